@@ -1,6 +1,6 @@
 /* GIMP RGBA C-Source image dump (bird_right2.c) */
 
-static const struct
+static struct
 {
   unsigned int width;
   unsigned int height;
@@ -1,6 +1,6 @@
 /* GIMP RGBA C-Source image dump (teleporter.c) */
 
-static const struct {
+static struct {
   unsigned int 	 width;
   unsigned int 	 height;
   unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
@@ -1,169 +0,0 @@
-/* GIMP RGBA C-Source image dump (dk.c) */
-
-static const struct
-{
-  unsigned int width;
-  unsigned int height;
-  unsigned int bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  unsigned char pixel_data[32 * 32 * 4 + 1];
-} dk_image = {
-    34,
-    32,
-    4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\000\034\015\000%\034\015"
-    "\000\254\034\015\000\254\034\015\000\254\034\015\000&\034\015\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000)\034\015\000\063\177\000\000\377"
-    "\210\000\025\377\210\000\025\377\210\000\025\377\034\015\000\377\034\015\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000Z\177\000\000\353\177\000\000"
-    "\377\210\000\025\377\210\000\025\377\210\000\025\377\177\000\000\377\034\015\000\204\034\015"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\014\034\015\000r\177\000\000"
-    "\352\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210"
-    "\000\025\377\177\000\000\327\034\015\000\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000"
-    "\000\034\015\000\205k\061\035\377\277\200O\377\277\200O\377\277\200O\377\277\200"
-    "O\377\277\200O\377\210\000\025\377\210\000\025\377\277\200O\377\277\200O\377\034"
-    "\015\000C\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\000\034\015\000\377\210\000\025\377\277\200"
-    "O\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\357\257`\377\357"
-    "\257`\377\343\320w\377\343\320w\377\277\200O\351\034\015\000k\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\063\034\015\000\336\034\015\000\336\034\015\000\336\034"
-    "\015\000\336\034\015\000T\210<\"\336\210<\"\377\210\000\025\377\277\200O\377\343\320"
-    "w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343"
-    "\320w\377\343\320w\377\277\200O\360\034\015\000z\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\034\015\000R\177\000\000\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025"
-    "\377\034\015\000\377\343\320w\377\357\257`\377\210\000\025\377\277\200O\377\277"
-    "\200O\377\343\320w\377\343\320w\377\343\320w\377\277\200O\377\357\257`\377"
-    "\277\200O\377\343\320w\377\034\015\000\263\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034"
-    "\015\000n\177\000\000\365\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210"
-    "\000\025\377\034\015\000\377\343\320w\377\357\257`\377\210\000\025\377\277\200O\377"
-    "\277\200O\377\364\364\364\377\364\364\364\377\364\364\364\377\277\200O\377"
-    "\357\257`\377\210<\"\377\364\364\364\377\277\200O\360\034\015\000\177\034\015\000"
-    "\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\034\015\000'\177\000\000\267\210\000\025\377\210\000\025\377\210\000\025\377\210"
-    "\000\025\377\210\000\025\377\210\000\025\377\177\000\000\377\277\200O\377\357\257`\377"
-    "\210<\"\377\357\257`\377\343\320w\377\343\320w\377\357\257`\377\343\320w"
-    "\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\357\257`\377\277"
-    "\200O\377\210<\"\241\034\015\000\024\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000e\177\000\000\377\210\000\025\377\210\000\025"
-    "\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\034"
-    "\015\000\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377"
-    "\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320"
-    "w\377\343\320w\377\343\320w\377\277\200O\377k\061\035\255\034\015\000\036\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000e\177\000"
-    "\000\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210"
-    "\000\025\377\210\000\025\377\034\015\000\377\343\320w\377\343\320w\377\343\320w\377"
-    "\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320"
-    "w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\277"
-    "\200O\377k\061\035\\\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\034\015\000e\177\000\000\377\210\000\025\377\210\000\025\377\210\000\025\377\210"
-    "\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\034\015\000\377\343\320w\377"
-    "\343\320w\377\343\320w\377\277\200O\377\277\200O\377\357\257`\377\343\320"
-    "w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343"
-    "\320w\377\343\320w\377\357\257`\377\210<\"\376\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000e\034\015\000\377\210\000\025\377"
-    "\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025"
-    "\377\034\015\000\377\277\200O\377\343\320w\377\343\320w\377\343\320w\377\343"
-    "\320w\377\277\200O\377\210<\"\377\210<\"\377\210<\"\377\210<\"\377\210<\""
-    "\377\210<\"\377\210<\"\377\210<\"\377\210<\"\377k\061\035e\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\064\177\000\000\377\177\000\000\377"
-    "\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025"
-    "\377\210\000\025\377\034\015\000\377\177\000\000\377\277\200O\377\343\320w\377\343\320"
-    "w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343"
-    "\320w\377\343\320w\377\343\320w\377\343\320w\377\277\200O\377\034\015\000\315"
-    "\034\015\000&\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000"
-    "\064\177\000\000\377\177\000\000\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000"
-    "\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377k\061\035\377\277"
-    "\200O\377\277\200O\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377"
-    "\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320"
-    "w\377\277\200O\276\034\015\000\036\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\034\015\000)\034\015\000\326\210\000\025\377\177\000\000\377\210\000\025\377\210"
-    "\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377"
-    "\210\000\025\377k\061\035\377\210<\"\377\304\000\000\377\277\200O\377\210<\"\377\343"
-    "\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377"
-    "\343\320w\377\210<\"\255\034\015\000\025\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\063\034\015\000\377\210\000\025\377\210\000\025\377"
-    "\034\015\000\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025"
-    "\377\210\000\025\377\210\000\025\377\177\000\000\377\177\000\000\377\304\000\000\377\304\000"
-    "\000\377\277\200O\377\277\200O\377\210\000\025\377\210\000\025\377\210\000\025\377\210"
-    "\000\025\377\210\000\025\377\177\000\000\377\034\015\000\230\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\255\177\000\000\377\210"
-    "\000\025\377\210\000\025\377\034\015\000\377\210\000\025\377\210\000\025\377\210\000\025\377"
-    "\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\177\000\000"
-    "\377\177\000\000\377\177\000\000\377\343\320w\377\277\200O\377\210\000\025\377\210\000"
-    "\025\377\210\000\025\377\210\000\025\377\210\000\025\377\177\000\000\377\034\015\000\230\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034"
-    "\015\000\377\210\000\025\377\210\000\025\377\210\000\025\377\177\000\000\377\210\000\025\377"
-    "\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025"
-    "\377\210\000\025\377\177\000\000\377\377\006\006\377\304\000\000\377\210<\"\377\210\000\025"
-    "\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377\177"
-    "\000\000\377\034\015\000\230\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\034\015\000\377\210\000\025\377\210\000\025\377\210\000\025\377\210"
-    "\000\025\377\034\015\000\377\210<\"\377\277\200O\377\277\200O\377\277\200O\377\277"
-    "\200O\377\277\200O\377\210\000\025\377\304\000\000\377\377\006\006\377\377\006\006\377\377"
-    "\006\006\377\177\000\000\377\210\000\025\377\210\000\025\377\210\000\025\377\210\000\025\377"
-    "\210\000\025\377\177\000\000\377\034\015\000\230\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\377\210\000\025\377\210\000\025\377"
-    "\210\000\025\377\210\000\025\377\034\015\000\377\343\320w\377\343\320w\377\343\320"
-    "w\377\343\320w\377\343\320w\377\343\320w\377\277\200O\377\277\200O\377\375"
-    "\261\000\377\375\261\000\377\375\261\000\377\177\000\000\377\277\200O\377\343\320w"
-    "\377\343\320w\377\343\320w\377\343\320w\377\277\200O\377\034\015\000\230\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000k\061"
-    "\035\377\277\200O\377\277\200O\377\210\000\025\377\210\000\025\377\034\015\000\377\343"
-    "\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377"
-    "\343\320w\377\357\257`\377\375\261\000\377\377\343\000\377\375\261\000\377\210"
-    "<\"\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377"
-    "\357\257`\377\034\015\000\230\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\034\015\000{\357\257`\377\343\320w\377\343\320w\377\277\200"
-    "O\377\277\200O\377\034\015\000\377\343\320w\377\343\320w\377\343\320w\377\343"
-    "\320w\377\343\320w\377\343\320w\377\343\320w\377\277\200O\377\375\261\000\377"
-    "\375\261\000\377\375\261\000\377\210<\"\377\343\320w\377\343\320w\377\343\320"
-    "w\377\343\320w\377\343\320w\377\357\257`\377\034\015\000\230\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000\315\343\320w\377"
-    "\343\320w\377\343\320w\377\343\320w\377\343\320w\377k\061\035\377\343\320w"
-    "\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343"
-    "\320w\377\277\200O\377\377\006\006\377\304\000\000\377\177\000\000\377\343\320w\377\343"
-    "\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\034\015\000\265"
-    "\034\015\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\034\015\000\315\343\320w\377\343\320w\377\343\320w\377\343\320w\377\210<\""
-    "\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343\320w\377\343"
-    "\320w\377\343\320w\377\343\320w\377\277\200O\377\177\000\000\377\177\000\000\377"
-    "\034\015\000\256\357\257`\377\343\320w\377\343\320w\377\343\320w\377\343\320"
-    "w\377\277\200O\377\034\015\000l\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\034\015\000R\277\200O\377\277\200O\377\277\200O\377"
-    "\277\200O\377k\061\035\377\277\200O\377\357\257`\377\343\320w\377\343\320w"
-    "\377\343\320w\377\343\320w\377\343\320w\377\277\200O\377\210<\"\300\034\015"
-    "\000\300\034\015\000\205\034\015\000\024k\061\035\204\277\200O\377\277\200O\377\277\200"
-    "O\377\277\200O\377\034\015\000f\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\034\015\000\000\034\015\000\314\034\015\000\314\034\015\000\314\034\015\000\314\034\015"
-    "\000\314\034\015\000\314\034\015\000\233\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
@@ -1,173 +0,0 @@
-/* GIMP RGBA C-Source image dump (dk_right2.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} dk_right2 = {
-  32, 32, 4,
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\367\061\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\336\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245"
-  "c\377\214\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\377\377\377\377\377\377\377\377\245c\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\377\245c\352\377\245c\377\367\061\000\377\377\245c\377\377\245"
-  "c\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\377\377\377\000\000\000\377\377\245c\377\214\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\377\245c\377\377\245c\377\367\061\000\377\377\245c\377\377\245"
-  "c\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377\377\245"
-  "c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\377\245c\377\377\245c\377\367\061\000\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\302\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\367\061\000\377\354\245\026\377\367\061\000\377\367\061"
-  "\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377\354\245\026"
-  "\377\354\245\026\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\354\245\026\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\354\245\026\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\354\245\026\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026"
-  "\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\354\245\026\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061"
-  "\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377"
-  "\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\354\245\026\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\354\245\026\377\354\245\026\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\354\245\026\377"
-  "\354\245\026\377\354\245\026\377\354\245\026\377\354\245\026\377\214\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367"
-  "\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367"
-  "\061\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245ch\367\061\000'\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000"
-  "\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\352\367\061\000\311"
-  "\367\061\000?\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245"
-  "c\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\232\377\245co\000\000\000\377\000\000\000\377\377\245"
-  "c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\311\377\245c\311"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\367\061\000\377"
-  "\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377"
-  "\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\367\061\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\367\061\000\377\354\245\026\377\354\245\026\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c"
-  "\377\377\245c\377\377\245c\377\367\061\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\354\245\026\377"
-  "\377\245c\377\367\061\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c"
-  "\377\377\245c\377\377\245c\377\367\061\000\377\367\061\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\245\026\377\354\245\026\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\367\061\000\377\377\245c\377\377\245c\377\367\061\000\377\367\061\000\377\367\061"
-  "\000\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\354\245\026\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c"
-  "\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\236\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\214\000\000\377\214\000\000\326\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377"
-  "\367\061\000\377\367\061\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245"
-  "c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\311\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c"
-  "\377\377\245c\377\214\000\000\377\214\000\000\311\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\330\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377",
-};
-
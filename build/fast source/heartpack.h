@@ -1,154 +0,0 @@
-/* GIMP RGBA C-Source image dump (heartpack.c) */
-
-static const struct
-{
-  unsigned int width;
-  unsigned int height;
-  unsigned int bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  unsigned char pixel_data[32 * 32 * 4 + 1];
-} heartpack = {
-    32,
-    32,
-    4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\206\062,\377\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\333\334\334\377\334\335\335\377\271)\040\377\314\232\232\377"
-    "\333\071N\377\000\000\000\000\314\232\232\377\000\000\000\000\343\344\344\377\313\070I\377"
-    "\000\000\000\000\000\000\000\000\231\061.\377\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232\377\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\251//\377\313\231\231\377\317"
-    "\272\273\377\326\300\301\377\326\300\301\377\326\300\301\377@\066)\377\326"
-    "\300\301\377:\003B\377@\066)\377\314\232\232\377\317\272\273\377\275\070E\377"
-    "\310\227\227\377\000\000\000\000\000\000\000\000\377\021\021\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\265\242\242\377\314\232\232\377\326\300\301\377\326\300\301"
-    "\377\326\300\301\377\326\300\301\377\326\300\301\377\314\232\232\377\326"
-    "\300\301\377\326\300\301\377\326\300\301\377\326\300\301\377\326\300\301"
-    "\377\306\262\262\377\306\262\262\377\333\071N\377\326\300\301\377:\003B\377"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\020'\004\377\231\211\207\377\333\071N\377\326\300\301"
-    "\377{ss\377\224cc\377\224cc\377\224cc\377{ss\377@\066)\377\326\300\301\377"
-    "\326\300\301\377@\066)\377\224cc\377\224cc\377\224cc\377{ss\377{ss\377\326"
-    "\300\301\377\326\300\301\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\021\021\377\314\232"
-    "\232\377\326\300\301\377{ss\377\255::\377\377ss\377\377tt\377\377OO\377\351"
-    "\013\013\377\225\032\032\377\310\276\276\377\310\276\276\377\225\032\032\377\351"
-    "\000\000\377\377\000\000\377\351\000\000\377\224cc\377f\000\000\377\326\300\301\377\326\300"
-    "\301\377\326\300\301\377\020'\004\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\251//\377\000\000\000\000\000\000\000\000\343\344\344\377\326\300\301"
-    "\377\326\300\301\377\276@@\377\361~~\377\377\343\343\377\377\345\345\377"
-    "\377\240\240\377\372$$\377\351\013\013\377\235VV\377\235VV\377\351\014\014\377"
-    "\372\000\000\377\377\000\000\377\372\000\000\377\360\000\000\377\247\000\000\377sCC\377\326\300"
-    "\301\377\326\300\301\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232\377:\003B\377vie\377\326\300\301"
-    "\377\305\000\000\377\377\221\221\377\377\365\365\377\377\316\316\377\377\200"
-    "\200\377\377\033\033\377\375\000\000\377\322\000\000\377\322\000\000\377\375\000\000\377\377"
-    "\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\265\000\000\377h\000\000\377\326\300"
-    "\301\377\326\300\301\377;\017@\377\320$\035\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\347\035\030\377\201ro\377\326"
-    "\300\301\377\305\000\000\377\377\202\202\377\377\320\320\377\377vv\377\377\000"
-    "\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000"
-    "\000\377\377\000\000\377\377\000\000\377\377\000\000\377\265\000\000\377h\000\000\377\326\300\301"
-    "\377\326\300\301\377@\066)\377\213\062-\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\216\062-\377\000\000\000\000\314\232\232\377\326\300\301"
-    "\377\326\300\301\377\305\000\000\377\377>>\377\377hh\377\377::\377\377\000\000\377"
-    "\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377"
-    "\377\000\000\377\377\000\000\377\377\000\000\377\265\000\000\377i\000\000\377\326\300\301\377"
-    "\326\300\301\377\236\060.\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\314\232\232\377\000\000\000\000\016\035\010\377\314\232\232\377\307\263"
-    "\263\377\326\300\301\377\305\000\000\377\377mm\377\377\262\262\377\377jj\377"
-    "\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377"
-    "\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\265\000\000\377k\000\000\377\326"
-    "\300\301\377\326\300\301\377\314\232\232\377\343\344\344\377\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314"
-    "\232\232\377\326\300\301\377\302((\377\372\213\213\377\377\340\340\377\377"
-    "\206\206\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377"
-    "\377\000\000\377\377\000\000\377\377\000\000\377\375\000\000\377\371\000\000\377\260\000\000\377"
-    "q++\377\326\300\301\377\326\300\301\377\000\000\000\000\333\071N\377\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\310&\036\377\314\232\232"
-    "\377\251\227\226\377\326\300\301\377\252\244\244\377\233\063\063\377\373@@"
-    "\377\376##\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377"
-    "\377\000\000\377\377\000\000\377\376\000\000\377\345\000\000\377\250\001\001\377\326\300\301"
-    "\377\245\244\244\377\326\300\301\377\302\256\256\377\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\333\071N\377\317\271\272\377\326\300\301\377\253\213\213\377\313\000\000"
-    "\377\360\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\377\000\000"
-    "\377\377\000\000\377\376\000\000\377\355\000\000\377\274\000\000\377~\000\000\377\223\213\213"
-    "\377\326\300\301\377\306\262\262\377<!:\377\221\061-\377\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\263\207\206\377\000"
-    "\000\000\000\343\344\344\377=$\070\377\311\264\265\377\343\344\344\377\207gg\377"
-    "\315\070\070\377\366\000\000\377\376\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377"
-    "\375\000\000\377\360\000\000\377\304\000\000\377s\070\070\377ogg\377\326\300\301\377\326"
-    "\300\301\377\314\267\267\377\327\330\330\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000j\064"
-    "+\377XME\377\272\246\246\377\326\300\301\377\322\317\317\377\222ss\377\316"
-    "\000\000\377\375\000\000\377\377\000\000\377\377\000\000\377\377\000\000\377\365\000\000\377\274"
-    "\000\000\377|\000\000\377{ss\377\326\300\301\377\317\271\272\377\265\242\242\377"
-    "<\033<\377tfb\377\314\232\232\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000fZU\377\020'\004\377"
-    "\326\300\301\377\326\300\301\377\326\300\301\377\271\202\202\377\314\023\023"
-    "\377\370\000\000\377\377\000\000\377\361\000\000\377\304\000\000\377\203\023\023\377\220\202"
-    "\202\377\326\300\301\377\302\256\256\377\216~|\377\217\177}\377\377\021\021"
-    "\377ZUN\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000r\064+\377|nk\377\333\071N\377\251\250\247"
-    "\377\326\300\301\377\326\300\301\377\326\300\301\377\224cc\377\336$$\377"
-    "\354\000\000\377\323\000\000\377|$$\377pcc\377\303\303\303\377\326\300\301\377\240"
-    "\217\216\377\326\300\301\377\343\344\344\377\000\000\000\000\212\061%\377\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\213\062-\377\000\000\000\000\000\000\000\000\204ur\377\377\021\021\377\326"
-    "\300\301\377\326\300\301\377\326\300\301\377\214UU\377\230\000\000\377\216\000"
-    "\000\377hUU\377\326\300\301\377\326\300\301\377\241\220\217\377\314\232\232"
-    "\377\020'\004\377\333\071N\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000_SM\377\252\230\230\377\020'\004\377\326\300\301\377\326\300"
-    "\301\377\326\300\301\377\205qq\377\205qq\377\313\313\313\377\326\300\301"
-    "\377\326\300\301\377RG?\377\326\300\301\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232\377\000\000\000\000\000\000\000\000qd`\377"
-    "\260\236\235\377\326\300\301\377\326\300\301\377\326\300\301\377\225\224"
-    "\224\377\225\224\224\377\344\344\344\377\343\344\344\377rnj\377\306\225\225"
-    "\377<\033<\377\322\323\322\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\333\071N\377pc_\377\220\200\177"
-    "\377\326\300\301\377\326\300\301\377\321\274\277\377\377\377\377\377\251"
-    "//\377\314\232\232\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000~`"
-    "\\\377{\063,\377:\003B\377Y\013\026\377O\010\021\377\251//\377<\033<\377\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "[\017\017\377Y\013\026\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\\W\377^\\W\377^\\"
-    "W\377^\\W\377^\\W\377^\\W\377^\\W\377^\\W\377g\027!\377O\010\021\377LKG\377"
-    "LKG\377LKG\377LKG\377LKG\377QOL\377QOL\377QOL\377\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "LKG\377^\\W\377^\\W\377LKG\377LKG\377LKG\377LKG\377\007\006\005\377Y\013\026\377"
-    "g\027!\377g\027!\377Y\013\026\377Y\013\026\377g\027!\377\007\006\005\377LKG\377LKG\377"
-    "LKG\377LKG\377QOL\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000LKG\377LKG\377ZYT\377LKG\377"
-    "LKG\377LKG\377LKG\364\007\006\005\364\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007"
-    "\006\005\377\007\006\005\377\007\006\005\377LKG\377LKG\377ZYT\377LKG\377LKG\377LKG\377\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000LKG\377QOL\377LKG\377LKG\377ZYT\377LKG\377LKG\377LKG\323LKG\323LKG"
-    "\377LKG\377ED@\377LKG\377ED@\377ED@\377ED@\377LKG\377LKG\377ZYT\377LKG\377"
-    "ZYT\377ZYT\377LKG\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000LKG\377ZYT\377LKG\377LKG\377LKG\377ZYT\377LKG\377ZYT"
-    "\377LKG\377LKG\377LKG\377LKG\377ZYT\377LKG\377LKG\377ZYT\377ZYT\377ZYT\377"
-    "LKG\377LKG\377LKG\377LKG\377ZYT\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000",
-};
@@ -1,145 +0,0 @@
-/* GIMP RGBA C-Source image dump (ladder.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} ladder = {
-  32, 32, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377"
-  "\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\015sz\377\015\221\232\377\015sz\377\015sz\377\015sz\377\015sz\377\015s"
-  "z\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015s"
-  "z\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221\232\377\015sz\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\015sz\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221\232\377"
-  "\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\015\221\232\015\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\015\221\232\005\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\015\221\232\015\015sz\377\015\221\232\377\015sz\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\015\221\232\003\015sz\377\015\221\232\377\015sz\377\015sz\377\015sz\377\015sz\377"
-  "\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377"
-  "\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221\232\377\015sz\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\015\221\232\004\015sz\377\015\221\232\377\015\221\232\377\015\221\232\377\015"
-  "\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\015\015sz\377\015\221\232\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\013\015sz\377\015\221\232"
-  "\377\015sz\377\015sz\013\015sz\010\015sz\017\015sz\003\015sz\002\015sz\001\015sz\001\015sz\004"
-  "\015sz\016\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\015\015sz\377\015"
-  "\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\004\015sz\377\015\221\232\377\015sz\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\013\015sz\377\015\221\232"
-  "\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\015\221\232\002\015sz\377\015\221\232\377\015sz\377\015sz\377"
-  "\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377"
-  "\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221\232"
-  "\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\015\221\232\003\015sz\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\006\015sz\377\015\221"
-  "\232\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\006\015sz\377\015\221"
-  "\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377"
-  "\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\006\015sz\377\015\221\232\377\015"
-  "sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232"
-  "\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\015\221\232\010\015sz\377\015\221\232\377\015sz\377\015sz"
-  "\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz"
-  "\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221"
-  "\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\015\221\232\020\015sz\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221"
-  "\232\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232"
-  "\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015"
-  "\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015s"
-  "z\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221\232\377\015sz\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015\221\232\377\015\221\232\377\015"
-  "\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377"
-  "\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377"
-  "\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377"
-  "\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377"
-  "\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377"
-  "\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\015sz\377\015\221\232\377\015sz\377\015sz\377\015sz\377\015sz\377\015s"
-  "z\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015s"
-  "z\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221\232\377\015sz\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\015sz\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232\377\015\221\232"
-  "\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015"
-  "sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015sz\377\015\221\232\377"
-  "\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\352\015sz\007\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\015sz\377\015\221\232\377\015sz\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
@@ -1,167 +0,0 @@
-/* GIMP RGBA C-Source image dump (platform.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} platform = {
-  32, 32, 4,
-  "\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224"
-  "\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030"
-  "\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036"
-  "\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377"
-  "\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224"
-  "\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030"
-  "\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036"
-  "\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377"
-  "\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224"
-  "\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030"
-  "\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036"
-  "\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377"
-  "\224\030\036\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\032"
-  "\016\016\377\032\016\016\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\032\016\016\377\032\016\016\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\032\016\016\377\032\016\016\377\032"
-  "\016\016\377\032\016\016\377\032\016\016\377\032\016\016\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\032\016\016\352\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\032\016\016\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\032\016\016\352\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061"
-  "\070\000\032\016\016\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\032\016\016\377\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333"
-  "\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016"
-  "\016\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#"
-  "*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\060\012\014\377\333\061\070"
-  "\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070"
-  "\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016\016\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\060\012\014\377\333\061\070\000\333\061\070\000\333"
-  "\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333"
-  "\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016\016\377\275#*\377\275#"
-  "*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\060\012\014\377\333\061\070\000\333\061\070\000\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\333\061\070\000\032\016\016\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\032\016\016\377"
-  "\032\016\016\377\032\016\016\377\032\016\016\377\032\016\016\377\032\016\016\377\032\016\016"
-  "\377\032\016\016\377\032\016\016\377\060\012\014\377\333\061\070\000\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016\016\377\032\016\016\377\032\016"
-  "\016\377\032\016\016\377\032\016\016\377\032\016\016\377\032\016\016\377\032\016\016\377"
-  "\032\016\016\377\032\016\016\377\257#*\377\257#*\377\257#*\377\257#*\377\257#*"
-  "\377\257#*\377\257#*\377\257#*\377\257#*\377\060\012\014\377\333\061\070\000\333"
-  "\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333"
-  "\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016\016\377\257"
-  "#*\377\257#*\377\257#*\377\257#*\377\257#*\377\257#*\377\257#*\377\257#*"
-  "\377\257#*\377\244\037%\377\244\037%\377\244\037%\377\244\037%\377\244\037%\377"
-  "\244\037%\377\244\037%\377\244\037%\377\244\037%\377\060\012\014\377\333\061\070\000"
-  "\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000"
-  "\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016\016\377"
-  "\244\037%\377\244\037%\377\244\037%\377\244\037%\377\244\037%\377\244\037%\377"
-  "\244\037%\377\244\037%\377\244\037%\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\060\012\014"
-  "\377\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070"
-  "\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016\016\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\032\016\016\377\333\061"
-  "\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\032\016\016\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\032\016\016\377\333\061\070\000\333\061"
-  "\070\000\333\061\070\000\333\061\070\000\333\061\070\000\333\061\070\000\032\016\016\352\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\032\016\016\377\032\016\016\377\032\016\016\377\032\016\016"
-  "\377\032\016\016\377\032\016\016\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\032\016\016\377\032\016\016\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\032\016\016\377\032\016\016"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377"
-  "\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275"
-  "#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*\377\275#*"
-  "\377\275#*\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224"
-  "\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030"
-  "\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036"
-  "\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377"
-  "\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224"
-  "\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030\036\377\224\030"
-  "\036\377\224\030\036\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034"
-  "\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377"
-  "\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210"
-  "\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027"
-  "\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034"
-  "\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377\210\027\034\377"
-  "\210\027\034\377\210\027\034\377\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000"
-  "\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016"
-  "\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016"
-  "\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016"
-  "\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016"
-  "\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016"
-  "\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016"
-  "\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016"
-  "\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016"
-  "\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032\016\016\000\032"
-  "\016\016\000\032\016\016\000\032\016\016\000",
-};
-
@@ -1,46 +0,0 @@
-/*
- * Copyright (C) 2018 bzt (bztsrc@github)
- *
- * Permission is hereby granted, free of charge, to any person
- * obtaining a copy of this software and associated documentation
- * files (the "Software"), to deal in the Software without
- * restriction, including without limitation the rights to use, copy,
- * modify, merge, publish, distribute, sublicense, and/or sell copies
- * of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be
- * included in all copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
- * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
- * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
- * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
- * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
- * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
- * DEALINGS IN THE SOFTWARE.
- *
- */
-
-
-void uart_init();
-void uart_send(unsigned int c);
-void spin_for_cycles(int c);
-char uart_getc();
-void uart_puts(char *s);
-void uart_hex(unsigned int d);
-
-/*
-#define PERIPHERAL_BASE 0xFE000000
-
-void uart_init();
-void uart_writeText(char *buffer);
-void uart_loadOutputFifo();
-unsigned char uart_readByte();
-unsigned int uart_isReadByteReady();
-void uart_writeByteBlocking(unsigned char ch);
-void uart_update();
-void mmio_write(long reg, unsigned int val);
-unsigned int mmio_read(long reg);
-*/
@@ -1,153 +0,0 @@
-/* GIMP RGBA C-Source image dump (bananarangpack.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} bananarangpack = {
-  32, 32, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\251//\030\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\343\344\344\016\343\344\344\007\377\021\021\004\314\232\232\007\333\071N\010"
-  "\000\000\000\000\314\232\232&\000\000\000\000\343\344\344\027\333\071N\010\000\000\000\000\000\000\000\000\251"
-  "//\006\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\333\071N\232\333\071N\323\377\377\377\377\314\232\232\232\326\300\301\003"
-  "\333\071N\332\326\300\301\003\326\300\301\015\000\000\000\000\326\300\301\033:\003B\026\000"
-  "\000\000\000\314\232\232\015\326\300\301\016\333\071N\005\314\232\232\006\000\000\000\000\000\000"
-  "\000\000\377\021\021\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232\377\326\300\301\377"
-  "\326\300\301\377\326\300\301\350\326\300\301\234\314\232\232\323\326\300"
-  "\301\005\326\300\301\001\326\300\301\004\314\232\232\011\326\300\301\"\326\300\301"
-  "\014\326\300\301\030\326\300\301\"\326\300\301\014\326\300\301\006\326\300\301"
-  "\004\333\071N\005\326\300\301\002:\003B\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232\377\333\071N\377\326"
-  "\300\301\377\326\300\301\377\015\012\010\377\015\012\010\377\326\300\301\377\326"
-  "\300\301\323\224cc\201\333\071N\223{ss\013\000\000\000\000\326\300\301\032\326\300\301"
-  "&\000\000\000\000\224cc\020\224cc\002\000\000\000\000{ss\001{ss\001\000\000\000\000\326\300\301\003\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\314\232\232\377\326\300\301\377\015\012\010\352P\066\013\377T;\021\377"
-  "\015\012\010\377\326\300\301\323\377\377\377\377:\003B\244\351\013\013\005\225\032"
-  "\032\007\310\276\276\027\310\276\276\005\225\032\032\003\351\000\000\005\377\000\000\001\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\326\300\301\001\020'\004\017\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\251//\377\000\000\000\000\377\377\377\377"
-  "\326\300\301\377\015\012\010\377T;\021\377]E\034\377\015\012\010\364\326\300\301"
-  "\342\326\300\301\377\326\300\301\344\351\013\013\264\351\013\013\002\235VV\002\235"
-  "VV\005\351\014\014\003\372\000\000\001\377\000\000\002\000\000\000\000\360\000\000\001\247\000\000\003\314\232"
-  "\232\364\351\013\013\213:\003B\352\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232n\326\300\301\326\217{"
-  "ov\015\012\010\327\015\012\010\377.#\021\323\217{oY\326\300\301\354\326\300\301"
-  "\377\314\232\232\377\016\035\010\270\000\000\000\000\322\000\000\003\375\000\000\003\377\000\000\001\377"
-  "\000\000\001\377\000\000\001\326\300\301\024\377\377\377\377\351\013\013x\326\300\301\323"
-  "\314\232\232\377:\003B\070\377\021\021\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\333\071N\377\326\300\301\326\217{ow.#\021\327\334"
-  "\255\062\377\357\301H\377.#\021\327.#\021m\326\300\301\333\326\300\301\236\326"
-  "\300\301\377\351\013\013\251\314\232\232?\314\232\232\204\377\000\000\004:\003B\236"
-  "\377\000\000\021\351\013\013\203\326\300\301\377\326\300\301\377\326\300\301\377"
-  "\326\300\301\377\326\300\301\377\314\232\232\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\251//O\314\232\232\377\326\300\301\326\326"
-  "\300\301\377.#\021\377\341\257'\377\354\273<\377\362\273M\377.#\021\333.#\021"
-  "\210\326\300\301\377\326\300\301\377\326\300\301\377\326\300\301\311\326"
-  "\300\301\377\326\300\301\377\326\300\301\377\326\300\301\377\326\300\301"
-  "\377\326\300\301\377.#\021\330.#\021\331.#\021Q\326\300\301\352:\003B\377\351"
-  "\013\013\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232\221\377\377"
-  "\377\377\016\035\010:\326\300\301\326\326\300\301\377.#\021\377\337\255#\377"
-  "\344\263\061\377\361\302H\377\370\314W\377.#\021\377.#\021\236\326\300\301\221"
-  "\326\300\301\377\326\300\301\377\326\300\301\377\326\300\301\377\326\300"
-  "\301\344.#\021\032.#\021\333.#\021\354~e=\377~e=\377.#\021\377\326\300\301\377"
-  "\314\232\232\352\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\333\071N\371\000\000\000\000\314\232\232\377\326\300\301\377.#\021\377\337"
-  "\255#\377\336\254\"\377\350\271=\377\366\313W\377\372\320^\377.#\021\377."
-  "#\021\377.#\021\065\326\300\301\256\326\300\301\377\326\300\301\205.#\021\067"
-  ".#\021\352.#\021\377\366\311Q\377\340\260\066\377\306\231!\377.#\021\377\326"
-  "\300\301\377\314\232\232\354\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\377\021\021=\314\232\232\352\326\300\301\377\217{o\272"
-  ".#\021\354\337\254#\377\336\254\"\377\351\270\070\377\365\310Q\377\371\316"
-  "Z\377\371\317]\377.#\021\333.#\021\371.#\021\377.#\021\340.#\021\340\375\322^"
-  "\377\363\306N\377\356\276A\377\340\260\060\377\267\215\036\377.#\021\377\326"
-  "\300\301\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\333\071N\247\326\300\301\360\326\300\301\354"
-  ".#\021\374\327\246\"\377\332\251\"\377\336\254\"\377\347\266\061\377\362\301"
-  "A\377\371\314T\377\375\323_\377\376\325f\377\376\326f\377\375\324b\377\375"
-  "\322^\377\366\310P\377\346\265\062\377\336\254\"\377\315\236\040\377.#\021\377"
-  "\326\300\301\377\326\300\301\377:\003B\377\351\013\013\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232#\333\071NM\326\300\301"
-  "\266\326\300\301\377\217{o\272.#\021\354\314\235\040\377\332\251\"\377\336"
-  "\254\"\377\346\264,\377\352\271\066\377\360\302K\377\360\303M\377\360\303"
-  "M\377\360\304M\377\357\301I\377\347\266\062\377\340\255\040\377\323\243!\377"
-  "\267\216\060\377.#\021\377\326\300\301\377\314\232\232\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000:\003BK\326"
-  "\300\301\377\326\300\301\377\326\300\301\354\217{o\222.#\021\327\315\236\040"
-  "\377\321\241!\377\331\250\040\377\341\255\040\377\343\257\040\377\342\257\""
-  "\377\337\255\040\377\337\255\"\377\336\254!\377\337\255#\377\324\244!\377"
-  "\267\216\060\377.#\021\377\326\300\301\377\326\300\301\377\314\232\232\377"
-  "\016\035\010\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\377\377\377\377\326\300\301\377\326\300\301\311\326"
-  "\300\301\377\217{oo.#\021\354\266\214(\374\312\233\037\377\321\240\037\377\323"
-  "\242\040\377\322\242\"\377\317\240!\377\320\240\"\377\317\240!\377\303\226"
-  "-\377.#\021\377.#\021\377\326\300\301\377\326\300\301\377\326\300\301\377\314"
-  "\232\232\012\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\251//!\333\071N\250\333\071No\326\300\301\377\326"
-  "\300\301\377}pq\272.#\021\342\264\212\036\364\303\225\037\377\302\225\037\377"
-  "\302\225\037\377\302\225\037\377\303\226\037\377\267\216\060\377.#\021\377\217"
-  "{o\377\326\300\301\377\326\300\301\374\326\300\301\354\377\021\021\067:\003B\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\251//y\000\000\000\000\377\377\377\377\326\300\301\377\326\300\301"
-  "\377\326\300\301\377\326\300\301\323xcM[.#\021\327.#\021\377.#\021\377.#\021"
-  "\377kS\040\377_J\037\377\217{o\377\326\300\301\377\326\300\301\377\326\300"
-  "\301\354:\003B\272\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\333\071N"
-  "\250\326\300\301\032\326\300\301\377\326\300\301\377\326\300\301\377\326\300"
-  "\301\377\326\300\301\377\326\300\301\377\326\300\301\377\326\300\301\377"
-  "\326\300\301\377\326\300\301\377\326\300\301\377\326\300\301\377\326\300"
-  "\301\311:\003B\016\016\035\010\323\314\232\232\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\314\232\232\377\000\000\000\000\000\000\000\000\333\071N\377\326\300\301\236\326\300"
-  "\301\377\326\300\301\377\326\300\301\377\326\300\301\377\326\300\301\377"
-  "\326\300\301\377\326\300\301\377\326\300\301\377\314\232\232\354:\003B\210"
-  "\016\035\010\272\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\333\071N\377\326\300\301.\326\300\301^\326\300"
-  "\301\377\326\300\301\377\321\274\277\377\377\377\377\377\251//\377\314\232"
-  "\232\377:\003B\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\314\232\232H\251"
-  "//m:\003B\377Y\013\026\377O\010\021\377\251//\377:\003B\272\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000[\017\017\377Y\013"
-  "\026\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\\W\377^\\W\377^\\W\377^\\W\377^\\"
-  "W\377^\\W\377^\\W\377^\\W\377g\027!\377O\010\021\377LKG\377LKG\377LKG\377LK"
-  "G\377LKG\377QOL\377QOL\377QOL\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000?=:\377^\\W\377^"
-  "\\W\377LKG\377?=:\377LKG\377LKG\377\007\006\005\377Y\013\026\377g\027!\377g\027!\377"
-  "Y\013\026\377Y\013\026\377g\027!\377\007\006\005\377LKG\377LKG\377?=:\377LKG\377QOL"
-  "\377?=:\377?=:\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000?=:\377LKG\377?=:\377?=:\377?=:\377?=:\377LKG\377LKG\377"
-  "\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007"
-  "\006\005\377BA=\377BA=\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000QOL\377QOL\377LK"
-  "G\377LKG\377LKG\377?=:\377ED@\377LKG\377LKG\377LKG\377LKG\377ED@\377LKG\377"
-  "ED@\377ED@\377ED@\377BA=\377BA=\377?=:\377LKG\377LKG\377LKG\377?=:\377?="
-  ":\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000?=:\377?=:\377"
-  "?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?="
-  ":\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377?=:\377"
-  "?=:\377?=:\377?=:\377\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
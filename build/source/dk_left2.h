@@ -1,173 +0,0 @@
-/* GIMP RGBA C-Source image dump (dk_left2.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} dk_left2 = {
-  32, 32, 4,
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\367\061\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\336\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\367\061\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\377"
-  "\245c\377\377\245c\377\367\061\000\377\214\000\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377"
-  "\245c\377\377\377\377\377\377\377\377\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\214\000\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\377\245"
-  "c\377\000\000\000\377\377\377\377\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\214\000\000\377\377\245c\377\377\245c\377\367\061\000\377"
-  "\377\245c\377\377\245c\352\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\354\245\026\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\354\245\026\377\377\245c\377\377\245c\377\367\061"
-  "\000\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\302\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\367\061\000\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\354\245\026\377"
-  "\354\245\026\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\367\061\000\377\367\061\000\377\354\245\026\377\367\061\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\245\026\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245"
-  "\026\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\354\245\026\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377\367\061\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377\354\245"
-  "\026\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\367\061\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\354\245\026\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\354\245\026\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\354\245\026\377\354\245"
-  "\026\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377"
-  "\354\245\026\377\354\245\026\377\354\245\026\377\354\245\026\377\354\245\026\377"
-  "\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245ch\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\367\061\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\367\061\000?\367\061\000\311\377\245c\352\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\232\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367"
-  "\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\377"
-  "\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\377\245c\311\377"
-  "\245c\311\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377"
-  "\000\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\367\061\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\354\245\026\377\354\245\026\377\367\061\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\377"
-  "\367\061\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000"
-  "\377\214\000\000\377\367\061\000\377\377\245c\377\354\245\026\377\367\061\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\367"
-  "\061\000\377\367\061\000\377\367\061\000\377\377\245c\377\377\245c\377\367\061\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\354\245\026\377\354\245\026\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\367"
-  "\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367"
-  "\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\377"
-  "\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\326"
-  "\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\236\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\214\000\000\311\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\214\000\000\311\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\330\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377",
-};
-
@@ -1,172 +0,0 @@
-/* GIMP RGBA C-Source image dump (dk_up2.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} dk_ladder2 = {
-  32, 32, 4,
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\367\214\000\000\367\367"
-  "\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377"
-  "\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061"
-  "\000\377\367\061\000\377\367\061\000\377\214\000\000\367\214\000\000\367\377\245c\367\377"
-  "\245c\367\377\245c\367\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377"
-  "\214\000\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000"
-  "\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367"
-  "\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377"
-  "\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\377\245c\363\377\245c\363\377\245c\363\214\000\000\363\214\000\000\363\000\000"
-  "\000\377\000\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\367\061\000\377\367\061\000\377\377\245c\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\214\000"
-  "\000\377\214\000\000\377\000\000\000\377\000\000\000\377\367\061\000\377\367\061\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\377\245"
-  "c\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\326\214\000\000\326\367\061\000\377"
-  "\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377\354\245"
-  "\026\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\000\000\000\377\000\000\000\377\367\061\000\332\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061"
-  "\000\377\367\061\000\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\367\061\000\365\367\061\000\365\377\245c\365\377\245c\365\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367"
-  "\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061"
-  "\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367\061\000\377"
-  "\367\061\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367\061"
-  "\000\377\367\061\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367\061\000\377\367\061\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\251\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377"
-  "\245c\243\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026"
-  "\377\354\245\026\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\367\061\000\377\367\061\000\377\377\245c\377\377\245c\377\367\061\000\377\367"
-  "\061\000\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\377\367"
-  "\061\000\377\377\245c\377\377\245c\377\367\061\000\377\367\061\000\377\377\245c\367"
-  "\377\245c\367\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\377\367\061\000\377\377\245c\377"
-  "\377\245c\377\367\061\000\377\367\061\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377",
-};
-
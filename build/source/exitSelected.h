@@ -1,547 +0,0 @@
-/* GIMP RGBA C-Source image dump (exitSelected.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[90 * 36 * 4 + 1];
-} exit_selected = {
-  90, 36, 4,
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\241%\032\364\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\364"
-  "\374\370\372\364\375\370\367\365\375\370\367\365\375\370\367\365\375\370"
-  "\367\365\375\370\367\365\375\370\367\376\376\374\377\265\000\000\377\265\000\000"
-  "\377\376\376\374\377\366\375\367\365\366\375\370\366\340\356\344\375\265"
-  "\000\000\377\265\000\000\377\376\376\374\377\364\374\370\373\367\375\371\375\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\367\375\371\377\362\375\370\370\363\376"
-  "\371\364\364\376\371\364\364\376\371\364\364\376\371\364\364\376\371\364"
-  "\363\376\371\364\376\376\374\377\265\000\000\377\265\000\000\377\376\376\374\377"
-  "\364\376\373\361\365\376\373\361\365\376\373\361\365\376\373\361\365\376"
-  "\373\361\365\376\373\361\365\376\372\361\376\376\374\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376\377\377\376\376\374"
-  "\377\376\376\374\377\376\376\374\377\376\376\374\377\376\376\374\377\376"
-  "\376\374\377\376\376\374\377\265\000\000\377\265\000\000\377\376\376\374\377\376"
-  "\376\374\377\376\375\374\377\376\376\374\377\265\000\000\377\265\000\000\377\376"
-  "\376\374\377\376\377\377\377\372\375\373\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\373\376\376\377\375\377\377\377\376\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\374\377\377\377\376\376"
-  "\374\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
-  "\376\376\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\376\376\374\377\376\376\376\377\376\376\373\377\376\376\374\377\376"
-  "\376\374\377\376\376\374\377\376\376\374\377\376\376\374\377\354\364\355"
-  "\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376\374\377\376\375\374"
-  "\377\376\376\374\377\265\000\000\377\265\000\000\377\376\376\374\377\376\377\377"
-  "\377\372\375\373\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377"
-  "\376\376\374\377\376\376\374\377\375\376\377\377\376\376\377\377\376\376"
-  "\374\377\376\376\374\377\376\376\374\377\376\376\374\377\265\000\000\377\265"
-  "\000\000\377\376\376\374\377\376\376\374\377\376\376\374\377\373\377\374\377"
-  "\375\377\376\377\366\372\370\377\376\376\374\377\376\376\374\377\376\376"
-  "\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377"
-  "\376\376\376\377\376\376\374\377\376\376\374\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374"
-  "\377\376\376\374\377\376\375\374\377\376\376\374\377\265\000\000\377\265\000\000"
-  "\377\376\376\374\377\376\377\377\377\372\375\373\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\364\370\364\377\371\377\377\377"
-  "\377\375\377\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\367\377"
-  "\375\377\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376"
-  "\376\377\376\376\374\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376"
-  "\376\374\377\376\375\374\377\376\376\374\377\265\000\000\377\265\000\000\377\376"
-  "\376\374\377\376\377\377\377\372\375\373\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\362\366\361\377\371\377\377\377\377\375"
-  "\377\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\367\377\375\377"
-  "\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376\376\377"
-  "\376\376\373\377\376\376\374\377\376\376\374\377\376\376\374\377\376\376"
-  "\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\257\325\271\355"
-  "\376\376\374\377\376\376\374\377\354\363\354\376\376\376\374\377\376\376"
-  "\374\377\376\376\374\377\376\376\374\377\376\376\374\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\362\366\361\377\371\377\377"
-  "\377\377\375\377\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\370"
-  "\377\375\377\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376"
-  "\376\376\377\376\376\373\377\375\375\373\377\375\375\373\377\367\374\367"
-  "\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\374\373\377\374\376"
-  "\373\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\362\366\361\377\371\377\377\377\377"
-  "\375\377\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\370\377\376"
-  "\376\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376\376"
-  "\377\376\376\374\377\376\375\374\377\376\375\375\377\376\376\374\377\376"
-  "\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\376\376\374\377\373\376\373\377\372\377\373\377"
-  "\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\362\366\361\377\371\377\377\377\377\375\377"
-  "\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\367\377\376\376\376"
-  "\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376\376\377\376"
-  "\376\373\377\376\376\374\377\376\376\374\377\376\376\374\377\376\376\374"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\370"
-  "\373\370\377\370\373\370\377\376\376\374\377\376\376\374\377\376\376\374"
-  "\377\376\376\374\377\362\367\363\377\376\376\374\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\362\366\361\377\371\377\377\377"
-  "\377\375\377\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\367\377"
-  "\376\376\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376"
-  "\376\377\376\376\374\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\377"
-  "\375\377\377\377\376\376\377\366\371\364\377\265\000\000\377\265\000\000\377\376"
-  "\376\374\377\376\376\377\377\372\375\375\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\362\366\361\377\371\377\377\377\377\375"
-  "\377\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\367\377\376\376"
-  "\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376\377\377"
-  "\376\376\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\377\376\377"
-  "\377\377\377\376\377\366\370\364\377\265\000\000\377\265\000\000\377\376\376\374"
-  "\377\374\377\377\377\371\376\375\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\362\366\361\377\371\377\377\377\377\375\377\377"
-  "\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\366\377\367\377\376\376\376\377"
-  "\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\375\377\377\376\376\376"
-  "\377\366\374\366\373\374\375\372\377\374\375\372\377\372\374\371\377\372"
-  "\375\371\377\376\376\374\377\265\000\000\377\265\000\000\377\376\376\374\377\377"
-  "\376\377\377\377\377\376\377\366\370\364\377\265\000\000\377\265\000\000\377\376"
-  "\376\374\377\373\377\377\377\371\376\375\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\376\376\374\377\376\376\374\377\371\375\370\377\372\377\377\377"
-  "\376\376\376\377\370\374\370\377\371\374\370\377\371\374\370\377\376\376"
-  "\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\366"
-  "\377\370\377\376\376\376\377\376\376\374\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377"
-  "\377\375\376\377\377\374\375\377\376\375\374\377\376\375\373\377\376\375"
-  "\373\377\376\375\373\377\376\376\374\377\376\376\374\377\265\000\000\377\265"
-  "\000\000\377\376\376\374\377\377\377\377\377\376\377\376\377\376\376\374\377"
-  "\265\000\000\377\265\000\000\377\376\376\374\377\374\377\375\377\371\377\373\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\372\377\371\377\373\377\372\377\373"
-  "\377\372\377\373\377\377\377\376\376\376\377\375\377\375\377\375\377\374"
-  "\377\375\377\374\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\367\377\367\377\375\377\375\377\376\376\374\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\376\376\374\377\376\376\374\377\376\376\374\377\376\376\374\377"
-  "\376\376\374\377\376\376\374\377\376\376\374\377\376\376\374\377\363\371"
-  "\363\376\265\000\000\377\265\000\000\377\376\376\374\377\376\376\374\377\376\376"
-  "\374\377\376\376\374\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376"
-  "\374\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374"
-  "\377\376\376\374\377\376\376\374\377\376\376\374\377\376\376\374\377\376"
-  "\376\374\377\376\376\374\377\376\376\374\377\376\376\374\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\376\376\374\377\376\376"
-  "\374\377\376\376\374\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\252+\017\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377",
-};
-
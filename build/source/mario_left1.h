@@ -1,162 +0,0 @@
-/* GIMP RGBA C-Source image dump (mario_left1.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} mario_left1 = {
-  32, 32, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033"
-  "\323\035\034\033\241\035\034\033\250\035\034\033\250\035\034\033\250\035\034\033a\035\034"
-  "\033o\035\034\033o\035\034\033z\035\034\033\233\035\034\033\237\035\034\033\312\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\035\034\033\246\376\357\356<\375\331\327\254\373\266\262\377\370\067\023"
-  "\377\370>$\377\370\066\022\377\370\067\023\377\370\067\023\377\370\067\023\377\370"
-  "\067\023\377\035\034\033\323\035\034\033\270\035\034\033\311\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\035\034\033]\035\034\033\177\035\034\033\234\035\034\033\223\035\034\033"
-  "\311\376\343\342L\376\356\355\262\376\343\342\377\370\067\023\377\370\067\023"
-  "\377\370\067\023\377\370\067\023\377\370\067\023\376\370\067\023\374\370\067\023\371"
-  "\370\067\023\333\370\067\023\377\035\034\033\246\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\035\034\033\304\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023"
-  "\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377"
-  "\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370"
-  "\067\023\377\370\067\023\377\035\034\033\213\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\035\034\033\035\035\034\033=\035\034\033\331\366]+_\362\207C\233\357\230N\336"
-  "\357\235R\377\353\230P\377\336\211D\377\316s\061\377\342\214D\377\355\231"
-  "N\377\337\211B\377\304e\"\377\300_\034\377\300_\034\376\277`\034\240\035\034\033"
-  "\270\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\027\352\265]\012"
-  "\035\034\033\324\353\265]\242\353\265]\307\353\266^\356\346\261Z\377\323\240"
-  "N\377\235n!\377\235n!\377\327\244Q\377\347\262[\377\320\236M\377\255}\061"
-  "\377\304\223D\377\316\234K\376\301\220A\334\250x-m\035\034\033\204\035\034\033"
-  "\263\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\035\034\033\034\035\034\033T\035\034\033\236\352\266^\334\352"
-  "\266^\365\352\266^\373\352\266^\376\346\262[\377\332\250T\352\035\034\033\377"
-  "\347\347\347\377\336\254W\377\323\242O\377\264\205\070\377\235n!\377\330\246"
-  "S\377\347\263\\\377\315\234K\377\235n!\377\220a\016H\035\034\033\344\035\034\033"
-  "\332\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\036\034\033&\035\034\033\247\352\266^\241\351\265^\371\350\265]\376"
-  "\351\265]\377\340\255W\377\325\242P\331\326\244Q\310\346\263\\\377\350\264"
-  "]\377\343\260Z\377\304\223D\377\235n!\377\235n!\377\331\247S\377\350\264"
-  "]\377\316\235K\377\247x,\345\235n!\377\222c\023\070\035\034\033y\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\035\034\033\377\335\252UoP\067\015\377P\067\015\377P\067\015\377P\067\015\377P\067"
-  "\015\377\065(\022\242\307\227G\377\320\236M\377\336\253V\377\326\244Q\377\304"
-  "\224E\377\312\231I\377\341\256X\377\347\264\\\377\314\233K\377\245v*\375"
-  "\222c\022\331\223d\023c\035\034\033\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377\231"
-  "i\034\236yT\026\377yT\026\377yT\026\377yT\026\377yT\026\377yT\026\377\304\224E\377"
-  "\337\254W\377\351\265]\377\350\264]\377\350\264\\\377\350\263\\\377\331\246"
-  "S\373\235n!\377\235n!\377\222c\022\243\035\034\033\377\035\034\033\223\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377\263}&\377\263}&\377\263}&\377\263}&\377"
-  "\263}&\377\312\231H\377\342\257Y\377\351\266^\377\351\266`\377\351\266b\377"
-  "\352\261_\377\352\236U\371\315\206@\312\235n!\377\222d\024\177\035\034\033\311"
-  "\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377"
-  "\344\261Z\203yT\026\377yT\026\377\346\262[\325\350\263\\\371\351\265^\377\347"
-  "\265i\377\333\257\212\377\316\250\242\377\317\236\241\377\326x\230\364\336"
-  "]\200\240\035\034\033\377\035\034\033\223\035\034\033\236\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377\035\034\033\377\035\034"
-  "\033\377\353\263\\k\353\255\\\315\350\245i\367\326\244\223\377b\204\373\377"
-  "b\204\373\377b\204\373\377b\204\373\377x\223\362\377b\204\373\377\035\034\033"
-  "\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\035\034\033\232\355lc\062b\204\373\377b\204\373\377b\204"
-  "\373\377b\204\373\377\341N\060\377\360CV\377\341N\060\377x\223\362\377x\223"
-  "\362\377\370\067\023\377\035\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\035\034\033\270\035\034\033\250\035\034\033\250\035\034\033\250\035\034\033\251\035\034"
-  "\033yx\223\362\377\365\352\025\377b\204\373\377\334U\215\377\341N\060\377\370"
-  "\070\035\377\370\070\034\377\362@L\377b\204\373\377b\204\373\377b\204\373\377"
-  "\035\034\033\377\035\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033t\035\034\033m\035\034\033\377"
-  "\377\377\377\071\377\377\377\213\377\377\377\317\352\350\372\260\274\263\356"
-  "ub\204\373\377b\204\373\377\341N\060\377\365<\071\377\370\067\027\377\370\067"
-  "\022\377\302\071\035\377\302\071\035\377b\204\373\377b\204\373\377b\204\373\377"
-  "\370\067\023\377\035\034\033\377\035\034\033b\035\034\033R\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\336\377\377\377S"
-  "\377\377\377\261\377\377\377\332\377\377\377\353\377\377\377\372\372\343"
-  "\347\376\360\243\260\376\351Ek\376\355D]\377\366:\061\377\370\067\024\377\370"
-  "\067\023\377\302\071\035\377\266\063\030\377\266\063\030\377b\204\373\377b\204\373"
-  "\377x\223\362\377\370\067\023\377\370\067\023\377\035\034\033\377\035\034\033\027\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\036"
-  "\035\034\361\377\377\377c\377\377\377\322\377\377\377\374\377\377\377\376\377"
-  "\374\374\377\375\334\333\377\365<\071\377\365<\071\377\367\067\033\377\370\067"
-  "\025\377\370\067\023\377\370\067\020\377\302\071\035\377\266'\012\377b\204\373\377"
-  "b\204\373\377x\223\362\377x\223\362\377\266\063\030\377\035\034\033\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\036\035\034\361\377\377\377d\377\377\377\324\377\377\377\376\377"
-  "\374\374\377\375\334\333\377\372\237\232\377\370\067\025\377\370\065\017\377"
-  "\370\067\022\377\370\067\023\377\302\071\035\377\266\063\030\377\266\063\030\377b\204"
-  "\373\377b\204\373\377x\223\362\377x\223\362\377x\223\362\377\035\034\033\352"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\036\035\034\254\035\034\033\323\377\377\377\277\377\377"
-  "\377\357\376\373\373\360\372\316\317\366\302\071\035\377\302\071\035\377\302"
-  "\071\035\377\302\071\035\377\266\063\030\377\266\063\030\377\266\063\030\377b\204\373"
-  "\377i\204\343\377x\223\362\377x\223\362\377x\223\362\377x\223\362\377\035"
-  "\034\033a\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\035\034\033\254\035\034\033"
-  "\215\035\034\033\311\035\034\033\344\266\063\030\344\266\063\030\377\266\063\030\377"
-  "\266\063\030\377\266'\012\377b\204\373\377i\204\343\377i\204\343\377i\204\343"
-  "\377x\223\362\377b\204\373\377x\223\362\377x\223\362\377\035\034\033\311\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\236\035\034\033"
-  "\344\200}\355\271b\204\373\377b\204\373\377b\204\373\377i\204\343\377i\204"
-  "\343\377i\204\343\377d\204\372\377i\204\343\377x\223\362\377x\223\362\377"
-  "i\204\343\377x\223\362\377\035\034\033\311\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\035\034\033\254\035\034\033\377Cd\360gi\204\343\377i\204\343\377"
-  "i\204\343\377i\204\343\377i\204\343\377c\204\373\377b\204\373\377i\204\343"
-  "\377i\204\343\377i\204\343\377i\204\343\377c\204\372\377i\204\343\377\035"
-  "\034\033\220\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\272a"
-  "\202\372KTu\365\251Jk\361\351Jk\361\377Uv\365\377Uq\323\377Uq\323\377Uq\323"
-  "\377b\204\373\377b\204\373\377b\204\373\377b\204\373\377i\204\343\377c\204"
-  "\372\344c\204\372\344\035\034\033\210\035\034\033\333\035\034\033\377\035\034\033\377"
-  "\035\034\033\272\035\034\033\354\035\034\033e\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377b\204\373\207b\204\373\340"
-  "[}\370\376Pp\363\377Gg\360\377Jj\361\377Oo\363\377Uq\323\377Uq\323\377Uq"
-  "\323\377b\204\373\377b\204\373\377c\204\372\377c\204\372\344c\204\372\344"
-  "\223d$\303\224c\022\377\224c\022\377\224c\022\377\224c\022\354\224c\022\374\035"
-  "\034\033\352\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\035\034\033\246b\204\373Wb\204\373\265b\204\373\356^\200\371\377"
-  "Uq\323\377Cc\357\377Cc\357\377Cc\357\377Cc\357\377Uq\323\377b\204\373\376"
-  "b\204\373\377c\204\372\377c\204\372\374c\204\372\354\224c\022\311\224c\022"
-  "\377\224c\022\377\224c\022\323\224c\022\323\224c\022\377\035\034\033\323\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033"
-  "\331\035\034\033\323c\203\372\364c\203\372\321b\203\372\377b\203\372\377Uq\323"
-  "\377Uq\323\377Cc\357\377Cc\357\377Cc\357\377Uq\323\377Uq\323\377c\204\372"
-  "\377c\204\372\352c\204\372\255\224c\022\377\223d\023\354\224c\022\272\224c\022"
-  "\364\224c\022\364\224c\022\377\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\224c\022\364"
-  "\224c\022\377\224c\022\377\224c\022\377\224c\022\377Uq\323\377\035\034\033\323\035"
-  "\034\033\323\035\034\033\377Cc\357\377Cc\357\377c\204\372\377c\204\372\354c\204"
-  "\372\272\223d\020\373\223d\023\372\224c\022\354\224c\022\323\224c\022\323\224"
-  "c\022\352\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\035\034\033\250\035\034\033\352\224c\022\377\224c\022\364\224"
-  "c\022\323\224c\022\344\224c\022\344\224c\022\352\035\034\033\241\000\000\000\000\035\034\033"
-  "\352\035\034\033\311\035\034\033\352\035\034\033\311\035\034\033\311\035\034\033\323\035"
-  "\034\033\364\223d\024\341\223d\024\367\224c\022\364\224c\022\364\224c\022\377\035"
-  "\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\035\034\033\272\224c\022\377\224c\022\377\224c\022\270\223d\026\320\223d\026\323"
-  "\223d\026\344\223d\026\337\035\034\033\352\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\223d\024\037\035\034\033\344\035\034\033\344\224"
-  "c\022\377\224c\022\311\224c\022\236\035\034\033\236\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\223d\024\237\223d\024\335"
-  "\223d\024\355\223d\024\370\223d\024\375\223d\024\222\223d\024\370\035\034\033\206"
-  "\223d\024/\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\223d\024Y\035\034\033\377\224c\022\311\224c\022\311\035\034\033\311\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\344\035"
-  "\034\033\377\035\034\033\377\035\034\033\311\035\034\033\236\035\034\033\223\035\034\033\223"
-  "\035\034\033\323\035\034\033\323\223d\024>\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377\035\034\033"
-  "\250\035\034\033\352\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
@@ -1,606 +0,0 @@
-/* GIMP RGBA C-Source image dump (startSelected.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[90 * 36 * 4 + 1];
-} start_selected = {
-  90, 36, 4,
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\000\000\000\377\012\033\016\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\000\000\000\377\001\001\001\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376"
-  "\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\376\376\376\377"
-  "\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377"
-  "\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\375\376\375\377\375"
-  "\376\375\377\375\376\375\377\375\376\375\377\376\376\376\377\376\376\376"
-  "\377\367\255\000\377\367\255\000\377\376\376\376\377\376\375\375\377\376\375"
-  "\375\377\376\375\375\377\376\375\375\377\376\375\375\377\376\375\375\377"
-  "\375\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\376\376\376\377\376\376\376\377\373\376\374\377\373\376"
-  "\374\377\374\376\375\377\374\376\375\377\372\376\375\377\376\376\376\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\366\372\363\377"
-  "\364\376\370\377\375\377\372\377\375\377\372\377\374\377\373\377\374\377"
-  "\373\377\374\377\373\377\374\377\373\377\374\377\374\377\376\376\376\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\366\372\363\377"
-  "\375\376\375\377\374\376\370\377\374\376\371\377\374\376\371\377\374\376"
-  "\371\377\374\376\371\377\373\376\372\377\373\376\374\377\376\376\376\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376"
-  "\376\377\376\376\376\377\373\374\373\377\376\376\376\377\376\376\376\377"
-  "\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\367\255\000\377\367\255\000\377\376\376\376\377\377"
-  "\375\376\377\377\375\375\377\377\375\375\377\377\375\376\377\377\375\376"
-  "\377\377\375\376\377\377\375\376\377\366\375\372\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\374"
-  "\376\375\377\374\376\375\377\374\376\375\377\374\376\375\377\373\376\375"
-  "\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\366\372\363\377\366\376\370\377\376\376\373\377\376\377\372\377\375"
-  "\377\374\377\375\377\374\377\375\377\374\377\375\377\374\377\375\377\374"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255"
-  "\000\377\366\372\363\377\372\374\372\377\375\374\372\377\375\375\372\377\376"
-  "\376\372\377\376\376\372\377\376\375\372\377\375\375\374\377\375\375\375"
-  "\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255"
-  "\000\377\376\376\376\377\366\372\363\377\366\372\363\377\366\372\363\377\366"
-  "\372\363\377\366\372\363\377\366\372\363\377\366\372\363\377\366\372\363"
-  "\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\366\372\363\377\366\372\363\377\366\372\363\377"
-  "\366\372\363\377\366\372\363\377\376\376\376\377\376\376\376\377\376\376"
-  "\376\377\367\255\000\377\367\255\000\377\366\372\363\377\366\376\370\377\376"
-  "\376\373\377\367\373\367\377\366\372\363\377\366\372\363\377\366\372\363"
-  "\377\366\372\363\377\366\372\363\377\366\372\363\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\367\255\000\377\366\372\363\377\366\372\363\377"
-  "\366\372\363\377\366\372\363\377\366\372\363\377\366\372\363\377\366\372"
-  "\363\377\366\372\363\377\366\372\363\377\376\376\376\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\374\377"
-  "\374\377\374\377\372\377\376\376\376\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\376\376\376\377\377\376\374\377\372\377\375\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376"
-  "\373\372\377\373\375\372\377\376\376\376\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\375\376\375\377\374\376\371\377"
-  "\374\377\370\377\367\255\000\377\367\255\000\377\366\372\363\377\366\376\370"
-  "\377\376\376\373\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\376\376\376\377\374\376\371\377\373\376"
-  "\373\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\376\376\376\377\377\375\374\377\374\377\374\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\376\376\376\377\373\377\374\377\374\377"
-  "\372\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376"
-  "\377\377\375\375\377\372\377\376\377\376\376\376\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\376\376\376\377\375\375\373\377\374\376"
-  "\373\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\375\376\375\377\374\376\371\377\374\377\370\377\367"
-  "\255\000\377\367\255\000\377\366\372\363\377\366\376\370\377\376\376\373\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\376\376\376\377\374\376\372\377\374\375\374\377\376\376\376"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376"
-  "\377\376\376\374\377\376\376\374\377\367\372\367\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377"
-  "\377\375\375\377\372\377\377\377\376\376\376\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\374\376"
-  "\373\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
-  "\376\376\376\377\376\376\376\377\376\376\376\377\374\376\371\377\374\377"
-  "\370\377\367\255\000\377\367\255\000\377\366\372\363\377\366\376\371\377\376"
-  "\376\374\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\376\376\376\377\375\376\374\377\376\376\374\377\373\374\373\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\373\376\376\377\376\375\375\377\377\375\374"
-  "\377\375\376\373\377\366\372\363\377\366\372\363\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\376\376\376\377\377\375\375\377\372\377\376\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376"
-  "\376\376\377\374\376\373\377\375\376\373\377\376\374\373\377\377\374\374"
-  "\377\377\375\374\377\377\375\374\377\377\375\374\377\377\375\374\377\376"
-  "\376\372\377\374\377\370\377\367\255\000\377\367\255\000\377\366\372\363\377"
-  "\366\376\371\377\376\376\374\377\376\376\374\377\376\376\374\377\376\376"
-  "\374\377\376\376\374\377\376\376\374\377\377\376\374\377\376\376\376\377"
-  "\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\376\376\374"
-  "\377\373\374\373\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\376\376\376\377\376\376\377\377\377\376\376"
-  "\377\377\376\375\377\375\376\375\377\366\372\363\377\366\372\363\377\376"
-  "\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\374\377\376\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\372\363\377\372\376\372\377\374\376\373\377\376\375\374\377\376\376"
-  "\375\377\377\375\376\377\376\376\376\377\376\376\376\377\376\376\375\377"
-  "\375\376\372\377\375\376\371\377\374\377\370\377\367\255\000\377\367\255\000"
-  "\377\366\372\363\377\366\376\371\377\376\376\376\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\376\376\376\377\375\377\376\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\375\376"
-  "\374\377\376\376\374\377\373\374\373\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\376\376\376\377\376\376\376\377\366\372\363\377"
-  "\376\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376"
-  "\377\375\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\376\376\376\377\371\377\372\377\374\376\373\377\376"
-  "\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\375\376\371\377\374\377\370\377\367"
-  "\255\000\377\367\255\000\377\366\372\363\377\366\376\371\377\376\376\376\377"
-  "\376\376\376\377\376\376\376\377\376\376\376\377\365\371\366\377\376\376"
-  "\376\377\375\377\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376"
-  "\376\377\375\376\374\377\376\376\374\377\373\374\373\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\372\363"
-  "\377\366\372\363\377\376\373\373\377\376\376\376\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376"
-  "\376\377\374\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\376\376\376\377\371\377\371\377\373\376\373\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\376\376\376\377\375\376\371\377\374\377\370\377\367\255\000"
-  "\377\367\255\000\377\366\372\363\377\366\376\371\377\376\376\376\377\376\376"
-  "\376\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\375"
-  "\377\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\375"
-  "\376\374\377\376\376\374\377\373\374\373\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\372\363\377\366\372\363"
-  "\377\373\375\373\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\374\376"
-  "\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\376\376\376\377\371\377\371\377\373\376\373\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376"
-  "\376\377\375\376\371\377\374\377\370\377\367\255\000\377\367\255\000\377\366"
-  "\372\363\377\366\376\371\377\376\376\376\377\376\376\376\377\367\255\000\377"
-  "\367\255\000\377\376\376\376\377\375\377\376\377\375\377\376\377\376\376\376"
-  "\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\376\376\376\377\375\376\374\377\376\376"
-  "\374\377\373\374\373\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
-  "\376\376\377\376\376\376\377\376\376\376\377\366\372\363\377\366\372\363"
-  "\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\375\376"
-  "\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\376\376\376\377\370\377\371\377\373\376\373\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376"
-  "\376\377\375\376\371\377\374\377\370\377\367\255\000\377\367\255\000\377\366"
-  "\372\363\377\366\376\371\377\376\376\376\377\376\376\376\377\367\255\000\377"
-  "\367\255\000\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
-  "\377\376\376\376\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\376\376\376\377\375\376\374\377\376\376"
-  "\374\377\373\374\373\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377"
-  "\376\376\373\377\377\376\373\377\377\376\373\377\377\376\373\377\377\376"
-  "\373\377\377\376\373\377\375\377\373\377\366\372\363\377\366\372\363\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\376\376\376\377\376\376\375\377\375\376\375"
-  "\377\375\375\375\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\376\376\376\377\372\377\371\377\374\376\372\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376"
-  "\376\377\375\376\371\377\374\377\370\377\367\255\000\377\367\255\000\377\376"
-  "\376\376\377\365\376\371\377\376\376\376\377\376\376\376\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377"
-  "\375\375\375\377\370\376\375\377\376\376\376\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\376\376\376\377\375\377\372\377\376\377"
-  "\372\377\367\372\367\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\360\367\362\377\374"
-  "\375\370\377\375\376\371\377\374\376\371\377\373\376\371\377\373\376\371"
-  "\377\373\376\371\377\372\376\371\377\367\374\371\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\376\376\376\377\373\375\372\377\371\376\372\377\376"
-  "\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376"
-  "\376\376\377\372\376\367\377\372\375\370\377\375\376\375\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\375\376\375\377"
-  "\372\376\370\377\372\376\367\377\367\255\000\377\367\255\000\377\376\376\376"
-  "\377\362\376\370\377\375\375\374\377\376\376\376\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\374\374"
-  "\373\377\366\375\373\377\376\376\376\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\360\366\361\377\373\376\367\377\373\376\370\377"
-  "\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376"
-  "\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
-  "\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\376\376\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376"
-  "\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\366"
-  "\372\363\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\376\376\376\377\376\376\376\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\376\376"
-  "\376\377\376\376\376\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000\377\020#\031\377\021\""
-  "\032\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\000\000\000"
-  "\377\001\000\001\377\001\001\001\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\000\000\000\377\000\000\000\377\002\000\000\377\001\000\000\377\000\001\000\377\000\002\000\377"
-  "\000\001\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377",
-};
-
@@ -1,155 +0,0 @@
-/* GIMP RGBA C-Source image dump (bird_left1.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} bird_left1 = {
-  32, 32, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "z\237-G#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377n|\177\377#\037\037\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\235\314"
-  "=\006#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000#\037\037\377{\202y\377s\275\326\377\066[J\377#\037\037\377|\242"
-  "/\060#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377\063h"
-  "y\377#\037\037\377\000\000\000\000#\037\037\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000#\037\037\377\232\274\307\377#\260\331\377\011^u\377#\037\037\377"
-  "#\037\037\377i\227\246\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377c\255"
-  "\305\377\007\210\252\377/\040\007\377#\037\037\377Xsp\377\065WM\377#\037\037\377\000"
-  "\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\202\224\227\377a\303\342\377\001\247\321"
-  "\377\000b}\377<K\037\377\223\257\270\377=\261\324\377#\037\037\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000#\037\037\377\070\257\321\377\000\203\244\377)\070\061\377j\243\265"
-  "\377\061\242\302\377\026Ud\377#\037\037\377\000\000\000\000\000\000\000\000#\037\037\377u}w\377"
-  "\211\312\340\377\010\262\335\377\000\224\271\377\025Rf\377\232\246\252\377t\307"
-  "\344\377\002\241\311\377#\037\037\377\234\313<\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\036"
-  "\253\320\374\002~\235\377\067\212\242\377\027\243\311\377\010^t\323#\037\037\377"
-  "\235\314=\014#\037\037\377#\037\037\377ViD\377\211\276\320\377\024\264\336\377"
-  "\000\242\312\377\030]t\377\177\225\233\377y\310\343\377\000\257\332\377\000\220"
-  "\264\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\024\243\310\354\001\226"
-  "\273\377\003\240\307\377\000Vl\377\014-\063\364.PE\364%TX\364\037Wa\364\036MT\377"
-  "'P_\377\040l\203\377\000\210\252\377\040^t\377\204\234\244\377b\302\341\377\000"
-  "\261\335\377\000\235\304\377\000v\224\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "#\037\037\377\005\215\257\377\000\255\330\377\000\227\275\377\000\225\273\377\000\227"
-  "\275\377\000\204\245\377\000\223\267\377\000\242\312\377\000\235\304\377\000\251\323"
-  "\377\000\226\274\377\035BP\377\177\241\254\377V\275\340\377\000\260\334\377\000"
-  "\241\311\377\000\200\240\377#\037\037\377b\205\216\270\215\267\065\017\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "#\037\037\377#\037\037\377\001b{\377\000\243\313\377\000\261\335\377\000\261\335\377"
-  "\000\257\333\377\000\245\316\377\000\254\326\377\000\261\335\377\000\261\335\377\000"
-  "\253\325\377\040k\204\377c\230\250\377>\271\336\377\000\260\334\377\000\237\307"
-  "\377\000u\223\377\070an\377Z\255\307\377#\037\037\377o\221'\021\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377"
-  "\005\203\244\377\000\253\325\377\000\260\334\377\000\257\333\377\000\261\335\377\000"
-  "\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\257\333\377\026u"
-  "\221\377]\222\243\377/\266\335\377\000\261\335\377\000\231\277\377$cy\377M\205"
-  "\227\377<\255\317\377\012\260\332\377#\037\037\377q\224(\032\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\005}\234"
-  "\364\000\232\301\377\000\200\240\377\000Qg\377\000\212\255\377\000\261\335\377\000\261"
-  "\335\377\000\261\335\377\000\261\335\377\000\261\335\377\002\221\266\377Bt\203\377"
-  "-\264\333\377\000\261\335\377\003\234\303\377+\203\233\377=\253\314\377\026\262"
-  "\334\377\000\254\327\377\000\222\267\377#\037\037\377\221\275\067\030\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\000"
-  "<M\377\000\033$\377\000\002\005\377\000\027\037\377\000\233\301\377\000\261\335\377\000\261"
-  "\335\377\000\261\335\377\000\261\335\377\000\251\323\377\"Wh\377\061\254\316\377"
-  "\000\261\335\377\000\261\334\377\005\250\321\377\005\260\333\377\000\260\334\377\000"
-  "\246\317\377\000\210\252\377#\037\037\377Rl!\213\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377#\037\037\377#\037\037\377\000\000\000\377"
-  "[[[\377\275\275\275\377\275\275\275\377\000\177\237\377\000\254\327\377\000\261"
-  "\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\206\250\377\070\211\242"
-  "\377\005\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\001\256\331\377"
-  "\027\223\266\377\060l\202\377Kju\377#\037\037\377Rm!\065\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000#\037\037\377\260\222+r\300\241\071\377\300\241\071\344\300"
-  "\241\071\344\300\241\071\377\252\251\251\377#\037\037\377\275\275\275\377\000\241"
-  "\312\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\260\334"
-  "\377\004^v\377\032\250\316\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261"
-  "\335\377\007\252\323\377\060\245\306\377M\254\314\377@\250\307\377\002`x\352#"
-  "\037\037\377\203\252\062\064\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\214\266\066\013#\037"
-  "\037\377\254\212\026\377\256\220*\377\256\220*\377\256\220*\377\205\223\233"
-  "\377v\214\227\377\016\203\244\377\000\247\320\377\000\257\333\377\000\261\335\377"
-  "\000\261\335\377\000\261\335\377\000\253\326\377\001Ti\377\000\237\306\377\000\250\322"
-  "\377\000\252\324\377\000\252\324\377\000\250\322\377\000\242\313\377\000\231\300\377"
-  "\000\215\261\377\000k\206\377\000\036'\377\015\023\003\377#\037\037\377\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377\234\200\040\377\234"
-  "\200\040\377\000\203\243\377\000\241\311\377\000\241\311\377\000\242\313\377\000\253"
-  "\326\377\000\261\335\377\000\261\335\377\000\261\335\377\000\253\326\377\000Nc\377"
-  "\000g\202\377\000r\216\377\000w\226\377\000z\231\377\000x\227\377\000r\217\377\000f\201"
-  "\377\000DW\377#\037\037\377#\037\037\377#\037\037\377n\217(\064\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\234\200\040\377\245\211"
-  "*\377\000\216\261\377\000\247\320\377\004\235\304\377%\263\331\377T\267\322\377"
-  "n\272\316\377{\274\313\377{\274\313\377o\272\315\377T\237\261\377(\203\231"
-  "\377\005p\214\377\000d\177\377\000`y\377\000b|\377\000l\210\377\000t\221\377\004BS\377"
-  "#\037\037\377(\067\012-Pi\034\021\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000#\037\037\377\245\211*\326\245\211*\377\254\212\026\377\006\223\267"
-  "\377`\267\321\377\265\304\275\377\330\312\263\377\345\314\256\377\350\314"
-  "\255\377\354\315\255\377\354\316\255\377\353\315\255\377\346\315\257\377"
-  "\331\312\262\377\267\304\273\377l\267\316\377\021\257\331\377\000\257\332\377"
-  "\000\257\332\377\000\225\273\377#\037\037\377\232\310;^\201\247\060\034w\233,*\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\210\260\063\014#\037"
-  "\037\377#\037\037\377#\037\037\377v\205\202\377\336\301\241\377\357\315\253\377"
-  "\360\316\254\377\360\316\254\377\357\315\253\377\360\316\254\377\360\316"
-  "\254\377\360\316\254\377\360\316\254\377\360\316\254\377\360\316\254\377"
-  "\354\315\255\377\263\304\276\377>\265\327\377\001\246\320\377\000r\220\377#\037"
-  "\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\312\247\204\377"
-  "\345\301\235\377\357\315\252\377\360\316\254\377\360\316\254\377\360\316"
-  "\254\377\360\316\254\377\360\316\254\377\360\316\254\377\360\316\254\377"
-  "\360\316\254\377\360\316\254\377\357\316\254\377\305\302\257\377C\217\247"
-  "\377+UQ\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037"
-  "\037\377\312\247\204\377\340\273\227\377\354\310\245\377\357\315\253\377\360"
-  "\316\254\377\360\316\254\377\356\316\254\377\360\316\254\377\360\316\254"
-  "\377\360\316\254\377\357\315\252\377\350\304\241\377\331\264\217\377\205"
-  "yf\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\212\264\065\015#\037\037\377#\037\037\377\330\263\216\377\341\275\230\377\347"
-  "\304\240\377\353\310\245\377\353\310\246\377\352\311\247\377\353\310\244"
-  "\377\346\302\237\377\340\273\225\377\320\254\210\377\213sY\377#\037\037\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000j\206+P#\037\037\377#\037\037\377\325\260\213\377\334\266\220\377\334"
-  "\266\220\377\333\265\220\377\333\266\220\377\323\256\212\377\256\217p\377"
-  "e^=\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\225\302\071\002k\213);#\037\037\377"
-  "/\040\007\304/\040\007\270/\040\007\377/\040\007\377/\040\007\377#\037\037\377\235\314=\015"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\217\272\066\001\230\306;\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\261\334YD\000\000\000\000",
-};
-
@@ -1,151 +0,0 @@
-/* GIMP RGBA C-Source image dump (bird_left2.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} bird_left2 = {
-  32, 32, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377#\037\037\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000#\037\037\377a\250\275\377\032cw\377#\037\037\377#\037\037\377#"
-  "\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000#\037\037\377\064\261\326\377\012d|\377#\037\037\377b\214\226\377A\215\244\377"
-  "#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037"
-  "\377\030\257\326\377\015Xm\377Q\213\235\377\063\251\315\377\010e}\377#\037\037"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\013"
-  "\255\326\377\027o\210\377\034\247\315\377\000k\206\377#\037\037\377#\037\037\377"
-  "#\037\037\377#\037\037\377#\037\037\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037"
-  "\037\377\006\252\323\377\000\241\312\377\000|\233\377\000EW\377\006Wm\377\010ax\377\004"
-  "y\227\377\005i\203\377\013u\221\377\037an\377#\037\037\377#\037\037\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037"
-  "\037\377\000\224\271\377\000\255\330\377\000\244\315\377\000\257\332\377\000\230\277"
-  "\377\000\216\262\377\000\252\324\377\000\244\316\377\000\260\333\377\000\260\333\377"
-  "\000\241\311\377\022cy\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377.ZV\377\000\204\246\377\000\256\331\377"
-  "\000\261\335\377\000\261\335\377\006\257\331\377\001\255\330\377\000\261\335\377\000"
-  "\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\255\330\377\005x\226"
-  "\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377"
-  "+]^\377\000\242\312\377\000\256\331\377\000\245\316\377\000\255\330\377\000\261\335"
-  "\377\002\260\334\377\011\261\333\377\000\261\335\377\000\261\335\377\000\261\335\377"
-  "\000\261\335\377\000\261\335\377\000\257\333\377\000\227\275\377\027Vd\377#\037\037"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\000\213\256\377\000\203"
-  "\244\377\000\\t\377\000\067G\377\000\245\316\377\000\261\335\377\000\261\335\377\000\260"
-  "\334\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335"
-  "\377\000\243\313\377\000\210\252\377\000z\231\377#\037\037\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000#\037\037\377\031-\"\377\000\".\377\000\000\000\377\000\000\000\377\000La\377"
-  "\000\257\332\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000"
-  "\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\235\304\377\000\207"
-  "\251\377\000\206\250\377(Z[\377#\037\037\352\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377"
-  "\000\000\000\377\204\204\204\377\331\331\331\377fx\202\377\000\233\302\377\000\261"
-  "\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\001\261\335"
-  "\377\006\262\334\377\000\261\335\377\000\261\335\377\000\246\317\377\000\211\253\377"
-  "\000\207\251\377\000^y\377#\037\037\377&\063\012+\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\331\237\020\377"
-  "XG'\377#\037\037\377\344\344\344\377H|\222\377\000\255\327\377\000\261\335\377"
-  "\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\006"
-  "\261\333\377\003\262\335\377\000\260\334\377\000\243\314\377\000\240\310\377\000\226"
-  "\273\377\000{\233\377\026\035\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\331\237\020\377\331\237"
-  "\020\377\331\237\020\377\207\205\201\377Z\200\220\377\000\223\270\377\000\251\323"
-  "\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\245\315\377"
-  "\000\213\256\377\000z\233\377\000p\216\377\000h\204\377\000Sk\377\000h\204\377\000o\215"
-  "\377\000k\206\377\004\001\000\377#\037\037\061#\037\037\060Jb\031\011\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\331\237\020\377\331\237\020\377\331"
-  "\237\020\377\331\237\020\377xdA\377\000\226\274\377\000\247\321\377\000\236\306\377"
-  "\000\260\334\377\000\261\335\377\000\261\335\377\000\261\335\377\000\217\263\377\002"
-  "\064A\377a\216\236\377\203\261\302\377\214\274\315\377\217\276\317\377\211"
-  "\266\306\377x\241\260\377N\177\220\377\034\\m\377#\037\037\377#\037\037\352#\037"
-  "\037E\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\257\202\022"
-  "\377\257\202\022\377\242u\005\377\246w\005\377;cq\377\000\234\303\377\000\245\314"
-  "\377\060\264\327\377X\267\322\377n\272\316\377v\273\314\377p\273\315\377["
-  "\263\312\377\062Zc\377\000v\224\377\000\242\313\377\000\257\334\377\000\251\323\377"
-  "\000\223\270\377\000\201\241\377\025|\230\377\024u\217\377\000`y\377\021\060\064\377"
-  "#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037"
-  "\377#\037\037\377\257\202\022\377\242u\005\377\013\224\267\377m\270\317\377\267"
-  "\304\274\377\326\312\263\377\344\314\257\377\350\315\256\377\352\315\255"
-  "\377\351\315\256\377\345\315\257\377\323\273\237\377d\\S\377\000n\213\377\000"
-  "\227\275\377\001\252\324\377\011\251\321\377\004\231\277\377\022\227\271\377<\234"
-  "\270\377V\222\247\377U\202\216\377\000\000\000\000#\037\037\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377\212\231"
-  "\226\377\343\307\250\377\360\316\254\377\360\316\254\377\360\316\254\377"
-  "\360\316\254\377\360\316\254\377\360\316\254\377\360\316\254\377\360\316"
-  "\254\377\336\277\237\377~n^\377\022Uj\377\000\200\241\377\001\232\300\377\000\230"
-  "\277\377\001\200\240\377\004w\225\377\003\211\253\377\063\242\305\377\037\217\260"
-  "\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000#\037\037\377}jP\377\332\265\221\377\353\310\245\377\360\316"
-  "\254\377\360\316\254\377\360\316\254\377\360\316\254\377\360\316\254\377"
-  "\360\316\254\377\360\316\254\377\360\316\254\377\352\310\247\377\265\233"
-  "\201\377USO\377\003]u\377\000\204\245\377\000\223\270\377\017\224\265\377,\203\233"
-  "\377=fu\252\007i\203\377\026FP\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\234\200d\377\332\265"
-  "\220\377\350\304\240\377\357\315\253\377\360\316\254\377\360\316\254\377"
-  "\360\316\254\377\360\316\254\377\360\316\254\377\360\316\254\377\360\316"
-  "\254\377\355\312\250\377\323\260\215\377\202kS\377\017\062\067\377\003c}\377\004"
-  "\206\246\377\007\222\265\377\066\246\306\377i\241\262\377#\037\037\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000#\037\037\377\226|a\377\323\256\211\377\340\273\227\377\351\305\242"
-  "\377\355\312\250\377\357\315\252\377\357\315\253\377\357\314\252\377\354"
-  "\312\247\377\346\302\236\377\334\267\221\377\271\231x\377#\037\037\377#\037"
-  "\037\377#\037\037\377#\037\037\377\012c{\377\000\201\241\377\033\227\273\377\067\232"
-  "\266\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377i]@\377\265\225u\377\327\262"
-  "\214\377\334\267\221\377\337\271\224\377\337\272\225\377\336\271\223\377"
-  "\333\266\220\377\323\257\212\377\236\202f\377#\037\037\377\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377\001i\204\377\000\207\252\377#\037\037\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377dZ<\377\235\202e\377\257\221"
-  "r\377\267\227w\377\256\220q\377\231~b\377#\037\037\377#\037\037\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\013Xm\377#\037\037"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377#\037\037"
-  "\377#\037\037\377#\037\037\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
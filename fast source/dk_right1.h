@@ -1,173 +0,0 @@
-/* GIMP RGBA C-Source image dump (dk_right1.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} dk_right1 = {
-  32, 32, 4,
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\255\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\255\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\367\061\000\377"
-  "\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377"
-  "\245c\377\377\245c\377\377\245c\377\214\000\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\377\377\377\377\377\377\377\377"
-  "\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\367"
-  "\061\000\377\377\245c\377\377\245c\377\214\000\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\377\377\377\000\000\000\377\377\245"
-  "c\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377\367\061"
-  "\000\377\377\245c\377\377\245c\377\354\245\026\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\354\245\026\377\377\245c\246\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c\377"
-  "\367\061\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\231\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\302\354\245"
-  "\026\377\367\061\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\354\245\026\377\354\245\026\377\354\245\026\377\354\245\026\231\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\231\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\354\245\026\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\231\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\267\214\000\000\342"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377"
-  "\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000f\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354"
-  "\245\026\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\214\000\000z\214\000\000\340\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\377\245c\313\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\231\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245cf\000"
-  "\000\000\377\000\000\000\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\376\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\377\245c\001\377\245"
-  "c\231\377\245c\376\367\061\000\376\377\245c\377\377\245c\377\377\245c\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\001\377\245c\231\377\245c\377\367\061\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245"
-  "c\377\377\245c\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\367\061\000\377\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\377"
-  "\245c\205\377\245c\377\377\245c\377\377\245c\377\367\061\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377"
-  "\377\245c\377\377\245c\377\377\245c\377\367\061\000\377\367\061\000\377\367\061"
-  "\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000"
-  "\000\000\377\000\000\000\377\377\245c\231\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\367\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\377\245c\266\377\245"
-  "c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377"
-  "\214\000\000\267\214\000\000\342\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\324\377\245c\324\377\245c\377\377\245c\377\377\245c\377\377\245c\342\000"
-  "\000\000\377\000\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\000\000\000\377\214\000\000\231\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\367\061\000\377\367\061\000\377\377\245c\377\377\245c\377\377\245c\377"
-  "\214\000\000\377\377\245c\377\377\245cf\377\245cf\377\245c\377\377\245c\377\377"
-  "\245c\377\367\061\000\231\000\000\000\377\000\000\000\377\377\245c\326\377\245c\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\214"
-  "\000\000\231\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\354\245\026\377\377\245c\377\354\245\026\243\354\245"
-  "\026\243\377\245c\377\377\245c\231\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\377\245c\231\377\245c\377\367\061\000\377\377\245c\377\377\245cf\377\245cf"
-  "\377\245c\377\000\000\000\377\214\000\000\231\214\000\000\377\214\000\000\377\214\000\000\377\214"
-  "\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\354\245\026\377\377"
-  "\245c\377\367\061\000\377\367\061\000\377\377\245c\377\377\245c\377\214\000\000\377"
-  "\214\000\000\377\214\000\000\377\214\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\377\245c\246\377\245c\377\377\245ck\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\214\000\000\224\214\000\000\324\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\367\061\000\377\214\000\000\377\214\000\000\377\354\245"
-  "\026\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\354\245\026\377"
-  "\214\000\000\377\354\245\026\377\354\245\026\377\367\061\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\214\000\000\377\214\000\000\377\214\000\000\377\214\000"
-  "\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\214\000\000\377\214"
-  "\000\000\377\354\245\026\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377"
-  "\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377\367\061\000\377\377\245c"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\230\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377"
-  "\214\000\000\377\214\000\000\377\367\061\000\377\377\245c\377\377\245c\377\354\245\026"
-  "\377\367\061\000\377\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377\245c\377\377\245c"
-  "\377\377\245c\377\377\245c\377\377\245c\377\214\000\000\377\367\061\000\377\367"
-  "\061\000\377\214\000\000\377\214\000\000\377\214\000\000\377\367\061\000\377\367\061\000\377\367"
-  "\061\000\377\367\061\000\377\214\000\000\377\214\000\000\377\377\245c\377\377\245c\377"
-  "\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\377"
-  "\245c\204\000\000\000\377\214\000\000\062\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\214\000\000\204\214\000\000\377\377\245c\377\377\245c\377\377"
-  "\245c\377\377\245c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\377"
-  "\245c\377\377\245c\377\377\245c\377\377\245c\377\377\245c\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\214\000\000f\214\000\000\377\377\245c\377\377\245c\377\377\245c\377\377\245"
-  "c\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\367\061\000\251"
-  "\377\245c\377\377\245c\377\377\245c\377\377\245c\350\377\245c\330\377\245"
-  "c\330\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377",
-};
-
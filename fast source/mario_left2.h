@@ -1,164 +0,0 @@
-/* GIMP RGBA C-Source image dump (mario_left2.c) */
-
-static const struct
-{
-  unsigned int width;
-  unsigned int height;
-  unsigned int bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  unsigned char pixel_data[32 * 32 * 4 + 1];
-} mario_left2 = {
-    32,
-    32,
-    4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377\035\034\033\250\035\034\033\233\035\034\033"
-    "\347\035\034\033\354\035\034\033\272\035\034\033\377\035\034\033\323\035\034\033\304\035"
-    "\034\033\272\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\321\377\370\367\247\374\310\305"
-    "\352\370[M\377\370<\036\377\370\066\022\374\370\067\023\354\370\067\023\370\370"
-    "\067\023\341\370\067\023\327\370\067\023X\035\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\314\035\034\033\314\035\034"
-    "\033\272\035\034\033\354\376\362\361\257\376\364\363\377\374\323\321\377\370"
-    "[M\377\370\062\000\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\376"
-    "\370\067\023\363\370\067\023{\035\034\033\344\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\035\034\033\323\370\067\023q\370\067\023\326\370;\026\327\367M$\347"
-    "\367eL\370\370oZ\377\366dN\377\363C\040\377\366I\035\377\367M\"\377\365H\035"
-    "\377\362=\024\377\362<\023\377\362<\023\377\362<\023|\035\034\033\272\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\207\035\034\033\250"
-    "\356\236PH\353\257Z\335\353\260Z\377\352\256Y\377\256r)\377\256r)\377\334"
-    "\241P\377\356\262\\\377\324\232J\377\243f\034\377\246j\040\377\250l\"\377\246"
-    "k!\220\035\034\033\352\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-    "\033\223\352\266^\207\352\266^\354\352\266^\355\352\266^\374\353\267^\377"
-    "\320\236M\377\035\034\033\377\377\377\377\377\333\251T\377\351\265^\377\313"
-    "\232J\377\247x,\377\333\251U\377\346\262[\377\304\224E\372\223d\024\217\035"
-    "\034\033\247\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\272\352\266^\240\352"
-    "\266^\372\352\266^\377\352\266^\377\352\266^\377\346\263\\\377\344\261Z\377"
-    "\344\261Z\377\345\261[\377\350\264]\377\304\223D\377\226g\031\377\246w+\377"
-    "\341\256X\377\354\267_\377\306\226F\377\223d\024\254\035\034\033\344\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\354\352\266^\253\347\263\\\372\344\261"
-    "Z\377\344\261Z\377\342\257Y\377\271\211<\377\277\217A\377\344\261Z\377\345"
-    "\261[\377\350\264]\377\303\223D\377\232k\036\377\255}\062\377\342\256Y\377"
-    "\353\267_\377\307\226G\377\223d\024\374\223d\024\323\035\034\033\323\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\035\034\033\354\244u)\221P\067\015\377P\067\015\377P\067\015"
-    "\377P\067\015\377P\067\015\377\236o#\377\254}\061\377\335\252U\377\350\264]\377"
-    "\344\261Z\377\345\262[\377\351\265]\377\347\263\\\377\303\223D\377\223d\024"
-    "\377\223d\024\345\035\034\033\311\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\272"
-    "\223d\023s\226g\031\363\234n!\376\235n\"\377\235n\"\377\233l\037\377\261\202"
-    "\066\377\340\255X\377\351\265]\377\352\266^\377\352\266^\377\351\265^\377"
-    "\343\257Y\377\267\210:\377\226g\031\365\223d\024\330\035\034\033\223\223d\024&"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\377\331\247SA\344\260Z"
-    "\245\344\261Z\352\344\260Z\351\344\261Z\363\346\262[\377\351\265]\377\346"
-    "\262[\377\344\261Z\377\345\262[\377\334\251U\374\252{/\355\225f\027\303\035"
-    "\034\033\323\035\034\033\250\223d\024\012\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\035\034\033\304\377\377\377\007\035\034\033\306\035\034\033\354\035\034\033\223\276"
-    "\243\271\040\343\255v\211\354\260[\376\346\253Z\377\261\203X\377\230oW\377"
-    "\232qW\377\231q\\\334\035\034\033\364\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\364\377\377\377\223\035\034\033\354\377"
-    "\377\377\014\235\260\375\003\035\034\033\377b\204\373\377\301l\271\367\365O\062"
-    "\377\350Yn\377b\204\373\377b\204\373\377b\204\373\377b\204\373\377b\204\373"
-    "\364\035\034\033\246\035\034\033\311\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035"
-    "\034\033\250\377\377\377\324\377\377\377\374\377\377\377\370\377\374\372\243"
-    "\035\034\033\377b\204\373\377\316_\246\373\363>B\377\333V\217\377b\204\373\377"
-    "b\204\373\377b\204\373\377\361@N\377\360BS\377\360AQ\376\365;\063\362\370"
-    "\067\013\205\035\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\250\377\377"
-    "\377\346\377\377\377\377\377\377\377\377\374\334\334\370b\204\373\377\230"
-    "v\337\374\327Y\227\377\317^\245\377b\204\373\377b\204\373\377b\204\373\377"
-    "\366:+\377\370\067\021\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067"
-    "\023\371\370\067\023\262\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\250\376"
-    "\367\366\323\377\375\375\377\377\374\372\377\336\331\366\377b\204\373\377"
-    "\342N~\377\370\067\027\377\310b\257\377b\204\373\377b\204\373\377b\204\373"
-    "\377\372\064\000\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377"
-    "\370\067\023\377\370\067\023\374\370\067\023\323\035\034\033\323\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035"
-    "\034\033\264\371yq\211\375\335\333\374\375\275\267\377\326l\245\377b\204\373"
-    "\377\350Jp\377\373\063\000\377\310b\257\377b\204\373\377b\204\373\377b\204\373"
-    "\377\366:+\377\370\067\021\377\370\067\023\377\370\067\023\377\370\067\023\377\370"
-    "\067\023\377\370\067\023\377\370\067\023\345\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\035\034\033]\371bV\263\372L\060\371\331b\225\377\234\210\336\377\351Pm\377"
-    "\365\071\064\377\307p\261\377v\220\364\377f\205\372\377u\200\363\377b\204\373"
-    "\377\364==\377\370\067\030\377\370\067\023\377\370\067\023\377\370\067\023\377\370"
-    "\067\023\377\370\067\023\347\370\067\023E\035\034\033\272\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\035\034\033\250\370\021\000\207\365\233M\363\357\335u\376\355yf\377\255h\316\377"
-    "\271\277\311\377\327\334\247\377b\204\373\377`\203\374\377b\204\373\377b"
-    "\204\373\377\355E^\377\360AQ\377\366;\062\377\370\067\017\377\370\067\023\377"
-    "\370\067\023\375\370\067\023\353\370\067\023]\035\034\033\257\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\035\034\033\323\035\034\033\352b\204\373\364b\204\373\377b\204\373\377b\204"
-    "\373\377b\204\373\377d\205\372\377b\204\373\377a\204\373\377b\204\373\377"
-    "b\204\373\377b\204\373\377\336r\235\377\372_L\377\371aT\377\371aT\377\371"
-    "aT\373\371aTf\035\034\033\352\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-    "\033\323b\204\373\377b\204\373\377b\204\373\377b\204\373\377o\207\355\377"
-    "b\204\373\377b\204\373\377]\201\373\377b\204\373\377\352\354\376\377\375"
-    "\370\370\377\377\366\365\377\376\366\365\377\376\366\365\377\376\366\365"
-    "\373\376\366\365f\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\246"
-    "b\204\373\377b\204\373\377b\204\373\377b\204\373\377o\207\355\377o\207\355"
-    "\377b\204\373\377b\204\373\377]\201\373\377b\204\373\377\352\355\376\377"
-    "\376\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\373\377\377\377f\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\034\000\000\000\000\223d\024\036\000\000\000\000\000\000\000\000"
-    "\035\034\033\311b\204\373\377g\202\362\377d\203\370\377o\207\355\377o\207\355"
-    "\377b\204\373\377b\204\373\377b\204\373\377b\204\373\377e\206\373\377\201"
-    "\231\373\377\341\345\376\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\375\377\377\377\353\377\377\377]\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033m\224c\022\007\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\225b\000$\035\034\033\250b\204\373\377b\204\373\377o\207\355\377o\207\355\377"
-    "b\204\373\377b\204\373\377b\204\373\377o\207\355\377o\207\355\377[v\356\377"
-    ">\\\345\377\326\333\375\377\374\375\377\365\377\377\377\354\377\377\377\324"
-    "\377\377\377@\035\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\223d\020\064\035"
-    "\034\033\250b\204\373\352b\204\373\377i\204\343\377b\204\373\377b\204\373\377"
-    "b\204\373\377o\207\355\377o\207\355\377o\207\355\377[v\356\377$H\347\377"
-    "h\202\365\377\213\235\365\233\035\034\033\377\371\370\367\024\035\034\033\250\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035"
-    "\034\033`\035\034\033\323\035\034\033\364\035\034\033f\035\034\033/\035\034\033E\035\034\033"
-    "\223i\201\356\377i\201\356\377c\204\372\377b\204\373\377b\204\373\377o\207"
-    "\355\377[v\356\377[v\356\377>\\\345\377$H\347\377Yz\367\377a\203\374\377"
-    "|w\277\371\223d\021\261\035\034\033\377\035\034\033\344\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033*\035\034\033\272\224c\022\354"
-    "\224c\022\272\035\034\033\250\035\034\033\352\035\034\033\377\224c\022\377h\202\362"
-    "\377d\204\371\377c\204\372\377[v\356\377b\204\373\377[v\356\377;[\354\372"
-    "$H\347\377$H\347\377^\177\371\377b\203\372\377e\203\366\377~u\266\377\223"
-    "d\022\371\223d\024\353\223d\024\316\035\034\033\344\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\070\035\034\033\342\223d\023\362\223d\023"
-    "\377\223d\023\377\224c\023\372\223d\023\375\224c\022\377\224c\022\377h\202\362"
-    "\375c\204\372\377Uq\323\377>\\\345\377\035\034\033\344^\177\371\245^\177\371"
-    "\356_\201\372\361c\204\372\376i\201\357\377\205p\235\377\222e\063\377\223"
-    "d\024\377\223d\024\377\223d\024\373\223d\024\377\035\034\033\232\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033@\035\034\033\323\223d\023\377"
-    "\223d\023\377\224c\022\377\224c\022\377\223d\020\306\224c\022\377\224c\022\377"
-    "c\204\372\377Cc\357\377>\\\345\377\035\034\033\344\035\034\033\314\035\034\033\344"
-    "\035\034\033\250\035\034\033\250\035\034\033\377\222e(\370\223d\020\377\223d\024\377"
-    "\223d\024\375\223d\024\353\223d\024\377\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\223d\023\364"
-    "\223d\023\377\223d\023\377\223d\023\263\035\034\033\333\035\034\033\323\035\034\033\311"
-    "\035\034\033\270\035\034\033\311\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000j\200\354\007\217"
-    "gW\040\035\034\033\377\223d\024\377\223d\024\377\223d\024\347\223d\024\377\035\034"
-    "\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\035\034\033\364\223d\023\364\223d\023\364\035\034\033\263"
-    "\035\034\033T\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\035\034\033\323\223d\024\266\223d\024\377\223d\024\374\223d\024\377\035"
-    "\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\035\034\033D\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\035\034\033\323\035"
-    "\034\033c\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\223d\024\"\035\034\033\323\035\034\033\377\035\034\033\377\035\034\033\272\035\034"
-    "\033\354\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
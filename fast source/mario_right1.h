@@ -1,162 +0,0 @@
-/* GIMP RGBA C-Source image dump (Mario_right1.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} mario_right1 = {
-  32, 32, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\312\035\034\033\237\035\034\033\233\035\034\033"
-  "z\035\034\033o\035\034\033o\035\034\033a\035\034\033\250\035\034\033\250\035\034\033\250\035"
-  "\034\033\241\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\035\034\033\311\035\034\033\270\035\034\033\323\370\067\023\377"
-  "\370\067\023\377\370\067\023\377\370\067\023\377\370\066\022\377\370>$\377\370\067"
-  "\023\377\373\266\262\377\375\331\327\254\376\357\356<\035\034\033\246\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033"
-  "\246\370\067\023\377\370\067\023\333\370\067\023\371\370\067\023\374\370\067\023\376"
-  "\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\376\343\342\377"
-  "\376\356\355\262\376\343\342L\035\034\033\311\035\034\033\223\035\034\033\234\035\034"
-  "\033\010\035\034\033\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\213\370"
-  "\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067"
-  "\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023"
-  "\377\370\067\023\377\370\067\023\377\370\067\023\270\370\067\023\352\035\034\033\377"
-  "\035\034\033\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\250\035\034\033\270\277"
-  "`\034\240\300_\034\376\300_\034\377\304e\"\377\337\211B\377\355\231N\377\342"
-  "\214D\377\316s\061\377\336\211D\377\353\230P\377\357\235R\377\357\230N\336"
-  "\035\034\033\377\366]+\013\035\034\033\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\035\034\033\263\035\034\033\204\250x-m\301\220A\334\316\234K\376\304\223D\377"
-  "\255}\061\377\320\236M\377\347\262[\377\327\244Q\377\235n!\377\235n!\377\323"
-  "\240N\377\346\261Z\377\353\266^\356\353\265]\247\035\034\033\377\035\034\033\002"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\332\035\034\033\344\220a\016H\235n"
-  "!\377\315\234K\377\347\263\\\377\330\246S\377\235n!\377\264\205\070\377\323"
-  "\242O\377\336\254W\377\347\347\347\377\035\034\033\377\332\250T\352\346\262"
-  "[\377\352\266^\376\352\266^\373\352\266^\365\035\034\033\377\035\034\033\001\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\035\034\033y\222c\023\070\235n!\377\247x,\345\316\235K\377"
-  "\350\264]\377\331\247S\377\235n!\377\235n!\377\304\223D\377\343\260Z\377"
-  "\350\264]\377\346\263\\\377\326\244Q\310\325\242P\331\340\255W\377\351\265"
-  "]\377\350\265]\376\351\265^\371\035\034\033\377\000\000\000\000\036\034\033\001\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035"
-  "\034\033\204\223d\023c\222c\022\331\245v*\375\314\233K\377\347\264\\\377\341"
-  "\256X\377\312\231I\377\304\224E\377\326\244Q\377\336\253V\377\320\236M\377"
-  "\307\227G\377\065(\022\242P\067\015\377P\067\015\377P\067\015\377P\067\015\377P\067"
-  "\015\377\035\034\033\377\035\034\033\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\223\035\034\033\377"
-  "\222c\022\243\235n!\377\235n!\377\331\246S\373\350\263\\\377\350\264\\\377"
-  "\350\264]\377\351\265]\377\337\254W\377\304\224E\377yT\026\377yT\026\377yT"
-  "\026\377yT\026\377yT\026\377yT\026\377\035\034\033\377\035\034\033\003\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\035\034\033\250\035\034\033\311\222d\024\177\235n!\377\315\206"
-  "@\312\352\236U\371\352\261_\377\351\266b\377\351\266`\377\351\266^\377\342"
-  "\257Y\377\312\231H\377\263}&\377\263}&\377\263}&\377\263}&\377\263}&\352"
-  "\035\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\236"
-  "\035\034\033\223\035\034\033\377\336]\200\240\326x\230\364\317\236\241\377\316"
-  "\250\242\377\333\257\212\377\347\265i\377\351\265^\377\350\263\\\371\346"
-  "\262[\325yT\026\377yT\026\352\035\034\033\377\035\034\033\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\250b\204\373\377x\223"
-  "\362\377b\204\373\377b\204\373\377b\204\373\377b\204\373\377\326\244\223"
-  "\377\350\245i\367\353\255\\\315\353\263\\k\035\034\033\377\035\034\033\005\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-  "\033\377\370\067\023\377x\223\362\377x\223\362\377\341N\060\377\360CV\377\341"
-  "N\060\377b\204\373\377b\204\373\377b\204\373\377b\204\373\377\355lc\062\035"
-  "\034\033P\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\035\034\033\377\035\034\033\377b\204\373\377b\204\373\377b\204\373\377\362"
-  "@L\377\370\070\034\377\370\070\035\377\341N\060\377\334U\215\377b\204\373\377"
-  "\365\352\025\377x\223\362\377\035\034\033o\035\034\033\251\035\034\033\250\035\034\033"
-  "\250\035\034\033\250\035\034\033\270\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033R\035\034\033b\035\034"
-  "\033\377\370\067\023\377b\204\373\377b\204\373\377b\204\373\377\302\071\035\377"
-  "\302\071\035\377\370\067\022\377\370\067\027\377\365<\071\377\341N\060\377b\204\373"
-  "\377b\204\373\377\274\263\356u\352\350\372\260\377\377\377\317\377\377\377"
-  "\213\377\377\377\071\035\034\033\377\035\034\033m\035\034\033t\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\027\035\034\033"
-  "\377\370\067\023\377\370\067\023\377x\223\362\377b\204\373\377b\204\373\377\266"
-  "\063\030\377\266\063\030\377\302\071\035\377\370\067\023\377\370\067\024\377\366:\061"
-  "\377\355D]\377\351Ek\376\360\243\260\376\372\343\347\376\377\377\377\372"
-  "\377\377\377\353\377\377\377\332\377\377\377\261\377\377\377S\035\034\033\336"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\035\034\033\377\266\063\030\377x\223\362\377x\223\362\377b\204"
-  "\373\377b\204\373\377\266'\012\377\302\071\035\377\370\067\020\377\370\067\023\377"
-  "\370\067\025\377\367\067\033\377\365<\071\377\365<\071\377\375\334\333\377\377"
-  "\374\374\377\377\377\377\376\377\377\377\374\377\377\377\322\377\377\377"
-  "c\036\035\034\361\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\352x\223\362\377x\223\362"
-  "\377x\223\362\377b\204\373\377b\204\373\377\266\063\030\377\266\063\030\377\302"
-  "\071\035\377\370\067\023\377\370\067\022\377\370\065\017\377\370\067\025\377\372\237"
-  "\232\377\375\334\333\377\377\374\374\377\377\377\377\376\377\377\377\324"
-  "\377\377\377d\036\035\034\361\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033ax\223\362\377"
-  "x\223\362\377x\223\362\377x\223\362\377i\204\343\377b\204\373\377\266\063"
-  "\030\377\266\063\030\377\266\063\030\377\302\071\035\377\302\071\035\377\302\071\035"
-  "\377\302\071\035\377\372\316\317\366\376\373\373\360\377\377\377\357\377\377"
-  "\377\277\035\034\033\323\036\035\034\254\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\311x"
-  "\223\362\377x\223\362\377b\204\373\377x\223\362\377i\204\343\377i\204\343"
-  "\377i\204\343\377b\204\373\377\266'\012\377\266\063\030\377\266\063\030\377\266"
-  "\063\030\377\266\063\030\344\035\034\033\344\035\034\033\311\035\034\033\215\035\034\033"
-  "\254\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\311x\223\362\377"
-  "i\204\343\377x\223\362\377x\223\362\377i\204\343\377d\204\372\377i\204\343"
-  "\377i\204\343\377i\204\343\377b\204\373\377b\204\373\377b\204\373\377\200"
-  "}\355\271\035\034\033\344\035\034\033\236\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\035\034\033\220i\204\343\377c\204\372\377i\204\343\377i\204"
-  "\343\377i\204\343\377i\204\343\377b\204\373\377c\204\373\377i\204\343\377"
-  "i\204\343\377i\204\343\377i\204\343\377i\204\343\377Cd\360g\035\034\033\377"
-  "\035\034\033\254\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\035\034\033e\035\034\033\354\035\034\033\272\035\034\033\377\035\034\033\377"
-  "\035\034\033\333\035\034\033\210c\204\372\344c\204\372\344i\204\343\377b\204\373"
-  "\377b\204\373\377b\204\373\377b\204\373\377Uq\323\377Uq\323\377Uq\323\377"
-  "Uv\365\377Jk\361\377Jk\361\351Tu\365\251a\202\372K\035\034\033\272\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\352"
-  "\224c\022\374\224c\022\354\224c\022\377\224c\022\377\224c\022\377\223d$\303c\204"
-  "\372\344c\204\372\344c\204\372\377b\204\373\377b\204\373\377Uq\323\377Uq"
-  "\323\377Uq\323\377Oo\363\377Jj\361\377Gg\360\377Pp\363\377[}\370\376b\204"
-  "\373\340b\204\373\207\035\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\224c\022\377\224c\022\323\224"
-  "c\022\323\224c\022\377\224c\022\377\224c\022\311c\204\372\354c\204\372\374c\204"
-  "\372\377b\204\373\377b\204\373\376Uq\323\377Cc\357\377Cc\357\377Cc\357\377"
-  "Cc\357\377Uq\323\377^\200\371\377b\204\373\356b\204\373\265b\204\373W\035"
-  "\034\033\246\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\035\034\033\323\224c\022\377\224c\022\364\224c\022\364\224c\022\272\223"
-  "d\023\354\224c\022\377c\204\372\255c\204\372\352c\204\372\377Uq\323\377Uq\323"
-  "\377Cc\357\377Cc\357\377Cc\357\377Uq\323\377Uq\323\377b\203\372\377b\203"
-  "\372\377c\203\372\321c\203\372\364\035\034\033\323\035\034\033\331\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\250"
-  "\224c\022\352\224c\022\323\224c\022\323\224c\022\354\223d\023\372\223d\020\373"
-  "c\204\372\272c\204\372\354c\204\372\377Cc\357\377Cc\357\377\035\034\033\377"
-  "\035\034\033\323\035\034\033\323Uq\323\377\224c\022\377\224c\022\377\224c\022\377"
-  "\224c\022\377\224c\022\364\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\250\224c\022\377\224"
-  "c\022\364\224c\022\364\223d\024\367\223d\024\341\035\034\033\364\035\034\033\323\035"
-  "\034\033\311\035\034\033\311\035\034\033\352\035\034\033\311\035\034\033\352\000\000\000\000\035"
-  "\034\033\241\224c\022\352\224c\022\344\224c\022\344\224c\022\323\224c\022\364\224"
-  "c\022\377\035\034\033\352\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\236\224c\022\236\224c\022\311\224"
-  "c\022\377\035\034\033\344\035\034\033\344\223d\024\037\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\250\035\034\033\352\223d\026\337\223d\026"
-  "\344\223d\026\323\223d\026\320\224c\022\270\224c\022\377\224c\022\377\035\034\033"
-  "\272\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-  "\033\311\224c\022\311\224c\022\311\035\034\033\377\223d\024Y\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\223d\024/\035\034\033\206"
-  "\223d\024\370\223d\024\222\223d\024\375\223d\024\370\223d\024\355\223d\024\335"
-  "\223d\024\237\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\035\034\033\352\035\034\033\250\035\034\033\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\223"
-  "d\024>\035\034\033\323\035\034\033\323\035\034\033\223\035\034\033\223\035\034\033\236\035"
-  "\034\033\311\035\034\033\377\035\034\033\377\035\034\033\344\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000",
-};
-
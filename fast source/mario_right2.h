@@ -1,164 +0,0 @@
-/* GIMP RGBA C-Source image dump (mario_right2.c) */
-
-static const struct
-{
-  unsigned int width;
-  unsigned int height;
-  unsigned int bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  unsigned char pixel_data[32 * 32 * 4 + 1];
-} mario_right2 = {
-    32,
-    32,
-    4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\035\034\033\272\035\034\033\304\035\034\033\323\035\034\033\377\035\034\033\272"
-    "\035\034\033\354\035\034\033\347\035\034\033\233\035\034\033\250\035\034\033\377\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\035\034\033\377\370\067\023X\370\067\023\327\370\067\023\341\370"
-    "\067\023\370\370\067\023\354\370\066\022\374\370<\036\377\370[M\377\374\310\305"
-    "\352\377\370\367\247\035\034\033\321\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\344\370\067\023{\370\067\023"
-    "\363\370\067\023\376\370\067\023\377\370\067\023\377\370\067\023\377\370\062\000\377"
-    "\370[M\377\374\323\321\377\376\364\363\377\376\362\361\257\035\034\033\354\035"
-    "\034\033\272\035\034\033\314\035\034\033\314\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\035\034\033\272\362<\023|\362<\023\377\362<\023\377\362=\024"
-    "\377\365H\035\377\367M\"\377\366I\035\377\363C\040\377\366dN\377\370oZ\377\367"
-    "eL\370\367M$\347\370;\026\327\370\067\023\326\370\067\023q\035\034\033\323\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\352\246k!\220\250l\""
-    "\377\246j\040\377\243f\034\377\324\232J\377\356\262\\\377\334\241P\377\256"
-    "r)\377\256r)\377\352\256Y\377\353\260Z\377\353\257Z\335\356\236PH\035\034\033"
-    "\250\035\034\033\207\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033"
-    "\247\223d\024\217\304\224E\372\346\262[\377\333\251U\377\247x,\377\313\232"
-    "J\377\351\265^\377\333\251T\377\377\377\377\377\035\034\033\377\320\236M\377"
-    "\353\267^\377\352\266^\374\352\266^\355\352\266^\354\352\266^\207\035\034\033"
-    "\223\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\344\223d\024\254\306"
-    "\226F\377\354\267_\377\341\256X\377\246w+\377\226g\031\377\304\223D\377\350"
-    "\264]\377\345\261[\377\344\261Z\377\344\261Z\377\346\263\\\377\352\266^\377"
-    "\352\266^\377\352\266^\377\352\266^\372\352\266^\240\035\034\033\272\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\035\034\033\323\223d\024\323\223d\024\374\307\226G\377\353\267"
-    "_\377\342\256Y\377\255}\062\377\232k\036\377\303\223D\377\350\264]\377\345"
-    "\261[\377\344\261Z\377\277\217A\377\271\211<\377\342\257Y\377\344\261Z\377"
-    "\344\261Z\377\347\263\\\372\352\266^\253\035\034\033\354\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\035\034\033\311\223d\024\345\223d\024\377\303\223D\377\347\263\\\377\351"
-    "\265]\377\345\262[\377\344\261Z\377\350\264]\377\335\252U\377\254}\061\377"
-    "\236o#\377P\067\015\377P\067\015\377P\067\015\377P\067\015\377P\067\015\377\244u)\221"
-    "\035\034\033\354\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\223d\024&\035\034\033\223\223d\024"
-    "\330\226g\031\365\267\210:\377\343\257Y\377\351\265^\377\352\266^\377\352"
-    "\266^\377\351\265]\377\340\255X\377\261\202\066\377\233l\037\377\235n\"\377"
-    "\235n\"\377\234n!\376\226g\031\363\223d\023s\035\034\033\272\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\223d\024\012\035\034\033\250\035\034\033\323\225f\027\303\252"
-    "{/\355\334\251U\374\345\262[\377\344\261Z\377\346\262[\377\351\265]\377\346"
-    "\262[\377\344\261Z\363\344\260Z\351\344\261Z\352\344\260Z\245\331\247SA\035"
-    "\034\033\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\035\034\033\364\231q\\\334\232qW\377\230oW\377\261\203X\377"
-    "\346\253Z\377\354\260[\376\343\255v\211\276\243\271\040\035\034\033\223\035\034"
-    "\033\354\035\034\033\306\377\377\377\007\035\034\033\304\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\311\035\034\033\246b\204\373\364b\204"
-    "\373\377b\204\373\377b\204\373\377b\204\373\377\350Yn\377\365O\062\377\301"
-    "l\271\367b\204\373\377\035\034\033\377\235\260\375\003\377\377\377\014\035\034\033"
-    "\354\377\377\377\223\035\034\033\364\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\035\034\033\377\370\067\013\205\365;\063\362\360AQ\376\360BS\377\361@N\377b\204"
-    "\373\377b\204\373\377b\204\373\377\333V\217\377\363>B\377\316_\246\373b\204"
-    "\373\377\035\034\033\377\377\374\372\243\377\377\377\370\377\377\377\374\377"
-    "\377\377\324\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\370\067\023\262"
-    "\370\067\023\371\370\067\023\377\370\067\023\377\370\067\023\377\370\067\021\377\366"
-    ":+\377b\204\373\377b\204\373\377b\204\373\377\317^\245\377\327Y\227\377\230"
-    "v\337\374b\204\373\377\374\334\334\370\377\377\377\377\377\377\377\377\377"
-    "\377\377\346\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\370\067\023\323\370\067"
-    "\023\374\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023"
-    "\377\372\064\000\377b\204\373\377b\204\373\377b\204\373\377\310b\257\377\370"
-    "\067\027\377\342N~\377b\204\373\377\336\331\366\377\377\374\372\377\377\375"
-    "\375\377\376\367\366\323\035\034\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\323\370\067"
-    "\023\345\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023"
-    "\377\370\067\021\377\366:+\377b\204\373\377b\204\373\377b\204\373\377\310b"
-    "\257\377\373\063\000\377\350Jp\377b\204\373\377\326l\245\377\375\275\267\377"
-    "\375\335\333\374\371yq\211\035\034\033\264\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\272\370\067\023E\370"
-    "\067\023\347\370\067\023\377\370\067\023\377\370\067\023\377\370\067\023\377\370\067"
-    "\030\377\364==\377b\204\373\377u\200\363\377f\205\372\377v\220\364\377\307"
-    "p\261\377\365\071\064\377\351Pm\377\234\210\336\377\331b\225\377\372L\060\371"
-    "\371bV\263\035\034\033]\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\257\370\067\023]\370\067\023\353\370\067"
-    "\023\375\370\067\023\377\370\067\017\377\366;\062\377\360AQ\377\355E^\377b\204"
-    "\373\377b\204\373\377`\203\374\377b\204\373\377\327\334\247\377\271\277\311"
-    "\377\255h\316\377\355yf\377\357\335u\376\365\233M\363\370\021\000\207\035\034"
-    "\033\250\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\035\034\033\352\371aTf\371aT\373\371aT\377\371aT\377"
-    "\372_L\377\336r\235\377b\204\373\377b\204\373\377b\204\373\377a\204\373\377"
-    "b\204\373\377d\205\372\377b\204\373\377b\204\373\377b\204\373\377b\204\373"
-    "\377b\204\373\364\035\034\033\352\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-    "\033\250\376\366\365f\376\366\365\373\376\366\365\377\376\366\365\377\377"
-    "\366\365\377\375\370\370\377\352\354\376\377b\204\373\377]\201\373\377b\204"
-    "\373\377b\204\373\377o\207\355\377b\204\373\377b\204\373\377b\204\373\377"
-    "b\204\373\377\035\034\033\323\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-    "\033\323\377\377\377f\377\377\377\373\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\376\376\377\377\352\355\376\377b\204\373\377]\201\373\377b\204"
-    "\373\377b\204\373\377o\207\355\377o\207\355\377b\204\373\377b\204\373\377"
-    "b\204\373\377b\204\373\377\035\034\033\246\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035"
-    "\034\033\323\377\377\377]\377\377\377\353\377\377\377\375\377\377\377\377\377"
-    "\377\377\377\341\345\376\377\201\231\373\377e\206\373\377b\204\373\377b\204"
-    "\373\377b\204\373\377b\204\373\377o\207\355\377o\207\355\377d\203\370\377"
-    "g\202\362\377b\204\373\377\035\034\033\311\000\000\000\000\000\000\000\000\223d\024\036\000\000\000"
-    "\000\035\034\033\034\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\035\034\033\377\377\377\377@\377\377\377\324\377\377\377\354"
-    "\374\375\377\365\326\333\375\377>\\\345\377[v\356\377o\207\355\377o\207\355"
-    "\377b\204\373\377b\204\373\377b\204\373\377o\207\355\377o\207\355\377b\204"
-    "\373\377b\204\373\377\035\034\033\250\225b\000$\000\000\000\000\000\000\000\000\000\000\000\000\224c\022"
-    "\007\035\034\033m\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\035\034\033\250\371\370\367\024\035\034\033\377\213\235\365\233h\202"
-    "\365\377$H\347\377[v\356\377o\207\355\377o\207\355\377o\207\355\377b\204"
-    "\373\377b\204\373\377b\204\373\377i\204\343\377b\204\373\377b\204\373\352"
-    "\035\034\033\250\223d\020\064\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033"
-    "\344\035\034\033\377\223d\021\261|w\277\371a\203\374\377Yz\367\377$H\347\377"
-    ">\\\345\377[v\356\377[v\356\377o\207\355\377b\204\373\377b\204\373\377c\204"
-    "\372\377i\201\356\377i\201\356\377\035\034\033\223\035\034\033E\035\034\033/\035\034"
-    "\033f\035\034\033\364\035\034\033\323\035\034\033`\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034\033\344\223d\024\316\223d\024\353\223"
-    "d\022\371~u\266\377e\203\366\377b\203\372\377^\177\371\377$H\347\377$H\347"
-    "\377;[\354\372[v\356\377b\204\373\377[v\356\377c\204\372\377d\204\371\377"
-    "h\202\362\377\224c\022\377\035\034\033\377\035\034\033\352\035\034\033\250\224c\022"
-    "\272\224c\022\354\035\034\033\272\035\034\033*\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\035\034\033\232\223d\024\377\223d\024\373\223d\024\377\223d\024\377"
-    "\222e\063\377\205p\235\377i\201\357\377c\204\372\376_\201\372\361^\177\371"
-    "\356^\177\371\245\035\034\033\344>\\\345\377Uq\323\377c\204\372\377h\202\362"
-    "\375\224c\022\377\224c\022\377\223d\023\375\224c\023\372\223d\023\377\223d\023"
-    "\377\223d\023\362\035\034\033\342\035\034\033\070\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\035\034\033\250\223d\024\377\223d\024\353\223d\024\375\223d\024"
-    "\377\223d\020\377\222e(\370\035\034\033\377\035\034\033\250\035\034\033\250\035\034\033"
-    "\344\035\034\033\314\035\034\033\344>\\\345\377Cc\357\377c\204\372\377\224c\022"
-    "\377\224c\022\377\223d\020\306\224c\022\377\224c\022\377\223d\023\377\223d\023"
-    "\377\035\034\033\323\035\034\033@\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\035\034\033\377\223d\024\377\223d\024\347\223d\024\377\223d"
-    "\024\377\035\034\033\377\217gW\040j\200\354\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\035\034\033\311\035\034\033\270\035\034\033\311\035\034\033\323\035\034\033\333\223d\023"
-    "\263\223d\023\377\223d\023\377\223d\023\364\035\034\033\323\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-    "\033\377\223d\024\377\223d\024\374\223d\024\377\223d\024\266\035\034\033\323\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\035\034"
-    "\033T\035\034\033\263\223d\023\364\223d\023\364\035\034\033\364\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\035\034\033\354\035\034\033\272\035\034\033\377\035\034\033\377\035\034"
-    "\033\323\223d\024\"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\035\034\033c\035\034\033\323\035\034\033\323\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\035\034\033D\000\000\000\000\000\000\000\000\000\000\000\000",
-};
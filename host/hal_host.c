@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hal.h"
+
+// Headless platform for running the game on a Linux host (make sim). The framebuffer is plain memory, time is
+// simulated and only moves when the game waits or reads the controller, so the game runs as fast as the CPU allows
+// and every run of the same input draws the same frames. Settings come from the environment:
+//
+//   SIM_FRAMES  frames to present before exiting (default 600)
+//   SIM_PPM     file to write the last frame to, as a binary PPM
+//   SIM_INPUT   controller script: one "<reads> <buttons>" line per step, holding the buttons for that many reads of
+//               the controller. Buttons are names joined by '+' (B Y SELECT START UP DOWN LEFT RIGHT A X L R), or '-'
+//               for none. Nothing is pressed once the script runs out.
+//   SIM_RECORD  file to record the game's controller and clock reads to (see source/replay.c)
+//   SIM_REPLAY  recording to play back instead of the controller; the simulator exits when it runs out
+//   SIM_REALTIME set to 1 to run off the host's clock at the Pi's speed, waits and all. Replays then keep the pace
+//               they were recorded at; otherwise they run as fast as the CPU allows.
+
+#define READ_TIME 204        // Microseconds a controller read takes on the Pi.
+#define STALL_READS 1000000  // Reads without a frame before the simulator gives up.
+#define SCRIPT_MAX 1024
+
+static const char *button_names[HAL_BUTTONS] = {
+    "B", "Y", "SELECT", "START", "UP", "DOWN", "LEFT", "RIGHT", "A", "X", "L", "R"
+};
+
+struct step
+{
+    int reads;
+    unsigned int pressed; // Bit i set if button i is down.
+};
+
+static struct step script[SCRIPT_MAX];
+static int script_len, script_pos, step_reads;
+
+static unsigned char *pixels;
+static struct hal_fb screen;
+static unsigned int palette[256];
+
+static unsigned int now;  // Simulated microseconds.
+static int frames, frame_limit = 600, reads_since_frame;
+static int shown; // Page last shown.
+static const char *ppm_path;
+static struct timespec started;
+static int realtime;
+
+static const char *record_path;
+static const unsigned char *recording;
+static int recording_len;
+
+static unsigned int parse_buttons(char *s)
+{
+    unsigned int pressed = 0;
+
+    for (char *name = strtok(s, "+\n"); name; name = strtok(0, "+\n")) {
+        for (int i = 0; i < HAL_BUTTONS; i++) {
+            if (button_names[i] && !strcmp(name, button_names[i])) pressed |= 1 << i;
+        }
+    }
+    return pressed;
+}
+
+static void load_script(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+
+    if (!f) {
+        fprintf(stderr, "sim: can't open %s\n", path);
+        exit(1);
+    }
+    while (script_len < SCRIPT_MAX && fgets(line, sizeof(line), f)) {
+        char buttons[200];
+
+        if (sscanf(line, "%d %199s", &script[script_len].reads, buttons) != 2) continue;
+        script[script_len].pressed = parse_buttons(buttons);
+        script_len++;
+    }
+    fclose(f);
+}
+
+void hal_init()
+{
+    const char *s;
+
+    if ((s = getenv("SIM_FRAMES"))) frame_limit = atoi(s);
+    if ((s = getenv("SIM_INPUT"))) load_script(s);
+    ppm_path = getenv("SIM_PPM");
+    realtime = (s = getenv("SIM_REALTIME")) && atoi(s);
+    clock_gettime(CLOCK_MONOTONIC, &started);
+}
+
+int hal_fb_depth(int depth)
+{
+    const char *s = getenv("SIM_DEPTH");
+
+    return s && atoi(s) ? atoi(s) : depth;
+}
+
+int hal_fb_open(int width, int height, int depth, struct hal_fb *fb)
+{
+    screen.width = width;
+    screen.height = height;
+    screen.depth = depth;
+    screen.pitch = width * depth / 8;
+    screen.isrgb = 1;
+    screen.pages = 2;
+    screen.bytes = (unsigned long) screen.pages * height * screen.pitch;
+
+    free(pixels);
+    pixels = calloc(1, screen.bytes);
+    screen.base = pixels;
+    *fb = screen;
+    return 1;
+}
+
+void hal_fb_palette(const unsigned int *argb, int n)
+{
+    memcpy(palette, argb, n * sizeof(unsigned int));
+}
+
+static unsigned int pixel_rgb(const unsigned char *p)
+{
+    if (screen.depth == 8) return palette[*p] & 0xFFFFFF;
+    if (screen.depth == 16) {
+        unsigned int c = p[0] | (p[1] << 8);
+        unsigned int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+        return ((r << 3 | r >> 2) << 16) | ((g << 2 | g >> 4) << 8) | (b << 3 | b >> 2);
+    }
+    return (p[0] | (p[1] << 8) | (p[2] << 16)) & 0xFFFFFF;
+}
+
+static void write_ppm(int page)
+{
+    FILE *f = fopen(ppm_path, "wb");
+    const unsigned char *row = pixels + (unsigned long) page * screen.height * screen.pitch;
+
+    if (!f) {
+        fprintf(stderr, "sim: can't write %s\n", ppm_path);
+        return;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", screen.width, screen.height);
+    for (unsigned int y = 0; y < screen.height; y++, row += screen.pitch) {
+        for (unsigned int x = 0; x < screen.width; x++) {
+            unsigned int c = pixel_rgb(row + x * screen.depth / 8);
+            fputc(c >> 16, f);
+            fputc((c >> 8) & 0xFF, f);
+            fputc(c & 0xFF, f);
+        }
+    }
+    fclose(f);
+}
+
+static void finish(int page, const char *why)
+{
+    struct timespec t;
+    double ms;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    ms = (t.tv_sec - started.tv_sec) * 1e3 + (t.tv_nsec - started.tv_nsec) / 1e6;
+
+    if (ppm_path) write_ppm(page);
+    fflush(stdout);
+    fprintf(stderr, "sim: %s after %d frames, %.3f s simulated, %.1f ms on the host (%.0f frames/s)\n", why, frames,
+            hal_time() / 1e6, ms, ms > 0 ? frames * 1e3 / ms : 0.0);
+    exit(0);
+}
+
+/* There is no display to wait for, so showing a page only counts the frame. */
+void hal_fb_show(int page)
+{
+    frames++;
+    shown = page;
+    reads_since_frame = 0;
+    if (frames >= frame_limit) finish(page, "done");
+}
+
+unsigned int hal_time()
+{
+    struct timespec t;
+
+    if (!realtime) return now;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec - started.tv_sec) * 1000000 + (t.tv_nsec - started.tv_nsec) / 1000;
+}
+
+void hal_wait(int us)
+{
+    struct timespec t = { us / 1000000, us % 1000000 * 1000L };
+
+    if (realtime) nanosleep(&t, 0);
+    else now += us;
+}
+
+int hal_read_input(int *buttons)
+{
+    unsigned int pressed = 0;
+
+    if (!realtime) now += READ_TIME;
+    if (++reads_since_frame > STALL_READS) finish(shown, "stalled waiting for input");
+
+    while (script_pos < script_len && step_reads >= script[script_pos].reads) {
+        script_pos++;
+        step_reads = 0;
+    }
+    if (script_pos < script_len) {
+        pressed = script[script_pos].pressed;
+        step_reads++;
+    }
+
+    for (int i = 0; i < HAL_BUTTONS; i++) buttons[i] = !(pressed & (1 << i));
+    return pressed != 0;
+}
+
+void hal_log(char *s)
+{
+    fputs(s, stdout);
+}
+
+void hal_log_hex(unsigned int n)
+{
+    printf("0x%08X", n);
+}
+
+static void write_recording()
+{
+    FILE *f = fopen(record_path, "wb");
+
+    if (!f || fwrite(recording, 1, recording_len, f) != (size_t) recording_len) {
+        fprintf(stderr, "sim: can't write %s\n", record_path);
+    }
+    if (f) fclose(f);
+}
+
+int hal_replay_mode(unsigned char *buf, int max, int *len)
+{
+    const char *path = getenv("SIM_REPLAY");
+
+    *len = 0;
+    if (path) {
+        FILE *f = fopen(path, "rb");
+
+        if (!f) {
+            fprintf(stderr, "sim: can't open %s\n", path);
+            exit(1);
+        }
+        *len = fread(buf, 1, max, f);
+        fclose(f);
+        return realtime ? HAL_REPLAY : HAL_REPLAY_FAST;
+    }
+
+    if ((record_path = getenv("SIM_RECORD"))) {
+        atexit(write_recording);
+        return HAL_RECORD;
+    }
+    return HAL_LIVE;
+}
+
+/* The recording stays where it is; it's written out when the simulator exits. */
+void hal_replay_save(const unsigned char *buf, int len)
+{
+    recording = buf;
+    recording_len = len;
+}
+
+void hal_replay_end(char *why)
+{
+    finish(shown, why);
+}
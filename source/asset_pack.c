@@ -0,0 +1,5372 @@
+/* Compressed asset pack, generated by tools/mkassets.py from the images in art/. Do not edit. */
+
+#include "asset_pack.h"
+
+const struct asset asset_table[NUM_ASSETS] = {
+    { 0, 70708, 481, 100, 0 }, // title_screen, 192400 bytes raw
+    { 70708, 9624, 500, 400, 48100 }, // titleDonkey, 800000 bytes raw
+    { 80332, 1487, 90, 36, 248100 }, // start, 12960 bytes raw
+    { 81819, 1748, 90, 36, 251340 }, // startSelected, 12960 bytes raw
+    { 83567, 848, 90, 36, 254580 }, // exit, 12960 bytes raw
+    { 84415, 1161, 90, 36, 257820 }, // exitSelected, 12960 bytes raw
+};
+
+const unsigned char asset_pack[ASSET_PACK_BYTES] = {
+    // title_screen
+    0x4f, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x31, 0xf0, 0x01, 0xc9, 0xd9, 0xec, 0x44, 0xc6, 0xd5,
+    0xea, 0xcc, 0xc5, 0xd4, 0xea, 0xee, 0xc5, 0xd5, 0xea, 0xcc, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x35,
+    0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x8f, 0xc6, 0xd6, 0xea, 0xaa, 0xcb, 0xda, 0xed, 0x22, 0xb0,
+    0x00, 0x31, 0x08, 0x44, 0x00, 0x40, 0xca, 0xda, 0xec, 0x22, 0xac, 0x00, 0x00, 0x64, 0x00, 0x00,
+    0x6c, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x35, 0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x50, 0x00, 0x48, 0xca, 0xd9, 0xec, 0x44, 0x78, 0x00, 0x0f, 0x0c, 0x00, 0x7d, 0x00, 0x5c, 0x01,
+    0x00, 0x64, 0x01, 0x00, 0xb0, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb4, 0x00, 0x0f, 0x04, 0x00, 0x35,
+    0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x00, 0x50, 0x00, 0x4f, 0xca, 0xd9, 0xec, 0x3f, 0xfc, 0x00,
+    0x7d, 0x0f, 0x90, 0x00, 0x05, 0xff, 0x02, 0xcc, 0xdc, 0xed, 0x88, 0xc7, 0xd6, 0xeb, 0xff, 0xc5,
+    0xd4, 0xea, 0xff, 0xc5, 0xd5, 0xea, 0xff, 0xc6, 0x04, 0x00, 0x20, 0x00, 0x38, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x3c, 0x00, 0x4f, 0xca, 0xda, 0xec, 0xee, 0x6c, 0x00, 0x05, 0x0f, 0x18, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x2d, 0xff, 0x04, 0xbd, 0xcc, 0xe6, 0xff, 0xa9, 0xb7, 0xdc, 0xff, 0x9e, 0xab,
+    0xd7, 0xff, 0x9c, 0xa8, 0xd6, 0xff, 0x9e, 0xaa, 0xd7, 0x04, 0x00, 0x3a, 0x22, 0x9d, 0xaa, 0x58,
+    0x00, 0xbf, 0xa0, 0xac, 0xd8, 0xff, 0xad, 0xbb, 0xde, 0xff, 0xc2, 0xd1, 0xe8, 0x38, 0x08, 0x32,
+    0x00, 0xf4, 0x04, 0x71, 0xc1, 0xd0, 0xe7, 0xff, 0xac, 0xba, 0xde, 0x5c, 0x00, 0x00, 0xbc, 0x00,
+    0x00, 0x6c, 0x00, 0x0f, 0xc0, 0x00, 0x39, 0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0xbf, 0x9f, 0xab,
+    0xd8, 0xff, 0xaa, 0xb8, 0xdd, 0xff, 0xbe, 0xcd, 0xe6, 0xbc, 0x00, 0x36, 0x00, 0xc0, 0x00, 0x0f,
+    0x04, 0x00, 0x35, 0x5f, 0xc1, 0xd0, 0xe8, 0xff, 0xad, 0x08, 0x01, 0x48, 0x00, 0x54, 0x01, 0x02,
+    0x08, 0x01, 0x8f, 0xd7, 0xff, 0xaa, 0xb7, 0xdc, 0xff, 0xbe, 0xcc, 0x08, 0x01, 0x83, 0x08, 0x50,
+    0x01, 0x00, 0x38, 0x07, 0xef, 0xb0, 0xbe, 0xe0, 0xff, 0xa1, 0xae, 0xd9, 0xff, 0x9c, 0xa9, 0xd6,
+    0xff, 0x9d, 0xa9, 0xd8, 0x02, 0x23, 0x05, 0x04, 0x02, 0xaf, 0xac, 0xd8, 0xff, 0xac, 0xb9, 0xdd,
+    0xff, 0xc0, 0xcf, 0xe7, 0x04, 0x02, 0x82, 0x08, 0xfc, 0x00, 0x0f, 0x0c, 0x00, 0x39, 0x00, 0xf0,
+    0x00, 0x00, 0xf8, 0x00, 0x31, 0x9f, 0xac, 0xd8, 0x20, 0x04, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02,
+    0x0f, 0x04, 0x00, 0x1d, 0x00, 0x80, 0x01, 0x00, 0x88, 0x01, 0x00, 0x90, 0x01, 0x3f, 0xb0, 0xbe,
+    0xdf, 0x44, 0x01, 0x22, 0x71, 0xb8, 0xc6, 0xe3, 0xff, 0xa5, 0xb2, 0xda, 0xcc, 0x01, 0x1f, 0x9c,
+    0xd0, 0x01, 0x24, 0x0c, 0xb8, 0x00, 0x00, 0x98, 0x00, 0x00, 0x04, 0x00, 0x79, 0xa4, 0xb1, 0xda,
+    0xff, 0xb6, 0xc4, 0xe2, 0x98, 0x00, 0x3f, 0xe1, 0xf2, 0xf9, 0x34, 0x0c, 0x3e, 0x0f, 0x9c, 0x01,
+    0x39, 0x08, 0x4c, 0x00, 0x48, 0xe1, 0xf2, 0xf8, 0x22, 0xb0, 0x00, 0x4f, 0xc1, 0xd0, 0xe8, 0x66,
+    0x14, 0x04, 0x19, 0x00, 0x04, 0x01, 0x00, 0x04, 0x00, 0x6a, 0xa4, 0xb0, 0xda, 0xff, 0xb5, 0xc3,
+    0x08, 0x01, 0x08, 0x68, 0x00, 0x0f, 0x0c, 0x00, 0x11, 0x00, 0x88, 0x00, 0x00, 0x90, 0x00, 0x04,
+    0x2c, 0x00, 0x71, 0xb9, 0xc7, 0xe3, 0xff, 0xa6, 0xb3, 0xdb, 0x3c, 0x02, 0x0f, 0xb8, 0x01, 0x35,
+    0x0c, 0xc8, 0x01, 0x04, 0x10, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xac, 0x04, 0xb9, 0xa1, 0xad, 0xd8,
+    0xff, 0xaf, 0xbc, 0xdf, 0xff, 0xc3, 0xd2, 0xe9, 0xd4, 0x01, 0x04, 0x94, 0x00, 0x0f, 0x08, 0x00,
+    0x75, 0x31, 0xc4, 0xd3, 0xe9, 0x7c, 0x02, 0xff, 0x03, 0x7f, 0x89, 0xcb, 0xff, 0x66, 0x6f, 0xc3,
+    0xff, 0x61, 0x68, 0xc2, 0xff, 0x64, 0x6c, 0xc3, 0xff, 0x65, 0x6d, 0x04, 0x00, 0x37, 0x31, 0x63,
+    0x6b, 0xc2, 0x58, 0x00, 0x71, 0x6a, 0x73, 0xc4, 0xff, 0x87, 0x92, 0xce, 0x34, 0x07, 0x0f, 0x54,
+    0x0e, 0x31, 0x40, 0xc8, 0xd8, 0xeb, 0x66, 0x18, 0x07, 0xdf, 0x85, 0x90, 0xcd, 0xff, 0x69, 0x72,
+    0xc4, 0xff, 0x60, 0x68, 0xc2, 0xff, 0x63, 0xbc, 0x00, 0x3c, 0x00, 0x0c, 0x01, 0x00, 0x58, 0x00,
+    0x71, 0x67, 0x70, 0xc4, 0xff, 0x81, 0x8b, 0xcc, 0x48, 0x02, 0x00, 0x0c, 0x0e, 0x0f, 0xc0, 0x01,
+    0x75, 0x00, 0x88, 0x00, 0x00, 0xc4, 0x10, 0x00, 0x24, 0x05, 0x54, 0x86, 0x91, 0xce, 0xff, 0x6a,
+    0x08, 0x01, 0x2f, 0x6b, 0xc2, 0xc4, 0x01, 0x3a, 0x00, 0x08, 0x01, 0x00, 0x1c, 0x02, 0x71, 0x67,
+    0x6f, 0xc3, 0xff, 0x80, 0x8a, 0xcb, 0x08, 0x05, 0x2f, 0xc5, 0xd4, 0xdc, 0x02, 0x87, 0xf1, 0x04,
+    0xcd, 0xdd, 0xee, 0x66, 0xb2, 0xc0, 0xe0, 0xff, 0x8d, 0x98, 0xd0, 0xff, 0x6d, 0x76, 0xc5, 0xff,
+    0x61, 0x69, 0xc2, 0x88, 0x02, 0x0f, 0xd8, 0x02, 0x21, 0x00, 0xfc, 0x00, 0x00, 0x04, 0x02, 0xff,
+    0x00, 0x68, 0x71, 0xc4, 0xff, 0x84, 0x8e, 0xcd, 0xff, 0xa9, 0xb6, 0xdc, 0xff, 0xc7, 0xd7, 0xeb,
+    0xd8, 0x03, 0x8a, 0x00, 0x18, 0x02, 0x0f, 0x04, 0x00, 0x31, 0x31, 0xc8, 0xd7, 0xeb, 0xa0, 0x0b,
+    0x62, 0x84, 0x8f, 0xcd, 0xff, 0x69, 0x71, 0x64, 0x03, 0x00, 0x10, 0x01, 0x0f, 0x48, 0x01, 0x21,
+    0x00, 0x80, 0x01, 0x00, 0x88, 0x01, 0x00, 0x90, 0x01, 0x00, 0x98, 0x01, 0x3f, 0xb1, 0xbf, 0xe0,
+    0x44, 0x01, 0x1a, 0xb1, 0xbd, 0xcb, 0xe5, 0xff, 0x9a, 0xa6, 0xd6, 0xff, 0x76, 0x80, 0xc8, 0xcc,
+    0x01, 0x00, 0x4c, 0x00, 0x0f, 0x88, 0x00, 0x21, 0x0c, 0x34, 0x00, 0xff, 0x04, 0x61, 0x6a, 0xc2,
+    0xff, 0x62, 0x6a, 0xc2, 0xff, 0x74, 0x7d, 0xc7, 0xff, 0x97, 0xa3, 0xd4, 0xff, 0xba, 0xc8, 0xe4,
+    0x98, 0x00, 0x1a, 0x0f, 0x68, 0x01, 0x31, 0x0f, 0x44, 0x00, 0x41, 0x0d, 0x14, 0x04, 0x0f, 0x1c,
+    0x05, 0x0c, 0x00, 0x04, 0x01, 0x00, 0x04, 0x00, 0xaf, 0x73, 0x7c, 0xc7, 0xff, 0x95, 0xa1, 0xd4,
+    0xff, 0xb9, 0xc7, 0x08, 0x01, 0x33, 0x40, 0xbe, 0xcd, 0xe6, 0xcc, 0x18, 0x07, 0x31, 0x78, 0x82,
+    0xc9, 0x5c, 0x06, 0x0f, 0xb8, 0x01, 0x35, 0x0c, 0xc8, 0x01, 0x04, 0x10, 0x00, 0x04, 0x68, 0x02,
+    0x71, 0x6b, 0x74, 0xc5, 0xff, 0x8a, 0x95, 0xcf, 0x88, 0x07, 0x4f, 0xcb, 0xdb, 0xed, 0xaa, 0x64,
+    0x01, 0x41, 0x0f, 0x54, 0x00, 0x19, 0x00, 0xf4, 0x06, 0x04, 0x04, 0x00, 0x04, 0x38, 0x00, 0x71,
+    0xc5, 0xd4, 0xe9, 0xee, 0xb0, 0xbd, 0xdf, 0xa8, 0x00, 0xff, 0x03, 0x57, 0x5e, 0xbf, 0xff, 0x24,
+    0x27, 0xb7, 0xff, 0x07, 0x04, 0xb5, 0xff, 0x1c, 0x1c, 0xb6, 0xff, 0x1f, 0x1f, 0x04, 0x00, 0x34,
+    0xe1, 0x20, 0xb6, 0xff, 0x18, 0x18, 0xb6, 0xff, 0x06, 0x04, 0xb5, 0xff, 0x2f, 0x33, 0xb8, 0x3c,
+    0x03, 0x31, 0x94, 0x9f, 0xd3, 0x70, 0x0a, 0x31, 0xc7, 0xd6, 0xeb, 0x18, 0x01, 0x00, 0x44, 0x15,
+    0x04, 0x94, 0x00, 0x0f, 0x08, 0x00, 0x0d, 0x04, 0x2c, 0x00, 0x00, 0x74, 0x15, 0x71, 0xb4, 0xc2,
+    0xe1, 0xff, 0x91, 0x9d, 0xd2, 0x7c, 0x07, 0x31, 0x2c, 0x30, 0xb8, 0x64, 0x00, 0x6f, 0x19, 0x19,
+    0xb6, 0xff, 0x1f, 0x20, 0xbc, 0x00, 0x34, 0xf3, 0x05, 0x1f, 0xb6, 0xff, 0x1b, 0x1b, 0xb6, 0xff,
+    0x06, 0x03, 0xb5, 0xff, 0x26, 0x2a, 0xb7, 0xff, 0x5a, 0x62, 0xc0, 0xff, 0x8c, 0x3c, 0x04, 0x00,
+    0x98, 0x15, 0x0f, 0xac, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x49, 0x04, 0x08, 0x01, 0x00, 0x44, 0x01,
+    0x00, 0xb4, 0x0a, 0x31, 0x93, 0x9e, 0xd3, 0x48, 0x04, 0x22, 0x2e, 0x32, 0x08, 0x01, 0x00, 0x74,
+    0x01, 0x0f, 0x08, 0x01, 0x06, 0x00, 0x20, 0x01, 0x13, 0x21, 0x04, 0x00, 0x13, 0x22, 0x04, 0x00,
+    0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x0f, 0xf8, 0x01, 0x04, 0x22, 0x1b, 0x1c, 0xc4, 0x01, 0xb1,
+    0x25, 0x28, 0xb7, 0xff, 0x58, 0x5f, 0xc0, 0xff, 0x8b, 0x96, 0xcf, 0xcc, 0x0c, 0x00, 0x6c, 0x0e,
+    0x00, 0xe0, 0x02, 0x00, 0x04, 0x00, 0x44, 0xca, 0xd9, 0xec, 0xee, 0x04, 0x00, 0x00, 0x10, 0x00,
+    0x0f, 0x00, 0x01, 0x41, 0x00, 0x5c, 0x16, 0x00, 0x64, 0x00, 0x17, 0xc9, 0x6c, 0x00, 0x00, 0x10,
+    0x00, 0x01, 0x04, 0x00, 0xa1, 0xda, 0xec, 0xcc, 0xcc, 0xdb, 0xed, 0xaa, 0xc8, 0xd8, 0xeb, 0x48,
+    0x05, 0x00, 0xb0, 0x05, 0xff, 0x00, 0x6c, 0x75, 0xc5, 0xff, 0x37, 0x3b, 0xb9, 0xff, 0x0a, 0x08,
+    0xb5, 0xff, 0x14, 0x14, 0xb5, 0x1c, 0x02, 0x1f, 0x52, 0x20, 0xb6, 0xff, 0x1a, 0x1a, 0x04, 0x02,
+    0xf1, 0x00, 0x2a, 0x2e, 0xb7, 0xff, 0x5e, 0x66, 0xc1, 0xff, 0x90, 0x9b, 0xd1, 0xff, 0xb3, 0xc1,
+    0xe1, 0xd8, 0x16, 0xc4, 0xcc, 0xdb, 0xed, 0xcc, 0xcb, 0xdb, 0xed, 0xcc, 0xca, 0xd9, 0xec, 0xff,
+    0x04, 0x00, 0x00, 0x14, 0x00, 0x0f, 0xfc, 0x00, 0x31, 0x4c, 0xd0, 0xe0, 0xef, 0x22, 0x5c, 0x00,
+    0x04, 0x64, 0x00, 0x0f, 0x08, 0x00, 0x25, 0x13, 0xc9, 0xa8, 0x00, 0x2f, 0xcc, 0xdc, 0x94, 0x04,
+    0x0f, 0x00, 0x2c, 0x00, 0x00, 0x64, 0x03, 0x00, 0xf0, 0x00, 0x71, 0x5f, 0x66, 0xc1, 0xff, 0x2b,
+    0x2e, 0xb8, 0x0c, 0x03, 0x0f, 0x64, 0x03, 0x16, 0x00, 0x50, 0x02, 0x00, 0x04, 0x00, 0x00, 0x5c,
+    0x02, 0xff, 0x0a, 0x22, 0xb6, 0xff, 0x15, 0x17, 0xb6, 0xff, 0x09, 0x0b, 0xb5, 0xff, 0x36, 0x3b,
+    0xb9, 0xff, 0x6b, 0x73, 0xc5, 0xff, 0x99, 0xa5, 0xd5, 0xff, 0xba, 0xc9, 0xe8, 0x05, 0x13, 0xff,
+    0x0a, 0xc2, 0xd1, 0xe8, 0x44, 0xa7, 0xb4, 0xdb, 0xff, 0x7d, 0x87, 0xca, 0xff, 0x48, 0x4f, 0xbc,
+    0xff, 0x17, 0x19, 0xb6, 0xff, 0x0c, 0x09, 0xb5, 0xff, 0x1e, 0xb0, 0x02, 0x04, 0x01, 0xc0, 0x04,
+    0x07, 0x7c, 0x00, 0x3f, 0x1f, 0x22, 0xb7, 0x04, 0x00, 0x06, 0xf1, 0x00, 0x0e, 0x10, 0xb6, 0xff,
+    0x13, 0x16, 0xb6, 0xff, 0x44, 0x49, 0xbb, 0xff, 0x79, 0x82, 0xc9, 0x94, 0x0c, 0x31, 0xbf, 0xce,
+    0xe7, 0x9c, 0x04, 0x0f, 0xc8, 0x01, 0x31, 0x0f, 0x44, 0x00, 0x61, 0x08, 0x14, 0x04, 0x2f, 0x2d,
+    0x31, 0x14, 0x04, 0x13, 0xb1, 0x0f, 0x0d, 0xb5, 0xff, 0x12, 0x12, 0xb6, 0xff, 0x42, 0x47, 0xbb,
+    0xe8, 0x08, 0x5f, 0xa2, 0xaf, 0xd9, 0xff, 0xc0, 0x08, 0x01, 0x2c, 0x00, 0xb8, 0x01, 0x00, 0xb4,
+    0x0a, 0xb1, 0x80, 0x8a, 0xcc, 0xff, 0x4c, 0x52, 0xbd, 0xff, 0x1a, 0x1c, 0xb6, 0x8c, 0x03, 0x0f,
+    0xb8, 0x01, 0x0a, 0x0f, 0xd4, 0x01, 0x09, 0x0f, 0x1c, 0x00, 0x0d, 0xe1, 0x20, 0xb6, 0xff, 0x16,
+    0x16, 0xb6, 0xff, 0x07, 0x05, 0xb5, 0xff, 0x32, 0x36, 0xb8, 0x34, 0x0c, 0x31, 0x96, 0xa2, 0xd4,
+    0x40, 0x11, 0x00, 0x50, 0x0a, 0x00, 0x98, 0x04, 0x40, 0xcb, 0xda, 0xed, 0xcc, 0xa4, 0x0b, 0x0f,
+    0x98, 0x01, 0x55, 0x31, 0xb8, 0xc7, 0xe3, 0x3c, 0x14, 0x00, 0xec, 0x0e, 0x00, 0x04, 0x00, 0x00,
+    0xc8, 0x11, 0x00, 0x14, 0x10, 0x00, 0x04, 0x00, 0x71, 0xa0, 0xad, 0xd8, 0xff, 0x8e, 0x99, 0xd1,
+    0x30, 0x08, 0xf3, 0x00, 0x39, 0x3d, 0xb9, 0xff, 0x00, 0x00, 0xb3, 0xff, 0x00, 0x00, 0xb1, 0xff,
+    0x00, 0x00, 0xb2, 0x04, 0x00, 0x08, 0x0c, 0x00, 0x04, 0x14, 0x00, 0x0f, 0x08, 0x00, 0x29, 0xd1,
+    0xb4, 0xff, 0x46, 0x4b, 0xbc, 0xff, 0x74, 0x7e, 0xc8, 0xff, 0x93, 0x9f, 0xd3, 0xe4, 0x01, 0x04,
+    0x90, 0x00, 0x6f, 0xae, 0xbb, 0xde, 0xff, 0xbf, 0xce, 0xe4, 0x13, 0x07, 0x00, 0x04, 0x16, 0x00,
+    0xc8, 0x16, 0x00, 0xb8, 0x00, 0x00, 0x34, 0x00, 0xf3, 0x04, 0xa2, 0xae, 0xd9, 0xff, 0x92, 0x9d,
+    0xd2, 0xff, 0x72, 0x7b, 0xc7, 0xff, 0x42, 0x48, 0xbb, 0xff, 0x00, 0x00, 0xb4, 0xb4, 0x00, 0x0f,
+    0xa0, 0x00, 0x29, 0x08, 0x3c, 0x00, 0x08, 0xfc, 0x00, 0x00, 0x0c, 0x00, 0xd1, 0xb3, 0xff, 0x3c,
+    0x41, 0xba, 0xff, 0x6e, 0x76, 0xc5, 0xff, 0x8f, 0x9a, 0xd1, 0xe8, 0x10, 0x00, 0x8c, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x90, 0x00, 0x0f, 0x04, 0x00, 0x1e, 0xb0, 0xb1, 0xda, 0xff, 0xa3, 0xb0, 0xda,
+    0xff, 0xa6, 0xb2, 0xdb, 0xff, 0x08, 0x09, 0x00, 0x4c, 0x16, 0x0f, 0x14, 0x02, 0x11, 0x00, 0x24,
+    0x01, 0x00, 0x2c, 0x01, 0x04, 0x78, 0x00, 0x00, 0x44, 0x01, 0x00, 0x80, 0x07, 0x6f, 0x73, 0x7d,
+    0xc7, 0xff, 0x44, 0x4a, 0x08, 0x01, 0x1d, 0x00, 0xf0, 0x01, 0x04, 0x04, 0x00, 0x08, 0xfc, 0x00,
+    0x08, 0x0c, 0x00, 0x00, 0xfc, 0x00, 0x04, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x51, 0xb3, 0xff, 0x3a,
+    0x3f, 0xba, 0xdc, 0x06, 0x00, 0x3c, 0x02, 0x00, 0x44, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x04, 0x01, 0x00, 0x64, 0x02, 0x00, 0x04, 0x00, 0x00, 0xb0, 0x16, 0x00, 0xf8, 0x02, 0x00,
+    0x1c, 0x07, 0x0f, 0xd8, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x0d, 0x40, 0xcf, 0xdf, 0xef, 0x22, 0x08,
+    0x0d, 0x00, 0x78, 0x18, 0x00, 0x60, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x70, 0x00, 0x0c, 0x04, 0x00,
+    0x00, 0x88, 0x00, 0x00, 0x4c, 0x13, 0xff, 0x00, 0x97, 0xa2, 0xd4, 0xff, 0x7a, 0x84, 0xca, 0xff,
+    0x4e, 0x55, 0xbd, 0xff, 0x03, 0x00, 0xb5, 0x1c, 0x02, 0x24, 0x00, 0xf0, 0x00, 0x08, 0xfc, 0x00,
+    0xd1, 0xb4, 0xff, 0x40, 0x46, 0xbb, 0xff, 0x71, 0x7a, 0xc6, 0xff, 0x91, 0x9c, 0xd2, 0x84, 0x02,
+    0x00, 0x70, 0x00, 0x00, 0x04, 0x00, 0x00, 0x88, 0x00, 0x00, 0x78, 0x00, 0x00, 0x9c, 0x00, 0xcf,
+    0xab, 0xb8, 0xdd, 0xff, 0xbb, 0xc9, 0xe4, 0xff, 0xcd, 0xdd, 0xee, 0x88, 0xd8, 0x00, 0x0d, 0x0f,
+    0x20, 0x00, 0x05, 0x40, 0xcb, 0xda, 0xed, 0xee, 0x40, 0x01, 0x00, 0x24, 0x1a, 0x00, 0x54, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x64, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x01, 0x38, 0x01, 0x21, 0xb1, 0xda,
+    0x8c, 0x12, 0x00, 0x84, 0x1a, 0x3f, 0xcf, 0xdf, 0xef, 0xe4, 0x20, 0x02, 0x71, 0xc1, 0xcf, 0xe7,
+    0xff, 0xab, 0xb9, 0xdd, 0x64, 0x03, 0x64, 0x6f, 0x78, 0xc6, 0xff, 0x40, 0x45, 0x5c, 0x02, 0x0c,
+    0x14, 0x01, 0x04, 0x20, 0x01, 0x0f, 0x08, 0x00, 0x09, 0x04, 0x64, 0x02, 0x00, 0x08, 0x00, 0xff,
+    0x05, 0xb2, 0xff, 0x02, 0x02, 0xb5, 0xff, 0x4c, 0x53, 0xbd, 0xff, 0x78, 0x81, 0xc9, 0xff, 0x98,
+    0xa4, 0xd5, 0xff, 0xb1, 0xbe, 0x10, 0x0f, 0x0b, 0x00, 0xc4, 0x04, 0x00, 0x6c, 0x01, 0x00, 0x8c,
+    0x0f, 0x73, 0x5d, 0x65, 0xc1, 0xff, 0x27, 0x2a, 0xb7, 0xd0, 0x01, 0x08, 0x8c, 0x00, 0x08, 0x80,
+    0x00, 0x0c, 0x18, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x04, 0x00, 0x0f, 0xf1, 0x00, 0x20, 0x23, 0xb7,
+    0xff, 0x5b, 0x63, 0xc0, 0xff, 0x83, 0x8d, 0xcc, 0xff, 0x9b, 0xa8, 0xd6, 0xec, 0x11, 0x04, 0xdc,
+    0x01, 0x0f, 0x78, 0x01, 0x15, 0x04, 0x04, 0x02, 0x00, 0x84, 0x0e, 0x39, 0xbd, 0xcc, 0xe6, 0x3c,
+    0x20, 0x00, 0xd0, 0x06, 0x00, 0xbc, 0x03, 0x00, 0x4c, 0x00, 0x01, 0x88, 0x01, 0x21, 0xb2, 0xda,
+    0x64, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x18, 0x00, 0x00, 0x74,
+    0x00, 0x03, 0x14, 0x04, 0x14, 0x66, 0x20, 0x02, 0x40, 0xe2, 0xf3, 0xf9, 0x44, 0xe0, 0x15, 0x04,
+    0x10, 0x00, 0x31, 0xbc, 0xcb, 0xe5, 0x18, 0x19, 0x00, 0x34, 0x00, 0x00, 0x74, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x38, 0x00, 0x00, 0x04, 0x00, 0x02, 0x14, 0x04, 0x1f, 0xd2, 0x14, 0x04, 0x20, 0x02,
+    0x38, 0x01, 0x71, 0x1d, 0x1f, 0xb6, 0xff, 0x57, 0x5f, 0xbf, 0x38, 0x07, 0x31, 0x9f, 0xab, 0xd7,
+    0x30, 0x0d, 0x04, 0x78, 0x00, 0x0f, 0x08, 0x00, 0x0d, 0x31, 0xb7, 0xc5, 0xe3, 0x28, 0x12, 0x00,
+    0x90, 0x00, 0x31, 0xa5, 0xb1, 0xda, 0xd4, 0x1c, 0x31, 0x88, 0x92, 0xce, 0x20, 0x0c, 0x00, 0xc4,
+    0x09, 0x02, 0x5c, 0x06, 0x02, 0x68, 0x00, 0x0e, 0x0c, 0x00, 0x08, 0xc4, 0x01, 0x0f, 0x0c, 0x00,
+    0x31, 0xf1, 0x02, 0xb4, 0xff, 0x49, 0x4f, 0xbc, 0xff, 0x77, 0x80, 0xc8, 0xff, 0x95, 0xa0, 0xd3,
+    0xff, 0xa3, 0xaf, 0xd9, 0x70, 0x01, 0x00, 0x24, 0x01, 0x00, 0xa4, 0x16, 0x00, 0xe4, 0x02, 0x0f,
+    0xd0, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x2d, 0x00, 0x64, 0x0a, 0x00, 0x6c, 0x0a, 0x71, 0x7a, 0x84,
+    0xc9, 0xff, 0x6c, 0x74, 0xc5, 0x04, 0x00, 0x31, 0x6e, 0x77, 0xc6, 0x54, 0x03, 0x00, 0x04, 0x00,
+    0x00, 0x7c, 0x07, 0x00, 0xd8, 0x0b, 0x60, 0x47, 0x4d, 0xbc, 0xff, 0x24, 0x28, 0xd8, 0x02, 0x00,
+    0xac, 0x04, 0x0f, 0x04, 0x00, 0x45, 0x00, 0x24, 0x07, 0x11, 0xb5, 0x94, 0x09, 0x31, 0x4d, 0x53,
+    0xbd, 0x94, 0x01, 0x00, 0xc8, 0x05, 0x00, 0x98, 0x00, 0x00, 0x8c, 0x00, 0x00, 0xe4, 0x13, 0x00,
+    0x1c, 0x01, 0x00, 0x9c, 0x0f, 0x0c, 0xf8, 0x00, 0x00, 0xd0, 0x17, 0x00, 0x6c, 0x02, 0x31, 0x82,
+    0x8c, 0xcc, 0xbc, 0x00, 0x01, 0x38, 0x00, 0x12, 0x75, 0x60, 0x14, 0x91, 0x4b, 0x52, 0xbd, 0xff,
+    0x2b, 0x2f, 0xb8, 0xff, 0x00, 0x68, 0x05, 0x02, 0x64, 0x00, 0x02, 0x0c, 0x00, 0x0f, 0xc8, 0x00,
+    0x3f, 0x00, 0x0c, 0x0f, 0x71, 0x48, 0x4e, 0xbc, 0xff, 0x5f, 0x67, 0xc1, 0x4c, 0x01, 0x00, 0xb8,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x54, 0x01, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0x90, 0x13, 0x71, 0x6a,
+    0x73, 0xc5, 0xff, 0x70, 0x79, 0xc6, 0xa0, 0x17, 0x00, 0xb4, 0x06, 0x3f, 0xc7, 0xd7, 0xeb, 0xb4,
+    0x05, 0x0a, 0x00, 0x38, 0x18, 0x00, 0xdc, 0x02, 0x32, 0x83, 0x8d, 0xcd, 0x08, 0x01, 0x00, 0xd4,
+    0x01, 0x21, 0x75, 0xc5, 0x4c, 0x01, 0x00, 0xd4, 0x04, 0x2f, 0x2c, 0x31, 0x08, 0x01, 0x53, 0x31,
+    0x25, 0x29, 0xb7, 0x34, 0x02, 0x00, 0x1c, 0x0d, 0x00, 0x44, 0x02, 0x00, 0x04, 0x01, 0x00, 0x04,
+    0x00, 0x00, 0x04, 0x01, 0x00, 0x10, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x07, 0x00, 0x88, 0x0e,
+    0x00, 0x2c, 0x04, 0x0c, 0xd0, 0x01, 0x0f, 0x10, 0x00, 0x21, 0x00, 0xa4, 0x08, 0x00, 0x48, 0x1c,
+    0x00, 0x08, 0x17, 0x00, 0x3c, 0x01, 0x00, 0x68, 0x00, 0x00, 0x70, 0x00, 0x08, 0x04, 0x00, 0x00,
+    0x84, 0x00, 0x00, 0x50, 0x01, 0x00, 0x20, 0x00, 0x00, 0x98, 0x12, 0xa0, 0x51, 0x58, 0xbe, 0xff,
+    0x33, 0x38, 0xb9, 0xff, 0x05, 0x08, 0x0c, 0x02, 0x0f, 0x1c, 0x02, 0x33, 0x71, 0x29, 0x2d, 0xb8,
+    0xff, 0x4a, 0x51, 0xbd, 0xdc, 0x16, 0x00, 0x88, 0x02, 0x00, 0x74, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x94, 0x00, 0x00, 0x14, 0x00, 0x00, 0xac, 0x0d, 0x00, 0x9c, 0x1a, 0x00, 0x38,
+    0x0a, 0x0f, 0xec, 0x00, 0x21, 0x00, 0x34, 0x00, 0x00, 0x10, 0x15, 0x00, 0xa0, 0x06, 0x2a, 0x79,
+    0x83, 0xbc, 0x03, 0x00, 0x68, 0x00, 0x0f, 0x04, 0x00, 0x29, 0x00, 0xa4, 0x00, 0x00, 0x20, 0x01,
+    0x00, 0x60, 0x05, 0x00, 0xac, 0x05, 0x0f, 0x9c, 0x21, 0x01, 0x00, 0x30, 0x0c, 0x00, 0xfc, 0x07,
+    0x00, 0xf4, 0x06, 0x00, 0x9c, 0x14, 0x00, 0xdc, 0x09, 0x24, 0x27, 0x2b, 0x20, 0x04, 0x0f, 0x48,
+    0x01, 0x29, 0x00, 0x3c, 0x00, 0xd1, 0xb4, 0xff, 0x04, 0x05, 0xb5, 0xff, 0x2e, 0x33, 0xb8, 0xff,
+    0x4b, 0x51, 0xbd, 0x3c, 0x19, 0x0c, 0x98, 0x16, 0x0c, 0x6c, 0x06, 0xf3, 0x04, 0x9a, 0xa7, 0xd6,
+    0xff, 0x76, 0x7f, 0xc8, 0xff, 0x55, 0x5d, 0xbf, 0xff, 0x39, 0x3e, 0xb9, 0xff, 0x18, 0x1c, 0xb6,
+    0xf0, 0x03, 0x00, 0xd8, 0x01, 0x0f, 0x04, 0x00, 0x15, 0x02, 0x7c, 0x00, 0x02, 0xac, 0x0b, 0x0f,
+    0x0c, 0x00, 0x03, 0x31, 0x14, 0x16, 0xb6, 0x68, 0x0b, 0x00, 0x14, 0x14, 0x31, 0x68, 0x70, 0xc4,
+    0x68, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x04,
+    0x60, 0x01, 0x00, 0xdc, 0x1b, 0x01, 0x60, 0x01, 0x07, 0x48, 0x07, 0x00, 0xc8, 0x0f, 0x00, 0xe0,
+    0x07, 0x00, 0x48, 0x00, 0x00, 0x08, 0x10, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x00, 0x98, 0x01,
+    0x0c, 0x14, 0x04, 0x00, 0x0c, 0x02, 0x0c, 0x04, 0x00, 0x40, 0xc0, 0xcf, 0xe7, 0x88, 0xfc, 0x0a,
+    0x00, 0x64, 0x00, 0x00, 0x34, 0x00, 0x00, 0x74, 0x00, 0x00, 0x48, 0x00, 0x00, 0xa8, 0x00, 0x00,
+    0x04, 0x00, 0x18, 0x6d, 0x14, 0x04, 0x1f, 0x30, 0x14, 0x04, 0x1d, 0xf1, 0x04, 0xb4, 0xff, 0x12,
+    0x15, 0xb6, 0xff, 0x35, 0x3a, 0xb9, 0xff, 0x52, 0x58, 0xbe, 0xff, 0x71, 0x7a, 0xc7, 0xff, 0x96,
+    0x98, 0x16, 0x1f, 0xe3, 0xa0, 0x17, 0x0e, 0x00, 0x2c, 0x09, 0x00, 0xcc, 0x17, 0x00, 0x74, 0x16,
+    0x00, 0x08, 0x03, 0x00, 0x04, 0x00, 0x00, 0x24, 0x1c, 0x00, 0x40, 0x14, 0x00, 0xbc, 0x0a, 0x2f,
+    0x1b, 0x1f, 0xb8, 0x01, 0x21, 0x0f, 0xe0, 0x01, 0x15, 0x0c, 0x28, 0x00, 0xd1, 0xb4, 0xff, 0x00,
+    0x02, 0xb5, 0xff, 0x2f, 0x34, 0xb8, 0xff, 0x4f, 0x55, 0xbd, 0x80, 0x15, 0x00, 0x90, 0x00, 0x00,
+    0x9c, 0x04, 0x00, 0x24, 0x04, 0xbf, 0x86, 0x90, 0xce, 0xff, 0xa8, 0xb5, 0xdc, 0xff, 0xc6, 0xd6,
+    0xea, 0xd8, 0x00, 0x0e, 0x0c, 0x80, 0x01, 0x0f, 0x10, 0x00, 0x15, 0x00, 0x5c, 0x03, 0x00, 0xb0,
+    0x05, 0x00, 0xc4, 0x03, 0x00, 0x30, 0x05, 0x31, 0x21, 0x24, 0xb7, 0x04, 0x00, 0x26, 0x2b, 0x2e,
+    0x04, 0x00, 0xf0, 0x17, 0x2a, 0x2c, 0xb7, 0xff, 0x24, 0x25, 0xb7, 0xff, 0x1a, 0x18, 0xb6, 0xff,
+    0x0b, 0x11, 0xb6, 0xff, 0x01, 0x20, 0xb8, 0xff, 0x00, 0x34, 0xbc, 0xff, 0x00, 0x42, 0xbf, 0xff,
+    0x00, 0x48, 0xc1, 0xff, 0x00, 0x49, 0xc2, 0xff, 0x00, 0x49, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x21,
+    0x00, 0x3c, 0x00, 0xf1, 0x16, 0xc2, 0xff, 0x00, 0x47, 0xc1, 0xff, 0x00, 0x3f, 0xbf, 0xff, 0x00,
+    0x30, 0xbb, 0xff, 0x02, 0x1c, 0xb7, 0xff, 0x0f, 0x11, 0xb6, 0xff, 0x1c, 0x1b, 0xb6, 0xff, 0x26,
+    0x28, 0xb7, 0xff, 0x28, 0x2b, 0xb7, 0xff, 0x1e, 0x20, 0xb6, 0x48, 0x16, 0x20, 0x59, 0x60, 0xe0,
+    0x14, 0x02, 0xe8, 0x15, 0x17, 0xc8, 0x8c, 0x06, 0x00, 0x6c, 0x15, 0x00, 0x14, 0x0a, 0xb1, 0x89,
+    0x93, 0xcf, 0xff, 0x56, 0x5d, 0xbf, 0xff, 0x2a, 0x2e, 0xb8, 0x34, 0x00, 0x71, 0x29, 0x2c, 0xb7,
+    0xff, 0x25, 0x27, 0xb7, 0x4c, 0x00, 0xf2, 0x00, 0x0e, 0x11, 0xb6, 0xff, 0x02, 0x1d, 0xb7, 0xff,
+    0x00, 0x31, 0xbb, 0xff, 0x00, 0x40, 0xbf, 0x74, 0x00, 0x01, 0xbc, 0x00, 0x00, 0x84, 0x00, 0x0f,
+    0xbc, 0x00, 0x21, 0x00, 0x34, 0x00, 0x12, 0xc2, 0x04, 0x01, 0xf1, 0x0b, 0x41, 0xbf, 0xff, 0x00,
+    0x33, 0xbb, 0xff, 0x01, 0x1f, 0xb8, 0xff, 0x0c, 0x11, 0xb6, 0xff, 0x1a, 0x19, 0xb6, 0xff, 0x24,
+    0x26, 0xb7, 0xff, 0x2a, 0x2d, 0xb7, 0xfc, 0x07, 0x00, 0x00, 0x08, 0x05, 0x04, 0x00, 0x25, 0x2e,
+    0xb8, 0x5c, 0x01, 0x04, 0x64, 0x01, 0x0f, 0x08, 0x00, 0x05, 0x00, 0xfc, 0x00, 0x00, 0x70, 0x0a,
+    0x31, 0x30, 0x34, 0xb8, 0xcc, 0x06, 0x3f, 0x8f, 0x9b, 0xd1, 0x08, 0x21, 0x0a, 0x00, 0xf4, 0x1d,
+    0x00, 0x30, 0x0c, 0x00, 0xe0, 0x18, 0x00, 0x0c, 0x16, 0x00, 0x34, 0x01, 0x00, 0x3c, 0x01, 0x00,
+    0x48, 0x00, 0x09, 0x08, 0x01, 0x21, 0x1c, 0xb7, 0x6c, 0x01, 0x01, 0x74, 0x01, 0x00, 0x7c, 0x01,
+    0x09, 0x08, 0x01, 0x00, 0x10, 0x01, 0xf3, 0x0e, 0xc2, 0xff, 0x00, 0x45, 0xc0, 0xff, 0x00, 0x3a,
+    0xbd, 0xff, 0x00, 0x29, 0xb9, 0xff, 0x00, 0x1b, 0xb7, 0xff, 0x00, 0x26, 0xb9, 0xff, 0x00, 0x37,
+    0xbc, 0xff, 0x00, 0x44, 0xc0, 0xf0, 0x01, 0x00, 0x28, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x00,
+    0x07, 0x08, 0x01, 0x21, 0x34, 0xbc, 0x24, 0x02, 0x05, 0x08, 0x01, 0x1e, 0x25, 0x08, 0x01, 0x00,
+    0xd8, 0x16, 0x00, 0x50, 0x0c, 0x00, 0x78, 0x12, 0x00, 0xc4, 0x05, 0x00, 0xb4, 0x15, 0x0c, 0xb4,
+    0x02, 0x40, 0xce, 0xde, 0xee, 0x44, 0x0c, 0x12, 0x40, 0xce, 0xdd, 0xee, 0x66, 0x0c, 0x00, 0x0f,
+    0x04, 0x00, 0x05, 0x00, 0xfc, 0x0e, 0x30, 0xcf, 0xde, 0xef, 0xb0, 0x2f, 0x01, 0xcc, 0x27, 0x00,
+    0xf8, 0x1f, 0x35, 0x52, 0x59, 0xbe, 0x38, 0x02, 0x01, 0x84, 0x01, 0x07, 0xd0, 0x02, 0x00, 0x6c,
+    0x01, 0x22, 0x2c, 0x2f, 0x84, 0x01, 0xf3, 0x0b, 0x27, 0x29, 0xb7, 0xff, 0x1e, 0x1e, 0xb6, 0xff,
+    0x11, 0x12, 0xb5, 0xff, 0x03, 0x18, 0xb7, 0xff, 0x00, 0x2d, 0xba, 0xff, 0x00, 0x3d, 0xbe, 0xff,
+    0x00, 0x46, 0xd4, 0x00, 0x01, 0x18, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x04,
+    0x01, 0x03, 0xc0, 0x02, 0x00, 0x54, 0x02, 0x12, 0x32, 0x04, 0x02, 0x22, 0x0d, 0x13, 0xa0, 0x18,
+    0x00, 0x74, 0x01, 0x0c, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xac, 0x17, 0x00, 0x64, 0x0a, 0x31,
+    0x7f, 0x8a, 0xcb, 0x48, 0x1d, 0x00, 0xac, 0x17, 0x0c, 0x00, 0x01, 0x0f, 0x10, 0x00, 0x0d, 0x00,
+    0xbc, 0x03, 0x00, 0x74, 0x0a, 0x00, 0xcc, 0x04, 0x31, 0x46, 0x4c, 0xbc, 0xb8, 0x03, 0x0c, 0xbc,
+    0x03, 0x00, 0xec, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0xb0, 0x00, 0x01, 0x34, 0x02, 0x61, 0x2c,
+    0xb7, 0xff, 0x53, 0x5a, 0xbe, 0x50, 0x01, 0x00, 0x98, 0x0d, 0x0c, 0xdc, 0x1e, 0x00, 0x80, 0x00,
+    0x31, 0x99, 0xa6, 0xd5, 0xdc, 0x09, 0x00, 0x34, 0x00, 0x00, 0xb8, 0x06, 0x31, 0x04, 0x0b, 0xb5,
+    0x04, 0x03, 0x2f, 0x00, 0x32, 0x64, 0x03, 0x11, 0x03, 0x3c, 0x01, 0xd6, 0x46, 0xc0, 0xff, 0x00,
+    0x3c, 0xbe, 0xff, 0x00, 0x2b, 0xba, 0xff, 0x00, 0x13, 0x80, 0x05, 0x26, 0x03, 0x03, 0x30, 0x05,
+    0x00, 0x98, 0x16, 0x00, 0x14, 0x05, 0x00, 0xf0, 0x00, 0x04, 0x18, 0x01, 0x00, 0xf4, 0x0d, 0x04,
+    0x0c, 0x00, 0x00, 0x40, 0x02, 0x00, 0x48, 0x02, 0x00, 0xb0, 0x07, 0x22, 0x11, 0x11, 0x38, 0x00,
+    0xbf, 0x07, 0x15, 0xb6, 0xff, 0x00, 0x27, 0xb9, 0xff, 0x00, 0x39, 0xbd, 0xb4, 0x02, 0x00, 0x03,
+    0x7c, 0x00, 0x00, 0xc0, 0x04, 0x03, 0xbc, 0x03, 0x51, 0x00, 0x1e, 0xb8, 0xff, 0x00, 0x74, 0x00,
+    0x00, 0x7c, 0x07, 0x02, 0x44, 0x00, 0x0f, 0xa8, 0x0b, 0x01, 0x00, 0x74, 0x1a, 0x71, 0x15, 0x15,
+    0xb6, 0xff, 0x21, 0x22, 0xb6, 0x64, 0x02, 0x00, 0x60, 0x01, 0x1f, 0x2c, 0xd4, 0x03, 0x18, 0x00,
+    0x2c, 0x01, 0x00, 0xe0, 0x19, 0x00, 0xa8, 0x0f, 0x31, 0x51, 0x57, 0xbe, 0xa0, 0x21, 0x00, 0x60,
+    0x01, 0x00, 0x10, 0x1d, 0x00, 0xc0, 0x1a, 0x31, 0x8c, 0x97, 0xd0, 0x60, 0x0e, 0x00, 0x30, 0x04,
+    0x00, 0xfc, 0x03, 0x00, 0xc4, 0x04, 0x00, 0x64, 0x00, 0x04, 0x04, 0x00, 0x00, 0xcc, 0x03, 0x00,
+    0x18, 0x00, 0x31, 0x30, 0x35, 0xb8, 0xe8, 0x0b, 0x3f, 0x90, 0x9c, 0xd2, 0x14, 0x04, 0x02, 0x00,
+    0x64, 0x0f, 0x71, 0x83, 0x8e, 0xcd, 0xff, 0x50, 0x57, 0xbe, 0x14, 0x10, 0x00, 0x74, 0x00, 0x00,
+    0x7c, 0x00, 0x00, 0x48, 0x00, 0x22, 0x2c, 0x2e, 0x94, 0x03, 0x00, 0xa0, 0x02, 0x00, 0x68, 0x05,
+    0x01, 0x1c, 0x05, 0x04, 0x14, 0x04, 0x00, 0xc8, 0x02, 0x0f, 0x14, 0x04, 0x09, 0x12, 0x3b, 0x14,
+    0x04, 0x22, 0x06, 0x17, 0xac, 0x01, 0x71, 0x08, 0x05, 0xb5, 0xff, 0x43, 0x49, 0xbb, 0x00, 0x18,
+    0x00, 0xc8, 0x00, 0x04, 0x94, 0x01, 0x3d, 0xe0, 0xf2, 0xf8, 0xa8, 0x26, 0x00, 0x00, 0x26, 0x00,
+    0x74, 0x08, 0x00, 0x2c, 0x09, 0x00, 0xd4, 0x17, 0x71, 0x21, 0x23, 0xb7, 0xff, 0x22, 0x25, 0xb7,
+    0xe4, 0x00, 0xe7, 0x22, 0x23, 0xb6, 0xff, 0x17, 0x16, 0xb6, 0xff, 0x08, 0x12, 0xb6, 0xff, 0x00,
+    0x25, 0x6c, 0x04, 0x00, 0xa4, 0x01, 0x0f, 0x88, 0x03, 0x0e, 0x0f, 0xa0, 0x03, 0x05, 0x0c, 0x18,
+    0x00, 0x03, 0xf8, 0x01, 0x00, 0xe0, 0x00, 0xf6, 0x02, 0x3e, 0xbe, 0xff, 0x00, 0x2f, 0xba, 0xff,
+    0x02, 0x1a, 0xb7, 0xff, 0x10, 0x11, 0xb5, 0xff, 0x1d, 0x1c, 0x70, 0x06, 0x31, 0x1d, 0x20, 0xb6,
+    0x14, 0x1d, 0x31, 0x5c, 0x64, 0xc1, 0x04, 0x16, 0x00, 0x60, 0x02, 0x44, 0xca, 0xda, 0xec, 0xcc,
+    0xdc, 0x00, 0x0f, 0x08, 0x00, 0x31, 0x00, 0x28, 0x1c, 0x31, 0xb9, 0xc8, 0xe4, 0xe8, 0x14, 0x00,
+    0xbc, 0x02, 0x00, 0x84, 0x08, 0x00, 0x78, 0x03, 0x02, 0xf8, 0x0f, 0x0f, 0xe0, 0x0f, 0x09, 0xf0,
+    0x09, 0xb5, 0xff, 0x00, 0x36, 0xbc, 0xff, 0x01, 0x57, 0xc7, 0xff, 0x00, 0x6c, 0xd0, 0xff, 0x00,
+    0x76, 0xd5, 0xff, 0x00, 0x78, 0xd6, 0xff, 0x00, 0x77, 0x04, 0x00, 0x1f, 0xd5, 0x04, 0x00, 0x20,
+    0x12, 0xd6, 0x40, 0x00, 0xef, 0x74, 0xd4, 0xff, 0x00, 0x68, 0xce, 0xff, 0x01, 0x51, 0xc4, 0xff,
+    0x00, 0x2c, 0xba, 0x34, 0x16, 0x00, 0x00, 0x98, 0x10, 0x51, 0xb3, 0xff, 0x38, 0x3d, 0xb9, 0x3c,
+    0x23, 0x00, 0x60, 0x16, 0x00, 0x10, 0x0f, 0x00, 0xf4, 0x01, 0x00, 0x04, 0x00, 0x00, 0x48, 0x08,
+    0x00, 0x90, 0x1a, 0x00, 0xec, 0x09, 0x2f, 0x35, 0x39, 0x30, 0x17, 0x01, 0x00, 0xd4, 0x00, 0x11,
+    0xb4, 0x74, 0x01, 0xb2, 0x01, 0x52, 0xc5, 0xff, 0x00, 0x69, 0xcf, 0xff, 0x00, 0x75, 0xd4, 0x7c,
+    0x00, 0x0f, 0xbc, 0x00, 0x2d, 0xa1, 0x75, 0xd5, 0xff, 0x00, 0x6b, 0xcf, 0xff, 0x01, 0x55, 0xc6,
+    0x88, 0x07, 0x00, 0x8c, 0x04, 0x0e, 0x48, 0x01, 0x08, 0xe4, 0x12, 0x00, 0x8c, 0x00, 0x0f, 0x04,
+    0x00, 0x19, 0x02, 0xfc, 0x00, 0x31, 0x3e, 0x44, 0xba, 0x10, 0x0f, 0x00, 0x30, 0x11, 0x00, 0x24,
+    0x11, 0x00, 0xf8, 0x0f, 0x08, 0x0c, 0x02, 0x01, 0xfc, 0x2d, 0x21, 0xb9, 0xdd, 0x94, 0x03, 0x00,
+    0x28, 0x0b, 0x00, 0xe0, 0x1c, 0x0e, 0x38, 0x18, 0x00, 0x78, 0x00, 0x11, 0xb4, 0x6c, 0x06, 0x01,
+    0x6c, 0x01, 0x2e, 0x69, 0xce, 0x08, 0x01, 0x04, 0xd0, 0x01, 0x62, 0x71, 0xd3, 0xff, 0x00, 0x61,
+    0xcb, 0x90, 0x06, 0x00, 0xb8, 0x08, 0x00, 0xac, 0x04, 0x62, 0x5c, 0xc9, 0xff, 0x00, 0x6f, 0xd2,
+    0xe8, 0x01, 0x01, 0x28, 0x00, 0x00, 0xf0, 0x01, 0x03, 0xc4, 0x01, 0x00, 0x0c, 0x02, 0xa3, 0x6c,
+    0xd0, 0xff, 0x01, 0x56, 0xc6, 0xff, 0x00, 0x35, 0xbc, 0x84, 0x0c, 0x00, 0x70, 0x00, 0x08, 0x04,
+    0x00, 0x04, 0x08, 0x01, 0x02, 0x14, 0x00, 0x00, 0x5c, 0x05, 0x00, 0xa8, 0x0b, 0x00, 0xe4, 0x02,
+    0x04, 0xcc, 0x00, 0x00, 0xec, 0x05, 0x00, 0x78, 0x2a, 0x00, 0x50, 0x16, 0x31, 0xaa, 0xb7, 0xdd,
+    0xb4, 0x15, 0x00, 0xf0, 0x14, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x68, 0x04, 0x00, 0xd4, 0x29, 0x00,
+    0x2c, 0x00, 0x00, 0xa0, 0x05, 0x00, 0xf8, 0x16, 0x00, 0x18, 0x27, 0x00, 0xb4, 0x08, 0x0f, 0xfc,
+    0x00, 0x03, 0x02, 0x78, 0x00, 0x0f, 0xa0, 0x01, 0x02, 0xe2, 0x24, 0xb9, 0xff, 0x01, 0x4c, 0xc2,
+    0xff, 0x01, 0x65, 0xcd, 0xff, 0x00, 0x73, 0xd3, 0x1c, 0x02, 0x05, 0xe4, 0x00, 0x00, 0xe8, 0x00,
+    0x0f, 0x04, 0x00, 0x01, 0x03, 0xfc, 0x00, 0x00, 0x4c, 0x02, 0x04, 0x04, 0x02, 0x21, 0x36, 0xbc,
+    0x5c, 0x0b, 0x02, 0x80, 0x00, 0x0f, 0x70, 0x00, 0x01, 0x00, 0xd0, 0x01, 0x11, 0xb2, 0xc0, 0x05,
+    0x00, 0xc4, 0x25, 0x31, 0x89, 0x94, 0xcf, 0xfc, 0x0c, 0x7f, 0xbc, 0xca, 0xe5, 0xff, 0xcd, 0xdc,
+    0xee, 0x60, 0x1c, 0x0e, 0x00, 0xf8, 0x34, 0x00, 0x08, 0x23, 0x31, 0xa3, 0xb0, 0xd9, 0xfc, 0x25,
+    0x31, 0x5a, 0x61, 0xc0, 0x94, 0x05, 0x0e, 0xd4, 0x00, 0x0f, 0x7c, 0x00, 0x01, 0x0f, 0x14, 0x00,
+    0x15, 0x00, 0xa4, 0x00, 0x11, 0xb3, 0x48, 0x01, 0x31, 0x66, 0x6e, 0xc3, 0xb4, 0x26, 0x00, 0xf4,
+    0x0e, 0x00, 0xfc, 0x2c, 0x00, 0x80, 0x1e, 0x00, 0xac, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x94, 0x23,
+    0x00, 0x78, 0x0e, 0x06, 0xf4, 0x02, 0x11, 0xb5, 0xfc, 0x01, 0x01, 0x0c, 0x03, 0x1f, 0x6a, 0x64,
+    0x03, 0x0c, 0x01, 0x5c, 0x01, 0x92, 0xd6, 0xff, 0x00, 0x72, 0xd3, 0xff, 0x00, 0x62, 0xcb, 0x14,
+    0x0b, 0x61, 0x1f, 0xb8, 0xff, 0x01, 0x00, 0xb4, 0x04, 0x00, 0x02, 0x00, 0x07, 0x00, 0x10, 0x07,
+    0x11, 0xb2, 0x88, 0x1d, 0x00, 0xb4, 0x10, 0x00, 0x74, 0x2d, 0x00, 0x7c, 0x00, 0x00, 0x04, 0x00,
+    0x35, 0xe3, 0xf4, 0xfa, 0x3c, 0x0e, 0xa0, 0xb2, 0xbf, 0xe0, 0xff, 0x7e, 0x88, 0xcb, 0xff, 0x37,
+    0x3c, 0xfc, 0x03, 0x00, 0xe4, 0x00, 0x51, 0xb3, 0xff, 0x00, 0x1d, 0xb8, 0x7c, 0x07, 0x6f, 0x01,
+    0x5f, 0xca, 0xff, 0x00, 0x70, 0xb4, 0x02, 0x04, 0x03, 0xbc, 0x03, 0x15, 0x00, 0xbc, 0x03, 0x00,
+    0x7c, 0x07, 0x04, 0xa4, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x11, 0xb5,
+    0x94, 0x00, 0x00, 0x9c, 0x00, 0x02, 0xd8, 0x01, 0x00, 0x24, 0x00, 0x00, 0x68, 0x00, 0x0f, 0x04,
+    0x00, 0x25, 0x02, 0x60, 0x01, 0x00, 0xf0, 0x13, 0x00, 0xc4, 0x27, 0x00, 0xb8, 0x02, 0x00, 0x0c,
+    0x2c, 0x00, 0xb8, 0x22, 0x00, 0xac, 0x0e, 0x00, 0x18, 0x03, 0x02, 0x68, 0x00, 0x00, 0x28, 0x00,
+    0x0f, 0x64, 0x00, 0x01, 0x00, 0x18, 0x00, 0x51, 0xb3, 0xff, 0x3f, 0x45, 0xba, 0x68, 0x1b, 0x00,
+    0x14, 0x04, 0x00, 0x44, 0x02, 0x31, 0xae, 0xbc, 0xde, 0x88, 0x0a, 0x00, 0x78, 0x16, 0x00, 0x38,
+    0x10, 0x00, 0xbc, 0x01, 0x00, 0x64, 0x00, 0x0f, 0x4c, 0x00, 0x0b, 0x00, 0x60, 0x00, 0x0f, 0x14,
+    0x04, 0x17, 0x50, 0x01, 0x62, 0xcb, 0xff, 0x01, 0x18, 0x07, 0x10, 0x23, 0x3c, 0x0f, 0x02, 0x08,
+    0x01, 0x00, 0xec, 0x0b, 0x00, 0x3c, 0x1c, 0x00, 0xfc, 0x2a, 0x00, 0x9c, 0x01, 0x00, 0x04, 0x00,
+    0x08, 0x24, 0x09, 0x00, 0x10, 0x00, 0x00, 0xf4, 0x2c, 0x00, 0x2c, 0x18, 0x00, 0xa8, 0x14, 0x00,
+    0x44, 0x10, 0x20, 0x18, 0x19, 0xc4, 0x07, 0x00, 0x7c, 0x00, 0x0b, 0x04, 0x00, 0x81, 0x0a, 0xb6,
+    0xff, 0x00, 0x3e, 0xbe, 0xff, 0x01, 0x6c, 0x04, 0x1b, 0xd1, 0x6c, 0x04, 0x0f, 0x84, 0x03, 0x01,
+    0x0f, 0x14, 0x00, 0x19, 0x03, 0xb0, 0x03, 0x00, 0x70, 0x06, 0x62, 0x67, 0xce, 0xff, 0x01, 0x4f,
+    0xc3, 0x64, 0x0c, 0x01, 0x60, 0x1d, 0x08, 0x88, 0x00, 0x02, 0x60, 0x01, 0x01, 0x58, 0x1c, 0x21,
+    0x77, 0xc6, 0x14, 0x1d, 0x00, 0x68, 0x06, 0x00, 0x78, 0x0a, 0x00, 0xcc, 0x00, 0x0f, 0x04, 0x00,
+    0x31, 0x00, 0xc4, 0x12, 0x00, 0x80, 0x16, 0xd0, 0x77, 0x81, 0xc9, 0xff, 0x58, 0x60, 0xc0, 0xff,
+    0x39, 0x3e, 0xba, 0xff, 0x10, 0x80, 0x08, 0x01, 0x30, 0x1d, 0x00, 0x78, 0x02, 0x0f, 0x04, 0x00,
+    0x04, 0x00, 0x48, 0x0e, 0x40, 0x4d, 0xc3, 0xff, 0x01, 0x38, 0x03, 0xff, 0x02, 0x8b, 0xe1, 0xff,
+    0x00, 0x96, 0xe8, 0xff, 0x00, 0x99, 0xe9, 0xff, 0x00, 0x98, 0xe9, 0xff, 0x00, 0x97, 0x04, 0x00,
+    0x20, 0x00, 0x38, 0x00, 0x00, 0x40, 0x00, 0xf0, 0x02, 0x95, 0xe7, 0xff, 0x00, 0x86, 0xde, 0xff,
+    0x01, 0x6b, 0xcf, 0xff, 0x00, 0x43, 0xc0, 0xff, 0x00, 0x0f, 0xa0, 0x01, 0x00, 0xe0, 0x01, 0x0a,
+    0x88, 0x00, 0x00, 0x10, 0x26, 0x00, 0xe4, 0x13, 0x00, 0x90, 0x03, 0x00, 0xc8, 0x18, 0x00, 0xc0,
+    0x0f, 0x00, 0x04, 0x00, 0x00, 0xa4, 0x27, 0x00, 0x88, 0x29, 0x00, 0xd8, 0x17, 0x20, 0x21, 0x25,
+    0x10, 0x13, 0x0a, 0x38, 0x00, 0x01, 0x84, 0x02, 0x00, 0xe0, 0x00, 0x40, 0x45, 0xc0, 0xff, 0x01,
+    0x3c, 0x08, 0x22, 0x88, 0xdf, 0x74, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x84, 0x00, 0x0f, 0xbc, 0x00,
+    0x29, 0x00, 0x04, 0x01, 0x40, 0x8a, 0xe0, 0xff, 0x01, 0xe8, 0x03, 0x5f, 0x4a, 0xc2, 0xff, 0x00,
+    0x1a, 0x80, 0x00, 0x01, 0x0c, 0x90, 0x00, 0x0f, 0x10, 0x00, 0x1f, 0x00, 0xe8, 0x13, 0x00, 0xe4,
+    0x16, 0x00, 0x40, 0x20, 0x00, 0x38, 0x2e, 0x00, 0x94, 0x06, 0x04, 0x98, 0x16, 0x40, 0xc4, 0xd4,
+    0xe9, 0xee, 0x84, 0x03, 0x31, 0x82, 0x8d, 0xcc, 0x50, 0x11, 0x00, 0x18, 0x14, 0x2f, 0x22, 0x26,
+    0x88, 0x00, 0x01, 0x52, 0xb3, 0xff, 0x00, 0x10, 0xb6, 0x9c, 0x04, 0x6a, 0x6b, 0xd0, 0xff, 0x00,
+    0x87, 0xde, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x04, 0x14, 0x01, 0xa2, 0x91, 0xe4, 0xff, 0x00, 0x7c,
+    0xd8, 0xff, 0x00, 0x5b, 0xc8, 0x80, 0x07, 0x00, 0xa8, 0x04, 0x00, 0x64, 0x09, 0x57, 0x8e, 0xe3,
+    0xff, 0x00, 0x97, 0xf8, 0x01, 0x04, 0x34, 0x00, 0x04, 0x08, 0x01, 0x80, 0x71, 0xd2, 0xff, 0x00,
+    0x4c, 0xc2, 0xff, 0x00, 0x58, 0x0b, 0x0f, 0x50, 0x02, 0x06, 0x00, 0xdc, 0x01, 0x02, 0x34, 0x1e,
+    0x00, 0x38, 0x16, 0x00, 0x9c, 0x2c, 0x40, 0xcd, 0xdc, 0xee, 0x88, 0x6c, 0x0a, 0x00, 0x0c, 0x0c,
+    0x00, 0x4c, 0x1f, 0x00, 0xd8, 0x01, 0x00, 0x84, 0x2a, 0x00, 0xa8, 0x19, 0x00, 0xa8, 0x02, 0x0f,
+    0x04, 0x00, 0x05, 0x00, 0x08, 0x0e, 0x00, 0x04, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x14, 0x15, 0x00,
+    0x14, 0x0e, 0x20, 0x1d, 0x21, 0x40, 0x02, 0x0f, 0x64, 0x01, 0x15, 0x52, 0xb3, 0xff, 0x00, 0x01,
+    0xb5, 0xe0, 0x0b, 0x00, 0x80, 0x07, 0x6f, 0x83, 0xdc, 0xff, 0x00, 0x93, 0xe6, 0xd8, 0x02, 0x13,
+    0x04, 0xfc, 0x00, 0x00, 0x4c, 0x02, 0x62, 0x88, 0xdf, 0xff, 0x01, 0x6e, 0xd1, 0x4c, 0x06, 0x10,
+    0x14, 0x7c, 0x01, 0x00, 0xe4, 0x00, 0x0f, 0x84, 0x00, 0x07, 0x71, 0x18, 0x1b, 0xb6, 0xff, 0x3d,
+    0x43, 0xba, 0x6c, 0x0b, 0x31, 0x7b, 0x85, 0xca, 0x14, 0x1b, 0x00, 0x7c, 0x1d, 0x0f, 0xe0, 0x03,
+    0x0d, 0x00, 0x3c, 0x0b, 0x01, 0xbc, 0x03, 0x21, 0x80, 0xc8, 0xf8, 0x26, 0x00, 0xbc, 0x03, 0x00,
+    0x38, 0x12, 0x02, 0x08, 0x07, 0x0f, 0x70, 0x00, 0x07, 0x0f, 0x20, 0x00, 0x21, 0x71, 0x1e, 0x21,
+    0xb6, 0xff, 0x41, 0x47, 0xbb, 0xd0, 0x28, 0x00, 0x2c, 0x09, 0x00, 0xe8, 0x08, 0x31, 0xc3, 0xd2,
+    0xe8, 0x20, 0x1e, 0x00, 0x84, 0x07, 0x00, 0x54, 0x14, 0x00, 0x40, 0x04, 0x02, 0x5c, 0x00, 0x03,
+    0x40, 0x05, 0x5f, 0x46, 0xc1, 0xff, 0x01, 0x6d, 0x64, 0x03, 0x10, 0x04, 0x68, 0x02, 0xa1, 0x92,
+    0xe5, 0xff, 0x00, 0x80, 0xda, 0xff, 0x00, 0x60, 0xca, 0xc0, 0x07, 0x06, 0x7c, 0x07, 0x00, 0xfc,
+    0x06, 0x00, 0xd0, 0x00, 0x11, 0xb3, 0x98, 0x0c, 0x00, 0x5c, 0x09, 0x00, 0x5c, 0x15, 0x04, 0x20,
+    0x01, 0x08, 0xe4, 0x05, 0x00, 0x5c, 0x36, 0x00, 0x84, 0x07, 0x20, 0x3b, 0x40, 0xc0, 0x0b, 0x00,
+    0x4c, 0x05, 0xf2, 0x02, 0xb3, 0xff, 0x00, 0x2a, 0xba, 0xff, 0x00, 0x58, 0xc7, 0xff, 0x00, 0x7a,
+    0xd7, 0xff, 0x00, 0x8f, 0xe3, 0xa4, 0x04, 0x04, 0x74, 0x00, 0x04, 0xb8, 0x01, 0x62, 0x96, 0xe7,
+    0xff, 0x00, 0x89, 0xe0, 0xa4, 0x07, 0x00, 0x6c, 0x0d, 0x00, 0xf0, 0x11, 0x04, 0xb4, 0x02, 0x22,
+    0x02, 0xb5, 0x18, 0x02, 0x00, 0x1c, 0x02, 0x00, 0xc4, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x0c, 0x00, 0x05, 0x04, 0x00, 0x00, 0xa0, 0x00, 0x0f, 0x04, 0x00, 0x27, 0x31, 0x1c, 0x1f,
+    0xb6, 0xb0, 0x19, 0x00, 0xb8, 0x02, 0x00, 0x30, 0x16, 0x00, 0xd8, 0x04, 0x00, 0x38, 0x1b, 0x0f,
+    0xbc, 0x03, 0x03, 0x0e, 0x68, 0x00, 0x31, 0x29, 0x2d, 0xb7, 0xcc, 0x20, 0x31, 0x67, 0x6f, 0xc4,
+    0x40, 0x23, 0x00, 0x34, 0x03, 0x00, 0x30, 0x26, 0x00, 0x0c, 0x03, 0x00, 0x58, 0x2c, 0x6f, 0x45,
+    0x4b, 0xbc, 0xff, 0x1b, 0x1e, 0x0c, 0x03, 0x0d, 0x0f, 0x14, 0x04, 0x1c, 0x62, 0x7d, 0xd9, 0xff,
+    0x00, 0x5d, 0xc9, 0x48, 0x13, 0x03, 0xbc, 0x06, 0x31, 0x31, 0x35, 0xb8, 0x08, 0x18, 0x00, 0x30,
+    0x0b, 0x04, 0xa0, 0x01, 0x35, 0xe1, 0xf3, 0xf9, 0x44, 0x20, 0x00, 0xb4, 0x20, 0x00, 0x2c, 0x02,
+    0x31, 0x75, 0x7f, 0xc8, 0xa8, 0x14, 0x00, 0x2c, 0x09, 0x24, 0x0b, 0x0d, 0xe0, 0x01, 0x0b, 0xd8,
+    0x00, 0x22, 0x28, 0xb9, 0x14, 0x09, 0x00, 0xa4, 0x09, 0x0c, 0x6c, 0x04, 0x0f, 0xa8, 0x05, 0x21,
+    0x08, 0x34, 0x00, 0x04, 0xf8, 0x01, 0xa2, 0x94, 0xe6, 0xff, 0x00, 0x85, 0xdd, 0xff, 0x01, 0x68,
+    0xce, 0x14, 0x15, 0x10, 0x09, 0x24, 0x01, 0x0e, 0xb0, 0x03, 0x13, 0x26, 0x50, 0x1b, 0x00, 0xcc,
+    0x08, 0x00, 0x10, 0x12, 0x00, 0x98, 0x16, 0x00, 0x08, 0x40, 0x04, 0xe4, 0x00, 0x0f, 0x08, 0x00,
+    0x29, 0x00, 0xb8, 0x24, 0x00, 0xb4, 0x02, 0x00, 0x80, 0x16, 0x00, 0x90, 0x08, 0x50, 0x07, 0x07,
+    0xb5, 0xff, 0x08, 0x5c, 0x10, 0x00, 0x04, 0x10, 0x00, 0x68, 0x16, 0x00, 0xa8, 0x0f, 0x00, 0x78,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0xa4, 0x13, 0x00, 0xa8, 0x02, 0x21, 0x66, 0xcd,
+    0x30, 0x07, 0xe0, 0x00, 0x9d, 0xec, 0xff, 0x00, 0xa8, 0xf3, 0xff, 0x00, 0xaa, 0xf5, 0xff, 0x00,
+    0xa9, 0x04, 0x00, 0x1f, 0xf4, 0x04, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x00, 0x22, 0xa6,
+    0xf2, 0xf4, 0x04, 0x40, 0x7f, 0xda, 0xff, 0x00, 0xb8, 0x0a, 0x00, 0x08, 0x15, 0x00, 0x70, 0x00,
+    0x22, 0x3f, 0xbe, 0x1c, 0x05, 0x12, 0x2f, 0x2c, 0x12, 0xf1, 0x00, 0x0f, 0x15, 0xb6, 0xff, 0x20,
+    0x22, 0xb6, 0xff, 0x2d, 0x30, 0xb8, 0xff, 0x34, 0x39, 0xb9, 0xf8, 0x0a, 0x00, 0xd0, 0x01, 0x31,
+    0x34, 0x38, 0xb9, 0xac, 0x16, 0x00, 0x70, 0x11, 0x10, 0x0e, 0x84, 0x12, 0x22, 0x1f, 0xb8, 0x24,
+    0x02, 0x00, 0xe4, 0x12, 0x00, 0x44, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x60, 0x14, 0x00, 0xd8, 0x0d,
+    0x93, 0x81, 0xdb, 0xff, 0x00, 0x9a, 0xea, 0xff, 0x00, 0xa7, 0xbc, 0x00, 0x00, 0x80, 0x00, 0x0f,
+    0xb8, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0xa2,
+    0x9c, 0xeb, 0xff, 0x00, 0x84, 0xdd, 0xff, 0x00, 0x64, 0xcc, 0x9c, 0x16, 0x00, 0x70, 0x00, 0x04,
+    0x78, 0x00, 0x00, 0x44, 0x0e, 0x93, 0x21, 0xb8, 0xff, 0x00, 0x17, 0xb7, 0xff, 0x00, 0x24, 0xc8,
+    0x17, 0x00, 0x50, 0x01, 0x00, 0x5c, 0x01, 0x00, 0xd0, 0x17, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x14, 0x12, 0x00, 0x0c, 0x16, 0x92, 0x2d, 0xba, 0xff, 0x01, 0x1d, 0xb7,
+    0xff, 0x0c, 0x12, 0xc8, 0x27, 0x31, 0x2e, 0x31, 0xb8, 0x68, 0x1c, 0x00, 0x88, 0x05, 0x00, 0x08,
+    0x05, 0x00, 0x08, 0x02, 0x00, 0x50, 0x1d, 0x31, 0x92, 0x9e, 0xd2, 0x14, 0x0d, 0x00, 0xac, 0x12,
+    0x63, 0x05, 0x03, 0xb5, 0xff, 0x0c, 0x14, 0x08, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x60, 0x06, 0x04,
+    0x90, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x64, 0x01, 0x00, 0xf8, 0x04, 0x1f, 0x99, 0x08, 0x01, 0x00,
+    0x00, 0xd4, 0x00, 0x00, 0x04, 0x00, 0x22, 0xa2, 0xef, 0x68, 0x09, 0x00, 0xf0, 0x01, 0x00, 0xf8,
+    0x01, 0x00, 0x34, 0x00, 0x62, 0x85, 0xdd, 0xff, 0x00, 0x9f, 0xed, 0xe8, 0x01, 0x13, 0xab, 0xf4,
+    0x01, 0x00, 0x2c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x01, 0x00, 0x14, 0x02, 0x00, 0x24, 0x00,
+    0x00, 0xcc, 0x06, 0x00, 0xa0, 0x18, 0x00, 0x08, 0x01, 0x00, 0xec, 0x00, 0x00, 0x08, 0x00, 0x90,
+    0x33, 0xbb, 0xff, 0x00, 0x22, 0xb8, 0xff, 0x00, 0x0d, 0xf0, 0x02, 0x02, 0x78, 0x03, 0x00, 0x34,
+    0x05, 0x00, 0x88, 0x20, 0x00, 0x14, 0x29, 0x00, 0xcc, 0x00, 0x00, 0x60, 0x06, 0x00, 0xe0, 0x1c,
+    0x00, 0x68, 0x08, 0x00, 0x1c, 0x00, 0x00, 0x90, 0x13, 0x6f, 0x33, 0x37, 0xb9, 0xff, 0x36, 0x3a,
+    0x04, 0x00, 0x08, 0x21, 0x3b, 0xb9, 0x44, 0x2b, 0x00, 0xd4, 0x1d, 0x00, 0x68, 0x13, 0x00, 0xd0,
+    0x11, 0x10, 0x0c, 0x04, 0x02, 0x00, 0x34, 0x19, 0x00, 0x7c, 0x01, 0x00, 0x7c, 0x00, 0x00, 0x60,
+    0x01, 0x00, 0x54, 0x01, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x00, 0x64, 0x01, 0x00, 0x24, 0x02,
+    0x00, 0x1c, 0x00, 0x22, 0x5a, 0xc8, 0xb0, 0x05, 0x00, 0x50, 0x07, 0x22, 0xa5, 0xf1, 0xd8, 0x02,
+    0x00, 0xd8, 0x00, 0x00, 0xec, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x08, 0x01,
+    0x00, 0x4c, 0x02, 0x00, 0xe0, 0x03, 0x00, 0xf0, 0x05, 0x22, 0x50, 0xc4, 0xb8, 0x17, 0x00, 0xec,
+    0x00, 0x00, 0x14, 0x0f, 0x00, 0x64, 0x19, 0x00, 0x60, 0x00, 0x00, 0x78, 0x00, 0x00, 0x8c, 0x00,
+    0x00, 0x08, 0x01, 0xa1, 0x23, 0xb8, 0xff, 0x0a, 0x16, 0xb6, 0xff, 0x05, 0x05, 0xb5, 0x34, 0x19,
+    0x00, 0x14, 0x26, 0x00, 0x90, 0x12, 0x3f, 0xb3, 0xc0, 0xe1, 0x78, 0x1a, 0x0a, 0x40, 0xce, 0xdd,
+    0xee, 0x88, 0xf8, 0x0f, 0x00, 0x4c, 0x1e, 0x00, 0xbc, 0x03, 0x00, 0xf8, 0x2b, 0x0f, 0xbc, 0x03,
+    0x0e, 0x00, 0x78, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x10, 0x01, 0x00, 0x38, 0x01, 0x21, 0x20,
+    0xb8, 0x48, 0x01, 0x00, 0x4c, 0x02, 0x71, 0x23, 0x26, 0xb7, 0xff, 0x54, 0x5b, 0xbf, 0x10, 0x0f,
+    0x00, 0x84, 0x0f, 0x00, 0x48, 0x26, 0x00, 0x78, 0x11, 0x00, 0x84, 0x02, 0x60, 0x5b, 0x62, 0xc0,
+    0xff, 0x0e, 0x06, 0x50, 0x05, 0x92, 0xb2, 0xff, 0x00, 0x13, 0xb7, 0xff, 0x00, 0x4f, 0xc4, 0x48,
+    0x01, 0x00, 0x10, 0x01, 0x00, 0x18, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28, 0x01, 0x0c, 0x44, 0x01,
+    0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x62, 0xa4, 0xf1, 0xff, 0x00, 0x93, 0xe5, 0x54, 0x13, 0x21,
+    0x54, 0xc5, 0x68, 0x13, 0x01, 0x30, 0x03, 0x00, 0xc0, 0x02, 0x01, 0x10, 0x07, 0x11, 0xb3, 0xbc,
+    0x17, 0x00, 0x34, 0x1c, 0x00, 0x48, 0x0d, 0x00, 0xf0, 0x02, 0x0c, 0x04, 0x00, 0x00, 0x14, 0x13,
+    0x31, 0x77, 0x81, 0xc8, 0x34, 0x02, 0x01, 0x70, 0x0b, 0x00, 0x1c, 0x06, 0x22, 0x30, 0xbb, 0x60,
+    0x0f, 0x00, 0x0c, 0x08, 0x2f, 0xa0, 0xee, 0xb4, 0x02, 0x03, 0x00, 0xa0, 0x00, 0x0f, 0xbc, 0x03,
+    0x05, 0x04, 0x08, 0x01, 0x00, 0x8c, 0x00, 0x0f, 0xbc, 0x03, 0x01, 0x0f, 0x54, 0x01, 0x19, 0x08,
+    0x2c, 0x00, 0x00, 0x04, 0x02, 0x00, 0x60, 0x01, 0x12, 0x21, 0x60, 0x01, 0x00, 0xb0, 0x02, 0x00,
+    0xb8, 0x02, 0x00, 0xc8, 0x06, 0x00, 0xd8, 0x04, 0x00, 0xe0, 0x04, 0x23, 0x0e, 0x16, 0xbc, 0x03,
+    0x00, 0xc4, 0x00, 0x00, 0x88, 0x00, 0x00, 0x40, 0x00, 0x00, 0x44, 0x02, 0x00, 0xb0, 0x02, 0x07,
+    0x14, 0x04, 0x71, 0x11, 0x17, 0xb6, 0xff, 0x22, 0x24, 0xb7, 0xe8, 0x30, 0x04, 0x10, 0x05, 0x00,
+    0x44, 0x0f, 0x02, 0x0c, 0x03, 0x11, 0xb8, 0xbc, 0x08, 0x10, 0x0c, 0x4c, 0x00, 0x00, 0xc4, 0x00,
+    0x00, 0x20, 0x18, 0x00, 0x7c, 0x00, 0x00, 0x4c, 0x00, 0x04, 0x04, 0x00, 0x00, 0x9c, 0x02, 0x00,
+    0x60, 0x00, 0x0f, 0x14, 0x04, 0x19, 0x21, 0x8c, 0xe1, 0xb4, 0x14, 0x20, 0x00, 0x38, 0xec, 0x12,
+    0x00, 0xb8, 0x06, 0x11, 0xb2, 0xa0, 0x03, 0x00, 0x08, 0x0b, 0x00, 0x98, 0x12, 0x0c, 0x9c, 0x01,
+    0x00, 0x80, 0x16, 0x00, 0x9c, 0x2a, 0x00, 0x34, 0x0d, 0x00, 0x18, 0x2b, 0x00, 0x30, 0x2f, 0x50,
+    0x0b, 0x0b, 0xb5, 0xff, 0x07, 0x98, 0x00, 0x00, 0x70, 0x06, 0x00, 0x34, 0x13, 0x00, 0x24, 0x04,
+    0x04, 0x04, 0x00, 0x40, 0x4e, 0xc3, 0xff, 0x00, 0xc4, 0x09, 0x00, 0x68, 0x00, 0x04, 0xb8, 0x01,
+    0x00, 0x28, 0x02, 0x0c, 0x40, 0x02, 0x0f, 0x10, 0x00, 0x21, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x70, 0x06, 0x00, 0x48, 0x0c, 0x04, 0x50, 0x08, 0x00, 0x60, 0x1b, 0x00, 0x1c, 0x01, 0x00,
+    0x24, 0x05, 0x00, 0x2c, 0x05, 0x12, 0x2e, 0x74, 0x05, 0x00, 0x54, 0x1a, 0x31, 0x0c, 0x0a, 0xb5,
+    0xbc, 0x1a, 0x00, 0x5c, 0x05, 0x31, 0x8b, 0x96, 0xd0, 0xa4, 0x03, 0x00, 0x38, 0x2d, 0x0c, 0xe8,
+    0x00, 0x0f, 0x10, 0x00, 0x1d, 0x00, 0xf4, 0x04, 0x31, 0x72, 0x7c, 0xc7, 0x38, 0x1d, 0x02, 0xc4,
+    0x12, 0x11, 0xb3, 0x20, 0x05, 0x10, 0x01, 0x28, 0x0e, 0x00, 0xe4, 0x08, 0x00, 0x2c, 0x0e, 0x00,
+    0xd0, 0x0c, 0x00, 0xf0, 0x0e, 0x00, 0x08, 0x00, 0x00, 0xe4, 0x0d, 0x22, 0x6f, 0xd1, 0xc4, 0x0f,
+    0x00, 0x28, 0x0c, 0x00, 0xf4, 0x0c, 0x00, 0xc8, 0x00, 0xdf, 0xae, 0xf7, 0xff, 0x00, 0xaf, 0xf9,
+    0xff, 0x00, 0xaf, 0xf8, 0xff, 0x00, 0xae, 0x04, 0x00, 0x20, 0x00, 0x38, 0x00, 0x00, 0x40, 0x00,
+    0x62, 0xac, 0xf7, 0xff, 0x00, 0xa3, 0xf0, 0x14, 0x0b, 0x00, 0x88, 0x07, 0x00, 0x0c, 0x14, 0x01,
+    0x74, 0x00, 0x12, 0xd2, 0x34, 0x10, 0x00, 0x9c, 0x03, 0x00, 0xac, 0x01, 0x01, 0x80, 0x0a, 0x00,
+    0xf8, 0x01, 0x00, 0x04, 0x00, 0x02, 0xc8, 0x05, 0x02, 0x84, 0x0b, 0x00, 0x0c, 0x00, 0x00, 0x14,
+    0x00, 0x51, 0xb3, 0xff, 0x00, 0x04, 0xb5, 0xb8, 0x1c, 0x01, 0x10, 0x13, 0x00, 0xe8, 0x08, 0x00,
+    0x48, 0x00, 0x00, 0x04, 0x00, 0x00, 0x54, 0x00, 0x00, 0x5c, 0x00, 0x00, 0xe4, 0x0c, 0x00, 0x6c,
+    0x00, 0x1f, 0xad, 0xbc, 0x00, 0x34, 0x00, 0x48, 0x00, 0x00, 0xb4, 0x05, 0x00, 0xbc, 0x05, 0x22,
+    0x82, 0xdb, 0x24, 0x01, 0x00, 0x70, 0x00, 0x00, 0x04, 0x00, 0x00, 0x90, 0x13, 0x00, 0x9c, 0x15,
+    0x00, 0x38, 0x03, 0x00, 0x58, 0x1d, 0x00, 0xfc, 0x02, 0x00, 0x64, 0x11, 0x22, 0x6d, 0xd1, 0xf0,
+    0x14, 0x00, 0x94, 0x00, 0x00, 0x60, 0x01, 0x0c, 0x04, 0x00, 0x00, 0x78, 0x01, 0x00, 0x40, 0x00,
+    0x53, 0x66, 0xcd, 0xff, 0x01, 0x53, 0x98, 0x04, 0x10, 0x04, 0xbc, 0x06, 0x00, 0xe4, 0x0b, 0x11,
+    0xb4, 0xe4, 0x19, 0x00, 0x34, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0xfc, 0x01, 0x00, 0x60, 0x2b, 0x00,
+    0x48, 0x1a, 0x00, 0x04, 0x0e, 0x02, 0x84, 0x04, 0x51, 0xb2, 0xff, 0x00, 0x11, 0xb6, 0xd0, 0x1d,
+    0x01, 0x1c, 0x16, 0x0f, 0x08, 0x01, 0x01, 0x00, 0x6c, 0x01, 0x0f, 0x08, 0x01, 0x01, 0x13, 0xb0,
+    0xd0, 0x01, 0x00, 0xa0, 0x04, 0x00, 0x40, 0x0c, 0x00, 0xc4, 0x00, 0x00, 0xd8, 0x0e, 0x00, 0x30,
+    0x14, 0x00, 0x34, 0x0c, 0x00, 0x34, 0x05, 0x00, 0xec, 0x01, 0x04, 0x28, 0x00, 0x04, 0xc4, 0x01,
+    0x01, 0x08, 0x01, 0x12, 0xf2, 0x5c, 0x0c, 0x2e, 0x82, 0xdc, 0x08, 0x01, 0x00, 0xe4, 0x06, 0x00,
+    0x44, 0x04, 0x00, 0x4c, 0x11, 0x01, 0x5c, 0x05, 0x11, 0xb4, 0xd4, 0x1a, 0x00, 0x70, 0x07, 0x00,
+    0xf8, 0x0e, 0x00, 0x90, 0x28, 0x31, 0x9b, 0xa7, 0xd6, 0x14, 0x0e, 0x02, 0xc8, 0x00, 0x00, 0xd4,
+    0x01, 0x00, 0xf0, 0x00, 0x0f, 0x04, 0x00, 0x20, 0x00, 0xd8, 0x0a, 0x80, 0x3b, 0xbd, 0xff, 0x01,
+    0x59, 0xc7, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0x50, 0x01, 0x01, 0x6c, 0x01, 0x1a, 0xd3, 0x6c, 0x01,
+    0x00, 0x64, 0x01, 0x00, 0xd8, 0x02, 0x00, 0x14, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0xf0, 0x00, 0x00,
+    0xf8, 0x03, 0x22, 0xab, 0xf6, 0xd4, 0x02, 0x00, 0xdc, 0x00, 0x00, 0xec, 0x00, 0x0f, 0x04, 0x00,
+    0x05, 0x00, 0x20, 0x00, 0x00, 0x08, 0x01, 0x22, 0xac, 0xf6, 0x94, 0x0a, 0x40, 0x7e, 0xd9, 0xff,
+    0x00, 0xac, 0x02, 0x22, 0x38, 0xbd, 0x28, 0x21, 0x00, 0x34, 0x01, 0x00, 0x60, 0x00, 0x00, 0x7c,
+    0x00, 0x00, 0x84, 0x00, 0x00, 0xb0, 0x16, 0x04, 0x58, 0x10, 0x00, 0x2c, 0x15, 0x00, 0x2c, 0x06,
+    0x21, 0x00, 0xb2, 0xdc, 0x22, 0x31, 0x7c, 0x86, 0xca, 0xc8, 0x35, 0x00, 0xd0, 0x01, 0x0f, 0x04,
+    0x00, 0x05, 0x40, 0xce, 0xde, 0xee, 0x66, 0x98, 0x27, 0x00, 0xf8, 0x11, 0x00, 0x04, 0x0d, 0x05,
+    0xbc, 0x03, 0x13, 0x23, 0xbc, 0x03, 0x22, 0x5e, 0xc9, 0x24, 0x1a, 0x00, 0xd0, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x04, 0x30, 0x00, 0x40, 0x69, 0xcf, 0xff, 0x01,
+    0x40, 0x0e, 0x00, 0x94, 0x04, 0x00, 0x7c, 0x06, 0x01, 0xa4, 0x00, 0x91, 0xb3, 0xff, 0x3e, 0x43,
+    0xba, 0xff, 0x85, 0x8f, 0xcd, 0x00, 0x2b, 0x00, 0xb4, 0x34, 0x05, 0x84, 0x07, 0x53, 0x63, 0xc0,
+    0xff, 0x0e, 0x05, 0x84, 0x07, 0x40, 0x15, 0xb7, 0xff, 0x00, 0xec, 0x19, 0x00, 0x08, 0x01, 0x00,
+    0x90, 0x09, 0x00, 0x18, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28, 0x01, 0x0c, 0x44, 0x01, 0x00, 0xf8,
+    0x03, 0x00, 0x18, 0x00, 0x00, 0xa4, 0x07, 0x00, 0xd8, 0x09, 0x22, 0x8d, 0xe2, 0x78, 0x14, 0x00,
+    0x28, 0x0b, 0x00, 0xb0, 0x1b, 0x10, 0x2a, 0x58, 0x16, 0x00, 0x58, 0x00, 0x02, 0x84, 0x07, 0x00,
+    0x38, 0x40, 0x00, 0x4c, 0x1c, 0x08, 0x1c, 0x01, 0x00, 0x1c, 0x34, 0x00, 0x10, 0x01, 0x00, 0xfc,
+    0x02, 0x00, 0xf4, 0x3f, 0x00, 0x3c, 0x17, 0x02, 0x14, 0x01, 0x11, 0xb2, 0x70, 0x19, 0x01, 0x14,
+    0x0b, 0x00, 0xcc, 0x05, 0x00, 0xa0, 0x03, 0x00, 0x80, 0x00, 0x04, 0x8c, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x80, 0x00, 0x01, 0xb4, 0x02, 0x12, 0xf1, 0x0c, 0x12, 0x00, 0x9c, 0x0b, 0x00, 0xe0, 0x04,
+    0x00, 0x14, 0x02, 0x00, 0x04, 0x00, 0x00, 0xf8, 0x02, 0x04, 0x08, 0x01, 0x22, 0x2e, 0xba, 0x00,
+    0x23, 0x00, 0xbc, 0x03, 0x0c, 0x1c, 0x05, 0x0f, 0x60, 0x01, 0x1d, 0x13, 0x6a, 0x60, 0x01, 0x00,
+    0xec, 0x05, 0x00, 0x38, 0x10, 0x05, 0x60, 0x32, 0x04, 0xe8, 0x02, 0x03, 0xb4, 0x13, 0x22, 0x3a,
+    0xbd, 0xd8, 0x19, 0x00, 0xbc, 0x03, 0x00, 0x64, 0x00, 0x00, 0x44, 0x02, 0x00, 0x98, 0x00, 0x04,
+    0x14, 0x04, 0x00, 0x10, 0x05, 0x10, 0x0c, 0x14, 0x04, 0x00, 0x28, 0x03, 0x04, 0x04, 0x00, 0x00,
+    0x04, 0x05, 0x04, 0x0c, 0x00, 0x03, 0x08, 0x00, 0x00, 0x98, 0x13, 0x62, 0x3f, 0xbe, 0xff, 0x01,
+    0x59, 0xc8, 0xd4, 0x00, 0x00, 0x4c, 0x00, 0x04, 0xec, 0x01, 0x00, 0x50, 0x00, 0x00, 0xa0, 0x02,
+    0x00, 0x10, 0x00, 0x00, 0x1c, 0x05, 0x0f, 0x14, 0x04, 0x11, 0x00, 0x20, 0x13, 0x00, 0x54, 0x03,
+    0x00, 0xd4, 0x04, 0x01, 0x1c, 0x02, 0x11, 0xb2, 0x04, 0x0b, 0x00, 0x84, 0x0f, 0x00, 0x0c, 0x17,
+    0x08, 0xa0, 0x01, 0x31, 0xbb, 0xc9, 0xe5, 0xf0, 0x1c, 0x00, 0x80, 0x16, 0x00, 0xc4, 0x09, 0x20,
+    0x13, 0x12, 0xd0, 0x01, 0x00, 0xe8, 0x00, 0x00, 0x2c, 0x18, 0x47, 0xb7, 0xff, 0x01, 0x44, 0xb4,
+    0x02, 0x00, 0x8c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd4, 0x1a, 0x00, 0xa0, 0x13, 0x00, 0x28, 0x0d,
+    0x22, 0xa8, 0xf4, 0x58, 0x06, 0x00, 0xac, 0x01, 0x00, 0xb4, 0x01, 0x00, 0xc4, 0x01, 0x0f, 0x04,
+    0x00, 0x29, 0x00, 0x44, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x98, 0x02, 0x00, 0x64, 0x0c, 0x22, 0x90,
+    0xe4, 0x88, 0x07, 0x00, 0x00, 0x01, 0x00, 0x7c, 0x00, 0x00, 0x0c, 0x01, 0x22, 0x67, 0xcd, 0xb0,
+    0x1c, 0x00, 0x2c, 0x0b, 0x01, 0x70, 0x06, 0x02, 0xb0, 0x00, 0x31, 0x38, 0x3c, 0xb9, 0xc8, 0x26,
+    0x31, 0x94, 0xa0, 0xd3, 0xa4, 0x32, 0x0c, 0x0c, 0x1c, 0x08, 0xf8, 0x00, 0x0f, 0x0c, 0x00, 0x11,
+    0x00, 0x84, 0x07, 0x00, 0x98, 0x08, 0x00, 0x78, 0x09, 0x02, 0xb4, 0x02, 0x12, 0xb3, 0x38, 0x0e,
+    0x00, 0x20, 0x04, 0x62, 0x7b, 0xd8, 0xff, 0x00, 0x8e, 0xe2, 0xb0, 0x0f, 0x00, 0x58, 0x06, 0x00,
+    0x08, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1c, 0x01, 0x22, 0xa2,
+    0xf0, 0x28, 0x0c, 0x00, 0x84, 0x07, 0x0f, 0x14, 0x01, 0x29, 0x04, 0x3c, 0x00, 0x00, 0x0c, 0x03,
+    0x00, 0x70, 0x01, 0x22, 0xa1, 0xee, 0x10, 0x0f, 0x22, 0x94, 0xe7, 0x04, 0x00, 0x00, 0x20, 0x0b,
+    0x00, 0xe4, 0x13, 0x00, 0x20, 0x01, 0x23, 0x4c, 0xc3, 0xe8, 0x15, 0x00, 0x68, 0x02, 0x00, 0x04,
+    0x00, 0x03, 0x64, 0x02, 0x03, 0xd0, 0x05, 0x02, 0x7c, 0x06, 0x11, 0xb3, 0x30, 0x0f, 0x23, 0x00,
+    0x4e, 0x30, 0x17, 0x00, 0x34, 0x06, 0x00, 0xb8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xbc, 0x00, 0x00,
+    0xf8, 0x0d, 0x22, 0xa1, 0xef, 0x14, 0x0b, 0x00, 0x74, 0x00, 0x04, 0x80, 0x00, 0x0f, 0x08, 0x00,
+    0x29, 0x00, 0x48, 0x00, 0x00, 0x08, 0x10, 0x00, 0xd4, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x68, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x48, 0x0e, 0x00, 0xd8, 0x03, 0x00, 0x98, 0x04, 0x00,
+    0xd4, 0x04, 0x00, 0xd4, 0x03, 0x22, 0x79, 0xd6, 0x70, 0x04, 0x00, 0x28, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x60, 0x01, 0x0c, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x03, 0x00, 0xa0, 0x17, 0x00,
+    0xb0, 0x07, 0x00, 0x80, 0x19, 0x00, 0x64, 0x0c, 0x01, 0xb0, 0x03, 0x11, 0xb4, 0xcc, 0x2b, 0x00,
+    0x6c, 0x34, 0x04, 0x54, 0x2b, 0x00, 0x5c, 0x18, 0x31, 0x8b, 0x97, 0xd0, 0xd8, 0x12, 0x02, 0x08,
+    0x01, 0x16, 0xb2, 0x08, 0x01, 0x00, 0xd8, 0x1d, 0x22, 0x89, 0xdf, 0x6c, 0x0c, 0x00, 0x98, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x94, 0x13, 0x00, 0x08, 0x01, 0x00, 0x74, 0x01, 0x00, 0xc0, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0xa4, 0x02, 0x00, 0xac, 0x02, 0x04, 0x84, 0x07, 0x00, 0x3c, 0x1f, 0x22, 0x4b,
+    0xc2, 0x54, 0x0c, 0x00, 0x48, 0x00, 0x08, 0x84, 0x07, 0x08, 0x38, 0x00, 0x00, 0x0c, 0x02, 0x00,
+    0x64, 0x0a, 0x00, 0x1c, 0x02, 0x05, 0x08, 0x01, 0x12, 0xe6, 0xd8, 0x15, 0x00, 0x08, 0x01, 0x00,
+    0xc8, 0x16, 0x00, 0xd0, 0x16, 0x00, 0x8c, 0x08, 0x03, 0xb4, 0x01, 0x31, 0x20, 0x24, 0xb7, 0x18,
+    0x30, 0x00, 0x88, 0x07, 0x31, 0x75, 0x7e, 0xc8, 0xc8, 0x2d, 0x00, 0x2c, 0x1a, 0x00, 0xd8, 0x0b,
+    0x02, 0x5c, 0x09, 0x00, 0xe8, 0x01, 0x0f, 0x04, 0x00, 0x20, 0x00, 0x84, 0x0e, 0x40, 0x52, 0xc5,
+    0xff, 0x01, 0xa8, 0x1d, 0x00, 0x7c, 0x00, 0x00, 0x60, 0x01, 0x00, 0x54, 0x01, 0x00, 0x08, 0x00,
+    0x08, 0x04, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0xb8, 0x0d, 0x22,
+    0x9f, 0xee, 0x20, 0x11, 0x0c, 0x14, 0x01, 0x09, 0xe8, 0x00, 0x07, 0x6c, 0x0a, 0x00, 0x28, 0x01,
+    0x00, 0xd8, 0x05, 0x00, 0xd4, 0x03, 0x22, 0x9c, 0xec, 0xd0, 0x03, 0x22, 0x54, 0xc6, 0x44, 0x1f,
+    0x22, 0x63, 0xcc, 0xd8, 0x05, 0x00, 0xb4, 0x04, 0x00, 0xb4, 0x0a, 0x00, 0x80, 0x00, 0x40, 0x8c,
+    0xe1, 0xff, 0x01, 0x64, 0x13, 0x22, 0x57, 0xc6, 0x2c, 0x15, 0x03, 0xc4, 0x04, 0x00, 0xcc, 0x11,
+    0x00, 0x84, 0x07, 0x7d, 0xaf, 0xbd, 0xdf, 0xff, 0xd0, 0xe0, 0xf0, 0xcc, 0x22, 0x04, 0xd4, 0x03,
+    0x00, 0x80, 0x0e, 0x01, 0xbc, 0x03, 0x21, 0x7c, 0xc7, 0x9c, 0x0b, 0x05, 0xbc, 0x03, 0x00, 0x58,
+    0x0d, 0x00, 0x20, 0x06, 0x0f, 0xbc, 0x03, 0x01, 0x00, 0xdc, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00,
+    0xa0, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x58, 0x19, 0x04, 0xb4, 0x02, 0x10, 0x24, 0x08, 0x07, 0x00,
+    0x84, 0x04, 0x11, 0xb2, 0x78, 0x34, 0x00, 0x90, 0x13, 0x00, 0xac, 0x1f, 0x0f, 0x84, 0x07, 0x12,
+    0x00, 0x10, 0x01, 0x00, 0x18, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28, 0x01, 0x0f, 0x44, 0x01, 0x05,
+    0x00, 0x24, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x7c, 0x01, 0x00, 0x80, 0x00, 0x00, 0x0c, 0x06, 0x00,
+    0xbc, 0x08, 0x01, 0xe4, 0x05, 0x02, 0xb4, 0x05, 0x00, 0x3c, 0x24, 0x00, 0x84, 0x07, 0x00, 0x94,
+    0x33, 0x04, 0x0c, 0x01, 0x00, 0x80, 0x07, 0x00, 0x9c, 0x16, 0x00, 0xd8, 0x26, 0x00, 0xcc, 0x15,
+    0x00, 0x18, 0x24, 0x00, 0xe8, 0x27, 0x02, 0x00, 0x03, 0x12, 0xb3, 0x7c, 0x29, 0x1f, 0x65, 0x84,
+    0x07, 0x00, 0x08, 0x88, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x50, 0x0d, 0x09, 0xbc, 0x03, 0x07, 0xb4,
+    0x02, 0x22, 0x73, 0xd4, 0x54, 0x08, 0x00, 0x20, 0x0d, 0x00, 0xd0, 0x09, 0x04, 0xbc, 0x03, 0x00,
+    0x50, 0x01, 0x00, 0x30, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x30, 0x00, 0x00,
+    0xe0, 0x00, 0x22, 0x8b, 0xe1, 0x98, 0x02, 0x00, 0x5c, 0x0b, 0x05, 0x54, 0x1d, 0x00, 0xe4, 0x02,
+    0x00, 0xd0, 0x04, 0x00, 0x08, 0x00, 0x12, 0xb3, 0xc0, 0x12, 0x0c, 0xc4, 0x04, 0x00, 0x44, 0x02,
+    0x0c, 0x14, 0x04, 0x05, 0x24, 0x09, 0x00, 0x3c, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x4c, 0x00, 0x12,
+    0xb4, 0x98, 0x26, 0x40, 0x54, 0xc5, 0xff, 0x01, 0xdc, 0x06, 0x0c, 0x0c, 0x03, 0x00, 0x90, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0xc4, 0x00, 0x04, 0x14, 0x04, 0x00, 0x10, 0x01, 0x00, 0x18, 0x01, 0x08,
+    0x28, 0x01, 0x08, 0x14, 0x04, 0x00, 0xb8, 0x06, 0x00, 0x34, 0x1c, 0x00, 0xec, 0x26, 0x03, 0xc0,
+    0x02, 0x00, 0x7c, 0x0f, 0x1b, 0x7a, 0x84, 0x07, 0x04, 0xd4, 0x12, 0x00, 0x20, 0x0f, 0x00, 0x4c,
+    0x2b, 0x00, 0xe4, 0x02, 0x15, 0x02, 0xd4, 0x06, 0x11, 0xb4, 0xb8, 0x27, 0x01, 0xf0, 0x0d, 0x00,
+    0xfc, 0x0a, 0x00, 0x74, 0x16, 0x00, 0x84, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x0b, 0x00, 0x9c,
+    0x10, 0x00, 0x68, 0x04, 0x00, 0x0c, 0x0b, 0x08, 0x88, 0x00, 0x0f, 0x0c, 0x00, 0x35, 0x00, 0xe0,
+    0x00, 0x00, 0xb8, 0x13, 0x00, 0x70, 0x0b, 0x00, 0xf8, 0x03, 0x00, 0x14, 0x05, 0x00, 0x04, 0x00,
+    0x00, 0x60, 0x01, 0x22, 0x87, 0xde, 0x54, 0x1a, 0x00, 0xfc, 0x13, 0x00, 0x54, 0x0a, 0x01, 0xe4,
+    0x00, 0x11, 0xb3, 0x20, 0x18, 0x00, 0x74, 0x3e, 0x00, 0x84, 0x46, 0x00, 0x0c, 0x1c, 0x31, 0xa8,
+    0xb5, 0xdb, 0x84, 0x32, 0x04, 0x90, 0x02, 0x0f, 0x08, 0x00, 0x1d, 0x00, 0xec, 0x22, 0x00, 0x9c,
+    0x17, 0x00, 0xb4, 0x10, 0x02, 0xc8, 0x03, 0x12, 0xb4, 0x40, 0x28, 0x00, 0x74, 0x09, 0x00, 0xb4,
+    0x02, 0x04, 0xa0, 0x05, 0x00, 0x90, 0x01, 0x00, 0x20, 0x03, 0x04, 0x04, 0x00, 0x00, 0xb8, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x3c, 0x03, 0x00, 0xcc, 0x00, 0x0f, 0x04, 0x00, 0x35,
+    0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x00, 0x18, 0x06, 0x04, 0x68, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0xcc, 0x03, 0x00, 0xe0, 0x14, 0x00, 0xe8, 0x15, 0x00, 0x48, 0x0e, 0x00, 0xc0, 0x10, 0x00, 0x6c,
+    0x14, 0x00, 0xec, 0x0c, 0x01, 0xd4, 0x01, 0x12, 0xb5, 0x88, 0x1a, 0x13, 0x16, 0xbc, 0x2b, 0x00,
+    0x50, 0x1e, 0x00, 0x40, 0x15, 0x00, 0x4c, 0x09, 0x00, 0x8c, 0x0b, 0x00, 0x44, 0x00, 0x00, 0xb4,
+    0x00, 0x04, 0x54, 0x00, 0x00, 0x64, 0x00, 0x00, 0x6c, 0x00, 0x0f, 0xb8, 0x00, 0x35, 0x00, 0x48,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x08, 0x68, 0x00, 0x00, 0x78, 0x00, 0x00, 0xe0, 0x0b,
+    0x00, 0x0c, 0x13, 0x00, 0x80, 0x0a, 0x00, 0xc8, 0x26, 0x00, 0x04, 0x25, 0x22, 0x86, 0xde, 0x0c,
+    0x17, 0x00, 0xac, 0x06, 0x22, 0xa5, 0xf2, 0xf4, 0x05, 0x00, 0x2c, 0x00, 0x00, 0xa0, 0x00, 0x01,
+    0x08, 0x00, 0x03, 0xd0, 0x17, 0x00, 0x68, 0x10, 0x00, 0x18, 0x03, 0x22, 0x7d, 0xd8, 0xb0, 0x03,
+    0x10, 0x1c, 0x04, 0x21, 0x00, 0x10, 0x05, 0x02, 0x08, 0x0f, 0x00, 0x74, 0x21, 0x00, 0x64, 0x3f,
+    0x31, 0xc3, 0xd3, 0xe9, 0x94, 0x22, 0x00, 0x60, 0x29, 0x26, 0x47, 0x4e, 0x20, 0x12, 0x01, 0xc8,
+    0x2c, 0x00, 0x38, 0x04, 0x00, 0x08, 0x06, 0x22, 0x9b, 0xeb, 0x68, 0x00, 0x04, 0xa0, 0x00, 0x00,
+    0x64, 0x01, 0x00, 0xb0, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xc0, 0x00, 0x08, 0x04, 0x00, 0x01, 0xe8,
+    0x02, 0x12, 0xf7, 0x80, 0x00, 0x00, 0x1c, 0x03, 0x00, 0xb4, 0x00, 0x00, 0x84, 0x07, 0x00, 0xa0,
+    0x0c, 0x00, 0xcc, 0x00, 0x05, 0x3c, 0x0f, 0x1a, 0xf8, 0x38, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x58, 0x00, 0x04, 0x68, 0x00, 0x00, 0x08, 0x00, 0x00, 0xd4, 0x00, 0x22, 0x9e, 0xed,
+    0x7c, 0x1e, 0x00, 0x44, 0x00, 0x00, 0x60, 0x13, 0x03, 0x84, 0x07, 0x00, 0x14, 0x1a, 0x00, 0xc0,
+    0x1f, 0x31, 0x32, 0x36, 0xb9, 0x50, 0x3c, 0x00, 0xa8, 0x03, 0x00, 0x98, 0x13, 0x63, 0x17, 0x1b,
+    0xb6, 0xff, 0x02, 0x19, 0xd0, 0x01, 0x00, 0x90, 0x0a, 0x00, 0x58, 0x0e, 0x00, 0x94, 0x05, 0x00,
+    0xf8, 0x03, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xfc, 0x15, 0x00, 0x04, 0x00, 0x00, 0x78, 0x18, 0x00,
+    0x80, 0x05, 0x00, 0x90, 0x0f, 0x00, 0x74, 0x12, 0x00, 0xd0, 0x02, 0x00, 0x6c, 0x01, 0x00, 0xd4,
+    0x00, 0x00, 0x90, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x0c, 0x00, 0x04, 0x04, 0x00, 0x04, 0x14, 0x01,
+    0x00, 0xf8, 0x03, 0x00, 0xcc, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0x2c, 0x01, 0x00, 0x60, 0x06,
+    0x00, 0xcc, 0x0d, 0x00, 0x64, 0x01, 0x00, 0x04, 0x07, 0x00, 0x68, 0x08, 0x00, 0x90, 0x15, 0x00,
+    0x5c, 0x0b, 0x00, 0xe0, 0x04, 0x00, 0x4c, 0x04, 0x04, 0x14, 0x01, 0x04, 0x10, 0x02, 0x00, 0xa0,
+    0x07, 0x00, 0x1c, 0x14, 0x03, 0xe0, 0x03, 0x00, 0xd4, 0x1d, 0x00, 0x4c, 0x15, 0x00, 0xd4, 0x1f,
+    0x00, 0x94, 0x26, 0x0f, 0xd0, 0x03, 0x05, 0x00, 0xf4, 0x03, 0x00, 0x7c, 0x35, 0x00, 0x5c, 0x32,
+    0x26, 0x30, 0x33, 0x10, 0x02, 0x01, 0xc0, 0x2e, 0x00, 0xa8, 0x01, 0x0f, 0xbc, 0x03, 0x09, 0x04,
+    0xe8, 0x00, 0x0f, 0x08, 0x00, 0x01, 0x00, 0x10, 0x01, 0x04, 0xac, 0x01, 0x00, 0x34, 0x03, 0x00,
+    0x58, 0x19, 0x00, 0xa0, 0x0c, 0x01, 0x20, 0x29, 0x00, 0x74, 0x02, 0x51, 0xb3, 0xff, 0x45, 0x4b,
+    0xbb, 0x20, 0x37, 0x2f, 0xb7, 0xc5, 0x84, 0x07, 0x0c, 0x00, 0x58, 0x29, 0x00, 0x5c, 0x0c, 0x00,
+    0x48, 0x05, 0x00, 0x18, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28, 0x01, 0x0f, 0x50, 0x01, 0x09, 0x00,
+    0x08, 0x13, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x01, 0x00, 0xb4, 0x08, 0x00, 0x74, 0x0b, 0x00, 0xc8,
+    0x03, 0x01, 0xe0, 0x03, 0x51, 0xb2, 0xff, 0x25, 0x26, 0xb7, 0xb0, 0x43, 0x00, 0x90, 0x1e, 0x04,
+    0x1c, 0x01, 0x00, 0x44, 0x20, 0x00, 0xf8, 0x2b, 0x00, 0x54, 0x32, 0x00, 0xac, 0x16, 0x50, 0x13,
+    0x15, 0xb6, 0xff, 0x0b, 0xe0, 0x14, 0x00, 0x38, 0x05, 0x00, 0xe8, 0x09, 0x00, 0x0c, 0x19, 0x00,
+    0xd8, 0x0c, 0x00, 0xdc, 0x10, 0x00, 0x08, 0x0f, 0x00, 0x80, 0x00, 0x0f, 0x88, 0x00, 0x01, 0x0f,
+    0xb4, 0x02, 0x05, 0x00, 0x08, 0x01, 0x00, 0xf4, 0x13, 0x22, 0x5e, 0xca, 0x60, 0x1a, 0x00, 0x60,
+    0x19, 0x00, 0xd4, 0x0b, 0x00, 0xb8, 0x05, 0x00, 0x2c, 0x02, 0x04, 0x30, 0x01, 0x0f, 0x50, 0x01,
+    0x01, 0x0c, 0x14, 0x00, 0x08, 0x60, 0x01, 0x00, 0x04, 0x02, 0x22, 0x8a, 0xe0, 0x94, 0x0e, 0x00,
+    0x5c, 0x0b, 0x00, 0xb0, 0x02, 0x00, 0xd4, 0x0e, 0x00, 0x74, 0x30, 0x00, 0xc4, 0x1e, 0x00, 0xa0,
+    0x2f, 0x00, 0x78, 0x01, 0x00, 0x38, 0x12, 0x08, 0xbc, 0x03, 0x00, 0x20, 0x01, 0x00, 0xc0, 0x02,
+    0x00, 0x14, 0x04, 0x00, 0xb8, 0x06, 0x00, 0x14, 0x04, 0x00, 0x6c, 0x1a, 0x01, 0x44, 0x02, 0x00,
+    0x80, 0x07, 0x00, 0xb0, 0x08, 0x08, 0x04, 0x00, 0x00, 0x14, 0x00, 0x12, 0xb4, 0xc4, 0x0f, 0x00,
+    0x6c, 0x1f, 0x00, 0x78, 0x04, 0x00, 0x88, 0x03, 0x00, 0x9c, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x94,
+    0x00, 0x00, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xa8, 0x02,
+    0x00, 0x10, 0x01, 0x00, 0x2c, 0x01, 0x08, 0x04, 0x00, 0x00, 0x38, 0x01, 0x00, 0x64, 0x0b, 0x00,
+    0x80, 0x00, 0x00, 0x50, 0x01, 0x0b, 0x84, 0x07, 0x00, 0x30, 0x1a, 0x00, 0xbc, 0x21, 0x00, 0x14,
+    0x18, 0x00, 0x7c, 0x16, 0x00, 0x20, 0x09, 0x00, 0x38, 0x18, 0x00, 0x6c, 0x15, 0x01, 0x1c, 0x09,
+    0x21, 0x22, 0xb6, 0xd4, 0x35, 0x10, 0x06, 0xb8, 0x05, 0x00, 0xe0, 0x00, 0x00, 0x20, 0x1b, 0x00,
+    0xb4, 0x19, 0x00, 0xec, 0x09, 0x00, 0xf0, 0x01, 0x00, 0x0c, 0x05, 0x00, 0x80, 0x00, 0x01, 0x04,
+    0x00, 0x12, 0xf3, 0x24, 0x0d, 0x00, 0xf0, 0x00, 0x00, 0x18, 0x02, 0x08, 0x88, 0x00, 0x0f, 0x0c,
+    0x00, 0x39, 0x00, 0xe8, 0x00, 0x00, 0xf0, 0x00, 0x08, 0x74, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xc8,
+    0x03, 0x00, 0xf8, 0x01, 0x00, 0x08, 0x0a, 0x00, 0x7c, 0x09, 0x00, 0xd0, 0x0b, 0xa1, 0x14, 0xb6,
+    0xff, 0x10, 0x17, 0xb6, 0xff, 0x17, 0x18, 0xb6, 0xa8, 0x28, 0x00, 0x54, 0x08, 0x00, 0x4c, 0x29,
+    0x00, 0xbc, 0x22, 0x0f, 0x98, 0x16, 0x25, 0x0f, 0x84, 0x07, 0x02, 0x00, 0x1c, 0x11, 0x00, 0x88,
+    0x17, 0x22, 0x91, 0xe5, 0xb0, 0x05, 0x00, 0x3c, 0x03, 0x00, 0x00, 0x09, 0x01, 0x80, 0x01, 0x07,
+    0xfc, 0x0b, 0x00, 0x10, 0x00, 0x0f, 0x0c, 0x01, 0x39, 0x08, 0x4c, 0x00, 0x00, 0xe8, 0x01, 0x00,
+    0x60, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x01, 0x00, 0x1c,
+    0x09, 0x00, 0xc0, 0x1c, 0x00, 0x24, 0x08, 0x00, 0xbc, 0x01, 0x00, 0xb4, 0x1e, 0x10, 0x0e, 0x88,
+    0x11, 0x03, 0xec, 0x09, 0x00, 0x70, 0x11, 0x00, 0x9c, 0x05, 0x00, 0x98, 0x02, 0x00, 0xf0, 0x06,
+    0x00, 0xbc, 0x02, 0x00, 0x7c, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x54, 0x00, 0x00, 0x4c, 0x00, 0x00,
+    0x54, 0x00, 0x01, 0x04, 0x00, 0x1e, 0xf7, 0x3c, 0x06, 0x00, 0x68, 0x00, 0x0f, 0x04, 0x00, 0x2d,
+    0x00, 0x68, 0x00, 0x01, 0x60, 0x00, 0x12, 0xf8, 0xc8, 0x14, 0x00, 0x0c, 0x00, 0x00, 0xdc, 0x02,
+    0x00, 0x68, 0x09, 0x00, 0xd4, 0x01, 0x00, 0x94, 0x0d, 0x00, 0x84, 0x2d, 0x00, 0x0c, 0x00, 0x00,
+    0xc8, 0x02, 0x00, 0x2c, 0x0e, 0x00, 0x74, 0x04, 0x00, 0x6c, 0x02, 0x00, 0x2c, 0x00, 0x00, 0x70,
+    0x01, 0x04, 0x08, 0x00, 0x00, 0x3c, 0x0c, 0x00, 0x80, 0x02, 0x00, 0x34, 0x03, 0x00, 0xcc, 0x00,
+    0x00, 0x5c, 0x0d, 0x01, 0xf4, 0x0a, 0x00, 0xb0, 0x27, 0x11, 0xb4, 0x68, 0x43, 0x00, 0xfc, 0x11,
+    0x00, 0xdc, 0x4d, 0x00, 0x18, 0x0d, 0x00, 0x98, 0x1b, 0x00, 0xd8, 0x10, 0x20, 0x3d, 0x42, 0x94,
+    0x22, 0x00, 0x7c, 0x03, 0x12, 0xb3, 0xdc, 0x20, 0x00, 0x68, 0x0a, 0x00, 0x7c, 0x03, 0x00, 0x84,
+    0x06, 0x00, 0xe0, 0x00, 0x00, 0x58, 0x00, 0x00, 0x64, 0x00, 0x01, 0x04, 0x00, 0x0f, 0x08, 0x01,
+    0x04, 0x04, 0x1c, 0x00, 0x00, 0x3c, 0x01, 0x0f, 0x84, 0x07, 0x1d, 0x00, 0x64, 0x00, 0x00, 0x04,
+    0x00, 0x01, 0x44, 0x00, 0x16, 0xf8, 0x70, 0x00, 0x00, 0x04, 0x05, 0x22, 0x8c, 0xe2, 0xc8, 0x04,
+    0x00, 0xc4, 0x35, 0x03, 0x84, 0x07, 0x02, 0x80, 0x23, 0x00, 0x38, 0x04, 0x00, 0xb4, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x60, 0x09, 0x62, 0x31, 0xbb, 0xff, 0x01, 0x4d, 0xc3, 0xac, 0x23, 0x00, 0x8c,
+    0x0f, 0x00, 0x00, 0x13, 0x00, 0xfc, 0x03, 0x00, 0xe0, 0x01, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x3c,
+    0x10, 0x00, 0xf8, 0x0b, 0x00, 0x1c, 0x18, 0x00, 0x74, 0x10, 0x00, 0x84, 0x01, 0x00, 0xec, 0x0c,
+    0x00, 0x74, 0x03, 0x00, 0xa8, 0x01, 0x04, 0x6c, 0x01, 0x04, 0xa8, 0x00, 0x05, 0x08, 0x00, 0x0f,
+    0x14, 0x01, 0x04, 0x00, 0xd4, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x38, 0x00, 0x00, 0x4c, 0x00,
+    0x00, 0xc4, 0x01, 0x00, 0xbc, 0x03, 0x00, 0x10, 0x1e, 0x00, 0x84, 0x02, 0x00, 0xa4, 0x02, 0x00,
+    0xec, 0x01, 0x00, 0xe4, 0x01, 0x00, 0xec, 0x03, 0x22, 0xb2, 0xfa, 0x0c, 0x01, 0x00, 0x08, 0x08,
+    0x00, 0x90, 0x00, 0x00, 0x08, 0x01, 0x01, 0x8c, 0x08, 0x00, 0xe0, 0x06, 0x11, 0xb2, 0xd8, 0x03,
+    0x31, 0x65, 0x6e, 0xc3, 0x5c, 0x4b, 0x04, 0x80, 0x29, 0x04, 0x80, 0x2c, 0x00, 0x74, 0x06, 0x00,
+    0x84, 0x16, 0x00, 0x78, 0x18, 0x00, 0x78, 0x2a, 0x00, 0x78, 0x36, 0x00, 0xb0, 0x3f, 0x15, 0x28,
+    0x84, 0x42, 0x12, 0xb3, 0xa4, 0x08, 0x00, 0x24, 0x15, 0x0f, 0xbc, 0x03, 0x11, 0x00, 0xb4, 0x00,
+    0x0c, 0x04, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xac, 0x01, 0x00, 0x08, 0x00, 0x00, 0x94, 0x02, 0x22,
+    0x8b, 0xe0, 0xf8, 0x10, 0x00, 0xc0, 0x05, 0x01, 0x7c, 0x11, 0x0f, 0x84, 0x07, 0x4c, 0x00, 0x90,
+    0x00, 0x00, 0x7c, 0x00, 0x00, 0x1c, 0x06, 0x00, 0xb8, 0x03, 0x00, 0x2c, 0x03, 0x00, 0xb4, 0x34,
+    0x04, 0x84, 0x07, 0x21, 0x27, 0xb7, 0x6c, 0x3f, 0x00, 0x00, 0x31, 0x00, 0x10, 0x01, 0x00, 0x04,
+    0x00, 0x00, 0x74, 0x0d, 0x00, 0xa8, 0x27, 0x00, 0x44, 0x3c, 0x02, 0x48, 0x0c, 0x03, 0x40, 0x0e,
+    0x22, 0x3d, 0xbe, 0xc4, 0x15, 0x00, 0xcc, 0x04, 0x00, 0x4c, 0x08, 0x00, 0xb4, 0x06, 0x00, 0x68,
+    0x06, 0x00, 0xc0, 0x01, 0x00, 0x68, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x1c,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x08, 0x01, 0x00, 0xb4, 0x02, 0x00, 0x74, 0x07, 0x00, 0x38, 0x0a,
+    0x00, 0xd0, 0x07, 0x00, 0x7c, 0x04, 0x00, 0x10, 0x03, 0x00, 0x4c, 0x00, 0x00, 0xac, 0x00, 0x09,
+    0x54, 0x04, 0x0b, 0x20, 0x05, 0x00, 0x48, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x34, 0x00, 0x00, 0x14,
+    0x00, 0x08, 0x14, 0x04, 0x00, 0x18, 0x16, 0x04, 0xcc, 0x02, 0x00, 0x38, 0x0c, 0x00, 0xb8, 0x1a,
+    0x00, 0xa0, 0x1d, 0x00, 0xe0, 0x04, 0x00, 0xd8, 0x10, 0x00, 0xbc, 0x03, 0x00, 0xa0, 0x06, 0x00,
+    0x3c, 0x00, 0x00, 0x44, 0x02, 0x00, 0xb8, 0x00, 0x05, 0x14, 0x04, 0x30, 0xc5, 0xff, 0x00, 0xa8,
+    0x0a, 0x0f, 0x84, 0x07, 0x0d, 0x00, 0x24, 0x11, 0x00, 0xc0, 0x0c, 0x00, 0x04, 0x0f, 0x00, 0xdc,
+    0x01, 0x00, 0x84, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x08, 0x00, 0x0d, 0x04, 0x00, 0x0f, 0x00, 0x03,
+    0x04, 0x01, 0x28, 0x00, 0x03, 0x98, 0x0b, 0x00, 0xbc, 0x04, 0x00, 0x88, 0x03, 0x00, 0x70, 0x05,
+    0x01, 0xc8, 0x03, 0x11, 0xb3, 0x1c, 0x4d, 0x00, 0x14, 0x2b, 0x00, 0x9c, 0x32, 0x00, 0x48, 0x0a,
+    0x00, 0xb4, 0x2f, 0x00, 0x34, 0x11, 0x54, 0x53, 0x59, 0xbe, 0xff, 0x0b, 0x2c, 0x20, 0x00, 0x2c,
+    0x00, 0x40, 0x20, 0xb8, 0xff, 0x01, 0x48, 0x0d, 0x00, 0x70, 0x15, 0x00, 0xa4, 0x0a, 0x00, 0x8c,
+    0x08, 0x22, 0x9e, 0xec, 0x54, 0x15, 0x00, 0xe4, 0x00, 0x00, 0x04, 0x00, 0x01, 0x6c, 0x00, 0x0f,
+    0xe0, 0x0b, 0x00, 0x00, 0xfc, 0x00, 0x0f, 0x04, 0x00, 0x3d, 0x00, 0x0c, 0x04, 0x04, 0x70, 0x00,
+    0x00, 0xd0, 0x01, 0x00, 0x60, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x14, 0x0f, 0x00, 0x50, 0x19, 0x00,
+    0x98, 0x16, 0x00, 0xa0, 0x1e, 0x00, 0x30, 0x0b, 0x00, 0xe4, 0x1c, 0x03, 0x0c, 0x03, 0x00, 0x74,
+    0x08, 0x00, 0xbc, 0x3d, 0x00, 0x98, 0x16, 0x00, 0x88, 0x07, 0x00, 0x1c, 0x0b, 0x00, 0x94, 0x02,
+    0x0f, 0x04, 0x00, 0x19, 0x0f, 0x84, 0x07, 0x16, 0x0f, 0xac, 0x01, 0x1d, 0x00, 0xc4, 0x00, 0x0f,
+    0x04, 0x00, 0x29, 0x09, 0x14, 0x01, 0x03, 0xd8, 0x02, 0x00, 0x38, 0x05, 0x00, 0x7c, 0x0d, 0x00,
+    0x48, 0x05, 0x00, 0x88, 0x0d, 0x00, 0x24, 0x0b, 0x00, 0x9c, 0x05, 0x00, 0x74, 0x23, 0x01, 0x80,
+    0x02, 0x12, 0xb3, 0x70, 0x11, 0x22, 0x51, 0xc5, 0xe8, 0x30, 0x00, 0x38, 0x03, 0x00, 0x2c, 0x00,
+    0x00, 0x34, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x64, 0x01, 0x08, 0xdc, 0x01, 0x00, 0x64, 0x00, 0x0f,
+    0xa4, 0x00, 0x29, 0x0f, 0x3c, 0x00, 0x05, 0x00, 0x58, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x04, 0x00,
+    0x04, 0x70, 0x00, 0x00, 0x9c, 0x05, 0x22, 0xa4, 0xf0, 0xf8, 0x0e, 0x00, 0xbc, 0x02, 0x00, 0x80,
+    0x07, 0x00, 0x8c, 0x14, 0x00, 0x20, 0x06, 0x00, 0x20, 0x04, 0x00, 0xa8, 0x00, 0x00, 0x94, 0x03,
+    0x01, 0x34, 0x00, 0x13, 0xf9, 0xfc, 0x18, 0x03, 0xbc, 0x06, 0x00, 0x68, 0x00, 0x00, 0x34, 0x0b,
+    0x00, 0x84, 0x07, 0x00, 0x5c, 0x0d, 0x00, 0x68, 0x08, 0x01, 0x04, 0x02, 0x11, 0xb4, 0xc0, 0x21,
+    0x31, 0x59, 0x61, 0xc0, 0xbc, 0x56, 0xb1, 0x7d, 0x87, 0xcb, 0xff, 0x71, 0x7b, 0xc7, 0xff, 0x55,
+    0x5c, 0xbf, 0x8c, 0x3c, 0x05, 0xc4, 0x15, 0x0f, 0x84, 0x07, 0x05, 0x04, 0x9c, 0x00, 0x00, 0xb0,
+    0x00, 0x00, 0x64, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x1c, 0x00, 0x0f, 0x84, 0x07,
+    0x25, 0x00, 0x3c, 0x00, 0x01, 0x44, 0x00, 0x03, 0xc8, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xd8, 0x02,
+    0x00, 0x84, 0x07, 0x00, 0x68, 0x04, 0x03, 0x84, 0x07, 0x02, 0xe8, 0x31, 0x00, 0x80, 0x07, 0x00,
+    0x04, 0x00, 0x07, 0x80, 0x07, 0x00, 0xd4, 0x01, 0x00, 0x78, 0x17, 0x00, 0x2c, 0x1a, 0x00, 0xdc,
+    0x0d, 0x00, 0x48, 0x07, 0x00, 0x1c, 0x19, 0x00, 0x30, 0x0b, 0x00, 0x08, 0x13, 0x00, 0x48, 0x01,
+    0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe8, 0x06, 0x00, 0x3c, 0x11,
+    0x00, 0x14, 0x07, 0x00, 0xd0, 0x05, 0x22, 0x80, 0xdb, 0xf4, 0x1b, 0x00, 0xd4, 0x00, 0x00, 0xa0,
+    0x00, 0x00, 0x70, 0x03, 0x05, 0x08, 0x01, 0x03, 0x68, 0x02, 0x00, 0xa8, 0x00, 0x00, 0x1c, 0x00,
+    0x0c, 0x10, 0x01, 0x0f, 0x10, 0x00, 0x09, 0x00, 0x34, 0x00, 0x00, 0x48, 0x00, 0x00, 0xe8, 0x01,
+    0x0f, 0x84, 0x07, 0x19, 0x00, 0x08, 0x01, 0x00, 0x1c, 0x05, 0x00, 0xec, 0x00, 0x21, 0x00, 0xb3,
+    0xdc, 0x3b, 0x00, 0xf4, 0x2e, 0x00, 0xf4, 0x41, 0x00, 0xbc, 0x04, 0x00, 0x74, 0x15, 0x00, 0xa4,
+    0x26, 0x00, 0xd4, 0x03, 0x00, 0x84, 0x2c, 0x00, 0x74, 0x27, 0x00, 0x10, 0x64, 0x00, 0x8c, 0x5c,
+    0x00, 0xf8, 0x1c, 0x31, 0x43, 0x48, 0xbb, 0x18, 0x54, 0x02, 0x7c, 0x06, 0x03, 0xc4, 0x12, 0x0c,
+    0x84, 0x07, 0x0f, 0xbc, 0x03, 0x06, 0x08, 0xf0, 0x00, 0x03, 0x0c, 0x00, 0x00, 0xc4, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x08, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x1c, 0x05, 0x00, 0x08, 0x0c, 0x0f, 0x84,
+    0x07, 0x5e, 0x12, 0xf5, 0x74, 0x2f, 0x00, 0xb4, 0x01, 0x00, 0xcc, 0x10, 0x07, 0x84, 0x07, 0x00,
+    0x78, 0x38, 0x09, 0x84, 0x07, 0x21, 0xbb, 0xde, 0x3c, 0x10, 0x02, 0x7c, 0x33, 0x00, 0xcc, 0x08,
+    0x11, 0xb3, 0xf4, 0x0d, 0x00, 0x38, 0x39, 0x01, 0x78, 0x15, 0x00, 0x14, 0x10, 0x00, 0x04, 0x09,
+    0x00, 0x80, 0x03, 0x00, 0x08, 0x04, 0x00, 0xc8, 0x01, 0x0f, 0xe0, 0x01, 0x05, 0x00, 0x18, 0x00,
+    0x04, 0xcc, 0x01, 0x04, 0x08, 0x01, 0x00, 0xb4, 0x02, 0x00, 0x4c, 0x04, 0x01, 0x84, 0x07, 0x12,
+    0xc2, 0x88, 0x24, 0x08, 0x84, 0x07, 0x00, 0x28, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x15,
+    0x00, 0x5c, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x9c, 0x04, 0x00, 0x18, 0x1b, 0x00,
+    0xfc, 0x14, 0x00, 0xb0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x74, 0x01, 0x00, 0xb8, 0x09, 0x00, 0x30,
+    0x13, 0x00, 0x38, 0x21, 0x04, 0x40, 0x0b, 0x0c, 0x84, 0x07, 0x08, 0x14, 0x04, 0x01, 0xc8, 0x2d,
+    0x03, 0x88, 0x0c, 0x01, 0x2c, 0x01, 0x00, 0x4c, 0x03, 0x04, 0x04, 0x00, 0x03, 0x54, 0x03, 0x00,
+    0x68, 0x02, 0x0f, 0x84, 0x07, 0x4c, 0x00, 0xb8, 0x2e, 0x00, 0x94, 0x32, 0x00, 0x30, 0x18, 0x00,
+    0x54, 0x19, 0x00, 0x80, 0x16, 0x00, 0x98, 0x2d, 0x00, 0x4c, 0x3a, 0x02, 0x90, 0x04, 0x00, 0xa0,
+    0x01, 0x11, 0xb4, 0xf8, 0x2e, 0x01, 0x00, 0x1e, 0x00, 0xc8, 0x0f, 0x00, 0xf4, 0x00, 0x00, 0x6c,
+    0x10, 0x00, 0x94, 0x03, 0x00, 0xa8, 0x0a, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x00, 0x24, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0xb0, 0x01, 0x0f, 0x04, 0x00, 0x4d, 0x04, 0xf8, 0x01, 0x00, 0x70, 0x00,
+    0x04, 0x7c, 0x00, 0x00, 0x2c, 0x02, 0x00, 0xb0, 0x0b, 0x00, 0x0c, 0x0a, 0x04, 0x98, 0x16, 0x00,
+    0x08, 0x14, 0x05, 0x80, 0x05, 0x11, 0xb3, 0x0c, 0x38, 0x00, 0xf0, 0x00, 0x00, 0x94, 0x02, 0x13,
+    0x8a, 0x5c, 0x38, 0x0f, 0xb8, 0x34, 0x1d, 0x0f, 0x84, 0x07, 0x06, 0x00, 0xc8, 0x03, 0x00, 0x1c,
+    0x01, 0x00, 0x18, 0x01, 0x00, 0x98, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x08, 0x01, 0x4d, 0x0f, 0x60,
+    0x00, 0x0d, 0x00, 0xa0, 0x01, 0x00, 0x20, 0x14, 0x00, 0x80, 0x0a, 0x00, 0xb4, 0x01, 0x00, 0x64,
+    0x16, 0x00, 0xc4, 0x04, 0x00, 0xa8, 0x02, 0x00, 0xd8, 0x10, 0x00, 0x34, 0x30, 0x00, 0xa8, 0x08,
+    0x00, 0x70, 0x11, 0x00, 0x78, 0x05, 0x00, 0x24, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x34, 0x00, 0x00,
+    0x3c, 0x00, 0x0f, 0x60, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x49, 0x00, 0x80, 0x00, 0x00, 0x88, 0x00,
+    0x00, 0xf0, 0x10, 0x00, 0xf0, 0x1a, 0x00, 0x68, 0x03, 0x00, 0x64, 0x01, 0x00, 0x24, 0x16, 0x00,
+    0x08, 0x00, 0x00, 0x2c, 0x06, 0x00, 0xf4, 0x04, 0x00, 0x84, 0x00, 0x04, 0x6c, 0x01, 0x04, 0x18,
+    0x02, 0x00, 0x38, 0x00, 0x00, 0x70, 0x03, 0x00, 0xd4, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xec, 0x0c,
+    0x00, 0x0c, 0x0f, 0x61, 0x0d, 0xb6, 0xff, 0x17, 0x1c, 0xb6, 0x0c, 0x29, 0x00, 0x28, 0x23, 0x00,
+    0xec, 0x11, 0x71, 0x3c, 0x42, 0xba, 0xff, 0x2b, 0x30, 0xb8, 0x48, 0x39, 0x02, 0xf4, 0x02, 0x03,
+    0x08, 0x0f, 0x00, 0x4c, 0x0b, 0x00, 0x40, 0x00, 0x00, 0x40, 0x13, 0x00, 0x8c, 0x00, 0x00, 0x68,
+    0x02, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x88, 0x00, 0x00, 0x84, 0x00, 0x00, 0x04,
+    0x02, 0x00, 0x74, 0x04, 0x00, 0x08, 0x07, 0x00, 0x84, 0x02, 0x00, 0x8c, 0x04, 0x00, 0x04, 0x09,
+    0x00, 0x40, 0x04, 0x00, 0x40, 0x00, 0x0f, 0x4c, 0x00, 0x11, 0x04, 0x24, 0x00, 0x00, 0xe4, 0x00,
+    0x00, 0x88, 0x0b, 0x00, 0x20, 0x16, 0x00, 0xac, 0x01, 0x00, 0x14, 0x0b, 0x01, 0x04, 0x00, 0x04,
+    0x30, 0x04, 0x04, 0x08, 0x00, 0x00, 0x38, 0x04, 0x02, 0xb0, 0x21, 0x01, 0x4c, 0x0e, 0x00, 0x44,
+    0x07, 0x00, 0x08, 0x1b, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x94, 0x00, 0x0f, 0x04, 0x00,
+    0x09, 0x04, 0x24, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0xa8, 0x07, 0x00, 0x6c, 0x0b, 0x00, 0xd4, 0x13,
+    0x00, 0x30, 0x02, 0x00, 0x38, 0x02, 0x00, 0x18, 0x00, 0x00, 0x08, 0x01, 0x00, 0xe4, 0x00, 0x00,
+    0xc4, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x00, 0x28, 0x01, 0x00, 0x4c, 0x00, 0x00, 0x58, 0x05, 0x00,
+    0x78, 0x02, 0x00, 0xac, 0x11, 0x00, 0x40, 0x2e, 0x00, 0x74, 0x00, 0x00, 0x50, 0x05, 0x00, 0x04,
+    0x1c, 0x00, 0xfc, 0x0e, 0x00, 0x74, 0x00, 0x00, 0xd8, 0x10, 0x00, 0xc8, 0x00, 0x40, 0x8f, 0xe4,
+    0xff, 0x00, 0xc4, 0x34, 0x00, 0x8c, 0x2a, 0x00, 0xb0, 0x2a, 0x12, 0x0b, 0x08, 0x2b, 0x22, 0x1c,
+    0x1e, 0x18, 0x40, 0x00, 0xbc, 0x22, 0x00, 0xfc, 0x24, 0x00, 0x6c, 0x15, 0x00, 0x54, 0x5a, 0x00,
+    0x90, 0x59, 0x00, 0x00, 0x3d, 0x00, 0x6c, 0x09, 0x31, 0x4e, 0x54, 0xbd, 0x74, 0x0c, 0x50, 0x1a,
+    0x1d, 0xb6, 0xff, 0x0a, 0x38, 0x2c, 0x00, 0x94, 0x23, 0x00, 0x3c, 0x45, 0x00, 0xa0, 0x01, 0x00,
+    0xbc, 0x1c, 0x00, 0xfc, 0x16, 0x00, 0x04, 0x01, 0x00, 0x94, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xe0,
+    0x00, 0x15, 0x00, 0x9c, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa8, 0x02, 0x00, 0xc8, 0x00, 0x22, 0x84,
+    0xdc, 0x80, 0x32, 0x00, 0x38, 0x43, 0x01, 0xf8, 0x09, 0x0f, 0x08, 0x0f, 0x50, 0x00, 0xb0, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xf4, 0x12, 0x00, 0xa4, 0x14, 0x00, 0x20, 0x01, 0x01, 0x58, 0x06, 0x51,
+    0xb2, 0xff, 0x23, 0x25, 0xb7, 0xd4, 0x57, 0x00, 0x14, 0x51, 0x00, 0xcc, 0x51, 0x40, 0xc3, 0xd2,
+    0xe9, 0x22, 0x28, 0x32, 0x00, 0x44, 0x20, 0x00, 0x94, 0x0c, 0x05, 0x8c, 0x08, 0x00, 0xd0, 0x15,
+    0x00, 0xec, 0x01, 0x00, 0x3c, 0x07, 0x00, 0x70, 0x03, 0x00, 0x58, 0x0f, 0x00, 0x48, 0x03, 0x00,
+    0xdc, 0x00, 0x0f, 0x0c, 0x01, 0x11, 0x04, 0x08, 0x01, 0x00, 0x38, 0x00, 0x00, 0x70, 0x0e, 0x00,
+    0x88, 0x0e, 0x00, 0x50, 0x00, 0x00, 0xa0, 0x0e, 0x00, 0xfc, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x80,
+    0x02, 0x04, 0xf8, 0x01, 0x0f, 0x54, 0x00, 0x11, 0x0c, 0x24, 0x00, 0x00, 0x8c, 0x00, 0x00, 0xe8,
+    0x05, 0x00, 0xa4, 0x04, 0x00, 0x4c, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x08, 0x00, 0x00, 0xa4, 0x03,
+    0x00, 0x6c, 0x0a, 0x00, 0x40, 0x17, 0x00, 0x70, 0x00, 0x00, 0xb0, 0x18, 0x00, 0xb4, 0x0b, 0x00,
+    0x8c, 0x1b, 0x00, 0x18, 0x01, 0x00, 0x48, 0x00, 0x00, 0x68, 0x02, 0x0c, 0x14, 0x04, 0x00, 0x0c,
+    0x0f, 0x00, 0x6c, 0x30, 0x01, 0x18, 0x27, 0x04, 0x48, 0x03, 0x00, 0x08, 0x00, 0x00, 0x4c, 0x03,
+    0x12, 0xb4, 0xe8, 0x23, 0x00, 0x4c, 0x00, 0x00, 0x7c, 0x04, 0x0f, 0xbc, 0x03, 0x19, 0x00, 0x70,
+    0x00, 0x04, 0x04, 0x00, 0x00, 0x9c, 0x01, 0x00, 0xf4, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x58, 0x03,
+    0x0b, 0x08, 0x0f, 0x31, 0x0b, 0x0c, 0xb5, 0xbc, 0x2e, 0x00, 0x74, 0x07, 0x00, 0xfc, 0x2c, 0x31,
+    0x41, 0x46, 0xbb, 0xac, 0x32, 0x50, 0x1e, 0x22, 0xb7, 0xff, 0x05, 0x1c, 0x2a, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x47, 0x00, 0xd4, 0x03, 0x00, 0x94, 0x3d, 0x00, 0x7c, 0x08, 0x00, 0x8c, 0x00, 0x00,
+    0x08, 0x01, 0x00, 0x10, 0x01, 0x00, 0x78, 0x01, 0x04, 0x6c, 0x00, 0x0f, 0x08, 0x00, 0x6d, 0x00,
+    0x90, 0x00, 0x00, 0x34, 0x02, 0x00, 0x98, 0x01, 0x00, 0x50, 0x19, 0x00, 0x40, 0x05, 0x00, 0x40,
+    0x01, 0x00, 0xb8, 0x2d, 0x00, 0x48, 0x29, 0x61, 0x0d, 0xb6, 0xff, 0x12, 0x18, 0xb6, 0x74, 0x2e,
+    0x00, 0xe4, 0x00, 0x00, 0x18, 0x30, 0x00, 0x30, 0x2d, 0x00, 0x18, 0x1c, 0x00, 0x34, 0x0b, 0x0f,
+    0x04, 0x00, 0x15, 0x0f, 0x84, 0x07, 0x9a, 0x00, 0x94, 0x01, 0x00, 0x04, 0x02, 0x00, 0x08, 0x00,
+    0x00, 0x04, 0x02, 0x00, 0x94, 0x05, 0x00, 0xec, 0x04, 0x00, 0x1c, 0x03, 0x00, 0x90, 0x3b, 0x00,
+    0xd4, 0x13, 0x00, 0xa0, 0x06, 0x00, 0xec, 0x09, 0x00, 0xfc, 0x0a, 0x00, 0xc0, 0x0a, 0x00, 0x30,
+    0x00, 0x00, 0xec, 0x0c, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x25, 0x00, 0x74, 0x02, 0x00, 0x48,
+    0x00, 0x00, 0x04, 0x00, 0x0f, 0x44, 0x00, 0x25, 0x00, 0x38, 0x00, 0x00, 0x88, 0x06, 0x00, 0x44,
+    0x00, 0x00, 0xbc, 0x00, 0x00, 0x74, 0x07, 0x00, 0xb8, 0x00, 0x00, 0xf8, 0x29, 0x00, 0xd4, 0x06,
+    0x08, 0xe4, 0x24, 0x00, 0x28, 0x00, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x0c, 0x02, 0x00, 0xa8, 0x02, 0x00, 0xf8, 0x03, 0x00, 0x0c, 0x22, 0x00, 0x30, 0x00, 0x00, 0x28,
+    0x20, 0x00, 0xd8, 0x0a, 0x00, 0x38, 0x29, 0x01, 0xc4, 0x06, 0x03, 0x68, 0x03, 0x01, 0xac, 0x04,
+    0x00, 0x78, 0x03, 0x00, 0x04, 0x00, 0x03, 0x14, 0x00, 0x00, 0x08, 0x0f, 0x0f, 0x84, 0x07, 0xa5,
+    0x00, 0x5c, 0x09, 0x00, 0xc8, 0x26, 0x00, 0xa0, 0x23, 0x00, 0x14, 0x06, 0x00, 0x0c, 0x01, 0x00,
+    0xd0, 0x01, 0x00, 0x18, 0x01, 0x01, 0x98, 0x01, 0x1f, 0xf7, 0x08, 0x00, 0x00, 0x00, 0x04, 0x18,
+    0x00, 0xd4, 0x2d, 0x12, 0xf9, 0x50, 0x1a, 0x00, 0xe0, 0x21, 0x00, 0xd0, 0x04, 0x00, 0x24, 0x02,
+    0x00, 0x0c, 0x27, 0x00, 0x50, 0x10, 0x00, 0xc0, 0x04, 0x01, 0x4c, 0x00, 0x0f, 0xec, 0x12, 0x34,
+    0x01, 0x84, 0x00, 0x12, 0xf8, 0xb4, 0x03, 0x00, 0xe0, 0x07, 0x00, 0xe0, 0x01, 0x00, 0xe8, 0x10,
+    0x00, 0xb0, 0x05, 0x00, 0x40, 0x08, 0x00, 0x0c, 0x06, 0x00, 0x88, 0x07, 0x00, 0x60, 0x05, 0x00,
+    0xd4, 0x03, 0x00, 0x90, 0x07, 0x00, 0xfc, 0x10, 0x00, 0xa8, 0x1e, 0x00, 0xdc, 0x08, 0x00, 0x3c,
+    0x1d, 0x00, 0xd4, 0x13, 0x00, 0xa4, 0x49, 0x01, 0xd0, 0x01, 0x11, 0xb3, 0xa0, 0x47, 0x00, 0x48,
+    0x48, 0x00, 0x84, 0x34, 0x00, 0x90, 0x43, 0x00, 0x14, 0x52, 0x00, 0x68, 0x1b, 0x00, 0x44, 0x4f,
+    0x00, 0x54, 0x48, 0x05, 0x70, 0x06, 0x00, 0xd0, 0x23, 0x00, 0xe8, 0x27, 0x00, 0x24, 0x11, 0x00,
+    0xd0, 0x09, 0x00, 0x2c, 0x04, 0x22, 0x9b, 0xea, 0xb0, 0x05, 0x04, 0x98, 0x00, 0x00, 0x4c, 0x02,
+    0x0f, 0x04, 0x00, 0x11, 0x00, 0x74, 0x06, 0x00, 0x6c, 0x02, 0x00, 0x38, 0x0e, 0x00, 0x34, 0x24,
+    0x00, 0x84, 0x2b, 0x00, 0x9c, 0x00, 0x00, 0x64, 0x00, 0x01, 0x84, 0x07, 0x0f, 0x94, 0x25, 0x18,
+    0x00, 0x38, 0x00, 0x0f, 0x10, 0x1e, 0x1d, 0x01, 0xd8, 0x01, 0x12, 0xf8, 0xbc, 0x00, 0x0f, 0x84,
+    0x07, 0x00, 0x00, 0xcc, 0x4c, 0x04, 0x1c, 0x32, 0x31, 0xa8, 0xb6, 0xdc, 0x04, 0x59, 0x00, 0x18,
+    0x30, 0x00, 0xb8, 0x39, 0x00, 0x40, 0x20, 0x02, 0x14, 0x01, 0x11, 0xb3, 0x10, 0x31, 0x01, 0xfc,
+    0x2b, 0x08, 0x48, 0x0c, 0x08, 0x58, 0x03, 0x0f, 0x0c, 0x01, 0x0d, 0x08, 0x08, 0x01, 0x00, 0x6c,
+    0x06, 0x00, 0x34, 0x02, 0x00, 0x0c, 0x01, 0x00, 0xcc, 0x09, 0x00, 0x10, 0x07, 0x00, 0xd8, 0x16,
+    0x01, 0x60, 0x01, 0x00, 0x6c, 0x02, 0x03, 0x44, 0x10, 0x00, 0xbc, 0x00, 0x0f, 0x58, 0x00, 0x0d,
+    0x0f, 0x20, 0x00, 0x05, 0x04, 0xa8, 0x01, 0x00, 0x44, 0x00, 0x00, 0x90, 0x06, 0x00, 0x4c, 0x11,
+    0x00, 0xf8, 0x07, 0x04, 0x74, 0x00, 0x00, 0x00, 0x03, 0x00, 0x98, 0x07, 0x00, 0x34, 0x0f, 0x00,
+    0xa0, 0x01, 0x00, 0x44, 0x02, 0x00, 0xa4, 0x0d, 0x00, 0x74, 0x18, 0x62, 0x79, 0xd7, 0xff, 0x00,
+    0x60, 0xcb, 0x80, 0x2f, 0x00, 0x04, 0x05, 0x07, 0x64, 0x4c, 0x02, 0xe4, 0x19, 0x03, 0x08, 0x04,
+    0x00, 0x30, 0x04, 0x00, 0x1c, 0x05, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x0a, 0x00, 0x6c, 0x00, 0x0f,
+    0x14, 0x01, 0x19, 0x00, 0xbc, 0x00, 0x00, 0x34, 0x00, 0x00, 0xac, 0x00, 0x00, 0xc0, 0x02, 0x00,
+    0x18, 0x01, 0x00, 0x1c, 0x1a, 0x00, 0xc8, 0x1e, 0x03, 0xb4, 0x02, 0x02, 0x70, 0x00, 0x00, 0x7c,
+    0x04, 0x00, 0x04, 0x00, 0x03, 0x78, 0x00, 0x01, 0x1c, 0x00, 0x12, 0xb4, 0x44, 0x02, 0x00, 0x30,
+    0x0d, 0x00, 0x78, 0x0c, 0x00, 0x7c, 0x17, 0x00, 0x0c, 0x08, 0x00, 0xe0, 0x08, 0x00, 0xf0, 0x00,
+    0x01, 0x58, 0x00, 0x0f, 0x8c, 0x03, 0x34, 0x00, 0xa8, 0x00, 0x0f, 0x04, 0x00, 0x35, 0x00, 0x98,
+    0x00, 0x00, 0x4c, 0x00, 0x00, 0xb4, 0x05, 0x00, 0xc0, 0x03, 0x00, 0x98, 0x16, 0x00, 0x40, 0x1a,
+    0x00, 0x80, 0x15, 0x00, 0xbc, 0x1f, 0x00, 0xf8, 0x08, 0x03, 0xc4, 0x12, 0x00, 0x10, 0x37, 0x00,
+    0xe8, 0x3b, 0x00, 0x94, 0x16, 0x0f, 0x80, 0x07, 0x15, 0x00, 0x28, 0x00, 0x0f, 0x84, 0x07, 0xa2,
+    0x00, 0x18, 0x01, 0x00, 0xb8, 0x01, 0x00, 0x9c, 0x11, 0x03, 0x28, 0x10, 0x01, 0x50, 0x0c, 0x00,
+    0x18, 0x01, 0x00, 0xe8, 0x36, 0x00, 0x68, 0x02, 0x00, 0x84, 0x07, 0x00, 0x38, 0x01, 0x00, 0x64,
+    0x02, 0x01, 0x2c, 0x12, 0x0f, 0xe0, 0x18, 0x04, 0x00, 0x60, 0x01, 0x0f, 0x04, 0x00, 0x0d, 0x00,
+    0x70, 0x00, 0x05, 0x04, 0x00, 0x0f, 0x48, 0x00, 0x28, 0x00, 0x8c, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x98, 0x00, 0x00, 0xa4, 0x05, 0x00, 0xcc, 0x01, 0x00, 0xe4, 0x0b, 0x00, 0x30, 0x0d, 0x00, 0x58,
+    0x0e, 0x05, 0x18, 0x03, 0x16, 0xf9, 0xa8, 0x1e, 0x00, 0xf0, 0x02, 0x00, 0x1c, 0x0a, 0x00, 0x2c,
+    0x0b, 0x00, 0x38, 0x06, 0x00, 0xe0, 0x0c, 0x40, 0x82, 0xdc, 0xff, 0x01, 0x3c, 0x1a, 0x00, 0xc8,
+    0x21, 0x05, 0x00, 0x43, 0x04, 0x88, 0x12, 0x04, 0xf8, 0x02, 0x02, 0x04, 0x03, 0x01, 0xe8, 0x15,
+    0x0f, 0x84, 0x07, 0xa9, 0x00, 0x60, 0x27, 0x04, 0x84, 0x07, 0x00, 0xb0, 0x03, 0x00, 0x0c, 0x01,
+    0x00, 0xd0, 0x01, 0x00, 0x48, 0x01, 0x05, 0x94, 0x01, 0x07, 0x04, 0x05, 0x00, 0x14, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x02, 0x00, 0xd4, 0x19, 0x00, 0x70,
+    0x0e, 0x00, 0x30, 0x01, 0x00, 0x58, 0x0c, 0x00, 0xb8, 0x09, 0x00, 0x4c, 0x01, 0x0f, 0x84, 0x07,
+    0x39, 0x00, 0x44, 0x02, 0x01, 0xac, 0x01, 0x12, 0xf6, 0x44, 0x21, 0x00, 0x30, 0x08, 0x00, 0xe4,
+    0x0b, 0x22, 0x87, 0xdf, 0x24, 0x2d, 0x00, 0x0c, 0x2e, 0x00, 0x78, 0x13, 0x00, 0xf8, 0x01, 0x00,
+    0x7c, 0x00, 0x00, 0x44, 0x05, 0x00, 0x4c, 0x05, 0x00, 0x88, 0x07, 0x62, 0x89, 0xdf, 0xff, 0x01,
+    0x73, 0xd4, 0x60, 0x4d, 0x00, 0x24, 0x0c, 0x01, 0xd4, 0x03, 0x11, 0xb2, 0xb8, 0x4f, 0x00, 0x74,
+    0x48, 0x00, 0xfc, 0x0e, 0x17, 0xcb, 0x84, 0x07, 0x00, 0x80, 0x1a, 0x00, 0x50, 0x66, 0x02, 0x30,
+    0x65, 0x11, 0xb4, 0x30, 0x56, 0x50, 0x01, 0x5a, 0xc8, 0xff, 0x01, 0x64, 0x00, 0x00, 0x60, 0x05,
+    0x00, 0xa8, 0x05, 0x00, 0x4c, 0x02, 0x00, 0xfc, 0x00, 0x04, 0x98, 0x00, 0x00, 0x08, 0x00, 0x0f,
+    0x04, 0x00, 0x09, 0x00, 0x38, 0x01, 0x00, 0x5c, 0x01, 0x00, 0xb8, 0x0a, 0x00, 0xdc, 0x0a, 0x00,
+    0xf8, 0x17, 0x00, 0xec, 0x4c, 0x00, 0xd8, 0x07, 0x00, 0x04, 0x27, 0x00, 0x78, 0x11, 0x01, 0x98,
+    0x00, 0x02, 0xa8, 0x4d, 0x00, 0xa0, 0x0f, 0x0f, 0x18, 0x2d, 0x0e, 0x0f, 0x84, 0x07, 0x3e, 0x42,
+    0xb3, 0xff, 0x14, 0x13, 0x10, 0x51, 0x00, 0x74, 0x73, 0x00, 0x90, 0x17, 0x00, 0x0c, 0x5d, 0x00,
+    0xbc, 0x52, 0x00, 0xf0, 0x53, 0x00, 0xf8, 0x6b, 0x05, 0x84, 0x07, 0x00, 0x18, 0x06, 0x00, 0xa4,
+    0x0d, 0x00, 0x84, 0x07, 0x00, 0x6c, 0x01, 0x00, 0x14, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x04, 0x01,
+    0x09, 0x00, 0x1c, 0x00, 0x05, 0x08, 0x01, 0x03, 0x5c, 0x37, 0x00, 0x70, 0x07, 0x00, 0xc8, 0x10,
+    0x00, 0xe8, 0x06, 0x00, 0x30, 0x09, 0x00, 0xc0, 0x01, 0x00, 0xb4, 0x01, 0x00, 0xbc, 0x01, 0x00,
+    0x60, 0x01, 0x00, 0xf4, 0x01, 0x00, 0x34, 0x00, 0x05, 0x04, 0x00, 0x0f, 0x20, 0x04, 0x1c, 0x08,
+    0x40, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x98, 0x02, 0x00, 0x88, 0x01, 0x00, 0x08,
+    0x09, 0x00, 0x80, 0x12, 0x00, 0x8c, 0x10, 0x00, 0xc8, 0x09, 0x00, 0xe0, 0x01, 0x00, 0x0c, 0x08,
+    0x00, 0x54, 0x0a, 0x00, 0x80, 0x00, 0x00, 0x48, 0x04, 0x00, 0xd4, 0x09, 0x03, 0x14, 0x04, 0x01,
+    0x74, 0x08, 0x00, 0xe4, 0x02, 0x01, 0xa0, 0x25, 0x0a, 0x08, 0x04, 0x01, 0x14, 0x13, 0x0f, 0x84,
+    0x07, 0x02, 0x07, 0x6c, 0x04, 0x00, 0x00, 0x01, 0x0f, 0x04, 0x00, 0x0d, 0x01, 0xe8, 0x00, 0x08,
+    0x84, 0x07, 0x12, 0xce, 0x58, 0x16, 0x41, 0x00, 0xb3, 0xff, 0x01, 0x20, 0x02, 0x00, 0x78, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x80, 0x00, 0x00, 0x98, 0x04, 0x00, 0x80, 0x16, 0x11, 0xb5, 0xac, 0x20,
+    0x01, 0xac, 0x4c, 0x00, 0xb0, 0x28, 0x00, 0xd8, 0x00, 0x00, 0xd8, 0x0f, 0x00, 0xc4, 0x00, 0x00,
+    0x78, 0x02, 0x01, 0x58, 0x00, 0x0f, 0x84, 0x07, 0x84, 0x00, 0x9c, 0x00, 0x00, 0xec, 0x01, 0x00,
+    0xf4, 0x08, 0x00, 0x18, 0x0a, 0x00, 0xa4, 0x32, 0x00, 0xd4, 0x0b, 0x00, 0x70, 0x29, 0x00, 0x7c,
+    0x12, 0x01, 0xf8, 0x00, 0x02, 0x98, 0x35, 0x00, 0x80, 0x17, 0x00, 0x24, 0x58, 0x00, 0x5c, 0x07,
+    0x0f, 0x04, 0x00, 0x15, 0x0f, 0x84, 0x07, 0x9e, 0x04, 0x24, 0x02, 0x00, 0xa8, 0x02, 0x00, 0x18,
+    0x01, 0x00, 0x60, 0x03, 0x00, 0xf0, 0x04, 0x00, 0x34, 0x0a, 0x00, 0x58, 0x0e, 0x00, 0xf8, 0x03,
+    0x22, 0x67, 0xcd, 0x9c, 0x47, 0x00, 0xa0, 0x02, 0x00, 0x24, 0x00, 0x04, 0x34, 0x00, 0x0f, 0x08,
+    0x00, 0x21, 0x00, 0xd8, 0x0c, 0x00, 0x44, 0x00, 0x00, 0x74, 0x34, 0x00, 0x08, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x34, 0x02, 0x0f, 0x4c, 0x00, 0x21, 0x00, 0xcc, 0x01, 0x00, 0x74, 0x03, 0x00, 0x78,
+    0x02, 0x00, 0x44, 0x0a, 0x00, 0x2c, 0x22, 0x00, 0xb8, 0x23, 0x00, 0x8c, 0x07, 0x00, 0xac, 0x05,
+    0x0f, 0xb0, 0x00, 0x09, 0x04, 0xf0, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x04, 0x04, 0x00, 0x90, 0x09,
+    0x00, 0x30, 0x1a, 0x01, 0x04, 0x02, 0x04, 0xf0, 0x02, 0x00, 0xfc, 0x02, 0x08, 0x04, 0x00, 0x03,
+    0x18, 0x00, 0x0f, 0x84, 0x07, 0x9d, 0x00, 0xf4, 0x20, 0x00, 0xc0, 0x21, 0x00, 0x6c, 0x27, 0x00,
+    0xb0, 0x16, 0x00, 0xc4, 0x0f, 0x00, 0x0c, 0x05, 0x00, 0x84, 0x07, 0x00, 0x80, 0x01, 0x00, 0xa8,
+    0x04, 0x00, 0x48, 0x01, 0x0f, 0x84, 0x01, 0x0d, 0x00, 0x2c, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x40,
+    0x10, 0x00, 0x78, 0x0b, 0x00, 0xd0, 0x26, 0x00, 0xdc, 0x1c, 0x00, 0x28, 0x0e, 0x00, 0x6c, 0x01,
+    0x00, 0x54, 0x01, 0x00, 0x4c, 0x00, 0x0f, 0x48, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x1d, 0x00, 0x78,
+    0x00, 0x00, 0x30, 0x02, 0x00, 0x7c, 0x00, 0x00, 0xac, 0x01, 0x00, 0xc4, 0x0c, 0x00, 0x18, 0x0a,
+    0x00, 0x6c, 0x09, 0x22, 0x7b, 0xd7, 0xa8, 0x49, 0x00, 0x54, 0x09, 0x00, 0x80, 0x00, 0x00, 0x4c,
+    0x0d, 0x00, 0xd8, 0x00, 0x00, 0x84, 0x09, 0x00, 0xc0, 0x02, 0x00, 0xc8, 0x11, 0x01, 0x38, 0x0c,
+    0x02, 0xa0, 0x25, 0x00, 0x60, 0x27, 0x00, 0x6c, 0x15, 0x00, 0x7c, 0x79, 0x00, 0x68, 0x1a, 0x00,
+    0x64, 0x2a, 0x00, 0x6c, 0x1b, 0x00, 0x40, 0x5d, 0x02, 0x70, 0x06, 0x12, 0xb5, 0xb4, 0x29, 0x00,
+    0x00, 0x0f, 0x00, 0x68, 0x1f, 0x00, 0xd8, 0x00, 0x00, 0x54, 0x00, 0x00, 0x84, 0x00, 0x00, 0x60,
+    0x00, 0x0f, 0xbc, 0x00, 0x15, 0x00, 0x9c, 0x02, 0x00, 0x30, 0x00, 0x00, 0xc4, 0x0f, 0x00, 0xa0,
+    0x0c, 0x00, 0x9c, 0x0f, 0x00, 0x20, 0x0a, 0x00, 0x58, 0x2c, 0x21, 0x19, 0xb7, 0xe0, 0x41, 0x22,
+    0x08, 0x07, 0x68, 0x14, 0x00, 0x70, 0x20, 0x00, 0x54, 0x51, 0x00, 0x74, 0x32, 0x00, 0x24, 0x35,
+    0x05, 0x20, 0x3c, 0x00, 0xa4, 0x43, 0x01, 0x08, 0x15, 0x12, 0xb2, 0x94, 0x2c, 0x00, 0x8c, 0x03,
+    0x0f, 0x08, 0x0f, 0x35, 0x00, 0x10, 0x02, 0x61, 0x00, 0xb3, 0xff, 0x07, 0x03, 0xb5, 0x30, 0x66,
+    0x00, 0x3c, 0x50, 0x31, 0x4a, 0x50, 0xbc, 0x4c, 0x4a, 0x00, 0xa4, 0x69, 0x00, 0x18, 0x5e, 0x01,
+    0x94, 0x47, 0x00, 0x08, 0x12, 0x00, 0x28, 0x14, 0x00, 0xc8, 0x25, 0x00, 0x84, 0x10, 0x00, 0x08,
+    0x09, 0x00, 0x70, 0x03, 0x00, 0x30, 0x02, 0x00, 0xe4, 0x00, 0x0f, 0x10, 0x01, 0x0d, 0x00, 0x24,
+    0x00, 0x00, 0x08, 0x01, 0x00, 0x70, 0x05, 0x00, 0xbc, 0x10, 0x00, 0xec, 0x0a, 0x00, 0x90, 0x1d,
+    0x00, 0x00, 0x0f, 0x00, 0x88, 0x0e, 0x01, 0x60, 0x01, 0x12, 0xf3, 0x0c, 0x16, 0x00, 0x28, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x18, 0x04, 0x04, 0x04, 0x00, 0x01, 0x78, 0x01, 0x0f, 0x88, 0x07, 0x1c,
+    0x0c, 0x94, 0x00, 0x00, 0x60, 0x04, 0x00, 0x48, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x90, 0x01, 0x00,
+    0x48, 0x08, 0x00, 0xb8, 0x15, 0x00, 0xa0, 0x2e, 0x00, 0xdc, 0x04, 0x00, 0xec, 0x04, 0x00, 0x60,
+    0x17, 0x00, 0x74, 0x00, 0x00, 0x28, 0x00, 0x00, 0x10, 0x07, 0x00, 0x68, 0x02, 0x0f, 0x14, 0x04,
+    0x06, 0x03, 0x08, 0x04, 0x22, 0x2f, 0xba, 0x30, 0x0f, 0x00, 0x8c, 0x19, 0x04, 0x40, 0x00, 0x0c,
+    0x7c, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x00, 0x20, 0x01, 0x00, 0x4c, 0x01, 0x00, 0x54, 0x01, 0x00,
+    0x84, 0x0f, 0x00, 0xb0, 0x56, 0x00, 0x28, 0x02, 0x00, 0xc0, 0x11, 0x00, 0xfc, 0x01, 0x18, 0x07,
+    0x80, 0x04, 0x12, 0xb5, 0xb8, 0x01, 0x00, 0x20, 0x17, 0x00, 0xe0, 0x2d, 0x00, 0x4c, 0x0b, 0x00,
+    0x48, 0x08, 0x00, 0x94, 0x01, 0x00, 0x40, 0x0d, 0x00, 0x6c, 0x10, 0x00, 0xc0, 0x00, 0x0f, 0x74,
+    0x00, 0x0d, 0x0f, 0x20, 0x00, 0x71, 0x04, 0xe8, 0x01, 0x00, 0xf8, 0x00, 0x00, 0xa4, 0x10, 0x00,
+    0xc4, 0x23, 0x00, 0xd0, 0x03, 0x00, 0x78, 0x10, 0x01, 0x84, 0x07, 0x91, 0xb3, 0xff, 0x3b, 0x41,
+    0xba, 0xff, 0x7b, 0x84, 0xca, 0x9c, 0x11, 0x00, 0x14, 0x75, 0x0f, 0x84, 0x07, 0xce, 0x00, 0x98,
+    0x01, 0x00, 0x10, 0x02, 0x00, 0x08, 0x00, 0x00, 0x88, 0x07, 0x00, 0xbc, 0x0b, 0x00, 0xec, 0x04,
+    0x00, 0xd8, 0x06, 0x00, 0x30, 0x03, 0x00, 0xb4, 0x05, 0x00, 0x20, 0x0a, 0x00, 0xa0, 0x07, 0x00,
+    0xb8, 0x06, 0x00, 0xb0, 0x02, 0x00, 0x2c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0x64, 0x02, 0x00,
+    0x5c, 0x00, 0x00, 0x78, 0x01, 0x00, 0x74, 0x01, 0x00, 0xb8, 0x0c, 0x00, 0x78, 0x01, 0x00, 0x2c,
+    0x05, 0x00, 0xf0, 0x02, 0x00, 0x38, 0x02, 0x04, 0x24, 0x00, 0x0f, 0x50, 0x00, 0x11, 0x04, 0x24,
+    0x00, 0x00, 0x54, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xb0, 0x00, 0x00, 0xc0, 0x0f, 0x04, 0xb0, 0x00,
+    0x00, 0x20, 0x06, 0x00, 0x64, 0x0b, 0x00, 0x04, 0x3d, 0x0f, 0xb0, 0x00, 0x09, 0x00, 0x30, 0x06,
+    0x00, 0x94, 0x00, 0x00, 0x3c, 0x3d, 0x00, 0x48, 0x06, 0x00, 0x9c, 0x06, 0x00, 0xa0, 0x35, 0x01,
+    0x04, 0x02, 0x00, 0x68, 0x03, 0x0b, 0x00, 0x03, 0x01, 0xcc, 0x05, 0x12, 0xb4, 0x18, 0x2d, 0x00,
+    0x2c, 0x00, 0x00, 0x34, 0x00, 0x00, 0x44, 0x04, 0x00, 0x44, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x8c,
+    0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x04, 0x01, 0x00, 0xb8,
+    0x0a, 0x00, 0x98, 0x05, 0x00, 0x70, 0x1c, 0x00, 0x0c, 0x17, 0x00, 0x34, 0x06, 0x00, 0x8c, 0x0b,
+    0x00, 0x40, 0x00, 0x0f, 0x4c, 0x00, 0x11, 0x04, 0x24, 0x00, 0x00, 0x98, 0x06, 0x00, 0xac, 0x0d,
+    0x0f, 0x10, 0x1e, 0x09, 0x00, 0x44, 0x53, 0x00, 0x80, 0x1c, 0x00, 0x10, 0x48, 0x00, 0x50, 0x1d,
+    0x00, 0x14, 0x1c, 0x00, 0x00, 0x05, 0x00, 0x90, 0x04, 0x00, 0xbc, 0x00, 0x00, 0x98, 0x00, 0x00,
+    0x78, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0xa0, 0x01, 0x00, 0x64, 0x01, 0x00, 0xec, 0x00, 0x00,
+    0x18, 0x02, 0x00, 0xac, 0x00, 0x00, 0xfc, 0x26, 0x00, 0xa8, 0x06, 0x00, 0x20, 0x16, 0x00, 0x00,
+    0x09, 0x00, 0xbc, 0x00, 0x0f, 0x4c, 0x00, 0x11, 0x0f, 0x64, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x09,
+    0x00, 0x34, 0x01, 0x00, 0xf0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3c, 0x02, 0x00, 0xbc, 0x0c, 0x00,
+    0xc8, 0x00, 0x00, 0x58, 0x29, 0x00, 0xec, 0x01, 0x00, 0xc8, 0x0c, 0x00, 0x60, 0x05, 0x00, 0xa8,
+    0x0f, 0x00, 0x28, 0x00, 0x00, 0x60, 0x01, 0x00, 0x28, 0x08, 0x00, 0xa0, 0x00, 0x00, 0x90, 0x16,
+    0x01, 0xd0, 0x01, 0x42, 0xb2, 0xff, 0x2b, 0x2d, 0xfc, 0x1c, 0x00, 0xd0, 0x74, 0x00, 0x88, 0x64,
+    0x00, 0x28, 0x2d, 0x00, 0x04, 0x5c, 0x00, 0x0c, 0x2d, 0x00, 0x28, 0x60, 0x02, 0x84, 0x07, 0x12,
+    0xb4, 0x40, 0x54, 0x00, 0xf4, 0x02, 0x00, 0x2c, 0x13, 0x00, 0x58, 0x00, 0x00, 0x20, 0x01, 0x00,
+    0x04, 0x00, 0x0f, 0xa4, 0x00, 0x09, 0x08, 0x1c, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x34, 0x01, 0x00, 0x60, 0x04, 0x00, 0xb0, 0x00, 0x07, 0x5c, 0x02, 0x00, 0x58, 0x60, 0x00, 0xf0,
+    0x50, 0x00, 0x80, 0x3b, 0x00, 0x80, 0x0e, 0x00, 0x14, 0x25, 0x00, 0x9c, 0x40, 0x00, 0x28, 0x26,
+    0x00, 0x84, 0x07, 0x00, 0xd4, 0x4c, 0x00, 0x10, 0x1b, 0x09, 0xa4, 0x43, 0x0f, 0x84, 0x07, 0x39,
+    0x00, 0x20, 0x2f, 0x01, 0x18, 0x01, 0x0c, 0xe4, 0x02, 0x03, 0x10, 0x00, 0x00, 0x0c, 0x22, 0x00,
+    0x00, 0x0e, 0x00, 0x08, 0x1e, 0x00, 0x68, 0x01, 0x00, 0xd0, 0x08, 0x00, 0x78, 0x01, 0x01, 0x34,
+    0x16, 0x13, 0xf3, 0xb0, 0x18, 0x0f, 0x68, 0x0d, 0x0c, 0x0c, 0x08, 0x01, 0x00, 0x44, 0x04, 0x00,
+    0xb8, 0x2b, 0x00, 0xf4, 0x02, 0x00, 0x60, 0x2f, 0x00, 0x3c, 0x06, 0x00, 0x3c, 0x09, 0x00, 0xb4,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0xe0, 0x01, 0x04, 0x68, 0x02, 0x00, 0x20, 0x04, 0x00, 0xbc, 0x03,
+    0x00, 0xe0, 0x02, 0x00, 0xa0, 0x07, 0x00, 0x4c, 0x01, 0x0f, 0x84, 0x01, 0x19, 0x00, 0x30, 0x00,
+    0x08, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x7c, 0x0d, 0x00,
+    0xe0, 0x01, 0x00, 0xe8, 0x13, 0x00, 0x50, 0x3e, 0x22, 0x7e, 0xda, 0x8c, 0x04, 0x00, 0xac, 0x07,
+    0x22, 0xb1, 0xfa, 0x34, 0x13, 0x00, 0xb8, 0x01, 0x00, 0xe0, 0x03, 0x00, 0xb0, 0x00, 0x07, 0xb8,
+    0x01, 0x02, 0x1c, 0x16, 0x00, 0x1c, 0x04, 0x12, 0xb4, 0x10, 0x59, 0x00, 0xd8, 0x10, 0x04, 0x04,
+    0x03, 0x00, 0xb0, 0x00, 0x0f, 0x1c, 0x05, 0x1e, 0x03, 0x44, 0x01, 0x00, 0x08, 0x01, 0x00, 0xf8,
+    0x07, 0x00, 0x64, 0x01, 0x00, 0x6c, 0x01, 0x00, 0x9c, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x84, 0x01,
+    0x00, 0x08, 0x09, 0x00, 0x7c, 0x04, 0x22, 0x0b, 0xb6, 0x7c, 0x04, 0x00, 0x9c, 0x14, 0x00, 0x30,
+    0x0c, 0x00, 0x14, 0x09, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x08, 0x00, 0x24, 0x01, 0x00, 0xe0, 0x00,
+    0x00, 0x74, 0x01, 0x08, 0xf8, 0x00, 0x0f, 0x0c, 0x00, 0x89, 0x00, 0xf4, 0x01, 0x00, 0xa0, 0x00,
+    0x00, 0xe4, 0x01, 0x00, 0x68, 0x15, 0x00, 0xc4, 0x04, 0x05, 0x84, 0x07, 0x11, 0xb2, 0xa0, 0x60,
+    0x00, 0xbc, 0x43, 0x00, 0x9c, 0x32, 0x40, 0xb7, 0xc6, 0xe3, 0xff, 0xb4, 0x7c, 0x0f, 0x88, 0x07,
+    0x11, 0x0f, 0x08, 0x0f, 0xa6, 0x00, 0x0c, 0x01, 0x01, 0xc4, 0x01, 0x03, 0x84, 0x1b, 0x00, 0xb8,
+    0x0a, 0x00, 0x84, 0x04, 0x00, 0xbc, 0x0a, 0x00, 0x6c, 0x14, 0x00, 0xbc, 0x11, 0x00, 0xfc, 0x13,
+    0x00, 0x60, 0x0e, 0x00, 0x2c, 0x02, 0x00, 0xe8, 0x04, 0x04, 0x34, 0x00, 0x00, 0x08, 0x00, 0x0f,
+    0x04, 0x00, 0x09, 0x04, 0x58, 0x00, 0x00, 0xb8, 0x07, 0x00, 0xa8, 0x02, 0x00, 0x70, 0x01, 0x00,
+    0x6c, 0x02, 0x00, 0x20, 0x0c, 0x00, 0x6c, 0x03, 0x00, 0x18, 0x03, 0x00, 0x24, 0x00, 0x04, 0x94,
+    0x01, 0x0f, 0x4c, 0x00, 0x09, 0x08, 0x1c, 0x00, 0x04, 0x70, 0x02, 0x00, 0x58, 0x00, 0x00, 0x50,
+    0x06, 0x0c, 0xb0, 0x00, 0x00, 0xa4, 0x11, 0x00, 0xa4, 0x0a, 0x0f, 0xb0, 0x00, 0x01, 0x00, 0x3c,
+    0x00, 0x00, 0x08, 0x1d, 0x00, 0x50, 0x00, 0x00, 0xec, 0x00, 0x00, 0x0c, 0x0b, 0x00, 0x70, 0x03,
+    0x00, 0xb4, 0x36, 0x01, 0x9c, 0x04, 0x00, 0xf4, 0x11, 0x03, 0x90, 0x04, 0x01, 0x04, 0x03, 0x00,
+    0x0c, 0x00, 0x03, 0x7c, 0x03, 0x0f, 0x08, 0x0f, 0x96, 0x03, 0xb0, 0x00, 0x00, 0x60, 0x17, 0x00,
+    0x34, 0x4e, 0x00, 0xe4, 0x02, 0x00, 0x48, 0x0d, 0x00, 0x34, 0x07, 0x00, 0x88, 0x01, 0x00, 0xf0,
+    0x04, 0x00, 0xf8, 0x04, 0x00, 0x0c, 0x01, 0x00, 0x08, 0x01, 0x0c, 0x04, 0x00, 0x00, 0x94, 0x01,
+    0x00, 0x14, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x30, 0x00, 0x00, 0x18, 0x0e, 0x00, 0x1c, 0x0c, 0x00,
+    0x0c, 0x02, 0x00, 0x08, 0x00, 0x00, 0x34, 0x01, 0x00, 0xec, 0x06, 0x00, 0x1c, 0x00, 0x00, 0x4c,
+    0x00, 0x00, 0x2c, 0x00, 0x0f, 0x4c, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x25, 0x00,
+    0x88, 0x00, 0x04, 0xac, 0x01, 0x00, 0x1c, 0x05, 0x00, 0x3c, 0x02, 0x00, 0x88, 0x1e, 0x00, 0x90,
+    0x1e, 0x00, 0xc4, 0x12, 0x08, 0x84, 0x07, 0x00, 0x88, 0x07, 0x00, 0x8c, 0x00, 0x00, 0xe0, 0x05,
+    0x00, 0x84, 0x07, 0x07, 0xf8, 0x4f, 0x00, 0x5c, 0x15, 0x31, 0x4f, 0x56, 0xbe, 0xc0, 0x3f, 0x00,
+    0x88, 0x34, 0x31, 0x88, 0x93, 0xce, 0x8c, 0x78, 0x00, 0x88, 0x29, 0x20, 0x18, 0x15, 0xe0, 0x01,
+    0x00, 0xe4, 0x13, 0x12, 0xb4, 0xe8, 0x56, 0x00, 0xa4, 0x05, 0x00, 0xac, 0x05, 0x00, 0xfc, 0x00,
+    0x00, 0x7c, 0x00, 0x0f, 0x9c, 0x02, 0x19, 0x0c, 0xb0, 0x00, 0x00, 0x84, 0x07, 0x00, 0xb0, 0x00,
+    0x00, 0x88, 0x01, 0x01, 0x04, 0x1e, 0x11, 0xb3, 0xfc, 0x51, 0x00, 0x80, 0x0f, 0x00, 0xb0, 0x6b,
+    0x00, 0x0c, 0x58, 0x00, 0xac, 0x2d, 0x04, 0x44, 0x44, 0x00, 0x58, 0x75, 0x00, 0x04, 0x58, 0x0f,
+    0x84, 0x07, 0x4a, 0x2f, 0x0a, 0xb6, 0xec, 0x14, 0x04, 0x00, 0x34, 0x02, 0x03, 0xfc, 0x02, 0x21,
+    0x30, 0xbb, 0xd0, 0x17, 0x01, 0xc4, 0x5e, 0x00, 0xec, 0x01, 0x00, 0x80, 0x09, 0x00, 0x2c, 0x03,
+    0x00, 0x70, 0x03, 0x00, 0xcc, 0x01, 0x0f, 0xec, 0x01, 0x0d, 0x08, 0x08, 0x01, 0x00, 0xa0, 0x03,
+    0x00, 0x90, 0x17, 0x00, 0x08, 0x01, 0x00, 0x98, 0x2d, 0x00, 0x9c, 0x01, 0x00, 0x24, 0x0b, 0x00,
+    0x60, 0x01, 0x00, 0xb4, 0x01, 0x00, 0x04, 0x00, 0x00, 0xec, 0x09, 0x00, 0x50, 0x06, 0x00, 0x20,
+    0x0a, 0x00, 0x2c, 0x00, 0x00, 0xec, 0x09, 0x00, 0xf4, 0x07, 0x00, 0xd0, 0x01, 0x01, 0x4c, 0x00,
+    0x03, 0xb0, 0x06, 0x00, 0x7c, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0xc0, 0x01, 0x00, 0xc8, 0x01,
+    0x00, 0xbc, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xbc, 0x09, 0x00, 0x04, 0x22, 0x00, 0x38, 0x13, 0x00,
+    0x14, 0x03, 0x00, 0x84, 0x07, 0x00, 0x54, 0x00, 0x00, 0xa8, 0x34, 0x00, 0x6c, 0x00, 0x00, 0xe8,
+    0x00, 0x00, 0xf4, 0x00, 0x0f, 0x14, 0x04, 0x02, 0x00, 0x24, 0x01, 0x12, 0xb5, 0xac, 0x47, 0x00,
+    0x90, 0x1d, 0x22, 0x5c, 0xc8, 0x9c, 0x4f, 0x00, 0x6c, 0x04, 0x00, 0xb0, 0x00, 0x0f, 0x1c, 0x05,
+    0x1a, 0x03, 0xe4, 0x0f, 0x00, 0x98, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x02, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x48, 0x00, 0xe0, 0x07, 0x01, 0x94, 0x06, 0x00, 0x9c, 0x02, 0x30, 0xb3, 0xff, 0x00,
+    0x04, 0x3c, 0x00, 0x80, 0x07, 0x00, 0xb4, 0x0b, 0x00, 0x84, 0x03, 0x00, 0xc8, 0x17, 0x00, 0xdc,
+    0x24, 0x00, 0x20, 0x01, 0x00, 0xbc, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x0c, 0x00,
+    0x0f, 0x04, 0x00, 0x91, 0x00, 0x90, 0x01, 0x00, 0xb0, 0x00, 0x00, 0x88, 0x0d, 0x00, 0xcc, 0x00,
+    0x00, 0xa0, 0x04, 0x05, 0x30, 0x30, 0x11, 0xb2, 0x94, 0x6a, 0x00, 0xa8, 0x6d, 0x00, 0xc4, 0x21,
+    0x00, 0xa4, 0x20, 0x00, 0xc8, 0x21, 0x0f, 0xac, 0x34, 0x11, 0x0f, 0x84, 0x07, 0xaa, 0x04, 0xb8,
+    0x01, 0x00, 0x98, 0x05, 0x00, 0x14, 0x02, 0x00, 0x4c, 0x02, 0x00, 0x60, 0x05, 0x00, 0x6c, 0x09,
+    0x00, 0x94, 0x04, 0x00, 0x44, 0x2c, 0x00, 0xf4, 0x04, 0x00, 0x44, 0x07, 0x01, 0xf8, 0x0c, 0x00,
+    0xc0, 0x23, 0x0f, 0x18, 0x03, 0x14, 0x00, 0x60, 0x03, 0x00, 0xf0, 0x08, 0x00, 0x08, 0x12, 0x00,
+    0x88, 0x0d, 0x00, 0x48, 0x02, 0x00, 0x08, 0x03, 0x00, 0x7c, 0x01, 0x00, 0x48, 0x11, 0x00, 0x20,
+    0x00, 0x04, 0x80, 0x00, 0x0f, 0x08, 0x00, 0x1d, 0x0c, 0xb0, 0x00, 0x00, 0xa0, 0x00, 0x04, 0xb0,
+    0x00, 0x00, 0xb8, 0x1c, 0x00, 0xc0, 0x00, 0x00, 0x64, 0x00, 0x00, 0xe8, 0x0a, 0x00, 0xf4, 0x01,
+    0x04, 0x60, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x14, 0x00, 0x00, 0x20, 0x04, 0x00, 0xf0, 0x03, 0x00,
+    0x94, 0x00, 0x00, 0x40, 0x38, 0x01, 0xf0, 0x76, 0x12, 0xb5, 0x9c, 0x53, 0x05, 0x80, 0x07, 0x00,
+    0x08, 0x03, 0x00, 0x7c, 0x03, 0x0f, 0x08, 0x0f, 0x99, 0x03, 0xb0, 0x00, 0x00, 0xbc, 0x21, 0x00,
+    0xe8, 0x51, 0x00, 0xb8, 0x03, 0x00, 0xa8, 0x08, 0x00, 0x0c, 0x01, 0x00, 0xfc, 0x04, 0x0f, 0x74,
+    0x01, 0x0d, 0x00, 0x2c, 0x01, 0x00, 0x68, 0x05, 0x00, 0xe4, 0x03, 0x00, 0xe8, 0x06, 0x00, 0xc8,
+    0x1b, 0x00, 0x24, 0x01, 0x00, 0x50, 0x14, 0x00, 0x58, 0x06, 0x04, 0x28, 0x1d, 0x0f, 0x4c, 0x00,
+    0x11, 0x04, 0x74, 0x01, 0x0f, 0x08, 0x00, 0x21, 0x00, 0x84, 0x00, 0x01, 0xac, 0x01, 0x12, 0xf6,
+    0x54, 0x5b, 0x00, 0x84, 0x07, 0x00, 0x58, 0x0e, 0x00, 0x2c, 0x0c, 0x00, 0x44, 0x02, 0x00, 0x9c,
+    0x00, 0x00, 0xb0, 0x0e, 0x00, 0xc8, 0x05, 0x00, 0x28, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x84, 0x07,
+    0x00, 0x28, 0x0c, 0x00, 0x7c, 0x08, 0x00, 0xc8, 0x15, 0x61, 0x00, 0xb4, 0xff, 0x0f, 0x14, 0xb6,
+    0x38, 0x77, 0x00, 0x10, 0x5a, 0x00, 0x24, 0x2d, 0x00, 0x40, 0x70, 0x00, 0x84, 0x63, 0x00, 0x78,
+    0x15, 0x11, 0x0a, 0xcc, 0x64, 0x12, 0xb4, 0xf0, 0x53, 0x00, 0xdc, 0x07, 0x00, 0xe8, 0x0f, 0x00,
+    0xac, 0x05, 0x00, 0x58, 0x00, 0x01, 0x08, 0x01, 0x0f, 0xe8, 0x02, 0x14, 0x08, 0xe0, 0x00, 0x00,
+    0x44, 0x03, 0x00, 0x40, 0x03, 0x00, 0xb0, 0x00, 0x00, 0x7c, 0x06, 0x01, 0xe0, 0x09, 0x02, 0xe8,
+    0x07, 0x00, 0x30, 0x35, 0x00, 0x68, 0x50, 0x00, 0x58, 0x04, 0x00, 0x98, 0x1e, 0x08, 0xe0, 0x0b,
+    0x00, 0x90, 0x07, 0x00, 0xac, 0x0f, 0x00, 0x74, 0x6d, 0x0f, 0x08, 0x0f, 0x63, 0x03, 0x84, 0x07,
+    0x00, 0x50, 0x3b, 0x00, 0xac, 0x11, 0x00, 0x88, 0x0b, 0x00, 0xc8, 0x00, 0x00, 0x10, 0x04, 0x00,
+    0xd4, 0x00, 0x00, 0x70, 0x03, 0x08, 0xe8, 0x00, 0x0f, 0x0c, 0x00, 0x0d, 0x00, 0x34, 0x00, 0x00,
+    0xe4, 0x06, 0x00, 0x9c, 0x12, 0x00, 0x98, 0x43, 0x00, 0x44, 0x15, 0x00, 0xa0, 0x03, 0x01, 0xb8,
+    0x01, 0x00, 0x54, 0x0f, 0x03, 0x5c, 0x01, 0x00, 0x60, 0x00, 0x00, 0x14, 0x00, 0x00, 0x58, 0x0e,
+    0x00, 0xe4, 0x18, 0x00, 0x84, 0x13, 0x00, 0x7c, 0x00, 0x00, 0x78, 0x09, 0x00, 0x44, 0x00, 0x0f,
+    0x68, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x09, 0x04, 0xc4, 0x01, 0x00, 0xac, 0x02, 0x00, 0x34, 0x13,
+    0x00, 0xe0, 0x01, 0x00, 0x4c, 0x19, 0x00, 0x64, 0x07, 0x00, 0x50, 0x0a, 0x00, 0x0c, 0x0c, 0x00,
+    0x64, 0x00, 0x00, 0x40, 0x02, 0x0f, 0x14, 0x04, 0x15, 0x00, 0xdc, 0x19, 0x00, 0xc8, 0x39, 0x00,
+    0xec, 0x46, 0x00, 0x8c, 0x02, 0x00, 0x6c, 0x04, 0x04, 0xd0, 0x04, 0x00, 0x44, 0x00, 0x00, 0x74,
+    0x00, 0x0f, 0x94, 0x00, 0x09, 0x08, 0x1c, 0x00, 0x00, 0x54, 0x01, 0x00, 0x80, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x6c, 0x01, 0x00, 0x54, 0x2a, 0x00, 0x38, 0x3d, 0x00, 0x5c, 0x42, 0x00, 0x04, 0x0f,
+    0x00, 0xbc, 0x09, 0x00, 0x30, 0x35, 0x00, 0x94, 0x10, 0x00, 0xbc, 0x00, 0x00, 0xe0, 0x02, 0x00,
+    0xb8, 0x04, 0x00, 0xa0, 0x02, 0x0f, 0xc8, 0x03, 0x0d, 0x08, 0x68, 0x00, 0x0f, 0x0c, 0x00, 0x79,
+    0x00, 0x6c, 0x01, 0x00, 0x90, 0x00, 0x00, 0x18, 0x06, 0x00, 0x78, 0x09, 0x00, 0x58, 0x04, 0x00,
+    0x0c, 0x29, 0x00, 0x94, 0x30, 0x61, 0x00, 0xb5, 0xff, 0x14, 0x19, 0xb6, 0x14, 0x3a, 0x00, 0x10,
+    0x2e, 0x00, 0x20, 0x8f, 0x00, 0x38, 0x55, 0x00, 0x58, 0x8a, 0x08, 0x2c, 0x03, 0x0f, 0x0c, 0x00,
+    0x01, 0x0f, 0x84, 0x07, 0x5a, 0x00, 0x9c, 0x04, 0x0f, 0x04, 0x00, 0x05, 0x00, 0xdc, 0x00, 0x0f,
+    0x04, 0x00, 0x29, 0x04, 0x40, 0x02, 0x00, 0x14, 0x02, 0x00, 0x38, 0x07, 0x00, 0xb8, 0x0a, 0x00,
+    0xd4, 0x52, 0x00, 0x44, 0x03, 0x00, 0xa4, 0x11, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0x04, 0x48,
+    0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x20, 0x02, 0x00, 0x14, 0x05, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x74, 0x0a, 0x00, 0xc8, 0x15, 0x00, 0x1c, 0x05, 0x00, 0x98, 0x04,
+    0x00, 0x18, 0x06, 0x00, 0xe4, 0x16, 0x00, 0x68, 0x03, 0x00, 0x28, 0x00, 0x00, 0x54, 0x11, 0x0f,
+    0x48, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x0d, 0x00, 0xb0, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x44, 0x00,
+    0x00, 0x58, 0x19, 0x00, 0x10, 0x03, 0x00, 0xb0, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x30, 0x06, 0x00,
+    0x60, 0x00, 0x00, 0xe8, 0x02, 0x08, 0xb0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2c, 0x03, 0x00, 0xe8,
+    0x38, 0x00, 0xe4, 0x00, 0x00, 0x3c, 0x39, 0x00, 0x64, 0x28, 0x00, 0xdc, 0x0a, 0x00, 0xbc, 0x15,
+    0x00, 0xa4, 0x32, 0x0f, 0x84, 0x07, 0xae, 0x12, 0xb3, 0xd0, 0x62, 0x00, 0xb4, 0x06, 0x00, 0x8c,
+    0x22, 0x00, 0x68, 0x0c, 0x00, 0x94, 0x01, 0x00, 0xfc, 0x00, 0x0f, 0x54, 0x01, 0x0d, 0x00, 0x2c,
+    0x01, 0x00, 0x28, 0x00, 0x00, 0x04, 0x02, 0x00, 0x3c, 0x0f, 0x00, 0x24, 0x03, 0x00, 0xe0, 0x5a,
+    0x00, 0x8c, 0x09, 0x00, 0xac, 0x0b, 0x00, 0xb8, 0x0b, 0x00, 0x54, 0x01, 0x00, 0x24, 0x00, 0x0f,
+    0x4c, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x0d, 0x00, 0xbc, 0x01, 0x0f, 0x04, 0x00, 0x06, 0x00, 0x2c,
+    0x2b, 0x12, 0xf9, 0xac, 0x01, 0x04, 0x8c, 0x16, 0x00, 0xa8, 0x01, 0x00, 0xf8, 0x04, 0x00, 0x68,
+    0x07, 0x00, 0xb8, 0x05, 0x00, 0x8c, 0x04, 0x00, 0x58, 0x0b, 0x00, 0xb4, 0x00, 0x04, 0xd8, 0x13,
+    0x00, 0x9c, 0x18, 0x00, 0xcc, 0x05, 0x00, 0x58, 0x23, 0x00, 0x80, 0x78, 0xe1, 0x1d, 0xb7, 0xff,
+    0x06, 0x08, 0xb5, 0xff, 0x0d, 0x09, 0xb5, 0xff, 0x11, 0x12, 0xb6, 0x10, 0x77, 0x71, 0x0c, 0x08,
+    0xb5, 0xff, 0x05, 0x0a, 0xb5, 0x98, 0x79, 0x01, 0x18, 0x72, 0x00, 0xe0, 0x00, 0x00, 0x0c, 0x14,
+    0x00, 0x38, 0x15, 0x00, 0x98, 0x05, 0x00, 0xb4, 0x05, 0x00, 0xe0, 0x00, 0x00, 0x04, 0x00, 0x0f,
+    0xc4, 0x00, 0x0d, 0x04, 0x20, 0x00, 0x00, 0x4c, 0x05, 0x00, 0xdc, 0x0b, 0x00, 0x24, 0x41, 0x00,
+    0x38, 0x01, 0x00, 0x58, 0x02, 0x00, 0x70, 0x22, 0x00, 0x58, 0x1d, 0x00, 0x4c, 0x05, 0x21, 0x00,
+    0xb3, 0x58, 0x8c, 0x00, 0x90, 0x90, 0x00, 0xa8, 0x61, 0x0c, 0x48, 0x04, 0x0f, 0x84, 0x07, 0x76,
+    0x00, 0x08, 0x03, 0x00, 0x60, 0x01, 0x00, 0xa0, 0x03, 0x00, 0x58, 0x03, 0x01, 0xa0, 0x01, 0x03,
+    0x30, 0x07, 0x04, 0xec, 0x00, 0x0f, 0x08, 0x00, 0x09, 0x05, 0x08, 0x01, 0x12, 0xed, 0x58, 0x55,
+    0x00, 0x50, 0x13, 0x00, 0x48, 0x04, 0x00, 0x48, 0x02, 0x00, 0x98, 0x08, 0x00, 0xc4, 0x09, 0x00,
+    0x58, 0x00, 0x00, 0x64, 0x01, 0x00, 0xd4, 0x0b, 0x00, 0x1c, 0x07, 0x00, 0x00, 0x0f, 0x00, 0xe8,
+    0x09, 0x00, 0x14, 0x1d, 0x00, 0x38, 0x0a, 0x00, 0x70, 0x06, 0x00, 0x9c, 0x03, 0x00, 0xc4, 0x07,
+    0x00, 0x88, 0x02, 0x00, 0x54, 0x00, 0x0f, 0x74, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x05, 0x00, 0xc0,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3c, 0x0e, 0x00, 0xe0, 0x01, 0x00, 0x8c, 0x00,
+    0x00, 0x68, 0x26, 0x00, 0x94, 0x04, 0x04, 0xd0, 0x11, 0x00, 0x64, 0x00, 0x04, 0x90, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x38, 0x1e, 0x00, 0xa8, 0x04, 0x00, 0x80, 0x0e, 0x00, 0x00, 0x13, 0x00, 0x8c,
+    0x1d, 0x01, 0x14, 0x07, 0x00, 0xe0, 0x0a, 0x07, 0x98, 0x0b, 0x00, 0xa0, 0x1d, 0x00, 0x60, 0x1e,
+    0x00, 0x18, 0x03, 0x00, 0xdc, 0x1a, 0x00, 0x18, 0x03, 0x00, 0x8c, 0x02, 0x0f, 0x90, 0x00, 0x05,
+    0x0f, 0x18, 0x00, 0x01, 0x00, 0xa0, 0x00, 0x00, 0x64, 0x01, 0x00, 0x14, 0x01, 0x00, 0x74, 0x01,
+    0x00, 0x7c, 0x01, 0x00, 0x84, 0x01, 0x01, 0x70, 0x00, 0x12, 0xb1, 0x50, 0x58, 0x00, 0xb8, 0x0f,
+    0x00, 0xd8, 0x02, 0x00, 0x80, 0x25, 0x00, 0x2c, 0x05, 0x00, 0x34, 0x00, 0x0f, 0x4c, 0x00, 0x01,
+    0x0f, 0x14, 0x00, 0x29, 0x00, 0x84, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x0f, 0x70, 0x00, 0x21, 0x04,
+    0xbc, 0x00, 0x00, 0x74, 0x01, 0x00, 0x1c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x44, 0x01, 0x00, 0x1c,
+    0x06, 0x00, 0xdc, 0x61, 0x01, 0x38, 0x3c, 0x00, 0x68, 0x01, 0x11, 0xb4, 0x5c, 0x77, 0x00, 0xb4,
+    0x3e, 0x00, 0x34, 0x12, 0x00, 0xfc, 0x7c, 0x0c, 0x34, 0x03, 0x08, 0x10, 0x00, 0x0f, 0x84, 0x07,
+    0x52, 0x01, 0x20, 0x01, 0x03, 0xbc, 0x2a, 0x00, 0xe8, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x00, 0xe0,
+    0x00, 0x00, 0x28, 0x00, 0x0f, 0x1c, 0x01, 0x21, 0x00, 0x34, 0x00, 0x04, 0x54, 0x00, 0x00, 0xdc,
+    0x04, 0x00, 0x8c, 0x02, 0x00, 0x38, 0x03, 0x00, 0x18, 0x03, 0x00, 0xa0, 0x5c, 0x00, 0xcc, 0x05,
+    0x00, 0x80, 0x05, 0x00, 0x60, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x08, 0x00, 0x00, 0x34, 0x00, 0x08,
+    0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x05, 0x00, 0xd8, 0x09, 0x00, 0x20,
+    0x0a, 0x00, 0x64, 0x01, 0x00, 0x60, 0x03, 0x00, 0x2c, 0x4f, 0x00, 0xb0, 0x2a, 0x00, 0xd8, 0x02,
+    0x00, 0x24, 0x07, 0x00, 0xf8, 0x0a, 0x00, 0xac, 0x0e, 0x00, 0xf4, 0x04, 0x00, 0x80, 0x02, 0x00,
+    0x38, 0x00, 0x04, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x08, 0xb0, 0x00, 0x00,
+    0x24, 0x0a, 0x00, 0x44, 0x0b, 0x00, 0x6c, 0x12, 0x00, 0x7c, 0x06, 0x00, 0x80, 0x0b, 0x0f, 0x84,
+    0x07, 0x05, 0x00, 0x5c, 0x00, 0x00, 0x74, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x1d, 0x00, 0x70,
+    0x17, 0x00, 0xd4, 0x25, 0x00, 0xe4, 0x34, 0x01, 0xb8, 0x0c, 0x02, 0x04, 0x02, 0x09, 0x08, 0x1a,
+    0x00, 0x8c, 0x03, 0x00, 0x48, 0x08, 0x00, 0x8c, 0x08, 0x0f, 0x58, 0x00, 0x01, 0x00, 0x54, 0x00,
+    0x0f, 0x04, 0x00, 0x01, 0x00, 0xd4, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x74, 0x02, 0x00, 0x6c, 0x00,
+    0x00, 0x64, 0x0c, 0x00, 0x1c, 0x1b, 0x00, 0x14, 0x01, 0x00, 0x88, 0x0f, 0x00, 0x88, 0x04, 0x00,
+    0x38, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00,
+    0x44, 0x0a, 0x00, 0x3c, 0x01, 0x00, 0xc8, 0x11, 0x00, 0x70, 0x25, 0x01, 0xb0, 0x03, 0x00, 0xb4,
+    0x00, 0x00, 0x20, 0x04, 0x00, 0xd0, 0x0c, 0x12, 0xb2, 0x24, 0x57, 0x00, 0xb8, 0x01, 0x00, 0xb0,
+    0x00, 0x00, 0x0c, 0x09, 0x00, 0x58, 0x00, 0x01, 0xb8, 0x01, 0x0f, 0x50, 0x05, 0x0c, 0x00, 0x64,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x01, 0x00, 0x4c, 0x06, 0x00, 0xc0, 0x22, 0x00, 0x20, 0x03,
+    0x00, 0x54, 0x23, 0x00, 0x6c, 0x04, 0x00, 0xb0, 0x00, 0x00, 0xd4, 0x00, 0x01, 0x4c, 0x00, 0x03,
+    0x54, 0x13, 0x00, 0x5c, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x10, 0x01, 0x00, 0x44, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0xe4, 0x0e, 0x00, 0x58, 0x00, 0x00,
+    0x70, 0x01, 0x00, 0xc0, 0x05, 0x00, 0x18, 0x05, 0x00, 0xb0, 0x0e, 0x00, 0x98, 0x11, 0x05, 0x84,
+    0x07, 0x00, 0xac, 0x07, 0x12, 0xf8, 0x1c, 0x48, 0x00, 0xe8, 0x00, 0x00, 0x18, 0x00, 0x21, 0x83,
+    0xdc, 0xa4, 0x56, 0x01, 0xa0, 0x63, 0x00, 0xc8, 0x4f, 0x01, 0x54, 0x09, 0x00, 0x18, 0x01, 0x08,
+    0x04, 0x00, 0x03, 0x9c, 0x77, 0x00, 0x64, 0x1b, 0x00, 0xa0, 0x0d, 0x00, 0x28, 0x01, 0x00, 0x14,
+    0x14, 0x00, 0xe0, 0x00, 0x01, 0xe8, 0x04, 0x00, 0xf0, 0x11, 0x0f, 0xe0, 0x00, 0x10, 0x00, 0xc4,
+    0x00, 0x00, 0x7c, 0x05, 0x00, 0x14, 0x1c, 0x00, 0x00, 0x19, 0x00, 0x9c, 0x14, 0x00, 0xa0, 0x2d,
+    0x00, 0x6c, 0x0d, 0x00, 0xe0, 0x0b, 0x00, 0x98, 0x1f, 0x03, 0x84, 0x07, 0x00, 0x00, 0x17, 0x00,
+    0xfc, 0x38, 0x00, 0x7c, 0x5f, 0x08, 0x40, 0x04, 0x00, 0x0c, 0x00, 0x01, 0x84, 0x07, 0x21, 0xa1,
+    0xd4, 0x40, 0x99, 0x0f, 0x08, 0x0f, 0x56, 0x00, 0x00, 0x1e, 0x01, 0x1c, 0x01, 0x00, 0x3c, 0x02,
+    0x00, 0x1c, 0x01, 0x11, 0xb4, 0x6c, 0x76, 0x01, 0x88, 0x63, 0x00, 0x20, 0x05, 0x00, 0x98, 0x06,
+    0x00, 0xe8, 0x01, 0x00, 0xa0, 0x01, 0x00, 0x88, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x08, 0x08, 0x01,
+    0x00, 0xe0, 0x6e, 0x00, 0xdc, 0x02, 0x00, 0x6c, 0x0e, 0x00, 0x1c, 0x1a, 0x00, 0x40, 0x06, 0x00,
+    0x18, 0x01, 0x00, 0x54, 0x00, 0x00, 0x44, 0x04, 0x00, 0x0c, 0x03, 0x00, 0x18, 0x0a, 0x00, 0x68,
+    0x07, 0x00, 0x0c, 0x07, 0x04, 0x7c, 0x03, 0x00, 0x94, 0x14, 0x00, 0x04, 0x0e, 0x00, 0xc0, 0x03,
+    0x00, 0x38, 0x13, 0x00, 0x44, 0x00, 0x00, 0xb4, 0x07, 0x00, 0x30, 0x00, 0x00, 0x64, 0x01, 0x00,
+    0x64, 0x00, 0x0f, 0x84, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x01, 0x00, 0x6c, 0x02, 0x00, 0x80, 0x0a,
+    0x00, 0xd8, 0x01, 0x00, 0xe4, 0x10, 0x00, 0x54, 0x00, 0x00, 0x18, 0x08, 0x00, 0xf4, 0x03, 0x00,
+    0x7c, 0x00, 0x00, 0x98, 0x00, 0x00, 0x08, 0x08, 0x00, 0x20, 0x00, 0x00, 0x68, 0x00, 0x00, 0xf8,
+    0x07, 0x00, 0xf8, 0x02, 0x00, 0x20, 0x00, 0x00, 0x04, 0x28, 0x00, 0xfc, 0x02, 0x05, 0xd0, 0x2e,
+    0x00, 0x28, 0x01, 0x04, 0x64, 0x03, 0x12, 0xb3, 0x10, 0x0f, 0x00, 0xac, 0x00, 0x0f, 0xf0, 0x0b,
+    0x05, 0x0f, 0x90, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x6c,
+    0x01, 0x00, 0x20, 0x01, 0x00, 0x8c, 0x02, 0x00, 0xfc, 0x4a, 0x01, 0xd4, 0x03, 0x12, 0xb1, 0x70,
+    0x62, 0x00, 0x84, 0x07, 0x00, 0xb4, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x94, 0x0a, 0x00, 0x18, 0x03,
+    0x0f, 0x0c, 0x01, 0x21, 0x0c, 0x7c, 0x00, 0x00, 0x10, 0x00, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x84, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x34, 0x00, 0x01, 0x04, 0x00, 0x0f, 0x24, 0x03,
+    0x10, 0x00, 0x68, 0x00, 0x04, 0x04, 0x00, 0x00, 0x34, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xf0, 0x00,
+    0x00, 0x04, 0x02, 0x00, 0x68, 0x06, 0x21, 0x80, 0xda, 0xa4, 0x32, 0x10, 0x01, 0x40, 0x0d, 0x00,
+    0x68, 0x05, 0x01, 0x18, 0x1c, 0x51, 0xb2, 0xff, 0x28, 0x2c, 0xb7, 0xd0, 0x79, 0x00, 0xbc, 0x50,
+    0x00, 0x8c, 0x75, 0x00, 0x28, 0x03, 0x0f, 0x04, 0x00, 0x05, 0x0f, 0x84, 0x07, 0x52, 0x00, 0x7c,
+    0x01, 0x00, 0x88, 0x02, 0x00, 0x50, 0x02, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0xe4, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80,
+    0x05, 0x00, 0xd4, 0x06, 0x00, 0x58, 0x0e, 0x00, 0xcc, 0x0b, 0x00, 0xbc, 0x26, 0x04, 0x68, 0x02,
+    0x00, 0x7c, 0x00, 0x00, 0x24, 0x00, 0x0f, 0x60, 0x00, 0x01, 0x04, 0x18, 0x00, 0x00, 0x90, 0x04,
+    0x00, 0x40, 0x00, 0x00, 0x50, 0x0a, 0x00, 0xc8, 0x32, 0x00, 0x58, 0x03, 0x00, 0xe4, 0x20, 0x00,
+    0x58, 0x11, 0x00, 0x24, 0x15, 0x00, 0xb8, 0x2a, 0x00, 0x58, 0x02, 0x00, 0x70, 0x02, 0x00, 0xf0,
+    0x02, 0x00, 0x00, 0x03, 0x00, 0xb8, 0x00, 0x04, 0x40, 0x00, 0x0f, 0x5c, 0x00, 0x01, 0x0f, 0x14,
+    0x00, 0x01, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf4, 0x07, 0x00, 0x70, 0x00, 0x00, 0xf4,
+    0x21, 0x00, 0xd4, 0x0c, 0x00, 0x2c, 0x07, 0x00, 0xf4, 0x0a, 0x00, 0xbc, 0x05, 0x00, 0x14, 0x01,
+    0x00, 0x5c, 0x02, 0x0c, 0x40, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x14, 0x04, 0x00,
+    0x7c, 0x05, 0x00, 0x30, 0x04, 0x00, 0x50, 0x03, 0x00, 0xdc, 0x0a, 0x01, 0x00, 0x03, 0x04, 0x70,
+    0x03, 0x00, 0x08, 0x00, 0x0f, 0x8c, 0x16, 0x94, 0x01, 0x90, 0x75, 0x00, 0xb0, 0x00, 0x11, 0xb5,
+    0xe4, 0x48, 0x01, 0xec, 0x08, 0x00, 0x38, 0x07, 0x01, 0xa4, 0x0b, 0x00, 0xd8, 0x6a, 0x00, 0xc4,
+    0x09, 0x0f, 0x34, 0x03, 0x0c, 0x00, 0xb4, 0x04, 0x00, 0x2c, 0x01, 0x00, 0xc4, 0x01, 0x04, 0x2c,
+    0x12, 0x00, 0x1c, 0x03, 0x00, 0x58, 0x3f, 0x00, 0xc0, 0x04, 0x00, 0xac, 0x01, 0x00, 0x20, 0x00,
+    0x0f, 0x54, 0x01, 0x01, 0x00, 0x18, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0xec, 0x01, 0x00, 0x98,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0x88, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x4c,
+    0x00, 0x00, 0xc4, 0x0c, 0x00, 0x2c, 0x09, 0x00, 0x9c, 0x4b, 0x00, 0xd8, 0x01, 0x00, 0xa4, 0x24,
+    0x00, 0xf0, 0x39, 0x00, 0xb0, 0x04, 0x00, 0x2c, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0xd8, 0x03, 0x00, 0xa0, 0x08, 0x00, 0xd8, 0x09, 0x00, 0xc4, 0x20, 0x00, 0xd8,
+    0x13, 0x00, 0x08, 0x07, 0x01, 0x6c, 0x06, 0x03, 0x64, 0x06, 0x01, 0xdc, 0x01, 0x12, 0xb3, 0x54,
+    0x14, 0x00, 0x18, 0x0a, 0x00, 0xb8, 0x09, 0x00, 0xd0, 0x08, 0x00, 0x64, 0x00, 0x00, 0xc8, 0x0e,
+    0x00, 0x70, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x7c, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x2c, 0x01,
+    0x00, 0x7c, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x44, 0x15, 0x00, 0x64, 0x0d, 0x00,
+    0xac, 0x0f, 0x00, 0xf8, 0x38, 0x43, 0x22, 0xb8, 0xff, 0x03, 0xf0, 0x16, 0x31, 0x15, 0x16, 0xb6,
+    0x7c, 0x4d, 0x00, 0xd4, 0x6a, 0x3d, 0xbb, 0xca, 0xe5, 0x54, 0x71, 0x01, 0x84, 0x07, 0x1f, 0xa2,
+    0x84, 0x07, 0x5c, 0x01, 0x80, 0x07, 0x00, 0x54, 0x06, 0x00, 0x04, 0x00, 0x12, 0xb4, 0x7c, 0x1c,
+    0x00, 0xb8, 0x1d, 0x00, 0xa0, 0x44, 0x0c, 0x60, 0x01, 0x0f, 0x0c, 0x01, 0x09, 0x0c, 0x08, 0x01,
+    0x00, 0x28, 0x02, 0x00, 0x8c, 0x03, 0x00, 0x5c, 0x07, 0x00, 0xcc, 0x18, 0x00, 0x7c, 0x0a, 0x00,
+    0x60, 0x01, 0x00, 0xe4, 0x06, 0x00, 0x60, 0x01, 0x00, 0x08, 0x00, 0x00, 0x60, 0x00, 0x00, 0xa0,
+    0x0b, 0x00, 0x74, 0x03, 0x00, 0x94, 0x2e, 0x00, 0x7c, 0x05, 0x00, 0x3c, 0x1f, 0x00, 0x68, 0x45,
+    0x00, 0x3c, 0x01, 0x00, 0x78, 0x04, 0x00, 0x44, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x5c, 0x09, 0x00,
+    0x94, 0x01, 0x00, 0x6c, 0x01, 0x0f, 0x88, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x05, 0x00, 0x3c, 0x00,
+    0x04, 0x78, 0x00, 0x00, 0xc8, 0x06, 0x00, 0xfc, 0x07, 0x00, 0x7c, 0x00, 0x00, 0xfc, 0x10, 0x00,
+    0xb0, 0x01, 0x22, 0x85, 0xde, 0xc0, 0x10, 0x00, 0x40, 0x02, 0x00, 0x04, 0x00, 0x00, 0xe4, 0x02,
+    0x00, 0x14, 0x04, 0x00, 0x3c, 0x08, 0x00, 0x74, 0x02, 0x00, 0xe8, 0x0a, 0x00, 0xb0, 0x2c, 0x00,
+    0x30, 0x01, 0x05, 0x64, 0x03, 0x03, 0x50, 0x50, 0x00, 0x20, 0x00, 0x00, 0xc0, 0x09, 0x00, 0x00,
+    0x02, 0x00, 0x68, 0x00, 0x0f, 0x18, 0x03, 0x1d, 0x00, 0xd4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x8c,
+    0x04, 0x00, 0x40, 0x0a, 0x00, 0x68, 0x19, 0x01, 0x84, 0x07, 0x00, 0x94, 0x01, 0x03, 0x64, 0x00,
+    0x00, 0x7c, 0x0a, 0x00, 0x84, 0x0a, 0x00, 0xbc, 0x00, 0x04, 0x64, 0x00, 0x00, 0x74, 0x01, 0x0f,
+    0xf0, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x19, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x02,
+    0x0f, 0x04, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x00, 0xcc, 0x03, 0x0f, 0x70, 0x00, 0x19, 0x04, 0x2c,
+    0x00, 0x00, 0x6c, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x50, 0x1f, 0x00, 0xb0, 0x05, 0x00, 0xc0, 0x12,
+    0x00, 0xfc, 0x01, 0x01, 0xa4, 0x03, 0x11, 0xb2, 0xc0, 0x50, 0x00, 0x38, 0x46, 0x00, 0xcc, 0x6b,
+    0x0f, 0x08, 0x0f, 0x2a, 0x00, 0xe8, 0x07, 0x00, 0x74, 0x02, 0x00, 0x68, 0x01, 0x00, 0x04, 0x00,
+    0x04, 0x84, 0x00, 0x0f, 0x08, 0x00, 0x19, 0x00, 0xb0, 0x00, 0x00, 0x18, 0x07, 0x00, 0xd4, 0x1b,
+    0x00, 0x98, 0x13, 0x00, 0x30, 0x02, 0x00, 0xd4, 0x02, 0x00, 0x94, 0x01, 0x04, 0x0c, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x28, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x0f, 0xa8,
+    0x01, 0x1d, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x1c, 0x0a, 0x00, 0x0c,
+    0x0a, 0x04, 0xa8, 0x02, 0x00, 0x04, 0x02, 0x00, 0x98, 0x02, 0x00, 0x10, 0x03, 0x01, 0x64, 0x00,
+    0x12, 0xf5, 0x4c, 0x28, 0x00, 0x68, 0x00, 0x04, 0x04, 0x00, 0x04, 0x80, 0x02, 0x00, 0xc4, 0x02,
+    0x00, 0x3c, 0x03, 0x00, 0x84, 0x03, 0x00, 0xe8, 0x27, 0x00, 0xbc, 0x02, 0x00, 0x58, 0x01, 0x01,
+    0xc8, 0x02, 0x03, 0x24, 0x06, 0x00, 0x68, 0x37, 0x00, 0xe0, 0x14, 0x00, 0x2c, 0x05, 0x00, 0x54,
+    0x00, 0x00, 0x44, 0x00, 0x04, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0xac,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x90, 0x00, 0x01, 0x84, 0x07, 0x12, 0xd0, 0x64, 0x0e, 0x00, 0x18,
+    0x03, 0x00, 0xb8, 0x0f, 0x0f, 0x58, 0x00, 0x0d, 0x00, 0x3c, 0x00, 0x00, 0x48, 0x02, 0x00, 0x88,
+    0x07, 0x00, 0x40, 0x05, 0x00, 0x04, 0x02, 0x00, 0x7c, 0x30, 0x00, 0xac, 0x00, 0x01, 0x04, 0x00,
+    0x00, 0x08, 0x03, 0x00, 0xb0, 0x00, 0x0f, 0x84, 0x07, 0x80, 0x00, 0x00, 0x1f, 0x00, 0x60, 0x01,
+    0x00, 0x20, 0x04, 0x01, 0xac, 0x00, 0x03, 0x3c, 0x7c, 0x00, 0xec, 0x08, 0x00, 0x18, 0x2c, 0x00,
+    0x80, 0x1b, 0x00, 0xd8, 0x12, 0x00, 0x48, 0x07, 0x00, 0x18, 0x02, 0x00, 0xe8, 0x00, 0x00, 0xf0,
+    0x00, 0x0f, 0x58, 0x01, 0x09, 0x00, 0x38, 0x02, 0x00, 0xfc, 0x01, 0x00, 0xc0, 0x01, 0x00, 0x58,
+    0x39, 0x00, 0x4c, 0x05, 0x00, 0x14, 0x04, 0x00, 0x10, 0x0c, 0x00, 0x98, 0x0c, 0x00, 0x30, 0x09,
+    0x00, 0xe4, 0x06, 0x00, 0x44, 0x00, 0x0f, 0x4c, 0x00, 0x0d, 0x00, 0x24, 0x00, 0x08, 0x04, 0x00,
+    0x00, 0x8c, 0x02, 0x00, 0x04, 0x00, 0x00, 0x88, 0x00, 0x00, 0x64, 0x00, 0x00, 0x48, 0x00, 0x00,
+    0x08, 0x0b, 0x00, 0xc4, 0x02, 0x05, 0xcc, 0x02, 0x12, 0xed, 0xb4, 0x70, 0x08, 0x10, 0x00, 0x00,
+    0x80, 0x13, 0x00, 0xa4, 0x13, 0x00, 0x10, 0x05, 0x00, 0x44, 0x10, 0x22, 0x67, 0xce, 0x0c, 0x00,
+    0x00, 0x20, 0x0d, 0x00, 0xc4, 0x03, 0x00, 0x88, 0x00, 0x00, 0x04, 0x00, 0x00, 0x6c, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x02, 0x00, 0x34, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x18,
+    0x2e, 0x05, 0x84, 0x07, 0x04, 0xd0, 0x01, 0x12, 0xb3, 0xd8, 0x82, 0x00, 0x34, 0x11, 0x00, 0xe8,
+    0x31, 0x00, 0xec, 0x02, 0x00, 0x94, 0x00, 0x00, 0x3c, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x78,
+    0x00, 0x00, 0xb4, 0x02, 0x00, 0x38, 0x01, 0x00, 0xb4, 0x00, 0x00, 0xac, 0x0c, 0x00, 0x74, 0x0a,
+    0x03, 0xec, 0x36, 0x00, 0xd8, 0x66, 0x31, 0x23, 0x27, 0xb7, 0x8c, 0x25, 0x00, 0x14, 0x92, 0x00,
+    0x74, 0x50, 0x00, 0x9c, 0x68, 0x00, 0x20, 0x35, 0x0c, 0xd0, 0x0b, 0x0f, 0x84, 0x07, 0x4e, 0x00,
+    0xd0, 0x0d, 0x00, 0xb0, 0x36, 0x01, 0x64, 0x0c, 0x00, 0x08, 0x01, 0x03, 0x04, 0x00, 0x00, 0x70,
+    0x8e, 0x00, 0x1c, 0x0b, 0x00, 0x84, 0x0e, 0x00, 0x24, 0x00, 0x00, 0x94, 0x03, 0x00, 0xc8, 0x00,
+    0x0f, 0x60, 0x01, 0x01, 0x0f, 0x1c, 0x01, 0x05, 0x0c, 0x08, 0x01, 0x00, 0xa0, 0x01, 0x00, 0x84,
+    0x11, 0x00, 0x84, 0x02, 0x00, 0x38, 0x02, 0x00, 0x70, 0x07, 0x00, 0x64, 0x06, 0x00, 0x2c, 0x01,
+    0x00, 0x2c, 0x00, 0x00, 0xec, 0x08, 0x00, 0x4c, 0x02, 0x00, 0xb4, 0x5c, 0x00, 0x24, 0x09, 0x01,
+    0xb0, 0x2d, 0x17, 0xb4, 0x8c, 0x21, 0x12, 0xb4, 0x6c, 0x71, 0x00, 0xa0, 0x07, 0x00, 0x9c, 0x05,
+    0x00, 0xdc, 0x04, 0x00, 0x38, 0x02, 0x01, 0x40, 0x00, 0x0f, 0x44, 0x0a, 0x0c, 0x0f, 0xa4, 0x00,
+    0x05, 0x04, 0x18, 0x00, 0x00, 0x34, 0x02, 0x00, 0xf4, 0x05, 0x00, 0xa8, 0x47, 0x00, 0x00, 0x25,
+    0x00, 0xb0, 0x01, 0x00, 0x90, 0x07, 0x00, 0xf0, 0x02, 0x00, 0xa8, 0x07, 0x00, 0x64, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0xac, 0x1a, 0x00, 0xbc, 0x05, 0x00, 0x54, 0x18, 0x00, 0x24, 0x00, 0x00, 0xa8,
+    0x00, 0x00, 0x28, 0x08, 0x00, 0x24, 0x25, 0x04, 0x70, 0x03, 0x00, 0x10, 0x00, 0x04, 0x20, 0x12,
+    0x00, 0x6c, 0x04, 0x00, 0x90, 0x06, 0x04, 0x40, 0x00, 0x00, 0x44, 0x00, 0x0f, 0x04, 0x00, 0x11,
+    0x00, 0x10, 0x01, 0x00, 0x04, 0x00, 0x04, 0xb4, 0x02, 0x00, 0xb4, 0x03, 0x00, 0x1c, 0x0a, 0x00,
+    0xac, 0x0c, 0x00, 0x8c, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x40, 0x17, 0x00, 0xcc, 0x2a, 0x04, 0xe8,
+    0x07, 0x00, 0x30, 0x00, 0x04, 0xec, 0x02, 0x0f, 0x64, 0x00, 0x11, 0x08, 0x24, 0x00, 0x00, 0x38,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x9c, 0x06, 0x00, 0xbc, 0x00,
+    0x0c, 0x88, 0x03, 0x00, 0x10, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0xe8, 0x02, 0x00, 0x04, 0x00,
+    0x00, 0x94, 0x01, 0x00, 0x58, 0x04, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x50, 0x00, 0x0f,
+    0x04, 0x00, 0x1d, 0x04, 0x88, 0x00, 0x00, 0xf0, 0x0b, 0x01, 0x10, 0x02, 0x11, 0xcf, 0x20, 0x76,
+    0x01, 0x88, 0x3d, 0x21, 0x00, 0xb2, 0x98, 0x9a, 0x00, 0x4c, 0x29, 0x00, 0xe4, 0x0e, 0x0f, 0x84,
+    0x07, 0x22, 0x00, 0xdc, 0x20, 0x00, 0x64, 0x0b, 0x00, 0x1c, 0x06, 0x00, 0xa8, 0x00, 0x00, 0x9c,
+    0x01, 0x00, 0x04, 0x00, 0x0f, 0xa8, 0x00, 0x19, 0x00, 0x6c, 0x01, 0x00, 0x30, 0x00, 0x00, 0x20,
+    0x04, 0x00, 0xf8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x90, 0x0e, 0x00, 0x24, 0x03, 0x00, 0x04, 0x00,
+    0x00, 0x18, 0x07, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x68, 0x02, 0x00, 0x3c, 0x00, 0x04, 0x48, 0x12, 0x00, 0x0c, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x4c, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x14, 0x01, 0x00, 0x9c, 0x01, 0x00, 0xf0,
+    0x01, 0x00, 0x84, 0x02, 0x00, 0x04, 0x03, 0x00, 0x8c, 0x07, 0x00, 0x04, 0x00, 0x00, 0xb8, 0x19,
+    0x00, 0x28, 0x2b, 0x00, 0xb0, 0x02, 0x00, 0xbc, 0x01, 0x00, 0x18, 0x03, 0x08, 0x58, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x10, 0x00, 0x00, 0x60, 0x05, 0x00, 0x34, 0x02, 0x00, 0x70, 0x15, 0x00, 0x1c,
+    0x39, 0x01, 0xf8, 0x03, 0x00, 0x88, 0x0c, 0x00, 0xf8, 0x03, 0x00, 0x08, 0x00, 0x02, 0x60, 0x79,
+    0x01, 0x2c, 0x07, 0x00, 0xa8, 0x0d, 0x00, 0x04, 0x07, 0x00, 0x7c, 0x00, 0x01, 0x40, 0x00, 0x0f,
+    0x64, 0x03, 0x18, 0x00, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x60, 0x01, 0x00, 0xac, 0x00, 0x00,
+    0xac, 0x02, 0x00, 0x10, 0x5e, 0x00, 0x08, 0x14, 0x00, 0x10, 0x01, 0x00, 0x58, 0x00, 0x00, 0xf0,
+    0x00, 0x0f, 0x58, 0x00, 0x05, 0x01, 0x18, 0x00, 0x03, 0xb0, 0x00, 0x00, 0x34, 0x08, 0x00, 0x84,
+    0x07, 0x00, 0x14, 0x1e, 0x09, 0xb0, 0x00, 0x0f, 0x84, 0x07, 0x79, 0x03, 0x04, 0x5b, 0x00, 0xb4,
+    0x02, 0x00, 0xe8, 0x17, 0x00, 0x20, 0x09, 0x00, 0x1c, 0x22, 0x04, 0xb0, 0x00, 0x00, 0xd4, 0x30,
+    0x00, 0x74, 0x06, 0x00, 0x48, 0x05, 0x00, 0x5c, 0x06, 0x00, 0x84, 0x01, 0x05, 0xac, 0x01, 0x00,
+    0x5c, 0x15, 0x0f, 0x88, 0x16, 0x04, 0x00, 0x44, 0x01, 0x00, 0x28, 0x01, 0x00, 0x38, 0x02, 0x00,
+    0x78, 0x03, 0x00, 0x4c, 0x01, 0x00, 0xdc, 0x0b, 0x00, 0xac, 0x13, 0x00, 0x4c, 0x14, 0x00, 0x60,
+    0x02, 0x00, 0xf4, 0x07, 0x00, 0x60, 0x0e, 0x00, 0x4c, 0x05, 0x00, 0x2c, 0x00, 0x04, 0x34, 0x00,
+    0x00, 0x0c, 0x00, 0x08, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0xec, 0x02, 0x09,
+    0x04, 0x00, 0x00, 0x74, 0x4b, 0x03, 0x80, 0x2f, 0x00, 0xf4, 0x03, 0x00, 0x24, 0x07, 0x00, 0x08,
+    0x14, 0x04, 0xc4, 0x02, 0x01, 0x08, 0x00, 0x12, 0xdb, 0x04, 0x86, 0x00, 0xc4, 0x05, 0x00, 0x04,
+    0x00, 0x00, 0x40, 0x32, 0x00, 0xa0, 0x10, 0x00, 0x04, 0x00, 0x00, 0x80, 0x02, 0x00, 0x04, 0x00,
+    0x00, 0x5c, 0x09, 0x00, 0x54, 0x03, 0x00, 0x44, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x38, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x84, 0x00, 0x01, 0x70, 0x00, 0x03, 0xd8, 0x4b, 0x00, 0x30, 0x0a, 0x00, 0x68,
+    0x11, 0x05, 0x5c, 0x1b, 0x02, 0x18, 0x25, 0x04, 0xe0, 0x03, 0x01, 0x68, 0x18, 0x00, 0x34, 0x1e,
+    0x00, 0x14, 0x19, 0x00, 0x24, 0x01, 0x00, 0x80, 0x16, 0x04, 0x10, 0x02, 0x00, 0x4c, 0x00, 0x0f,
+    0x04, 0x00, 0x11, 0x00, 0xe8, 0x00, 0x00, 0x18, 0x14, 0x00, 0x08, 0x03, 0x00, 0x78, 0x03, 0x00,
+    0xb4, 0x00, 0x00, 0xa8, 0x0f, 0x01, 0x40, 0x1c, 0x51, 0xb1, 0xff, 0x04, 0x00, 0xb4, 0xf8, 0x54,
+    0x00, 0x44, 0xb8, 0x00, 0x90, 0x2d, 0x00, 0x7c, 0x5f, 0x00, 0x18, 0x73, 0x00, 0x10, 0x3c, 0x0f,
+    0x84, 0x07, 0x56, 0x00, 0x00, 0x07, 0x00, 0x38, 0x10, 0x01, 0x5c, 0x0d, 0x00, 0xcc, 0x02, 0x04,
+    0x08, 0x01, 0x00, 0x8c, 0x03, 0x12, 0xb4, 0x8c, 0x28, 0x00, 0x10, 0x0b, 0x00, 0x30, 0x07, 0x00,
+    0x40, 0x03, 0x00, 0x70, 0x10, 0x0f, 0x60, 0x01, 0x05, 0x0f, 0x14, 0x01, 0x05, 0x05, 0x08, 0x01,
+    0x12, 0xf7, 0x44, 0x09, 0x00, 0xa8, 0x01, 0x00, 0x50, 0x00, 0x00, 0xe4, 0x08, 0x00, 0x84, 0x01,
+    0x00, 0xe4, 0x08, 0x00, 0x60, 0x01, 0x00, 0x04, 0x34, 0x00, 0x30, 0x01, 0x00, 0x3c, 0x04, 0x00,
+    0xac, 0x04, 0x00, 0xa8, 0x10, 0x01, 0x44, 0x0a, 0x03, 0x14, 0x04, 0x04, 0xac, 0x0b, 0x00, 0xbc,
+    0x17, 0x00, 0xdc, 0x4d, 0x00, 0x40, 0x25, 0x00, 0x18, 0x02, 0x00, 0xf0, 0x05, 0x00, 0x7c, 0x00,
+    0x0f, 0xa0, 0x01, 0x1d, 0x00, 0x34, 0x00, 0x04, 0x04, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x30, 0x06, 0x00, 0xc8, 0x02, 0x00, 0x84, 0x07, 0x00, 0xec, 0x51, 0x00, 0x04, 0x00, 0x00,
+    0xac, 0x0f, 0x00, 0x74, 0x08, 0x00, 0x50, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x48, 0x02, 0x04, 0x0c,
+    0x03, 0x00, 0xc4, 0x0a, 0x00, 0x90, 0x3e, 0x00, 0x88, 0x0a, 0x00, 0x30, 0x02, 0x03, 0x60, 0x09,
+    0x01, 0xd4, 0x71, 0x00, 0xdc, 0x04, 0x00, 0x84, 0x07, 0x00, 0xc8, 0x02, 0x0f, 0x6c, 0x04, 0x0d,
+    0x04, 0x88, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x98, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x04, 0x00,
+    0x14, 0x03, 0x00, 0x84, 0x07, 0x00, 0x14, 0x1b, 0x00, 0x1c, 0x10, 0x00, 0x00, 0x21, 0x00, 0xc4,
+    0x08, 0x00, 0xa8, 0x0c, 0x00, 0xe8, 0x18, 0x00, 0xbc, 0x08, 0x00, 0x6c, 0x02, 0x00, 0x30, 0x00,
+    0x0c, 0x48, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x00, 0x34, 0x00, 0x00, 0x04, 0x00, 0x00, 0xdc, 0x00,
+    0x00, 0x08, 0x01, 0x00, 0x30, 0x00, 0x00, 0x88, 0x01, 0x00, 0xf8, 0x00, 0x00, 0xfc, 0x04, 0x00,
+    0xbc, 0x1b, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x02, 0x00, 0x74, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x01,
+    0x24, 0x00, 0x11, 0xda, 0x38, 0x87, 0x01, 0x50, 0x10, 0x00, 0x30, 0x04, 0x00, 0xc8, 0x3f, 0x00,
+    0x5c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x58, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x01, 0x8c, 0x00, 0x12,
+    0xf8, 0x90, 0x47, 0x00, 0x74, 0x02, 0x00, 0x30, 0x07, 0x00, 0x38, 0x07, 0x01, 0xe4, 0x08, 0x0f,
+    0x84, 0x07, 0x30, 0x00, 0x80, 0x15, 0x00, 0xd4, 0x02, 0x00, 0xa8, 0x00, 0x00, 0x3c, 0x01, 0x00,
+    0x98, 0x00, 0x0f, 0xa4, 0x00, 0x1d, 0x04, 0x30, 0x00, 0x00, 0x74, 0x05, 0x00, 0xa4, 0x00, 0x00,
+    0x30, 0x04, 0x00, 0x18, 0x16, 0x00, 0xb8, 0x20, 0x00, 0x04, 0x00, 0x00, 0xa0, 0x09, 0x00, 0xa8,
+    0x02, 0x00, 0x0c, 0x00, 0x00, 0xd8, 0x1e, 0x04, 0xcc, 0x20, 0x00, 0xc8, 0x0c, 0x00, 0xac, 0x01,
+    0x00, 0x74, 0x00, 0x00, 0x04, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15,
+    0x00, 0x3c, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x48, 0x00, 0x00, 0xa0, 0x04, 0x00, 0xa4, 0x01, 0x00,
+    0xd4, 0x05, 0x00, 0x34, 0x03, 0x00, 0x54, 0x03, 0x00, 0x90, 0x05, 0x00, 0x04, 0x05, 0x00, 0x28,
+    0x00, 0x04, 0xa4, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x20, 0x09,
+    0x00, 0x58, 0x0e, 0x00, 0x84, 0x07, 0x00, 0x04, 0x1e, 0x01, 0x24, 0x06, 0x00, 0x00, 0x04, 0x03,
+    0xf8, 0x03, 0x00, 0x10, 0x00, 0x00, 0x20, 0x9a, 0x00, 0x84, 0x07, 0x00, 0xec, 0x05, 0x00, 0xf0,
+    0x07, 0x0c, 0x4c, 0x00, 0x00, 0x50, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x70, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0xc0, 0x02, 0x00, 0x20, 0x01, 0x00, 0x3c, 0x17, 0x00, 0x38, 0x0a, 0x00, 0x0c, 0x01,
+    0x00, 0x3c, 0x08, 0x0f, 0x58, 0x00, 0x0d, 0x00, 0x04, 0x02, 0x00, 0x64, 0x00, 0x00, 0x84, 0x07,
+    0x00, 0xd4, 0x00, 0x00, 0x58, 0x0e, 0x00, 0x24, 0x2d, 0x01, 0x04, 0x02, 0x12, 0xb4, 0x7c, 0x8b,
+    0x04, 0x0c, 0x00, 0x00, 0xf4, 0x0a, 0x0c, 0xb0, 0x00, 0x04, 0x40, 0x00, 0x00, 0x44, 0x00, 0x0f,
+    0x04, 0x00, 0x05, 0x00, 0xa0, 0x00, 0x00, 0x24, 0x06, 0x00, 0xf0, 0x02, 0x00, 0x94, 0x13, 0x00,
+    0xcc, 0x0d, 0x00, 0xac, 0x0f, 0x00, 0x1c, 0x01, 0x00, 0x68, 0x0e, 0x00, 0x64, 0x01, 0x00, 0x3c,
+    0x00, 0x0f, 0x4c, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x00, 0x34, 0x00, 0x00, 0x94, 0x01, 0x00, 0x18,
+    0x04, 0x08, 0xc4, 0x04, 0x00, 0x14, 0x04, 0x00, 0x14, 0x02, 0x00, 0xd8, 0x0b, 0x00, 0x10, 0x01,
+    0x00, 0x68, 0x0e, 0x00, 0x78, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x38, 0x00, 0x0f, 0x04, 0x00, 0x05,
+    0x00, 0xa4, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x08, 0x04, 0x00, 0xd0, 0x48, 0x00,
+    0xec, 0x01, 0x00, 0x48, 0x0e, 0x00, 0xa0, 0x01, 0x00, 0x48, 0x1b, 0x00, 0x4c, 0x01, 0x00, 0x68,
+    0x01, 0x00, 0x4c, 0x05, 0x00, 0x2c, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x04, 0x02, 0x01, 0x04,
+    0x00, 0x12, 0xf6, 0xd8, 0x01, 0x00, 0x0c, 0x00, 0x04, 0x30, 0x00, 0x00, 0x44, 0x00, 0x00, 0x94,
+    0x05, 0x00, 0x58, 0x07, 0x00, 0xc0, 0x00, 0x00, 0x8c, 0x0c, 0x00, 0x98, 0x18, 0x00, 0xb8, 0x00,
+    0x00, 0xb8, 0x39, 0x00, 0xa0, 0x1d, 0x00, 0x7c, 0x13, 0x00, 0x08, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x50, 0x0d, 0x00, 0xfc, 0x0e, 0x00, 0x0c, 0x08, 0x00, 0x40, 0x01, 0x00, 0x40, 0x05, 0x00, 0x00,
+    0x01, 0x00, 0x24, 0x05, 0x00, 0x5c, 0x00, 0x04, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc8, 0x00,
+    0x00, 0x48, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x84, 0x07, 0x00, 0xc0, 0x04, 0x00, 0x68, 0x42, 0x03,
+    0x10, 0x16, 0x01, 0x78, 0x07, 0x04, 0xe8, 0x05, 0x00, 0xe4, 0x05, 0x00, 0x34, 0x16, 0x00, 0x2c,
+    0x01, 0x00, 0x88, 0x04, 0x00, 0x24, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x44, 0x00, 0x00, 0x4c, 0x00,
+    0x0f, 0x04, 0x00, 0x11, 0x00, 0xd8, 0x01, 0x00, 0x30, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xf4, 0x23,
+    0x00, 0xb4, 0x08, 0x00, 0x84, 0x07, 0x01, 0x7c, 0x8f, 0x51, 0xb2, 0xff, 0x07, 0x00, 0xb4, 0x94,
+    0x5a, 0x00, 0x88, 0x4a, 0x00, 0x58, 0x22, 0x00, 0x0c, 0x3c, 0x0c, 0x7c, 0x07, 0x04, 0x10, 0x00,
+    0x0f, 0x08, 0x0f, 0x47, 0x12, 0xe8, 0xe4, 0x98, 0x00, 0xd8, 0x05, 0x00, 0x68, 0x58, 0x01, 0xd0,
+    0x02, 0x00, 0x88, 0x03, 0x00, 0x04, 0x00, 0x12, 0xb4, 0x88, 0x89, 0x00, 0xa8, 0x08, 0x00, 0x30,
+    0x51, 0x00, 0xec, 0x05, 0x00, 0xf0, 0x03, 0x0f, 0x60, 0x01, 0x05, 0x0f, 0x14, 0x01, 0x09, 0x00,
+    0x08, 0x01, 0x00, 0x1c, 0x02, 0x04, 0x08, 0x01, 0x00, 0xcc, 0x01, 0x00, 0xe0, 0x06, 0x00, 0x48,
+    0x0e, 0x00, 0xf0, 0x01, 0x00, 0x24, 0x01, 0x00, 0xe0, 0x06, 0x00, 0x28, 0x00, 0x00, 0x70, 0x03,
+    0x00, 0x44, 0x0a, 0x00, 0x64, 0x02, 0x05, 0x7c, 0x14, 0x00, 0x88, 0x07, 0x03, 0x94, 0x00, 0x00,
+    0x20, 0x04, 0x00, 0xb0, 0x42, 0x00, 0x1c, 0x02, 0x00, 0x14, 0x06, 0x00, 0xe0, 0x08, 0x00, 0x5c,
+    0x00, 0x00, 0x3c, 0x00, 0x0f, 0x84, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x00,
+    0xe0, 0x01, 0x00, 0x48, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x84, 0x07, 0x00, 0x28, 0x08, 0x00, 0x04,
+    0x00, 0x00, 0x58, 0x05, 0x00, 0x14, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x2c, 0x00,
+    0x00, 0xac, 0x07, 0x00, 0x70, 0x0a, 0x00, 0xe8, 0x04, 0x00, 0xc8, 0x08, 0x00, 0x60, 0x09, 0x00,
+    0x70, 0x07, 0x00, 0xb0, 0x08, 0x00, 0xa0, 0x00, 0x00, 0x28, 0x08, 0x0f, 0x14, 0x04, 0x01, 0x00,
+    0x3c, 0x00, 0x0f, 0x88, 0x00, 0x09, 0x0c, 0x1c, 0x00, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x18, 0x03, 0x00, 0xb8, 0x35, 0x00, 0xec, 0x20, 0x00, 0xf4, 0x20, 0x00, 0x48, 0x02, 0x00, 0x14,
+    0x18, 0x00, 0xac, 0x08, 0x00, 0xe8, 0x06, 0x00, 0x9c, 0x03, 0x00, 0xa0, 0x00, 0x0c, 0x40, 0x00,
+    0x0f, 0x10, 0x00, 0x19, 0x08, 0x88, 0x03, 0x00, 0x4c, 0x00, 0x00, 0xdc, 0x08, 0x00, 0xa8, 0x05,
+    0x00, 0x38, 0x05, 0x00, 0x74, 0x10, 0x00, 0x88, 0x03, 0x00, 0x74, 0x01, 0x00, 0x78, 0x03, 0x0f,
+    0x04, 0x00, 0x05, 0x00, 0x6c, 0x06, 0x00, 0x04, 0x00, 0x00, 0x88, 0x06, 0x00, 0xbc, 0x08, 0x00,
+    0x68, 0x04, 0x00, 0xd0, 0x01, 0x00, 0x5c, 0x00, 0x00, 0xc8, 0x00, 0x0f, 0x90, 0x00, 0x19, 0x00,
+    0x90, 0x01, 0x00, 0x34, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x30, 0x07, 0x00, 0x38,
+    0x07, 0x01, 0xa4, 0x02, 0x0f, 0x84, 0x07, 0x1d, 0x11, 0xdc, 0xb8, 0x16, 0x00, 0xe0, 0xb4, 0x05,
+    0xf4, 0x3f, 0x00, 0x84, 0x15, 0x00, 0x64, 0x04, 0x00, 0xe8, 0x0d, 0x00, 0x38, 0x04, 0x00, 0x88,
+    0x07, 0x00, 0xf8, 0x00, 0x0c, 0x38, 0x04, 0x0f, 0xb4, 0x00, 0x09, 0x00, 0xa4, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x14, 0x03, 0x00, 0x74, 0x05, 0x00, 0xf8, 0x0c, 0x00, 0xf4, 0x4e, 0x00, 0x60, 0x53,
+    0x00, 0x44, 0x04, 0x00, 0x3c, 0x19, 0x00, 0x48, 0x26, 0x00, 0x10, 0x00, 0x00, 0x3c, 0x06, 0x00,
+    0x24, 0x06, 0x00, 0x2c, 0x02, 0x04, 0x34, 0x05, 0x00, 0x9c, 0x09, 0x00, 0x44, 0x02, 0x00, 0x40,
+    0x00, 0x00, 0xe8, 0x00, 0x00, 0x80, 0x00, 0x00, 0x50, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x58,
+    0x01, 0x00, 0xfc, 0x01, 0x00, 0xa8, 0x18, 0x00, 0x4c, 0x0b, 0x00, 0xa4, 0x01, 0x00, 0x88, 0x02,
+    0x00, 0x24, 0x09, 0x00, 0x18, 0x02, 0x00, 0xcc, 0x00, 0x04, 0xa4, 0x00, 0x00, 0xb4, 0x02, 0x00,
+    0xfc, 0x04, 0x00, 0x90, 0x01, 0x00, 0xb4, 0x09, 0x00, 0x30, 0x09, 0x00, 0x90, 0x0e, 0x01, 0x58,
+    0x0e, 0x00, 0x80, 0x07, 0x00, 0x04, 0x00, 0x04, 0x64, 0x03, 0x12, 0xb4, 0xa0, 0x8c, 0x00, 0xe8,
+    0x01, 0x00, 0x34, 0x0b, 0x00, 0x30, 0x05, 0x00, 0xa4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x48, 0x00,
+    0x0f, 0xa0, 0x00, 0x15, 0x00, 0xc0, 0x01, 0x00, 0x04, 0x00, 0x00, 0x30, 0x08, 0x00, 0xf4, 0x00,
+    0x00, 0x50, 0x05, 0x00, 0xcc, 0x0e, 0x00, 0xdc, 0x03, 0x00, 0xa4, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x58, 0x00, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x6c, 0x00, 0x00,
+    0xe4, 0x08, 0x00, 0x04, 0x02, 0x00, 0xe4, 0x00, 0x00, 0xfc, 0x02, 0x00, 0xbc, 0x01, 0x00, 0x9c,
+    0x25, 0x05, 0x48, 0x5a, 0x0f, 0xb4, 0x61, 0x70, 0x00, 0xc0, 0x00, 0x00, 0x20, 0x01, 0x00, 0x60,
+    0x01, 0x00, 0x4c, 0x13, 0x00, 0xe0, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x44, 0x14, 0x01, 0x14, 0x04,
+    0x12, 0xb3, 0xec, 0x84, 0x00, 0x04, 0x0f, 0x00, 0x98, 0x0b, 0x00, 0x34, 0x07, 0x00, 0x70, 0x04,
+    0x00, 0xe0, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x04, 0xc4, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x8c, 0x08,
+    0x00, 0x40, 0x01, 0x00, 0x40, 0x05, 0x00, 0x08, 0x00, 0x00, 0x78, 0x02, 0x00, 0x54, 0x09, 0x00,
+    0x80, 0x00, 0x0f, 0x48, 0x00, 0x0d, 0x00, 0x24, 0x00, 0x00, 0x68, 0x02, 0x00, 0x48, 0x00, 0x00,
+    0x78, 0x02, 0x00, 0x84, 0x00, 0x00, 0x8c, 0x1e, 0x00, 0x0c, 0x00, 0x04, 0x8c, 0x02, 0x00, 0x0c,
+    0x03, 0x00, 0xec, 0x05, 0x00, 0x5c, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x6c, 0x05, 0x00, 0x48, 0x34,
+    0x00, 0x98, 0x90, 0x00, 0xe0, 0x04, 0x00, 0xb4, 0x27, 0x00, 0x84, 0x04, 0x00, 0x4c, 0x09, 0x00,
+    0x24, 0x07, 0x00, 0x24, 0x05, 0x00, 0xf8, 0x02, 0x00, 0x54, 0x09, 0x00, 0x28, 0x05, 0x00, 0x18,
+    0x05, 0x00, 0x98, 0x02, 0x0f, 0x8c, 0x00, 0x01, 0x00, 0xd0, 0x01, 0x00, 0x04, 0x00, 0x00, 0x28,
+    0x01, 0x00, 0x58, 0x07, 0x00, 0xe8, 0x07, 0x00, 0x24, 0x01, 0x00, 0x20, 0x5e, 0x00, 0xc0, 0x0c,
+    0x00, 0x2c, 0x03, 0x00, 0x78, 0x15, 0x00, 0xac, 0x08, 0x00, 0x30, 0x10, 0x00, 0x08, 0x09, 0x00,
+    0x58, 0x00, 0x00, 0xf0, 0x16, 0x00, 0x1c, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x5c,
+    0x00, 0x01, 0x0c, 0x14, 0x00, 0x00, 0x84, 0x00, 0x00, 0x60, 0x01, 0x00, 0x90, 0x00, 0x00, 0xe0,
+    0x00, 0x00, 0x98, 0x2f, 0x00, 0x70, 0x06, 0x00, 0x48, 0x30, 0x03, 0x84, 0x07, 0x00, 0x08, 0x0f,
+    0x00, 0x84, 0x16, 0x00, 0x18, 0xb5, 0x00, 0x64, 0x9e, 0x04, 0x70, 0x07, 0x0f, 0x08, 0x00, 0x01,
+    0x0f, 0x84, 0x07, 0x42, 0x00, 0x08, 0x01, 0x00, 0x34, 0x01, 0x00, 0x14, 0x04, 0x00, 0x98, 0x0a,
+    0x00, 0x70, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x30, 0x04, 0x01, 0x8c, 0x08, 0x12, 0xb3, 0x14, 0x32,
+    0x00, 0xa0, 0x07, 0x00, 0xbc, 0x00, 0x00, 0x6c, 0x06, 0x00, 0xc0, 0x01, 0x0c, 0xec, 0x00, 0x0f,
+    0x10, 0x00, 0x0d, 0x04, 0x08, 0x01, 0x00, 0xe4, 0x01, 0x00, 0xd4, 0x54, 0x00, 0x8c, 0x08, 0x00,
+    0x30, 0x28, 0x00, 0x00, 0x05, 0x00, 0x08, 0x04, 0x00, 0x84, 0x00, 0x01, 0x84, 0x03, 0x12, 0xf5,
+    0x48, 0x7b, 0x00, 0x10, 0x00, 0x00, 0xa8, 0x12, 0x00, 0x80, 0x01, 0x01, 0x44, 0x0a, 0x00, 0x1c,
+    0x04, 0x00, 0x04, 0x00, 0x07, 0x20, 0x04, 0x00, 0x18, 0x02, 0x00, 0x84, 0x02, 0x00, 0xe8, 0x05,
+    0x00, 0x18, 0x0a, 0x00, 0x5c, 0x00, 0x01, 0x44, 0x00, 0x1e, 0xf6, 0x04, 0x1b, 0x0f, 0xa0, 0x00,
+    0x0d, 0x00, 0x20, 0x00, 0x00, 0xd8, 0x01, 0x00, 0xe8, 0x02, 0x00, 0xe8, 0x01, 0x00, 0x80, 0x00,
+    0x00, 0x84, 0x07, 0x00, 0xd0, 0x04, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x34, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe4,
+    0x04, 0x00, 0x44, 0x04, 0x00, 0x00, 0x14, 0x00, 0xb4, 0x02, 0x00, 0xc0, 0x44, 0x01, 0x70, 0x03,
+    0x12, 0xb2, 0x7c, 0x30, 0x00, 0xb4, 0x06, 0x00, 0x20, 0x0a, 0x00, 0x3c, 0x01, 0x00, 0x28, 0x00,
+    0x00, 0x74, 0x01, 0x00, 0x08, 0x03, 0x00, 0x3c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0x6c, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x78, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x10, 0x07, 0x00, 0xd4, 0x22, 0x00,
+    0x14, 0x07, 0x00, 0xe4, 0x03, 0x00, 0x6c, 0x1c, 0x00, 0x98, 0x00, 0x0f, 0x4c, 0x00, 0x11, 0x0f,
+    0x24, 0x00, 0x01, 0x00, 0xc0, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc8, 0x05, 0x00, 0xc8, 0x03, 0x00,
+    0xac, 0x02, 0x00, 0x4c, 0x01, 0x00, 0xc0, 0x05, 0x00, 0xf4, 0x04, 0x00, 0xb8, 0x0d, 0x00, 0x68,
+    0x01, 0x00, 0x6c, 0x79, 0x00, 0xb8, 0x02, 0x00, 0x20, 0x03, 0x00, 0x7c, 0x01, 0x0f, 0x04, 0x00,
+    0x05, 0x00, 0xf8, 0x56, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x09, 0x00, 0x70, 0x22, 0x00, 0x24, 0x09,
+    0x00, 0x68, 0x05, 0x00, 0xf4, 0x03, 0x0f, 0xfc, 0x00, 0x1d, 0x04, 0x6c, 0x01, 0x00, 0x9c, 0x00,
+    0x00, 0x8c, 0x00, 0x0f, 0x84, 0x07, 0x28, 0x00, 0xb8, 0x25, 0x00, 0xf8, 0x97, 0x00, 0x54, 0xa6,
+    0x02, 0x84, 0x07, 0x11, 0xb3, 0x5c, 0xa8, 0x00, 0x6c, 0xa3, 0x10, 0x01, 0xd8, 0x08, 0x00, 0x70,
+    0x02, 0x00, 0xc8, 0x06, 0x00, 0x00, 0x01, 0x00, 0xa8, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x44, 0x0b,
+    0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xa4, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3c, 0x01,
+    0x00, 0x34, 0x0d, 0x00, 0x7c, 0x08, 0x00, 0x40, 0x0e, 0x00, 0x84, 0x09, 0x01, 0x04, 0x00, 0x00,
+    0x3c, 0x0a, 0x03, 0x04, 0x00, 0x00, 0x30, 0x06, 0x00, 0xd0, 0x19, 0x00, 0xc8, 0x2a, 0x00, 0xd8,
+    0x06, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x08, 0x00, 0xf0, 0x04, 0x00, 0x4c, 0x09, 0x00, 0xfc, 0x04,
+    0x00, 0xec, 0x00, 0x00, 0x94, 0x01, 0x0f, 0x7c, 0x00, 0x15, 0x00, 0x14, 0x0a, 0x00, 0xc0, 0x01,
+    0x00, 0xe0, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x60, 0x04, 0x00, 0x38, 0x07, 0x00, 0xdc, 0x04, 0x00,
+    0x9c, 0x0a, 0x00, 0x4c, 0x00, 0x00, 0x24, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x8c, 0x04, 0x01, 0xd8,
+    0x01, 0x00, 0x54, 0x9a, 0x30, 0xdb, 0xff, 0x01, 0x58, 0x0b, 0x00, 0x4c, 0x05, 0x00, 0x28, 0x08,
+    0x01, 0xd8, 0x08, 0x00, 0xa8, 0x00, 0x00, 0x68, 0x03, 0x03, 0x08, 0x00, 0x00, 0xec, 0x01, 0x00,
+    0xb0, 0x9a, 0x00, 0x60, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x67, 0x00, 0x54, 0x00, 0x00, 0x8c,
+    0x02, 0x00, 0xe0, 0x04, 0x0f, 0xa4, 0x00, 0x11, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0xa4,
+    0x00, 0x00, 0xd4, 0x09, 0x00, 0x28, 0x0d, 0x00, 0x70, 0x04, 0x00, 0x8c, 0x07, 0x00, 0x08, 0x04,
+    0x00, 0x04, 0x01, 0x00, 0x88, 0x10, 0x00, 0x64, 0x05, 0x01, 0x58, 0x00, 0x12, 0xf6, 0xec, 0x47,
+    0x00, 0xb0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x08, 0x00, 0x00, 0xbc, 0x00, 0x00,
+    0x20, 0x01, 0x00, 0xbc, 0x15, 0x00, 0x94, 0x02, 0x00, 0x68, 0x01, 0x00, 0x4c, 0x01, 0x00, 0x18,
+    0x06, 0x04, 0xbc, 0x00, 0x0f, 0xf4, 0x0a, 0x01, 0x04, 0xa0, 0x01, 0x00, 0x44, 0x00, 0x0f, 0x04,
+    0x00, 0x05, 0x00, 0x64, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x7c, 0x01, 0x00, 0xa0, 0x00, 0x0f, 0x08,
+    0x0f, 0x1d, 0x00, 0x3c, 0x00, 0x04, 0x5c, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x9c,
+    0x03, 0x00, 0xb4, 0x2e, 0x00, 0xac, 0x03, 0x01, 0xa4, 0x00, 0x00, 0x54, 0x01, 0x12, 0xb2, 0xc4,
+    0x47, 0x00, 0xd8, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x14, 0x03, 0x00, 0x7c, 0x00, 0x00, 0xa0, 0x01,
+    0x08, 0x44, 0x00, 0x04, 0x4c, 0x00, 0x08, 0x08, 0x00, 0x01, 0x24, 0x00, 0x12, 0xf8, 0x8c, 0x08,
+    0x00, 0x3c, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x88, 0x25, 0x00, 0x94, 0x07, 0x00,
+    0xbc, 0x00, 0x00, 0xec, 0x00, 0x00, 0x28, 0x00, 0x08, 0x38, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0xb4, 0x01, 0x00, 0x64, 0x01, 0x00, 0xc4, 0x01, 0x00, 0x74, 0x01, 0x00, 0xb0, 0x02,
+    0x00, 0x80, 0x01, 0x00, 0xf0, 0x22, 0x01, 0x88, 0x02, 0x12, 0xde, 0x78, 0x80, 0x00, 0xb4, 0x03,
+    0x00, 0x14, 0x03, 0x00, 0xf8, 0x03, 0x08, 0xbc, 0x00, 0x00, 0x14, 0x06, 0x00, 0xe0, 0x04, 0x00,
+    0x00, 0x0f, 0x00, 0x28, 0x1c, 0x00, 0xc4, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x06, 0x00, 0xc8,
+    0x05, 0x00, 0xf8, 0x00, 0x00, 0xe4, 0x04, 0x01, 0x74, 0x02, 0x00, 0x5c, 0x26, 0x0f, 0x58, 0x17,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x08, 0x00, 0x88, 0x00,
+    0x00, 0xb4, 0x81, 0x00, 0x64, 0x02, 0x00, 0x8c, 0x02, 0x00, 0xb0, 0x08, 0x00, 0xe8, 0x07, 0x00,
+    0xe0, 0x07, 0x00, 0x40, 0x01, 0x00, 0x58, 0x00, 0x01, 0xe0, 0x05, 0x12, 0xf0, 0x28, 0x62, 0x00,
+    0x30, 0x01, 0x00, 0x40, 0x00, 0x04, 0xd8, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x58, 0x0b, 0x00, 0xd8, 0x61, 0x00, 0x24, 0x01, 0x40, 0x7a, 0xd7, 0xff, 0x01,
+    0x00, 0x09, 0x00, 0xf0, 0x07, 0x10, 0x03, 0x8c, 0x7b, 0x02, 0xf4, 0x15, 0x00, 0x94, 0x3c, 0x00,
+    0x6c, 0x40, 0x00, 0x64, 0x07, 0x0f, 0x7c, 0x07, 0x01, 0x04, 0x14, 0x00, 0x00, 0x20, 0x00, 0x0f,
+    0x20, 0x3c, 0x02, 0x00, 0x84, 0x08, 0x00, 0x20, 0x03, 0x00, 0x58, 0x01, 0x00, 0x74, 0x00, 0x00,
+    0x84, 0x01, 0x00, 0xa8, 0x00, 0x0f, 0x9c, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0xa0, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x08, 0x01, 0x00, 0x74, 0x04, 0x00, 0xe0, 0x04, 0x00, 0x10, 0x03, 0x00, 0x44,
+    0x06, 0x00, 0xec, 0x24, 0x00, 0x04, 0x01, 0x00, 0x70, 0x01, 0x01, 0x44, 0x04, 0x12, 0xb5, 0xa8,
+    0x88, 0x00, 0xe8, 0x12, 0x00, 0xdc, 0x09, 0x00, 0x34, 0x00, 0x0f, 0x64, 0x00, 0x11, 0x04, 0x68,
+    0x00, 0x00, 0x94, 0x00, 0x00, 0x08, 0x01, 0x00, 0xc4, 0x06, 0x00, 0xb8, 0x15, 0x00, 0x2c, 0x18,
+    0x00, 0x80, 0x04, 0x00, 0x84, 0x03, 0x00, 0xa8, 0x02, 0x00, 0xb8, 0x01, 0x00, 0x84, 0x00, 0x00,
+    0x44, 0x02, 0x00, 0x08, 0x00, 0x00, 0x08, 0x05, 0x00, 0xb8, 0x2e, 0x40, 0x6d, 0xd0, 0xff, 0x01,
+    0x8c, 0x00, 0x01, 0xd0, 0x04, 0x07, 0x18, 0x04, 0x01, 0xe0, 0x06, 0x12, 0xb3, 0x4c, 0x97, 0x21,
+    0x41, 0xbf, 0x78, 0xa4, 0x01, 0xe4, 0x06, 0x00, 0x38, 0x0f, 0x00, 0xa4, 0x03, 0x00, 0x48, 0x00,
+    0x00, 0x74, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x84, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x10, 0x01,
+    0x00, 0xc4, 0x02, 0x00, 0xe0, 0x00, 0x00, 0xa0, 0x09, 0x00, 0xdc, 0x07, 0x00, 0x84, 0x02, 0x00,
+    0x74, 0x0b, 0x00, 0x84, 0x07, 0x00, 0x5c, 0x00, 0x00, 0x3c, 0x07, 0x08, 0xfc, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x4c, 0x02, 0x00, 0xd4, 0x04, 0x00, 0xec, 0x0c,
+    0x01, 0xa4, 0x00, 0x12, 0xb2, 0xa4, 0xb0, 0x00, 0x38, 0x32, 0x00, 0x60, 0x02, 0x00, 0xa4, 0x01,
+    0x00, 0x68, 0x05, 0x00, 0xa8, 0x01, 0x00, 0x30, 0x00, 0x0f, 0xa4, 0x00, 0x15, 0x00, 0x98, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x88, 0x06, 0x00, 0xc4, 0x17, 0x00,
+    0xc0, 0x0c, 0x00, 0x38, 0x06, 0x00, 0xfc, 0x05, 0x00, 0x20, 0x00, 0x04, 0x44, 0x10, 0x0f, 0xf0,
+    0x00, 0x16, 0x03, 0xd4, 0x1b, 0x00, 0x20, 0x09, 0x00, 0x38, 0x03, 0x00, 0x8c, 0x10, 0x00, 0xa8,
+    0x02, 0x00, 0xa0, 0x0b, 0x00, 0x90, 0x03, 0x00, 0x5c, 0x00, 0x40, 0x77, 0xd6, 0xff, 0x01, 0x48,
+    0x07, 0x00, 0x24, 0x2b, 0x01, 0xe8, 0x04, 0x00, 0xb4, 0x02, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x74,
+    0x7d, 0x00, 0x04, 0x00, 0x52, 0xb5, 0xff, 0x00, 0x3e, 0xbf, 0xc4, 0x7c, 0x00, 0x74, 0x05, 0x40,
+    0x91, 0xe5, 0xff, 0x01, 0x78, 0x13, 0x00, 0xe0, 0x06, 0x00, 0xb0, 0x00, 0x00, 0x48, 0x01, 0x00,
+    0x3c, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xd4, 0x00, 0x00, 0x28, 0x00, 0x00, 0x80, 0x05, 0x00,
+    0xfc, 0x00, 0x0f, 0x8c, 0x16, 0x36, 0x00, 0x10, 0x05, 0x12, 0xb4, 0x08, 0xa3, 0x00, 0xb0, 0x01,
+    0x00, 0x78, 0x14, 0x00, 0xcc, 0x04, 0x00, 0xa4, 0x01, 0x00, 0xcc, 0x06, 0x00, 0x44, 0x02, 0x00,
+    0x48, 0x01, 0x00, 0xa8, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xc0, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x88, 0x01, 0x00, 0xc0, 0x3d, 0x00, 0xd8, 0x63, 0x01, 0x58, 0x0e, 0x00, 0x64,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xbc, 0x02, 0x03, 0x04, 0x00, 0x00, 0x64, 0x54, 0x00, 0xf8, 0x15,
+    0x00, 0xd8, 0x28, 0x00, 0x28, 0x07, 0x00, 0x14, 0x0f, 0x00, 0xcc, 0x45, 0x00, 0x34, 0x00, 0x00,
+    0x40, 0x07, 0x00, 0xd0, 0x0c, 0x00, 0x98, 0x04, 0x00, 0x68, 0x02, 0x00, 0x7c, 0x00, 0x0f, 0xc4,
+    0x02, 0x0d, 0x00, 0x24, 0x00, 0x00, 0x80, 0x00, 0x00, 0x54, 0x01, 0x00, 0xa8, 0x0e, 0x00, 0x44,
+    0x00, 0x00, 0x98, 0x0c, 0x00, 0x24, 0x05, 0x00, 0x74, 0x01, 0x00, 0xa0, 0x09, 0x00, 0x68, 0x02,
+    0x00, 0x48, 0x01, 0x00, 0xa4, 0x00, 0x00, 0xf4, 0x05, 0x00, 0x0c, 0x0c, 0x00, 0xd8, 0x11, 0x00,
+    0x74, 0x0b, 0x00, 0x88, 0x00, 0x00, 0x18, 0x32, 0x00, 0xe4, 0x0c, 0x01, 0xf0, 0x03, 0x00, 0xe4,
+    0x0a, 0x07, 0x04, 0x00, 0x00, 0x34, 0x08, 0x00, 0xb0, 0x00, 0x00, 0x80, 0x20, 0x00, 0x70, 0x02,
+    0x00, 0x6c, 0x05, 0x00, 0xc4, 0x02, 0x00, 0xec, 0x00, 0x00, 0x58, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x58, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0xd4, 0x00, 0x00, 0xc4, 0x02, 0x00, 0xe0, 0x00, 0x00,
+    0x6c, 0x02, 0x00, 0x48, 0x06, 0x00, 0x88, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x54, 0x07, 0x00, 0xc0,
+    0x03, 0x00, 0xfc, 0x09, 0x0f, 0x58, 0x00, 0x05, 0x00, 0xa8, 0x02, 0x00, 0x98, 0x01, 0x00, 0x44,
+    0x08, 0x00, 0x0c, 0x02, 0x00, 0x44, 0x04, 0x00, 0x94, 0x00, 0x01, 0xb0, 0x46, 0x00, 0x68, 0x01,
+    0x12, 0xb2, 0x30, 0x4e, 0x00, 0x54, 0x01, 0x00, 0x58, 0x06, 0x00, 0x68, 0x00, 0x00, 0x4c, 0x00,
+    0x00, 0x20, 0x01, 0x0f, 0xa0, 0x00, 0x0d, 0x00, 0xc8, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x60, 0x00,
+    0x0f, 0x84, 0x07, 0x22, 0x03, 0x6c, 0x06, 0x00, 0x60, 0x01, 0x00, 0x6c, 0x00, 0x00, 0x28, 0x16,
+    0x00, 0x24, 0x08, 0x00, 0xbc, 0x0c, 0x00, 0xa0, 0x00, 0x05, 0x38, 0x31, 0x11, 0xb3, 0x6c, 0xae,
+    0x01, 0xd8, 0xaa, 0x00, 0x00, 0x01, 0x00, 0x78, 0x03, 0x00, 0x30, 0x00, 0x0f, 0xa4, 0x00, 0x11,
+    0x04, 0x24, 0x00, 0x00, 0x64, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x58, 0x1f, 0x00,
+    0x5c, 0x04, 0x00, 0xb8, 0x03, 0x00, 0x64, 0x05, 0x00, 0xc8, 0x00, 0x04, 0x28, 0x00, 0x00, 0x58,
+    0x00, 0x08, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x10, 0x01, 0x00, 0x74, 0x00, 0x00, 0xc4, 0x01,
+    0x00, 0x74, 0x01, 0x00, 0x90, 0x10, 0x00, 0x44, 0x01, 0x00, 0x34, 0x01, 0x00, 0x8c, 0x0e, 0x00,
+    0xec, 0x03, 0x00, 0x18, 0x02, 0x00, 0xe4, 0x1a, 0x00, 0xcc, 0x09, 0x00, 0x6c, 0x10, 0x01, 0xe0,
+    0x22, 0x00, 0x60, 0x01, 0x12, 0xb3, 0xd8, 0x11, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x17, 0x00, 0x84,
+    0x00, 0x00, 0x58, 0x0c, 0x00, 0xcc, 0x01, 0x00, 0x04, 0x00, 0x00, 0xe0, 0x05, 0x00, 0xc0, 0x05,
+    0x00, 0x08, 0x0d, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x05,
+    0x00, 0x8c, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00, 0x00, 0x70, 0x04, 0x00,
+    0x68, 0x18, 0x00, 0x30, 0x05, 0x00, 0xe0, 0x04, 0x00, 0x80, 0x07, 0x00, 0x24, 0x08, 0x00, 0x74,
+    0x06, 0x00, 0xb4, 0x00, 0x00, 0x58, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x50, 0x00, 0x05, 0x08, 0x18,
+    0x00, 0x00, 0xcc, 0x01, 0x00, 0x80, 0x00, 0x00, 0x34, 0x02, 0x00, 0x14, 0x09, 0x00, 0xac, 0x00,
+    0x00, 0x54, 0x08, 0x00, 0x74, 0x03, 0x00, 0xc4, 0x1b, 0x01, 0x54, 0x06, 0x00, 0xe8, 0x02, 0x51,
+    0xb3, 0xff, 0x08, 0x06, 0xb5, 0x68, 0xa9, 0x00, 0x2c, 0xab, 0x00, 0x64, 0x07, 0x04, 0x70, 0x07,
+    0x0f, 0x08, 0x00, 0x01, 0x00, 0x20, 0x00, 0x0f, 0x84, 0x07, 0x02, 0x00, 0x24, 0x06, 0x00, 0x40,
+    0x07, 0x00, 0xe4, 0x15, 0x00, 0x74, 0x00, 0x00, 0x84, 0x01, 0x00, 0x80, 0x00, 0x08, 0x94, 0x00,
+    0x0f, 0x0c, 0x00, 0x05, 0x00, 0xd4, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x08, 0x01,
+    0x00, 0x7c, 0x05, 0x00, 0x04, 0x0a, 0x00, 0x04, 0x10, 0x04, 0x7c, 0x95, 0x00, 0x08, 0x00, 0x00,
+    0x14, 0x01, 0x00, 0x30, 0x03, 0x00, 0xd0, 0x0c, 0x00, 0xa4, 0x06, 0x0f, 0x64, 0x00, 0x11, 0x0c,
+    0x08, 0x01, 0x00, 0xd4, 0x14, 0x00, 0x48, 0x12, 0x00, 0x48, 0x05, 0x00, 0x40, 0x1d, 0x00, 0x74,
+    0x03, 0x00, 0xec, 0x06, 0x04, 0x60, 0x01, 0x00, 0x5c, 0x02, 0x00, 0xd4, 0x01, 0x00, 0x5c, 0x03,
+    0x00, 0xe4, 0x09, 0x00, 0x74, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x9c, 0x10, 0x0f, 0x20, 0x04, 0x01,
+    0x00, 0x54, 0x1f, 0x00, 0xb4, 0x0f, 0x00, 0xbc, 0x0f, 0x00, 0x9c, 0x18, 0x00, 0x18, 0x02, 0x00,
+    0x8c, 0x02, 0x00, 0x7c, 0x03, 0x00, 0xf0, 0x03, 0x00, 0x04, 0x01, 0x00, 0x84, 0x00, 0x0f, 0xfc,
+    0x00, 0x05, 0x0c, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x50,
+    0x02, 0x00, 0x78, 0x07, 0x00, 0x04, 0x0f, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x1c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x40, 0x00, 0x04, 0x0c, 0x00, 0x00,
+    0xbc, 0x03, 0x00, 0x84, 0x07, 0x00, 0x38, 0x02, 0x00, 0xf0, 0x28, 0x01, 0xb0, 0x06, 0x03, 0x04,
+    0x29, 0x00, 0x48, 0x31, 0x08, 0xc4, 0x04, 0x00, 0xe4, 0x03, 0x00, 0x70, 0x01, 0x00, 0x7c, 0x01,
+    0x04, 0x48, 0x00, 0x00, 0x4c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0xc0, 0x04, 0x00, 0x7c, 0x04, 0x00, 0x08, 0x0f, 0x00, 0x68, 0x05, 0x00, 0x38, 0x03, 0x00,
+    0xd0, 0x08, 0x00, 0xc4, 0x02, 0x00, 0x3c, 0x00, 0x01, 0x8c, 0x00, 0x03, 0x58, 0x07, 0x00, 0x10,
+    0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x54, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x60,
+    0x08, 0x00, 0x04, 0x03, 0x00, 0x10, 0x05, 0x00, 0x84, 0x03, 0x00, 0x5c, 0x00, 0x00, 0x9c, 0x03,
+    0x00, 0xfc, 0x00, 0x00, 0x60, 0x01, 0x01, 0x0c, 0x0b, 0x00, 0xb4, 0x02, 0x03, 0x4c, 0x06, 0x01,
+    0xe0, 0x00, 0x0f, 0x0c, 0x00, 0x0c, 0x00, 0x48, 0x27, 0x00, 0x8c, 0x06, 0x00, 0xac, 0x0b, 0x00,
+    0xe0, 0x03, 0x00, 0x40, 0x02, 0x00, 0xec, 0x09, 0x00, 0xf0, 0x01, 0x00, 0x90, 0x0b, 0x00, 0x7c,
+    0x00, 0x0f, 0xa4, 0x00, 0x15, 0x04, 0x60, 0x01, 0x00, 0xa0, 0x00, 0x0f, 0x8c, 0x16, 0x24, 0x00,
+    0xfc, 0x8c, 0x00, 0x5c, 0xc4, 0x00, 0xb4, 0xc5, 0x00, 0xc0, 0xca, 0x00, 0x0c, 0x29, 0x20, 0x11,
+    0x18, 0x0c, 0x0b, 0x12, 0xb5, 0x5c, 0x04, 0x00, 0x10, 0x21, 0x00, 0xdc, 0x0b, 0x00, 0xa0, 0x01,
+    0x00, 0x8c, 0x02, 0x00, 0x9c, 0x00, 0x0f, 0xa4, 0x00, 0x11, 0x00, 0x78, 0x01, 0x00, 0x2c, 0x00,
+    0x00, 0x98, 0x06, 0x00, 0xe4, 0x02, 0x00, 0xbc, 0x02, 0x00, 0xcc, 0x0b, 0x05, 0x24, 0x01, 0x00,
+    0x38, 0x01, 0x03, 0x04, 0x00, 0x00, 0xf4, 0x28, 0x00, 0xd8, 0x06, 0x00, 0x44, 0x10, 0x00, 0x78,
+    0x13, 0x00, 0x04, 0x00, 0x00, 0x84, 0x0e, 0x00, 0xe8, 0x02, 0x00, 0xf8, 0x04, 0x00, 0xf4, 0x0b,
+    0x00, 0x10, 0x0e, 0x0f, 0xc8, 0x03, 0x15, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x01,
+    0x00, 0x3c, 0x03, 0x00, 0x84, 0x07, 0x00, 0x40, 0x0c, 0x00, 0x10, 0x03, 0x01, 0x84, 0x07, 0x12,
+    0xed, 0xec, 0x1b, 0x04, 0x84, 0x07, 0x00, 0x2c, 0x02, 0x00, 0xd8, 0x04, 0x21, 0x63, 0xcb, 0xdc,
+    0x63, 0x01, 0x50, 0xad, 0x21, 0x03, 0xb5, 0x9c, 0x77, 0x00, 0xa4, 0x17, 0x31, 0x45, 0x4a, 0xbb,
+    0x6c, 0xc7, 0x00, 0x60, 0x9c, 0x00, 0x14, 0x54, 0x10, 0x1a, 0x00, 0xbe, 0x00, 0x28, 0x2d, 0x00,
+    0x10, 0x55, 0x00, 0x58, 0x24, 0x00, 0x1c, 0x02, 0x00, 0x28, 0x02, 0x00, 0xd8, 0x04, 0x00, 0xc0,
+    0x02, 0x00, 0xfc, 0x00, 0x0f, 0x64, 0x03, 0x19, 0x00, 0x28, 0x01, 0x00, 0x38, 0x00, 0x00, 0x30,
+    0x06, 0x00, 0x6c, 0x0b, 0x00, 0x44, 0x0d, 0x00, 0x18, 0x05, 0x00, 0xb0, 0x06, 0x00, 0x90, 0x0b,
+    0x00, 0x60, 0x07, 0x00, 0xbc, 0x03, 0x0f, 0x58, 0x00, 0x09, 0x00, 0x1c, 0x01, 0x00, 0x40, 0x03,
+    0x00, 0xb0, 0x08, 0x00, 0x84, 0x1c, 0x00, 0x98, 0x0d, 0x04, 0xf4, 0x0a, 0x00, 0x5c, 0x05, 0x00,
+    0xbc, 0x02, 0x0f, 0x84, 0x07, 0x5d, 0x00, 0xb0, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x98, 0x00, 0x00,
+    0x04, 0x02, 0x00, 0xe0, 0x13, 0x00, 0x90, 0x18, 0x00, 0x5c, 0x6d, 0x04, 0xf4, 0x01, 0x00, 0x54,
+    0x10, 0x00, 0xd0, 0x08, 0x00, 0xc4, 0x06, 0x00, 0x10, 0x06, 0x0f, 0x68, 0x02, 0x19, 0x00, 0x34,
+    0x01, 0x00, 0x7c, 0x04, 0x00, 0x08, 0x03, 0x00, 0x20, 0x02, 0x00, 0x28, 0x0b, 0x00, 0x6c, 0x04,
+    0x00, 0xec, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x58, 0x03, 0x00, 0x1c, 0x00, 0x00, 0x60, 0x01, 0x00,
+    0x10, 0x02, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x01, 0xa4, 0x00, 0x12, 0xf6, 0x20, 0x05, 0x00,
+    0x20, 0x01, 0x00, 0x74, 0x01, 0x00, 0x30, 0x52, 0x00, 0x80, 0x02, 0x00, 0xa8, 0x2d, 0x00, 0x4c,
+    0x05, 0x00, 0xe8, 0x2a, 0x00, 0x04, 0x00, 0x00, 0x48, 0x01, 0x00, 0x18, 0x00, 0x00, 0xd0, 0x12,
+    0x00, 0x10, 0x24, 0x04, 0xcc, 0x02, 0x00, 0xfc, 0x17, 0x00, 0xf4, 0x0d, 0x00, 0xcc, 0x03, 0x00,
+    0x18, 0x1b, 0x00, 0x4c, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x9c, 0x04, 0x00, 0x84, 0x02, 0x00, 0xbc,
+    0x01, 0x00, 0xac, 0x00, 0x0c, 0x7c, 0x00, 0x0f, 0x10, 0x00, 0x09, 0x00, 0x30, 0x00, 0x00, 0xbc,
+    0x00, 0x00, 0x80, 0x06, 0x00, 0x4c, 0x0d, 0x00, 0x90, 0x0a, 0x00, 0x60, 0x08, 0x00, 0x0c, 0x03,
+    0x00, 0x74, 0x05, 0x00, 0xa8, 0x07, 0x00, 0x24, 0x00, 0x0f, 0x44, 0x00, 0x09, 0x0c, 0x1c, 0x00,
+    0x00, 0x04, 0x01, 0x00, 0x04, 0x00, 0x00, 0x34, 0x01, 0x00, 0x44, 0x00, 0x00, 0x20, 0x07, 0x00,
+    0x94, 0x21, 0x00, 0x90, 0x04, 0x61, 0x03, 0xb5, 0xff, 0x04, 0x0c, 0xb6, 0x0c, 0xae, 0x00, 0x0c,
+    0x7f, 0x00, 0x10, 0x61, 0x00, 0x80, 0x8c, 0x00, 0xa0, 0xe4, 0x0f, 0x0c, 0x1e, 0x09, 0x00, 0x94,
+    0x07, 0x01, 0x84, 0x07, 0x03, 0x20, 0x3c, 0x10, 0x0c, 0x18, 0x03, 0x00, 0xa4, 0x0e, 0x22, 0x12,
+    0xb7, 0xb0, 0x08, 0x00, 0xd4, 0x08, 0x00, 0xb0, 0x0f, 0x00, 0xe0, 0x04, 0x04, 0x0c, 0x01, 0x0c,
+    0x98, 0x00, 0x0f, 0x10, 0x00, 0x09, 0x00, 0xe4, 0x00, 0x00, 0x08, 0x01, 0x00, 0x4c, 0x0b, 0x00,
+    0x4c, 0x00, 0x00, 0x28, 0x02, 0x00, 0xdc, 0x3a, 0x00, 0xc0, 0x09, 0x00, 0x54, 0x06, 0x00, 0xec,
+    0x01, 0x00, 0xd4, 0x03, 0x00, 0xac, 0x05, 0x00, 0xd8, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x04, 0x00,
+    0x0f, 0x54, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x30, 0x00, 0x00, 0x08, 0x01,
+    0x00, 0x5c, 0x07, 0x00, 0x40, 0x15, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0f, 0x00, 0xd0, 0x07, 0x00,
+    0xbc, 0x01, 0x04, 0xc4, 0x03, 0x00, 0xbc, 0x00, 0x04, 0xd0, 0x15, 0x00, 0x2c, 0x10, 0x00, 0x9c,
+    0x0b, 0x52, 0x01, 0xb5, 0xff, 0x13, 0x19, 0xe8, 0x79, 0x00, 0x48, 0x81, 0x00, 0xa4, 0xbe, 0x00,
+    0x4c, 0x4c, 0x00, 0xf0, 0x9b, 0xb2, 0x1e, 0x23, 0xb7, 0xff, 0x02, 0x09, 0xb5, 0xff, 0x00, 0x05,
+    0xb6, 0x68, 0x37, 0x04, 0x78, 0x04, 0x0f, 0x8c, 0x08, 0x21, 0x00, 0xc8, 0x00, 0x00, 0xac, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0xe4, 0x03, 0x00, 0xe8, 0x02, 0x00, 0x14, 0x04, 0x00, 0x0c, 0x02, 0x00,
+    0xbc, 0x10, 0x00, 0xb0, 0x00, 0x00, 0x34, 0x04, 0x00, 0xa4, 0x00, 0x08, 0x60, 0x01, 0x00, 0x30,
+    0x00, 0x00, 0xc0, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x80, 0x01, 0x00, 0x28, 0x0c, 0x00, 0x14, 0x09,
+    0x00, 0x54, 0x05, 0x00, 0x5c, 0x4d, 0x00, 0x84, 0x03, 0x00, 0xac, 0x01, 0x00, 0xd0, 0x17, 0x00,
+    0xc4, 0x04, 0x00, 0x8c, 0x06, 0x00, 0xdc, 0x18, 0x0f, 0x6c, 0x04, 0x11, 0x00, 0x94, 0x00, 0x00,
+    0x04, 0x00, 0x01, 0x64, 0x00, 0x04, 0x68, 0x72, 0x12, 0xe8, 0x88, 0xb7, 0x00, 0xb0, 0x0a, 0x00,
+    0x34, 0x0a, 0x00, 0xa4, 0x00, 0x00, 0xc8, 0x08, 0x00, 0xa0, 0x12, 0x00, 0x68, 0x01, 0x00, 0xc8,
+    0x01, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x05, 0x58, 0x00, 0x12, 0xf3, 0x70, 0x83, 0x00,
+    0x28, 0x3a, 0x00, 0x4c, 0x02, 0x00, 0x74, 0x16, 0x00, 0x80, 0x03, 0x00, 0x88, 0x03, 0x00, 0x7c,
+    0x2d, 0x61, 0x17, 0xb7, 0xff, 0x04, 0x11, 0xb6, 0x04, 0x93, 0x00, 0x50, 0xc5, 0x00, 0xb4, 0x02,
+    0x00, 0x2c, 0x52, 0x31, 0x54, 0x5c, 0xbf, 0xfc, 0xa7, 0x00, 0xc8, 0x11, 0x0f, 0x04, 0x00, 0x01,
+    0x00, 0x84, 0x9b, 0x00, 0xec, 0x93, 0x72, 0x35, 0x3f, 0xba, 0xff, 0x1c, 0x3f, 0xbd, 0xcc, 0x96,
+    0x00, 0x44, 0x02, 0x00, 0xf8, 0x01, 0x00, 0xb0, 0x06, 0x00, 0xb4, 0x00, 0x00, 0xec, 0x06, 0x00,
+    0x54, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x04, 0x24, 0x00, 0x00, 0x3c, 0x10, 0x00, 0x3c, 0x06, 0x00,
+    0xf4, 0x0b, 0x01, 0x74, 0x05, 0x00, 0x00, 0x08, 0x11, 0xb2, 0xcc, 0x7a, 0x0f, 0x18, 0x2d, 0x15,
+    0x00, 0x14, 0xc8, 0x00, 0x94, 0x96, 0x00, 0x58, 0x4b, 0x00, 0x9c, 0x92, 0x31, 0x4d, 0x54, 0xbd,
+    0x90, 0xc2, 0x01, 0x3c, 0x27, 0x00, 0xc4, 0x05, 0x00, 0x38, 0x07, 0x00, 0x3c, 0x05, 0x00, 0xdc,
+    0x05, 0x00, 0x98, 0x00, 0x00, 0x44, 0x01, 0x00, 0xb8, 0x04, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00,
+    0x09, 0x04, 0x24, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x14, 0x15,
+    0x00, 0x54, 0x00, 0x01, 0x04, 0x00, 0x0b, 0xb4, 0xaf, 0x01, 0x50, 0x0a, 0x00, 0xc0, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x60, 0x0c, 0x12, 0xb2, 0xf0, 0x19, 0x00, 0x3c, 0x07, 0x00, 0x2c, 0x04, 0x00,
+    0x7c, 0x02, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x10, 0x00, 0xa4, 0x01, 0x0f, 0x7c, 0x00, 0x09, 0x00,
+    0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x48, 0x0b, 0x00, 0x84, 0x07, 0x00, 0x88, 0x0a, 0x00, 0xfc,
+    0x14, 0x00, 0x6c, 0x21, 0x00, 0x6c, 0x01, 0x00, 0x2c, 0x07, 0x00, 0x40, 0x00, 0x04, 0x6c, 0x55,
+    0x00, 0x84, 0x07, 0x00, 0x80, 0x05, 0x00, 0x84, 0x03, 0x00, 0xe4, 0x01, 0x00, 0x44, 0x04, 0x21,
+    0x00, 0xb3, 0x1c, 0x7f, 0x00, 0xac, 0x74, 0x00, 0x98, 0x31, 0x00, 0xac, 0x6d, 0x00, 0xe8, 0xa3,
+    0x00, 0x30, 0x5f, 0x02, 0x7c, 0x97, 0x00, 0xa8, 0x00, 0x12, 0xb2, 0xa8, 0x08, 0x00, 0x58, 0x19,
+    0x00, 0x74, 0x02, 0x04, 0x58, 0x00, 0x00, 0xdc, 0x07, 0x00, 0x00, 0x01, 0x00, 0x84, 0x00, 0x0f,
+    0x04, 0x00, 0x09, 0x00, 0x84, 0x00, 0x00, 0x04, 0x00, 0x00, 0x24, 0x00, 0x00, 0xd8, 0x00, 0x00,
+    0xac, 0x02, 0x00, 0x74, 0x05, 0x00, 0x94, 0x0b, 0x00, 0x50, 0x0a, 0x00, 0x58, 0x00, 0x00, 0xfc,
+    0x00, 0x00, 0xe8, 0x01, 0x00, 0xc8, 0x05, 0x01, 0x54, 0x00, 0x0f, 0x50, 0x0a, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x70, 0x03, 0x00, 0xf4, 0x0a, 0x05, 0x78, 0x12, 0x00, 0x9c, 0x11,
+    0x12, 0xb0, 0xf4, 0x42, 0x00, 0xdc, 0x00, 0x00, 0x28, 0x08, 0x00, 0x20, 0x06, 0x01, 0x48, 0x01,
+    0x03, 0xa4, 0x0e, 0x00, 0x80, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x98, 0x00, 0x04, 0xc8, 0x03,
+    0x00, 0x1c, 0x07, 0x00, 0x88, 0x0c, 0x00, 0x04, 0x05, 0x00, 0x50, 0x09, 0x00, 0xd4, 0x01, 0x00,
+    0xa0, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x84, 0x07, 0x00, 0x60, 0x01, 0x00, 0xc8, 0x0c, 0x00, 0x30, 0x05, 0x01, 0xb8, 0x0a,
+    0x00, 0x98, 0x00, 0x03, 0x70, 0x8c, 0x00, 0x80, 0x0d, 0x00, 0x68, 0x09, 0x00, 0x54, 0x29, 0x00,
+    0xfc, 0x15, 0x00, 0xe0, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x00, 0x80, 0x00, 0x00, 0x08,
+    0x00, 0x0c, 0x04, 0x00, 0x00, 0x94, 0x00, 0x00, 0x14, 0x00, 0x00, 0x74, 0x04, 0x00, 0xd0, 0x00,
+    0x00, 0xe4, 0x01, 0x00, 0xd4, 0x0d, 0x00, 0xa0, 0x06, 0x00, 0xa8, 0x13, 0x00, 0x1c, 0x0c, 0x00,
+    0xa0, 0x00, 0x00, 0x60, 0x05, 0x00, 0xac, 0x06, 0x00, 0x2c, 0x00, 0x0f, 0x4c, 0x00, 0x01, 0x00,
+    0x48, 0x00, 0x01, 0xa4, 0x00, 0x12, 0xf6, 0x04, 0x5f, 0x00, 0x3c, 0x2f, 0x00, 0xfc, 0x08, 0x01,
+    0xe0, 0x0c, 0x03, 0xa4, 0x00, 0x04, 0x68, 0x07, 0x0d, 0x08, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x04,
+    0x02, 0x03, 0x30, 0x52, 0x00, 0xdc, 0x0f, 0x00, 0x78, 0x01, 0x00, 0xc8, 0x04, 0x00, 0x14, 0x05,
+    0x00, 0xf4, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x60, 0x00, 0x0c, 0x10, 0x02, 0x00, 0x90, 0x00, 0x0f,
+    0x04, 0x00, 0x09, 0x00, 0xac, 0x00, 0x00, 0x38, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x48, 0x00, 0x00,
+    0xa0, 0x0f, 0x00, 0xb8, 0x02, 0x00, 0x64, 0x02, 0x00, 0x70, 0x0c, 0x08, 0x88, 0x03, 0x00, 0x2c,
+    0x00, 0x0f, 0x4c, 0x00, 0x09, 0x08, 0x1c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x68, 0x02, 0x00, 0xcc,
+    0x05, 0x00, 0x1c, 0x01, 0x00, 0x28, 0x01, 0x00, 0xd4, 0x0d, 0x01, 0x7c, 0x03, 0x51, 0xb2, 0xff,
+    0x0d, 0x01, 0xb5, 0xbc, 0xc9, 0x00, 0x70, 0xbc, 0x00, 0x44, 0xb4, 0x00, 0xdc, 0xa6, 0x04, 0xa0,
+    0x70, 0x00, 0x6c, 0x07, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x84, 0x07, 0x00, 0xcc, 0x8b, 0x00, 0x40,
+    0x1e, 0x05, 0xbc, 0x2d, 0x21, 0x01, 0xb6, 0xd0, 0x69, 0x10, 0x01, 0x2c, 0x06, 0x00, 0xc4, 0x02,
+    0x00, 0xc4, 0x00, 0x00, 0xc4, 0x03, 0x00, 0xa4, 0x02, 0x00, 0xd8, 0x00, 0x00, 0x7c, 0x01, 0x08,
+    0x9c, 0x00, 0x0f, 0x0c, 0x00, 0x01, 0x05, 0xb0, 0x00, 0x12, 0xf6, 0x80, 0x8a, 0x00, 0xb0, 0x00,
+    0x00, 0x8c, 0x05, 0x00, 0x48, 0x06, 0x00, 0x18, 0x10, 0x00, 0x5c, 0x00, 0x00, 0x84, 0x06, 0x00,
+    0xf4, 0x02, 0x00, 0x28, 0x01, 0x00, 0xd8, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x5c, 0x00, 0x0d, 0x00,
+    0x24, 0x00, 0x01, 0x08, 0x01, 0x03, 0x58, 0x00, 0x00, 0x3c, 0x09, 0x00, 0xdc, 0x15, 0x00, 0x5c,
+    0x0d, 0x00, 0x08, 0x0f, 0x00, 0xa8, 0x00, 0x00, 0x90, 0x00, 0x22, 0xb2, 0xfb, 0x2c, 0xaa, 0x00,
+    0x70, 0x01, 0x00, 0x60, 0x02, 0x00, 0xf8, 0x02, 0x00, 0x08, 0x06, 0x03, 0x20, 0x04, 0x00, 0x3c,
+    0xb0, 0x00, 0xf0, 0x05, 0x00, 0x50, 0x23, 0x00, 0x90, 0xae, 0x00, 0x5c, 0x81, 0x00, 0xa4, 0x50,
+    0x00, 0x60, 0xd5, 0x11, 0x08, 0x30, 0x02, 0x52, 0xb2, 0xff, 0x00, 0x08, 0xb6, 0xcc, 0x03, 0x00,
+    0xe8, 0x07, 0x00, 0x84, 0x07, 0x00, 0xfc, 0x00, 0x01, 0x10, 0x02, 0x03, 0x28, 0x30, 0x00, 0x8c,
+    0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x0c, 0x02, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0xd0,
+    0x0a, 0x00, 0xf0, 0x00, 0x00, 0x9c, 0x14, 0x00, 0x84, 0x17, 0x00, 0xa0, 0x09, 0x00, 0xbc, 0x04,
+    0x00, 0x14, 0x00, 0x00, 0x88, 0x08, 0x00, 0xfc, 0x09, 0x00, 0x28, 0x00, 0x04, 0x54, 0x00, 0x00,
+    0x04, 0x05, 0x00, 0x78, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x28, 0x25, 0x00, 0x84, 0x03, 0x00, 0x58,
+    0x0d, 0x00, 0xf0, 0x0c, 0x01, 0x88, 0x05, 0x12, 0xb1, 0x60, 0x4f, 0x00, 0xfc, 0x00, 0x00, 0x64,
+    0x02, 0x0f, 0x6c, 0x04, 0x0d, 0x00, 0x18, 0x01, 0x04, 0x04, 0x00, 0x01, 0x64, 0x00, 0x12, 0xf7,
+    0x64, 0x46, 0x00, 0xbc, 0x07, 0x00, 0x24, 0x06, 0x00, 0x90, 0x00, 0x00, 0x98, 0x00, 0x00, 0xf4,
+    0x01, 0x00, 0x84, 0x03, 0x00, 0x00, 0x08, 0x00, 0x1c, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x0c, 0x04,
+    0x0f, 0x9c, 0x01, 0x0d, 0x00, 0x5c, 0x00, 0x00, 0xec, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe0, 0x03,
+    0x00, 0xdc, 0x03, 0x00, 0xc0, 0x05, 0x00, 0xfc, 0x08, 0x01, 0xf4, 0xbd, 0x04, 0x98, 0x03, 0x00,
+    0x24, 0x06, 0x00, 0x04, 0x00, 0x11, 0xb4, 0x14, 0xbb, 0x00, 0x90, 0xb5, 0x00, 0x4c, 0x55, 0x00,
+    0xd4, 0x64, 0x00, 0xbc, 0x11, 0x00, 0x90, 0x02, 0x00, 0x48, 0x19, 0x08, 0x04, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xe8, 0x3e, 0xd0, 0x7e, 0x87, 0xca, 0xff, 0x60, 0x65, 0xc0, 0xff,
+    0x37, 0x40, 0xba, 0xff, 0x03, 0x4c, 0x02, 0x13, 0x66, 0x38, 0x38, 0x00, 0xe8, 0x01, 0x00, 0x70,
+    0x09, 0x00, 0xcc, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xd8, 0x10, 0x00, 0x20, 0x00, 0x00, 0x9c,
+    0xb4, 0x22, 0x74, 0xd4, 0x34, 0x91, 0x00, 0x4c, 0x0c, 0x01, 0x54, 0x01, 0x11, 0xb2, 0x58, 0xc9,
+    0x00, 0xc4, 0x0a, 0x00, 0xec, 0x1d, 0x0f, 0xa4, 0x43, 0x0d, 0x00, 0x58, 0x03, 0x00, 0xb0, 0xf5,
+    0x00, 0xe0, 0xc0, 0x00, 0xbc, 0x00, 0x00, 0xbc, 0xaf, 0x00, 0xc4, 0x07, 0x02, 0x1c, 0x1e, 0x12,
+    0xb2, 0x94, 0x15, 0x0f, 0x84, 0x07, 0x2d, 0x00, 0x8c, 0x16, 0x00, 0xc0, 0x02, 0x00, 0xfc, 0x10,
+    0x01, 0xa4, 0x00, 0x00, 0xbc, 0x04, 0x00, 0xc4, 0x04, 0x03, 0x88, 0x07, 0x01, 0x04, 0x04, 0x00,
+    0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x5c, 0x01, 0x12, 0xb2, 0x08, 0x39, 0x00,
+    0x84, 0x07, 0x04, 0xc0, 0x02, 0x00, 0x5c, 0x02, 0x00, 0x9c, 0x01, 0x00, 0xfc, 0x01, 0x00, 0xac,
+    0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x04, 0xc4, 0x01, 0x00, 0x14,
+    0x0d, 0x00, 0x08, 0x03, 0x04, 0x90, 0x0a, 0x00, 0x14, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x70, 0x30,
+    0x00, 0x08, 0x00, 0x00, 0xc0, 0x03, 0x00, 0xc8, 0x02, 0x00, 0xa8, 0x06, 0x00, 0xd4, 0x0c, 0x03,
+    0x64, 0x03, 0x31, 0x3f, 0x44, 0xba, 0x24, 0x8b, 0x00, 0x0c, 0xd0, 0x00, 0xb4, 0x66, 0x00, 0x44,
+    0x9b, 0x00, 0xd0, 0xb1, 0x00, 0x10, 0x0f, 0x05, 0x6c, 0x04, 0x00, 0x24, 0x22, 0x00, 0x2c, 0x07,
+    0x00, 0x20, 0x05, 0x00, 0x58, 0x00, 0x00, 0x64, 0x03, 0x00, 0xe0, 0x03, 0x00, 0x80, 0x00, 0x00,
+    0x70, 0x02, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x78, 0x00, 0x04, 0x04, 0x00, 0x00, 0x2c, 0x00, 0x00,
+    0xd8, 0x00, 0x00, 0xb4, 0x05, 0x08, 0x84, 0x07, 0x00, 0x10, 0x06, 0x00, 0xcc, 0x02, 0x0f, 0x18,
+    0x03, 0x0d, 0x00, 0x3c, 0x00, 0x00, 0x44, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x8c, 0x03, 0x00, 0x0c,
+    0x0e, 0x01, 0x94, 0x09, 0x00, 0x48, 0x01, 0x12, 0xb1, 0x80, 0x21, 0x00, 0xc0, 0x11, 0x00, 0xe4,
+    0x00, 0x00, 0xb4, 0x06, 0x01, 0xa4, 0x00, 0x0f, 0x84, 0x07, 0x64, 0x00, 0x5c, 0x0e, 0x03, 0x60,
+    0x01, 0x01, 0x48, 0xc5, 0x00, 0x20, 0x18, 0x00, 0x38, 0x07, 0x00, 0x90, 0x1b, 0x00, 0x44, 0x04,
+    0x00, 0xf0, 0x04, 0x00, 0x08, 0x01, 0x04, 0x1c, 0x01, 0x0f, 0x08, 0x00, 0x01, 0x00, 0xec, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x8c, 0x0a, 0x00, 0xe4, 0x03, 0x00, 0x24, 0x01, 0x00, 0xc4, 0x07, 0x00,
+    0x28, 0x0d, 0x00, 0xe4, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x48, 0x05, 0x00, 0x20, 0x00, 0x00, 0x98,
+    0x05, 0x00, 0x2c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x9c, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x10,
+    0x01, 0x00, 0x40, 0x09, 0x04, 0x84, 0x07, 0x00, 0x70, 0x41, 0x04, 0xa4, 0x00, 0x01, 0x4c, 0x05,
+    0x00, 0x94, 0x02, 0x08, 0x04, 0x00, 0x00, 0xac, 0x02, 0x07, 0x04, 0x00, 0x00, 0xc4, 0x11, 0x00,
+    0x5c, 0x17, 0x00, 0xd0, 0x06, 0x00, 0xe8, 0x02, 0x00, 0x74, 0x17, 0x00, 0xdc, 0x18, 0x00, 0xa8,
+    0x39, 0x00, 0x78, 0x00, 0x08, 0x10, 0x02, 0x00, 0x10, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x98,
+    0x00, 0x04, 0xe4, 0x00, 0x00, 0x44, 0x08, 0x00, 0xac, 0x1a, 0x00, 0x9c, 0x08, 0x00, 0x58, 0x0c,
+    0x00, 0x28, 0x26, 0x00, 0xd8, 0x02, 0x00, 0x44, 0x00, 0x04, 0x24, 0x00, 0x00, 0x0c, 0x00, 0x0f,
+    0x04, 0x00, 0x11, 0x00, 0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x60, 0x01, 0x00, 0x4c, 0x00, 0x00,
+    0xd4, 0x06, 0x00, 0xb4, 0x00, 0x01, 0x80, 0x03, 0x51, 0xb1, 0xff, 0x14, 0x0e, 0xb5, 0xa8, 0xa7,
+    0x00, 0x20, 0xbe, 0x00, 0x0c, 0x94, 0x00, 0xac, 0xa7, 0x1f, 0xcc, 0xf0, 0xc3, 0x10, 0x00, 0x84,
+    0x07, 0x31, 0x95, 0xa1, 0xd3, 0xbc, 0x16, 0x02, 0xc0, 0x2d, 0x00, 0x28, 0x05, 0x12, 0xb5, 0x30,
+    0xa6, 0x04, 0xec, 0x14, 0x00, 0x58, 0x0a, 0x00, 0xb4, 0x04, 0x00, 0x68, 0x01, 0x00, 0x80, 0x00,
+    0x00, 0x8c, 0x00, 0x00, 0xe8, 0x00, 0x0f, 0xb8, 0x00, 0x09, 0x00, 0x24, 0x00, 0x00, 0xb0, 0x00,
+    0x00, 0xc4, 0x01, 0x00, 0x34, 0x08, 0x04, 0x2c, 0x07, 0x00, 0x30, 0x2e, 0x00, 0x94, 0x04, 0x00,
+    0xf0, 0x08, 0x00, 0xa4, 0x05, 0x00, 0xd4, 0x02, 0x01, 0xe4, 0x05, 0x0f, 0xf4, 0x24, 0x14, 0x04,
+    0x58, 0x00, 0x00, 0x88, 0x00, 0x00, 0x08, 0x01, 0x00, 0x80, 0x02, 0x04, 0x84, 0x07, 0x00, 0xd4,
+    0x07, 0x00, 0xb4, 0x06, 0x00, 0x14, 0x02, 0x00, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x6c, 0x0a,
+    0x00, 0x9c, 0x05, 0x00, 0xdc, 0x01, 0x00, 0x34, 0x10, 0x03, 0x1c, 0x02, 0x00, 0x78, 0xa0, 0x00,
+    0xbc, 0x78, 0x32, 0x9a, 0xa6, 0xd5, 0xd4, 0xc2, 0x21, 0xb1, 0xda, 0x48, 0x2e, 0x00, 0x24, 0xb6,
+    0x11, 0x0e, 0xd8, 0x3d, 0x43, 0xb1, 0xff, 0x00, 0x07, 0x84, 0x07, 0x00, 0x9c, 0x06, 0x00, 0xe0,
+    0x02, 0x01, 0xc4, 0x04, 0x04, 0x80, 0x07, 0x00, 0x74, 0x37, 0x0f, 0x04, 0x00, 0x11, 0x03, 0x44,
+    0x20, 0x00, 0x94, 0x00, 0x00, 0x10, 0x02, 0x00, 0x04, 0x02, 0x00, 0x28, 0x04, 0x00, 0x08, 0x06,
+    0x00, 0xfc, 0x02, 0x00, 0xa4, 0x06, 0x00, 0xe8, 0x0e, 0x00, 0x68, 0x07, 0x00, 0x84, 0x04, 0x00,
+    0xd8, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x18, 0x04, 0x00, 0x44,
+    0x04, 0x00, 0x18, 0x12, 0x00, 0x4c, 0x05, 0x00, 0xf4, 0x0e, 0x00, 0xc8, 0x08, 0x01, 0x8c, 0x05,
+    0x12, 0xb1, 0xf0, 0xb8, 0x00, 0x84, 0x07, 0x00, 0xc4, 0x0a, 0x00, 0x28, 0x00, 0x01, 0xa4, 0x00,
+    0x00, 0x74, 0x00, 0x0f, 0xf0, 0x0b, 0x00, 0x0f, 0xb0, 0x01, 0x01, 0x00, 0x30, 0x00, 0x00, 0x64,
+    0x00, 0x00, 0x7c, 0x00, 0x00, 0xd8, 0x26, 0x00, 0x7c, 0x07, 0x00, 0x5c, 0x02, 0x00, 0x94, 0x03,
+    0x00, 0x0c, 0x03, 0x00, 0x80, 0x09, 0x00, 0x3c, 0x08, 0x00, 0xc0, 0x00, 0x00, 0x94, 0x00, 0x0f,
+    0x44, 0x00, 0x01, 0x08, 0x14, 0x00, 0x00, 0x24, 0x00, 0x00, 0x78, 0x01, 0x00, 0x40, 0x08, 0x00,
+    0xd0, 0x0a, 0x00, 0xe0, 0x00, 0x00, 0xac, 0x0b, 0x01, 0x8c, 0x03, 0x00, 0x5c, 0x02, 0x04, 0x8c,
+    0x03, 0x55, 0xb3, 0xff, 0x0f, 0x0e, 0xb5, 0x88, 0xcd, 0x00, 0xcc, 0x06, 0x0f, 0x04, 0x00, 0x19,
+    0xf2, 0x00, 0x7d, 0x86, 0xc9, 0xff, 0x49, 0x50, 0xbd, 0xff, 0x04, 0x30, 0xba, 0xff, 0x00, 0x43,
+    0xc1, 0xc4, 0xc0, 0x00, 0xd8, 0x09, 0x00, 0xc8, 0x0f, 0x00, 0x60, 0x02, 0x0f, 0x04, 0x00, 0x09,
+    0x00, 0x24, 0x00, 0x00, 0xbc, 0x27, 0x00, 0x8c, 0x10, 0x00, 0x3c, 0x01, 0x00, 0x98, 0x34, 0x01,
+    0xd8, 0x08, 0x00, 0x9c, 0x00, 0x11, 0xb3, 0xb8, 0xd2, 0x00, 0xdc, 0x9e, 0x0f, 0xa4, 0x43, 0x11,
+    0x04, 0xb4, 0x00, 0x00, 0xe8, 0xe8, 0x00, 0x50, 0x3c, 0x00, 0x20, 0x9c, 0x00, 0x10, 0x80, 0x02,
+    0x84, 0x07, 0x12, 0xb3, 0xb4, 0xc9, 0x00, 0x68, 0x0f, 0x00, 0xf0, 0x01, 0x00, 0x20, 0x05, 0x00,
+    0x2c, 0x01, 0x00, 0x24, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00,
+    0xc0, 0x02, 0x00, 0x60, 0x19, 0x00, 0x30, 0x17, 0x00, 0x70, 0x08, 0x00, 0x68, 0x16, 0x00, 0x78,
+    0x09, 0x00, 0xc8, 0x15, 0x01, 0xfc, 0x03, 0x07, 0xcc, 0x04, 0x05, 0x10, 0x00, 0x02, 0xc8, 0x00,
+    0x01, 0x68, 0x1b, 0x00, 0xf8, 0x0a, 0x00, 0x58, 0x09, 0x00, 0x6c, 0x03, 0x00, 0x80, 0x00, 0x00,
+    0x60, 0x02, 0x00, 0xcc, 0x01, 0x0f, 0x7c, 0x00, 0x0d, 0x00, 0x80, 0x00, 0x00, 0xac, 0x04, 0x00,
+    0x60, 0x10, 0x00, 0x58, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x44, 0x03, 0x00, 0xec, 0x09, 0x00, 0x14,
+    0x00, 0x00, 0xa0, 0x05, 0x00, 0x20, 0x00, 0x00, 0x38, 0x0a, 0x00, 0x88, 0x03, 0x00, 0x18, 0x00,
+    0x00, 0xa4, 0x07, 0x05, 0x24, 0x06, 0x02, 0x84, 0xdb, 0x00, 0x1c, 0x39, 0x00, 0x78, 0x5b, 0x00,
+    0x54, 0xfd, 0x00, 0x24, 0xdc, 0x00, 0x38, 0x75, 0x00, 0xb8, 0xcd, 0x05, 0x84, 0x07, 0x00, 0x54,
+    0x57, 0x00, 0x88, 0x14, 0x00, 0x64, 0x03, 0x00, 0x18, 0x03, 0x00, 0xa4, 0x00, 0x00, 0x10, 0x04,
+    0x00, 0x94, 0x02, 0x0c, 0x04, 0x00, 0x00, 0x6c, 0x00, 0x04, 0x14, 0x00, 0x00, 0x60, 0x02, 0x00,
+    0x20, 0x03, 0x01, 0x1c, 0x0a, 0x00, 0xf0, 0x02, 0x12, 0xf8, 0xf4, 0x85, 0x00, 0x78, 0x1f, 0x00,
+    0xb0, 0x0a, 0x00, 0xf4, 0x21, 0x00, 0x90, 0x00, 0x00, 0xf0, 0x0a, 0x0f, 0x18, 0x03, 0x0d, 0x00,
+    0xec, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x5c, 0x00, 0x00, 0x80, 0x06, 0x00, 0xf0, 0x04, 0x00, 0xbc,
+    0x08, 0x00, 0xc0, 0x22, 0x00, 0xf8, 0x08, 0x00, 0xf8, 0x18, 0x00, 0xa0, 0x16, 0x00, 0x48, 0x04,
+    0x0f, 0x0c, 0x03, 0x1d, 0x04, 0x58, 0x00, 0x0f, 0x08, 0x0f, 0x2d, 0x00, 0x28, 0x16, 0x00, 0xa8,
+    0x12, 0x07, 0x48, 0x0c, 0x01, 0xac, 0xd4, 0x00, 0xe8, 0x02, 0x00, 0x3c, 0x04, 0x00, 0x48, 0x05,
+    0x00, 0x90, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x14, 0x01, 0x0f, 0xe0, 0x01, 0x0d, 0x00, 0x20, 0x00,
+    0x00, 0xcc, 0x00, 0x00, 0xe0, 0x09, 0x00, 0xcc, 0x27, 0x00, 0xb0, 0x08, 0x01, 0xcc, 0x16, 0x12,
+    0xe2, 0x18, 0x00, 0x04, 0x28, 0x02, 0x0f, 0x4c, 0x00, 0x09, 0x00, 0xdc, 0x00, 0x00, 0xec, 0x03,
+    0x00, 0x74, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x68, 0x38, 0x00, 0x74, 0x01, 0x01, 0xac, 0x0f, 0x00,
+    0xc0, 0x08, 0x00, 0x88, 0x02, 0x0f, 0xa0, 0x02, 0x01, 0x0b, 0x14, 0x00, 0x00, 0xd4, 0x13, 0x00,
+    0xbc, 0x4a, 0x00, 0x40, 0x0f, 0x00, 0x2c, 0x1e, 0x00, 0xcc, 0x09, 0x00, 0xb8, 0x01, 0x0c, 0x10,
+    0x02, 0x00, 0x18, 0x02, 0x00, 0xe4, 0x00, 0x00, 0xb4, 0x04, 0x00, 0xc0, 0x00, 0x0f, 0x04, 0x00,
+    0x11, 0x00, 0x9c, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x30, 0x02, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0x14, 0x00, 0x0f, 0x3c, 0x00, 0x11, 0x0c, 0x24, 0x00, 0x00, 0x38, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x94, 0x03, 0x01, 0x28, 0x02, 0x12, 0xd4, 0x28, 0xa4, 0x03, 0xb0, 0xb6, 0x31, 0x19, 0x17,
+    0xb6, 0xac, 0xe9, 0x00, 0xb4, 0xd7, 0x0f, 0xe8, 0xc3, 0x11, 0x04, 0x3c, 0x04, 0x00, 0x1c, 0x66,
+    0x00, 0x5c, 0x8e, 0x00, 0x48, 0x13, 0x00, 0x98, 0x15, 0x00, 0x04, 0xc7, 0x00, 0x68, 0xd9, 0x10,
+    0x04, 0xec, 0x52, 0x00, 0x54, 0x34, 0x00, 0xa0, 0x08, 0x00, 0xa0, 0x01, 0x00, 0x30, 0x06, 0x00,
+    0x4c, 0x07, 0x00, 0x84, 0x00, 0x01, 0xb4, 0x02, 0x0f, 0x08, 0x0a, 0x0c, 0x04, 0x24, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x54, 0x01, 0x00, 0x50, 0x13, 0x00, 0x48, 0x02, 0x00, 0x4c,
+    0x06, 0x00, 0x60, 0x01, 0x00, 0xf4, 0x02, 0x00, 0x50, 0x01, 0x00, 0xdc, 0x00, 0x0c, 0xf0, 0x00,
+    0x0f, 0x10, 0x00, 0x05, 0x00, 0x2c, 0x00, 0x00, 0x54, 0x00, 0x00, 0xac, 0x03, 0x00, 0x3c, 0x18,
+    0x00, 0xa4, 0x0b, 0x00, 0x30, 0x03, 0x00, 0x88, 0x07, 0x00, 0x08, 0x1a, 0x00, 0xf8, 0x05, 0x00,
+    0x24, 0x01, 0x00, 0xac, 0x01, 0x00, 0x60, 0x00, 0x00, 0x94, 0x07, 0x00, 0x44, 0x12, 0x00, 0x78,
+    0x00, 0x05, 0xec, 0x0c, 0x11, 0xb3, 0xe4, 0xad, 0x00, 0x0c, 0xdb, 0x44, 0xaf, 0xbd, 0xdf, 0xcf,
+    0x0c, 0x01, 0x00, 0xf4, 0xcb, 0x00, 0x3c, 0x13, 0x20, 0x11, 0x0c, 0x24, 0x02, 0x03, 0x48, 0x0c,
+    0x00, 0x84, 0x13, 0x00, 0x20, 0x0a, 0x04, 0x58, 0x00, 0x00, 0x08, 0x02, 0x00, 0x58, 0x00, 0x0f,
+    0x04, 0x00, 0x09, 0x00, 0x2c, 0x04, 0x00, 0x04, 0x00, 0x00, 0x24, 0x00, 0x00, 0x78, 0x07, 0x00,
+    0xb0, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x44, 0x00, 0x00, 0xb8,
+    0x04, 0x04, 0x14, 0x01, 0x00, 0x74, 0x02, 0x00, 0xf0, 0x06, 0x00, 0xdc, 0x04, 0x00, 0xb8, 0x00,
+    0x04, 0x3c, 0x01, 0x00, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00, 0x00, 0xd4, 0x00, 0x00,
+    0x88, 0x07, 0x00, 0xe4, 0x00, 0x00, 0xec, 0x00, 0x00, 0x50, 0x08, 0x00, 0xbc, 0x02, 0x00, 0x94,
+    0x05, 0x00, 0xa0, 0x01, 0x0f, 0x84, 0x07, 0x25, 0x00, 0x68, 0x01, 0x00, 0x64, 0x00, 0x00, 0xd0,
+    0x04, 0x01, 0x54, 0x01, 0x12, 0xe6, 0x40, 0x16, 0x00, 0xe0, 0x12, 0x00, 0x74, 0x05, 0x00, 0x58,
+    0x03, 0x00, 0xa0, 0x07, 0x00, 0xb8, 0x00, 0x01, 0x98, 0x00, 0x0f, 0xdc, 0x07, 0x08, 0x04, 0xb0,
+    0x00, 0x00, 0xc4, 0x00, 0x00, 0x1c, 0x0d, 0x04, 0x3c, 0x06, 0x01, 0x08, 0x0f, 0x00, 0x54, 0x01,
+    0x11, 0xb3, 0x70, 0xef, 0x00, 0xc4, 0x91, 0x00, 0xbc, 0x64, 0x00, 0x00, 0x18, 0x04, 0x08, 0x09,
+    0x04, 0x84, 0x01, 0x0f, 0x08, 0x00, 0x15, 0x00, 0x98, 0xac, 0x00, 0xcc, 0x05, 0x10, 0x05, 0x48,
+    0x0d, 0x21, 0x09, 0xb7, 0x8c, 0x2c, 0x01, 0x84, 0xd8, 0x00, 0xa0, 0x08, 0x00, 0x04, 0x00, 0x00,
+    0x40, 0x05, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0xa4, 0x0e, 0x00,
+    0x40, 0x01, 0x61, 0x1a, 0xb7, 0xff, 0x0e, 0x17, 0xb6, 0xcc, 0xc4, 0x00, 0xb4, 0xef, 0x00, 0x04,
+    0x17, 0x00, 0x98, 0xe0, 0x00, 0xf0, 0xed, 0x00, 0x08, 0xd7, 0x0f, 0x94, 0x00, 0x15, 0x00, 0x84,
+    0x87, 0x00, 0x84, 0x12, 0x00, 0x9c, 0x94, 0x0f, 0x84, 0x07, 0x36, 0x00, 0x44, 0x02, 0x00, 0x2c,
+    0x03, 0x00, 0x64, 0x0c, 0x00, 0xa0, 0x0d, 0x00, 0x34, 0x08, 0x00, 0x14, 0x1c, 0x41, 0x1d, 0xb7,
+    0xff, 0x01, 0xbc, 0xcd, 0x00, 0x58, 0x01, 0x04, 0x04, 0x00, 0x00, 0xf4, 0x04, 0x04, 0x04, 0x00,
+    0x03, 0x94, 0x4f, 0x00, 0x60, 0x28, 0x00, 0x04, 0x08, 0x00, 0x68, 0x0e, 0x00, 0x30, 0x03, 0x00,
+    0x2c, 0x05, 0x00, 0x80, 0x02, 0x00, 0xf4, 0x01, 0x00, 0xfc, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x00,
+    0x5c, 0x05, 0x00, 0xec, 0x01, 0x00, 0x78, 0x02, 0x00, 0xfc, 0x01, 0x00, 0x1c, 0xa2, 0x00, 0x44,
+    0x0b, 0x00, 0x7c, 0x02, 0x00, 0xb4, 0x02, 0x00, 0xf4, 0x05, 0x00, 0x9c, 0x09, 0x00, 0xac, 0x0c,
+    0x00, 0x08, 0x00, 0x00, 0x50, 0x10, 0x00, 0x50, 0x20, 0x00, 0x68, 0x15, 0x00, 0xa0, 0x1c, 0x03,
+    0xe8, 0x0a, 0x00, 0xb0, 0x66, 0x00, 0xa4, 0x17, 0x00, 0x38, 0xbb, 0x00, 0x70, 0xd8, 0x00, 0x18,
+    0x0c, 0x00, 0xc4, 0xc2, 0x33, 0x50, 0x56, 0xbe, 0xf8, 0xe9, 0x03, 0xf8, 0x1a, 0x00, 0x24, 0x2d,
+    0x00, 0x38, 0x4e, 0x00, 0x98, 0x0b, 0x00, 0xac, 0x06, 0x00, 0xe8, 0x02, 0x00, 0x90, 0x0e, 0x00,
+    0x5c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x8c, 0x04, 0x00, 0xb0, 0x02, 0x00,
+    0xa4, 0x00, 0x00, 0xac, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x78, 0x02, 0x0f, 0x84, 0x07, 0x25, 0x00,
+    0x08, 0x01, 0x00, 0xa4, 0x05, 0x00, 0x58, 0x00, 0x00, 0xf8, 0x15, 0x00, 0x58, 0x04, 0x00, 0x78,
+    0x07, 0x00, 0x3c, 0x01, 0x00, 0xdc, 0x00, 0x00, 0x64, 0x08, 0x00, 0xa4, 0x0a, 0x00, 0x7c, 0x08,
+    0x00, 0xe8, 0x02, 0x00, 0x74, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x24, 0x00,
+    0x00, 0x4c, 0x01, 0x00, 0xc4, 0x01, 0x00, 0xd8, 0x00, 0x0f, 0x8c, 0x16, 0x29, 0x04, 0x84, 0x07,
+    0x00, 0x60, 0x1d, 0x01, 0x60, 0x01, 0x12, 0xb2, 0xe0, 0x09, 0x00, 0xf0, 0x2a, 0x00, 0x5c, 0x00,
+    0x00, 0x64, 0x00, 0x00, 0x70, 0x00, 0x00, 0x08, 0x01, 0x0f, 0x94, 0x00, 0x0a, 0x00, 0xb8, 0x52,
+    0x03, 0xfc, 0x83, 0x00, 0x6c, 0x07, 0x00, 0xf8, 0x0e, 0x00, 0xd8, 0x0b, 0x00, 0x3c, 0x2c, 0x00,
+    0xb8, 0x20, 0x00, 0x7c, 0x01, 0x00, 0x20, 0x02, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x4c,
+    0x00, 0x0e, 0x12, 0xf8, 0x1c, 0x20, 0x00, 0x58, 0x02, 0x00, 0x2c, 0x04, 0x0f, 0x84, 0x07, 0x1e,
+    0x07, 0xb0, 0x02, 0x01, 0xd8, 0x00, 0x12, 0xb4, 0x2c, 0xda, 0x00, 0x28, 0x0b, 0x00, 0x74, 0x01,
+    0x00, 0xbc, 0x0a, 0x00, 0xe0, 0x00, 0x00, 0x08, 0x02, 0x00, 0xb4, 0x0f, 0x00, 0xa0, 0x0f, 0x00,
+    0xec, 0x00, 0x04, 0x84, 0x01, 0x00, 0xf4, 0x00, 0x0f, 0xa4, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x00,
+    0x84, 0x01, 0x00, 0x28, 0x00, 0x01, 0x04, 0x00, 0x0f, 0xc0, 0x04, 0x08, 0x00, 0x2c, 0x00, 0x0f,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x78, 0x00, 0x00, 0x90, 0x28, 0x00, 0xf8, 0x02, 0x22,
+    0x7f, 0xda, 0x28, 0x16, 0x00, 0x44, 0x49, 0x01, 0xfc, 0x0a, 0x51, 0xb1, 0xff, 0x05, 0x01, 0xb5,
+    0x50, 0xdc, 0x00, 0x84, 0x16, 0x00, 0x34, 0x80, 0x0f, 0x38, 0x04, 0x15, 0x00, 0xf4, 0xf0, 0x00,
+    0x48, 0x13, 0x00, 0x98, 0x25, 0x00, 0xc4, 0x0b, 0x00, 0xc4, 0x70, 0x00, 0xa4, 0xad, 0x05, 0x3c,
+    0x5a, 0x00, 0x60, 0x00, 0x00, 0xac, 0x17, 0x00, 0x4c, 0x0b, 0x0c, 0x24, 0x06, 0x0f, 0xb0, 0x00,
+    0x05, 0x00, 0x18, 0x00, 0x04, 0xf8, 0x00, 0x00, 0xbc, 0x00, 0x00, 0xa4, 0x09, 0x00, 0x24, 0x14,
+    0x00, 0x2c, 0x16, 0x00, 0x80, 0x07, 0x00, 0x50, 0x01, 0x00, 0x00, 0x02, 0x00, 0x08, 0x04, 0x00,
+    0xe8, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x30, 0x00, 0x01,
+    0x08, 0x01, 0x16, 0xed, 0x48, 0xc0, 0x00, 0x84, 0x27, 0x00, 0xb0, 0x0f, 0x00, 0xac, 0x0a, 0x00,
+    0x14, 0x0a, 0x00, 0x8c, 0x06, 0x00, 0xfc, 0x05, 0x00, 0xa8, 0x08, 0x00, 0xc8, 0x03, 0x00, 0xd0,
+    0x9b, 0x00, 0x50, 0x03, 0x00, 0x50, 0x1d, 0x07, 0x68, 0xb5, 0x00, 0xbc, 0xa8, 0x00, 0x68, 0x05,
+    0x08, 0x28, 0x01, 0x00, 0x3c, 0xe4, 0x00, 0x40, 0x6a, 0x02, 0xa4, 0x0b, 0x00, 0x84, 0x2b, 0x11,
+    0xb6, 0x5c, 0x72, 0x10, 0x01, 0x88, 0x03, 0x04, 0x58, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x58, 0x00,
+    0x00, 0xc4, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x34, 0x02, 0x00, 0x04, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x40, 0x05, 0x00, 0x00, 0x01, 0x00, 0x20, 0x04, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x16, 0x00,
+    0xc8, 0x00, 0x00, 0xdc, 0x04, 0x00, 0xd0, 0x04, 0x00, 0x40, 0x07, 0x00, 0xe8, 0x13, 0x00, 0xa4,
+    0x00, 0x00, 0x38, 0x1f, 0x01, 0x28, 0x00, 0x03, 0xd8, 0x0b, 0x00, 0x10, 0x01, 0x00, 0x1c, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x34, 0x00, 0x00, 0x8c, 0x0b, 0x00, 0x2c, 0x00, 0x00,
+    0x24, 0x07, 0x00, 0x48, 0x24, 0x00, 0x68, 0x06, 0x00, 0x38, 0x3b, 0x00, 0xb0, 0x02, 0x0f, 0xf0,
+    0x0b, 0x0d, 0x00, 0x50, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x60, 0x00, 0x00, 0x88, 0x01, 0x00,
+    0x64, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x6c, 0x05, 0x00, 0xd8, 0x08, 0x00, 0x24, 0x14, 0x00, 0x7c,
+    0x09, 0x0f, 0x58, 0x00, 0x15, 0x00, 0xc8, 0x07, 0x00, 0xa4, 0x04, 0x00, 0xf8, 0x08, 0x00, 0x00,
+    0x01, 0x00, 0xb4, 0x2f, 0x00, 0x40, 0x0d, 0x00, 0x24, 0x2c, 0x01, 0x08, 0x0f, 0x00, 0x1c, 0x0b,
+    0x02, 0x34, 0x19, 0x00, 0xcc, 0x7a, 0x00, 0xb0, 0x06, 0x00, 0x70, 0x16, 0x08, 0x84, 0x01, 0x0f,
+    0x0c, 0x00, 0x11, 0x40, 0xa0, 0xac, 0xd8, 0x66, 0x5c, 0x1c, 0x00, 0xc4, 0x07, 0x11, 0x04, 0xb4,
+    0x10, 0x00, 0x58, 0x00, 0x04, 0xcc, 0x03, 0x0f, 0x08, 0x00, 0x23, 0x00, 0x60, 0x92, 0x00, 0x50,
+    0x00, 0x00, 0x38, 0xd4, 0x31, 0x86, 0x90, 0xcd, 0x3c, 0xe9, 0x3d, 0xbf, 0xcd, 0xe6, 0xdc, 0x55,
+    0x0f, 0xa0, 0x00, 0x09, 0x00, 0xa0, 0x25, 0x00, 0xd4, 0x00, 0x0f, 0x84, 0x07, 0x33, 0x03, 0x2c,
+    0x04, 0x00, 0x88, 0x44, 0x00, 0x80, 0x09, 0x00, 0x7c, 0x03, 0x00, 0xfc, 0x01, 0x00, 0x9c, 0x01,
+    0x00, 0xf0, 0x01, 0x00, 0x84, 0x09, 0x01, 0x84, 0x07, 0x00, 0xf0, 0x00, 0x0f, 0x84, 0x07, 0x01,
+    0x12, 0xb4, 0xa4, 0x09, 0x00, 0xe0, 0xc9, 0x00, 0xe8, 0x2a, 0x00, 0x94, 0x22, 0x00, 0xc4, 0x03,
+    0x00, 0xb4, 0x14, 0x00, 0x90, 0x02, 0x00, 0xec, 0x01, 0x00, 0xf8, 0x01, 0x00, 0x94, 0x02, 0x0f,
+    0x14, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x70, 0x03, 0x00, 0x00, 0x02, 0x00,
+    0x50, 0x03, 0x00, 0x24, 0x11, 0x00, 0xc0, 0x03, 0x00, 0x80, 0x02, 0x00, 0x98, 0x0f, 0x00, 0x38,
+    0x07, 0x00, 0x18, 0x08, 0x00, 0xbc, 0xd4, 0x00, 0x60, 0x03, 0x00, 0xc4, 0x0c, 0x01, 0x14, 0x41,
+    0x00, 0xf0, 0x10, 0x11, 0xb3, 0x50, 0x01, 0x00, 0xc4, 0xf7, 0x00, 0xa8, 0x5e, 0x00, 0xec, 0xdf,
+    0x00, 0x50, 0x01, 0x00, 0xf0, 0x01, 0x00, 0x3c, 0x09, 0x02, 0x64, 0x03, 0x12, 0xb2, 0x44, 0x0c,
+    0x00, 0x20, 0xa4, 0x00, 0x70, 0x02, 0x00, 0xf4, 0x09, 0x00, 0x50, 0x00, 0x04, 0x5c, 0x00, 0x00,
+    0x60, 0x00, 0x08, 0x04, 0x00, 0x00, 0xc4, 0x06, 0x00, 0x20, 0x00, 0x00, 0xa8, 0x0e, 0x00, 0x28,
+    0x07, 0x00, 0x30, 0x07, 0x00, 0x38, 0x07, 0x00, 0xc8, 0x00, 0x00, 0xb0, 0x14, 0x00, 0x3c, 0x03,
+    0x0f, 0x84, 0x07, 0x21, 0x00, 0xec, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x01, 0x00, 0x6c, 0x01,
+    0x00, 0x58, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x4c, 0x04, 0x04, 0xc8, 0x03, 0x00,
+    0xc4, 0x12, 0x00, 0x64, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0x38, 0x01, 0x09, 0x00, 0x20, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x98, 0x00, 0x00, 0x28, 0x00, 0x00, 0x44, 0x01, 0x00, 0x10, 0x03, 0x00, 0xc0,
+    0x00, 0x00, 0xa8, 0x08, 0x00, 0xe8, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x6c, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x7c, 0x03, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x6c, 0x06, 0x00,
+    0xd0, 0x0a, 0x0f, 0x84, 0x07, 0x09, 0x00, 0x88, 0x04, 0x00, 0x64, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0x34, 0x00, 0x0c, 0x48, 0x00, 0x08, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x14,
+    0x00, 0x00, 0x84, 0x05, 0x04, 0x84, 0x07, 0x00, 0x54, 0x15, 0x04, 0x84, 0x07, 0x00, 0x38, 0x0c,
+    0x00, 0x48, 0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x01, 0x4c, 0x00,
+    0x0f, 0x84, 0x07, 0x40, 0x00, 0x18, 0x0b, 0x00, 0x98, 0x48, 0x00, 0x1c, 0x08, 0x00, 0xa4, 0x0f,
+    0x00, 0x68, 0x08, 0x00, 0xf8, 0x01, 0x00, 0x1c, 0x0c, 0x04, 0x90, 0x15, 0x00, 0x6c, 0x04, 0x00,
+    0xf0, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xa0, 0x00, 0x05, 0x04, 0x18, 0x00, 0x00, 0x24, 0x00, 0x05,
+    0x04, 0x00, 0x03, 0x58, 0x03, 0x04, 0x1c, 0x00, 0x0f, 0x08, 0x00, 0x0d, 0x04, 0x38, 0x00, 0x00,
+    0x1c, 0x02, 0x00, 0x80, 0x05, 0x00, 0x14, 0x08, 0x00, 0xb8, 0x14, 0x40, 0x5e, 0xca, 0xff, 0x01,
+    0x00, 0x30, 0x01, 0x98, 0x10, 0x00, 0x80, 0x03, 0x51, 0xb2, 0xff, 0x09, 0x07, 0xb5, 0xc0, 0xdf,
+    0x02, 0x84, 0x07, 0x0f, 0xe4, 0xe5, 0x1b, 0x00, 0xf0, 0x96, 0x00, 0x3c, 0xed, 0x00, 0x50, 0x4b,
+    0x00, 0x38, 0xd4, 0x00, 0x48, 0xe0, 0x11, 0x16, 0xf8, 0xe0, 0x00, 0x88, 0x06, 0x12, 0xb5, 0x7c,
+    0xd3, 0x00, 0x0c, 0x0e, 0x00, 0x08, 0x04, 0x00, 0x84, 0x02, 0x04, 0x98, 0x00, 0x0f, 0xc0, 0x00,
+    0x0e, 0x12, 0xf7, 0x24, 0x09, 0x00, 0x20, 0x02, 0x00, 0xc8, 0x03, 0x00, 0x10, 0x13, 0x00, 0x68,
+    0x06, 0x00, 0xcc, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x40, 0x00, 0x01, 0x4c, 0x00, 0x0f, 0x18, 0x01,
+    0x0c, 0x00, 0xec, 0x01, 0x00, 0x28, 0x00, 0x00, 0x08, 0x01, 0x00, 0x70, 0x09, 0x00, 0xd0, 0x07,
+    0x00, 0x90, 0x00, 0x00, 0x58, 0x0f, 0x00, 0xa0, 0x13, 0x00, 0x5c, 0x51, 0x00, 0x8c, 0x06, 0x00,
+    0xcc, 0x09, 0x00, 0x14, 0x00, 0x00, 0xdc, 0x1f, 0x00, 0x28, 0x2d, 0x00, 0xc0, 0x03, 0x40, 0x64,
+    0xcc, 0xff, 0x01, 0xb4, 0x04, 0x00, 0xb0, 0x06, 0x00, 0x0c, 0x26, 0x01, 0xc4, 0x15, 0x11, 0xb3,
+    0x24, 0xd4, 0x0c, 0x84, 0x07, 0x00, 0x3c, 0x01, 0x00, 0x84, 0x08, 0x09, 0x94, 0x17, 0x00, 0x54,
+    0x67, 0x00, 0x38, 0x03, 0x01, 0x58, 0x00, 0x12, 0xce, 0x00, 0xc5, 0x00, 0x58, 0x00, 0x0f, 0x04,
+    0x00, 0x05, 0x00, 0x2c, 0x02, 0x00, 0x6c, 0x03, 0x00, 0x38, 0x02, 0x0c, 0x40, 0x0b, 0x00, 0xf0,
+    0x00, 0x00, 0x84, 0x07, 0x00, 0x08, 0x00, 0x00, 0x04, 0x01, 0x0c, 0x84, 0x07, 0x00, 0x20, 0x01,
+    0x0c, 0x60, 0x01, 0x00, 0xf8, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb8, 0x07, 0x04, 0x48, 0x01, 0x00,
+    0x74, 0x03, 0x00, 0x20, 0x14, 0x00, 0xa4, 0x1a, 0x00, 0x60, 0x2c, 0x00, 0x2c, 0x07, 0x00, 0x4c,
+    0x00, 0x00, 0x64, 0x01, 0x00, 0x38, 0x05, 0x00, 0x3c, 0x03, 0x00, 0x34, 0x01, 0x00, 0x68, 0x00,
+    0x0f, 0x04, 0x00, 0x11, 0x00, 0x60, 0x00, 0x00, 0x98, 0x03, 0x00, 0x60, 0x01, 0x04, 0x84, 0x07,
+    0x00, 0x18, 0x08, 0x00, 0x58, 0x00, 0x00, 0x64, 0x37, 0x00, 0x7c, 0x0a, 0x0f, 0x58, 0x00, 0x09,
+    0x00, 0x40, 0x00, 0x00, 0x68, 0x00, 0x00, 0x10, 0x05, 0x00, 0xf4, 0x10, 0x00, 0x98, 0x3a, 0x00,
+    0xcc, 0x16, 0x00, 0xa4, 0x91, 0x00, 0xc0, 0x1e, 0x01, 0xfc, 0x08, 0x00, 0x2c, 0x06, 0x11, 0xb3,
+    0x1c, 0xfa, 0x00, 0x4c, 0xe6, 0x39, 0x88, 0x93, 0xcf, 0xe0, 0x06, 0x00, 0x14, 0x18, 0x00, 0xe0,
+    0x7a, 0x00, 0x38, 0x0d, 0x00, 0x74, 0xb9, 0x0c, 0x04, 0x00, 0x00, 0xc4, 0x14, 0x00, 0x04, 0x00,
+    0x00, 0x10, 0xb4, 0x00, 0x8c, 0xd3, 0x00, 0xe0, 0xd5, 0x00, 0x18, 0xcc, 0x00, 0x98, 0x55, 0x02,
+    0xd0, 0x05, 0x00, 0x60, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x02, 0xc0, 0x07, 0x00, 0xe4, 0xaa, 0x00,
+    0xd8, 0x98, 0x00, 0xd8, 0xad, 0x00, 0x70, 0xaf, 0x21, 0xc2, 0xd0, 0x90, 0xd5, 0x0f, 0xa8, 0xbf,
+    0x06, 0x0f, 0x8c, 0x07, 0x01, 0x00, 0x38, 0x0f, 0x00, 0x94, 0x96, 0x00, 0x80, 0xd6, 0x0f, 0x08,
+    0x0f, 0x2e, 0x00, 0x50, 0x01, 0x00, 0x04, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x7c, 0x01, 0x00, 0x30,
+    0x03, 0x00, 0x34, 0x02, 0x00, 0x8c, 0x05, 0x00, 0x74, 0x17, 0x00, 0x8c, 0x27, 0x01, 0xd8, 0x08,
+    0x51, 0xb4, 0xff, 0x0a, 0x0a, 0xb5, 0x18, 0xbf, 0x00, 0xc4, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x68,
+    0x19, 0x00, 0xd8, 0xcb, 0x00, 0xd0, 0x12, 0x10, 0x03, 0xb8, 0x16, 0x00, 0x9c, 0x0e, 0x00, 0x20,
+    0x07, 0x00, 0xb8, 0x09, 0x00, 0x28, 0x02, 0x00, 0x64, 0x06, 0x00, 0xec, 0x01, 0x00, 0xb8, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x68, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x80, 0x00, 0x00, 0x2c, 0x00,
+    0x00, 0x74, 0x0e, 0x00, 0xa0, 0x02, 0x00, 0x34, 0x16, 0x00, 0xb8, 0x11, 0x00, 0xdc, 0x10, 0x00,
+    0xac, 0x3d, 0x00, 0x38, 0x1d, 0x00, 0x64, 0x09, 0x00, 0xa0, 0x0d, 0x12, 0x1a, 0xb8, 0xcd, 0x00,
+    0xa4, 0x5e, 0x00, 0x8c, 0x00, 0x00, 0x38, 0xf0, 0x00, 0x24, 0x1f, 0x00, 0x98, 0x13, 0x00, 0x84,
+    0x07, 0x00, 0xf8, 0x1a, 0x00, 0xe8, 0x0a, 0x00, 0x00, 0x20, 0x00, 0x50, 0xbe, 0x00, 0xe8, 0xb5,
+    0x50, 0x12, 0x17, 0xb6, 0xff, 0x01, 0xcc, 0x10, 0x00, 0xac, 0x27, 0x00, 0xd4, 0x00, 0x00, 0xac,
+    0x29, 0x00, 0xe8, 0x0f, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x68, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0xe4, 0xdb, 0x00, 0x88, 0x07, 0x00, 0x28, 0x07, 0x00, 0x14, 0x03, 0x00, 0xf0, 0x02, 0x00,
+    0x58, 0x03, 0x00, 0x3c, 0x03, 0x0f, 0x84, 0x07, 0x29, 0x04, 0xec, 0x00, 0x00, 0x6c, 0x01, 0x00,
+    0x58, 0x00, 0x00, 0x50, 0x0a, 0x01, 0x04, 0x00, 0x03, 0x40, 0xbc, 0x00, 0x08, 0x01, 0x00, 0x24,
+    0x00, 0x0f, 0x2c, 0x01, 0x05, 0x0c, 0x18, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x88, 0x03, 0x00, 0x4c,
+    0x00, 0x0f, 0x84, 0x07, 0x35, 0x01, 0xcc, 0x13, 0x12, 0xb4, 0xa0, 0x38, 0x00, 0x04, 0x06, 0x00,
+    0x40, 0x16, 0x00, 0x18, 0x0c, 0x00, 0x78, 0x13, 0x00, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x08,
+    0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0xd4, 0x07, 0x00, 0xc4, 0x00, 0x00, 0xac, 0x03, 0x00, 0xd8,
+    0x03, 0x00, 0xb4, 0x3b, 0x00, 0x48, 0x04, 0x00, 0xe4, 0x04, 0x00, 0xfc, 0x08, 0x00, 0x4c, 0x00,
+    0x00, 0x08, 0x0f, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x48, 0x00, 0x05, 0x00, 0x18, 0x00,
+    0x00, 0xdc, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x50, 0x00, 0x00, 0x98, 0x05, 0x0f, 0x08, 0x0f, 0x19,
+    0x00, 0xa4, 0x8b, 0x00, 0x20, 0x2d, 0x00, 0xb8, 0x16, 0x00, 0xf0, 0x17, 0x00, 0x94, 0x12, 0x00,
+    0x04, 0x00, 0x00, 0xc8, 0x05, 0x00, 0xac, 0x02, 0x00, 0xc0, 0x1a, 0x00, 0xe0, 0x00, 0x00, 0xd4,
+    0x05, 0x00, 0x90, 0x07, 0x00, 0x54, 0x19, 0x00, 0x84, 0x05, 0x00, 0x04, 0x0a, 0x00, 0x88, 0x02,
+    0x00, 0x90, 0x02, 0x0f, 0x90, 0x01, 0x1d, 0x00, 0xb4, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0x04,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x07, 0x00, 0x48, 0x0e, 0x00, 0x18, 0x05,
+    0x00, 0xac, 0x02, 0xe1, 0x19, 0xb7, 0xff, 0x05, 0x14, 0xb6, 0xff, 0x12, 0x16, 0xb6, 0xff, 0x1b,
+    0x1d, 0xb6, 0xbc, 0xdf, 0x00, 0xd8, 0x13, 0x00, 0xf8, 0x20, 0x00, 0x7c, 0x19, 0x0f, 0x24, 0x04,
+    0x01, 0x0f, 0x14, 0x00, 0x0d, 0x00, 0x7c, 0xad, 0x00, 0x90, 0x15, 0x00, 0x3c, 0x03, 0x00, 0x4c,
+    0xe7, 0x01, 0x48, 0x04, 0x00, 0xa0, 0x25, 0x00, 0x08, 0x01, 0x00, 0x8c, 0x12, 0x00, 0x84, 0x00,
+    0x00, 0x8c, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xd0, 0x00, 0x15, 0x00, 0x44, 0x04,
+    0x00, 0x38, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f,
+    0x40, 0x00, 0x15, 0x00, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x38, 0x00, 0x00, 0x5c, 0x1f, 0x00,
+    0x88, 0x01, 0x00, 0x8c, 0x20, 0x00, 0x94, 0x03, 0x00, 0x60, 0x04, 0x00, 0x28, 0x2c, 0x00, 0x60,
+    0x07, 0x00, 0x40, 0x09, 0x00, 0x64, 0x14, 0x00, 0x78, 0x3a, 0x04, 0xc8, 0x03, 0x00, 0x28, 0x04,
+    0x00, 0x34, 0x0c, 0x00, 0x8c, 0xed, 0x21, 0x17, 0xb6, 0x44, 0xbc, 0x00, 0x60, 0xe0, 0x00, 0x08,
+    0x06, 0x00, 0xd4, 0x05, 0x08, 0x14, 0x01, 0x00, 0x50, 0xd1, 0x00, 0x4c, 0x85, 0x00, 0x6c, 0x8f,
+    0x22, 0x19, 0x1b, 0x5c, 0x01, 0x01, 0x4c, 0xeb, 0x00, 0xe4, 0x1a, 0x08, 0x58, 0x00, 0x04, 0x5c,
+    0x00, 0x0c, 0x24, 0x04, 0x00, 0x10, 0x00, 0x00, 0xec, 0x07, 0x00, 0x60, 0x1c, 0x00, 0x7c, 0x06,
+    0x00, 0xe8, 0x1a, 0x00, 0x8c, 0x06, 0x00, 0x50, 0x0b, 0x04, 0xf4, 0x0a, 0x00, 0x2c, 0x04, 0x00,
+    0xb4, 0x02, 0x00, 0x30, 0x07, 0x00, 0x10, 0x05, 0x00, 0xbc, 0x11, 0x00, 0xbc, 0x1a, 0x00, 0xc4,
+    0x1a, 0x00, 0x40, 0x04, 0x00, 0xe4, 0x00, 0x00, 0xec, 0x00, 0x00, 0x04, 0x00, 0x08, 0x20, 0x01,
+    0x04, 0x3c, 0x03, 0x00, 0x20, 0x00, 0x00, 0x2c, 0x2b, 0x00, 0x2c, 0x03, 0x00, 0x88, 0x04, 0x00,
+    0x08, 0x01, 0x00, 0xe4, 0x0c, 0x00, 0x00, 0x03, 0x00, 0xa4, 0x05, 0x00, 0x58, 0x01, 0x00, 0x3c,
+    0x00, 0x00, 0x20, 0x03, 0x08, 0x40, 0x00, 0x0f, 0x0c, 0x00, 0x09, 0x01, 0x30, 0x00, 0x07, 0x50,
+    0x1b, 0x00, 0x6c, 0x0d, 0x00, 0xf0, 0x16, 0x00, 0x5c, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xac, 0x00,
+    0x00, 0x58, 0x00, 0x00, 0x70, 0x03, 0x0f, 0x58, 0x00, 0x01, 0x01, 0x40, 0x00, 0x03, 0xb8, 0xb4,
+    0x00, 0x30, 0x12, 0x00, 0x40, 0x00, 0x00, 0xd8, 0x0c, 0x00, 0x30, 0x04, 0x61, 0x17, 0xb7, 0xff,
+    0x08, 0x15, 0xb6, 0x7c, 0x07, 0x00, 0xf0, 0xd4, 0x00, 0x90, 0x23, 0x00, 0xe4, 0x91, 0x35, 0x9f,
+    0xac, 0xd8, 0x70, 0xe3, 0x00, 0x84, 0x01, 0x00, 0xcc, 0x95, 0x00, 0x18, 0x28, 0x31, 0x46, 0x4d,
+    0xbc, 0xb4, 0xc7, 0x00, 0xac, 0x2e, 0x08, 0x04, 0x00, 0x00, 0x74, 0x98, 0x00, 0x04, 0x00, 0x31,
+    0x49, 0x50, 0xbc, 0x9c, 0xfb, 0x00, 0x6c, 0xf0, 0x00, 0x70, 0xdd, 0x11, 0x01, 0x08, 0x0f, 0x00,
+    0x88, 0x0a, 0x0f, 0x04, 0x00, 0x25, 0x02, 0xb8, 0x07, 0x00, 0x8c, 0x27, 0x00, 0xc0, 0x2b, 0x00,
+    0x7c, 0x92, 0x0f, 0xa0, 0xbf, 0x09, 0x00, 0xac, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x0f, 0x84, 0x07,
+    0x42, 0x00, 0xb8, 0x01, 0x01, 0x78, 0x01, 0x00, 0x48, 0x41, 0x03, 0xcc, 0x05, 0x00, 0xe0, 0x09,
+    0x00, 0xa8, 0x04, 0x01, 0x84, 0x07, 0x02, 0x4c, 0xdd, 0x00, 0x58, 0x01, 0x00, 0xdc, 0x06, 0x00,
+    0xc4, 0x9a, 0x00, 0xb8, 0xfc, 0x00, 0x2c, 0x35, 0x00, 0x20, 0xa7, 0x10, 0x0d, 0xec, 0x04, 0x00,
+    0xe4, 0x13, 0x00, 0xcc, 0x32, 0x00, 0xcc, 0x04, 0x00, 0x0c, 0x0f, 0x0f, 0xc8, 0x03, 0x19, 0x00,
+    0xdc, 0x01, 0x00, 0x80, 0x00, 0x00, 0xf0, 0x04, 0x40, 0x9a, 0xea, 0xff, 0x01, 0x84, 0x04, 0x00,
+    0xa0, 0x09, 0x01, 0x90, 0x1e, 0x02, 0xf0, 0x0e, 0x05, 0x04, 0x2e, 0x21, 0x00, 0xb4, 0x98, 0xa7,
+    0x00, 0xbc, 0xec, 0x00, 0x34, 0xe8, 0x00, 0x30, 0x09, 0x00, 0xa8, 0x4f, 0x04, 0x90, 0x04, 0x71,
+    0xc8, 0xd8, 0xeb, 0xff, 0xae, 0xbc, 0xdf, 0xf0, 0xd6, 0x00, 0x98, 0xe4, 0x00, 0x7c, 0x21, 0x00,
+    0x94, 0x18, 0x02, 0x44, 0x09, 0x00, 0x0c, 0x09, 0x00, 0x04, 0x00, 0x02, 0x90, 0x01, 0x02, 0x14,
+    0x00, 0x00, 0xbc, 0xe5, 0x00, 0xd8, 0x01, 0x04, 0x14, 0x00, 0x00, 0x20, 0x00, 0x03, 0x64, 0x1f,
+    0x00, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x7c, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x58, 0x03, 0x00,
+    0x1c, 0x03, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x0f, 0xc0,
+    0x02, 0x11, 0x00, 0x64, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x00, 0xec, 0x02, 0x00, 0x04, 0x00, 0x0f,
+    0x1c, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x11, 0x00, 0x3c, 0x01, 0x00, 0x40, 0x00, 0x0f, 0x84, 0x07,
+    0x31, 0x00, 0xb0, 0x0e, 0x00, 0x54, 0x12, 0x00, 0xfc, 0x05, 0x00, 0xa8, 0x06, 0x00, 0x84, 0x01,
+    0x00, 0xec, 0x0b, 0x00, 0xf8, 0x03, 0x00, 0xd0, 0x01, 0x00, 0x58, 0x05, 0x00, 0x94, 0x00, 0x00,
+    0x74, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x24, 0x01, 0x00, 0x8c, 0x04, 0x00,
+    0x88, 0x09, 0x00, 0x54, 0x0e, 0x00, 0xa0, 0x04, 0x00, 0x2c, 0x01, 0x00, 0x1c, 0x02, 0x00, 0xb8,
+    0x0c, 0x00, 0x58, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x48, 0x00,
+    0x05, 0x00, 0x18, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x7c, 0x01, 0x00, 0xd0, 0x04, 0x01, 0x84, 0x07,
+    0x12, 0xdb, 0xd8, 0x13, 0x00, 0xbc, 0x31, 0x00, 0x74, 0x02, 0x01, 0xf0, 0x0c, 0x04, 0xbc, 0x01,
+    0x0b, 0x08, 0x00, 0x00, 0x9c, 0x3a, 0x00, 0xc8, 0x00, 0x00, 0xfc, 0x07, 0x00, 0xd8, 0x00, 0x00,
+    0xd0, 0x14, 0x00, 0x5c, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x04, 0x04, 0x00, 0x00, 0x34,
+    0x10, 0x00, 0xb8, 0x21, 0x00, 0x10, 0x00, 0x00, 0xe0, 0x0c, 0x00, 0xac, 0x22, 0x00, 0x44, 0x10,
+    0x00, 0x18, 0x18, 0x00, 0xf0, 0x04, 0x00, 0x5c, 0x01, 0x00, 0x9c, 0x04, 0x00, 0x90, 0x00, 0x0f,
+    0x04, 0x00, 0x41, 0x00, 0x04, 0x01, 0x00, 0xe4, 0x00, 0x00, 0x38, 0x01, 0x04, 0x5c, 0x02, 0x00,
+    0x78, 0x15, 0x00, 0x20, 0x16, 0x61, 0x00, 0xb3, 0xff, 0x12, 0x0f, 0xb5, 0xec, 0x74, 0x00, 0x48,
+    0xfd, 0x00, 0x4c, 0x31, 0x40, 0x94, 0x9f, 0xd3, 0xff, 0x58, 0x16, 0x00, 0x40, 0xc3, 0x0f, 0x28,
+    0x04, 0x05, 0x0f, 0x18, 0x00, 0x09, 0x00, 0x2c, 0x03, 0x00, 0xbc, 0xe7, 0x00, 0xe8, 0xb9, 0x20,
+    0x1d, 0x1d, 0xe4, 0x38, 0x00, 0x64, 0x03, 0x0f, 0x84, 0x07, 0x30, 0x0f, 0x1c, 0x01, 0x2d, 0x08,
+    0x08, 0x01, 0x00, 0xa8, 0x0d, 0x00, 0x0c, 0x10, 0x00, 0x00, 0x0f, 0x00, 0x58, 0x04, 0x01, 0xe8,
+    0x01, 0x00, 0xa8, 0x03, 0x08, 0x1c, 0x1b, 0x08, 0xf0, 0x01, 0x03, 0xb8, 0x03, 0x03, 0x80, 0xe2,
+    0x00, 0xac, 0x04, 0x00, 0xf0, 0x0c, 0x00, 0x2c, 0x31, 0x00, 0xe8, 0xa6, 0x08, 0x10, 0x01, 0x40,
+    0x0e, 0x10, 0x14, 0xdf, 0xb8, 0xe8, 0x00, 0x14, 0x2b, 0x00, 0x74, 0x81, 0x02, 0xf8, 0xd2, 0x00,
+    0x4c, 0x00, 0x06, 0x44, 0x00, 0x04, 0x1c, 0x04, 0x00, 0x08, 0x00, 0x01, 0x74, 0xa1, 0x01, 0x08,
+    0x05, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00, 0x12, 0xb3, 0x84, 0x95, 0x00, 0x90, 0x32, 0x00, 0x00,
+    0x14, 0x00, 0x38, 0x02, 0x00, 0x38, 0x0c, 0x00, 0x98, 0x06, 0x00, 0xb8, 0x09, 0x00, 0x08, 0x01,
+    0x00, 0x2c, 0x04, 0x00, 0xb4, 0x02, 0x00, 0xd8, 0x06, 0x00, 0x20, 0x04, 0x00, 0x28, 0x04, 0x00,
+    0x04, 0x03, 0x00, 0x38, 0x04, 0x00, 0xe4, 0x01, 0x00, 0xec, 0x01, 0x00, 0xf0, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x30, 0x00, 0x08, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x88, 0x11,
+    0x00, 0x80, 0x02, 0x00, 0x8c, 0x02, 0x00, 0xa0, 0x11, 0x00, 0x98, 0x02, 0x00, 0x90, 0x04, 0x00,
+    0x5c, 0x12, 0x00, 0x5c, 0x00, 0x00, 0x24, 0x00, 0x08, 0x38, 0x00, 0x0f, 0x0c, 0x00, 0x0d, 0x00,
+    0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x84, 0x00, 0x00, 0x44, 0x07, 0x0f, 0x84,
+    0x07, 0x25, 0x00, 0xf4, 0x48, 0x00, 0x2c, 0x03, 0x00, 0x08, 0x09, 0x01, 0x1c, 0x01, 0x11, 0xb3,
+    0xc4, 0xa0, 0x00, 0x18, 0xf8, 0x00, 0xdc, 0x09, 0x00, 0xf0, 0x18, 0x00, 0xc0, 0x4d, 0x08, 0x78,
+    0x01, 0x00, 0x10, 0x00, 0x00, 0xc8, 0xb4, 0x00, 0x10, 0x16, 0x06, 0xd0, 0x05, 0x04, 0x74, 0x01,
+    0x0f, 0x08, 0x00, 0x01, 0x00, 0x6c, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x02, 0x10, 0x02, 0x02, 0xd0,
+    0x10, 0x0f, 0x0c, 0x00, 0x0d, 0x02, 0x48, 0x00, 0x00, 0xec, 0xa0, 0x00, 0x48, 0x16, 0x00, 0x8c,
+    0xb0, 0x08, 0x9c, 0x00, 0x0f, 0x0c, 0x00, 0x19, 0x0f, 0x84, 0x07, 0x4e, 0x00, 0x70, 0x04, 0x00,
+    0x04, 0x11, 0x00, 0x7c, 0x05, 0x00, 0x10, 0x0e, 0x03, 0x60, 0x01, 0x00, 0x54, 0x0a, 0x00, 0xd4,
+    0x2f, 0x00, 0x3c, 0x10, 0x00, 0xcc, 0xd5, 0x00, 0x34, 0xc2, 0x00, 0xd0, 0x12, 0x00, 0xf4, 0x15,
+    0x06, 0xd0, 0x12, 0x12, 0xb4, 0x8c, 0xf6, 0x00, 0x40, 0x12, 0x00, 0x44, 0x03, 0x00, 0xec, 0x01,
+    0x00, 0xf4, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x20, 0x02, 0x09, 0x00, 0x20, 0x00, 0x00, 0x24, 0x11,
+    0x00, 0xe8, 0x04, 0x22, 0x9b, 0xeb, 0x84, 0x07, 0x00, 0x38, 0x05, 0x01, 0x84, 0x04, 0x00, 0x28,
+    0x13, 0x00, 0x24, 0x04, 0x04, 0x04, 0x00, 0x02, 0xb4, 0x8b, 0x00, 0x0c, 0x0c, 0x00, 0xdc, 0x1a,
+    0x00, 0x20, 0x1f, 0x00, 0x70, 0x22, 0x08, 0x44, 0x01, 0x00, 0x64, 0x04, 0x00, 0xa4, 0x04, 0x00,
+    0xf8, 0x10, 0x00, 0x94, 0x30, 0x00, 0x34, 0x81, 0x00, 0x4c, 0x03, 0x01, 0xf0, 0x0b, 0x01, 0xb8,
+    0x05, 0x00, 0x4c, 0x00, 0x06, 0xf4, 0x01, 0x02, 0x64, 0x03, 0x04, 0x10, 0x00, 0x03, 0x70, 0x00,
+    0x00, 0x60, 0x03, 0x00, 0x20, 0x1a, 0x00, 0xdc, 0x0a, 0x0f, 0x84, 0x07, 0x41, 0x00, 0xf4, 0x00,
+    0x0f, 0x04, 0x00, 0x02, 0x0f, 0xb0, 0x13, 0x0c, 0x0c, 0x48, 0x01, 0x01, 0x44, 0x00, 0x03, 0x9c,
+    0x0a, 0x00, 0xa0, 0x03, 0x00, 0xb8, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x58, 0x06, 0x00, 0xbc, 0x03,
+    0x00, 0x0c, 0x07, 0x00, 0x34, 0x00, 0x00, 0xe4, 0x05, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x7c, 0x0b, 0x00, 0x8c, 0x16, 0x04, 0x84, 0x07, 0x00, 0x80, 0x1c, 0x00, 0xf8,
+    0x17, 0x00, 0xec, 0x28, 0x00, 0x44, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x48, 0x00, 0x00, 0x24, 0x09,
+    0x00, 0x40, 0x00, 0x00, 0x18, 0x07, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x8c, 0x00, 0x00,
+    0x1c, 0x04, 0x00, 0xd8, 0x0f, 0x00, 0x8c, 0x14, 0x00, 0x60, 0x20, 0x00, 0xf8, 0x0e, 0x00, 0x4c,
+    0x00, 0x00, 0x3c, 0x0c, 0x00, 0xcc, 0x1b, 0x00, 0x30, 0x6e, 0x00, 0xec, 0x1c, 0x0f, 0x84, 0x07,
+    0x21, 0x00, 0x90, 0x04, 0x00, 0x54, 0x00, 0x00, 0x84, 0x07, 0x00, 0x5c, 0x25, 0x01, 0xcc, 0x01,
+    0x00, 0xb8, 0x01, 0x02, 0x60, 0x03, 0x02, 0xe4, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x03,
+    0x98, 0x43, 0x04, 0x00, 0x17, 0x00, 0xac, 0x20, 0x00, 0x68, 0x19, 0x00, 0x14, 0x08, 0x00, 0x08,
+    0x00, 0x00, 0x70, 0x20, 0x00, 0x2c, 0x26, 0x00, 0xe0, 0x00, 0x08, 0x04, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x34, 0x05, 0x00, 0x10, 0x0e, 0x00, 0x58, 0x05, 0x00, 0x30, 0x00, 0x00, 0x48, 0x05, 0x01,
+    0xcc, 0x02, 0x00, 0x20, 0x2b, 0x0f, 0xa4, 0x24, 0x0c, 0x0c, 0x14, 0x01, 0x0f, 0x10, 0x00, 0x11,
+    0x00, 0x84, 0x01, 0x00, 0x04, 0x00, 0x00, 0x64, 0x00, 0x00, 0x1c, 0x05, 0x00, 0xf8, 0x0c, 0x00,
+    0x60, 0x0d, 0x01, 0x7c, 0x03, 0x51, 0xb2, 0xff, 0x1d, 0x1b, 0xb6, 0x58, 0x2a, 0x00, 0xac, 0xd1,
+    0x00, 0xc4, 0x0d, 0x00, 0x9c, 0xe6, 0x39, 0xc9, 0xd8, 0xeb, 0xe4, 0x13, 0x08, 0x00, 0x03, 0x0f,
+    0x0c, 0x00, 0x0d, 0x71, 0xc7, 0xd6, 0xea, 0xff, 0x9e, 0xab, 0xd7, 0x50, 0x0b, 0x11, 0x1e, 0x84,
+    0x07, 0x00, 0xf4, 0x02, 0x0f, 0x84, 0x07, 0x34, 0x00, 0x04, 0x02, 0x08, 0x04, 0x00, 0x0f, 0x00,
+    0x01, 0x11, 0x04, 0x24, 0x00, 0x00, 0x04, 0x01, 0x00, 0x08, 0x04, 0x00, 0x68, 0x02, 0x00, 0x74,
+    0x02, 0x00, 0x24, 0x06, 0x01, 0x8c, 0x08, 0x04, 0xd4, 0x01, 0x00, 0x08, 0x00, 0x00, 0x84, 0x07,
+    0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x03, 0xe8, 0x01, 0x01, 0x08, 0x02, 0x00, 0xd4, 0x03, 0x00,
+    0x04, 0x00, 0x11, 0xb3, 0x30, 0x40, 0x00, 0x3c, 0x32, 0x00, 0x68, 0x07, 0x00, 0x2c, 0x31, 0x0f,
+    0x10, 0x01, 0x05, 0x00, 0x4c, 0x31, 0x00, 0xe0, 0x9b, 0x3f, 0x4a, 0x50, 0xbd, 0x44, 0xf5, 0x00,
+    0x04, 0x5c, 0x00, 0x00, 0x8c, 0xa4, 0x00, 0xa8, 0x0b, 0x04, 0x70, 0x00, 0x00, 0x64, 0x00, 0x03,
+    0xc8, 0x25, 0x00, 0x44, 0x11, 0x00, 0x10, 0x17, 0x00, 0x94, 0x02, 0x00, 0x80, 0x07, 0x00, 0x1c,
+    0x2f, 0x00, 0xfc, 0x11, 0x00, 0xd0, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x3c, 0x02,
+    0x00, 0x50, 0x02, 0x0f, 0x84, 0x07, 0x21, 0x00, 0x48, 0x00, 0x00, 0x90, 0x05, 0x00, 0xcc, 0x0a,
+    0x00, 0x90, 0x13, 0x00, 0x64, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3c, 0x03, 0x00, 0xb4, 0x03, 0x0f,
+    0x88, 0x03, 0x05, 0x00, 0x38, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x98, 0x01, 0x04, 0x68, 0x02,
+    0x00, 0x60, 0x01, 0x0f, 0x84, 0x07, 0x26, 0x12, 0xe3, 0x18, 0xf6, 0x00, 0x80, 0x10, 0x01, 0x20,
+    0x09, 0x02, 0xa4, 0xf3, 0x00, 0x18, 0x3a, 0x00, 0x18, 0x0d, 0x08, 0x74, 0x01, 0x31, 0x9a, 0xa7,
+    0xd6, 0x14, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x64, 0x8a, 0x02, 0x34, 0x07, 0x03, 0x48, 0x01, 0x09,
+    0xbc, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x04, 0x88, 0x01, 0x04, 0x84, 0x01, 0x00, 0x88, 0x01, 0x04,
+    0x04, 0x00, 0x03, 0x78, 0x07, 0x0f, 0x24, 0x0f, 0x12, 0x02, 0x34, 0x00, 0x00, 0x48, 0x33, 0x31,
+    0x80, 0x8b, 0xcc, 0xc4, 0x0a, 0x08, 0xa4, 0x00, 0x0f, 0x0c, 0x00, 0x19, 0x0f, 0x84, 0x07, 0x46,
+    0x01, 0xa0, 0x01, 0x00, 0x10, 0xa7, 0x12, 0xf1, 0x44, 0xda, 0x00, 0x04, 0x0e, 0x01, 0x08, 0x0f,
+    0x00, 0x04, 0x01, 0x02, 0x30, 0xe3, 0x00, 0x84, 0x8f, 0x04, 0x54, 0x0a, 0x40, 0xb9, 0xc8, 0xe4,
+    0x88, 0xa0, 0x92, 0x00, 0xa8, 0x38, 0x24, 0x1c, 0x1c, 0x4c, 0x0b, 0x12, 0xb5, 0xf4, 0xfd, 0x0f,
+    0x08, 0x0f, 0x2c, 0x00, 0x84, 0xec, 0xf1, 0x00, 0x03, 0x4e, 0xc3, 0xff, 0x14, 0x22, 0xb7, 0xff,
+    0x24, 0x1c, 0xb5, 0xff, 0x2f, 0x30, 0xb7, 0x50, 0x3d, 0x00, 0x08, 0x08, 0x00, 0x60, 0x16, 0x00,
+    0xe8, 0x01, 0x00, 0x60, 0x12, 0x00, 0x0c, 0x2d, 0x4f, 0xcc, 0xdc, 0xed, 0x88, 0x40, 0x01, 0x01,
+    0x00, 0x98, 0x16, 0x00, 0xac, 0x04, 0x00, 0x1c, 0x1e, 0x00, 0xec, 0xc0, 0x00, 0x84, 0x10, 0x04,
+    0x9c, 0xe7, 0x00, 0xf8, 0x0a, 0x00, 0xf4, 0xce, 0x50, 0x16, 0x18, 0xb6, 0xff, 0x04, 0x5c, 0x6d,
+    0x01, 0xec, 0x07, 0x00, 0xb0, 0x3f, 0x03, 0x88, 0x35, 0x00, 0xf8, 0x12, 0x00, 0xfc, 0x03, 0x04,
+    0x84, 0x15, 0x00, 0x08, 0x03, 0x00, 0x20, 0x04, 0x00, 0xdc, 0x0a, 0x04, 0xc0, 0x02, 0x00, 0xd0,
+    0x0a, 0x00, 0xd8, 0x0a, 0x00, 0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x1c, 0x03, 0x00, 0x74, 0x03,
+    0x00, 0x28, 0x00, 0x0f, 0x1c, 0x03, 0x1d, 0x0f, 0x30, 0x03, 0x01, 0x0f, 0x14, 0x00, 0x15, 0x04,
+    0xb8, 0x01, 0x00, 0xa4, 0x00, 0x0f, 0x84, 0x07, 0x29, 0x00, 0x5c, 0x0b, 0x00, 0xe0, 0x19, 0x00,
+    0xf0, 0x22, 0x00, 0x34, 0x07, 0x00, 0xe4, 0x0a, 0x00, 0xac, 0x06, 0x00, 0xf8, 0x06, 0x00, 0xf4,
+    0x03, 0x00, 0x94, 0x0b, 0x00, 0x60, 0x07, 0x0f, 0x98, 0x00, 0x09, 0x00, 0x8c, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x0c, 0x20, 0x00, 0xe0, 0x06, 0x00, 0x44, 0x02, 0x00, 0xc8, 0x0c, 0x00, 0x4c, 0x36,
+    0x00, 0xa8, 0x4a, 0x00, 0xd4, 0x1a, 0x00, 0x3c, 0x1b, 0x00, 0x50, 0x04, 0x00, 0x54, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x54, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x00, 0x54, 0x01, 0x00,
+    0x58, 0x00, 0x00, 0xe4, 0x04, 0x00, 0x24, 0x07, 0x00, 0x30, 0x16, 0x00, 0x9c, 0x02, 0x00, 0x68,
+    0x30, 0x00, 0x5c, 0x00, 0x00, 0x64, 0x18, 0x08, 0x04, 0x00, 0x00, 0x40, 0x3e, 0x00, 0x04, 0x00,
+    0x00, 0x4c, 0x14, 0x00, 0x8c, 0x08, 0x00, 0x88, 0x27, 0x00, 0xa0, 0x2a, 0x00, 0xdc, 0x13, 0x00,
+    0xa8, 0x0c, 0x00, 0x50, 0x08, 0x0c, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x40, 0x48, 0x00, 0xbc, 0x00, 0x00, 0x64, 0x2b, 0x00, 0x50, 0x0a, 0x00, 0x2c, 0x2b,
+    0x0f, 0xb0, 0x00, 0x19, 0x00, 0xb4, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0xe0, 0x00, 0x00, 0xbc,
+    0x08, 0x00, 0x1c, 0x01, 0x00, 0x38, 0x10, 0x00, 0x6c, 0x4a, 0x01, 0x98, 0x02, 0x51, 0xb2, 0xff,
+    0x24, 0x25, 0xb7, 0xb4, 0x0e, 0x00, 0x94, 0x9d, 0x2e, 0xbd, 0xcb, 0x1c, 0x78, 0x0f, 0x00, 0x03,
+    0x01, 0x0f, 0x14, 0x00, 0x09, 0x31, 0xc5, 0xd4, 0xea, 0x44, 0x0b, 0x00, 0x54, 0x00, 0x0f, 0x08,
+    0x0f, 0x7a, 0x00, 0x34, 0x01, 0x01, 0x08, 0x01, 0x12, 0xf2, 0xf4, 0xdc, 0x00, 0x14, 0x22, 0x00,
+    0xb8, 0x09, 0x00, 0x34, 0x49, 0x01, 0xe8, 0x05, 0x03, 0x74, 0x05, 0x01, 0xa4, 0x22, 0x02, 0xb8,
+    0x88, 0x00, 0x54, 0x0d, 0x00, 0x74, 0xdc, 0x00, 0x10, 0x40, 0x00, 0xb8, 0x44, 0x00, 0xb4, 0x39,
+    0x00, 0x88, 0xdc, 0x00, 0xd4, 0x48, 0x4f, 0xb0, 0xbe, 0xdf, 0x82, 0x08, 0x01, 0x09, 0x00, 0x1c,
+    0x00, 0x00, 0xdc, 0x9b, 0x00, 0x50, 0x13, 0x00, 0x20, 0x0d, 0x00, 0x20, 0x04, 0x00, 0xc0, 0x07,
+    0x00, 0xe4, 0x1a, 0x00, 0x20, 0x9f, 0x50, 0x18, 0x1a, 0xb6, 0xff, 0x06, 0xf0, 0x22, 0x01, 0x88,
+    0x01, 0x03, 0x20, 0x04, 0x00, 0x94, 0x0f, 0x00, 0x10, 0x17, 0x00, 0x8c, 0x16, 0x00, 0x50, 0x11,
+    0x00, 0x8c, 0x2d, 0x00, 0x1c, 0x1d, 0x00, 0xa8, 0x0b, 0x00, 0x3c, 0x08, 0x00, 0xc0, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0xb4, 0x02, 0x00, 0x10, 0x04, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x28,
+    0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x68, 0x09, 0x00, 0x48, 0x04, 0x00, 0xfc, 0x02,
+    0x00, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x7c, 0x02,
+    0x00, 0x1c, 0x02, 0x00, 0x64, 0x00, 0x00, 0xc4, 0x1a, 0x00, 0x58, 0x00, 0x0f, 0x30, 0x00, 0x05,
+    0x0f, 0x18, 0x00, 0x09, 0x00, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x84, 0x00,
+    0x0f, 0x84, 0x07, 0x29, 0x00, 0xc0, 0x22, 0x00, 0x2c, 0x1f, 0x00, 0x5c, 0x0b, 0x01, 0x9c, 0x01,
+    0x02, 0x90, 0x77, 0x31, 0x71, 0x7a, 0xc7, 0x70, 0x20, 0x00, 0x5c, 0x01, 0x04, 0x04, 0x00, 0x00,
+    0x80, 0x16, 0x00, 0xe8, 0xa7, 0x00, 0xc0, 0x1c, 0x00, 0x8c, 0xd9, 0x10, 0x09, 0x54, 0x18, 0x00,
+    0x8c, 0x2f, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x18, 0x04, 0xbc, 0x03, 0x00, 0x64, 0x18, 0x08, 0x04,
+    0x00, 0x04, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0xf4, 0x03, 0x00, 0x84, 0x0b, 0x00, 0xec, 0x4c, 0x01, 0x70, 0x79, 0x06, 0x18, 0x02, 0x02,
+    0xe0, 0x07, 0x0f, 0x10, 0x00, 0x01, 0x02, 0x84, 0x07, 0x00, 0x80, 0x18, 0x00, 0xe8, 0x25, 0x00,
+    0x8c, 0xb0, 0x0f, 0x3c, 0x06, 0x05, 0x04, 0xb8, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x0f, 0x84, 0x07,
+    0x4a, 0x00, 0xc0, 0x01, 0x00, 0xec, 0x01, 0x00, 0xfc, 0x0d, 0x00, 0x84, 0x04, 0x00, 0xe8, 0x04,
+    0x03, 0x60, 0x01, 0x00, 0xc4, 0x06, 0x00, 0x78, 0x3b, 0x00, 0x80, 0x00, 0x04, 0x9c, 0x00, 0x00,
+    0x94, 0x0b, 0x00, 0xf0, 0x11, 0x10, 0x1f, 0x94, 0x4a, 0x01, 0xd0, 0x08, 0x00, 0x84, 0x07, 0x12,
+    0xc2, 0x14, 0xe5, 0x00, 0xbc, 0x14, 0x00, 0xec, 0x01, 0x00, 0xf4, 0x01, 0x00, 0x04, 0x00, 0x00,
+    0x5c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x70, 0x02, 0x00,
+    0xf4, 0x09, 0xf1, 0x03, 0x79, 0xd7, 0xff, 0x0e, 0x50, 0xc4, 0xff, 0x36, 0x40, 0xbb, 0xff, 0x56,
+    0x5a, 0xbe, 0xff, 0x6c, 0x74, 0xc4, 0x5c, 0xf6, 0x31, 0x76, 0x80, 0xc8, 0xcc, 0x17, 0x00, 0x3c,
+    0x9b, 0x00, 0x68, 0xfc, 0x00, 0xd0, 0x0b, 0x04, 0x8c, 0x00, 0x0f, 0x08, 0x00, 0x01, 0x00, 0x34,
+    0x9f, 0x00, 0x5c, 0x93, 0x00, 0xbc, 0x0f, 0x00, 0x68, 0xdc, 0x00, 0x40, 0x00, 0x00, 0x48, 0x00,
+    0x00, 0xa4, 0x16, 0x00, 0x7c, 0xca, 0x00, 0xd4, 0x00, 0x10, 0x13, 0xcc, 0x1e, 0x01, 0x70, 0x0c,
+    0x12, 0xb4, 0xcc, 0x43, 0x00, 0x88, 0x15, 0x00, 0x48, 0x0e, 0x00, 0x8c, 0x06, 0x00, 0x24, 0x29,
+    0x00, 0xc8, 0x00, 0x00, 0x04, 0x03, 0x00, 0xa0, 0x00, 0x00, 0xdc, 0x0a, 0x00, 0xd4, 0x00, 0x00,
+    0xc0, 0x02, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c,
+    0x03, 0x00, 0x1c, 0x03, 0x00, 0x7c, 0x03, 0x00, 0x84, 0x03, 0x0f, 0xec, 0x00, 0x05, 0x0f, 0x18,
+    0x00, 0x3d, 0x00, 0x98, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x84, 0x07, 0x25, 0x00, 0x40, 0x00, 0x00,
+    0x94, 0x00, 0x00, 0x84, 0x06, 0x00, 0x58, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x7c, 0x08, 0x00, 0x38,
+    0x0e, 0x00, 0x94, 0x1b, 0x00, 0xd8, 0x0b, 0x00, 0x60, 0x00, 0x04, 0x28, 0x00, 0x00, 0x2c, 0x00,
+    0x0f, 0x04, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x84, 0x04, 0x00, 0x2c, 0x07,
+    0x00, 0xf8, 0x06, 0x00, 0x1c, 0x01, 0x00, 0x2c, 0x47, 0x01, 0x1c, 0x02, 0x03, 0x44, 0x85, 0x0f,
+    0x84, 0x07, 0x21, 0x00, 0x7c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x24, 0x07, 0x00, 0xa4, 0x11, 0x00,
+    0x98, 0x13, 0x00, 0x5c, 0x07, 0x00, 0x7c, 0x20, 0x00, 0x38, 0x20, 0x00, 0x34, 0x55, 0x08, 0x04,
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x24, 0x05, 0x00, 0xd4, 0x22, 0x00, 0x40, 0x0c,
+    0x00, 0xd8, 0x02, 0x00, 0xb8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x5c, 0x0c, 0x00, 0x10, 0x10, 0x00, 0x8c, 0x27, 0x00, 0xe8, 0x07, 0x00, 0xb0,
+    0x32, 0x00, 0x68, 0x04, 0x00, 0x18, 0x01, 0x00, 0x60, 0x01, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00,
+    0x0c, 0x3c, 0x00, 0x0f, 0x10, 0x00, 0x29, 0x00, 0x34, 0x02, 0x00, 0x60, 0x02, 0x00, 0x78, 0x00,
+    0x00, 0x58, 0x02, 0x00, 0xf8, 0x17, 0x00, 0x7c, 0x02, 0x00, 0x40, 0x08, 0x01, 0x98, 0x02, 0x11,
+    0xb2, 0xa8, 0xf3, 0x00, 0x40, 0xde, 0x00, 0x04, 0x1e, 0x0c, 0x28, 0x96, 0x0f, 0xf8, 0x02, 0x01,
+    0x0f, 0x14, 0x00, 0x0d, 0x0f, 0x84, 0x07, 0x82, 0x00, 0x08, 0x01, 0x00, 0x60, 0x06, 0x04, 0x08,
+    0x01, 0x00, 0x40, 0x02, 0x05, 0x08, 0x01, 0x00, 0x54, 0x05, 0x00, 0x0c, 0x0c, 0x00, 0x08, 0x00,
+    0x02, 0x04, 0x00, 0x31, 0x07, 0x09, 0xb5, 0x84, 0x7d, 0x00, 0x74, 0x49, 0x00, 0xc8, 0xb4, 0x00,
+    0x20, 0x0c, 0x01, 0xe0, 0x03, 0x21, 0x81, 0xc9, 0x50, 0xdd, 0x00, 0x54, 0xa6, 0x0f, 0x08, 0x01,
+    0x0d, 0x00, 0x20, 0x00, 0x40, 0xb1, 0xbf, 0xe0, 0x4b, 0x30, 0x0f, 0x00, 0x98, 0x05, 0x02, 0x40,
+    0x00, 0x11, 0xc8, 0x64, 0x13, 0x31, 0x5d, 0x64, 0xc1, 0x34, 0x0d, 0x00, 0x30, 0x1e, 0x05, 0x60,
+    0x11, 0x00, 0x3c, 0x06, 0x00, 0x50, 0x20, 0x00, 0x54, 0x19, 0x00, 0x80, 0x02, 0x00, 0xb0, 0x1e,
+    0x00, 0x38, 0x20, 0x00, 0x1c, 0x02, 0x00, 0x04, 0x02, 0x04, 0x1c, 0x02, 0x04, 0x0c, 0x03, 0x00,
+    0xd4, 0x00, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x0c, 0x03, 0x00, 0x30, 0x04, 0x00, 0x38,
+    0x04, 0x00, 0xe8, 0x01, 0x00, 0x48, 0x04, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x00,
+    0x0f, 0x04, 0x00, 0x51, 0x00, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x84, 0x00,
+    0x00, 0x8c, 0x00, 0x00, 0xd0, 0x1d, 0x00, 0x58, 0x12, 0x00, 0xa4, 0x00, 0x00, 0xac, 0x00, 0x00,
+    0x68, 0x03, 0x00, 0xc8, 0x03, 0x00, 0x28, 0x00, 0x0c, 0x94, 0x00, 0x00, 0x14, 0x00, 0x00, 0xdc,
+    0x00, 0x00, 0xf0, 0x00, 0x00, 0x14, 0x03, 0x00, 0x1c, 0x03, 0x01, 0xa8, 0x02, 0x00, 0x9c, 0x01,
+    0x02, 0xb4, 0xa4, 0x00, 0x84, 0x16, 0x0c, 0x7c, 0x10, 0x00, 0x6c, 0xb7, 0x27, 0x25, 0x29, 0x68,
+    0xfb, 0x00, 0x20, 0x0b, 0x00, 0x4c, 0x1f, 0x00, 0x74, 0x23, 0x00, 0xc4, 0x03, 0x00, 0x28, 0x1a,
+    0x01, 0x04, 0x00, 0x0b, 0xc8, 0x03, 0x09, 0x0c, 0x00, 0x12, 0xc9, 0x8c, 0x76, 0x00, 0xd8, 0x03,
+    0x00, 0x24, 0x0c, 0x00, 0x7c, 0x65, 0x00, 0xe8, 0x21, 0x01, 0x20, 0x09, 0x02, 0x60, 0x07, 0x05,
+    0xa8, 0x01, 0x01, 0x38, 0x03, 0x0f, 0x14, 0x00, 0x03, 0x00, 0x44, 0x51, 0x00, 0xc0, 0xf9, 0x00,
+    0x24, 0x15, 0x80, 0xb8, 0xc7, 0xe3, 0xff, 0xca, 0xd9, 0xec, 0xee, 0x08, 0x02, 0x0f, 0x04, 0x00,
+    0x19, 0x00, 0x04, 0x07, 0x0f, 0x94, 0x25, 0x3e, 0x00, 0x6c, 0x01, 0x00, 0x60, 0x01, 0x00, 0x08,
+    0x00, 0x00, 0xac, 0x04, 0x0f, 0x84, 0x07, 0x04, 0x00, 0x78, 0x00, 0x08, 0x48, 0x17, 0x00, 0x94,
+    0x16, 0x00, 0x54, 0xfa, 0x02, 0x84, 0x07, 0x00, 0xd0, 0x12, 0x0f, 0x84, 0x07, 0x30, 0x00, 0x88,
+    0x0c, 0xf1, 0x03, 0x78, 0xd7, 0xff, 0x19, 0x53, 0xc4, 0xff, 0x50, 0x5b, 0xbf, 0xff, 0x7d, 0x85,
+    0xc9, 0xff, 0x9c, 0xa7, 0xd6, 0xf4, 0x1d, 0x00, 0x0c, 0xf9, 0x00, 0x54, 0x07, 0x00, 0x68, 0x16,
+    0x0f, 0xa8, 0x7c, 0x01, 0x0f, 0x48, 0x01, 0x01, 0x00, 0xa8, 0x16, 0x31, 0xb5, 0xc3, 0xe1, 0xa0,
+    0x3f, 0x00, 0x40, 0x00, 0x00, 0x10, 0xff, 0x00, 0x88, 0x13, 0x31, 0x81, 0x8c, 0xcc, 0x64, 0xfa,
+    0x11, 0x20, 0x04, 0xfe, 0x00, 0x04, 0x11, 0x12, 0xb3, 0x94, 0x60, 0x00, 0xe0, 0x01, 0x00, 0x90,
+    0xaf, 0x00, 0x70, 0x0d, 0x00, 0x60, 0x03, 0x00, 0x14, 0x04, 0x00, 0x1c, 0x08, 0x00, 0x20, 0x01,
+    0x00, 0x9c, 0x02, 0x08, 0xc0, 0x02, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x04, 0xc0, 0x02, 0x00,
+    0x74, 0x03, 0x00, 0x24, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x4c, 0x01, 0x0f, 0x04, 0x00, 0x51, 0x00,
+    0x98, 0x00, 0x00, 0x70, 0x00, 0x00, 0x18, 0x03, 0x0f, 0x08, 0x0f, 0x21, 0x00, 0x3c, 0x00, 0x00,
+    0xa8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x84, 0x03, 0x00, 0xac, 0x1d, 0x00, 0xa8, 0x2d, 0x00, 0x4c,
+    0x16, 0x00, 0x2c, 0x0e, 0x00, 0x94, 0x03, 0x01, 0x64, 0x00, 0x0f, 0x84, 0x15, 0x0c, 0x00, 0x24,
+    0x00, 0x00, 0xa4, 0x08, 0x00, 0x4c, 0x00, 0x00, 0x08, 0x0f, 0x00, 0x4c, 0x06, 0x00, 0xdc, 0x03,
+    0x00, 0x00, 0x0f, 0x01, 0x1c, 0x02, 0x12, 0xb3, 0x10, 0x34, 0x0f, 0x84, 0x07, 0x26, 0x12, 0xf7,
+    0x08, 0x74, 0x00, 0xe4, 0x25, 0x00, 0x00, 0x04, 0x00, 0x38, 0x28, 0x00, 0x84, 0x0c, 0x00, 0x04,
+    0x00, 0x00, 0xac, 0x01, 0x08, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x64, 0x16,
+    0x00, 0x58, 0x0e, 0x00, 0x14, 0x08, 0x05, 0xc4, 0x01, 0x03, 0x68, 0x78, 0x00, 0xa8, 0x01, 0x08,
+    0x04, 0x00, 0x00, 0xe4, 0x10, 0x00, 0xc4, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x84, 0x07, 0x00, 0xdc,
+    0x54, 0x00, 0x6c, 0x05, 0x00, 0xdc, 0x17, 0x00, 0xf8, 0x07, 0x00, 0x60, 0x01, 0x00, 0x20, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0xe4, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x04, 0x48, 0x00, 0x00, 0x50, 0x02,
+    0x00, 0xe8, 0x1e, 0x00, 0x64, 0x00, 0x21, 0x7b, 0xd8, 0x20, 0x33, 0x10, 0x01, 0xfc, 0x07, 0x00,
+    0x60, 0x24, 0x01, 0x4c, 0x04, 0x11, 0xb2, 0x3c, 0xf8, 0x00, 0xdc, 0xd2, 0x00, 0x70, 0x03, 0x3f,
+    0xca, 0xd9, 0xec, 0x84, 0x16, 0x26, 0x04, 0x20, 0x03, 0x0f, 0x84, 0x07, 0x7a, 0x00, 0x08, 0x01,
+    0x00, 0x84, 0x02, 0x00, 0xa0, 0x01, 0x00, 0xa8, 0x01, 0x00, 0x08, 0x01, 0x00, 0xdc, 0x06, 0x00,
+    0x08, 0x1a, 0x00, 0xa0, 0x1e, 0x00, 0x18, 0x0d, 0x01, 0x08, 0x01, 0x00, 0xe8, 0x05, 0x02, 0x80,
+    0x07, 0x00, 0x6c, 0x05, 0x31, 0x0f, 0x11, 0xb6, 0xd4, 0x23, 0x31, 0x78, 0x81, 0xc9, 0x20, 0x10,
+    0x00, 0x68, 0x41, 0x00, 0xe0, 0x03, 0x00, 0x20, 0x04, 0x44, 0xb2, 0xbf, 0xe0, 0x4b, 0xec, 0x00,
+    0x0f, 0x08, 0x00, 0x15, 0x04, 0x3c, 0x00, 0x31, 0xac, 0xba, 0xdd, 0xec, 0x08, 0x00, 0xc8, 0x07,
+    0x64, 0x5d, 0x65, 0xc1, 0xff, 0x29, 0x2b, 0x3c, 0x06, 0x03, 0x94, 0x7c, 0x00, 0xb8, 0x27, 0x00,
+    0x60, 0x19, 0x00, 0x24, 0x08, 0x00, 0x20, 0x11, 0x08, 0x20, 0x04, 0x00, 0xcc, 0x00, 0x00, 0x18,
+    0x02, 0x00, 0xd0, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x10, 0x04, 0x00, 0x54, 0x03, 0x00, 0x20, 0x04,
+    0x00, 0x28, 0x04, 0x00, 0x30, 0x04, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x07, 0x00, 0xf8, 0x01, 0x00,
+    0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x24, 0x00, 0x08,
+    0x04, 0x00, 0x0f, 0x2c, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x44, 0x00, 0x00, 0x7c, 0x00,
+    0x00, 0x84, 0x00, 0x00, 0x68, 0x10, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x28, 0x00, 0xa4, 0x00, 0x00,
+    0xf4, 0x12, 0x00, 0x88, 0x0a, 0x00, 0xc8, 0x03, 0x00, 0x2c, 0x00, 0x0c, 0x4c, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0xdc, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x84, 0x03, 0x0b, 0x84, 0x07, 0x00, 0xfc, 0xfb,
+    0x00, 0x24, 0xfc, 0x00, 0x14, 0xec, 0x08, 0x78, 0x01, 0x33, 0x67, 0x70, 0xc4, 0xec, 0x0c, 0x00,
+    0x08, 0x04, 0x11, 0xb4, 0xf0, 0x38, 0x00, 0x34, 0xf3, 0x10, 0x01, 0x74, 0x19, 0x00, 0xec, 0x0b,
+    0x00, 0x70, 0x03, 0x00, 0x04, 0x00, 0x08, 0xc4, 0x03, 0x0f, 0x0c, 0x00, 0x01, 0x00, 0x24, 0x00,
+    0x00, 0x78, 0x01, 0x00, 0x68, 0x15, 0x00, 0xd0, 0x30, 0x01, 0x8c, 0x1e, 0x00, 0x14, 0x02, 0x03,
+    0xc0, 0x05, 0x01, 0x30, 0x0e, 0x00, 0x28, 0x02, 0x0f, 0x04, 0x00, 0x05, 0x11, 0xb4, 0x38, 0x4d,
+    0x00, 0x04, 0x20, 0x00, 0x48, 0x96, 0x00, 0x90, 0x4b, 0x00, 0x30, 0x08, 0x00, 0x24, 0x06, 0x08,
+    0xb0, 0x00, 0x0f, 0x0c, 0x00, 0x0d, 0x0f, 0x84, 0x07, 0x69, 0x00, 0xe8, 0x4d, 0x00, 0x80, 0x1d,
+    0x04, 0xa4, 0x00, 0x00, 0xac, 0x02, 0x00, 0x40, 0x7c, 0x02, 0x84, 0x07, 0x00, 0x08, 0x01, 0x0f,
+    0x84, 0x07, 0x34, 0xe1, 0x76, 0xd6, 0xff, 0x1f, 0x55, 0xc5, 0xff, 0x5e, 0x69, 0xc3, 0xff, 0x92,
+    0x9b, 0xd1, 0x44, 0x07, 0x00, 0x00, 0x0c, 0x00, 0xec, 0x80, 0x00, 0x04, 0x3c, 0x04, 0x80, 0x00,
+    0x0f, 0x08, 0x00, 0x19, 0x00, 0x38, 0x00, 0x00, 0x40, 0x00, 0x00, 0x48, 0x1b, 0x00, 0xa4, 0x16,
+    0x00, 0x4c, 0x1e, 0x00, 0x10, 0x1b, 0x20, 0x27, 0x2c, 0x94, 0xe6, 0x12, 0xb4, 0x90, 0xe9, 0x00,
+    0x00, 0x14, 0x00, 0x84, 0x15, 0x00, 0x2c, 0x1c, 0x00, 0xec, 0x05, 0x00, 0x6c, 0x02, 0x00, 0x1c,
+    0x04, 0x04, 0x88, 0x06, 0x00, 0x58, 0x03, 0x04, 0xc0, 0x02, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03,
+    0x00, 0x5c, 0x03, 0x00, 0xc0, 0x02, 0x00, 0x6c, 0x03, 0x00, 0x74, 0x03, 0x00, 0x24, 0x00, 0x00,
+    0xa8, 0x02, 0x0c, 0xc0, 0x02, 0x0f, 0x10, 0x00, 0x45, 0x08, 0x18, 0x03, 0x0f, 0x84, 0x07, 0x21,
+    0x04, 0x98, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x90, 0x0d, 0x00, 0x10, 0x0f, 0x00, 0x70, 0x0e, 0x00,
+    0x8c, 0x09, 0x00, 0xec, 0x00, 0x00, 0xfc, 0x00, 0x04, 0x24, 0x00, 0x0f, 0x08, 0x00, 0x11, 0x00,
+    0x30, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x44, 0x10, 0x00, 0x84, 0x07, 0x00, 0x38, 0x58, 0x0f, 0x08,
+    0x0f, 0x2d, 0x04, 0x78, 0x00, 0x00, 0x10, 0x17, 0x00, 0xa4, 0x00, 0x00, 0x28, 0x07, 0x00, 0xc4,
+    0x35, 0x00, 0xec, 0x07, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x20, 0x05, 0x00, 0xd0, 0x00, 0x00, 0xcc,
+    0x0f, 0x0f, 0xc8, 0x00, 0x09, 0x00, 0xb0, 0x01, 0x00, 0xb8, 0x01, 0x00, 0x68, 0x00, 0x00, 0x94,
+    0x17, 0x00, 0xec, 0x03, 0x00, 0x08, 0x0f, 0x00, 0x10, 0x11, 0x00, 0x68, 0x04, 0x00, 0x70, 0x04,
+    0x00, 0x0c, 0x02, 0x01, 0x6c, 0x01, 0x0f, 0x8c, 0x08, 0x0c, 0x00, 0x44, 0x00, 0x0f, 0x04, 0x00,
+    0x11, 0x01, 0x4c, 0x00, 0x03, 0x58, 0x08, 0x00, 0x10, 0x05, 0x00, 0x88, 0x28, 0x00, 0xcc, 0x78,
+    0x00, 0x8c, 0x1f, 0x40, 0x27, 0xb9, 0xff, 0x03, 0xc8, 0x2f, 0x01, 0xe4, 0x0b, 0x11, 0xb5, 0xe0,
+    0x58, 0x00, 0xe4, 0x13, 0x00, 0xdc, 0x0d, 0x00, 0xd0, 0xd2, 0x0f, 0xf8, 0x02, 0x19, 0x0f, 0x2c,
+    0x00, 0x01, 0x0f, 0x84, 0x07, 0x7f, 0x00, 0xd0, 0x58, 0x12, 0xf3, 0x40, 0xda, 0x00, 0x80, 0x07,
+    0x00, 0x44, 0x2f, 0x00, 0xb8, 0x18, 0x00, 0x38, 0x44, 0x00, 0x7c, 0x14, 0x00, 0x1c, 0x1a, 0x00,
+    0x4c, 0x44, 0x00, 0x38, 0x66, 0x01, 0x14, 0x01, 0x11, 0xb4, 0xac, 0xd5, 0x00, 0x60, 0x2b, 0x00,
+    0x40, 0x97, 0x00, 0xcc, 0x0e, 0x0f, 0xe8, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x29, 0x31, 0x9c, 0xa8,
+    0xd6, 0x44, 0xf6, 0x20, 0x31, 0x36, 0xd4, 0xf1, 0x00, 0x54, 0x0d, 0x12, 0xb6, 0xbc, 0x0d, 0x00,
+    0x54, 0x3e, 0x00, 0x20, 0x06, 0x00, 0xb0, 0x13, 0x01, 0x24, 0x03, 0x12, 0xf5, 0x98, 0x35, 0x08,
+    0xf4, 0x01, 0x04, 0x50, 0x02, 0x00, 0x54, 0x03, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x28,
+    0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0xf0, 0x01, 0x00, 0x5c, 0x03, 0x01, 0x04, 0x02,
+    0x0f, 0x50, 0x02, 0x34, 0x08, 0x80, 0x00, 0x0f, 0x0c, 0x00, 0x05, 0x04, 0x70, 0x00, 0x00, 0x7c,
+    0x00, 0x00, 0x70, 0x1f, 0x00, 0xcc, 0x06, 0x00, 0x80, 0x07, 0x00, 0x5c, 0x0e, 0x00, 0x20, 0x3c,
+    0x00, 0x54, 0x17, 0x00, 0x1c, 0x00, 0x0f, 0x40, 0x00, 0x0a, 0x03, 0x7c, 0x22, 0x00, 0x14, 0x03,
+    0x00, 0x1c, 0x03, 0x08, 0x08, 0x0f, 0x13, 0x3a, 0x08, 0x0f, 0x29, 0xbc, 0xde, 0x28, 0x0a, 0x00,
+    0x70, 0xaf, 0x20, 0x22, 0x24, 0xcc, 0x08, 0x03, 0x24, 0x06, 0x00, 0xdc, 0x01, 0x00, 0xa4, 0x38,
+    0x00, 0x6c, 0x21, 0x00, 0x64, 0x3c, 0x00, 0xa8, 0x03, 0x00, 0x04, 0x00, 0x0f, 0xcc, 0x03, 0x0d,
+    0x00, 0x24, 0x00, 0x00, 0x28, 0x08, 0x00, 0x7c, 0x00, 0x00, 0x24, 0x1a, 0x00, 0xcc, 0x1e, 0x00,
+    0x2c, 0x33, 0x00, 0xa0, 0x10, 0x00, 0x24, 0x02, 0x00, 0x64, 0x84, 0x0f, 0x04, 0x00, 0x01, 0x00,
+    0xc0, 0x29, 0x00, 0x38, 0x71, 0xa1, 0x0a, 0xb6, 0xff, 0x15, 0x1a, 0xb6, 0xff, 0x2c, 0x31, 0xb8,
+    0x0c, 0xe7, 0x31, 0x64, 0x6d, 0xc3, 0xbc, 0x2b, 0x00, 0xd4, 0x1c, 0x0f, 0x2c, 0x02, 0x19, 0x0f,
+    0x84, 0x07, 0x6e, 0x25, 0xbe, 0xe0, 0x60, 0x01, 0x0f, 0x8c, 0x16, 0x42, 0x00, 0x08, 0x0f, 0xe1,
+    0x76, 0xd6, 0xff, 0x1e, 0x55, 0xc4, 0xff, 0x5c, 0x67, 0xc2, 0xff, 0x8e, 0x97, 0xcf, 0xb0, 0xef,
+    0x2f, 0xc7, 0xd6, 0x84, 0x22, 0x27, 0x08, 0x60, 0x01, 0x31, 0xc9, 0xd8, 0xec, 0xf0, 0xd3, 0x31,
+    0x93, 0x9e, 0xd2, 0x40, 0x3e, 0xb2, 0x26, 0x34, 0xb9, 0xff, 0x00, 0x24, 0xba, 0xff, 0x00, 0x45,
+    0xc1, 0xbc, 0x14, 0x00, 0x48, 0x33, 0x01, 0x84, 0x15, 0x12, 0xf3, 0x48, 0x74, 0x00, 0x50, 0x03,
+    0x00, 0x94, 0x02, 0x08, 0xc0, 0x02, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00,
+    0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00, 0x74, 0x03, 0x00, 0xcc, 0x05, 0x04, 0x34,
+    0x00, 0x00, 0x38, 0x00, 0x0f, 0x04, 0x00, 0x4d, 0x01, 0x98, 0x00, 0x03, 0x18, 0x03, 0x0f, 0x84,
+    0x07, 0x29, 0x04, 0xa8, 0x00, 0x00, 0x08, 0x0b, 0x00, 0xb0, 0x06, 0x00, 0x08, 0x00, 0x04, 0x14,
+    0x00, 0x0f, 0x08, 0x00, 0x0d, 0x00, 0x2c, 0x00, 0x00, 0x7c, 0x07, 0x00, 0xa8, 0x06, 0x00, 0x60,
+    0x42, 0x00, 0xcc, 0x0c, 0x00, 0x6c, 0x1a, 0x00, 0xe8, 0x12, 0x00, 0x00, 0x03, 0x0f, 0x84, 0x07,
+    0x35, 0x04, 0x88, 0x00, 0x00, 0x70, 0x00, 0x01, 0xa4, 0x00, 0x04, 0xc4, 0x7f, 0x0f, 0x08, 0x00,
+    0x09, 0x0f, 0xe4, 0x26, 0x14, 0x00, 0xb8, 0x01, 0x00, 0x60, 0x00, 0x0f, 0x84, 0x07, 0x55, 0x00,
+    0x70, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x54, 0x08, 0x00, 0xac, 0x0f, 0x00, 0x00, 0x18, 0x00, 0x60,
+    0x13, 0x01, 0x64, 0x06, 0x11, 0xb3, 0x64, 0x06, 0x31, 0x32, 0x37, 0xb9, 0x88, 0x64, 0x00, 0xc4,
+    0x04, 0x00, 0x00, 0x21, 0x00, 0x84, 0x12, 0x0f, 0x24, 0x87, 0x01, 0x08, 0xe0, 0x02, 0x0f, 0x0c,
+    0x00, 0x11, 0x0f, 0x84, 0x07, 0x82, 0x08, 0x08, 0x01, 0x00, 0x04, 0x1e, 0x00, 0x0c, 0x3c, 0x00,
+    0x90, 0x08, 0x00, 0xa8, 0x0d, 0x00, 0x10, 0x0f, 0x00, 0xec, 0x05, 0x00, 0x60, 0x05, 0x04, 0x20,
+    0x01, 0x21, 0x13, 0xb5, 0xf4, 0x5f, 0x00, 0x24, 0x4f, 0x00, 0xcc, 0x0c, 0x0f, 0xf8, 0x00, 0x11,
+    0x0f, 0x24, 0x00, 0x19, 0x31, 0x98, 0xa4, 0xd4, 0xe4, 0x16, 0x71, 0x30, 0x3a, 0xba, 0xff, 0x00,
+    0x21, 0xb9, 0xc4, 0x43, 0x01, 0x98, 0x09, 0x00, 0x24, 0x08, 0x00, 0x24, 0x12, 0x00, 0xec, 0x02,
+    0x00, 0x30, 0x02, 0x00, 0xc4, 0x01, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0xe0, 0x01, 0x00, 0x10, 0x04, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x28, 0x04, 0x00, 0x30,
+    0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0xec, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x00,
+    0x08, 0x3c, 0x00, 0x0f, 0x0c, 0x00, 0x49, 0x00, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xac, 0x03,
+    0x00, 0xfc, 0x06, 0x00, 0x54, 0x0e, 0x00, 0xd4, 0x0f, 0x00, 0x78, 0x0c, 0x00, 0x84, 0x07, 0x00,
+    0x04, 0x13, 0x00, 0xb0, 0x00, 0x00, 0x5c, 0x08, 0x00, 0x24, 0x00, 0x00, 0x68, 0x03, 0x08, 0x90,
+    0x00, 0x00, 0x3c, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x08, 0x07, 0x0f, 0x84, 0x07,
+    0x05, 0x1c, 0xbb, 0x84, 0x07, 0x47, 0xc5, 0xff, 0x24, 0x26, 0x84, 0x07, 0x00, 0x24, 0x22, 0x00,
+    0x20, 0x04, 0x00, 0x68, 0x14, 0x00, 0x80, 0x13, 0x04, 0x64, 0x00, 0x0f, 0xd4, 0x03, 0x09, 0x04,
+    0x24, 0x00, 0x00, 0x98, 0x00, 0x00, 0x38, 0x12, 0x00, 0x70, 0x22, 0x00, 0x64, 0x31, 0x00, 0x58,
+    0x01, 0x00, 0xbc, 0x14, 0x00, 0x58, 0x4a, 0x00, 0xdc, 0x64, 0x08, 0x04, 0x00, 0x00, 0x60, 0x08,
+    0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x74, 0x00, 0x22, 0x32, 0xbb, 0x28, 0xf5, 0x01, 0x58,
+    0x11, 0x00, 0xc4, 0x5a, 0x11, 0xb9, 0x90, 0xeb, 0x00, 0x64, 0x15, 0x00, 0xa0, 0x0d, 0x0f, 0x20,
+    0x02, 0x15, 0x0f, 0x84, 0x07, 0xd2, 0xf1, 0x03, 0x78, 0xd7, 0xff, 0x17, 0x53, 0xc4, 0xff, 0x4a,
+    0x54, 0xbe, 0xff, 0x73, 0x7a, 0xc6, 0xff, 0x94, 0x9f, 0xd2, 0x4c, 0x16, 0x0f, 0x34, 0x10, 0x1d,
+    0x0c, 0x54, 0x01, 0x00, 0x30, 0x2d, 0x00, 0x40, 0x01, 0xf2, 0x04, 0x97, 0xa2, 0xd4, 0xff, 0x77,
+    0x7e, 0xc7, 0xff, 0x4f, 0x54, 0xbd, 0xff, 0x1e, 0x39, 0xbb, 0xff, 0x00, 0x4d, 0xc4, 0xb0, 0x2b,
+    0x00, 0x8c, 0x23, 0x00, 0x18, 0x02, 0x00, 0x68, 0x0d, 0x00, 0x10, 0x02, 0x00, 0x48, 0x03, 0x00,
+    0x78, 0x02, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x44,
+    0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x04, 0x02, 0x00, 0x64, 0x03, 0x00, 0xbc, 0x02,
+    0x00, 0x74, 0x03, 0x01, 0x34, 0x00, 0x0f, 0xf8, 0x05, 0x14, 0x00, 0x58, 0x00, 0x0f, 0x04, 0x00,
+    0x2d, 0x00, 0x94, 0x00, 0x04, 0x18, 0x03, 0x0f, 0x84, 0x07, 0x2d, 0x01, 0x4c, 0x00, 0x03, 0xbc,
+    0x47, 0x01, 0x0c, 0x00, 0x0f, 0xc8, 0x00, 0x10, 0x00, 0x28, 0x00, 0x00, 0x2c, 0x01, 0x00, 0xb8,
+    0x03, 0x00, 0x3c, 0x1f, 0x00, 0x24, 0x16, 0x00, 0x1c, 0x01, 0x00, 0xcc, 0x0c, 0x00, 0x38, 0x0c,
+    0x01, 0x70, 0x1f, 0x00, 0x1c, 0x12, 0x0f, 0x10, 0x1e, 0x28, 0x08, 0x24, 0x01, 0x00, 0x70, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x68, 0x01, 0x0f, 0x04, 0x00, 0x11, 0x00, 0x2c, 0x00, 0x00, 0x20, 0x01,
+    0x08, 0x44, 0x00, 0x0f, 0x0c, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x00, 0x18, 0x00, 0x0f, 0x84, 0x07,
+    0x59, 0x00, 0x74, 0x00, 0x00, 0x84, 0x04, 0x00, 0x84, 0x07, 0x00, 0x0c, 0x05, 0x01, 0x5c, 0x13,
+    0x00, 0x2c, 0x01, 0x42, 0xb2, 0xff, 0x22, 0x23, 0x0c, 0x2d, 0x31, 0x7a, 0x84, 0xca, 0x38, 0x24,
+    0x00, 0x80, 0x12, 0x00, 0x3c, 0x07, 0x0c, 0xd4, 0x02, 0x0f, 0x10, 0x00, 0x21, 0x00, 0x48, 0x00,
+    0x0f, 0x94, 0x25, 0x76, 0x01, 0xa0, 0x01, 0x03, 0x70, 0x8c, 0x00, 0x04, 0x06, 0x00, 0x08, 0x01,
+    0x00, 0x14, 0x2e, 0x00, 0x04, 0x00, 0x00, 0x30, 0x36, 0x00, 0xb0, 0x14, 0x00, 0xa4, 0x26, 0x00,
+    0x24, 0x10, 0x00, 0xac, 0x21, 0x01, 0x40, 0x05, 0x11, 0xb2, 0xe0, 0x4b, 0x31, 0x44, 0x49, 0xbb,
+    0xdc, 0x21, 0x00, 0x70, 0x41, 0x00, 0xc4, 0x57, 0x0f, 0x0c, 0x01, 0x21, 0x0c, 0x34, 0x00, 0x00,
+    0xb8, 0x34, 0x00, 0xc4, 0x43, 0xb2, 0x7c, 0x84, 0xc9, 0xff, 0x55, 0x5a, 0xbe, 0xff, 0x26, 0x3a,
+    0xbb, 0xa8, 0xd9, 0x00, 0x00, 0x2d, 0x00, 0x38, 0x15, 0x00, 0x5c, 0x20, 0x00, 0x90, 0x0d, 0x00,
+    0x94, 0x11, 0x04, 0xbc, 0x00, 0x00, 0x38, 0x02, 0x08, 0x04, 0x00, 0x00, 0x70, 0x02, 0x00, 0xdc,
+    0x01, 0x00, 0x10, 0x04, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x28, 0x04, 0x00, 0x30, 0x04,
+    0x00, 0x1c, 0x03, 0x00, 0x40, 0x04, 0x00, 0x48, 0x04, 0x0f, 0x40, 0x00, 0x05, 0x08, 0x4c, 0x00,
+    0x0f, 0x0c, 0x00, 0x3d, 0x00, 0x9c, 0x00, 0x00, 0x98, 0x00, 0x00, 0xe4, 0x04, 0x00, 0x4c, 0x08,
+    0x00, 0xb0, 0x19, 0x00, 0x7c, 0x4b, 0x00, 0x5c, 0x08, 0x00, 0xa8, 0x00, 0x00, 0xc0, 0x03, 0x00,
+    0x18, 0x00, 0x00, 0x48, 0x5d, 0x00, 0x28, 0x00, 0x00, 0xa4, 0x00, 0x04, 0x84, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x40, 0x00, 0x0f, 0x84, 0x07, 0x2d, 0x00, 0x50, 0x2e, 0x00, 0xc8, 0x0e, 0x00, 0x8c,
+    0x0f, 0x00, 0x54, 0x07, 0x00, 0x08, 0x1a, 0x00, 0x04, 0x00, 0x00, 0x34, 0x01, 0x0f, 0x04, 0x00,
+    0x0a, 0x03, 0x7c, 0x4f, 0x00, 0x80, 0x00, 0x00, 0xac, 0x0d, 0x00, 0x34, 0x2a, 0x00, 0x94, 0x01,
+    0x00, 0xb8, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x7c, 0x13, 0x08, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0xc8, 0x4b, 0x40, 0x6a, 0xcf, 0xff, 0x01, 0x80, 0x1e, 0x00, 0xd8, 0x25, 0x01,
+    0xb4, 0x16, 0x02, 0xc8, 0x2d, 0x00, 0x98, 0x7f, 0x0f, 0xb4, 0x61, 0x15, 0x04, 0x2c, 0x02, 0x00,
+    0x44, 0x06, 0x00, 0x98, 0x1d, 0x0f, 0xa4, 0x43, 0x3a, 0x00, 0x64, 0x01, 0x00, 0x60, 0x01, 0x00,
+    0x08, 0x00, 0x00, 0x4c, 0x05, 0x0f, 0x10, 0x1e, 0x04, 0x01, 0x8c, 0x16, 0x0f, 0x08, 0x0f, 0x4d,
+    0x00, 0xe4, 0x11, 0xf1, 0x03, 0x7a, 0xd7, 0xff, 0x0b, 0x50, 0xc3, 0xff, 0x2b, 0x36, 0xb9, 0xff,
+    0x44, 0x45, 0xba, 0xff, 0x61, 0x68, 0xc1, 0xec, 0x46, 0x00, 0xf4, 0x19, 0x00, 0x94, 0x16, 0x04,
+    0x0c, 0x01, 0x0f, 0x08, 0x00, 0x19, 0x40, 0xca, 0xda, 0xec, 0xcc, 0x30, 0x0b, 0x00, 0xb8, 0x45,
+    0x00, 0x84, 0x16, 0xb2, 0x47, 0x4c, 0xbb, 0xff, 0x2e, 0x3a, 0xba, 0xff, 0x10, 0x47, 0xc0, 0x18,
+    0x11, 0x01, 0x80, 0x16, 0x12, 0xeb, 0x68, 0x7e, 0x00, 0x18, 0x02, 0x00, 0x58, 0x06, 0x00, 0x10,
+    0x01, 0x04, 0x04, 0x00, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x44, 0x03,
+    0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x04, 0x02, 0x00, 0x6c, 0x03, 0x00,
+    0xb4, 0x02, 0x00, 0x44, 0x02, 0x00, 0xa8, 0x02, 0x04, 0x38, 0x00, 0x0f, 0x08, 0x00, 0x4d, 0x00,
+    0x94, 0x00, 0x00, 0x70, 0x00, 0x00, 0x98, 0x02, 0x0f, 0x84, 0x07, 0x2d, 0x0f, 0xac, 0x00, 0x1d,
+    0x00, 0x78, 0x00, 0x00, 0x80, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x9c, 0x0a, 0x00, 0xd0, 0x03, 0x00,
+    0x54, 0x0b, 0x00, 0x58, 0x3c, 0x00, 0xd0, 0x27, 0x00, 0xc0, 0x28, 0x01, 0x40, 0x70, 0x00, 0x58,
+    0x06, 0x00, 0x94, 0x7b, 0x12, 0xbe, 0x48, 0xe8, 0x00, 0x74, 0x06, 0x00, 0xf8, 0x0c, 0x00, 0x3c,
+    0x00, 0x00, 0x04, 0x00, 0x0f, 0x78, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x41, 0x00, 0xb8, 0x01, 0x00,
+    0x58, 0x00, 0x0f, 0x84, 0x07, 0x55, 0x04, 0xf8, 0x00, 0x00, 0xec, 0x2a, 0x00, 0x54, 0x0c, 0x00,
+    0x7c, 0x06, 0x00, 0xec, 0x0d, 0x03, 0x64, 0x06, 0x00, 0x00, 0x47, 0x00, 0x50, 0x4f, 0x00, 0x80,
+    0x07, 0x00, 0xdc, 0x4a, 0x1f, 0xcd, 0x98, 0x61, 0x10, 0x0f, 0x10, 0x03, 0x15, 0x0f, 0x84, 0x07,
+    0x8e, 0x00, 0x88, 0x1f, 0x00, 0xc0, 0x0c, 0x00, 0x5c, 0x59, 0x00, 0x54, 0x11, 0x00, 0xb4, 0x14,
+    0x00, 0xbc, 0x1c, 0x00, 0x10, 0x0f, 0x01, 0xac, 0x63, 0x51, 0xb4, 0xff, 0x05, 0x04, 0xb5, 0x9c,
+    0xaa, 0x00, 0xb8, 0xe7, 0x00, 0xb8, 0x1d, 0x00, 0xf4, 0x39, 0x00, 0xac, 0x17, 0x0f, 0x04, 0x01,
+    0x15, 0x0f, 0x28, 0x00, 0x01, 0x40, 0xb2, 0xc0, 0xe0, 0x27, 0x70, 0x10, 0x00, 0x00, 0x0f, 0xb2,
+    0x4b, 0x50, 0xbc, 0xff, 0x32, 0x3b, 0xba, 0xff, 0x15, 0x43, 0xbf, 0x9c, 0x1e, 0x00, 0x30, 0x6c,
+    0x00, 0x9c, 0x04, 0x00, 0xdc, 0x18, 0x00, 0x04, 0x04, 0x0c, 0x20, 0x04, 0x00, 0x3c, 0x02, 0x04,
+    0x04, 0x00, 0x00, 0x18, 0x03, 0x00, 0x50, 0x02, 0x00, 0x18, 0x03, 0x00, 0x18, 0x04, 0x00, 0x20,
+    0x04, 0x00, 0x28, 0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0x44, 0x00,
+    0x00, 0x04, 0x02, 0x00, 0x04, 0x00, 0x04, 0x38, 0x00, 0x0f, 0x08, 0x00, 0x55, 0x00, 0xbc, 0x00,
+    0x00, 0xe4, 0x04, 0x00, 0x7c, 0x02, 0x04, 0xdc, 0x15, 0x00, 0xbc, 0x28, 0x00, 0x38, 0x57, 0x00,
+    0x0c, 0x05, 0x00, 0x6c, 0x17, 0x00, 0xb8, 0x00, 0x05, 0x68, 0x08, 0x03, 0x8c, 0x0b, 0x00, 0xac,
+    0x00, 0x00, 0xdc, 0x00, 0x00, 0x6c, 0x04, 0x00, 0xb4, 0x02, 0x0f, 0x08, 0x0f, 0x25, 0x00, 0xd0,
+    0x63, 0x00, 0xfc, 0x3d, 0x04, 0x08, 0x01, 0x00, 0x2c, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x01,
+    0x09, 0x00, 0x78, 0x00, 0x00, 0x80, 0x00, 0x00, 0x24, 0x00, 0x04, 0xbc, 0x00, 0x00, 0xbc, 0x16,
+    0x00, 0xa8, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0xdc, 0x00, 0x00, 0x04, 0x00, 0x00, 0xec, 0x07,
+    0x00, 0xf4, 0x0f, 0x00, 0xc8, 0x3d, 0x00, 0xf0, 0x45, 0x03, 0x64, 0x03, 0x00, 0x00, 0x2f, 0x00,
+    0xbc, 0x3a, 0x00, 0x58, 0x06, 0x0f, 0x08, 0x0f, 0x37, 0x12, 0xe2, 0x40, 0x9c, 0x00, 0xa8, 0x00,
+    0x0f, 0xd4, 0x00, 0x0d, 0x00, 0x24, 0x00, 0x08, 0x04, 0x00, 0x04, 0xe0, 0x00, 0x0f, 0x84, 0x07,
+    0x0d, 0x17, 0xbf, 0x8c, 0x16, 0x0f, 0x10, 0x1e, 0x41, 0x00, 0xe8, 0x02, 0x00, 0xb8, 0x08, 0x40,
+    0x4e, 0xc3, 0xff, 0x01, 0x04, 0x30, 0x61, 0x00, 0xb3, 0xff, 0x27, 0x28, 0xb7, 0xb4, 0x4c, 0x00,
+    0x20, 0x03, 0x00, 0x90, 0x25, 0x0f, 0xcc, 0x26, 0x1d, 0x62, 0xcb, 0xdb, 0xed, 0xaa, 0xb7, 0xc5,
+    0x80, 0x16, 0x72, 0x63, 0x6b, 0xc3, 0xff, 0x2d, 0x3b, 0xba, 0x10, 0x68, 0x40, 0x46, 0xc1, 0xff,
+    0x02, 0x90, 0x78, 0x00, 0x30, 0x09, 0x00, 0x78, 0x00, 0x00, 0x38, 0x1c, 0x08, 0x14, 0x01, 0x08,
+    0x0c, 0x00, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x3c, 0x02, 0x00, 0x4c,
+    0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x08, 0x02, 0x00, 0x74, 0x03,
+    0x00, 0x78, 0x01, 0x00, 0x30, 0x02, 0x08, 0x3c, 0x00, 0x0f, 0x0c, 0x00, 0x49, 0x00, 0x94, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x18, 0x03, 0x0f, 0x84, 0x07, 0x5e, 0x03, 0x7c, 0xb3, 0x00, 0xac, 0x03,
+    0x00, 0xdc, 0x12, 0x00, 0x08, 0x01, 0x00, 0x0c, 0x12, 0x00, 0x70, 0x30, 0x01, 0xe8, 0x02, 0x00,
+    0x30, 0x21, 0x00, 0x04, 0x00, 0x0f, 0x84, 0x07, 0xfc, 0x00, 0x04, 0x05, 0x00, 0x48, 0x02, 0x00,
+    0xd0, 0x05, 0x00, 0x78, 0x02, 0x00, 0xf4, 0x04, 0x00, 0x08, 0x19, 0x00, 0xb8, 0x08, 0x01, 0x38,
+    0x01, 0x11, 0xb2, 0x94, 0x73, 0x00, 0xa4, 0x0b, 0x00, 0x1c, 0x69, 0x00, 0x64, 0x52, 0x0f, 0x34,
+    0x06, 0x01, 0x0f, 0x14, 0x00, 0x25, 0x0f, 0x84, 0x07, 0x8e, 0x00, 0x88, 0x1f, 0x00, 0x14, 0x27,
+    0x00, 0x18, 0x01, 0x00, 0x58, 0x03, 0x00, 0x5c, 0x02, 0x00, 0xa0, 0x0d, 0x00, 0x54, 0x54, 0x00,
+    0x14, 0x43, 0x80, 0x31, 0xbb, 0xff, 0x01, 0x1f, 0xb8, 0xff, 0x03, 0x58, 0x77, 0x52, 0x00, 0xb4,
+    0xff, 0x20, 0x22, 0xd8, 0xad, 0x00, 0x98, 0x16, 0x08, 0x9c, 0x61, 0x0f, 0x20, 0x01, 0x1d, 0x00,
+    0xf0, 0x08, 0x00, 0xa8, 0x34, 0x32, 0x35, 0x41, 0xbb, 0x1c, 0x60, 0x40, 0x41, 0xbf, 0xff, 0x03,
+    0xa0, 0x36, 0x00, 0xa8, 0x15, 0x00, 0xc8, 0x05, 0x00, 0x38, 0x0a, 0x0f, 0xcc, 0x03, 0x11, 0x00,
+    0x90, 0x03, 0x00, 0x08, 0x04, 0x00, 0x10, 0x04, 0x00, 0xc0, 0x00, 0x00, 0x18, 0x03, 0x00, 0x28,
+    0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0x02, 0x01, 0xbc, 0x03,
+    0x0f, 0x10, 0x1e, 0x58, 0x0f, 0xbc, 0x00, 0x01, 0x00, 0x88, 0x00, 0x00, 0x54, 0x0e, 0x00, 0x84,
+    0x07, 0x00, 0xc0, 0x21, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x98, 0x02, 0x00, 0xec, 0x06,
+    0x08, 0xa4, 0x00, 0x01, 0x0c, 0x00, 0x03, 0xf8, 0x1a, 0x0f, 0x84, 0x07, 0x29, 0x00, 0x18, 0x16,
+    0x00, 0x8c, 0x16, 0x00, 0x08, 0x01, 0x00, 0x74, 0x05, 0x01, 0x58, 0x00, 0x0f, 0x08, 0x01, 0x1c,
+    0x00, 0x44, 0x03, 0x00, 0x60, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x4c, 0x17, 0x00, 0x28, 0x00,
+    0x00, 0x68, 0x03, 0x00, 0xcc, 0x09, 0x05, 0x34, 0x08, 0x00, 0xe0, 0x1f, 0x0f, 0x50, 0x96, 0x1b,
+    0x08, 0x4c, 0x02, 0x0f, 0x08, 0x0f, 0x02, 0x00, 0xdc, 0x07, 0x00, 0xa0, 0x02, 0x00, 0xd0, 0x2a,
+    0x00, 0xdc, 0x08, 0x00, 0xd4, 0x00, 0x00, 0xdc, 0x26, 0x0f, 0x74, 0x01, 0x01, 0x0f, 0x14, 0x00,
+    0x05, 0x00, 0x34, 0x00, 0x00, 0x1c, 0x00, 0x0f, 0x84, 0x07, 0x08, 0x00, 0x80, 0x0f, 0x00, 0x94,
+    0x1a, 0x04, 0x90, 0x00, 0x00, 0xa8, 0x29, 0x0f, 0x18, 0x2d, 0x3e, 0x08, 0x28, 0x4b, 0x00, 0x54,
+    0x6c, 0x01, 0x54, 0x2b, 0x11, 0xb4, 0x20, 0x5b, 0x00, 0x78, 0x12, 0x31, 0x92, 0x9d, 0xd2, 0x34,
+    0xdb, 0x00, 0x40, 0xcf, 0x04, 0x88, 0x00, 0x0f, 0x08, 0x00, 0x09, 0x71, 0xc3, 0xd2, 0xe8, 0xff,
+    0xaf, 0xbc, 0xdf, 0xb8, 0x6d, 0x72, 0x72, 0x7b, 0xc6, 0xff, 0x44, 0x4c, 0xbc, 0x78, 0x63, 0x22,
+    0x4b, 0xc4, 0x00, 0x0f, 0x00, 0xa4, 0xe8, 0x40, 0x95, 0xe7, 0xff, 0x01, 0x9c, 0x11, 0x00, 0xb0,
+    0x01, 0x00, 0x3c, 0x03, 0x04, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x04, 0x04, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x3c, 0x02, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00,
+    0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00, 0x10, 0x02, 0x01, 0x40, 0x00, 0x03, 0x38,
+    0x0a, 0x04, 0x3c, 0x00, 0x0f, 0x08, 0x00, 0x49, 0x00, 0x94, 0x00, 0x00, 0xf4, 0x03, 0x0f, 0x84,
+    0x07, 0x69, 0x00, 0xac, 0x03, 0x00, 0xd0, 0x21, 0x00, 0xd4, 0x42, 0x00, 0x04, 0x0f, 0x01, 0x1c,
+    0x05, 0x00, 0x80, 0x21, 0x00, 0xec, 0x02, 0x0b, 0x84, 0x07, 0x00, 0x74, 0x2e, 0x00, 0xd0, 0x13,
+    0x00, 0x7c, 0x03, 0x00, 0x2c, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x20, 0x01, 0x49, 0x0f, 0x5c, 0x00,
+    0x15, 0x04, 0x88, 0x00, 0x0f, 0x08, 0x0f, 0x49, 0x00, 0xa8, 0x01, 0x00, 0x90, 0x00, 0x00, 0x44,
+    0x02, 0x00, 0xc4, 0x0b, 0x00, 0x10, 0x10, 0x40, 0x81, 0xdb, 0xff, 0x01, 0xc0, 0xe8, 0x00, 0x4c,
+    0x02, 0x01, 0x18, 0x5a, 0x00, 0xb0, 0x08, 0x73, 0xb2, 0xff, 0x26, 0x2a, 0xb7, 0xff, 0x71, 0x28,
+    0x13, 0x3f, 0xce, 0xdd, 0xee, 0x04, 0x3f, 0x02, 0x0f, 0xf8, 0x02, 0x09, 0x0f, 0x1c, 0x00, 0x09,
+    0x0f, 0x84, 0x07, 0x86, 0x00, 0xd8, 0x05, 0x00, 0x48, 0x11, 0x00, 0x68, 0x07, 0x00, 0xfc, 0x06,
+    0x00, 0xb0, 0x3e, 0x00, 0x90, 0x01, 0x00, 0xd4, 0x04, 0x00, 0x28, 0x06, 0x00, 0x94, 0x07, 0x21,
+    0x70, 0xd2, 0xbc, 0xff, 0x01, 0xb8, 0x17, 0x01, 0x20, 0x04, 0x00, 0x30, 0x01, 0x11, 0xb3, 0x38,
+    0x40, 0x00, 0x3c, 0x2e, 0x31, 0x8d, 0x99, 0xd0, 0x34, 0x01, 0x0f, 0x00, 0x01, 0x09, 0x0c, 0x1c,
+    0x00, 0x00, 0x48, 0x2d, 0x00, 0x80, 0x07, 0x90, 0x78, 0x81, 0xc8, 0xff, 0x4b, 0x53, 0xbd, 0xff,
+    0x04, 0x5c, 0x4d, 0x22, 0x46, 0xc2, 0x18, 0x0e, 0x00, 0x38, 0x63, 0x40, 0x92, 0xe5, 0xff, 0x01,
+    0x88, 0x00, 0x05, 0xe0, 0x03, 0x0f, 0x30, 0x06, 0x0c, 0x00, 0xe8, 0x01, 0x00, 0x50, 0x02, 0x00,
+    0x30, 0x00, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x28, 0x04, 0x00, 0xe4, 0x01, 0x00, 0x38,
+    0x04, 0x00, 0x40, 0x04, 0x00, 0x04, 0x02, 0x01, 0xbc, 0x03, 0x0f, 0x4c, 0x00, 0x0c, 0x00, 0x30,
+    0x02, 0x0f, 0x04, 0x00, 0x41, 0x00, 0x7c, 0x00, 0x00, 0x24, 0x06, 0x00, 0xf4, 0x04, 0x00, 0xbc,
+    0x03, 0x00, 0x78, 0x07, 0x00, 0x38, 0x1d, 0x00, 0xa4, 0x00, 0x00, 0xac, 0x25, 0x00, 0x14, 0x23,
+    0x00, 0xd8, 0x03, 0x00, 0xc8, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x84, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0xdc, 0x00, 0x00, 0x6c, 0x04, 0x00, 0xac, 0x01, 0x05, 0xd4, 0x06, 0x00, 0x84, 0x01, 0x07, 0x94,
+    0x25, 0x0f, 0x10, 0x1e, 0x15, 0x00, 0x08, 0x01, 0x00, 0x08, 0x04, 0x01, 0x58, 0x00, 0x0f, 0x08,
+    0x01, 0x1c, 0x04, 0x34, 0x00, 0x00, 0xa0, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x01, 0xe0, 0x16, 0x16,
+    0xf9, 0xf0, 0x19, 0x00, 0x40, 0x1e, 0x00, 0x20, 0x1b, 0x03, 0xe8, 0x0a, 0x00, 0x54, 0x3e, 0x00,
+    0x78, 0x4e, 0x00, 0xc8, 0x18, 0x0f, 0x08, 0x0f, 0x32, 0x00, 0xb0, 0x27, 0x00, 0xec, 0x5d, 0x00,
+    0x4c, 0x06, 0x04, 0x30, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0xd4, 0x00, 0x00,
+    0x2c, 0x00, 0x0f, 0x84, 0x07, 0x05, 0x1e, 0x3e, 0x20, 0x3c, 0x00, 0xcc, 0xb0, 0x0f, 0x20, 0x3c,
+    0x42, 0x00, 0x24, 0x2a, 0x00, 0xcc, 0x05, 0x00, 0xc8, 0x3d, 0x01, 0xbc, 0x17, 0x11, 0xb4, 0xac,
+    0xd3, 0x00, 0x54, 0xde, 0x00, 0xac, 0x4b, 0x00, 0x8c, 0x7b, 0x00, 0xf0, 0x53, 0x2f, 0xc6, 0xd6,
+    0xb4, 0x5e, 0x0b, 0x00, 0x20, 0x3c, 0x31, 0xac, 0xb9, 0xdd, 0x20, 0x0b, 0x90, 0x67, 0x6e, 0xc3,
+    0xff, 0x48, 0x4b, 0xbb, 0xff, 0x2a, 0x84, 0x25, 0x00, 0xf4, 0x21, 0x13, 0x6a, 0x80, 0x16, 0x00,
+    0xf0, 0x09, 0x00, 0x28, 0x09, 0x00, 0x14, 0x03, 0x00, 0x00, 0x01, 0x04, 0x08, 0x01, 0x00, 0x0c,
+    0x00, 0x08, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x00, 0x00, 0x3c, 0x02,
+    0x00, 0x4c, 0x03, 0x00, 0xb0, 0x02, 0x00, 0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00,
+    0x74, 0x03, 0x00, 0x10, 0x02, 0x00, 0xa8, 0x02, 0x08, 0x3c, 0x00, 0x0f, 0x0c, 0x00, 0x49, 0x00,
+    0x94, 0x00, 0x00, 0x70, 0x00, 0x00, 0x18, 0x03, 0x0f, 0x08, 0x0f, 0x65, 0x00, 0xac, 0x03, 0x00,
+    0xc8, 0x03, 0x00, 0x54, 0x1a, 0x00, 0x14, 0x01, 0x05, 0x44, 0x8e, 0x0b, 0x84, 0x07, 0x00, 0x64,
+    0x23, 0x00, 0x9c, 0x34, 0x00, 0x28, 0x4b, 0x00, 0xb0, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xc0, 0x00,
+    0x0f, 0x20, 0x01, 0x49, 0x0f, 0x5c, 0x00, 0x15, 0x00, 0xb8, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x6c,
+    0x05, 0x0f, 0x18, 0x2d, 0x45, 0x04, 0xec, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x78, 0x20, 0x00, 0x30,
+    0x01, 0x00, 0xf4, 0x1c, 0x00, 0xb0, 0x68, 0x00, 0x0c, 0xd9, 0x00, 0xdc, 0x29, 0x01, 0x20, 0x04,
+    0x11, 0xb3, 0xd0, 0x04, 0x07, 0x20, 0x04, 0x0f, 0x84, 0x07, 0xd3, 0x00, 0x10, 0x1e, 0x00, 0x28,
+    0x05, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x25, 0x00, 0x00, 0x16, 0x00, 0xac, 0x08, 0x00, 0x74, 0x03,
+    0x00, 0x34, 0x01, 0x00, 0x70, 0x2f, 0x00, 0xe4, 0x04, 0x00, 0x20, 0x1e, 0x00, 0x98, 0x16, 0x01,
+    0xf8, 0x36, 0x00, 0x00, 0x06, 0x11, 0xb4, 0xac, 0x43, 0x00, 0x98, 0x16, 0x00, 0x28, 0x51, 0x00,
+    0x98, 0x16, 0x35, 0xa3, 0xb0, 0xda, 0x3c, 0x2a, 0x0c, 0x74, 0x07, 0x08, 0x10, 0x00, 0x40, 0xb1,
+    0xbe, 0xe0, 0x82, 0x40, 0x40, 0xd0, 0x6b, 0x73, 0xc4, 0xff, 0x4c, 0x50, 0xbc, 0xff, 0x2f, 0x36,
+    0xb9, 0xff, 0x03, 0x1c, 0x27, 0x00, 0x50, 0x05, 0x00, 0x80, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x54,
+    0x05, 0x00, 0x84, 0x00, 0x00, 0xb0, 0x06, 0x01, 0xb4, 0x02, 0x0f, 0x64, 0x0b, 0x0c, 0x00, 0x24,
+    0x00, 0x00, 0x50, 0x02, 0x00, 0x10, 0x04, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x28, 0x04,
+    0x00, 0x1c, 0x03, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0x50, 0x00, 0x00, 0x10, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x78, 0x02, 0x0f, 0x04, 0x00, 0x5d, 0x00, 0x78, 0x00, 0x04, 0xa4, 0x00, 0x00,
+    0xbc, 0x03, 0x00, 0x84, 0x07, 0x00, 0xd8, 0x24, 0x00, 0x88, 0x07, 0x00, 0xac, 0x79, 0x00, 0xf8,
+    0x00, 0x00, 0xd8, 0x03, 0x00, 0x24, 0x00, 0x00, 0x2c, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0xdc, 0x00, 0x00, 0x8c, 0x01, 0x0f, 0x84, 0x07, 0x6d, 0x01, 0x90, 0x00, 0x00, 0xb8, 0x4e,
+    0x0f, 0x04, 0x00, 0x08, 0x04, 0xbc, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x5c, 0x02, 0x00, 0xf0, 0x19,
+    0x00, 0x5c, 0x45, 0x01, 0x64, 0x03, 0x0f, 0x08, 0x0f, 0x30, 0x23, 0x42, 0xba, 0x7c, 0x51, 0x00,
+    0xe8, 0x93, 0x12, 0xbb, 0xf4, 0xc0, 0x00, 0x94, 0x39, 0x00, 0x54, 0x06, 0x00, 0x48, 0x07, 0x00,
+    0x40, 0x01, 0x00, 0x34, 0x02, 0x00, 0xac, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0x60, 0x01, 0x00,
+    0x28, 0x00, 0x00, 0x3c, 0x00, 0x0f, 0x10, 0x1e, 0x00, 0x00, 0xe4, 0x08, 0x00, 0x28, 0x5a, 0x22,
+    0xa5, 0xb1, 0xdc, 0x02, 0x40, 0xb8, 0xc6, 0xe3, 0xcc, 0xe0, 0x33, 0x00, 0xf4, 0x02, 0x0a, 0x28,
+    0x4b, 0x0f, 0xa4, 0x43, 0x30, 0x00, 0x84, 0x07, 0x00, 0x54, 0x2b, 0x00, 0x70, 0x5f, 0x01, 0xb8,
+    0xf2, 0x40, 0xb4, 0xff, 0x08, 0x0a, 0x50, 0x0d, 0xa0, 0xb5, 0xff, 0x29, 0x2d, 0xb8, 0xff, 0x60,
+    0x67, 0xc1, 0xff, 0x7c, 0x00, 0x3f, 0xbf, 0xce, 0xe7, 0x68, 0x03, 0x0a, 0x00, 0xe0, 0x8b, 0x31,
+    0x9b, 0xa8, 0xd6, 0x28, 0x08, 0x20, 0x2f, 0x31, 0x84, 0x34, 0x70, 0xb3, 0xff, 0x06, 0x1c, 0xb7,
+    0xff, 0x02, 0x5c, 0x00, 0x00, 0x6c, 0x1a, 0x00, 0x44, 0x24, 0x00, 0x24, 0x09, 0x00, 0xf8, 0x00,
+    0x0f, 0x04, 0x00, 0x0d, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x44, 0x03,
+    0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00,
+    0x74, 0x03, 0x01, 0xf8, 0x01, 0x0f, 0xa4, 0x03, 0x0c, 0x0f, 0x6c, 0x00, 0x0d, 0x0f, 0x20, 0x00,
+    0x19, 0x00, 0x94, 0x00, 0x04, 0x18, 0x03, 0x0f, 0x84, 0x07, 0x6d, 0x00, 0xb4, 0x13, 0x00, 0xc4,
+    0x03, 0x00, 0xc4, 0x46, 0x03, 0x3c, 0x09, 0x02, 0xb8, 0x46, 0x03, 0x8c, 0x07, 0x00, 0x54, 0x47,
+    0x00, 0x5c, 0x1b, 0x00, 0x38, 0x1e, 0x00, 0x30, 0x01, 0x00, 0xcc, 0x03, 0x0f, 0xa8, 0x02, 0x1d,
+    0x0f, 0x1c, 0x01, 0x19, 0x0f, 0x2c, 0x00, 0x19, 0x00, 0xb8, 0x01, 0x00, 0x30, 0x00, 0x08, 0x84,
+    0x07, 0x00, 0xa8, 0x3b, 0x00, 0xec, 0x0b, 0x00, 0x70, 0x04, 0x00, 0xac, 0x00, 0x01, 0x6c, 0x01,
+    0x0f, 0xb0, 0x0b, 0x1c, 0x00, 0x54, 0x00, 0x04, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0x64, 0x03, 0x04, 0x1c, 0x13, 0x00, 0x38, 0x62, 0x01, 0x6c, 0x0a, 0x91, 0xb5, 0xff, 0x13,
+    0x18, 0xb6, 0xff, 0x29, 0x2d, 0xb7, 0x98, 0x61, 0x00, 0x80, 0x4e, 0x00, 0x8c, 0x46, 0x00, 0x78,
+    0x12, 0x00, 0xbc, 0xe8, 0x08, 0x38, 0x06, 0x0f, 0x0c, 0x00, 0x2d, 0x0f, 0x08, 0x0f, 0x82, 0x00,
+    0x88, 0x03, 0x00, 0x0c, 0x24, 0x00, 0x14, 0x59, 0x00, 0x00, 0x43, 0x00, 0x24, 0x48, 0x00, 0xd0,
+    0x04, 0x00, 0xa4, 0x03, 0x00, 0x20, 0x24, 0x00, 0x78, 0x03, 0x00, 0x4c, 0x05, 0x00, 0xe0, 0x04,
+    0x00, 0x70, 0x03, 0x00, 0x30, 0x06, 0x00, 0x68, 0x49, 0x03, 0x68, 0x02, 0x22, 0x09, 0x0b, 0x20,
+    0x04, 0x00, 0x8c, 0x07, 0x00, 0x58, 0x5b, 0x00, 0x88, 0x85, 0x0f, 0x28, 0x01, 0x11, 0x00, 0xcc,
+    0x13, 0x00, 0x60, 0x13, 0x71, 0x37, 0x3a, 0xb9, 0xff, 0x02, 0x00, 0xb3, 0x78, 0x8d, 0x10, 0x03,
+    0x14, 0x09, 0x00, 0x2c, 0x15, 0x00, 0x30, 0x5c, 0x00, 0xf8, 0x01, 0x00, 0xb4, 0x01, 0x0f, 0x04,
+    0x00, 0x19, 0x00, 0x90, 0x03, 0x00, 0x50, 0x02, 0x00, 0x10, 0x04, 0x00, 0xe8, 0x02, 0x00, 0xb0,
+    0x00, 0x00, 0x28, 0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0xd0, 0x00,
+    0x00, 0x10, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x5c, 0x00, 0x19, 0x0f, 0x2c, 0x00, 0x35, 0x00, 0x78,
+    0x00, 0x00, 0xa4, 0x00, 0x00, 0x80, 0x03, 0x00, 0x54, 0x01, 0x00, 0x84, 0x07, 0x00, 0x78, 0x6a,
+    0x00, 0x80, 0x62, 0x00, 0xa8, 0x47, 0x00, 0x78, 0x10, 0x00, 0x1c, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x78, 0x00, 0x00, 0x08, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x14, 0x01, 0x00, 0x14,
+    0x03, 0x00, 0x1c, 0x03, 0x01, 0xc4, 0x20, 0x00, 0x08, 0x09, 0x0f, 0x08, 0x0f, 0x18, 0x00, 0x10,
+    0x1e, 0x00, 0x60, 0x01, 0x0f, 0x08, 0x01, 0x4d, 0x01, 0xb0, 0x00, 0x12, 0xf8, 0x6c, 0xa7, 0x0f,
+    0x84, 0x07, 0x38, 0x00, 0x00, 0x3d, 0x00, 0xd4, 0x45, 0x00, 0x14, 0x07, 0x05, 0x84, 0x07, 0x00,
+    0x34, 0x6a, 0x21, 0x4d, 0xc3, 0xd4, 0x12, 0x01, 0x7c, 0x1e, 0x00, 0xec, 0x13, 0x00, 0x40, 0x0a,
+    0x00, 0xe8, 0x0f, 0x01, 0x3c, 0x01, 0x0f, 0x14, 0x06, 0x10, 0x00, 0xb0, 0x00, 0x00, 0x2c, 0x00,
+    0x00, 0x20, 0x04, 0x09, 0x84, 0x07, 0x00, 0x40, 0x05, 0x11, 0xb3, 0xac, 0xda, 0x00, 0x70, 0x5b,
+    0x00, 0x18, 0x04, 0x31, 0x9f, 0xab, 0xd8, 0x9c, 0x68, 0x00, 0xa4, 0x25, 0x00, 0x14, 0x61, 0x20,
+    0x16, 0x14, 0x00, 0x03, 0x12, 0xb2, 0x9c, 0x91, 0x00, 0xa0, 0x57, 0x00, 0xcc, 0x10, 0x00, 0x3c,
+    0x03, 0x0f, 0x68, 0x02, 0x15, 0x00, 0x7c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x10,
+    0x02, 0x07, 0x84, 0x07, 0x02, 0x38, 0xfa, 0x00, 0x84, 0x00, 0x00, 0x64, 0x00, 0x00, 0xec, 0x01,
+    0x11, 0xb4, 0xa4, 0x5a, 0x00, 0x0c, 0x29, 0x00, 0x2c, 0x69, 0x0f, 0x68, 0x03, 0x09, 0x00, 0x04,
+    0x90, 0x00, 0xac, 0x07, 0x00, 0x3c, 0x65, 0x00, 0xd8, 0x3f, 0x01, 0x14, 0xfd, 0x00, 0xb8, 0x8a,
+    0x40, 0x51, 0xc4, 0xff, 0x01, 0x18, 0x03, 0x00, 0x20, 0x03, 0x00, 0xf4, 0x00, 0x01, 0xb4, 0x10,
+    0x0f, 0x5c, 0x05, 0x0c, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x3c, 0x02,
+    0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x04, 0x4c, 0x00, 0x00, 0x74, 0x03, 0x00,
+    0xd8, 0x02, 0x00, 0xa8, 0x02, 0x00, 0x58, 0x00, 0x0f, 0x04, 0x00, 0x51, 0x00, 0x94, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x18, 0x03, 0x0f, 0x84, 0x07, 0x8d, 0x00, 0x84, 0x5b, 0x00, 0xe8, 0x03, 0x00,
+    0x88, 0x5a, 0x00, 0x6c, 0x0e, 0x00, 0x74, 0x05, 0x00, 0xf4, 0x06, 0x00, 0xf8, 0x01, 0x00, 0x2c,
+    0x01, 0x00, 0xc8, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x3d, 0x01, 0x24, 0x01, 0x03, 0xf0,
+    0x2d, 0x00, 0xa0, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x04, 0x02, 0x00, 0x28, 0x00, 0x00, 0xf4,
+    0x0c, 0x00, 0x7c, 0x1c, 0x00, 0xa0, 0x0e, 0x0f, 0x84, 0x07, 0x3d, 0x00, 0xfc, 0x13, 0x00, 0x64,
+    0x00, 0x00, 0xac, 0x01, 0x00, 0x38, 0x1a, 0x00, 0x90, 0x08, 0x00, 0x04, 0x3b, 0x01, 0x48, 0x06,
+    0x11, 0xb2, 0x8c, 0x64, 0x00, 0xdc, 0x02, 0x00, 0x70, 0x66, 0x00, 0xe0, 0x5e, 0x00, 0x34, 0x31,
+    0x3f, 0xc2, 0xd2, 0xe8, 0x68, 0x0a, 0x0a, 0x0f, 0x00, 0x03, 0x09, 0x0f, 0x1c, 0x00, 0x05, 0x0f,
+    0x84, 0x07, 0x4a, 0x00, 0xe0, 0x00, 0x08, 0x04, 0x00, 0x0f, 0xcc, 0x01, 0x0d, 0x01, 0x2c, 0x00,
+    0x03, 0x40, 0x75, 0x00, 0x40, 0x23, 0x00, 0x18, 0x01, 0x00, 0x50, 0x03, 0x00, 0x8c, 0x07, 0x00,
+    0xd4, 0x09, 0x00, 0x28, 0x02, 0x00, 0xb4, 0x17, 0x00, 0x8c, 0x2c, 0x00, 0xa8, 0x07, 0x00, 0xfc,
+    0x27, 0x00, 0xe4, 0x04, 0x00, 0xec, 0x67, 0x23, 0x20, 0xb8, 0x6c, 0xe9, 0x08, 0x20, 0x04, 0x11,
+    0xb3, 0xb0, 0x61, 0x00, 0xfc, 0x12, 0x0f, 0x00, 0x01, 0x05, 0x08, 0x18, 0x00, 0x00, 0x20, 0x2e,
+    0x00, 0xa4, 0x38, 0x11, 0x0c, 0x7c, 0x3c, 0x00, 0x44, 0x42, 0x02, 0xe4, 0x40, 0x10, 0x01, 0x80,
+    0x00, 0x00, 0x8c, 0x04, 0x00, 0xd4, 0x03, 0x00, 0x1c, 0x02, 0x00, 0x34, 0x02, 0x0f, 0xcc, 0x00,
+    0x0d, 0x04, 0x20, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x30, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x64, 0x04,
+    0x00, 0xd0, 0x00, 0x00, 0x28, 0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00,
+    0x48, 0x04, 0x01, 0xfc, 0x00, 0x0f, 0x78, 0x04, 0x0c, 0x04, 0x54, 0x00, 0x0f, 0x08, 0x00, 0x3d,
+    0x00, 0x7c, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x7c, 0x03, 0x00, 0xe8, 0x00, 0x0f, 0x84, 0x07, 0x5a,
+    0x12, 0xc1, 0x40, 0x80, 0x00, 0x64, 0x1f, 0x00, 0x80, 0x00, 0x00, 0x60, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x94, 0x00, 0x01, 0x04, 0x00, 0x0f, 0xb0, 0x06, 0x10, 0x0f, 0x10, 0x01, 0x11, 0x00, 0xe0,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xbc, 0x09, 0x00, 0x44, 0x02, 0x00, 0x64, 0x11, 0x16, 0x3c, 0x1c,
+    0x5c, 0x0f, 0x8c, 0x16, 0x2e, 0x01, 0x08, 0x0f, 0x00, 0x94, 0x06, 0x03, 0x9c, 0x5e, 0x00, 0x74,
+    0x6b, 0x00, 0x00, 0x07, 0x00, 0x44, 0x0a, 0x00, 0xc4, 0x06, 0x00, 0x88, 0x07, 0x00, 0x50, 0x07,
+    0x00, 0xac, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00,
+    0x00, 0x34, 0x00, 0x0f, 0x84, 0x07, 0x00, 0x71, 0x1c, 0x1e, 0xb6, 0xff, 0x43, 0x49, 0xbb, 0x88,
+    0x07, 0x00, 0xcc, 0x4d, 0x31, 0x6c, 0x75, 0xc5, 0xdc, 0x06, 0x00, 0x0c, 0x08, 0x02, 0xc0, 0x02,
+    0x12, 0xb3, 0xe8, 0x68, 0x00, 0x84, 0x00, 0x0f, 0x84, 0x07, 0x4c, 0x00, 0xa0, 0x4e, 0x00, 0xa4,
+    0x04, 0x0f, 0x84, 0x07, 0x11, 0x00, 0xd4, 0x5a, 0x09, 0xb0, 0x7b, 0x00, 0xa4, 0x00, 0x41, 0x50,
+    0xc4, 0xff, 0x01, 0x30, 0x73, 0x12, 0xeb, 0x74, 0xaa, 0x04, 0x1c, 0x05, 0x0f, 0x20, 0x01, 0x0d,
+    0x00, 0x24, 0x01, 0x00, 0x3c, 0x03, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00,
+    0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00, 0x74, 0x03, 0x00, 0xf4, 0x01, 0x00, 0x84,
+    0x03, 0x0f, 0x4c, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x39, 0x00, 0x94, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0xd8, 0x05, 0x0f, 0x84, 0x07, 0x86, 0x00, 0x40, 0x09, 0x00, 0x5c, 0xed, 0x12, 0xb7, 0x78, 0x24,
+    0x00, 0x88, 0x10, 0x00, 0x80, 0x06, 0x00, 0x38, 0x30, 0x00, 0x88, 0x03, 0x00, 0x24, 0x03, 0x00,
+    0x14, 0x01, 0x00, 0xcc, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x61, 0x00, 0xb8, 0x01, 0x00,
+    0x78, 0x00, 0x00, 0x14, 0x08, 0x00, 0xf8, 0x05, 0x00, 0x0c, 0x15, 0x0f, 0x84, 0x07, 0x3e, 0x03,
+    0x70, 0x05, 0x00, 0xfc, 0x18, 0x00, 0x6c, 0x06, 0x00, 0x04, 0x01, 0x00, 0xb8, 0x03, 0x03, 0x84,
+    0x07, 0x31, 0x32, 0x37, 0xb8, 0xd8, 0x4f, 0x00, 0xb4, 0x02, 0x00, 0x24, 0x96, 0x0f, 0x04, 0x30,
+    0x25, 0x08, 0x64, 0x06, 0x0f, 0x0c, 0x00, 0x01, 0x0f, 0x84, 0x07, 0x4a, 0x00, 0x44, 0x01, 0x0f,
+    0x04, 0x00, 0x21, 0x00, 0x3c, 0x03, 0x00, 0x08, 0x02, 0x00, 0x3c, 0x0c, 0x00, 0x60, 0x03, 0x00,
+    0x00, 0x3a, 0x00, 0x90, 0x0d, 0x00, 0x38, 0x05, 0x00, 0x08, 0x00, 0x00, 0xc8, 0x0c, 0x00, 0x88,
+    0x07, 0x00, 0x68, 0x03, 0x00, 0x20, 0x0f, 0x00, 0x3c, 0x24, 0x0f, 0x84, 0x07, 0x02, 0x11, 0xb4,
+    0x54, 0x7c, 0x00, 0x24, 0x60, 0x0f, 0xfc, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x00, 0xb8, 0x61, 0x00,
+    0x38, 0x5b, 0x11, 0x16, 0x2c, 0xf2, 0x03, 0x84, 0x07, 0x40, 0x48, 0xc1, 0xff, 0x01, 0x90, 0x15,
+    0x00, 0x48, 0x0c, 0x00, 0x24, 0x06, 0x00, 0x1c, 0x02, 0x0f, 0x9c, 0x02, 0x19, 0x00, 0x90, 0x03,
+    0x00, 0x34, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x20, 0x04, 0x00, 0x28, 0x04, 0x00,
+    0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0xe0, 0x00, 0x00, 0x48, 0x04, 0x00, 0x54, 0x00, 0x00, 0x04,
+    0x00, 0x0f, 0x30, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x2d, 0x00, 0x78, 0x00, 0x00, 0xa4, 0x00, 0x00,
+    0xe0, 0x00, 0x0f, 0x84, 0x07, 0x5e, 0x12, 0xc0, 0x18, 0xbe, 0x0f, 0x08, 0x01, 0x4d, 0x00, 0xe4,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x40, 0x02, 0x0f, 0x8c, 0x16, 0x34, 0x71, 0xb6,
+    0xc5, 0xe2, 0xff, 0x8e, 0x99, 0xd0, 0xac, 0x12, 0x00, 0xd0, 0x8e, 0x00, 0x94, 0x8a, 0x32, 0x14,
+    0x1a, 0xb6, 0x4c, 0xcd, 0x00, 0x4c, 0xa0, 0x00, 0x74, 0x1e, 0x00, 0xdc, 0x03, 0x00, 0x3c, 0x35,
+    0x00, 0xf0, 0x48, 0x00, 0xac, 0x01, 0x00, 0x88, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09,
+    0x04, 0x24, 0x00, 0x0f, 0x84, 0x07, 0x04, 0x71, 0x08, 0x08, 0xb5, 0xff, 0x1d, 0x20, 0xb6, 0x38,
+    0x61, 0x00, 0x54, 0x79, 0x00, 0x40, 0x40, 0x93, 0x27, 0x2b, 0xb7, 0xff, 0x15, 0x18, 0xb6, 0xff,
+    0x03, 0x38, 0x3f, 0x01, 0xe8, 0xd6, 0x00, 0x50, 0x21, 0x0f, 0x84, 0x07, 0x38, 0x02, 0xe4, 0x6a,
+    0x06, 0xe8, 0x0a, 0x31, 0x01, 0x02, 0xb5, 0xdc, 0xd6, 0x00, 0x9c, 0x25, 0x00, 0x34, 0x87, 0x0c,
+    0x54, 0x03, 0x08, 0x10, 0x00, 0x00, 0xd0, 0x52, 0x00, 0xc8, 0x4e, 0x00, 0xfc, 0x55, 0x20, 0x12,
+    0x0e, 0x08, 0x06, 0x12, 0xb2, 0xf8, 0xbf, 0x00, 0x4c, 0x1a, 0x00, 0x1c, 0x2f, 0x00, 0x2c, 0x87,
+    0x00, 0xf8, 0x0c, 0x00, 0x10, 0x03, 0x00, 0x30, 0x03, 0x0f, 0x20, 0x01, 0x0d, 0x00, 0x24, 0x01,
+    0x00, 0x2c, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00,
+    0x64, 0x03, 0x00, 0x6c, 0x03, 0x00, 0x44, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x84, 0x03, 0x0f, 0x4c,
+    0x00, 0x09, 0x0f, 0x1c, 0x00, 0x39, 0x00, 0x94, 0x00, 0x00, 0x70, 0x00, 0x00, 0x68, 0x02, 0x0f,
+    0x84, 0x07, 0x71, 0x00, 0xbc, 0x46, 0x0d, 0x8c, 0x16, 0x00, 0x7c, 0x01, 0x12, 0xb5, 0xf8, 0xc8,
+    0x00, 0x70, 0x0c, 0x00, 0x44, 0x14, 0x00, 0x94, 0x1f, 0x00, 0x1c, 0x1e, 0x00, 0xd4, 0x12, 0x00,
+    0x74, 0x23, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x35, 0x00,
+    0x18, 0x29, 0x00, 0x64, 0x04, 0x00, 0x40, 0x0d, 0x00, 0x64, 0x00, 0x00, 0xfc, 0x06, 0x0f, 0x04,
+    0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x08, 0x1b, 0x00, 0xd0, 0x01, 0x00, 0x3c,
+    0x48, 0x00, 0x28, 0x02, 0x00, 0xac, 0x31, 0x00, 0xa4, 0x00, 0x00, 0x60, 0x01, 0x00, 0xa0, 0x00,
+    0x00, 0x04, 0x00, 0x0f, 0xa0, 0x00, 0x21, 0x00, 0x18, 0x1a, 0x00, 0x40, 0x2e, 0x00, 0x68, 0x06,
+    0x00, 0xd8, 0x1c, 0x00, 0x60, 0x24, 0x00, 0x30, 0x0b, 0x00, 0x00, 0x24, 0x03, 0x84, 0x07, 0x00,
+    0xc0, 0x5c, 0x00, 0x68, 0x48, 0x7f, 0xaa, 0xb8, 0xdd, 0xff, 0xcb, 0xda, 0xed, 0xc8, 0x56, 0x1e,
+    0x08, 0xfc, 0x02, 0x0f, 0x0c, 0x00, 0x09, 0x0f, 0x84, 0x07, 0x46, 0x00, 0x00, 0x03, 0x00, 0x7c,
+    0x13, 0x00, 0x2c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x30, 0x01,
+    0x19, 0x00, 0x30, 0x00, 0x00, 0x84, 0x04, 0x00, 0x44, 0x0c, 0x00, 0xb0, 0x14, 0x00, 0xa4, 0x34,
+    0x00, 0x98, 0x50, 0x00, 0x94, 0x01, 0x00, 0x1c, 0x16, 0x00, 0x18, 0x00, 0x00, 0xfc, 0x27, 0x00,
+    0xf4, 0x18, 0x01, 0x00, 0x46, 0x00, 0x1c, 0x04, 0x00, 0x04, 0x00, 0x00, 0x64, 0x02, 0x00, 0x94,
+    0x0c, 0x11, 0xb4, 0x04, 0xea, 0x00, 0xb0, 0x13, 0x0f, 0x04, 0x01, 0x09, 0x04, 0x1c, 0x00, 0x00,
+    0xd4, 0x13, 0x00, 0xac, 0x1a, 0x06, 0xb4, 0x56, 0x12, 0xb5, 0x9c, 0x02, 0x00, 0x3c, 0x28, 0x00,
+    0x30, 0x18, 0x00, 0xf8, 0x07, 0x00, 0xf4, 0x03, 0x00, 0x98, 0x00, 0x00, 0x50, 0x02, 0x0f, 0xcc,
+    0x00, 0x11, 0x00, 0x90, 0x03, 0x00, 0x08, 0x04, 0x00, 0x34, 0x00, 0x00, 0x18, 0x04, 0x00, 0xbc,
+    0x00, 0x00, 0x28, 0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0x54, 0x00,
+    0x00, 0x4c, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x54, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x3d, 0x00, 0x78,
+    0x00, 0x00, 0xa4, 0x00, 0x00, 0x20, 0x03, 0x0f, 0x84, 0x07, 0x09, 0x00, 0x24, 0x00, 0x00, 0x2c,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x14, 0x03,
+    0x0f, 0x8c, 0x16, 0x16, 0x1a, 0xc4, 0xa4, 0x43, 0x00, 0xfc, 0x3d, 0x00, 0xfc, 0x03, 0x00, 0xb0,
+    0x04, 0x00, 0x74, 0x09, 0x00, 0xf0, 0x01, 0x04, 0x04, 0x00, 0x00, 0x20, 0x03, 0x00, 0x94, 0x00,
+    0x00, 0x30, 0x03, 0x00, 0x74, 0x00, 0x0f, 0x04, 0x00, 0x25, 0x00, 0x40, 0x00, 0x00, 0x80, 0x01,
+    0x00, 0xfc, 0x03, 0x00, 0x60, 0x11, 0x00, 0xd4, 0x09, 0x00, 0x18, 0x07, 0x05, 0x0c, 0x70, 0x0f,
+    0x58, 0xa5, 0x1b, 0x04, 0x30, 0x02, 0x00, 0x08, 0x00, 0x00, 0xa8, 0x42, 0x00, 0xa4, 0x12, 0x00,
+    0xf0, 0x18, 0x00, 0xbc, 0x30, 0x00, 0x04, 0xa6, 0x22, 0x2b, 0x2e, 0xec, 0x1c, 0x01, 0x9c, 0x16,
+    0x00, 0x18, 0x32, 0x00, 0xb4, 0x02, 0x00, 0x50, 0x13, 0x00, 0x40, 0x02, 0x00, 0xc4, 0x00, 0x00,
+    0x48, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x60, 0x01, 0x00, 0x20, 0x00, 0x00,
+    0x0c, 0x01, 0x04, 0xa4, 0x0b, 0x00, 0x04, 0x30, 0x01, 0x90, 0x1d, 0x00, 0xdc, 0x02, 0x00, 0xe4,
+    0x02, 0x00, 0x04, 0x00, 0x00, 0xf0, 0x02, 0x08, 0x04, 0x00, 0x02, 0x14, 0x00, 0x02, 0x34, 0x16,
+    0x00, 0xd0, 0xb7, 0x16, 0xc0, 0x80, 0x3d, 0x0f, 0x68, 0x02, 0x15, 0x00, 0x7c, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x7c, 0x01, 0x00, 0x10, 0x02, 0x00, 0xc8, 0x0f, 0x00, 0x2c, 0x0d, 0x10, 0x16, 0x4c,
+    0x8f, 0x00, 0x7c, 0x00, 0x00, 0x70, 0x00, 0x00, 0x68, 0x00, 0x02, 0x0c, 0x00, 0x00, 0xf4, 0x00,
+    0x00, 0x68, 0x5d, 0x00, 0x34, 0x87, 0x00, 0x14, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x14, 0x2d,
+    0x00, 0x54, 0x0c, 0x00, 0xa0, 0x61, 0x05, 0x8c, 0x16, 0x00, 0x30, 0x08, 0x22, 0x3e, 0xbe, 0xdc,
+    0xb7, 0x00, 0xec, 0x12, 0x00, 0x68, 0x03, 0x00, 0x14, 0x05, 0x00, 0x58, 0x02, 0x00, 0xb4, 0x01,
+    0x00, 0x64, 0x02, 0x00, 0x08, 0x01, 0x0c, 0x04, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0xd4, 0x00, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x64,
+    0x03, 0x00, 0x6c, 0x03, 0x00, 0x40, 0x00, 0x00, 0x6c, 0x01, 0x0f, 0x44, 0x00, 0x05, 0x0c, 0x54,
+    0x00, 0x0f, 0x10, 0x00, 0x31, 0x00, 0x94, 0x00, 0x00, 0x70, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xd4,
+    0x02, 0x00, 0xe0, 0x58, 0x00, 0xdc, 0x31, 0x00, 0xe0, 0x05, 0x00, 0x78, 0x1d, 0x00, 0x58, 0x06,
+    0x00, 0x68, 0x00, 0x00, 0x98, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x01,
+    0x44, 0x00, 0x03, 0xac, 0x15, 0x0c, 0x20, 0x00, 0x0f, 0x10, 0x00, 0x09, 0x00, 0x38, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0xb8, 0x01, 0x00, 0xd8, 0x21, 0x00, 0x64, 0x24, 0x00, 0xb8, 0x01, 0x05, 0xe8,
+    0x88, 0x03, 0xb8, 0x01, 0x09, 0x5c, 0x6c, 0x00, 0xc4, 0x01, 0x12, 0xb3, 0x9c, 0x2e, 0x00, 0x14,
+    0x03, 0x00, 0x6c, 0x02, 0x00, 0x74, 0x02, 0x00, 0x68, 0x00, 0x00, 0x50, 0x00, 0x00, 0x08, 0x00,
+    0x0f, 0x04, 0x00, 0x21, 0x08, 0xc8, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x00, 0x00, 0x34, 0x05,
+    0x00, 0x5c, 0x07, 0x00, 0x9c, 0x00, 0x00, 0x08, 0x0b, 0x00, 0xd0, 0x23, 0x00, 0x6c, 0x3a, 0x00,
+    0x08, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x88, 0x00, 0x00, 0x14, 0x00, 0x00, 0x64, 0x0d, 0x00, 0x5c,
+    0x04, 0x00, 0x04, 0x0f, 0x00, 0x4c, 0x40, 0x00, 0x3c, 0x0b, 0x00, 0x70, 0x04, 0x00, 0x60, 0x01,
+    0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xa0, 0x00, 0x19, 0x00, 0x98, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x38, 0x02, 0x00, 0x64, 0x0f, 0x00, 0x3c, 0x02, 0x40, 0x87, 0xdf, 0xff, 0x01, 0x90, 0x17,
+    0x00, 0x48, 0x06, 0x07, 0x34, 0x40, 0x00, 0xdc, 0x0a, 0x00, 0x68, 0x1a, 0x00, 0x70, 0x1a, 0x0f,
+    0xd4, 0x02, 0x05, 0x0f, 0x18, 0x00, 0x31, 0x0f, 0x84, 0x07, 0x3e, 0x00, 0xe4, 0x00, 0x00, 0xf4,
+    0x04, 0x00, 0x24, 0x01, 0x00, 0x48, 0x34, 0x00, 0x28, 0x07, 0x00, 0x4c, 0x59, 0x04, 0x58, 0x03,
+    0x00, 0x1c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x08, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xb4, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x98, 0x16, 0x00, 0xa8, 0x18, 0x00, 0x38, 0xfe, 0x00, 0x3c, 0x1c, 0x00,
+    0x44, 0x56, 0x00, 0xc0, 0x61, 0x00, 0xb0, 0x03, 0x00, 0x04, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x28,
+    0x07, 0x10, 0x17, 0x20, 0x04, 0x00, 0x64, 0x02, 0x00, 0x04, 0x00, 0x04, 0x20, 0x04, 0x02, 0xe0,
+    0x92, 0x0f, 0x08, 0x0f, 0x15, 0x00, 0x64, 0x97, 0x00, 0xe8, 0x29, 0x00, 0x78, 0x9c, 0x01, 0xac,
+    0x1a, 0x00, 0x20, 0x04, 0x40, 0x38, 0xbd, 0xff, 0x01, 0x1c, 0x35, 0x00, 0xa0, 0x15, 0x00, 0x18,
+    0x02, 0x00, 0x40, 0x02, 0x00, 0xa4, 0x02, 0x00, 0xe0, 0x03, 0x0f, 0xc0, 0x00, 0x09, 0x04, 0x1c,
+    0x00, 0x00, 0xec, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04,
+    0x00, 0x28, 0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x04, 0x02, 0x00, 0x10, 0x02, 0x00,
+    0x4c, 0x02, 0x00, 0x04, 0x00, 0x04, 0x38, 0x00, 0x08, 0x08, 0x00, 0x00, 0x18, 0x00, 0x05, 0x04,
+    0x00, 0x0f, 0x9c, 0x15, 0x34, 0x0c, 0x60, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x74,
+    0x05, 0x00, 0x6c, 0x10, 0x00, 0x90, 0x02, 0x00, 0x44, 0x0b, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0xc0, 0x00, 0x08, 0x24, 0x14, 0x01, 0x90, 0x00, 0x0f, 0x9c, 0x34, 0x1f, 0x00, 0x3c, 0x33,
+    0x00, 0x74, 0x85, 0x02, 0x60, 0x01, 0x11, 0xb4, 0x0c, 0x13, 0x01, 0xac, 0xac, 0x00, 0x94, 0x23,
+    0x00, 0xa4, 0x04, 0x00, 0x30, 0x89, 0x00, 0x04, 0x00, 0x00, 0x8c, 0x05, 0x00, 0x7c, 0x10, 0x00,
+    0x3c, 0x0e, 0x00, 0x98, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04,
+    0x00, 0x15, 0x04, 0x30, 0x00, 0x00, 0x40, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x50, 0x00, 0x22, 0x89,
+    0xe0, 0x58, 0xa5, 0x00, 0xd0, 0x09, 0x00, 0x70, 0x80, 0x03, 0xf4, 0x0a, 0x00, 0x58, 0x7e, 0x00,
+    0x44, 0x7a, 0x00, 0x7c, 0x30, 0x0f, 0x58, 0xa5, 0x11, 0x08, 0x7c, 0x03, 0x40, 0xc7, 0xd6, 0xea,
+    0xaa, 0x70, 0x51, 0x00, 0x50, 0x2f, 0x00, 0x18, 0x16, 0x00, 0x10, 0x0f, 0x02, 0x30, 0x0e, 0x12,
+    0xb2, 0xe4, 0xc9, 0x0f, 0x84, 0x07, 0x31, 0x00, 0x98, 0x2f, 0x21, 0x34, 0xbb, 0x58, 0x73, 0x05,
+    0x60, 0x07, 0x00, 0xa0, 0x02, 0x01, 0x54, 0x26, 0x00, 0xf4, 0x02, 0x04, 0x04, 0x00, 0x00, 0xfc,
+    0x02, 0x00, 0xdc, 0x71, 0x12, 0xb3, 0xe4, 0x0c, 0x00, 0xd0, 0x20, 0x01, 0x84, 0x07, 0x12, 0xe9,
+    0x00, 0x9d, 0x01, 0xb8, 0x01, 0x03, 0x84, 0x13, 0x0f, 0x48, 0x01, 0x05, 0x04, 0x24, 0x00, 0x00,
+    0x38, 0x01, 0x00, 0xfc, 0x01, 0x07, 0x84, 0x07, 0x02, 0xd8, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x68,
+    0x00, 0x00, 0xc0, 0x05, 0x02, 0xa4, 0x9f, 0x00, 0x84, 0x07, 0x0f, 0x08, 0x0f, 0x11, 0x00, 0x84,
+    0x07, 0x00, 0x6c, 0x80, 0x02, 0x90, 0x90, 0x00, 0x30, 0x33, 0x00, 0x4c, 0xa2, 0x12, 0xb9, 0xec,
+    0x0a, 0x00, 0xcc, 0x49, 0x00, 0x88, 0x47, 0x00, 0x98, 0x05, 0x00, 0x68, 0x1a, 0x00, 0x80, 0x00,
+    0x01, 0x8c, 0x00, 0x0f, 0xf4, 0x02, 0x00, 0x01, 0x18, 0x00, 0x07, 0x84, 0x82, 0x00, 0x4c, 0x03,
+    0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x01, 0xb4, 0x02, 0x00,
+    0xcc, 0x06, 0x0f, 0x40, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x2d, 0x01, 0x98,
+    0x00, 0x03, 0x18, 0x03, 0x0f, 0x84, 0x07, 0x21, 0x00, 0x80, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x04,
+    0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x7c, 0x00, 0x04, 0xc8, 0x03, 0x00, 0xa8,
+    0x04, 0x00, 0x84, 0x07, 0x00, 0x14, 0x01, 0x08, 0x1c, 0x4b, 0x00, 0x34, 0x02, 0x0f, 0x84, 0x07,
+    0x01, 0x00, 0x84, 0x15, 0x0f, 0x84, 0x07, 0x39, 0x00, 0xb8, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x98, 0x01, 0x00, 0x04, 0x0b,
+    0x00, 0xe8, 0x01, 0x00, 0x70, 0x00, 0x00, 0x88, 0x3b, 0x00, 0xf4, 0x2a, 0x08, 0x04, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x33, 0x00, 0x00, 0x0f, 0x00, 0x18,
+    0x75, 0x00, 0xfc, 0x05, 0x00, 0x0c, 0x15, 0x00, 0xc0, 0x07, 0x00, 0x60, 0x06, 0x00, 0xf0, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x04, 0x30, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x58, 0x06, 0x00, 0xd0, 0x47, 0x00, 0x48, 0x38, 0x00, 0xec, 0x04, 0x00, 0x94, 0x0b, 0x05,
+    0x34, 0x10, 0x11, 0xb3, 0xa8, 0x7f, 0x00, 0xe8, 0x6d, 0x3f, 0xb0, 0xbd, 0xdf, 0x04, 0x1e, 0x3e,
+    0x08, 0x40, 0x04, 0x0f, 0x84, 0x07, 0x3a, 0x00, 0x70, 0x01, 0x00, 0xe4, 0x00, 0x00, 0xe4, 0x0f,
+    0x00, 0x74, 0x61, 0x00, 0x4c, 0x03, 0x00, 0xc4, 0x05, 0x00, 0x60, 0x05, 0x00, 0xc0, 0x06, 0x00,
+    0x08, 0x0c, 0x00, 0x18, 0x03, 0x00, 0x24, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0x38, 0x01, 0x09, 0x00,
+    0x24, 0x00, 0x00, 0xb8, 0x01, 0x00, 0xa0, 0x06, 0x00, 0xa8, 0x06, 0x00, 0xb4, 0x01, 0x00, 0x4c,
+    0x3a, 0x00, 0x48, 0x20, 0x00, 0x08, 0x00, 0x00, 0x2c, 0x4b, 0x00, 0xb4, 0x03, 0x00, 0x64, 0x0a,
+    0x00, 0x48, 0x1f, 0x00, 0xa4, 0x9f, 0x00, 0x60, 0x02, 0x05, 0x04, 0x00, 0x00, 0x20, 0x04, 0x11,
+    0xb4, 0x84, 0x85, 0x0f, 0x08, 0x0f, 0x17, 0x11, 0xd7, 0x38, 0x58, 0x00, 0xa8, 0x70, 0x01, 0xc4,
+    0x0c, 0x00, 0xe0, 0x04, 0x00, 0x28, 0x62, 0x00, 0xd4, 0x58, 0x00, 0xdc, 0x03, 0x00, 0x10, 0x0f,
+    0x00, 0x28, 0x06, 0x00, 0x50, 0x08, 0x00, 0x98, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x00, 0x0f,
+    0xc8, 0x00, 0x0a, 0x00, 0x50, 0x99, 0x03, 0x80, 0xdc, 0x00, 0x80, 0x02, 0x00, 0x20, 0x04, 0x00,
+    0x4c, 0x00, 0x00, 0x1c, 0x03, 0x00, 0x38, 0x04, 0x00, 0xdc, 0x00, 0x0f, 0x4c, 0x00, 0x11, 0x00,
+    0x30, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x6c, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x25, 0x00, 0xc4, 0x00,
+    0x00, 0x6c, 0x01, 0x00, 0x24, 0x03, 0x00, 0x74, 0x05, 0x00, 0xb0, 0x01, 0x00, 0x90, 0x25, 0x00,
+    0x88, 0x07, 0x00, 0xc0, 0x01, 0x00, 0x14, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x24, 0x00, 0x00, 0x2c,
+    0x00, 0x00, 0x68, 0x00, 0x00, 0x08, 0x00, 0x00, 0x90, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x98, 0x0a,
+    0x00, 0xac, 0x0a, 0x0f, 0x94, 0x25, 0x10, 0x00, 0xf4, 0x6b, 0x15, 0x1d, 0x5c, 0x6f, 0x12, 0xb4,
+    0x28, 0x0e, 0x00, 0x1c, 0x76, 0x00, 0xd4, 0x1f, 0x00, 0x90, 0x03, 0x00, 0x60, 0x09, 0x00, 0x7c,
+    0x03, 0x00, 0x1c, 0x0f, 0x00, 0xec, 0x1f, 0x00, 0x38, 0x07, 0x00, 0x10, 0x0f, 0x04, 0x74, 0x00,
+    0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0xa4, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x48, 0x00, 0x00, 0xdc, 0x79, 0x00, 0xf0, 0x36, 0x00, 0xdc, 0x00, 0x00, 0xac, 0x00, 0x00,
+    0x84, 0x13, 0x00, 0xe4, 0x01, 0x21, 0x00, 0xb3, 0xd8, 0x9d, 0x00, 0x58, 0xa5, 0x00, 0x84, 0x6f,
+    0x0f, 0x9c, 0x34, 0x19, 0x08, 0x4c, 0x03, 0x00, 0x30, 0x0b, 0x31, 0x81, 0x8b, 0xcc, 0x80, 0x5a,
+    0x02, 0xac, 0x06, 0x12, 0xb2, 0x5c, 0x3e, 0x00, 0xcc, 0x1a, 0x00, 0x5c, 0x37, 0x00, 0x00, 0x03,
+    0x00, 0x90, 0x00, 0x00, 0x48, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0xbc, 0x00,
+    0x00, 0x60, 0x01, 0x00, 0x74, 0x04, 0x00, 0x00, 0x30, 0x00, 0xdc, 0x1d, 0x00, 0xa8, 0x0b, 0x00,
+    0x54, 0x05, 0x00, 0xac, 0x71, 0x05, 0xec, 0x02, 0x00, 0x10, 0x07, 0x03, 0x04, 0x00, 0x00, 0x80,
+    0x77, 0x00, 0xf8, 0x0c, 0x00, 0x64, 0x5e, 0x00, 0x4c, 0x4e, 0x00, 0x58, 0x01, 0x00, 0xac, 0x0a,
+    0x00, 0xc4, 0x01, 0x00, 0xd0, 0x0a, 0x00, 0x58, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x7c, 0x00, 0x0d,
+    0x00, 0x24, 0x00, 0x04, 0x10, 0x02, 0x04, 0x84, 0x07, 0x00, 0x5c, 0x17, 0xa1, 0x00, 0xb3, 0xff,
+    0x02, 0x00, 0xb4, 0xff, 0x16, 0x19, 0xb6, 0x80, 0x30, 0x00, 0x28, 0x3c, 0x00, 0x88, 0x63, 0x00,
+    0x8c, 0x8b, 0x00, 0x64, 0xde, 0x0f, 0x10, 0x9f, 0x09, 0x00, 0x30, 0x1e, 0x00, 0x3c, 0x26, 0x00,
+    0x3c, 0x7a, 0x00, 0xc8, 0x7f, 0x00, 0xb8, 0x17, 0x31, 0x17, 0x1b, 0xb6, 0xfc, 0x28, 0x01, 0xe8,
+    0x5b, 0x00, 0xc8, 0x03, 0x00, 0x1c, 0x09, 0x00, 0x3c, 0x06, 0x00, 0x08, 0x28, 0x0f, 0x18, 0x03,
+    0x09, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x24, 0x00, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03,
+    0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00, 0x6c, 0x04, 0x00,
+    0x6c, 0x01, 0x00, 0xa8, 0x02, 0x0f, 0xf0, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x39, 0x00, 0x94, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0xb8, 0x01, 0x0f, 0x84, 0x07, 0x1d, 0x00, 0xa0, 0x0c, 0x00, 0x74, 0x01,
+    0x00, 0xb0, 0x11, 0x00, 0xb4, 0x02, 0x00, 0xdc, 0x00, 0x00, 0xc4, 0x00, 0x0f, 0xa0, 0x00, 0x15,
+    0x00, 0x78, 0x00, 0x00, 0x80, 0x00, 0x00, 0xac, 0x03, 0x00, 0x00, 0x01, 0x00, 0x44, 0x0e, 0x00,
+    0x00, 0x0a, 0x00, 0xbc, 0x39, 0x00, 0xd0, 0x48, 0x00, 0x68, 0x5f, 0x08, 0x80, 0x75, 0x01, 0x40,
+    0x02, 0x00, 0x50, 0x09, 0x02, 0x0c, 0x0b, 0x01, 0xfc, 0x2a, 0x00, 0x7c, 0x20, 0x00, 0x64, 0x0c,
+    0x00, 0x74, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x05, 0xc8, 0x00,
+    0x12, 0xf4, 0x5c, 0x69, 0x00, 0xcc, 0x00, 0x00, 0x04, 0x00, 0x00, 0x78, 0x0e, 0x00, 0xcc, 0x02,
+    0x00, 0xd4, 0x14, 0x00, 0xf4, 0x06, 0x00, 0x48, 0x3f, 0x00, 0x08, 0x0b, 0x00, 0x00, 0x08, 0x00,
+    0xac, 0x02, 0x08, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x10, 0x00, 0x00, 0xf0, 0x05, 0x00, 0xbc,
+    0x00, 0x00, 0x7c, 0x02, 0x00, 0x4c, 0x91, 0x0f, 0x84, 0x07, 0x35, 0x00, 0x94, 0x0b, 0x00, 0x68,
+    0x0f, 0x00, 0xf4, 0x50, 0x00, 0xdc, 0x07, 0x00, 0xfc, 0x58, 0x52, 0x0e, 0xb6, 0xff, 0x10, 0x18,
+    0xa4, 0x8e, 0x00, 0xd4, 0x7a, 0x00, 0x60, 0x21, 0x00, 0xc0, 0x0d, 0x0f, 0x44, 0x5e, 0x1d, 0x08,
+    0x14, 0x04, 0x0f, 0x0c, 0x00, 0x11, 0x0f, 0x84, 0x07, 0x3b, 0x00, 0x74, 0x0a, 0x03, 0x24, 0xf9,
+    0x00, 0x98, 0xcb, 0x00, 0xfc, 0x03, 0x00, 0x04, 0x02, 0x00, 0x84, 0x04, 0x00, 0x70, 0x08, 0x00,
+    0xbc, 0x06, 0x00, 0x20, 0x02, 0x00, 0xdc, 0x01, 0x00, 0x30, 0x02, 0x0f, 0xdc, 0x01, 0x09, 0x01,
+    0x24, 0x00, 0x03, 0xe8, 0x0a, 0x00, 0x40, 0x05, 0x00, 0x74, 0x16, 0x00, 0xf8, 0x1d, 0x00, 0xd0,
+    0xbd, 0x00, 0x98, 0x01, 0x00, 0xb8, 0x17, 0x00, 0x08, 0x00, 0x00, 0x10, 0x73, 0x00, 0x94, 0x04,
+    0x00, 0x7c, 0x04, 0x01, 0x54, 0x02, 0x11, 0xb5, 0x44, 0x8d, 0x31, 0x1f, 0x23, 0xb7, 0xc8, 0xb2,
+    0x00, 0xb4, 0x22, 0x00, 0xb4, 0x94, 0x0f, 0x0c, 0x01, 0x11, 0x00, 0x20, 0xbd, 0x00, 0x04, 0x27,
+    0x00, 0x98, 0x9a, 0x00, 0x34, 0x78, 0x50, 0x19, 0x1c, 0xb6, 0xff, 0x07, 0x1c, 0x04, 0x00, 0xbc,
+    0x02, 0x00, 0xbc, 0x6a, 0x00, 0xe4, 0x03, 0x00, 0x5c, 0x1b, 0x00, 0x40, 0x09, 0x00, 0x28, 0x03,
+    0x04, 0xa4, 0x00, 0x0f, 0xc8, 0x00, 0x0a, 0x0f, 0x84, 0x07, 0x2c, 0x00, 0x30, 0x01, 0x00, 0x8c,
+    0x03, 0x00, 0xc4, 0x02, 0x00, 0x74, 0x00, 0x00, 0xa4, 0x03, 0x00, 0xe4, 0x02, 0x0f, 0x74, 0x00,
+    0x09, 0x0f, 0x1c, 0x00, 0x1d, 0x04, 0xc8, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xa4, 0x01, 0x00, 0xac,
+    0x01, 0x00, 0x88, 0x28, 0x00, 0x44, 0x70, 0x00, 0x90, 0x26, 0x00, 0x3c, 0x37, 0x00, 0xb8, 0x19,
+    0x08, 0x7c, 0x00, 0x04, 0x34, 0x00, 0x00, 0x6c, 0x04, 0x0f, 0x84, 0x07, 0x18, 0x00, 0x70, 0x55,
+    0x00, 0x28, 0x81, 0x00, 0x60, 0x01, 0x00, 0x98, 0x8e, 0x32, 0x08, 0x16, 0xb6, 0xec, 0xaa, 0x00,
+    0x10, 0x3f, 0x04, 0xd4, 0x01, 0x00, 0x08, 0x00, 0x00, 0x70, 0x06, 0x00, 0x78, 0x06, 0x00, 0xb4,
+    0x03, 0x00, 0xc0, 0x12, 0x00, 0xd4, 0x00, 0x00, 0x74, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00,
+    0x15, 0x04, 0x30, 0x00, 0x00, 0x54, 0x04, 0x00, 0x58, 0x0f, 0x00, 0xd8, 0x07, 0x00, 0xd0, 0x12,
+    0x00, 0x34, 0x02, 0x61, 0x0e, 0xb6, 0xff, 0x0d, 0x16, 0xb6, 0xf0, 0x87, 0x31, 0x2d, 0x30, 0xb8,
+    0x18, 0x83, 0x31, 0x83, 0x8e, 0xcd, 0xf4, 0x0a, 0x4f, 0xcf, 0xde, 0xef, 0x44, 0x30, 0x02, 0x11,
+    0x0c, 0x24, 0x00, 0x00, 0xc8, 0xab, 0x00, 0xfc, 0xa5, 0x00, 0x40, 0x02, 0x0f, 0x84, 0x07, 0x36,
+    0x00, 0xf4, 0x01, 0x00, 0x90, 0x06, 0x00, 0xfc, 0x6d, 0x00, 0x80, 0x04, 0x00, 0x04, 0x03, 0x00,
+    0xd8, 0x39, 0x00, 0xf4, 0x71, 0x01, 0xf0, 0x02, 0x00, 0x44, 0x05, 0x03, 0x80, 0x07, 0x00, 0x50,
+    0x08, 0x00, 0xe4, 0x24, 0x00, 0xac, 0x93, 0x00, 0xe8, 0x00, 0x00, 0xc0, 0x11, 0x00, 0x68, 0x1d,
+    0x00, 0x58, 0x10, 0x00, 0x14, 0x0b, 0x00, 0xc0, 0x01, 0x00, 0x14, 0x01, 0x0f, 0x7c, 0x03, 0x15,
+    0x00, 0x30, 0x00, 0x00, 0xbc, 0x07, 0x04, 0x84, 0x07, 0x00, 0x0c, 0x03, 0x61, 0x00, 0xb3, 0xff,
+    0x09, 0x01, 0xb5, 0x00, 0x7a, 0x00, 0xd0, 0x0e, 0x00, 0x40, 0x78, 0x00, 0x30, 0x4b, 0x00, 0x3c,
+    0x03, 0x00, 0x7c, 0x52, 0x00, 0x04, 0x01, 0x00, 0xcc, 0x4f, 0x01, 0x04, 0x00, 0x12, 0xc8, 0x08,
+    0x00, 0x00, 0x64, 0xa5, 0x00, 0x1c, 0x69, 0x00, 0xa4, 0x08, 0x00, 0xdc, 0x69, 0x00, 0x44, 0x2d,
+    0x00, 0xe4, 0x13, 0x00, 0x48, 0x35, 0x00, 0xc4, 0x79, 0x11, 0x10, 0xe8, 0x34, 0x03, 0x14, 0x0f,
+    0x00, 0xb8, 0x00, 0x00, 0xb8, 0x0f, 0x00, 0xf4, 0x03, 0x00, 0x80, 0x00, 0x01, 0x44, 0x07, 0x0f,
+    0xb8, 0x0f, 0x00, 0x01, 0xc8, 0x00, 0x03, 0x20, 0x04, 0x0f, 0x84, 0x07, 0xad, 0x04, 0x90, 0x01,
+    0x00, 0xb0, 0x1b, 0x00, 0x90, 0x19, 0x00, 0xfc, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x48, 0x07, 0x00,
+    0x60, 0x03, 0x0f, 0xf0, 0x03, 0x15, 0x00, 0x48, 0x00, 0x00, 0x18, 0x01, 0x00, 0xb8, 0x07, 0x00,
+    0xf0, 0x06, 0x00, 0x98, 0x03, 0x00, 0xc0, 0x03, 0x00, 0x08, 0x17, 0x00, 0x4c, 0x0e, 0x00, 0xe4,
+    0x08, 0x01, 0x78, 0x33, 0x0b, 0x34, 0x02, 0x00, 0x38, 0x02, 0x00, 0x9c, 0x25, 0x0f, 0x84, 0x07,
+    0x35, 0x00, 0xb8, 0x01, 0x00, 0xe4, 0x06, 0x00, 0x3c, 0x02, 0x00, 0x08, 0x15, 0x00, 0xc4, 0x03,
+    0x00, 0x04, 0x00, 0x00, 0xf4, 0x06, 0x00, 0xc8, 0x05, 0x00, 0x14, 0x06, 0x00, 0x60, 0x07, 0x00,
+    0x78, 0x00, 0x01, 0x88, 0x12, 0x00, 0x90, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x02, 0x50, 0x0d, 0x01,
+    0x28, 0x67, 0x00, 0x04, 0x03, 0x05, 0xd0, 0x3c, 0x03, 0x70, 0x06, 0x0f, 0x10, 0x04, 0x15, 0x00,
+    0x28, 0x00, 0x00, 0x50, 0x02, 0x00, 0x08, 0x00, 0x00, 0x20, 0x01, 0x00, 0x50, 0x0d, 0x00, 0x9c,
+    0x06, 0x00, 0xec, 0x65, 0x01, 0x88, 0x00, 0x11, 0xb3, 0x8c, 0x43, 0x02, 0x98, 0x91, 0x11, 0xc4,
+    0xcc, 0x03, 0x00, 0x70, 0x51, 0x00, 0xd0, 0x2f, 0x0c, 0xec, 0x03, 0x0f, 0x10, 0x00, 0x39, 0x0f,
+    0x84, 0x07, 0x46, 0x00, 0x4c, 0x1f, 0x00, 0xb0, 0x06, 0x00, 0xf0, 0x08, 0x00, 0x3c, 0x34, 0x00,
+    0xcc, 0x15, 0x00, 0x20, 0x11, 0x00, 0x20, 0x02, 0x08, 0xd4, 0x14, 0x00, 0x10, 0x01, 0x0f, 0x04,
+    0x00, 0x01, 0x00, 0x4c, 0x02, 0x00, 0x04, 0x00, 0x00, 0xd0, 0x01, 0x00, 0xc4, 0x1b, 0x00, 0x54,
+    0x0f, 0x00, 0xec, 0x0a, 0x00, 0x18, 0x06, 0x00, 0x38, 0x0d, 0x00, 0xa0, 0x0e, 0x0f, 0x84, 0x04,
+    0x00, 0x00, 0x24, 0x22, 0x00, 0x7c, 0x7f, 0x00, 0xbc, 0x7f, 0x00, 0x40, 0x39, 0x31, 0x8b, 0x96,
+    0xcf, 0xac, 0x8f, 0x00, 0xa8, 0x7d, 0x0f, 0x38, 0x01, 0x09, 0x00, 0x1c, 0x3c, 0x31, 0xa4, 0xb0,
+    0xda, 0x88, 0xa9, 0x00, 0x80, 0x48, 0x00, 0x94, 0x16, 0x50, 0x41, 0x47, 0xbb, 0xff, 0x17, 0x24,
+    0x06, 0x08, 0x68, 0x64, 0x00, 0x18, 0x06, 0x00, 0x5c, 0x17, 0x00, 0x30, 0x03, 0x00, 0xd0, 0x01,
+    0x00, 0x04, 0x00, 0x0f, 0xc0, 0x00, 0x01, 0x04, 0x14, 0x00, 0x00, 0x18, 0x03, 0x00, 0x24, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0x54, 0x03, 0x00, 0xa4, 0x0b, 0x00, 0xac, 0x0b, 0x00, 0xd0, 0x07, 0x00,
+    0xd0, 0x00, 0x00, 0x6c, 0x03, 0x00, 0x64, 0x07, 0x00, 0xec, 0x00, 0x00, 0x04, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x34, 0x00, 0x00, 0x40, 0x06, 0x00, 0xd4, 0x17, 0x00, 0x28, 0x00,
+    0x00, 0x54, 0x01, 0x00, 0x3c, 0x02, 0x00, 0x14, 0x01, 0x00, 0x58, 0x00, 0x0c, 0x30, 0x00, 0x00,
+    0x34, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x04, 0x4c, 0x00, 0x00, 0x70, 0x00, 0x00, 0xac, 0x0d, 0x00,
+    0xc0, 0x0b, 0x00, 0xb0, 0x01, 0x00, 0x14, 0x54, 0x00, 0x08, 0x00, 0x00, 0xac, 0x02, 0x00, 0xf4,
+    0x00, 0x00, 0x88, 0x01, 0x04, 0x14, 0x04, 0x00, 0xd4, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0xec, 0x03, 0x0f, 0x08, 0x0f, 0x05, 0x0b, 0x38, 0x69, 0x00, 0x7c, 0x2e, 0x00, 0x60, 0x01,
+    0x00, 0x7c, 0x85, 0x33, 0x3a, 0x40, 0xba, 0xa0, 0x9d, 0x03, 0x64, 0x03, 0x01, 0x14, 0xbc, 0x00,
+    0xac, 0x88, 0x03, 0x40, 0x94, 0x00, 0x80, 0x15, 0x00, 0x40, 0x11, 0x00, 0x04, 0x01, 0x00, 0xd8,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0xa4, 0x00, 0x00, 0x2c,
+    0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x04, 0x00, 0x64, 0x0f, 0x00, 0x88, 0x04, 0x03, 0x70, 0x03,
+    0x31, 0x21, 0x24, 0xb7, 0xac, 0x18, 0x31, 0x67, 0x6f, 0xc3, 0x68, 0x42, 0x3f, 0xa2, 0xae, 0xd9,
+    0x50, 0x15, 0x0e, 0x0f, 0x44, 0x02, 0x09, 0x31, 0xb7, 0xc6, 0xe3, 0xb8, 0x03, 0x0f, 0x84, 0x07,
+    0x33, 0x03, 0x40, 0x15, 0x00, 0xec, 0x01, 0x00, 0x90, 0x37, 0x00, 0xd0, 0x04, 0x00, 0xc4, 0x00,
+    0x00, 0x54, 0x03, 0x00, 0x40, 0x02, 0x00, 0xa8, 0x08, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x50, 0x0e,
+    0x00, 0xb8, 0x11, 0x00, 0xec, 0x00, 0x00, 0x4c, 0x09, 0x00, 0xfc, 0x04, 0x00, 0x3c, 0x67, 0x00,
+    0xa8, 0x01, 0x0f, 0xcc, 0x05, 0x16, 0x03, 0xdc, 0x04, 0x00, 0x7c, 0x00, 0x00, 0x78, 0x00, 0x04,
+    0x84, 0x07, 0x00, 0x8c, 0x0a, 0x61, 0x00, 0xb2, 0xff, 0x10, 0x0b, 0xb5, 0xe4, 0xe5, 0x00, 0x3c,
+    0x8f, 0x00, 0x54, 0x07, 0x00, 0xf8, 0x4a, 0x00, 0xdc, 0x44, 0x00, 0x60, 0x6c, 0x00, 0x60, 0x07,
+    0x00, 0xc0, 0x6c, 0x00, 0x04, 0x00, 0x00, 0xac, 0x9f, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x30, 0x1f, 0x00, 0x04, 0x0f, 0x00, 0xec, 0x17, 0x00, 0x8c, 0x07, 0x00, 0x6c, 0x03, 0x00, 0x74,
+    0x01, 0x00, 0x54, 0xae, 0x20, 0x19, 0x16, 0x44, 0x08, 0x00, 0x04, 0x29, 0x07, 0x7c, 0x8f, 0x00,
+    0x88, 0x06, 0x00, 0x80, 0x00, 0x00, 0xc4, 0x01, 0x0f, 0xf8, 0x01, 0x01, 0x00, 0x14, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x1c, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x1c,
+    0x01, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00, 0xd0, 0x02, 0x01, 0x40, 0x00, 0x03, 0x4c, 0x01,
+    0x00, 0x0c, 0x02, 0x0f, 0x04, 0x00, 0x4d, 0x00, 0x94, 0x00, 0x00, 0x50, 0x03, 0x00, 0x70, 0x01,
+    0x00, 0x48, 0x03, 0x00, 0x2c, 0x1b, 0x00, 0xac, 0x13, 0x00, 0x08, 0x07, 0x00, 0x48, 0x03, 0x00,
+    0x9c, 0x06, 0x00, 0x84, 0x00, 0x00, 0x98, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x34,
+    0x00, 0x00, 0x9c, 0x01, 0x00, 0x1c, 0x00, 0x00, 0xb4, 0x2f, 0x00, 0xb8, 0x01, 0x00, 0xac, 0x06,
+    0x00, 0xf4, 0x04, 0x00, 0x74, 0x03, 0x00, 0x08, 0x01, 0x00, 0x24, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x30, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x24, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xb4, 0x0b, 0x00,
+    0xd0, 0x17, 0x00, 0x04, 0x07, 0x00, 0x10, 0x0f, 0x00, 0x88, 0x00, 0x00, 0xe0, 0x08, 0x05, 0x78,
+    0x42, 0x00, 0xf4, 0x06, 0x00, 0x78, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x08, 0x0f, 0x34, 0x00, 0xa4,
+    0x00, 0x00, 0x9c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xac, 0x04, 0x00, 0xe8, 0x24, 0x00, 0xc0, 0x14,
+    0x00, 0xc4, 0x1d, 0x00, 0x4c, 0x25, 0x00, 0xe4, 0x07, 0x00, 0xbc, 0x14, 0x00, 0xc0, 0x05, 0x00,
+    0x78, 0x0e, 0x0f, 0x84, 0x07, 0x22, 0x1f, 0xd1, 0x84, 0x07, 0x37, 0x00, 0x9c, 0x12, 0x00, 0xec,
+    0x16, 0x00, 0x90, 0x6f, 0x01, 0xe4, 0x05, 0x11, 0xb3, 0x5c, 0x0a, 0x00, 0x0c, 0x2d, 0x00, 0xf0,
+    0x89, 0x00, 0x90, 0x0b, 0x00, 0xc4, 0x20, 0x2f, 0xd0, 0xe0, 0xe8, 0xa1, 0x1b, 0x0f, 0x24, 0x04,
+    0x09, 0x0f, 0x1c, 0x00, 0x01, 0x0f, 0x84, 0x07, 0x46, 0x00, 0x44, 0x03, 0x00, 0xd0, 0x0a, 0x00,
+    0x18, 0x03, 0x00, 0xfc, 0x13, 0x00, 0xcc, 0x05, 0x0f, 0x84, 0x07, 0x19, 0x00, 0xcc, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0x48, 0x03, 0x00, 0xd0, 0x02, 0x00, 0x54, 0x03, 0x00, 0xec, 0x05, 0x00, 0x5c,
+    0x0f, 0x00, 0xd0, 0x02, 0x00, 0x4c, 0x14, 0x01, 0x84, 0x04, 0x04, 0xc0, 0x05, 0x02, 0x50, 0x02,
+    0x31, 0x02, 0x03, 0xb5, 0x90, 0x34, 0x00, 0xd0, 0x26, 0x00, 0x7c, 0x07, 0x00, 0x30, 0xa3, 0x00,
+    0x9c, 0x47, 0x00, 0x28, 0x7c, 0x00, 0x40, 0x31, 0x22, 0x8b, 0x97, 0x14, 0x04, 0x06, 0x20, 0x04,
+    0x11, 0xcf, 0xc8, 0x0b, 0x00, 0xb0, 0x29, 0x00, 0x0c, 0x54, 0x00, 0x20, 0x04, 0x00, 0x08, 0x00,
+    0x00, 0xc0, 0x16, 0x64, 0x5c, 0x63, 0xc0, 0xff, 0x23, 0x23, 0x18, 0x8c, 0x03, 0xf4, 0x7a, 0x0f,
+    0x84, 0x07, 0x51, 0x00, 0xcc, 0x02, 0x00, 0x4c, 0x03, 0x00, 0x60, 0x04, 0x00, 0x98, 0x0e, 0x00,
+    0x40, 0x19, 0x00, 0x08, 0x05, 0x00, 0x48, 0x57, 0x00, 0x94, 0x0e, 0x00, 0x10, 0x01, 0x00, 0x1c,
+    0x01, 0x08, 0xc8, 0x03, 0x00, 0x10, 0x00, 0x0f, 0x04, 0x00, 0x29, 0x00, 0x70, 0x00, 0x04, 0xbc,
+    0x03, 0x00, 0xf8, 0x03, 0x00, 0x74, 0x07, 0x00, 0x78, 0x00, 0x00, 0x70, 0x01, 0x00, 0x4c, 0x0d,
+    0x00, 0xc0, 0x01, 0x00, 0x04, 0x06, 0x00, 0xd8, 0x03, 0x00, 0x14, 0x04, 0x04, 0x48, 0x09, 0x00,
+    0x8c, 0x00, 0x00, 0x98, 0x01, 0x0f, 0x84, 0x07, 0x00, 0x00, 0x24, 0x0d, 0x00, 0x8c, 0x79, 0x00,
+    0x78, 0x02, 0x35, 0xd7, 0xe7, 0xf3, 0xd0, 0x9d, 0x00, 0x54, 0x49, 0x00, 0x94, 0x79, 0x00, 0xec,
+    0x11, 0x10, 0x19, 0x44, 0x2c, 0x03, 0x14, 0x07, 0x00, 0xa8, 0x23, 0x32, 0x01, 0x00, 0xb2, 0x64,
+    0x36, 0x00, 0x64, 0x06, 0x00, 0x14, 0x1a, 0x0f, 0x84, 0x07, 0x35, 0x00, 0xd0, 0x04, 0x00, 0x98,
+    0x06, 0x00, 0x3c, 0x11, 0x01, 0x70, 0x03, 0x02, 0xec, 0x87, 0x31, 0x65, 0x6e, 0xc3, 0x20, 0x06,
+    0x00, 0xa8, 0x00, 0x3f, 0xc1, 0xd0, 0xe7, 0x4c, 0x15, 0x0a, 0x00, 0xc8, 0x00, 0x0f, 0x04, 0x00,
+    0x09, 0x00, 0xc0, 0x30, 0x00, 0xd8, 0x00, 0x00, 0x84, 0x20, 0x0f, 0x08, 0x0f, 0x2e, 0x04, 0xcc,
+    0x01, 0x00, 0x94, 0x01, 0x00, 0x04, 0x03, 0x00, 0xf4, 0x09, 0x00, 0xcc, 0x0e, 0x00, 0xc8, 0x00,
+    0x00, 0x50, 0x05, 0x05, 0x00, 0x03, 0x00, 0x44, 0x05, 0x02, 0xfc, 0x02, 0x01, 0x74, 0x00, 0x00,
+    0xac, 0x46, 0x00, 0x60, 0x6c, 0x00, 0x7c, 0x03, 0x00, 0xc4, 0x01, 0x00, 0xc0, 0x07, 0x00, 0xb0,
+    0x01, 0x00, 0x48, 0x00, 0x04, 0x54, 0x00, 0x0f, 0x08, 0x00, 0x0d, 0x01, 0x80, 0x02, 0x03, 0xd0,
+    0x12, 0x08, 0x84, 0x07, 0x01, 0xf0, 0x19, 0x91, 0xb2, 0xff, 0x13, 0x0f, 0xb5, 0xff, 0x58, 0x5f,
+    0xbf, 0x60, 0x12, 0x00, 0x30, 0x5a, 0x00, 0x64, 0x16, 0x00, 0x8c, 0x7f, 0x31, 0x87, 0x91, 0xce,
+    0x6c, 0xb1, 0x31, 0x4a, 0x51, 0xbd, 0xc8, 0xcc, 0x00, 0xac, 0x3c, 0x00, 0x0c, 0x00, 0x00, 0x10,
+    0x1a, 0x00, 0x34, 0x0f, 0x00, 0x58, 0xc5, 0x00, 0xfc, 0x01, 0x00, 0x48, 0xa2, 0x00, 0x2c, 0x01,
+    0x00, 0x80, 0xa5, 0x00, 0x0c, 0x0f, 0x24, 0x1d, 0x1e, 0x64, 0x03, 0x12, 0xb5, 0x00, 0x97, 0x00,
+    0xfc, 0x09, 0x00, 0x24, 0x2d, 0x00, 0x7c, 0x09, 0x00, 0xfc, 0x00, 0x00, 0xcc, 0x23, 0x0c, 0xb4,
+    0x00, 0x04, 0xa4, 0x00, 0x00, 0x24, 0x03, 0x0f, 0x84, 0x07, 0xb5, 0x00, 0xe0, 0x01, 0x00, 0xb8,
+    0x06, 0x00, 0xf8, 0x02, 0x00, 0x1c, 0x06, 0x00, 0x74, 0x03, 0x00, 0x48, 0x05, 0x00, 0xe4, 0x00,
+    0x04, 0xf0, 0x00, 0x0c, 0x08, 0x01, 0x0f, 0x10, 0x00, 0x05, 0x00, 0xf0, 0x01, 0x00, 0xf8, 0x01,
+    0x00, 0x44, 0x01, 0x00, 0x70, 0x34, 0x00, 0xd4, 0x07, 0x00, 0x0c, 0x0d, 0x01, 0x40, 0x11, 0x00,
+    0x34, 0x02, 0x00, 0x04, 0x00, 0x04, 0x38, 0x02, 0x0f, 0x84, 0x07, 0x3c, 0x00, 0x74, 0x00, 0x00,
+    0x14, 0x04, 0x00, 0x2c, 0x05, 0x00, 0x64, 0x49, 0x00, 0x0c, 0x17, 0x00, 0x6c, 0x1d, 0x00, 0x14,
+    0x44, 0x00, 0xd8, 0x03, 0x00, 0x70, 0x83, 0x01, 0x90, 0x0f, 0x00, 0x80, 0x00, 0x0f, 0x04, 0x00,
+    0x11, 0x00, 0xe4, 0x05, 0x12, 0xb5, 0x30, 0x76, 0x0f, 0x08, 0x0f, 0x3d, 0x00, 0xf0, 0x13, 0x00,
+    0x10, 0x17, 0x01, 0x14, 0x04, 0x51, 0xb3, 0xff, 0x42, 0x47, 0xbb, 0x24, 0x0c, 0x00, 0x34, 0x06,
+    0x0f, 0x1c, 0x78, 0x31, 0x0f, 0x30, 0x04, 0x09, 0x04, 0x1c, 0x00, 0x0f, 0x84, 0x07, 0x46, 0x00,
+    0x08, 0x09, 0x00, 0x4c, 0x1c, 0x00, 0x80, 0x07, 0x00, 0x04, 0x00, 0x00, 0x14, 0x04, 0x00, 0x2c,
+    0x03, 0x00, 0xb4, 0x05, 0x00, 0x20, 0x02, 0x0f, 0x58, 0x03, 0x01, 0x0f, 0x50, 0x02, 0x0d, 0x04,
+    0x28, 0x0a, 0x00, 0x50, 0x18, 0x00, 0xac, 0x14, 0x00, 0x84, 0x16, 0x01, 0xc0, 0x05, 0x06, 0x50,
+    0x02, 0x71, 0x03, 0x03, 0xb5, 0xff, 0x4f, 0x55, 0xbd, 0xb4, 0x94, 0x00, 0x50, 0x07, 0x31, 0xbe,
+    0xcc, 0xe6, 0x08, 0x00, 0x00, 0x00, 0x4b, 0x00, 0xdc, 0x0e, 0x00, 0xb8, 0xa3, 0x31, 0x49, 0x4f,
+    0xbc, 0xc8, 0x0b, 0x00, 0x74, 0x10, 0x00, 0x0c, 0x00, 0x00, 0xc8, 0x43, 0x00, 0x7c, 0x1f, 0x00,
+    0x50, 0x4b, 0x00, 0x18, 0xb1, 0x00, 0x54, 0x85, 0x00, 0x30, 0x69, 0x00, 0xe8, 0x1a, 0x24, 0x28,
+    0x2a, 0x68, 0x6f, 0x03, 0xec, 0x6b, 0x00, 0x04, 0x02, 0x00, 0xd8, 0x14, 0x00, 0x8c, 0x00, 0x00,
+    0xbc, 0x15, 0x0f, 0xc8, 0x00, 0x0d, 0x00, 0xdc, 0x06, 0x00, 0x2c, 0x07, 0x00, 0x4c, 0x04, 0x00,
+    0x48, 0x08, 0x00, 0xa4, 0x0b, 0x00, 0xac, 0x0b, 0x00, 0x9c, 0x08, 0x00, 0xbc, 0x0b, 0x00, 0x14,
+    0x01, 0x0c, 0x64, 0x03, 0x04, 0x70, 0x03, 0x00, 0x88, 0x14, 0x00, 0x74, 0x07, 0x00, 0xfc, 0x0c,
+    0x00, 0x00, 0x10, 0x00, 0x9c, 0x03, 0x00, 0x94, 0x14, 0x00, 0x48, 0x00, 0x00, 0x94, 0x05, 0x0f,
+    0x48, 0x01, 0x1d, 0x0f, 0x60, 0x01, 0x05, 0x08, 0x18, 0x00, 0x00, 0x54, 0x00, 0x04, 0xbc, 0x03,
+    0x00, 0x00, 0x04, 0x00, 0xb0, 0x00, 0x00, 0xe0, 0x60, 0x00, 0xd8, 0x14, 0x08, 0x14, 0x04, 0x00,
+    0xc4, 0x3b, 0x00, 0xd8, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x70, 0x03, 0x05, 0x84, 0x07, 0x00, 0x8c,
+    0x01, 0x02, 0x78, 0x4a, 0x00, 0xd8, 0x17, 0x04, 0xf0, 0x94, 0x84, 0xd6, 0xe6, 0xf3, 0x44, 0xd9,
+    0xea, 0xf4, 0xcc, 0x78, 0x02, 0x31, 0xa4, 0xb1, 0xda, 0x74, 0x81, 0x00, 0x34, 0x0e, 0x00, 0x4c,
+    0x45, 0x50, 0x12, 0x14, 0xb6, 0xff, 0x09, 0xf4, 0xd3, 0x04, 0xd0, 0x01, 0x0f, 0x1c, 0x13, 0x31,
+    0x00, 0x48, 0x01, 0x00, 0xdc, 0x00, 0x04, 0x08, 0x0f, 0x00, 0x40, 0x01, 0x01, 0x04, 0x13, 0x00,
+    0xd4, 0x03, 0x11, 0xb3, 0x7c, 0x30, 0x00, 0x84, 0x00, 0x3f, 0xa7, 0xb5, 0xdb, 0x10, 0x77, 0x32,
+    0x00, 0x58, 0x06, 0x0f, 0x84, 0x07, 0x3e, 0x00, 0xc0, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x60, 0x0c, 0x00, 0x28, 0x0d, 0x00, 0xdc, 0x74, 0x00, 0x1c, 0x1b, 0x05, 0x84, 0x0a, 0x00,
+    0xc8, 0x04, 0x00, 0x78, 0x01, 0x12, 0xb3, 0x44, 0xc8, 0x00, 0x14, 0x6a, 0x00, 0x54, 0x1d, 0x01,
+    0xf4, 0x0a, 0x12, 0xf5, 0xa8, 0x01, 0x00, 0x40, 0x00, 0x00, 0x4c, 0x00, 0x0f, 0x04, 0x00, 0x11,
+    0x00, 0x2c, 0x00, 0x00, 0x34, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x44, 0x00, 0x00, 0xc0, 0x05, 0x07,
+    0x60, 0x2b, 0x31, 0x12, 0x0c, 0xb5, 0x14, 0x3c, 0x00, 0x74, 0x07, 0x00, 0x54, 0x07, 0x00, 0x30,
+    0x0c, 0x00, 0x30, 0x03, 0x64, 0x6f, 0x77, 0xc5, 0xff, 0x33, 0x34, 0x14, 0x2e, 0x00, 0x64, 0x01,
+    0x03, 0x94, 0x00, 0xa1, 0x00, 0xb3, 0xff, 0x2c, 0x2c, 0xb7, 0xff, 0x69, 0x70, 0xc3, 0xa8, 0x70,
+    0x04, 0x38, 0x0f, 0x00, 0x0c, 0x0b, 0x60, 0x58, 0x60, 0xc0, 0xff, 0x1b, 0x1b, 0x84, 0x07, 0x00,
+    0x30, 0x00, 0x03, 0x68, 0x05, 0x00, 0x2c, 0x09, 0x00, 0x70, 0x0a, 0x00, 0xfc, 0x30, 0x00, 0x9c,
+    0x15, 0x00, 0xf8, 0x00, 0x00, 0x40, 0x03, 0x08, 0xbc, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x3c, 0x03, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03, 0x00,
+    0xb4, 0x02, 0x00, 0x24, 0x03, 0x00, 0x34, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x28, 0x00, 0x0d, 0x04,
+    0x00, 0x0f, 0x1c, 0x0f, 0x44, 0x01, 0x68, 0x00, 0x0f, 0x94, 0x25, 0x18, 0x08, 0x20, 0x04, 0x00,
+    0xfc, 0x0a, 0x00, 0x04, 0x0f, 0x00, 0xc4, 0x00, 0x00, 0x70, 0x01, 0x00, 0x44, 0x0e, 0x00, 0xf8,
+    0x1a, 0x00, 0xe4, 0x00, 0x04, 0xc8, 0x00, 0x08, 0x04, 0x01, 0x0f, 0x0c, 0x00, 0x09, 0x04, 0x58,
+    0x00, 0x00, 0xd0, 0x03, 0x00, 0x38, 0x0b, 0x00, 0x0c, 0x0f, 0x00, 0x58, 0x00, 0x00, 0x88, 0x19,
+    0x04, 0x64, 0x03, 0x01, 0x40, 0x02, 0x00, 0xa4, 0x01, 0x0f, 0x84, 0x07, 0x3c, 0x04, 0x70, 0x03,
+    0x00, 0xd8, 0x21, 0x00, 0xec, 0x1d, 0x05, 0xf0, 0x0e, 0x00, 0xa8, 0x02, 0x0f, 0x04, 0x00, 0x21,
+    0x07, 0x1c, 0x02, 0x00, 0x80, 0x05, 0x0f, 0x08, 0x0f, 0x35, 0x00, 0x98, 0x10, 0x0b, 0x84, 0x07,
+    0x00, 0x50, 0x42, 0x31, 0x85, 0x90, 0xcd, 0xd4, 0x7a, 0x04, 0xac, 0x04, 0x0f, 0x08, 0x00, 0x4d,
+    0x0f, 0x84, 0x07, 0x0e, 0x00, 0x4c, 0x07, 0x00, 0x94, 0x05, 0x0f, 0x04, 0x02, 0x11, 0x01, 0x80,
+    0x02, 0x03, 0x40, 0x0b, 0x00, 0x38, 0x00, 0x00, 0x84, 0x07, 0x00, 0x8c, 0x16, 0x00, 0xfc, 0x68,
+    0x00, 0x7c, 0x26, 0x00, 0xe4, 0x09, 0x00, 0x94, 0x09, 0x00, 0xf0, 0x14, 0x00, 0x60, 0x06, 0x00,
+    0x20, 0x02, 0x0f, 0x48, 0x02, 0x09, 0x04, 0x1c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x98, 0x0b, 0x00, 0x0c, 0x06, 0x00, 0xe0, 0x11, 0x01, 0x98, 0x22, 0x00, 0xa0,
+    0x01, 0x00, 0x48, 0x02, 0x00, 0xdc, 0x01, 0x02, 0x08, 0x0f, 0x00, 0x58, 0x07, 0x00, 0x50, 0xc3,
+    0x00, 0xe8, 0x05, 0x00, 0x54, 0x5f, 0x00, 0xf0, 0x2c, 0x60, 0x77, 0x7f, 0xc8, 0xff, 0x3c, 0x3e,
+    0x84, 0x7f, 0x00, 0x30, 0x00, 0x00, 0x7c, 0x1a, 0x00, 0x34, 0x00, 0x02, 0x0c, 0x00, 0x31, 0x22,
+    0x20, 0xb6, 0x90, 0x6d, 0x00, 0xe4, 0x38, 0x00, 0x7c, 0x87, 0x00, 0x04, 0x00, 0x00, 0xe8, 0x29,
+    0x00, 0x4c, 0x1e, 0x20, 0x25, 0x27, 0x84, 0x07, 0x00, 0x28, 0x00, 0x03, 0xa8, 0x02, 0x00, 0x40,
+    0x18, 0x00, 0xe4, 0x03, 0x00, 0x0c, 0x05, 0x00, 0x34, 0x03, 0x00, 0x84, 0x06, 0x00, 0xec, 0x03,
+    0x04, 0xac, 0x00, 0x0c, 0x08, 0x00, 0x04, 0x0c, 0x03, 0x00, 0x24, 0x00, 0x00, 0x18, 0x04, 0x00,
+    0x3c, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00, 0x64,
+    0x03, 0x00, 0xe4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x7c, 0x04, 0x00, 0x68, 0x00, 0x00, 0xc8, 0x1c, 0x00, 0x44, 0x01, 0x00, 0x54, 0x0a, 0x00,
+    0x0c, 0x00, 0x00, 0x6c, 0x3a, 0x00, 0x08, 0x01, 0x00, 0x08, 0x08, 0x00, 0x3c, 0x00, 0x00, 0x34,
+    0x00, 0x0f, 0x04, 0x00, 0x35, 0x04, 0xb0, 0x00, 0x00, 0x9c, 0x01, 0x00, 0xe0, 0x00, 0x08, 0x14,
+    0x04, 0x00, 0xa0, 0x0c, 0x00, 0x14, 0x08, 0x00, 0x74, 0x00, 0x08, 0x84, 0x07, 0x00, 0x94, 0x08,
+    0x00, 0xec, 0x24, 0x00, 0xec, 0x0a, 0x01, 0xe0, 0x03, 0x02, 0xec, 0x6b, 0x00, 0x94, 0x6e, 0x00,
+    0x54, 0x01, 0x35, 0xb2, 0xc0, 0xe0, 0x7c, 0x07, 0x35, 0xd8, 0xe8, 0xf4, 0x6c, 0x55, 0x00, 0xbc,
+    0x14, 0x00, 0x18, 0x1c, 0x31, 0x5e, 0x65, 0xc1, 0x04, 0xc5, 0x02, 0xac, 0x25, 0x07, 0x6c, 0x01,
+    0x00, 0xbc, 0x12, 0x0f, 0x24, 0x22, 0x29, 0x00, 0x44, 0x01, 0x00, 0x18, 0x01, 0x04, 0x14, 0x04,
+    0x09, 0x84, 0x07, 0x11, 0xb2, 0x78, 0x60, 0x2a, 0x7e, 0x89, 0x00, 0x70, 0x0f, 0x70, 0x03, 0x29,
+    0x0f, 0x84, 0x07, 0x46, 0x00, 0xfc, 0x02, 0x00, 0x04, 0x00, 0x00, 0x78, 0x09, 0x00, 0x5c, 0x14,
+    0x00, 0x1c, 0x28, 0x0f, 0x84, 0x07, 0x02, 0x12, 0xb2, 0x14, 0x3c, 0x00, 0xc0, 0x05, 0x01, 0xf4,
+    0x42, 0x12, 0xec, 0x54, 0x82, 0x04, 0xb4, 0x10, 0x00, 0x0c, 0x01, 0x0f, 0x04, 0x00, 0x11, 0x00,
+    0x38, 0x01, 0x00, 0x34, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x84, 0x07, 0x00, 0xd0, 0x07, 0x00, 0x54,
+    0x00, 0x03, 0x10, 0x1e, 0x31, 0x0b, 0x03, 0xb5, 0xdc, 0x91, 0x00, 0x2c, 0xa1, 0x00, 0xc4, 0x70,
+    0x31, 0x8a, 0x94, 0xcf, 0x60, 0x5d, 0x51, 0x53, 0x57, 0xbd, 0xff, 0x17, 0xa4, 0x4e, 0x00, 0x58,
+    0x16, 0x00, 0x04, 0x00, 0x00, 0x68, 0x03, 0x00, 0x08, 0x00, 0xf1, 0x02, 0xb1, 0xff, 0x0c, 0x00,
+    0xb4, 0xff, 0x4d, 0x51, 0xbc, 0xff, 0x75, 0x7d, 0xc7, 0xff, 0x89, 0x93, 0xce, 0x54, 0xbd, 0x00,
+    0x48, 0x90, 0x00, 0xd8, 0x9f, 0x11, 0x13, 0x58, 0x00, 0x00, 0x90, 0x03, 0x12, 0xb5, 0x40, 0x69,
+    0x00, 0xbc, 0x1c, 0x00, 0xa0, 0x27, 0x00, 0xcc, 0x1c, 0x00, 0x00, 0x02, 0x00, 0x44, 0x06, 0x00,
+    0xfc, 0x03, 0x00, 0x9c, 0x02, 0x00, 0x9c, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x8c, 0x02, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x54, 0x03, 0x00, 0x5c, 0x03,
+    0x00, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x00, 0xc4, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x3c, 0x01, 0x00,
+    0x2c, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x48, 0x00, 0x0f, 0x04, 0x00, 0x3d, 0x01, 0x64, 0x00, 0x0f,
+    0x84, 0x07, 0x25, 0x12, 0xec, 0xbc, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0xcc, 0x10, 0x00, 0x70, 0x03,
+    0x00, 0xdc, 0x00, 0x00, 0xfc, 0x00, 0x04, 0xc8, 0x00, 0x0f, 0xb0, 0x00, 0x15, 0x00, 0x88, 0x00,
+    0x00, 0x34, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc8, 0x08, 0x00, 0xe0, 0x28, 0x00, 0x2c, 0x92, 0x0f,
+    0x84, 0x07, 0x49, 0x00, 0x68, 0x01, 0x00, 0x70, 0x00, 0x00, 0x70, 0x03, 0x00, 0xb0, 0x11, 0x00,
+    0x4c, 0x09, 0x05, 0x64, 0x0e, 0x00, 0x0c, 0x02, 0x00, 0xe4, 0x01, 0x04, 0x04, 0x00, 0x00, 0xb0,
+    0x05, 0x03, 0xb4, 0x9f, 0x01, 0x0c, 0x08, 0x03, 0x10, 0x00, 0x0f, 0x0c, 0x00, 0x02, 0x00, 0x14,
+    0x04, 0x03, 0xa0, 0x09, 0x0f, 0x84, 0x07, 0x50, 0x00, 0x48, 0x0b, 0x00, 0xd8, 0x6b, 0x0f, 0x0c,
+    0x04, 0x29, 0x0f, 0x3c, 0x00, 0x19, 0x0e, 0x84, 0x07, 0x00, 0x34, 0x03, 0x03, 0x58, 0xa5, 0x00,
+    0x04, 0x03, 0x00, 0x10, 0x22, 0x04, 0x04, 0x02, 0x00, 0xd8, 0x01, 0x00, 0x64, 0x01, 0x0f, 0x04,
+    0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x18, 0x03, 0x00, 0x48, 0x25, 0x00, 0x58, 0x03, 0x00, 0x04, 0x05, 0x00, 0x1c, 0x04,
+    0x00, 0xa4, 0x1a, 0x00, 0x88, 0x07, 0x00, 0x68, 0x0b, 0x00, 0x30, 0x00, 0x00, 0x5c, 0x03, 0x0f,
+    0x54, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x24, 0x00, 0x00, 0x50, 0x02, 0x04, 0x14, 0x04, 0x04,
+    0x84, 0x07, 0x00, 0x7c, 0x31, 0x01, 0x44, 0x10, 0x00, 0xd8, 0x01, 0x00, 0xc4, 0x01, 0x02, 0x10,
+    0x1e, 0x00, 0x64, 0xb1, 0x00, 0x6c, 0x43, 0x00, 0xa4, 0x2a, 0x00, 0x54, 0x16, 0xa0, 0x7c, 0x85,
+    0xca, 0xff, 0x59, 0x5f, 0xbf, 0xff, 0x22, 0x1d, 0x24, 0x00, 0x00, 0x0c, 0x02, 0x00, 0xe4, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x91, 0xb3, 0xff, 0x46, 0x49, 0xbb, 0xff,
+    0x70, 0x78, 0xc6, 0xd0, 0x1b, 0x00, 0x8c, 0x1f, 0x00, 0xec, 0x39, 0x00, 0x28, 0x0f, 0x00, 0xa4,
+    0xc9, 0x00, 0x24, 0x15, 0x01, 0x68, 0x55, 0x00, 0x38, 0x18, 0x00, 0x54, 0x19, 0x00, 0x3c, 0x09,
+    0x00, 0xd8, 0x0f, 0x00, 0x68, 0x02, 0x00, 0xec, 0x03, 0x00, 0x08, 0x04, 0x04, 0xa8, 0x00, 0x00,
+    0x08, 0x00, 0x08, 0x04, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x9c, 0x02, 0x00, 0xbc, 0x00, 0x00, 0x2c,
+    0x00, 0x00, 0x64, 0x03, 0x00, 0x28, 0x04, 0x00, 0x18, 0x01, 0x00, 0x38, 0x04, 0x00, 0x64, 0x03,
+    0x00, 0x40, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x84, 0x07, 0x00, 0xbc, 0x27, 0x00, 0xa0, 0x2f, 0x00, 0x38, 0x00, 0x00, 0x60,
+    0x19, 0x00, 0xe4, 0x2b, 0x00, 0x10, 0x07, 0x00, 0xf0, 0x02, 0x00, 0x6c, 0x04, 0x00, 0x30, 0x00,
+    0x00, 0x3c, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x48, 0x00,
+    0x00, 0xfc, 0x04, 0x00, 0x84, 0x07, 0x00, 0x7c, 0xdf, 0x00, 0xf4, 0x08, 0x00, 0x44, 0x37, 0x00,
+    0x74, 0x00, 0x00, 0xb0, 0x00, 0x0c, 0x84, 0x07, 0x00, 0x60, 0x28, 0x00, 0xa0, 0x00, 0x03, 0x84,
+    0x07, 0x00, 0x64, 0x3d, 0x00, 0x40, 0x01, 0x00, 0xfc, 0x53, 0x00, 0xf8, 0x17, 0x00, 0xa8, 0xe0,
+    0x0f, 0x98, 0x02, 0x01, 0x00, 0xf8, 0x17, 0x00, 0xc8, 0x4c, 0x00, 0x94, 0x14, 0x00, 0x70, 0x42,
+    0x01, 0x50, 0x15, 0x00, 0x38, 0x0b, 0x0f, 0x08, 0x0f, 0x4e, 0x02, 0x84, 0x07, 0x00, 0x50, 0x5c,
+    0x00, 0x04, 0x56, 0x0f, 0x9c, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x1d, 0x0f, 0x84, 0x07, 0x46, 0x00,
+    0x94, 0x01, 0x00, 0x04, 0x00, 0x08, 0x10, 0x02, 0x0c, 0x84, 0x07, 0x00, 0x60, 0xa0, 0x00, 0x10,
+    0x03, 0x00, 0x90, 0x25, 0x00, 0x0c, 0x2d, 0x00, 0xf4, 0x48, 0x00, 0xc8, 0x18, 0x00, 0x64, 0x03,
+    0x00, 0x80, 0x02, 0x00, 0x40, 0x00, 0x00, 0xd4, 0x01, 0x0f, 0x04, 0x00, 0x15, 0x00, 0xe0, 0x11,
+    0x00, 0x70, 0x00, 0x00, 0x34, 0x0b, 0x00, 0x4c, 0x0b, 0x00, 0xa0, 0x39, 0x03, 0x78, 0x12, 0x31,
+    0x04, 0x00, 0xb5, 0x14, 0x2d, 0x00, 0x50, 0x25, 0xf2, 0x04, 0x4c, 0x53, 0xbd, 0xff, 0x50, 0x58,
+    0xbe, 0xff, 0x46, 0x50, 0xbd, 0xff, 0x30, 0x3e, 0xbb, 0xff, 0x11, 0x2b, 0xb9, 0xa8, 0x76, 0x00,
+    0x04, 0x00, 0x00, 0xb4, 0x53, 0x00, 0x08, 0x00, 0xd2, 0x22, 0xb8, 0xff, 0x0e, 0x2a, 0xb9, 0xff,
+    0x2d, 0x3c, 0xbb, 0xff, 0x44, 0x4e, 0x30, 0x00, 0x31, 0x4e, 0x54, 0xbd, 0x3c, 0xa1, 0x00, 0x5c,
+    0x98, 0x10, 0x07, 0xb8, 0x00, 0x04, 0x7c, 0x05, 0x00, 0x60, 0x60, 0x00, 0x28, 0x06, 0x00, 0xb8,
+    0x14, 0x00, 0x28, 0x03, 0x00, 0x84, 0x0f, 0x00, 0x84, 0x00, 0x00, 0x80, 0x08, 0x00, 0xc4, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x8c, 0x02, 0x00,
+    0x44, 0x03, 0x00, 0x4c, 0x03, 0x00, 0x1c, 0x03, 0x00, 0x34, 0x00, 0x00, 0x64, 0x03, 0x00, 0x6c,
+    0x03, 0x00, 0xfc, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x94, 0x04, 0x00, 0x2c, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x38, 0x03, 0x00, 0x20, 0x00, 0x0f,
+    0x04, 0x00, 0x39, 0x00, 0x94, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x9c, 0x0b, 0x0f, 0x10, 0x1e, 0x11,
+    0x00, 0x2c, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x20, 0x04, 0x08, 0xf4, 0x0a, 0x00, 0x70, 0x0b, 0x00,
+    0x6c, 0x09, 0x00, 0x84, 0x0b, 0x00, 0x94, 0x28, 0x0f, 0xac, 0x00, 0x1d, 0x04, 0x58, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0xc8, 0x03, 0x0f, 0x08, 0x0f, 0x61, 0x00, 0xf0, 0x05, 0x01, 0x78, 0x12, 0x00,
+    0xa0, 0x05, 0x03, 0x48, 0x07, 0x04, 0xe8, 0x01, 0x0f, 0x08, 0x00, 0x1a, 0x03, 0x3c, 0x00, 0x00,
+    0xf0, 0x46, 0x0f, 0x84, 0x07, 0x4c, 0x00, 0x88, 0x64, 0x0f, 0x08, 0x0f, 0x73, 0x12, 0xb5, 0xd8,
+    0xd2, 0x00, 0x08, 0x1c, 0x00, 0x74, 0x05, 0x00, 0x50, 0x02, 0x00, 0xcc, 0x01, 0x0f, 0xac, 0x02,
+    0x0d, 0x01, 0x80, 0x02, 0x04, 0x08, 0x0f, 0x02, 0x14, 0xa9, 0x01, 0xc4, 0xe0, 0x00, 0x88, 0x03,
+    0x00, 0x0c, 0x20, 0x00, 0x44, 0x01, 0x00, 0xe8, 0x18, 0x00, 0xa0, 0x8a, 0x00, 0x60, 0x0b, 0x00,
+    0x0c, 0x03, 0x04, 0x34, 0x00, 0x0f, 0x5c, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0xa4, 0x1c, 0x00, 0xc4, 0x30, 0x00, 0xe0, 0xea, 0x00, 0x6c, 0x2f, 0x00, 0x80,
+    0x04, 0x07, 0xf4, 0x36, 0x00, 0x40, 0x48, 0x00, 0x5c, 0xe7, 0x00, 0x04, 0x06, 0x00, 0x40, 0x40,
+    0xe3, 0x48, 0x52, 0xbd, 0xff, 0x34, 0x41, 0xbb, 0xff, 0x16, 0x2e, 0xb9, 0xff, 0x00, 0x23, 0x24,
+    0x04, 0x00, 0x20, 0x04, 0x03, 0x0c, 0x00, 0xf1, 0x04, 0x08, 0x28, 0xb9, 0xff, 0x29, 0x39, 0xba,
+    0xff, 0x41, 0x4c, 0xbd, 0xff, 0x4f, 0x57, 0xbe, 0xff, 0x4f, 0x56, 0xbe, 0x90, 0x25, 0x00, 0xb0,
+    0x5b, 0x11, 0x0b, 0x88, 0xd2, 0x00, 0xbc, 0x07, 0x12, 0xb5, 0xf0, 0x22, 0x00, 0x50, 0x19, 0x00,
+    0x20, 0x06, 0x00, 0x5c, 0x19, 0x00, 0x88, 0x07, 0x00, 0x74, 0x1b, 0x00, 0x20, 0x01, 0x00, 0xf4,
+    0x02, 0x00, 0xa8, 0x00, 0x0c, 0xc8, 0x00, 0x00, 0x18, 0x00, 0x04, 0x64, 0x03, 0x00, 0x18, 0x04,
+    0x00, 0x20, 0x04, 0x00, 0x28, 0x04, 0x00, 0x30, 0x04, 0x00, 0x38, 0x04, 0x00, 0x40, 0x04, 0x00,
+    0x18, 0x04, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x04, 0x05, 0x00, 0xf8, 0x0c, 0x00, 0x58, 0x19, 0x00, 0x84, 0x07, 0x00, 0xbc, 0x36,
+    0x00, 0x4c, 0x01, 0x00, 0x10, 0x3d, 0x00, 0x58, 0x10, 0x00, 0x4c, 0x11, 0x00, 0xe4, 0x0a, 0x00,
+    0xc0, 0x03, 0x00, 0x30, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x40, 0x00, 0x0f, 0x04, 0x00, 0x29, 0x00,
+    0x44, 0x00, 0x00, 0xb0, 0x00, 0x00, 0xf0, 0x01, 0x08, 0x14, 0x04, 0x00, 0x08, 0x0d, 0x00, 0x98,
+    0x0b, 0x00, 0x10, 0x02, 0x00, 0xb0, 0x00, 0x08, 0x84, 0x07, 0x00, 0x1c, 0x12, 0x00, 0x20, 0x15,
+    0x00, 0x98, 0x00, 0x00, 0x14, 0x33, 0x61, 0x00, 0xb5, 0xff, 0x0f, 0x15, 0xb6, 0x70, 0x55, 0x31,
+    0x3a, 0x3e, 0xba, 0x9c, 0x50, 0x00, 0x80, 0x23, 0x00, 0x84, 0x14, 0x0f, 0xd8, 0x06, 0x01, 0x71,
+    0xa3, 0xaf, 0xd9, 0xff, 0x73, 0x7c, 0xc7, 0x84, 0x96, 0x02, 0x14, 0x36, 0x11, 0xb3, 0x38, 0x3c,
+    0x0f, 0x2c, 0x31, 0x2e, 0x00, 0x14, 0x01, 0x00, 0x0c, 0x01, 0x00, 0xa8, 0x08, 0x00, 0xcc, 0x1e,
+    0x05, 0x14, 0x04, 0x00, 0xd4, 0x03, 0x02, 0x84, 0x07, 0x00, 0xfc, 0x19, 0x00, 0x2c, 0x11, 0x0f,
+    0x98, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x1d, 0x0f, 0x84, 0x07, 0x5a, 0x00, 0x4c, 0x03, 0x00, 0xac,
+    0x08, 0x01, 0x84, 0x0a, 0x12, 0xb5, 0xd0, 0x02, 0x00, 0x30, 0x2d, 0x00, 0x18, 0x03, 0x00, 0x30,
+    0x02, 0x00, 0x20, 0x0a, 0x0f, 0x1c, 0x02, 0x21, 0x00, 0xf8, 0x01, 0x00, 0xf0, 0x06, 0x00, 0x64,
+    0x11, 0x00, 0x48, 0x0b, 0x00, 0x64, 0x02, 0x00, 0x68, 0x18, 0x00, 0x48, 0x23, 0x01, 0xc4, 0x1b,
+    0x00, 0x3c, 0x01, 0x00, 0x80, 0x3c, 0xf2, 0x06, 0xb4, 0xff, 0x04, 0x00, 0xb4, 0xff, 0x06, 0x00,
+    0xb4, 0xff, 0x07, 0x1d, 0xb7, 0xff, 0x05, 0x38, 0xbc, 0xff, 0x03, 0x4c, 0xc2, 0xc8, 0x6c, 0x00,
+    0x78, 0x23, 0x00, 0x04, 0x00, 0x00, 0xdc, 0x48, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0xf1, 0x03,
+    0x58, 0xc7, 0xff, 0x02, 0x4d, 0xc3, 0xff, 0x05, 0x3b, 0xbd, 0xff, 0x07, 0x20, 0xb8, 0xff, 0x07,
+    0x01, 0xb5, 0x40, 0x00, 0x02, 0x94, 0x27, 0x03, 0x60, 0x03, 0x05, 0x98, 0x05, 0x12, 0xb3, 0x68,
+    0x4c, 0x00, 0xc0, 0x45, 0x00, 0xf8, 0x09, 0x00, 0x64, 0x03, 0x00, 0x38, 0x13, 0x00, 0xd0, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x08, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x8c, 0x02, 0x00,
+    0x44, 0x03, 0x00, 0xb8, 0x15, 0x00, 0xa4, 0x02, 0x00, 0x30, 0x0a, 0x00, 0x64, 0x03, 0x00, 0x6c,
+    0x03, 0x00, 0x34, 0x00, 0x00, 0xc0, 0x06, 0x00, 0xc8, 0x02, 0x00, 0xcc, 0x00, 0x22, 0x97, 0xe9,
+    0x60, 0x19, 0x00, 0x44, 0x04, 0x00, 0x04, 0x0c, 0x00, 0x20, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x4c,
+    0x00, 0x00, 0xf8, 0x02, 0x00, 0x58, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x04, 0x4c, 0x00, 0x00, 0x14,
+    0x04, 0x0f, 0x84, 0x07, 0x21, 0x00, 0x3c, 0x09, 0x00, 0x20, 0x04, 0x00, 0xec, 0x0b, 0x00, 0x4c,
+    0x79, 0x00, 0xc0, 0x0e, 0x00, 0x84, 0x08, 0x00, 0x8c, 0x29, 0x04, 0xb0, 0x00, 0x0f, 0xa4, 0x00,
+    0x11, 0x00, 0xd0, 0x00, 0x00, 0x20, 0x01, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb4, 0x0b,
+    0x00, 0x60, 0x0f, 0x01, 0x0c, 0x25, 0x02, 0xc4, 0x01, 0x01, 0x58, 0x0c, 0x01, 0x44, 0x02, 0x03,
+    0xe4, 0x13, 0x0f, 0x78, 0x12, 0x2d, 0x00, 0x70, 0x00, 0x00, 0x9c, 0x00, 0x04, 0x70, 0x03, 0x00,
+    0x8c, 0x16, 0x00, 0x00, 0x1e, 0x01, 0x64, 0x00, 0x00, 0x74, 0x00, 0x0c, 0xe8, 0x01, 0x04, 0x10,
+    0x00, 0x00, 0xa4, 0x07, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x12, 0xb4, 0x04, 0x21, 0x00,
+    0x84, 0x07, 0x00, 0x98, 0x08, 0x00, 0x1c, 0x05, 0x00, 0x6c, 0x01, 0x04, 0x74, 0x00, 0x00, 0x78,
+    0x00, 0x0f, 0x04, 0x00, 0x11, 0x04, 0x30, 0x00, 0x00, 0x50, 0x01, 0x00, 0xdc, 0x02, 0x00, 0x50,
+    0x0d, 0x05, 0xac, 0x0f, 0x03, 0x84, 0x07, 0x1f, 0x8f, 0x8c, 0x16, 0x5f, 0x00, 0x14, 0x14, 0x00,
+    0x28, 0x59, 0x20, 0x14, 0x13, 0x14, 0x01, 0x00, 0x1c, 0x0e, 0x12, 0xb5, 0xb0, 0x8d, 0x00, 0x94,
+    0x01, 0x00, 0xac, 0x53, 0x00, 0xb8, 0x02, 0x00, 0x2c, 0x41, 0x00, 0x9c, 0x03, 0x00, 0xd4, 0x01,
+    0x0f, 0xec, 0x00, 0x05, 0x00, 0x14, 0x01, 0x00, 0x04, 0x00, 0x00, 0x2c, 0x07, 0x00, 0xf4, 0x02,
+    0x00, 0x68, 0x3a, 0x00, 0x40, 0x0d, 0x01, 0xbc, 0x81, 0x12, 0xb1, 0x98, 0xac, 0x00, 0x10, 0x0f,
+    0x00, 0x58, 0x0b, 0x00, 0xac, 0x16, 0x00, 0x28, 0x00, 0x00, 0x14, 0x01, 0x00, 0x34, 0x00, 0x0f,
+    0x54, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x50, 0x02, 0x00, 0x24, 0x00, 0x00, 0xbc, 0x0a, 0x00,
+    0xd4, 0x09, 0x00, 0x8c, 0x15, 0x00, 0x94, 0x15, 0x00, 0x70, 0x5c, 0x00, 0x78, 0x04, 0x00, 0x24,
+    0x2d, 0x00, 0x94, 0x31, 0x03, 0xc4, 0x03, 0x00, 0x18, 0xd7, 0x02, 0x20, 0x04, 0xd2, 0xb5, 0xff,
+    0x07, 0x19, 0xb7, 0xff, 0x06, 0x35, 0xbc, 0xff, 0x03, 0x49, 0xc2, 0xf0, 0xe6, 0x04, 0x18, 0x04,
+    0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x04, 0x20, 0x04, 0xf3, 0x03, 0x4f, 0xc4, 0xff, 0x05, 0x3e,
+    0xbe, 0xff, 0x07, 0x24, 0xb8, 0xff, 0x07, 0x05, 0xb5, 0xff, 0x05, 0x00, 0xb4, 0xb4, 0x2b, 0x00,
+    0x14, 0x01, 0x08, 0x04, 0x00, 0x00, 0x2c, 0x02, 0x12, 0xb5, 0x10, 0x02, 0x00, 0x9c, 0x04, 0x00,
+    0x0c, 0x1d, 0x00, 0x70, 0x03, 0x00, 0xa0, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xb0, 0x00, 0x08, 0x04,
+    0x00, 0x00, 0xbc, 0x00, 0x00, 0x18, 0x00, 0x00, 0x28, 0x07, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04,
+    0x00, 0x64, 0x03, 0x0f, 0x84, 0x07, 0x19, 0x00, 0x10, 0x0b, 0x01, 0xf8, 0x0c, 0x00, 0x7c, 0x00,
+    0x12, 0xb2, 0x98, 0x99, 0x00, 0x50, 0x03, 0x00, 0x34, 0x1b, 0x00, 0x60, 0x03, 0x00, 0x94, 0x01,
+    0x00, 0x64, 0x00, 0x00, 0x84, 0x00, 0x08, 0x7c, 0x00, 0x0f, 0x0c, 0x00, 0x21, 0x08, 0xb0, 0x00,
+    0x00, 0x5c, 0x00, 0x00, 0x08, 0x0f, 0x01, 0xb0, 0x00, 0x0b, 0x84, 0x07, 0x00, 0x2c, 0x0f, 0x00,
+    0x74, 0x00, 0x00, 0x18, 0x04, 0x00, 0x20, 0x02, 0x00, 0x3c, 0x04, 0x00, 0x7c, 0x12, 0x00, 0xf0,
+    0x01, 0x00, 0xdc, 0x37, 0x10, 0x1e, 0xc4, 0x17, 0x00, 0xb0, 0x00, 0x11, 0xb3, 0x68, 0xae, 0x00,
+    0x60, 0xdc, 0x04, 0x1c, 0x1e, 0x0c, 0xdc, 0x06, 0x00, 0x88, 0xc1, 0x00, 0x94, 0x16, 0x00, 0xa0,
+    0x1d, 0x0f, 0x84, 0x07, 0x3a, 0x00, 0xa0, 0x00, 0x00, 0x14, 0x01, 0x00, 0x24, 0x22, 0x00, 0xdc,
+    0x25, 0x0b, 0x84, 0x07, 0x00, 0xfc, 0x86, 0x0f, 0x84, 0x07, 0x9e, 0x00, 0xf0, 0x08, 0x00, 0x88,
+    0x04, 0x00, 0x28, 0x0e, 0x01, 0x74, 0x10, 0x00, 0xc8, 0x11, 0x03, 0xa8, 0x13, 0x00, 0x28, 0x19,
+    0x00, 0x74, 0x03, 0x00, 0x70, 0x08, 0x00, 0x68, 0x06, 0x00, 0x98, 0x02, 0x00, 0x1c, 0x02, 0x00,
+    0xd4, 0x01, 0x0f, 0x0c, 0x02, 0x0d, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0x64, 0x03, 0x00,
+    0xa0, 0x06, 0x00, 0xe8, 0x04, 0x00, 0xd4, 0x01, 0x00, 0xe4, 0x02, 0x00, 0xd0, 0x21, 0x00, 0xd0,
+    0x0c, 0x10, 0x07, 0xd0, 0xb7, 0x00, 0x10, 0x05, 0x04, 0x04, 0x00, 0x00, 0x2c, 0x04, 0x56, 0xb2,
+    0xff, 0x00, 0x14, 0xb8, 0x80, 0x8e, 0x00, 0xe0, 0x73, 0x00, 0x10, 0xda, 0x00, 0x78, 0x1a, 0x26,
+    0x84, 0xdc, 0x0c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x1c, 0x08, 0x5c, 0x51, 0xc5, 0xff, 0x00, 0x1e,
+    0x14, 0x1a, 0x11, 0xb5, 0xc0, 0x12, 0x06, 0x14, 0x06, 0x00, 0x60, 0x00, 0x12, 0xb4, 0x84, 0x23,
+    0x00, 0x34, 0x00, 0x00, 0x84, 0x07, 0x00, 0x6c, 0x07, 0x00, 0xd0, 0x01, 0x00, 0x04, 0x00, 0x00,
+    0xcc, 0x00, 0x00, 0x08, 0x00, 0x00, 0x84, 0x02, 0x00, 0x44, 0x04, 0x00, 0xa4, 0x06, 0x00, 0x84,
+    0x07, 0x00, 0xc0, 0x15, 0x00, 0x18, 0x03, 0x00, 0x64, 0x03, 0x00, 0x4c, 0x30, 0x01, 0x48, 0x08,
+    0x12, 0xe9, 0xa4, 0x4c, 0x00, 0x3c, 0x13, 0x00, 0x84, 0xab, 0x00, 0x78, 0x56, 0x00, 0x04, 0x0c,
+    0x00, 0xb8, 0x03, 0x00, 0x88, 0x9c, 0x00, 0x98, 0x03, 0x00, 0x4c, 0x00, 0x00, 0x28, 0x02, 0x00,
+    0x58, 0x00, 0x0f, 0x04, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x00, 0x48, 0x01, 0x00, 0x7c, 0x01, 0x0f,
+    0x84, 0x07, 0x21, 0x00, 0xd4, 0x03, 0x00, 0x70, 0x03, 0x00, 0xd4, 0x6b, 0x00, 0xf4, 0x22, 0x00,
+    0xb4, 0x02, 0x00, 0x74, 0x0c, 0x00, 0xb0, 0x00, 0x00, 0x54, 0x09, 0x00, 0xf0, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0x04, 0x00, 0x0f, 0xac, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xc8, 0x03, 0x00, 0x58, 0x00, 0x00, 0xa0, 0x09, 0x01, 0x24, 0x0b, 0x00, 0xb8, 0x01,
+    0x00, 0x9c, 0x03, 0x00, 0xd8, 0x04, 0x00, 0x08, 0x00, 0x0f, 0x84, 0x07, 0x40, 0x00, 0x04, 0x0a,
+    0x00, 0x10, 0x04, 0x01, 0xe0, 0x06, 0x00, 0xd0, 0x01, 0x00, 0x04, 0x00, 0x00, 0x70, 0x00, 0x0c,
+    0x80, 0x16, 0x03, 0x80, 0x00, 0x01, 0xcc, 0x02, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00,
+    0xb0, 0x00, 0x12, 0xb3, 0x6c, 0xfa, 0x00, 0xfc, 0x02, 0x00, 0x9c, 0x02, 0x00, 0x78, 0x04, 0x00,
+    0xe0, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x08, 0x01, 0x09, 0x0c, 0x1c, 0x00, 0x04, 0x30, 0x00, 0x0f,
+    0x84, 0x07, 0x78, 0x31, 0xc4, 0xd4, 0xe9, 0x50, 0x21, 0x00, 0x0c, 0x14, 0x02, 0x68, 0x56, 0x00,
+    0xf0, 0x00, 0x12, 0xb5, 0x40, 0x71, 0x00, 0xcc, 0x1d, 0x00, 0x64, 0x14, 0x00, 0xd4, 0x02, 0x00,
+    0xfc, 0x03, 0x00, 0xb4, 0x02, 0x0f, 0x04, 0x02, 0x09, 0x00, 0x80, 0x02, 0x00, 0xe4, 0x00, 0x00,
+    0x24, 0x00, 0x01, 0x84, 0x07, 0x12, 0xd6, 0xfc, 0x8d, 0x01, 0x08, 0x09, 0x11, 0xb0, 0xe4, 0x47,
+    0x01, 0xe0, 0x09, 0x00, 0x64, 0x24, 0x05, 0x84, 0x07, 0x03, 0x58, 0xe8, 0x0c, 0x2c, 0x01, 0x0c,
+    0x10, 0x00, 0x00, 0x54, 0x02, 0x00, 0x50, 0x02, 0x00, 0xd8, 0x0a, 0x00, 0x0c, 0x1d, 0x00, 0xe4,
+    0x01, 0x00, 0xcc, 0x07, 0x00, 0x78, 0x04, 0x00, 0xa0, 0x06, 0x14, 0x15, 0x28, 0x4b, 0x03, 0xe8,
+    0x01, 0x01, 0xd4, 0x01, 0x00, 0x60, 0xd6, 0x52, 0xb7, 0xff, 0x00, 0x47, 0xc2, 0xb0, 0x1c, 0x00,
+    0xcc, 0x02, 0x21, 0x84, 0xdd, 0x18, 0x04, 0x01, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2c, 0x04,
+    0x00, 0xa0, 0x02, 0x00, 0x94, 0x0e, 0x00, 0xc4, 0x13, 0x10, 0x28, 0x84, 0x6e, 0x00, 0x08, 0x02,
+    0x00, 0x08, 0x01, 0x00, 0x20, 0x02, 0x02, 0x20, 0x04, 0x06, 0x60, 0xc9, 0x00, 0x1c, 0x00, 0x03,
+    0x84, 0xe4, 0x00, 0x1c, 0x01, 0x00, 0x1c, 0x03, 0x00, 0x94, 0x09, 0x00, 0xf8, 0x00, 0x00, 0x04,
+    0x00, 0x0f, 0xb8, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0xec, 0x03, 0x0f, 0x84, 0x07, 0x22, 0x03,
+    0x64, 0x0e, 0x00, 0x94, 0x03, 0x01, 0xf4, 0x0c, 0x12, 0xb0, 0x90, 0x0c, 0x00, 0x88, 0x0f, 0x00,
+    0xb8, 0x00, 0x00, 0x94, 0x08, 0x00, 0x38, 0x14, 0x00, 0x90, 0x04, 0x00, 0x80, 0x01, 0x0c, 0x80,
+    0x00, 0x0f, 0x10, 0x00, 0x1d, 0x00, 0x68, 0x01, 0x04, 0xb0, 0x00, 0x00, 0xbc, 0x03, 0x0f, 0x84,
+    0x07, 0x06, 0x07, 0xc0, 0x32, 0x00, 0xb4, 0x05, 0x00, 0x20, 0x0f, 0x00, 0x70, 0x05, 0x00, 0xd4,
+    0x79, 0x00, 0x1c, 0x09, 0x00, 0xf8, 0xad, 0x01, 0xf8, 0x01, 0x11, 0xb1, 0xe8, 0x1d, 0x35, 0x6b,
+    0x74, 0xc5, 0x68, 0x6f, 0x0c, 0x84, 0x07, 0x40, 0xb1, 0xbf, 0xe0, 0xee, 0xf4, 0x67, 0x02, 0x60,
+    0x4a, 0x00, 0x78, 0x01, 0x0f, 0x08, 0x0f, 0x34, 0x04, 0x14, 0x01, 0x00, 0x34, 0x02, 0x00, 0x84,
+    0x07, 0x00, 0x3c, 0x10, 0x00, 0x20, 0x08, 0x03, 0x1c, 0x02, 0x0f, 0x84, 0x07, 0xa2, 0x00, 0x18,
+    0x11, 0x00, 0x1c, 0x0e, 0x00, 0xa8, 0x46, 0x00, 0xb8, 0x40, 0x00, 0x78, 0x0a, 0x00, 0x80, 0x16,
+    0x00, 0x30, 0x85, 0x00, 0xfc, 0x19, 0x00, 0x20, 0x00, 0x00, 0x90, 0x01, 0x00, 0xa4, 0x04, 0x00,
+    0x50, 0x07, 0x0f, 0x00, 0x02, 0x15, 0x00, 0x3c, 0x02, 0x00, 0x04, 0x00, 0x00, 0xec, 0x06, 0x00,
+    0xdc, 0x3f, 0x00, 0x5c, 0x02, 0x00, 0x50, 0xcd, 0x00, 0x00, 0x0f, 0x00, 0x60, 0x00, 0x00, 0xc8,
+    0x12, 0x00, 0x0c, 0x7e, 0x00, 0x1c, 0x2d, 0x00, 0x7c, 0x2d, 0x00, 0x94, 0x11, 0x00, 0x0c, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x0c, 0x35, 0x00, 0x0c, 0x03, 0x00, 0x58, 0x0c, 0x00, 0x9c, 0x03, 0x00,
+    0x2c, 0x06, 0x00, 0x04, 0x00, 0x00, 0xe8, 0x2b, 0x00, 0x08, 0x00, 0x00, 0x38, 0x04, 0x00, 0x14,
+    0x07, 0x00, 0xb4, 0x03, 0x00, 0x3c, 0x0b, 0x00, 0xb0, 0x9d, 0x00, 0x38, 0x00, 0x00, 0xbc, 0x00,
+    0x00, 0x04, 0x00, 0x07, 0xc4, 0x12, 0x02, 0x88, 0x07, 0x00, 0x64, 0x03, 0x07, 0x6c, 0x8d, 0x00,
+    0xbc, 0x1a, 0x00, 0xc4, 0x01, 0x0f, 0xcc, 0x00, 0x01, 0x00, 0x7c, 0x03, 0x00, 0x7c, 0x02, 0x00,
+    0xa8, 0x29, 0x00, 0x14, 0x03, 0x00, 0x7c, 0x3a, 0x00, 0x78, 0x15, 0x00, 0x88, 0x17, 0x00, 0x1c,
+    0x03, 0x00, 0x74, 0x00, 0x00, 0xbc, 0x19, 0x00, 0xcc, 0x04, 0x00, 0xcc, 0x00, 0x00, 0x58, 0x21,
+    0x00, 0x24, 0x00, 0x00, 0xe4, 0x16, 0x00, 0xf0, 0x24, 0x00, 0x2c, 0x07, 0x00, 0x40, 0x03, 0x0f,
+    0x5c, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x21, 0x00, 0x44, 0x01, 0x00, 0x44, 0x03, 0x00, 0x58, 0x00,
+    0x0f, 0x84, 0x07, 0x25, 0x00, 0x88, 0x04, 0x00, 0x74, 0x01, 0x00, 0x6c, 0x0b, 0x00, 0xf0, 0x10,
+    0x00, 0xd8, 0xaf, 0x00, 0x94, 0x1f, 0x00, 0x6c, 0x08, 0x00, 0xd8, 0x01, 0x01, 0x64, 0x00, 0x0f,
+    0x34, 0x3d, 0x00, 0x08, 0xb0, 0x00, 0x00, 0x84, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x34, 0x05, 0x00,
+    0x08, 0x01, 0x00, 0x9c, 0x97, 0x00, 0xd8, 0x29, 0x01, 0x18, 0x30, 0x03, 0x24, 0x05, 0x01, 0x78,
+    0x01, 0x00, 0xe4, 0x04, 0x0f, 0x84, 0x07, 0x34, 0x00, 0x98, 0x00, 0x00, 0x84, 0x00, 0x00, 0x08,
+    0x0f, 0x00, 0x70, 0x03, 0x00, 0xc0, 0x2f, 0x00, 0xb8, 0x04, 0x00, 0x38, 0x02, 0x00, 0xe8, 0x01,
+    0x00, 0xb0, 0x14, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0xb8, 0x00, 0xfc, 0xca, 0x00,
+    0xe0, 0x18, 0x00, 0x0c, 0x02, 0x00, 0x6c, 0x58, 0x0f, 0x04, 0x00, 0x01, 0x00, 0xa0, 0x43, 0x00,
+    0x74, 0x46, 0x00, 0x80, 0x02, 0x00, 0xc0, 0x01, 0x00, 0x40, 0x02, 0x00, 0x74, 0x05, 0x00, 0x58,
+    0x0b, 0x00, 0xdc, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x14, 0x01, 0x00, 0x30,
+    0x00, 0x0f, 0x84, 0x07, 0x78, 0x00, 0x58, 0x99, 0x00, 0x60, 0x3f, 0x00, 0x2c, 0x9e, 0x00, 0x1c,
+    0x44, 0x01, 0xfc, 0x1c, 0x40, 0x02, 0xb5, 0xff, 0x02, 0xf4, 0x00, 0x00, 0x38, 0x41, 0x00, 0x10,
+    0x12, 0x00, 0x14, 0x2b, 0x22, 0x7e, 0xda, 0x38, 0x07, 0x00, 0xa4, 0x03, 0x00, 0x6c, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0xcc, 0x00, 0x08, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x84,
+    0x07, 0x00, 0x8c, 0x03, 0x00, 0x38, 0x02, 0x00, 0x44, 0x0b, 0x00, 0x4c, 0x02, 0x00, 0xf8, 0x04,
+    0x00, 0x8c, 0x01, 0x00, 0x04, 0x03, 0x00, 0xe4, 0x16, 0x00, 0x00, 0x03, 0x00, 0x40, 0x03, 0x08,
+    0x40, 0x00, 0x0f, 0x0c, 0x00, 0x0d, 0x00, 0x2c, 0x03, 0x00, 0x58, 0x04, 0x00, 0x38, 0x00, 0x00,
+    0xdc, 0x03, 0x00, 0x9c, 0x03, 0x00, 0x4c, 0x00, 0x00, 0x3c, 0x19, 0x00, 0xac, 0x01, 0x01, 0xf4,
+    0x05, 0x12, 0xb4, 0xe0, 0x01, 0x00, 0xe8, 0x01, 0x00, 0x24, 0x04, 0x00, 0xc0, 0x10, 0x00, 0x90,
+    0x09, 0x00, 0x6c, 0x07, 0x00, 0xc0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xa4, 0x04, 0x05, 0x20, 0x04,
+    0x12, 0xef, 0x1c, 0x07, 0x00, 0x30, 0x03, 0x00, 0xe8, 0x0d, 0x22, 0x4b, 0xc3, 0x68, 0x0e, 0x00,
+    0x40, 0x00, 0x00, 0x04, 0x00, 0x01, 0xa8, 0x02, 0x03, 0xb4, 0x02, 0x00, 0x10, 0x00, 0x00, 0xc8,
+    0x00, 0x00, 0x68, 0x00, 0x00, 0x80, 0x24, 0x00, 0x28, 0x10, 0x00, 0x6c, 0x02, 0x00, 0x70, 0x0b,
+    0x0f, 0x10, 0x02, 0x05, 0x04, 0x0c, 0x03, 0x0f, 0x84, 0x07, 0x25, 0x00, 0x04, 0x0c, 0x00, 0xe4,
+    0x0b, 0x00, 0xbc, 0x08, 0x00, 0x8c, 0x02, 0x00, 0x80, 0x00, 0x00, 0x50, 0x12, 0x00, 0xe8, 0x06,
+    0x00, 0x1c, 0x09, 0x00, 0xf0, 0x0c, 0x00, 0x94, 0x01, 0x0f, 0x3c, 0x01, 0x0d, 0x0f, 0x20, 0x00,
+    0x15, 0x08, 0xb0, 0x00, 0x0f, 0x84, 0x07, 0x11, 0x00, 0xf8, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x24,
+    0x05, 0x00, 0x68, 0x05, 0x00, 0x88, 0x05, 0x00, 0xd8, 0x3b, 0x00, 0x7c, 0x03, 0x00, 0x28, 0x01,
+    0x21, 0x00, 0xb2, 0x5c, 0x2e, 0x00, 0xd8, 0x67, 0x00, 0x1c, 0x72, 0x0c, 0x80, 0x07, 0x00, 0x10,
+    0x00, 0x00, 0x08, 0x30, 0x00, 0x4c, 0x36, 0x00, 0x40, 0x18, 0x0f, 0x08, 0x0f, 0x3a, 0x00, 0xcc,
+    0x00, 0x00, 0xa0, 0x00, 0x00, 0x70, 0x03, 0x00, 0x3c, 0x11, 0x00, 0x08, 0x02, 0x01, 0xa8, 0x29,
+    0x00, 0xe4, 0x05, 0x11, 0xb2, 0x04, 0xdc, 0x0f, 0x08, 0x0f, 0x9a, 0x00, 0x88, 0x12, 0x00, 0x74,
+    0x10, 0x00, 0x18, 0x09, 0x00, 0xb4, 0x24, 0x00, 0xc8, 0x4c, 0x00, 0xfc, 0x02, 0x00, 0x38, 0x0d,
+    0x00, 0x30, 0x0e, 0x00, 0x70, 0x06, 0x00, 0xf0, 0x06, 0x00, 0x6c, 0x02, 0x00, 0xfc, 0x00, 0x0f,
+    0xf4, 0x01, 0x15, 0x00, 0x28, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x04, 0x00, 0x00, 0x4c, 0x02, 0x00,
+    0xec, 0x05, 0x00, 0x68, 0x19, 0x00, 0xf0, 0x61, 0x01, 0x30, 0x25, 0x00, 0x30, 0x01, 0x12, 0xb5,
+    0x18, 0x03, 0x00, 0x68, 0x32, 0x00, 0xa0, 0x0d, 0x00, 0x7c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf8,
+    0x06, 0x00, 0x58, 0x01, 0x00, 0x94, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x24, 0x06, 0x00, 0x50, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0xac, 0x02, 0x00, 0x5c, 0x15, 0x00, 0xa4, 0x14, 0x00, 0x10, 0x13, 0x00, 0x5c, 0x0f, 0x00, 0x78,
+    0x05, 0x01, 0x58, 0x03, 0x03, 0x0c, 0x06, 0x01, 0x34, 0x02, 0x03, 0x70, 0x00, 0x00, 0xec, 0x0f,
+    0x00, 0x5c, 0x00, 0x00, 0x0c, 0x30, 0x00, 0xbc, 0x03, 0x00, 0x68, 0x03, 0x00, 0x48, 0x00, 0x00,
+    0x70, 0x02, 0x00, 0x08, 0x00, 0x00, 0xec, 0x05, 0x00, 0x54, 0x00, 0x00, 0x84, 0x44, 0x00, 0xd8,
+    0x0b, 0x00, 0x64, 0x09, 0x00, 0xa0, 0x08, 0x00, 0x08, 0x10, 0x00, 0x78, 0x06, 0x00, 0x88, 0x07,
+    0x00, 0x70, 0x00, 0x00, 0x8c, 0x24, 0x00, 0xcc, 0x21, 0x00, 0x3c, 0x03, 0x00, 0xbc, 0x1a, 0x00,
+    0xd8, 0x06, 0x00, 0x84, 0x00, 0x00, 0x58, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c,
+    0x01, 0x00, 0x38, 0x01, 0x00, 0xac, 0x00, 0x0f, 0x04, 0x00, 0x29, 0x00, 0x44, 0x01, 0x00, 0x7c,
+    0x01, 0x0f, 0x84, 0x07, 0x1d, 0x00, 0x2c, 0x01, 0x00, 0xb4, 0x00, 0x00, 0x40, 0x08, 0x00, 0x84,
+    0x07, 0x00, 0x74, 0x1a, 0x01, 0x74, 0x0b, 0x12, 0xb5, 0x84, 0x05, 0x00, 0xe0, 0x01, 0x00, 0xb0,
+    0x35, 0x00, 0xfc, 0x04, 0x01, 0x64, 0x00, 0x0f, 0x84, 0x07, 0x0c, 0x00, 0xc4, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x03, 0x00, 0xa8, 0x04, 0x00, 0x44, 0x00, 0x00, 0xb0, 0x01,
+    0x00, 0x9c, 0x03, 0x00, 0x3c, 0x14, 0x04, 0x50, 0x04, 0x00, 0x74, 0x01, 0x00, 0x60, 0x1b, 0x00,
+    0xd0, 0x04, 0x00, 0x04, 0x27, 0x00, 0xe0, 0x06, 0x04, 0x40, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04,
+    0x00, 0x15, 0x00, 0x70, 0x00, 0x00, 0x2c, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xb8, 0x04, 0x00, 0x94,
+    0x11, 0x00, 0x68, 0x14, 0x00, 0xc0, 0x00, 0x00, 0xe4, 0x48, 0x01, 0x4c, 0x02, 0x03, 0xe8, 0x01,
+    0x00, 0x90, 0x07, 0x00, 0x84, 0x00, 0x00, 0xc8, 0x14, 0x00, 0x6c, 0x20, 0x00, 0x28, 0x06, 0x00,
+    0xd4, 0x04, 0x00, 0xa0, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x68, 0x02, 0x00, 0x20, 0x00, 0x00, 0xc8,
+    0x1c, 0x00, 0x6c, 0x09, 0x00, 0xcc, 0x03, 0x00, 0xe4, 0x0d, 0x01, 0x9c, 0x15, 0x12, 0xf3, 0x6c,
+    0x6b, 0x00, 0x78, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x84, 0x07, 0x80, 0x00, 0x10, 0x62, 0x00,
+    0xe0, 0x46, 0x00, 0x18, 0x23, 0x00, 0xc8, 0x2a, 0x00, 0x2c, 0x32, 0x60, 0x2e, 0x33, 0xb8, 0xff,
+    0x0f, 0x10, 0x78, 0x06, 0x12, 0xb4, 0xd8, 0x64, 0x00, 0x74, 0x0b, 0x00, 0x08, 0x06, 0x00, 0x70,
+    0x0a, 0x00, 0x64, 0x03, 0x00, 0x6c, 0x01, 0x00, 0x04, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x7c, 0x02,
+    0x00, 0x18, 0x00, 0x00, 0x24, 0x03, 0x00, 0xc0, 0x05, 0x00, 0x04, 0x12, 0x00, 0x20, 0x0b, 0x00,
+    0x28, 0x04, 0x00, 0x18, 0x18, 0x00, 0x08, 0x03, 0x00, 0xcc, 0x08, 0x00, 0x94, 0x0e, 0x00, 0xac,
+    0x05, 0x00, 0x40, 0x03, 0x00, 0x48, 0x03, 0x00, 0x50, 0x03, 0x00, 0x2c, 0x02, 0x0c, 0x50, 0x00,
+    0x0f, 0x10, 0x00, 0x05, 0x04, 0x64, 0x00, 0x00, 0xf4, 0x05, 0x00, 0xfc, 0x03, 0x00, 0xb4, 0x01,
+    0x00, 0x34, 0x08, 0x00, 0x64, 0x03, 0x00, 0x50, 0x02, 0x00, 0x58, 0x09, 0x00, 0x8c, 0xa5, 0x00,
+    0xa0, 0x1c, 0x00, 0xb8, 0x01, 0x00, 0x0c, 0x08, 0x00, 0xf4, 0x07, 0x00, 0x1c, 0x02, 0x00, 0xc8,
+    0x07, 0x00, 0x58, 0x00, 0x08, 0x70, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x88, 0x07, 0x00, 0xb0, 0x00,
+    0x00, 0x9c, 0x00, 0x00, 0x58, 0x1a, 0x00, 0x94, 0x02, 0x00, 0x3c, 0x08, 0x01, 0x84, 0x07, 0x03,
+    0x38, 0x02, 0x00, 0x5c, 0x00, 0x04, 0x64, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x84, 0x0f, 0x00, 0xd8,
+    0x12, 0x00, 0x90, 0x1a, 0x00, 0xe8, 0x02, 0x00, 0x1c, 0x01, 0x0c, 0xc8, 0x03, 0x00, 0xac, 0x00,
+    0x00, 0xf8, 0x01, 0x00, 0x70, 0x00, 0x00, 0x2c, 0x41, 0x00, 0x38, 0x07, 0x00, 0x64, 0x03, 0x00,
+    0x64, 0x00, 0x00, 0x54, 0x01, 0x00, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x9c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x18, 0x04, 0x00, 0x6c, 0x02,
+    0x00, 0x64, 0x00, 0x00, 0x20, 0x34, 0x00, 0x30, 0x5b, 0x00, 0xcc, 0x02, 0x00, 0x04, 0x00, 0x00,
+    0x78, 0x13, 0x00, 0x34, 0x08, 0x00, 0x3c, 0x08, 0x00, 0x6c, 0x01, 0x00, 0xdc, 0x00, 0x00, 0xc8,
+    0x00, 0x01, 0x40, 0x00, 0x0f, 0x78, 0x31, 0x28, 0x00, 0xc4, 0x01, 0x00, 0xb0, 0x00, 0x00, 0xc8,
+    0x00, 0x00, 0x58, 0x00, 0x00, 0x60, 0x01, 0x04, 0xb0, 0x00, 0x00, 0x70, 0x00, 0x04, 0xb0, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0xa4, 0x00, 0x01, 0x70, 0x00, 0x03, 0x10, 0x04, 0x00, 0x20, 0x04, 0x00,
+    0x28, 0x04, 0x00, 0xec, 0x03, 0x00, 0xfc, 0x80, 0x01, 0x30, 0x01, 0x11, 0xb2, 0x5c, 0x2e, 0x00,
+    0x18, 0x36, 0x00, 0xc4, 0xb3, 0x3d, 0xb6, 0xc4, 0xe2, 0x84, 0x4a, 0x00, 0xb8, 0x43, 0x00, 0xbc,
+    0x25, 0x00, 0x18, 0xc5, 0x05, 0x84, 0x07, 0x00, 0xb0, 0x0e, 0x00, 0xcc, 0x07, 0x00, 0x3c, 0x04,
+    0x0f, 0x14, 0x04, 0x21, 0x04, 0xac, 0x09, 0x00, 0x70, 0x09, 0x00, 0xb8, 0x02, 0x00, 0x78, 0x01,
+    0x00, 0x10, 0x04, 0x05, 0x1c, 0x13, 0x11, 0xb2, 0x78, 0x0f, 0x0c, 0x8c, 0x86, 0x00, 0x14, 0x08,
+    0x0f, 0x04, 0x00, 0x25, 0x0f, 0x10, 0x1e, 0x47, 0x03, 0xd0, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x44,
+    0x0a, 0x00, 0x8c, 0x13, 0x00, 0x54, 0x0a, 0x00, 0xd4, 0x00, 0x00, 0xdc, 0x02, 0x00, 0xb4, 0x0e,
+    0x00, 0x80, 0x07, 0x00, 0x50, 0x03, 0x00, 0x84, 0x01, 0x04, 0xc4, 0x01, 0x00, 0x08, 0x00, 0x00,
+    0xa0, 0x01, 0x0f, 0x04, 0x00, 0x11, 0x00, 0xcc, 0x01, 0x00, 0x04, 0x00, 0x00, 0x74, 0x02, 0x00,
+    0xe4, 0x01, 0x00, 0x18, 0x12, 0x00, 0x84, 0x20, 0x01, 0xc4, 0x01, 0x00, 0xf0, 0x16, 0x02, 0x0c,
+    0xb6, 0x05, 0xf0, 0x07, 0x00, 0x78, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x02, 0x00, 0xb0, 0x1a,
+    0x00, 0x74, 0x05, 0x00, 0x14, 0x05, 0x00, 0xe8, 0x02, 0x00, 0x80, 0x10, 0x01, 0x04, 0x00, 0x00,
+    0xe0, 0x94, 0x00, 0xc4, 0xb9, 0x12, 0xf9, 0x78, 0x03, 0x00, 0xec, 0x03, 0x00, 0x2c, 0x03, 0x00,
+    0xbc, 0x00, 0x00, 0x24, 0x02, 0x00, 0x1c, 0x15, 0x00, 0x18, 0x04, 0x01, 0x64, 0x00, 0x03, 0x00,
+    0x11, 0x01, 0x60, 0x03, 0x03, 0x84, 0x07, 0x00, 0x0c, 0x0e, 0x00, 0x28, 0x03, 0x00, 0x94, 0x03,
+    0x00, 0x68, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xec, 0x02, 0x00, 0xd8, 0x01, 0x00,
+    0xf4, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0xe0, 0x12, 0x00, 0x90, 0x00, 0x00, 0xf0, 0x16, 0x04, 0x08,
+    0x01, 0x00, 0x6c, 0x00, 0x00, 0x84, 0x07, 0x00, 0x1c, 0x01, 0x00, 0xdc, 0x05, 0x00, 0xb4, 0x35,
+    0x01, 0x88, 0x8f, 0x12, 0xb2, 0x64, 0xff, 0x00, 0x34, 0x19, 0x00, 0xa8, 0x0d, 0x00, 0x58, 0x00,
+    0x00, 0xcc, 0x0b, 0x00, 0x94, 0x0b, 0x00, 0x88, 0x03, 0x00, 0x2c, 0x01, 0x00, 0x08, 0x01, 0x00,
+    0x08, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x00, 0x78, 0x01, 0x00, 0xa4, 0x00, 0x00,
+    0x9c, 0x03, 0x00, 0x64, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xd4, 0x40, 0x00, 0xf4, 0x04, 0x00, 0xf0,
+    0x07, 0x00, 0x58, 0x00, 0x00, 0x40, 0x03, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x2c, 0x01,
+    0x00, 0x0c, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x34, 0x08, 0x00, 0x64, 0x01, 0x00, 0x7c, 0x04, 0x01,
+    0xb0, 0x00, 0x12, 0xb3, 0x8c, 0x08, 0x04, 0x84, 0x15, 0x01, 0xe0, 0x01, 0x03, 0x84, 0x12, 0x00,
+    0x34, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x5c, 0x00, 0x00, 0x78, 0x01, 0x00, 0x8c, 0x00, 0x00,
+    0xdc, 0x10, 0x00, 0x1c, 0x01, 0x00, 0x3c, 0x14, 0x00, 0xe0, 0x10, 0x00, 0xdc, 0x01, 0x01, 0xb8,
+    0x0c, 0x00, 0x6c, 0x01, 0x0f, 0x08, 0x0f, 0x3c, 0x00, 0x48, 0x01, 0x00, 0x50, 0x08, 0x00, 0xb0,
+    0x0e, 0x00, 0x24, 0x02, 0x00, 0xc8, 0x03, 0x00, 0xb8, 0x09, 0x01, 0xd4, 0x00, 0x00, 0x70, 0x00,
+    0x12, 0xb2, 0xd8, 0x50, 0x00, 0x0c, 0x09, 0x00, 0xe0, 0x0d, 0x00, 0x58, 0x07, 0x00, 0x28, 0x00,
+    0x00, 0xc0, 0x01, 0x00, 0x90, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0xec, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x28, 0x01, 0x00, 0x90, 0x31, 0x00, 0xa4, 0x04, 0x00, 0x70, 0x00, 0x00,
+    0x08, 0x01, 0x00, 0xf0, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x78, 0x01, 0x00,
+    0xb0, 0x05, 0x00, 0x90, 0x01, 0x0f, 0x10, 0x1e, 0x70, 0x00, 0x70, 0x04, 0x00, 0x54, 0x6c, 0x00,
+    0x88, 0x07, 0x00, 0xf4, 0x55, 0x00, 0xb0, 0x87, 0x51, 0x4d, 0x54, 0xbd, 0xff, 0x1c, 0x3c, 0x41,
+    0x00, 0x18, 0x03, 0x03, 0x18, 0x3b, 0x00, 0x34, 0x03, 0x00, 0x68, 0x03, 0x00, 0x68, 0x06, 0x00,
+    0xec, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xec, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0xc0, 0x05, 0x00,
+    0x04, 0x03, 0x00, 0x50, 0x0b, 0x00, 0xd8, 0x06, 0x00, 0x6c, 0x06, 0x00, 0x8c, 0x0a, 0x00, 0x74,
+    0x01, 0x00, 0x48, 0x0b, 0x00, 0xd4, 0x08, 0x00, 0xbc, 0xa8, 0x00, 0xf4, 0x09, 0x00, 0x54, 0x00,
+    0x00, 0x10, 0x01, 0x00, 0x60, 0x04, 0x00, 0xbc, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x58, 0x00, 0x01,
+    0x04, 0x14, 0x00, 0x00, 0x60, 0x00, 0x00, 0x10, 0x24, 0x00, 0x5c, 0x02, 0x00, 0x80, 0x01, 0x00,
+    0xb8, 0x01, 0x00, 0x50, 0x00, 0x01, 0x64, 0x09, 0x03, 0x2c, 0x04, 0x00, 0x68, 0x05, 0x00, 0x70,
+    0x1d, 0x00, 0xcc, 0x1a, 0x00, 0xc0, 0x06, 0x00, 0xbc, 0x03, 0x00, 0xb4, 0x03, 0x00, 0x98, 0x00,
+    0x00, 0x84, 0x01, 0x00, 0xf4, 0x02, 0x01, 0x08, 0x00, 0x03, 0x24, 0x04, 0x00, 0x5c, 0x00, 0x00,
+    0xa8, 0x02, 0x00, 0x6c, 0x0b, 0x00, 0x98, 0x01, 0x00, 0x14, 0x02, 0x00, 0x90, 0x5a, 0x00, 0x88,
+    0x07, 0x01, 0xa4, 0x0b, 0x00, 0x08, 0x01, 0x00, 0x3c, 0x02, 0x04, 0x04, 0x00, 0x12, 0xb4, 0x8c,
+    0x5f, 0x00, 0xcc, 0x0b, 0x00, 0x7c, 0x0b, 0x00, 0xec, 0x2d, 0x04, 0x10, 0x02, 0x00, 0xc4, 0x04,
+    0x00, 0x50, 0x00, 0x00, 0xa8, 0x00, 0x04, 0x08, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0xb0, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x7c, 0x04, 0x00, 0xfc, 0x09, 0x00, 0xd4, 0x06, 0x00, 0x20,
+    0x06, 0x00, 0x44, 0x02, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x14, 0x01, 0x00, 0xb8, 0x00, 0x00, 0x24, 0x01, 0x00, 0x2c, 0x01, 0x00,
+    0x34, 0x01, 0x00, 0x14, 0x0a, 0x00, 0x68, 0x2e, 0x00, 0x40, 0x0a, 0x00, 0x54, 0x01, 0x00, 0x2c,
+    0x05, 0x00, 0xf0, 0x45, 0x00, 0xd0, 0x0b, 0x00, 0xc4, 0x00, 0x00, 0x40, 0x00, 0x00, 0xdc, 0x00,
+    0x04, 0x4c, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x78, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x2c, 0x01, 0x00, 0x98, 0x08, 0x0c, 0xb0, 0x00, 0x00, 0x44, 0x05, 0x00, 0x98, 0x00, 0x04,
+    0x44, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xd0,
+    0x00, 0x00, 0x8c, 0x0c, 0x00, 0xa0, 0x00, 0x01, 0x50, 0x05, 0x11, 0xb2, 0xd0, 0xe3, 0x00, 0xb4,
+    0x3d, 0x00, 0x3c, 0xac, 0x00, 0x80, 0x46, 0x00, 0x08, 0xb3, 0x00, 0x04, 0x4e, 0x00, 0x18, 0x0f,
+    0x00, 0xc4, 0x5f, 0x00, 0x20, 0x34, 0x00, 0x28, 0x3a, 0x00, 0x30, 0x0f, 0x02, 0x84, 0x07, 0x11,
+    0xb2, 0x0c, 0x19, 0x01, 0x40, 0x9f, 0x0f, 0x84, 0x07, 0x1d, 0x04, 0xf8, 0x00, 0x00, 0xac, 0x04,
+    0x00, 0x84, 0x05, 0x00, 0x40, 0x00, 0x40, 0x7b, 0xd7, 0xff, 0x01, 0x10, 0xeb, 0x00, 0xc0, 0x60,
+    0x00, 0x54, 0x27, 0x03, 0x98, 0x00, 0x0f, 0x18, 0x65, 0x3d, 0x0f, 0x84, 0x07, 0x46, 0x00, 0x64,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x60, 0x02, 0x00, 0xc8, 0x05, 0x00, 0x4c, 0x02,
+    0x00, 0x84, 0x0a, 0x00, 0x04, 0x00, 0x00, 0xa8, 0x01, 0x00, 0xc0, 0x05, 0x00, 0x00, 0x02, 0x00,
+    0x7c, 0x08, 0x00, 0x2c, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00,
+    0x38, 0x01, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x01, 0x00, 0xe4, 0x01, 0x00, 0x04, 0x03, 0x00, 0x7c,
+    0x0b, 0x01, 0x84, 0x0a, 0x12, 0xb2, 0x78, 0xe7, 0x00, 0xf0, 0x02, 0x00, 0xdc, 0x01, 0x00, 0x68,
+    0x0e, 0x00, 0xe8, 0x12, 0x00, 0x78, 0x00, 0x00, 0x04, 0x00, 0x00, 0x70, 0x05, 0x00, 0x94, 0x00,
+    0x00, 0x3c, 0x00, 0x00, 0x98, 0x03, 0x00, 0x7c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x7c, 0x00, 0x08,
+    0x0c, 0x00, 0x00, 0x38, 0x02, 0x01, 0x30, 0x11, 0x12, 0xec, 0x44, 0x00, 0x00, 0xe8, 0x20, 0x00,
+    0x6c, 0x0f, 0x00, 0xd8, 0x11, 0x00, 0x68, 0x03, 0x00, 0x6c, 0x38, 0x00, 0x8c, 0x4b, 0x00, 0x28,
+    0x2d, 0x00, 0x3c, 0xe2, 0x00, 0x4c, 0x0b, 0x00, 0xcc, 0x03, 0x00, 0xb8, 0x0b, 0x00, 0x40, 0x16,
+    0x00, 0x7c, 0x05, 0x00, 0x54, 0x04, 0x00, 0xec, 0x07, 0x00, 0xac, 0x03, 0x00, 0xfc, 0x03, 0x00,
+    0xbc, 0x0d, 0x00, 0x84, 0x49, 0x00, 0x6c, 0x07, 0x04, 0x50, 0x3c, 0x00, 0x24, 0x01, 0x00, 0x8c,
+    0x00, 0x00, 0x9c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x70, 0x03, 0x01, 0x70, 0x0f, 0x00, 0xc0, 0x03,
+    0x12, 0xb4, 0x7c, 0x2d, 0x00, 0xe0, 0x07, 0x00, 0x88, 0x06, 0x00, 0x58, 0x00, 0x04, 0x98, 0x16,
+    0x00, 0x34, 0x02, 0x01, 0xb4, 0x00, 0x03, 0x54, 0x0a, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x1d,
+    0x00, 0xf8, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x8c, 0x01, 0x0f, 0x84, 0x07, 0x11, 0x00, 0x60, 0x00,
+    0x00, 0x34, 0x00, 0x00, 0xb8, 0x01, 0x04, 0xb0, 0x00, 0x00, 0xd4, 0x1e, 0x01, 0xb0, 0x06, 0x00,
+    0x78, 0x04, 0x03, 0x20, 0xf7, 0x00, 0x84, 0x15, 0x00, 0xc8, 0x04, 0x00, 0xa4, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0x78, 0x01, 0x00, 0x38,
+    0x00, 0x00, 0x24, 0x02, 0x00, 0x44, 0x00, 0x00, 0xa0, 0x0e, 0x00, 0xbc, 0x18, 0x00, 0x88, 0x0e,
+    0x01, 0x6c, 0x0f, 0x0f, 0xfc, 0x19, 0x34, 0x04, 0x8c, 0x00, 0x00, 0x3c, 0x04, 0x00, 0x84, 0x01,
+    0x00, 0xa8, 0x01, 0x00, 0x98, 0x04, 0x00, 0x30, 0x07, 0x00, 0x44, 0x0c, 0x00, 0x4c, 0x08, 0x00,
+    0x00, 0x0f, 0x00, 0x74, 0x09, 0x00, 0xf8, 0x5c, 0x00, 0x3c, 0x0d, 0x00, 0x14, 0x08, 0x00, 0xac,
+    0x07, 0x00, 0x40, 0x0a, 0x00, 0xd4, 0x02, 0x00, 0x04, 0x01, 0x00, 0xb8, 0x03, 0x08, 0x04, 0x00,
+    0x04, 0x14, 0x00, 0x00, 0x98, 0x02, 0x00, 0x74, 0x09, 0x00, 0x8c, 0x06, 0x00, 0x28, 0x1f, 0x04,
+    0x7c, 0x19, 0x00, 0x6c, 0x01, 0x00, 0x7c, 0x00, 0x0f, 0x14, 0x01, 0x11, 0x00, 0xac, 0x04, 0x00,
+    0x2c, 0x00, 0x00, 0x74, 0x06, 0x00, 0xec, 0x05, 0x0f, 0x84, 0x07, 0x74, 0x00, 0x88, 0x07, 0x00,
+    0x2c, 0x9e, 0x00, 0x0c, 0x75, 0x00, 0x24, 0x05, 0x00, 0xa0, 0x25, 0x06, 0x04, 0xb2, 0x12, 0xb4,
+    0x0c, 0x11, 0x00, 0xb8, 0x68, 0x00, 0x0c, 0x06, 0x0f, 0x84, 0x07, 0x0d, 0x00, 0xe0, 0x00, 0x00,
+    0x88, 0x03, 0x00, 0xf8, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x58, 0x01, 0x00, 0xe0, 0x10, 0x00, 0x70,
+    0x06, 0x00, 0x78, 0x06, 0x00, 0xcc, 0x2c, 0x00, 0xc8, 0x0d, 0x00, 0xd4, 0x0d, 0x00, 0x98, 0x01,
+    0x00, 0x24, 0x03, 0x00, 0xd0, 0x03, 0x00, 0x34, 0x03, 0x00, 0x44, 0x01, 0x00, 0x04, 0x00, 0x00,
+    0x44, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x48, 0x01, 0x00, 0x90, 0x04, 0x00,
+    0x5c, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa8, 0x0d, 0x00, 0xfc, 0x5f, 0x01, 0x5c, 0x05, 0x03, 0x30,
+    0x25, 0x00, 0x6c, 0x12, 0x00, 0xb0, 0x01, 0x00, 0x48, 0x0e, 0x05, 0x20, 0x04, 0x12, 0xf6, 0x20,
+    0x03, 0x00, 0x44, 0x00, 0x00, 0x60, 0x00, 0x08, 0x0c, 0x00, 0x08, 0xb0, 0x00, 0x00, 0x50, 0x07,
+    0x00, 0x84, 0x04, 0x00, 0xec, 0x40, 0x00, 0xd4, 0x45, 0x00, 0x88, 0x04, 0x00, 0xf4, 0x25, 0x00,
+    0x88, 0x1d, 0x00, 0x60, 0x26, 0x00, 0xd0, 0x12, 0x00, 0x64, 0xa2, 0x00, 0xc8, 0x00, 0x00, 0x0c,
+    0x1b, 0x00, 0xb0, 0x07, 0x00, 0xec, 0x21, 0x00, 0x98, 0x0b, 0x00, 0x64, 0x04, 0x01, 0x5c, 0x00,
+    0x07, 0xc8, 0x03, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x58, 0x02, 0x00, 0xd4, 0x06, 0x00,
+    0x3c, 0x07, 0x00, 0x38, 0x08, 0x00, 0x48, 0x17, 0x00, 0x58, 0x02, 0x0f, 0xfc, 0x00, 0x05, 0x00,
+    0xe4, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xd0, 0x08, 0x00, 0xa4, 0x02, 0x00, 0x34, 0x02, 0x00, 0x58,
+    0x10, 0x00, 0x3c, 0x04, 0x00, 0x40, 0x03, 0x00, 0x78, 0x51, 0x00, 0x64, 0x10, 0x00, 0x14, 0x00,
+    0x00, 0xec, 0x08, 0x00, 0xac, 0x02, 0x00, 0x68, 0x00, 0x00, 0x80, 0x00, 0x0f, 0x04, 0x00, 0x25,
+    0x00, 0x14, 0x01, 0x00, 0x60, 0x01, 0x00, 0x48, 0x03, 0x00, 0x60, 0x01, 0x00, 0xe8, 0x04, 0x00,
+    0x40, 0x0e, 0x00, 0xfc, 0x07, 0x00, 0x4c, 0x09, 0x00, 0x64, 0x07, 0x00, 0x04, 0x02, 0x00, 0x60,
+    0x00, 0x00, 0x2c, 0x00, 0x01, 0x08, 0x00, 0x03, 0x98, 0x0b, 0x00, 0x78, 0x03, 0x00, 0x20, 0x00,
+    0x00, 0x28, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x54, 0x05, 0x21, 0x00, 0xb4, 0x54, 0x11, 0x31, 0x32,
+    0x36, 0xb9, 0x18, 0x45, 0x00, 0x74, 0x3d, 0x00, 0xf8, 0x18, 0x00, 0x1c, 0x3a, 0x00, 0x24, 0x1e,
+    0x00, 0x00, 0xd8, 0x00, 0xf0, 0x41, 0x00, 0x50, 0x36, 0x11, 0x17, 0xf8, 0x09, 0x00, 0x74, 0x10,
+    0x03, 0xc4, 0x01, 0x00, 0x00, 0x0d, 0x00, 0xc8, 0x04, 0x0f, 0x08, 0x0f, 0x19, 0x00, 0x6c, 0x01,
+    0x00, 0x94, 0x00, 0x00, 0x34, 0x01, 0x00, 0xdc, 0x03, 0x00, 0xc8, 0x01, 0x00, 0x2c, 0x2b, 0x00,
+    0x14, 0x08, 0x41, 0x29, 0xb9, 0xff, 0x03, 0x7c, 0x54, 0x00, 0x64, 0x00, 0x11, 0xb4, 0x10, 0xaf,
+    0x00, 0xf4, 0xd9, 0x00, 0x2c, 0xb0, 0x00, 0x04, 0x03, 0x0f, 0x04, 0x00, 0x2d, 0x0f, 0x84, 0x07,
+    0x0a, 0x00, 0xbc, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x60, 0x01, 0x00, 0x08, 0x00,
+    0x0f, 0x04, 0x00, 0x21, 0x00, 0x5c, 0x03, 0x00, 0x18, 0x02, 0x00, 0xa0, 0x01, 0x00, 0xb8, 0x05,
+    0x01, 0x04, 0x00, 0x12, 0xf6, 0x90, 0x13, 0x00, 0x18, 0x00, 0x0f, 0x54, 0x00, 0x21, 0x00, 0x34,
+    0x00, 0x00, 0x38, 0x01, 0x00, 0x04, 0x00, 0x00, 0x70, 0x02, 0x00, 0x94, 0x02, 0x00, 0x38, 0x01,
+    0x04, 0xb4, 0x08, 0x00, 0x30, 0x05, 0x00, 0x0c, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x54, 0x03, 0x00,
+    0xc8, 0x02, 0x00, 0x28, 0x00, 0x00, 0x70, 0x00, 0x01, 0x88, 0x00, 0x04, 0xd4, 0xb9, 0x03, 0xb0,
+    0x0f, 0x00, 0x50, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x08, 0x00, 0xa4,
+    0x1c, 0x00, 0x54, 0x00, 0x00, 0x30, 0x0b, 0x00, 0xa4, 0x1a, 0x00, 0xe4, 0x07, 0x00, 0x38, 0x02,
+    0x00, 0xa8, 0x0b, 0x00, 0xa0, 0x34, 0x00, 0x30, 0x1c, 0x00, 0xb0, 0x05, 0x00, 0x6c, 0x87, 0x00,
+    0xf4, 0x21, 0x00, 0x88, 0x06, 0x00, 0x98, 0x22, 0x00, 0x4c, 0x06, 0x00, 0x6c, 0x03, 0x00, 0x54,
+    0x04, 0x00, 0x98, 0x02, 0x00, 0x90, 0x12, 0x00, 0xe8, 0x05, 0x00, 0x0c, 0x08, 0x00, 0x90, 0x00,
+    0x00, 0x60, 0x01, 0x00, 0x08, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x20, 0x04, 0x00, 0xd4, 0x06, 0x05,
+    0x7c, 0x09, 0x12, 0xb4, 0x84, 0x0d, 0x00, 0x58, 0x00, 0x00, 0x8c, 0x15, 0x00, 0xbc, 0x8c, 0x00,
+    0x30, 0x1e, 0x00, 0x2c, 0x02, 0x00, 0xb0, 0x04, 0x00, 0x04, 0x01, 0x00, 0x04, 0x00, 0x0f, 0xc0,
+    0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x00, 0x18, 0x03, 0x00, 0x4c, 0x00, 0x00,
+    0xbc, 0x02, 0x0f, 0x08, 0x0f, 0x0d, 0x00, 0xc0, 0x01, 0x08, 0x20, 0x07, 0x00, 0x04, 0x18, 0x00,
+    0x10, 0x01, 0x01, 0x34, 0x08, 0x03, 0x84, 0x07, 0x00, 0xfc, 0x00, 0x00, 0x14, 0x22, 0x00, 0x40,
+    0x07, 0x00, 0x2c, 0x00, 0x01, 0x64, 0x00, 0x07, 0x60, 0x04, 0x0f, 0x90, 0x00, 0x09, 0x04, 0x1c,
+    0x00, 0x00, 0x94, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0xc4, 0x01, 0x00, 0x7c, 0x08,
+    0x00, 0x6c, 0x1c, 0x0d, 0x84, 0x07, 0x12, 0xe3, 0x50, 0xae, 0x00, 0x30, 0x00, 0x00, 0x48, 0x01,
+    0x04, 0x40, 0x00, 0x0f, 0x08, 0x00, 0x21, 0x00, 0x20, 0x02, 0x00, 0x10, 0x05, 0x00, 0x38, 0x06,
+    0x00, 0xf8, 0x07, 0x00, 0x90, 0x1e, 0x00, 0xe8, 0x01, 0x00, 0xa0, 0x14, 0x00, 0x80, 0x07, 0x00,
+    0xdc, 0x0f, 0x00, 0x58, 0x16, 0x00, 0xd0, 0x01, 0x00, 0xb8, 0x04, 0x00, 0x30, 0x00, 0x00, 0xb8,
+    0x01, 0x00, 0xa8, 0x00, 0x05, 0x04, 0x00, 0x03, 0x5c, 0x02, 0x00, 0x18, 0x00, 0x00, 0xd4, 0x07,
+    0x00, 0x30, 0x00, 0x00, 0x34, 0x02, 0x00, 0x20, 0x11, 0x00, 0x80, 0x09, 0x00, 0x88, 0x18, 0x00,
+    0x20, 0x04, 0x0f, 0xb0, 0x00, 0x15, 0x04, 0xd4, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x94, 0x03, 0x0f,
+    0x84, 0x07, 0x78, 0x00, 0x80, 0x04, 0x00, 0x2c, 0x48, 0x00, 0x34, 0x57, 0x33, 0x6c, 0x74, 0xc5,
+    0xd8, 0xc9, 0x03, 0x04, 0x02, 0x00, 0xf4, 0x05, 0x00, 0xf0, 0x02, 0x00, 0x4c, 0x01, 0x00, 0x80,
+    0x05, 0x0f, 0x04, 0x02, 0x19, 0x00, 0x70, 0x03, 0x00, 0x40, 0x06, 0x00, 0x7c, 0x06, 0x00, 0x78,
+    0x01, 0x01, 0xf4, 0x0a, 0x12, 0xb3, 0x58, 0x24, 0x00, 0xd8, 0x03, 0x00, 0xec, 0x03, 0x00, 0xb8,
+    0x05, 0x00, 0xc0, 0x05, 0x0f, 0x58, 0x00, 0x11, 0x00, 0x6c, 0x01, 0x00, 0x28, 0x00, 0x00, 0x94,
+    0x01, 0x00, 0xbc, 0x01, 0x00, 0x08, 0x9a, 0x00, 0xac, 0x05, 0x00, 0xf0, 0x11, 0x00, 0xdc, 0x0a,
+    0x00, 0x6c, 0x03, 0x00, 0xb0, 0x00, 0x04, 0xb4, 0x02, 0x00, 0x0c, 0x03, 0x0f, 0x40, 0x02, 0x19,
+    0x00, 0x0c, 0x02, 0x00, 0xbc, 0x03, 0x00, 0xa0, 0x01, 0x00, 0x58, 0x00, 0x00, 0xe4, 0x03, 0x00,
+    0xac, 0x0b, 0x00, 0x4c, 0x11, 0x00, 0x94, 0x1d, 0x00, 0x60, 0x1e, 0x00, 0x54, 0x17, 0x00, 0x6c,
+    0x1e, 0x00, 0xc8, 0x03, 0x00, 0xc0, 0x0b, 0x00, 0x1c, 0x1e, 0x00, 0x18, 0x02, 0x00, 0xdc, 0x0b,
+    0x00, 0xf0, 0x07, 0x00, 0x70, 0x00, 0x04, 0xec, 0x01, 0x00, 0x50, 0x00, 0x00, 0x38, 0x03, 0x00,
+    0xa8, 0x1b, 0x00, 0x40, 0x01, 0x00, 0xcc, 0x0b, 0x00, 0x3c, 0x0f, 0x00, 0x30, 0x00, 0x00, 0xe0,
+    0x06, 0x00, 0x80, 0x08, 0x00, 0x24, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x00,
+    0x0f, 0x04, 0x00, 0x01, 0x00, 0x44, 0x00, 0x00, 0x28, 0x01, 0x00, 0x30, 0x01, 0x00, 0x38, 0x01,
+    0x01, 0xe0, 0x06, 0x12, 0xb3, 0xa4, 0x1b, 0x08, 0x98, 0x16, 0x00, 0x88, 0x04, 0x00, 0xf4, 0x00,
+    0x00, 0x54, 0x00, 0x00, 0xd4, 0x02, 0x0f, 0x4c, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x0d, 0x00, 0x88,
+    0x00, 0x00, 0x3c, 0x00, 0x00, 0xb4, 0x00, 0x00, 0xb0, 0x52, 0x00, 0x2c, 0x03, 0x00, 0x80, 0x1c,
+    0x00, 0x20, 0x04, 0x00, 0x50, 0x09, 0x00, 0x54, 0x17, 0x00, 0x5c, 0x03, 0x04, 0x64, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0xec, 0x01, 0x00, 0xa0, 0x0c, 0x00, 0xec, 0x01, 0x00, 0x64,
+    0x12, 0x00, 0x08, 0x1a, 0x21, 0x2a, 0xba, 0x4c, 0xbb, 0x71, 0x0e, 0x0e, 0xb5, 0xff, 0x1a, 0x18,
+    0xb6, 0x2c, 0xb7, 0x31, 0x26, 0x29, 0xb7, 0x24, 0x1e, 0x31, 0x27, 0x29, 0xb7, 0xc4, 0xdc, 0x00,
+    0x28, 0x0f, 0x50, 0x11, 0x0f, 0xb5, 0xff, 0x04, 0x20, 0x07, 0x00, 0x5c, 0x08, 0x00, 0x30, 0x11,
+    0x00, 0x58, 0x09, 0x00, 0x24, 0x0b, 0x00, 0x34, 0x01, 0x00, 0xd0, 0x00, 0x00, 0xb4, 0x00, 0x00,
+    0x64, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x78, 0x01, 0x00, 0x64, 0x03, 0x00,
+    0xbc, 0x00, 0x00, 0xe8, 0x09, 0x00, 0xd8, 0x16, 0x00, 0xa8, 0x01, 0x61, 0x00, 0xb4, 0xff, 0x1b,
+    0x1f, 0xb6, 0x10, 0x08, 0x00, 0xb8, 0x36, 0x00, 0xa4, 0x1e, 0x00, 0x20, 0x17, 0x3f, 0xb9, 0xc8,
+    0xe4, 0x9c, 0x6c, 0x32, 0x0f, 0x84, 0x07, 0x06, 0x00, 0xe8, 0x03, 0x00, 0x8c, 0x00, 0x00, 0x1c,
+    0x02, 0x00, 0xc4, 0x00, 0x00, 0x34, 0x10, 0x00, 0xc8, 0x02, 0x0f, 0xc8, 0x00, 0x09, 0x0f, 0x1c,
+    0x00, 0x09, 0x00, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0xec, 0x00, 0x04, 0x04, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x04, 0x00, 0x0f, 0x38, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x01, 0x48, 0x00, 0x12,
+    0xf9, 0xd4, 0x01, 0x00, 0x6c, 0x0e, 0x00, 0x60, 0x11, 0x00, 0x68, 0x02, 0x00, 0xdc, 0x02, 0x00,
+    0xcc, 0x2c, 0x00, 0x50, 0x03, 0x00, 0x40, 0x1d, 0x00, 0x1c, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x4c,
+    0x00, 0x00, 0xc8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00,
+    0x0f, 0x04, 0x00, 0x09, 0x00, 0x24, 0x00, 0x00, 0x30, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x09,
+    0x00, 0xd0, 0x02, 0x00, 0x10, 0x06, 0x00, 0x88, 0x55, 0x00, 0xd4, 0x0c, 0x00, 0xf0, 0x01, 0x00,
+    0x1c, 0x0f, 0x00, 0xf4, 0x09, 0x00, 0x68, 0x03, 0x00, 0xfc, 0x0a, 0x01, 0xcc, 0x29, 0x12, 0xb1,
+    0xbc, 0x43, 0x00, 0x74, 0x05, 0x00, 0x20, 0x0b, 0x00, 0xe4, 0x02, 0x00, 0x90, 0x06, 0x00, 0x94,
+    0x07, 0x00, 0x98, 0x03, 0x00, 0x30, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x34, 0x12, 0x00, 0x64, 0x00,
+    0x22, 0xb1, 0xfa, 0x9c, 0x44, 0x00, 0xc8, 0x03, 0x0f, 0x84, 0x07, 0x01, 0x01, 0x0c, 0x02, 0x00,
+    0x14, 0x0f, 0x03, 0x98, 0x5c, 0x00, 0x28, 0x07, 0x00, 0x58, 0x00, 0x00, 0x68, 0x02, 0x00, 0xa0,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xa4, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x00, 0x80, 0x00, 0x00, 0xdc,
+    0x01, 0x00, 0x4c, 0x00, 0x0f, 0x84, 0x07, 0x0a, 0x00, 0xa0, 0x17, 0x12, 0xf6, 0x4c, 0x01, 0x00,
+    0x04, 0x04, 0x00, 0x28, 0x16, 0x00, 0xa8, 0x06, 0x00, 0x2c, 0x02, 0x00, 0xc8, 0x19, 0x01, 0xbc,
+    0x97, 0x03, 0x80, 0x05, 0x00, 0x28, 0x08, 0x00, 0xfc, 0x0d, 0x00, 0x0c, 0x03, 0x00, 0x28, 0x05,
+    0x00, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xa0, 0x00, 0x15, 0x00, 0x90, 0x00, 0x00, 0xac, 0x01,
+    0x00, 0x08, 0x00, 0x00, 0x84, 0x02, 0x00, 0xdc, 0x04, 0x00, 0x68, 0x00, 0x00, 0x44, 0x0c, 0x04,
+    0x84, 0x07, 0x00, 0xe8, 0x01, 0x0f, 0x08, 0x01, 0x3d, 0x00, 0xa4, 0x00, 0x00, 0x4c, 0x07, 0x00,
+    0xa8, 0x05, 0x00, 0x60, 0x01, 0x00, 0xf0, 0x04, 0x00, 0xe4, 0x01, 0x00, 0x48, 0x04, 0x00, 0x3c,
+    0x18, 0x00, 0x14, 0x03, 0x00, 0x24, 0x0d, 0x00, 0xdc, 0x04, 0x00, 0x38, 0x01, 0x00, 0xa4, 0x00,
+    0x00, 0x34, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x48, 0x14, 0x00, 0x14, 0x00, 0x00, 0x2c, 0x01, 0x00,
+    0x84, 0x07, 0x00, 0xd8, 0x17, 0x00, 0x1c, 0x11, 0x00, 0xdc, 0x03, 0x00, 0x38, 0x01, 0x00, 0x18,
+    0x00, 0x04, 0x40, 0x00, 0x0f, 0x14, 0x01, 0x0d, 0x00, 0x48, 0x00, 0x00, 0x24, 0x00, 0x00, 0x20,
+    0x04, 0x04, 0x08, 0x01, 0x00, 0x6c, 0x11, 0x03, 0x08, 0x01, 0x0f, 0x9c, 0x34, 0x61, 0x00, 0x7c,
+    0x07, 0x04, 0x04, 0x00, 0x40, 0xcb, 0xdb, 0xed, 0xcc, 0x24, 0x14, 0x00, 0x9c, 0x1b, 0x20, 0x2a,
+    0x2c, 0x5c, 0x32, 0x03, 0x04, 0x02, 0x00, 0xd4, 0x06, 0x0f, 0x84, 0x07, 0x1d, 0x04, 0x14, 0x01,
+    0x00, 0xb8, 0x0b, 0x04, 0x0c, 0x03, 0x00, 0x14, 0x12, 0x01, 0xb8, 0x1d, 0x00, 0x34, 0x16, 0x12,
+    0xb3, 0xe0, 0x09, 0x00, 0xdc, 0x12, 0x00, 0x8c, 0x03, 0x00, 0xc0, 0x05, 0x04, 0x84, 0x01, 0x00,
+    0x24, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x5c, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x09, 0x00,
+    0xf4, 0x37, 0x00, 0x90, 0x1a, 0x00, 0xa0, 0x00, 0x00, 0xf0, 0x0a, 0x00, 0xf0, 0x0c, 0x00, 0x3c,
+    0x04, 0x00, 0x58, 0x00, 0x00, 0x9c, 0x12, 0x01, 0x58, 0x00, 0x00, 0x74, 0x16, 0x0f, 0x38, 0x0a,
+    0x0c, 0x00, 0xa0, 0x02, 0x04, 0xa0, 0x01, 0x00, 0x40, 0x03, 0x00, 0x44, 0x11, 0x00, 0x5c, 0x0e,
+    0x00, 0xa8, 0x12, 0x04, 0x20, 0x04, 0x00, 0x54, 0x00, 0x00, 0x60, 0x1e, 0x00, 0xfc, 0x0e, 0x00,
+    0x44, 0x0b, 0x01, 0xb0, 0x19, 0x12, 0xb0, 0x94, 0x40, 0x00, 0x8c, 0x0b, 0x00, 0x10, 0x08, 0x00,
+    0xe4, 0x02, 0x00, 0xbc, 0x00, 0x00, 0xcc, 0x00, 0x04, 0xa4, 0x00, 0x00, 0x68, 0x02, 0x00, 0xa0,
+    0x07, 0x00, 0x50, 0x16, 0x00, 0x7c, 0x02, 0x00, 0x54, 0x00, 0x00, 0xb8, 0x0b, 0x00, 0x48, 0x04,
+    0x00, 0x38, 0x04, 0x00, 0xa8, 0x02, 0x00, 0xd4, 0x00, 0x00, 0x84, 0x00, 0x00, 0x3c, 0x00, 0x08,
+    0x04, 0x00, 0x00, 0x94, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x94, 0x00, 0x00, 0x70,
+    0x0f, 0x00, 0x4c, 0x0a, 0x01, 0x78, 0x26, 0x00, 0x48, 0x01, 0x12, 0xb4, 0xa4, 0x2d, 0x00, 0x5c,
+    0x0f, 0x00, 0xa0, 0x07, 0x00, 0x58, 0x02, 0x00, 0x28, 0x00, 0x00, 0xe4, 0x04, 0x00, 0xa8, 0x08,
+    0x0f, 0x54, 0x00, 0x01, 0x08, 0x60, 0x00, 0x0f, 0x0c, 0x00, 0x01, 0x00, 0x8c, 0x00, 0x01, 0xbc,
+    0x00, 0x12, 0xf2, 0x74, 0xcc, 0x00, 0x08, 0x01, 0x00, 0x3c, 0x08, 0x00, 0xb8, 0x00, 0x00, 0x48,
+    0x03, 0x00, 0x64, 0x00, 0x00, 0xb4, 0x01, 0x00, 0xc8, 0x02, 0x00, 0x98, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x70, 0x03, 0x00, 0xac, 0x0c, 0x80, 0x7e, 0xd9, 0xff,
+    0x01, 0x69, 0xce, 0xff, 0x01, 0xb0, 0x0a, 0x05, 0x98, 0x64, 0x00, 0x50, 0x02, 0x0f, 0x04, 0x00,
+    0x05, 0x91, 0xb3, 0xff, 0x00, 0x1e, 0xb8, 0xff, 0x01, 0x47, 0xc1, 0x38, 0x16, 0x01, 0x5c, 0x3e,
+    0x00, 0x48, 0x16, 0x00, 0x3c, 0x02, 0x00, 0xc4, 0x01, 0x00, 0xa8, 0x00, 0x00, 0x64, 0x00, 0x00,
+    0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x30, 0x01, 0x00, 0x20, 0x00, 0x00, 0x58, 0x01, 0x00,
+    0x18, 0x02, 0x00, 0xf0, 0x0b, 0x00, 0xcc, 0x10, 0x03, 0x64, 0x03, 0x00, 0xa4, 0x70, 0x31, 0x5b,
+    0x62, 0xc0, 0x14, 0x56, 0x00, 0x44, 0x60, 0x3f, 0xb3, 0xc0, 0xe1, 0xa4, 0x8a, 0x36, 0x0f, 0x84,
+    0x07, 0x06, 0x00, 0x1c, 0x02, 0x00, 0x44, 0x01, 0x00, 0x94, 0x00, 0x00, 0x58, 0x01, 0x0f, 0xc8,
+    0x00, 0x11, 0x00, 0xc4, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xd8, 0x01, 0x01, 0x04, 0x00, 0x00,
+    0x84, 0x10, 0x03, 0xcc, 0x9e, 0x0f, 0x30, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x0d, 0x00, 0x94, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0xe4, 0x05, 0x00, 0xdc, 0x01, 0x00, 0xcc, 0x10, 0x00, 0x64, 0x11, 0x00,
+    0xc0, 0x01, 0x00, 0x80, 0x07, 0x00, 0xc0, 0x02, 0x00, 0xbc, 0x0e, 0x00, 0x74, 0x03, 0x00, 0xe8,
+    0x01, 0x00, 0x50, 0x00, 0x00, 0x30, 0x00, 0x01, 0x04, 0x00, 0x0f, 0x00, 0x0f, 0x14, 0x04, 0x34,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x2c, 0x03, 0x00, 0xbc, 0x11, 0x00, 0x84, 0x06,
+    0x00, 0x04, 0x00, 0x00, 0xb8, 0x02, 0x00, 0xe4, 0x09, 0x00, 0xa4, 0x05, 0x00, 0x28, 0x12, 0x01,
+    0xb8, 0x01, 0x03, 0x2c, 0x07, 0x00, 0x24, 0x06, 0x04, 0xb0, 0x0e, 0x00, 0xcc, 0x0d, 0x00, 0x3c,
+    0x03, 0x00, 0x98, 0x00, 0x00, 0x7c, 0x0b, 0x00, 0x60, 0x0d, 0x00, 0x54, 0x0f, 0x00, 0x60, 0x01,
+    0x00, 0x5c, 0x00, 0x0f, 0x84, 0x07, 0x16, 0x12, 0xb4, 0x58, 0x46, 0x00, 0xdc, 0x07, 0x00, 0x30,
+    0x07, 0x00, 0xdc, 0x00, 0x00, 0x40, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00,
+    0x21, 0x00, 0x3c, 0x00, 0x00, 0x98, 0x01, 0x00, 0x44, 0x04, 0x00, 0x54, 0x00, 0x00, 0xd8, 0x06,
+    0x00, 0xa4, 0x00, 0x00, 0x38, 0x06, 0x00, 0x38, 0x03, 0x00, 0xf4, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x58, 0x06, 0x00, 0xa0, 0x03, 0x00, 0x30, 0x03, 0x00, 0x48, 0x06, 0x00, 0xcc, 0x00, 0x00, 0x20,
+    0x05, 0x00, 0xc0, 0x04, 0x00, 0xe4, 0x0b, 0x01, 0x04, 0x10, 0x00, 0xfc, 0x00, 0x07, 0x20, 0x2e,
+    0x00, 0xf4, 0x00, 0x01, 0xb0, 0x06, 0x00, 0xf0, 0x01, 0x0f, 0xd0, 0x04, 0x0c, 0x00, 0x64, 0x00,
+    0x08, 0x04, 0x00, 0x04, 0x18, 0x03, 0x00, 0xb4, 0x03, 0x00, 0x88, 0x00, 0x00, 0x94, 0x02, 0x08,
+    0x84, 0x07, 0x00, 0x78, 0x1b, 0x00, 0x08, 0x01, 0x00, 0x74, 0x03, 0x00, 0x3c, 0x04, 0x00, 0x3c,
+    0x00, 0x00, 0xcc, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x00, 0x04, 0x01, 0x00, 0x04,
+    0x00, 0x00, 0xf0, 0x02, 0x00, 0xb4, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x8c, 0x0d, 0x00, 0xe4, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0xf0, 0x01, 0x00, 0xdc, 0x03, 0x00, 0x74, 0x01, 0x0f, 0x50, 0x02, 0x01,
+    0x00, 0x3c, 0x00, 0x01, 0x04, 0x00, 0x00, 0xbc, 0x05, 0x03, 0x3c, 0x33, 0x00, 0x2c, 0x00, 0x00,
+    0x2c, 0x01, 0x00, 0xe4, 0x14, 0x00, 0x34, 0x11, 0x22, 0x65, 0xcc, 0x10, 0x00, 0x0f, 0xb0, 0x00,
+    0x19, 0x0c, 0x08, 0x01, 0x00, 0x8c, 0x08, 0x0f, 0x84, 0x07, 0x78, 0x00, 0x90, 0x16, 0x00, 0x40,
+    0x32, 0x00, 0x28, 0x14, 0x1f, 0x29, 0x84, 0x07, 0x32, 0x12, 0xf8, 0x90, 0x0a, 0x00, 0x68, 0x03,
+    0x00, 0xbc, 0x05, 0x00, 0x84, 0x18, 0x01, 0x08, 0x20, 0x03, 0x3c, 0x06, 0x00, 0xf0, 0x09, 0x00,
+    0xe0, 0x09, 0x00, 0x58, 0x12, 0x00, 0xa8, 0x01, 0x00, 0xf4, 0x01, 0x00, 0x04, 0x00, 0x0f, 0xf4,
+    0x01, 0x15, 0x00, 0xbc, 0x01, 0x00, 0x98, 0x01, 0x00, 0x60, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x88,
+    0x07, 0x00, 0x84, 0x30, 0x00, 0xa0, 0x01, 0x04, 0x58, 0x00, 0x00, 0x54, 0x04, 0x00, 0x78, 0x01,
+    0x0f, 0x58, 0x00, 0x11, 0x04, 0x24, 0x00, 0x00, 0x58, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x24, 0x02,
+    0x00, 0x2c, 0x02, 0x00, 0x04, 0x00, 0x00, 0xe0, 0x0d, 0x00, 0xb0, 0x12, 0x00, 0x68, 0x38, 0x00,
+    0xa4, 0x0d, 0x01, 0xc0, 0x02, 0x00, 0x24, 0x03, 0x12, 0xb3, 0xbc, 0x1c, 0x00, 0x28, 0x0e, 0x00,
+    0xa4, 0x09, 0x00, 0x64, 0x03, 0x00, 0x3c, 0x02, 0x04, 0x64, 0x03, 0x00, 0xb4, 0x0b, 0x00, 0xf4,
+    0x02, 0x00, 0xc0, 0x07, 0x00, 0xa0, 0x1e, 0x00, 0x40, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x54, 0x00,
+    0x00, 0x2c, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xa8, 0x02, 0x0f, 0xf4, 0x00, 0x05, 0x00, 0x94, 0x00,
+    0x00, 0xc0, 0x00, 0x00, 0xfc, 0x75, 0x00, 0xbc, 0x02, 0x00, 0x00, 0x2a, 0x00, 0x84, 0x07, 0x00,
+    0x6c, 0x3d, 0x01, 0x58, 0x06, 0x12, 0xb4, 0x5c, 0x10, 0x00, 0x24, 0x1e, 0x00, 0xfc, 0x00, 0x00,
+    0xbc, 0x0f, 0x00, 0x7c, 0x06, 0x00, 0x14, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04,
+    0x00, 0x0f, 0x60, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x09, 0x00, 0x40, 0x00, 0x04, 0x60, 0x01, 0x00,
+    0x00, 0x04, 0x00, 0x5c, 0x1f, 0x00, 0x7c, 0x0c, 0x00, 0x0c, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x14,
+    0x01, 0x00, 0xc0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x34, 0x12, 0x00, 0xac, 0x00, 0x00, 0x88, 0x00, 0x00, 0xd8, 0x03, 0x00, 0xb4, 0x08, 0x01,
+    0xb8, 0x0f, 0x02, 0x04, 0x16, 0x02, 0x80, 0x32, 0x00, 0xf4, 0x27, 0x04, 0x04, 0x00, 0x00, 0x18,
+    0x00, 0x12, 0xb5, 0x68, 0x05, 0x00, 0xac, 0x04, 0x00, 0xbc, 0x0c, 0x00, 0x08, 0x06, 0x00, 0xb8,
+    0x03, 0x00, 0x18, 0x02, 0x00, 0xac, 0x04, 0x0f, 0xa8, 0x00, 0x09, 0x08, 0x1c, 0x00, 0x00, 0x2c,
+    0x01, 0x00, 0x10, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x90, 0x0f, 0x00, 0x4c, 0x15,
+    0x01, 0x2c, 0x01, 0x11, 0xb3, 0xa0, 0x52, 0x00, 0x98, 0xe3, 0x00, 0x08, 0xac, 0x00, 0x6c, 0x60,
+    0x0f, 0xb0, 0x7f, 0x1d, 0x04, 0xb0, 0x0a, 0x0f, 0x08, 0x00, 0x01, 0x0f, 0x84, 0x07, 0x02, 0x00,
+    0x50, 0x05, 0x00, 0x64, 0x23, 0x00, 0x1c, 0x10, 0x00, 0x14, 0x01, 0x00, 0x58, 0x02, 0x00, 0x80,
+    0x06, 0x0f, 0xd4, 0x00, 0x19, 0x00, 0xd0, 0x00, 0x0f, 0x04, 0x00, 0x49, 0x00, 0xb8, 0x01, 0x00,
+    0xec, 0x01, 0x00, 0x6c, 0x01, 0x00, 0x14, 0x06, 0x00, 0xb4, 0x0c, 0x00, 0x28, 0x19, 0x00, 0xa8,
+    0x05, 0x00, 0xc0, 0x01, 0x00, 0x64, 0x0e, 0x00, 0x50, 0x02, 0x00, 0xb8, 0x00, 0x0f, 0x88, 0x00,
+    0x35, 0x00, 0x74, 0x00, 0x00, 0x04, 0x01, 0x00, 0x78, 0x00, 0x00, 0x04, 0x00, 0x00, 0x88, 0x0a,
+    0x00, 0x60, 0x00, 0x00, 0x30, 0x03, 0x00, 0xcc, 0x0a, 0x00, 0x2c, 0x03, 0x00, 0x04, 0x08, 0x00,
+    0x14, 0x11, 0x00, 0x28, 0x04, 0x00, 0x60, 0x0b, 0x00, 0x44, 0x0d, 0x00, 0x18, 0x02, 0x00, 0xa4,
+    0x00, 0x00, 0x90, 0x02, 0x00, 0xe4, 0x03, 0x00, 0x04, 0x12, 0x00, 0x68, 0x09, 0x00, 0xd4, 0x0a,
+    0x00, 0x18, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x7c, 0x03, 0x00, 0x60, 0x00, 0x00, 0xc0, 0x03, 0x00,
+    0x4c, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x20, 0x13, 0x01, 0xac, 0x1a, 0x03, 0x6c, 0x02, 0x01, 0xc4,
+    0x12, 0x03, 0xc0, 0x0a, 0x00, 0x50, 0x0d, 0x00, 0x90, 0x0f, 0x00, 0x24, 0x06, 0x00, 0x3c, 0x07,
+    0x00, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00, 0x4c, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0x08, 0x03,
+    0x00, 0x00, 0x04, 0x00, 0x48, 0x00, 0x0f, 0x84, 0x07, 0x05, 0x00, 0x20, 0x00, 0x00, 0xa4, 0x00,
+    0x00, 0xf4, 0x00, 0x00, 0xd8, 0x08, 0x00, 0x88, 0x24, 0x00, 0x30, 0x19, 0x00, 0x54, 0x04, 0x00,
+    0xe8, 0x1a, 0x00, 0xb0, 0x24, 0x01, 0xac, 0x0f, 0x03, 0xac, 0x00, 0x00, 0x14, 0x10, 0x00, 0x3c,
+    0x13, 0x00, 0x38, 0x0e, 0x00, 0x88, 0x01, 0x00, 0xa8, 0x01, 0x0f, 0xa4, 0x00, 0x1d, 0x00, 0x18,
+    0x03, 0x00, 0x10, 0x0d, 0x05, 0x18, 0x03, 0x1a, 0xca, 0x8c, 0x16, 0x00, 0x64, 0x2a, 0x00, 0x7c,
+    0x03, 0x00, 0xec, 0x01, 0x0f, 0x08, 0x01, 0x31, 0x08, 0x38, 0x01, 0x00, 0x4c, 0x01, 0x00, 0xec,
+    0x00, 0x00, 0xb4, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x04, 0x02, 0x00, 0x98, 0x00, 0x08, 0x30, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x54, 0x01, 0x00,
+    0x14, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0x84, 0x05, 0x00, 0xe8, 0x05, 0x00, 0x0c, 0x0d, 0x00, 0x88,
+    0x04, 0x00, 0x0c, 0x23, 0x00, 0x44, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x50, 0x00, 0x00, 0x6c, 0x00,
+    0x00, 0x2c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x08, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x8c, 0x08,
+    0x0f, 0x84, 0x07, 0x7c, 0x00, 0x28, 0x62, 0x00, 0x64, 0x59, 0x0f, 0x84, 0x07, 0x33, 0x0b, 0x38,
+    0x77, 0x00, 0x68, 0x02, 0x00, 0xa0, 0x28, 0x08, 0xe8, 0x18, 0x00, 0xf4, 0x09, 0x00, 0xcc, 0x1c,
+    0x00, 0xbc, 0x06, 0x00, 0x30, 0x03, 0x0f, 0x5c, 0x02, 0x21, 0x00, 0x50, 0x01, 0x00, 0xd4, 0x01,
+    0x00, 0x9c, 0x02, 0x00, 0xe8, 0x07, 0x00, 0x78, 0x43, 0x00, 0x98, 0x03, 0x00, 0x58, 0x0a, 0x00,
+    0xa4, 0x2b, 0x0f, 0x3c, 0x17, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x14, 0x02, 0x00, 0x1c, 0x02, 0x00,
+    0xd4, 0x01, 0x00, 0x04, 0x00, 0x00, 0x40, 0x02, 0x00, 0x64, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x40,
+    0x07, 0x00, 0x5c, 0x00, 0x00, 0xa4, 0x16, 0x00, 0xc0, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb4, 0x0b,
+    0x00, 0x30, 0x1f, 0x00, 0x20, 0x02, 0x00, 0xb4, 0x06, 0x00, 0x34, 0x02, 0x00, 0x64, 0x03, 0x00,
+    0x3c, 0x00, 0x00, 0xd0, 0x02, 0x00, 0xfc, 0x0e, 0x00, 0x34, 0x1e, 0x00, 0x8c, 0x05, 0x00, 0x70,
+    0x12, 0x00, 0x8c, 0x05, 0x00, 0xec, 0x00, 0x00, 0x68, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x04, 0x00,
+    0x09, 0x00, 0x4c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x08, 0x14, 0x00, 0x24, 0x0c,
+    0x00, 0x84, 0x07, 0x01, 0xd4, 0x06, 0x00, 0x04, 0x08, 0x03, 0x0c, 0xf1, 0x00, 0xb8, 0x13, 0x00,
+    0x38, 0x0c, 0x00, 0xc4, 0x1e, 0x00, 0xb8, 0x0f, 0x00, 0x64, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3c,
+    0x00, 0x00, 0x04, 0x00, 0x0f, 0x64, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x0d, 0x00, 0xc8, 0x00, 0x00,
+    0xa0, 0x01, 0x00, 0x6c, 0x0c, 0x00, 0xa8, 0x03, 0x00, 0x54, 0x18, 0x00, 0x54, 0x08, 0x00, 0x08,
+    0x05, 0x00, 0xc8, 0x00, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00, 0x04, 0x48, 0x00, 0x00, 0x08, 0x03,
+    0x00, 0x18, 0x00, 0x00, 0x84, 0x00, 0x00, 0x7c, 0x06, 0x00, 0x08, 0x07, 0x00, 0xc8, 0x17, 0x00,
+    0x4c, 0x05, 0x00, 0xac, 0xc4, 0x00, 0x10, 0x1a, 0x04, 0x04, 0x00, 0x00, 0x54, 0x12, 0x00, 0xa4,
+    0x07, 0x00, 0x08, 0x00, 0x00, 0x20, 0x01, 0x00, 0xe8, 0x0f, 0x00, 0x94, 0x09, 0x00, 0x48, 0x01,
+    0x00, 0x84, 0x01, 0x04, 0x54, 0x00, 0x0f, 0x08, 0x00, 0x15, 0x04, 0x64, 0x03, 0x00, 0xac, 0x01,
+    0x00, 0xa0, 0x03, 0x00, 0x48, 0x06, 0x00, 0xdc, 0x04, 0x03, 0x84, 0x07, 0x00, 0x94, 0x5d, 0x00,
+    0xe4, 0x58, 0x0f, 0xa0, 0x52, 0x35, 0x08, 0x8c, 0x07, 0x00, 0x4c, 0x87, 0x00, 0x5c, 0x00, 0x20,
+    0x40, 0x46, 0xf0, 0x86, 0x03, 0xf0, 0x0f, 0x00, 0x1c, 0x79, 0x00, 0x94, 0x98, 0x00, 0x10, 0x0d,
+    0x00, 0x10, 0x06, 0x00, 0x24, 0x10, 0x00, 0x4c, 0x01, 0x00, 0x98, 0x02, 0x00, 0x00, 0x02, 0x00,
+    0x90, 0x05, 0x0f, 0xdc, 0x00, 0x15, 0x0f, 0x28, 0x00, 0x3d, 0x04, 0x7c, 0x00, 0x00, 0xe0, 0x02,
+    0x00, 0x10, 0x0a, 0x00, 0xb0, 0x01, 0x00, 0xf0, 0x0e, 0x00, 0xb0, 0x11, 0x00, 0x2c, 0x0a, 0x00,
+    0xac, 0x02, 0x00, 0x94, 0x05, 0x00, 0x20, 0x1e, 0x00, 0x54, 0x06, 0x00, 0x80, 0x00, 0x00, 0x60,
+    0x01, 0x04, 0x38, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x04, 0x00, 0x29, 0x00, 0x34, 0x02, 0x00, 0x04,
+    0x00, 0x00, 0x54, 0x00, 0x00, 0xec, 0x11, 0x00, 0x0c, 0x00, 0x04, 0x38, 0x02, 0x00, 0xc0, 0x09,
+    0x00, 0x70, 0x0a, 0x00, 0x68, 0x07, 0x00, 0x5c, 0x03, 0x00, 0x90, 0x00, 0x00, 0x7c, 0x03, 0x00,
+    0x3c, 0x01, 0x00, 0xc8, 0x08, 0x00, 0x24, 0x02, 0x00, 0x10, 0x0a, 0x00, 0x8c, 0x16, 0x00, 0xf4,
+    0x03, 0x0f, 0x84, 0x07, 0x22, 0x03, 0xc4, 0x87, 0x00, 0xcc, 0x03, 0x00, 0xd4, 0x03, 0x00, 0x88,
+    0x07, 0x00, 0xe4, 0x07, 0x00, 0x3c, 0x02, 0x00, 0x3c, 0x03, 0x00, 0xdc, 0x00, 0x0f, 0xec, 0x00,
+    0x1d, 0x00, 0xc4, 0x00, 0x00, 0x34, 0x00, 0x00, 0x30, 0x01, 0x0f, 0x84, 0x07, 0x11, 0x00, 0x20,
+    0x04, 0x00, 0x60, 0x12, 0x00, 0x70, 0x08, 0x00, 0xbc, 0x39, 0x01, 0xa8, 0x02, 0x03, 0x7c, 0x07,
+    0x01, 0x28, 0x08, 0x12, 0xb5, 0x6c, 0x3f, 0x00, 0x24, 0x0f, 0x00, 0x7c, 0x06, 0x00, 0xd4, 0x02,
+    0x00, 0x90, 0x01, 0x00, 0x44, 0x06, 0x00, 0x98, 0x03, 0x0f, 0xa4, 0x00, 0x15, 0x00, 0x64, 0x01,
+    0x00, 0x70, 0x02, 0x00, 0xdc, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x3c, 0x10, 0x00, 0x30, 0x04, 0x01,
+    0x70, 0x00, 0x12, 0xb3, 0xa8, 0x0a, 0x00, 0x88, 0x1e, 0x00, 0x54, 0x01, 0x00, 0xf4, 0x01, 0x00,
+    0xf8, 0x16, 0x00, 0xd4, 0x08, 0x0f, 0x08, 0x01, 0x25, 0x00, 0x98, 0x00, 0x08, 0x04, 0x00, 0x01,
+    0x18, 0x01, 0x00, 0xb4, 0x11, 0x0c, 0x04, 0x00, 0x0f, 0x44, 0x11, 0x10, 0x00, 0x3c, 0x00, 0x00,
+    0x4c, 0x00, 0x00, 0x34, 0x03, 0x00, 0x30, 0x01, 0x00, 0x8c, 0x08, 0x00, 0x34, 0x01, 0x00, 0xe8,
+    0x04, 0x00, 0x58, 0x06, 0x00, 0x10, 0x00, 0x0f, 0xb0, 0x00, 0x15, 0x00, 0x08, 0x01, 0x00, 0x4c,
+    0x00, 0x00, 0x40, 0x01, 0x00, 0x1c, 0x0d, 0x0f, 0x84, 0x07, 0xed, 0x00, 0x7c, 0x09, 0x00, 0x54,
+    0x0e, 0x04, 0x44, 0x15, 0x00, 0x64, 0x06, 0x00, 0x0c, 0x04, 0x0f, 0x5c, 0x02, 0x15, 0x00, 0x9c,
+    0x01, 0x00, 0xbc, 0x03, 0x00, 0x54, 0x01, 0x00, 0x5c, 0x02, 0x00, 0x88, 0x03, 0x00, 0x90, 0x03,
+    0x00, 0x08, 0x0f, 0x00, 0x4c, 0x02, 0x00, 0xa8, 0x03, 0x00, 0x44, 0x02, 0x00, 0x78, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x48, 0x03, 0x01, 0x60, 0x00, 0x07,
+    0x0c, 0x11, 0x00, 0xe4, 0x0d, 0x00, 0x04, 0x02, 0x00, 0xbc, 0x01, 0x00, 0x94, 0x0b, 0x00, 0x88,
+    0x06, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x00, 0xdc, 0x0e, 0x00, 0x44, 0x04,
+    0x01, 0x38, 0x00, 0x03, 0x5c, 0x1b, 0x00, 0x88, 0x16, 0x00, 0x58, 0x06, 0x00, 0xa4, 0x0e, 0x00,
+    0xec, 0x03, 0x00, 0x38, 0x02, 0x00, 0x44, 0x00, 0x00, 0x60, 0x06, 0x00, 0xbc, 0x00, 0x00, 0x2c,
+    0x00, 0x0f, 0x94, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x20,
+    0x01, 0x04, 0x84, 0x07, 0x01, 0x90, 0x1e, 0x03, 0x84, 0x07, 0x01, 0xac, 0x03, 0x00, 0xf4, 0x05,
+    0x03, 0x00, 0x97, 0x00, 0xc4, 0x0c, 0x00, 0x2c, 0x00, 0x00, 0x48, 0x01, 0x00, 0x64, 0x00, 0x0f,
+    0xfc, 0x00, 0x1d, 0x04, 0x90, 0x00, 0x00, 0x04, 0x01, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0xb4, 0x02, 0x00, 0xa4, 0x04, 0x00, 0xbc, 0x03, 0x00, 0x20, 0x1f, 0x00, 0xa8, 0x0c, 0x00, 0x74,
+    0x08, 0x04, 0xf0, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x28, 0x00, 0x00, 0x08, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x88, 0x07, 0x00, 0x34, 0x00, 0x00, 0x74, 0x06, 0x00, 0x28, 0x03, 0x00, 0xe4, 0x01, 0x00,
+    0x2c, 0x01, 0x00, 0x48, 0x04, 0x00, 0xe8, 0x14, 0x08, 0x04, 0x00, 0x00, 0x64, 0x05, 0x00, 0x10,
+    0x00, 0x00, 0xac, 0x08, 0x00, 0x68, 0x05, 0x00, 0x0c, 0x0d, 0x00, 0x18, 0x06, 0x00, 0x48, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x34, 0x00, 0x00, 0x2c, 0x00,
+    0x00, 0x10, 0x02, 0x00, 0xb0, 0x04, 0x0b, 0x84, 0x07, 0x00, 0x7c, 0x37, 0x00, 0x14, 0xfa, 0x00,
+    0x54, 0x7e, 0x08, 0x40, 0x07, 0x0f, 0x0c, 0x00, 0x31, 0x04, 0x08, 0x0f, 0x00, 0xe8, 0x07, 0x01,
+    0x68, 0x3f, 0x00, 0x78, 0x0d, 0x00, 0x14, 0x33, 0x00, 0x44, 0x05, 0x00, 0x20, 0x19, 0x00, 0xbc,
+    0x0b, 0x00, 0x2c, 0x02, 0x00, 0x0c, 0x33, 0x00, 0xe8, 0x02, 0x00, 0x24, 0x01, 0x0f, 0xe0, 0x00,
+    0x1d, 0x00, 0xdc, 0x00, 0x0f, 0x04, 0x00, 0x35, 0x00, 0x7c, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x5c,
+    0x02, 0x00, 0xbc, 0x02, 0x00, 0x40, 0x03, 0x01, 0xf4, 0x06, 0x12, 0xd2, 0xd0, 0x0a, 0x00, 0xe0,
+    0x01, 0x00, 0xac, 0x02, 0x00, 0xf4, 0x06, 0x00, 0x4c, 0x02, 0x00, 0x78, 0x00, 0x00, 0x34, 0x00,
+    0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x35, 0x00, 0x50, 0x00, 0x05, 0x04, 0x00, 0x12, 0xf7, 0x90,
+    0x1e, 0x00, 0x70, 0x00, 0x00, 0xdc, 0x0c, 0x00, 0x6c, 0x06, 0x00, 0x5c, 0x05, 0x00, 0x54, 0x1a,
+    0x00, 0x20, 0x08, 0x00, 0x84, 0x16, 0x00, 0x70, 0x02, 0x00, 0xf4, 0x0c, 0x00, 0x00, 0x0a, 0x00,
+    0xe4, 0x03, 0x00, 0xe8, 0x29, 0x00, 0x94, 0x02, 0x00, 0xbc, 0x00, 0x00, 0x34, 0x06, 0x00, 0x98,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x5c, 0x01, 0x00, 0xb0, 0x07, 0x00, 0xf8, 0x08, 0x0f, 0x08, 0x0f,
+    0x02, 0x03, 0x84, 0x11, 0x00, 0x1c, 0x1b, 0x00, 0x90, 0x16, 0x00, 0xb8, 0x0b, 0x00, 0x8c, 0x3c,
+    0x00, 0x34, 0x0a, 0x00, 0x88, 0x07, 0x00, 0x44, 0x07, 0x00, 0x4c, 0x00, 0x00, 0x9c, 0x00, 0x00,
+    0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x30, 0x00, 0x00, 0x54, 0x01, 0x00, 0x40, 0x00, 0x0f,
+    0x84, 0x07, 0x15, 0x00, 0xf8, 0x02, 0x00, 0xf4, 0x17, 0x00, 0x2c, 0x02, 0x00, 0x34, 0x02, 0x01,
+    0xd0, 0x03, 0x03, 0xa0, 0x00, 0x00, 0x10, 0x0f, 0x04, 0xe8, 0x12, 0x00, 0x24, 0x07, 0x00, 0x10,
+    0x0f, 0x00, 0xd4, 0x00, 0x00, 0x10, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x98, 0x00, 0x00, 0x74, 0x00,
+    0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x18, 0x03, 0x04, 0x84, 0x07, 0x01, 0x20, 0x12,
+    0x00, 0x08, 0x0f, 0x04, 0xb0, 0x4c, 0x12, 0xb4, 0x84, 0x2e, 0x00, 0x38, 0x21, 0x00, 0x38, 0x17,
+    0x00, 0xd4, 0x13, 0x00, 0x7c, 0x1a, 0x00, 0x08, 0x01, 0x00, 0x6c, 0x01, 0x00, 0x58, 0x00, 0x0f,
+    0x64, 0x00, 0x11, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x14, 0x01, 0x00, 0x44, 0x00,
+    0x09, 0x04, 0x00, 0x0f, 0x80, 0x07, 0x10, 0x08, 0x50, 0x00, 0x00, 0x14, 0x04, 0x00, 0x90, 0x00,
+    0x00, 0xd8, 0x01, 0x00, 0x18, 0x02, 0x00, 0x90, 0x04, 0x00, 0xec, 0x04, 0x00, 0x08, 0x02, 0x00,
+    0x44, 0x01, 0x00, 0xf0, 0x05, 0x00, 0x20, 0x00, 0x00, 0x34, 0x00, 0x00, 0x68, 0x00, 0x00, 0x08,
+    0x00, 0x0c, 0x04, 0x00, 0x00, 0x08, 0x01, 0x00, 0x14, 0x00, 0x00, 0x9c, 0x04, 0x00, 0xb4, 0x05,
+    0x0f, 0x84, 0x07, 0xe1, 0x01, 0x40, 0x8c, 0x00, 0x3c, 0x06, 0x12, 0xb4, 0x50, 0x24, 0x00, 0xb0,
+    0x2e, 0x00, 0x9c, 0x06, 0x00, 0xf4, 0x12, 0x00, 0x48, 0x03, 0x00, 0xb4, 0x06, 0x00, 0xf0, 0x08,
+    0x00, 0x28, 0x01, 0x0f, 0x48, 0x01, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd8, 0x01,
+    0x04, 0x54, 0x01, 0x00, 0x74, 0x05, 0x00, 0x40, 0x00, 0x00, 0x90, 0x03, 0x00, 0x50, 0x03, 0x00,
+    0x98, 0x01, 0x0f, 0x08, 0x0f, 0x25, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x08,
+    0x04, 0x00, 0x00, 0x38, 0x07, 0x00, 0xa0, 0x0d, 0x00, 0x74, 0x0f, 0x00, 0xe4, 0x06, 0x00, 0x08,
+    0x02, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3c, 0x04, 0x00, 0xac, 0x04,
+    0x00, 0x34, 0x00, 0x00, 0x98, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x78, 0x05, 0x00,
+    0xe4, 0x00, 0x00, 0x30, 0x0f, 0x00, 0x84, 0x07, 0x00, 0xf0, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x2c, 0x00, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x28, 0x05, 0x00, 0x68, 0x00, 0x0f, 0x84, 0x07, 0x06, 0x00, 0x54, 0x01, 0x03, 0x80,
+    0x75, 0x00, 0x98, 0x02, 0x00, 0x2c, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x64, 0x00, 0x11, 0x0f, 0x7c,
+    0x00, 0x06, 0x03, 0xcc, 0x10, 0x00, 0x20, 0x00, 0x00, 0x60, 0x01, 0x00, 0xf4, 0x02, 0x00, 0xf8,
+    0x13, 0x00, 0xe4, 0x08, 0x00, 0x10, 0x32, 0x00, 0x4c, 0x06, 0x00, 0x08, 0x04, 0x00, 0xa0, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x28, 0x00, 0x00, 0x94, 0x01, 0x04, 0x0c, 0x00, 0x00, 0xb4, 0x08, 0x00,
+    0x38, 0x00, 0x00, 0x04, 0x01, 0x00, 0xd0, 0x03, 0x00, 0x4c, 0x05, 0x00, 0x08, 0x00, 0x0c, 0x04,
+    0x00, 0x04, 0x18, 0x00, 0x00, 0x58, 0x04, 0x00, 0x80, 0x07, 0x00, 0x54, 0x00, 0x00, 0x44, 0x05,
+    0x00, 0x48, 0x00, 0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0xf0, 0x00,
+    0x00, 0x2c, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x84, 0x07, 0x04, 0x00, 0x94, 0x63, 0x00, 0xf0, 0x85,
+    0x0f, 0x78, 0x07, 0x31, 0x08, 0x44, 0x00, 0x31, 0xbb, 0xca, 0xe5, 0x58, 0x30, 0x00, 0x68, 0x3f,
+    0x00, 0xe4, 0x8d, 0x72, 0x24, 0x28, 0xb7, 0xff, 0x17, 0x1c, 0xb6, 0xd8, 0x2b, 0x00, 0x60, 0x05,
+    0x00, 0x6c, 0x17, 0x00, 0xf4, 0x03, 0x00, 0x88, 0x0c, 0x00, 0x30, 0x06, 0x00, 0xe4, 0x00, 0x04,
+    0xb0, 0x00, 0x00, 0xb4, 0x00, 0x0f, 0x04, 0x00, 0x5d, 0x01, 0x60, 0x01, 0x03, 0x64, 0xdd, 0x00,
+    0xc0, 0x04, 0x00, 0x20, 0x09, 0x00, 0xb0, 0x06, 0x00, 0x9c, 0x15, 0x00, 0x4c, 0x03, 0x00, 0xd4,
+    0x02, 0x00, 0x44, 0x02, 0x00, 0xa8, 0x00, 0x00, 0xc0, 0x05, 0x0f, 0xa0, 0x00, 0x51, 0x00, 0x6c,
+    0x00, 0x00, 0x1c, 0x03, 0x00, 0x78, 0x00, 0x00, 0x40, 0x02, 0x05, 0x04, 0x00, 0x12, 0xf3, 0x24,
+    0xc5, 0x00, 0xdc, 0x06, 0x00, 0x3c, 0x01, 0x00, 0x7c, 0x1a, 0x00, 0xd4, 0x09, 0x00, 0x90, 0x25,
+    0x00, 0x4c, 0x13, 0x00, 0xc0, 0x16, 0x00, 0x58, 0x05, 0x00, 0xa4, 0x00, 0x0f, 0x84, 0x07, 0x19,
+    0x00, 0xe8, 0x30, 0x00, 0xd8, 0x19, 0x00, 0x24, 0x1b, 0x00, 0x90, 0x11, 0x00, 0xcc, 0x19, 0x00,
+    0x08, 0x0a, 0x00, 0xcc, 0x03, 0x00, 0x4c, 0x00, 0x00, 0x24, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04,
+    0x00, 0x15, 0x00, 0x30, 0x00, 0x00, 0xb4, 0x02, 0x00, 0xa8, 0x00, 0x0f, 0x84, 0x07, 0x19, 0x00,
+    0xa4, 0x0b, 0x01, 0x48, 0x52, 0x00, 0xc8, 0x03, 0x04, 0x08, 0x0f, 0x03, 0x88, 0x07, 0x00, 0xa0,
+    0x00, 0x00, 0x20, 0x1e, 0x00, 0xb0, 0x34, 0x00, 0x38, 0x2e, 0x00, 0xdc, 0x04, 0x00, 0x20, 0x09,
+    0x0f, 0x70, 0x06, 0x0d, 0x08, 0xb4, 0x00, 0x00, 0x98, 0x00, 0x00, 0x10, 0x00, 0x00, 0xfc, 0x09,
+    0x00, 0xec, 0x10, 0x00, 0x44, 0x0b, 0x00, 0x9c, 0x12, 0x00, 0x00, 0x0f, 0x00, 0xe4, 0x31, 0x00,
+    0xa0, 0x02, 0x00, 0x14, 0x36, 0x00, 0x8c, 0x07, 0x00, 0x04, 0x26, 0x00, 0x90, 0x05, 0x00, 0x28,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x04, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00,
+    0x69, 0x00, 0x88, 0x02, 0x00, 0x58, 0x05, 0x00, 0xf0, 0x1a, 0x00, 0xa8, 0x01, 0x00, 0x30, 0x2a,
+    0x00, 0x24, 0x10, 0x00, 0x9c, 0x08, 0x00, 0x04, 0x02, 0x0f, 0xb0, 0x00, 0x0d, 0x04, 0x70, 0x03,
+    0x00, 0x2c, 0x02, 0x0f, 0x84, 0x07, 0xf1, 0x04, 0x5c, 0x02, 0x00, 0x14, 0x46, 0x00, 0x28, 0x0c,
+    0x00, 0x54, 0x03, 0x00, 0xe0, 0x0a, 0x00, 0xc0, 0x02, 0x00, 0xc8, 0x02, 0x0f, 0xf8, 0x01, 0x11,
+    0x00, 0x24, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x74, 0x05, 0x00, 0x54, 0x01, 0x00, 0xf4, 0x13, 0x00,
+    0x98, 0x03, 0x00, 0x50, 0x04, 0x00, 0x04, 0x03, 0x00, 0x18, 0x00, 0x00, 0xc8, 0x03, 0x00, 0xd8,
+    0x03, 0x00, 0x28, 0x00, 0x0f, 0x40, 0x02, 0x29, 0x00, 0x00, 0x02, 0x00, 0x48, 0x00, 0x00, 0x04,
+    0x02, 0x00, 0x54, 0x00, 0x00, 0x2c, 0x08, 0x01, 0x04, 0x00, 0x12, 0xf4, 0xc0, 0x0b, 0x00, 0x1c,
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x94, 0x00, 0x00, 0xec, 0x01, 0x00, 0x28, 0x00, 0x00, 0x70, 0x07,
+    0x00, 0x78, 0x07, 0x00, 0xc0, 0x15, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0x94, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x94, 0x04, 0x00, 0x58, 0x07, 0x04, 0x84, 0x07, 0x08, 0x8c, 0x16, 0x00, 0x2c,
+    0x0b, 0x00, 0x40, 0x0b, 0x00, 0x40, 0x35, 0x00, 0xd4, 0x15, 0x00, 0x58, 0x13, 0x00, 0xd4, 0x1b,
+    0x00, 0xfc, 0x00, 0x00, 0x38, 0x00, 0x04, 0x98, 0x00, 0x0f, 0x68, 0x00, 0x09, 0x0f, 0x1c, 0x00,
+    0x05, 0x00, 0xa4, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xa4, 0x12, 0x00, 0x58, 0x16,
+    0x00, 0xe4, 0x08, 0x00, 0xfc, 0x02, 0x0f, 0x84, 0x07, 0x01, 0x08, 0x48, 0x00, 0x00, 0x70, 0x01,
+    0x00, 0xe8, 0x00, 0x00, 0x84, 0x00, 0x05, 0x30, 0x01, 0x04, 0x0c, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x60, 0x05, 0x12, 0xf4, 0x74, 0x9c, 0x00, 0x30, 0x00, 0x00, 0xb0, 0x00, 0x08, 0x48, 0x00, 0x0f,
+    0x0c, 0x00, 0x19, 0x00, 0xb0, 0x00, 0x00, 0x30, 0x00, 0x00, 0xb0, 0x00, 0x0f, 0x84, 0x07, 0x00,
+    0x00, 0x60, 0x7f, 0x00, 0x9c, 0x6c, 0x00, 0xb4, 0x0e, 0x08, 0x40, 0x07, 0x0f, 0x0c, 0x00, 0x31,
+    0x00, 0xdc, 0x9d, 0x00, 0x68, 0x3f, 0x00, 0xf8, 0x72, 0x00, 0x40, 0xda, 0x36, 0x55, 0x5c, 0xbf,
+    0x7c, 0x4e, 0x00, 0xf4, 0x13, 0x00, 0x74, 0x0d, 0x00, 0xe4, 0x06, 0x00, 0x40, 0x5f, 0x00, 0xcc,
+    0x0b, 0x00, 0x20, 0x01, 0x00, 0xb0, 0x00, 0x00, 0xec, 0x02, 0x00, 0xb4, 0x00, 0x0f, 0x04, 0x00,
+    0x5d, 0x00, 0x7c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0xb0, 0x10, 0x00, 0x98, 0x05,
+    0x00, 0x88, 0x03, 0x00, 0x4c, 0x12, 0x00, 0xec, 0x01, 0x00, 0x44, 0x01, 0x00, 0x94, 0x00, 0x00,
+    0x0c, 0x11, 0x0f, 0xa4, 0x00, 0x59, 0x00, 0x6c, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x04, 0x00, 0x00,
+    0xa0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x14, 0x02, 0x00, 0x18, 0x07, 0x00, 0x3c, 0x03, 0x00, 0xd8,
+    0x03, 0x00, 0x24, 0x08, 0x00, 0xdc, 0x0a, 0x00, 0x10, 0x03, 0x00, 0x50, 0x01, 0x00, 0xd8, 0x09,
+    0x04, 0x94, 0x06, 0x0f, 0x84, 0x07, 0x19, 0x04, 0x3c, 0x03, 0x00, 0x40, 0x03, 0x00, 0x58, 0x31,
+    0x00, 0x80, 0x08, 0x04, 0xe8, 0x23, 0x00, 0x78, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x04, 0x01, 0x0f,
+    0x04, 0x00, 0x15, 0x00, 0x34, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc4, 0x04, 0x00, 0xa8, 0x00, 0x00,
+    0x90, 0x04, 0x00, 0x5c, 0x0e, 0x00, 0xc4, 0x19, 0x00, 0xa0, 0x04, 0x00, 0x24, 0x06, 0x00, 0x20,
+    0x00, 0x00, 0xa4, 0x00, 0x00, 0xd8, 0x0d, 0x00, 0x68, 0x10, 0x00, 0xc4, 0x0d, 0x0f, 0x84, 0x07,
+    0x09, 0x08, 0xa4, 0x00, 0x00, 0x3c, 0x14, 0x00, 0x70, 0x06, 0x00, 0x80, 0x06, 0x00, 0x10, 0x0c,
+    0x00, 0x98, 0x00, 0x00, 0x74, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00,
+    0x00, 0x98, 0x00, 0x00, 0x48, 0x04, 0x00, 0x70, 0x18, 0x00, 0x50, 0x1d, 0x00, 0xc0, 0x06, 0x00,
+    0x38, 0x4b, 0x00, 0x84, 0x08, 0x00, 0x04, 0x01, 0x00, 0xa8, 0x02, 0x00, 0x44, 0x29, 0x00, 0x2c,
+    0x0a, 0x00, 0xb0, 0x00, 0x00, 0xec, 0x06, 0x00, 0x58, 0x00, 0x00, 0x88, 0x01, 0x00, 0x08, 0x00,
+    0x0f, 0x04, 0x00, 0x6d, 0x00, 0x88, 0x00, 0x00, 0x04, 0x00, 0x00, 0xa8, 0x0b, 0x00, 0x88, 0x08,
+    0x00, 0x34, 0x09, 0x00, 0x90, 0x18, 0x00, 0x98, 0x04, 0x00, 0x0c, 0xc9, 0x00, 0x5c, 0x07, 0x00,
+    0xa4, 0x00, 0x00, 0x24, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x04, 0x18, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0xe0, 0x00, 0x00, 0xe8, 0x00, 0x0f, 0x94, 0x25, 0x78, 0x0f, 0x10, 0x1e, 0x52, 0x00,
+    0x58, 0x11, 0x01, 0xec, 0x01, 0x04, 0xec, 0x09, 0x03, 0xf8, 0x09, 0x00, 0x24, 0x0c, 0x00, 0x04,
+    0x04, 0x00, 0x58, 0x01, 0x00, 0x60, 0x01, 0x00, 0x2c, 0x01, 0x00, 0x04, 0x00, 0x0c, 0x44, 0x01,
+    0x0c, 0x10, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x24, 0x06, 0x00, 0x90, 0x02, 0x00, 0x88, 0x03, 0x00,
+    0xa8, 0x11, 0x00, 0x98, 0x03, 0x00, 0xa0, 0x03, 0x00, 0xa8, 0x03, 0x00, 0x8c, 0x06, 0x00, 0x88,
+    0x0d, 0x00, 0xfc, 0x02, 0x00, 0xe0, 0x05, 0x00, 0x40, 0x00, 0x00, 0x04, 0x03, 0x00, 0x08, 0x00,
+    0x0f, 0x04, 0x00, 0x25, 0x00, 0x74, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x50, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0xbc, 0x03, 0x00, 0x38, 0x04, 0x00, 0x64, 0x03, 0x00, 0xcc, 0x1a, 0x00, 0x0c, 0x1f,
+    0x0f, 0x84, 0x07, 0x31, 0x00, 0xe4, 0x0e, 0x00, 0x4c, 0x1d, 0x05, 0x98, 0x03, 0x04, 0x48, 0x01,
+    0x12, 0xb4, 0x30, 0xb0, 0x00, 0x5c, 0x39, 0x00, 0xac, 0x0e, 0x00, 0x74, 0x00, 0x00, 0x04, 0x04,
+    0x00, 0xd4, 0x13, 0x00, 0x78, 0x03, 0x00, 0xf0, 0x05, 0x00, 0x98, 0x00, 0x00, 0x04, 0x00, 0x04,
+    0xa8, 0x00, 0x0f, 0x08, 0x00, 0x11, 0x00, 0x84, 0x01, 0x00, 0x60, 0x01, 0x00, 0x90, 0x05, 0x00,
+    0x98, 0x05, 0x00, 0xec, 0x02, 0x0f, 0x84, 0x07, 0x15, 0x00, 0x60, 0x00, 0x00, 0x6c, 0x01, 0x00,
+    0x74, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x38, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x00, 0x6c, 0x00,
+    0x00, 0x78, 0x01, 0x00, 0x08, 0x00, 0x00, 0xf0, 0x01, 0x04, 0x64, 0x03, 0x07, 0x10, 0x1e, 0x0f,
+    0x84, 0x07, 0x49, 0x00, 0xc8, 0x07, 0x40, 0xc8, 0xd7, 0xeb, 0x88, 0x64, 0x0f, 0x00, 0xfc, 0x4b,
+    0x00, 0xfc, 0x25, 0x20, 0x43, 0x48, 0x1c, 0x1e, 0x00, 0xa4, 0x01, 0x03, 0xe8, 0x42, 0x0f, 0x84,
+    0x07, 0x81, 0x00, 0x70, 0x03, 0x00, 0x50, 0x09, 0x00, 0x80, 0x03, 0x00, 0x6c, 0x20, 0x00, 0xc4,
+    0x0a, 0x00, 0xec, 0x01, 0x00, 0xa8, 0x04, 0x00, 0x88, 0x01, 0x04, 0x54, 0x01, 0x00, 0x0c, 0x00,
+    0x0f, 0x04, 0x00, 0x55, 0x04, 0x30, 0x02, 0x00, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0xc8, 0x09,
+    0x00, 0x80, 0x07, 0x00, 0x98, 0x00, 0x00, 0xd8, 0x18, 0x00, 0x04, 0x00, 0x00, 0xec, 0x03, 0x00,
+    0xe4, 0x02, 0x00, 0x1c, 0x28, 0x00, 0x2c, 0x06, 0x00, 0x24, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x7c, 0x03, 0x00, 0xe8, 0x08, 0x00, 0x24, 0x00, 0x00, 0x74, 0x01, 0x0d, 0x94, 0x25,
+    0x03, 0x64, 0x0e, 0x05, 0x48, 0x03, 0x12, 0xb3, 0x00, 0x35, 0x00, 0x84, 0x07, 0x00, 0xa0, 0x22,
+    0x00, 0x80, 0x88, 0x00, 0x48, 0x02, 0x00, 0x4c, 0x00, 0x00, 0x54, 0x00, 0x0f, 0x04, 0x00, 0x15,
+    0x01, 0xb8, 0x00, 0x0f, 0x40, 0x78, 0x0c, 0x00, 0x58, 0x00, 0x0f, 0x84, 0x07, 0x25, 0x00, 0xe0,
+    0x53, 0x00, 0x78, 0x4a, 0x0f, 0x84, 0x07, 0x1e, 0x03, 0xf8, 0x15, 0x00, 0xd8, 0x22, 0x00, 0x1c,
+    0x03, 0x00, 0x14, 0x05, 0x00, 0x6c, 0x08, 0x00, 0x48, 0x01, 0x00, 0x98, 0x04, 0x00, 0x78, 0x07,
+    0x01, 0x98, 0x05, 0x12, 0xb2, 0x0c, 0x00, 0x00, 0x9c, 0x06, 0x00, 0x40, 0x03, 0x00, 0x58, 0x01,
+    0x00, 0xfc, 0x00, 0x0f, 0x08, 0x01, 0x1d, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x41, 0x00, 0x88,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x2c, 0x06, 0x0f, 0x84, 0x07, 0xff, 0x3a, 0x00,
+    0x1c, 0x2f, 0x00, 0x50, 0x01, 0x00, 0x58, 0x01, 0x00, 0x34, 0x06, 0x00, 0xcc, 0x02, 0x00, 0x6c,
+    0x01, 0x0f, 0xc8, 0x01, 0x0d, 0x00, 0xd0, 0x02, 0x00, 0x24, 0x00, 0x00, 0x80, 0x03, 0x00, 0x34,
+    0x04, 0x00, 0x90, 0x03, 0x00, 0x98, 0x03, 0x00, 0xb8, 0x2b, 0x00, 0x60, 0x02, 0x00, 0x04, 0x00,
+    0x00, 0xb8, 0x03, 0x00, 0x74, 0x02, 0x00, 0x80, 0x0d, 0x00, 0x2c, 0x00, 0x00, 0x5c, 0x00, 0x00,
+    0x08, 0x00, 0x0f, 0x04, 0x00, 0x25, 0x00, 0x40, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x50, 0x00,
+    0x00, 0x1c, 0x00, 0x00, 0xbc, 0x00, 0x00, 0xe8, 0x0a, 0x00, 0x38, 0x04, 0x00, 0xdc, 0x22, 0x00,
+    0xe8, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x08, 0x0f, 0x2d, 0x00, 0xfc, 0x65, 0x00, 0xe0, 0x44, 0x01,
+    0x3c, 0x29, 0x03, 0xc0, 0x08, 0x01, 0x48, 0x04, 0x12, 0xb4, 0xf0, 0x6d, 0x00, 0x60, 0x3b, 0x00,
+    0x98, 0x3b, 0x00, 0xac, 0x34, 0x00, 0xdc, 0x1b, 0x00, 0x48, 0x03, 0x00, 0x54, 0x14, 0x00, 0x80,
+    0x08, 0x00, 0x98, 0x00, 0x00, 0x04, 0x00, 0x04, 0xa8, 0x00, 0x0f, 0x08, 0x00, 0x11, 0x00, 0xc8,
+    0x00, 0x0f, 0x84, 0x07, 0x95, 0x00, 0xd0, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x3c,
+    0x04, 0x00, 0xfc, 0x00, 0x00, 0x4c, 0x04, 0x0f, 0x84, 0x07, 0x58, 0x00, 0x88, 0x07, 0x00, 0x04,
+    0x00, 0x00, 0x8c, 0xa1, 0x00, 0x5c, 0xef, 0x00, 0x74, 0x4e, 0x02, 0x1c, 0x1e, 0x12, 0xb2, 0x08,
+    0x06, 0x00, 0x78, 0x26, 0x00, 0x84, 0x0c, 0x00, 0x74, 0x17, 0x00, 0x18, 0x09, 0x00, 0xb0, 0x00,
+    0x04, 0xc4, 0x02, 0x00, 0xb8, 0x00, 0x0f, 0x04, 0x00, 0x55, 0x00, 0xd4, 0x01, 0x00, 0x80, 0x00,
+    0x00, 0x94, 0x05, 0x00, 0x38, 0x03, 0x00, 0x34, 0x03, 0x00, 0x9c, 0x3b, 0x00, 0xa0, 0x00, 0x00,
+    0xe4, 0x05, 0x00, 0xe8, 0x22, 0x00, 0x18, 0x00, 0x00, 0x28, 0x00, 0x0f, 0x34, 0x02, 0x1d, 0x0f,
+    0xc4, 0x00, 0x39, 0x00, 0x7c, 0x00, 0x00, 0x20, 0x01, 0x00, 0x14, 0x04, 0x00, 0x1c, 0x04, 0x00,
+    0xd4, 0x02, 0x04, 0xa4, 0x00, 0x00, 0xd8, 0x1c, 0x00, 0x68, 0x07, 0x00, 0xd8, 0x03, 0x00, 0x74,
+    0x07, 0x00, 0xd0, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x54, 0x01, 0x00, 0x10, 0x00, 0x00, 0x1c, 0x00,
+    0x0f, 0x84, 0x07, 0x12, 0x00, 0x24, 0x09, 0x12, 0xb4, 0xd0, 0x60, 0x00, 0x40, 0x20, 0x00, 0x74,
+    0x19, 0x00, 0x34, 0x03, 0x00, 0x58, 0x00, 0x00, 0x54, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xd4, 0x00,
+    0x15, 0x08, 0xb0, 0x00, 0x00, 0x54, 0x01, 0x0f, 0x08, 0x0f, 0x36, 0x03, 0xa4, 0x00, 0x00, 0xac,
+    0x0c, 0x00, 0x28, 0x16, 0x00, 0x5c, 0x00, 0x00, 0x78, 0x0c, 0x00, 0x98, 0x00, 0x00, 0x74, 0x00,
+    0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0xcc, 0x00, 0x00, 0x04, 0x00, 0x00, 0xdc, 0x00,
+    0x00, 0x20, 0x01, 0x00, 0x18, 0x19, 0x00, 0xa4, 0x0f, 0x00, 0xf0, 0x47, 0x01, 0x84, 0x07, 0x12,
+    0xb3, 0x08, 0x01, 0x00, 0x14, 0x00, 0x00, 0xdc, 0x15, 0x00, 0x48, 0x03, 0x00, 0x58, 0x00, 0x00,
+    0x54, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x6d, 0x00, 0xec, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x10, 0x02, 0x00, 0x60, 0x0d, 0x00, 0x38, 0x0a, 0x00, 0x68, 0x10, 0x00, 0xe8, 0x03, 0x00, 0xcc,
+    0x00, 0x00, 0xb4, 0x02, 0x00, 0xa4, 0x00, 0x0f, 0xb0, 0x00, 0x05, 0x04, 0x18, 0x00, 0x00, 0x28,
+    0x00, 0x04, 0x20, 0x04, 0x0f, 0x08, 0x0f, 0xee, 0x00, 0x5c, 0x02, 0x03, 0x98, 0x32, 0x00, 0x64,
+    0x11, 0x00, 0x84, 0x0a, 0x00, 0xf0, 0x19, 0x00, 0x54, 0x07, 0x00, 0x2c, 0x02, 0x00, 0x04, 0x04,
+    0x00, 0x54, 0x01, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x2c, 0x00, 0x00, 0x78, 0x03, 0x00, 0x58, 0x13,
+    0x04, 0x5c, 0x02, 0x00, 0x50, 0x00, 0x00, 0xb0, 0x03, 0x00, 0xe4, 0x16, 0x00, 0xe8, 0x0b, 0x00,
+    0xb8, 0x01, 0x00, 0xa4, 0x03, 0x00, 0xc4, 0x01, 0x0f, 0x50, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x29,
+    0x01, 0x8c, 0x00, 0x12, 0xf5, 0x70, 0x46, 0x00, 0x30, 0x1e, 0x00, 0x08, 0x08, 0x00, 0x6c, 0x12,
+    0x01, 0x84, 0x07, 0x12, 0xd7, 0x98, 0x07, 0x00, 0x14, 0x07, 0x00, 0x10, 0x02, 0x0f, 0x8c, 0x00,
+    0x0d, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x01, 0x00, 0x48, 0x08, 0x00, 0xb8, 0x12,
+    0x00, 0xd8, 0x0b, 0x00, 0x68, 0x57, 0x00, 0xc8, 0x19, 0x00, 0x9c, 0x25, 0x01, 0x2c, 0x3c, 0x03,
+    0xd8, 0x0b, 0x00, 0x10, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x58, 0x13, 0x00, 0x6c, 0x29, 0x00, 0x94,
+    0x17, 0x00, 0xbc, 0x04, 0x00, 0x74, 0x02, 0x00, 0x74, 0x00, 0x00, 0x9c, 0x00, 0x0f, 0x54, 0x01,
+    0x15, 0x00, 0x04, 0x01, 0x00, 0xa4, 0x00, 0x00, 0x30, 0x00, 0x0f, 0x08, 0x0f, 0x25, 0x00, 0x44,
+    0x00, 0x0f, 0x04, 0x00, 0x55, 0x00, 0xdc, 0x00, 0x04, 0x04, 0x02, 0x00, 0x00, 0x10, 0x00, 0xa4,
+    0x14, 0x00, 0xd4, 0x0d, 0x00, 0xd8, 0x0b, 0x00, 0x64, 0x13, 0x03, 0x70, 0xb6, 0x0f, 0x8c, 0x16,
+    0x45, 0x00, 0x7c, 0x07, 0x04, 0x04, 0x00, 0x00, 0x34, 0x95, 0x00, 0xa8, 0x96, 0x00, 0xc0, 0x7a,
+    0x0f, 0x84, 0x07, 0x7a, 0x00, 0x4c, 0x02, 0x00, 0x04, 0x00, 0x00, 0x28, 0x01, 0x00, 0xbc, 0x15,
+    0x00, 0xf4, 0x4a, 0x00, 0x00, 0x1a, 0x00, 0x78, 0x06, 0x00, 0x3c, 0x12, 0x00, 0x1c, 0x27, 0x00,
+    0x44, 0x27, 0x00, 0xb8, 0x02, 0x00, 0x20, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x30, 0x00, 0x00, 0x08,
+    0x00, 0x0f, 0x04, 0x00, 0x61, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0xbc, 0x03, 0x00, 0xfc,
+    0x0d, 0x00, 0xdc, 0x46, 0x00, 0x30, 0x17, 0x00, 0x74, 0x05, 0x00, 0x44, 0x05, 0x0c, 0xb0, 0x0e,
+    0x00, 0xe0, 0x03, 0x00, 0x34, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x08, 0x04, 0x07, 0x84, 0x07, 0x02,
+    0x98, 0xb5, 0x03, 0x70, 0x04, 0x04, 0xb8, 0x0a, 0x01, 0x00, 0x25, 0x03, 0xcc, 0x0a, 0x00, 0xc0,
+    0x0a, 0x40, 0x51, 0xc5, 0xff, 0x01, 0x04, 0x01, 0x00, 0x88, 0x04, 0x00, 0xd0, 0x0b, 0x00, 0x34,
+    0x0e, 0x00, 0x7c, 0x03, 0x00, 0xfc, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00,
+    0x09, 0x00, 0xac, 0x00, 0x00, 0x28, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x28, 0x07, 0x0f, 0x84, 0x07,
+    0x1c, 0x0a, 0xa4, 0x00, 0x00, 0xac, 0x00, 0x04, 0x04, 0x00, 0x03, 0xa4, 0x00, 0x00, 0xac, 0x0c,
+    0x40, 0x69, 0xcf, 0xff, 0x01, 0x80, 0x06, 0x00, 0x64, 0x00, 0x00, 0x70, 0x00, 0x00, 0xf0, 0x00,
+    0x0f, 0x94, 0x00, 0x09, 0x0c, 0x1c, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0xc4, 0x07,
+    0x00, 0x68, 0x4a, 0x00, 0x54, 0x01, 0x00, 0x60, 0x0f, 0x01, 0x84, 0x07, 0x1f, 0xb2, 0x84, 0x07,
+    0x67, 0x00, 0x38, 0x01, 0x00, 0x98, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x94, 0x11, 0x00, 0xc0,
+    0x00, 0x0f, 0x08, 0x0f, 0x01, 0x0f, 0x84, 0x07, 0xff, 0x2e, 0x00, 0x3c, 0x2a, 0x00, 0x30, 0x07,
+    0x00, 0x08, 0x04, 0x00, 0x70, 0x21, 0x00, 0xc4, 0x15, 0x00, 0x00, 0x1a, 0x00, 0x38, 0x06, 0x0c,
+    0x44, 0x02, 0x0f, 0x10, 0x00, 0x05, 0x00, 0x9c, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x38, 0x03, 0x04,
+    0x0c, 0x1c, 0x00, 0xb0, 0x03, 0x00, 0xd8, 0x0b, 0x00, 0x10, 0x03, 0x0f, 0xb4, 0x02, 0x25, 0x00,
+    0x54, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x08, 0x06, 0x00, 0x20, 0x02, 0x00, 0xc4, 0x29, 0x00,
+    0xc8, 0x04, 0x00, 0x04, 0x04, 0x00, 0x68, 0x28, 0x00, 0x00, 0x21, 0x00, 0x94, 0x25, 0x00, 0x24,
+    0x16, 0x0f, 0x84, 0x07, 0x1a, 0x03, 0x90, 0x3f, 0x00, 0x08, 0x01, 0x00, 0x3c, 0x0d, 0x00, 0x40,
+    0x12, 0x00, 0xc4, 0x48, 0x00, 0x7c, 0x26, 0x00, 0x94, 0x16, 0x00, 0xe4, 0x37, 0x00, 0xb0, 0x21,
+    0x01, 0x4c, 0x04, 0x03, 0x88, 0x07, 0x01, 0x0c, 0x00, 0x12, 0xb4, 0x3c, 0xbf, 0x00, 0x84, 0x06,
+    0x00, 0x74, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x70, 0x05, 0x00, 0x78, 0x03, 0x00, 0xa0, 0x0f, 0x0f,
+    0xd0, 0x00, 0x09, 0x08, 0x0c, 0x03, 0x00, 0x34, 0x13, 0x00, 0x2c, 0x00, 0x00, 0xc4, 0x07, 0x00,
+    0xa8, 0x05, 0x00, 0xe8, 0x16, 0x0f, 0x94, 0x25, 0x09, 0x00, 0x2c, 0x00, 0x0f, 0x04, 0x00, 0x5d,
+    0x00, 0xb0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x2c, 0x05, 0x00, 0xb8, 0x0b, 0x00, 0xdc, 0x25, 0x40,
+    0x89, 0xdf, 0xff, 0x01, 0x34, 0x0d, 0x00, 0x70, 0x2a, 0x00, 0xcc, 0x22, 0x03, 0x84, 0x07, 0x00,
+    0xd8, 0xb2, 0x0f, 0xa4, 0x7b, 0x51, 0x00, 0x7c, 0x3c, 0x00, 0x64, 0xa4, 0x32, 0x52, 0x58, 0xbe,
+    0xb4, 0x73, 0x00, 0x80, 0x00, 0x0f, 0x08, 0x0f, 0x71, 0x04, 0xe0, 0x04, 0x00, 0x2c, 0x01, 0x00,
+    0x64, 0x03, 0x00, 0x28, 0x03, 0x00, 0x74, 0x03, 0x00, 0xbc, 0x2f, 0x00, 0xac, 0x02, 0x00, 0xe8,
+    0x06, 0x00, 0x30, 0x1c, 0x00, 0x74, 0x09, 0x00, 0x24, 0x00, 0x00, 0x58, 0x01, 0x04, 0x60, 0x01,
+    0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x5d, 0x00, 0xd4, 0x03, 0x00, 0xb4, 0x00, 0x00, 0xbc, 0x03,
+    0x00, 0x9c, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x98, 0x24, 0x00, 0xb0, 0x0e, 0x01, 0x84, 0x07, 0x12,
+    0xf1, 0x20, 0x00, 0x00, 0x9c, 0x05, 0x00, 0x9c, 0x00, 0x00, 0xac, 0x00, 0x00, 0x34, 0x00, 0x0f,
+    0x84, 0x07, 0x0e, 0x04, 0xdc, 0x06, 0x07, 0x08, 0x00, 0x00, 0x14, 0x25, 0x40, 0x3a, 0xbd, 0xff,
+    0x01, 0xc8, 0x40, 0x00, 0x74, 0x28, 0x00, 0xc4, 0x09, 0x00, 0x9c, 0x2d, 0x00, 0x8c, 0x08, 0x00,
+    0x88, 0x0a, 0x00, 0x68, 0x00, 0x00, 0x64, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x24, 0x00, 0x00,
+    0x84, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x74, 0x04, 0x0f, 0x84, 0x07, 0x8d, 0x00, 0x54, 0x01, 0x0f,
+    0x84, 0x07, 0x99, 0x00, 0x90, 0x04, 0x00, 0xe0, 0x01, 0x00, 0x64, 0x05, 0x00, 0x5c, 0x0c, 0x00,
+    0x3c, 0x15, 0x00, 0xa8, 0x31, 0x00, 0x24, 0x1b, 0x00, 0xa0, 0x04, 0x00, 0xa8, 0x04, 0x00, 0xa0,
+    0x01, 0x00, 0x24, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x04, 0x18, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x40, 0x02, 0x00, 0xcc, 0x09, 0x0f, 0x08, 0x0f, 0xf5, 0x00, 0xa0, 0x04, 0x00, 0x40, 0x3a,
+    0x00, 0x44, 0x15, 0x00, 0x14, 0x13, 0x00, 0xd4, 0x08, 0x00, 0xf8, 0x0d, 0x00, 0x6c, 0x01, 0x00,
+    0x48, 0x01, 0x00, 0xdc, 0x02, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x88, 0x03, 0x00,
+    0x28, 0x00, 0x00, 0x1c, 0x0b, 0x00, 0x60, 0x01, 0x00, 0x0c, 0x32, 0x00, 0xb0, 0x03, 0x00, 0x64,
+    0x02, 0x00, 0xd8, 0x07, 0x00, 0x18, 0x03, 0x00, 0x84, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x48, 0x00,
+    0x09, 0x0f, 0x1c, 0x00, 0x21, 0x00, 0x78, 0x03, 0x00, 0x7c, 0x00, 0x00, 0x2c, 0x07, 0x00, 0xc8,
+    0x0f, 0x00, 0x80, 0x03, 0x00, 0xdc, 0x04, 0x00, 0xd4, 0x11, 0x00, 0x84, 0x00, 0x00, 0x00, 0x31,
+    0x00, 0x0c, 0x0f, 0x00, 0x98, 0x4f, 0x0f, 0x84, 0x07, 0x19, 0x04, 0x8c, 0x00, 0x00, 0xdc, 0x07,
+    0x00, 0xc0, 0x00, 0x00, 0x24, 0x13, 0x00, 0x7c, 0x02, 0x00, 0x44, 0x31, 0x00, 0x68, 0x83, 0x00,
+    0x6c, 0x4c, 0x00, 0xd4, 0x28, 0x01, 0x78, 0x07, 0x0b, 0x84, 0x07, 0x00, 0x8c, 0x3d, 0x00, 0xe4,
+    0x28, 0x00, 0x64, 0x23, 0x00, 0x00, 0x34, 0x00, 0x14, 0x01, 0x00, 0x78, 0x05, 0x00, 0x88, 0x12,
+    0x00, 0x58, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x04, 0xcc, 0x00, 0x00,
+    0x28, 0x01, 0x00, 0xf4, 0x02, 0x00, 0x10, 0x00, 0x00, 0xb4, 0x02, 0x00, 0xe4, 0x02, 0x00, 0xfc,
+    0x07, 0x00, 0x04, 0x21, 0x00, 0x04, 0x12, 0x00, 0x88, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x48, 0x00,
+    0x00, 0x04, 0x00, 0x0c, 0x48, 0x00, 0x0f, 0x10, 0x00, 0x55, 0x00, 0x7c, 0x00, 0x00, 0x20, 0x01,
+    0x00, 0xb4, 0x09, 0x00, 0x14, 0x20, 0x00, 0x58, 0x33, 0x40, 0x6a, 0xcf, 0xff, 0x01, 0xf4, 0x08,
+    0x00, 0x20, 0x1f, 0x10, 0x14, 0xf4, 0x4d, 0x00, 0x48, 0x0c, 0x02, 0x38, 0xa1, 0x00, 0xd4, 0x87,
+    0x00, 0xcc, 0x3b, 0x04, 0xb4, 0x0e, 0x0f, 0x08, 0x00, 0x41, 0x5f, 0xbc, 0xca, 0xe5, 0xff, 0x8e,
+    0x08, 0x0f, 0x7d, 0x00, 0x48, 0x06, 0x00, 0x04, 0x00, 0x00, 0xa4, 0x02, 0x00, 0xd0, 0x01, 0x00,
+    0x80, 0x05, 0x00, 0xc0, 0x27, 0x00, 0xbc, 0x3e, 0x00, 0x34, 0x12, 0x00, 0x40, 0x21, 0x00, 0xc0,
+    0x08, 0x00, 0xc4, 0x0a, 0x00, 0x24, 0x02, 0x00, 0xc8, 0x06, 0x0f, 0xc4, 0x01, 0x55, 0x0f, 0x68,
+    0x00, 0x01, 0x00, 0xac, 0x00, 0x00, 0x04, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x74,
+    0x05, 0x00, 0x5c, 0x21, 0x00, 0xdc, 0x06, 0x00, 0x10, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x3c, 0x00,
+    0x00, 0x04, 0x02, 0x01, 0x08, 0x00, 0x03, 0xcc, 0x2f, 0x00, 0xbc, 0x00, 0x0b, 0x08, 0x0f, 0x04,
+    0x28, 0x91, 0x31, 0x10, 0x13, 0xb6, 0xb4, 0x2e, 0x31, 0x31, 0x36, 0xb8, 0xac, 0xf4, 0x00, 0x38,
+    0x27, 0x00, 0x58, 0xa0, 0x32, 0x0e, 0x17, 0xb6, 0x5c, 0x12, 0x00, 0x58, 0x45, 0x00, 0xb4, 0x03,
+    0x00, 0x70, 0x2d, 0x00, 0x64, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x60, 0x02, 0x04, 0x64, 0x00, 0x00,
+    0x68, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x30, 0x03, 0x00, 0xac, 0x03, 0x00,
+    0x04, 0x04, 0x00, 0xa8, 0x00, 0x00, 0x2c, 0x15, 0x00, 0x08, 0x04, 0x00, 0x80, 0x03, 0x00, 0x5c,
+    0x01, 0x00, 0x20, 0x00, 0x00, 0x58, 0x03, 0x00, 0x0c, 0x0b, 0x00, 0x90, 0x03, 0x00, 0xdc, 0x12,
+    0x00, 0x1c, 0x04, 0x00, 0x04, 0x08, 0x01, 0xcc, 0xcc, 0x51, 0xb4, 0xff, 0x13, 0x16, 0xb6, 0xec,
+    0xb2, 0x00, 0x48, 0xd4, 0x00, 0x60, 0x8a, 0x90, 0x2f, 0x2d, 0xb7, 0xff, 0x20, 0x1f, 0xb6, 0xff,
+    0x0b, 0x8c, 0x47, 0x00, 0x88, 0x08, 0x00, 0xa8, 0x0f, 0x00, 0x28, 0x09, 0x00, 0x1c, 0x01, 0x00,
+    0x24, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x94, 0x00, 0x05, 0x0c, 0x18, 0x00, 0x00, 0xd8, 0x03, 0x00,
+    0x14, 0x00, 0x00, 0x3c, 0x01, 0x00, 0xfc, 0x2c, 0x00, 0x50, 0x00, 0x0f, 0x08, 0x0f, 0x6d, 0x00,
+    0x60, 0x01, 0x00, 0x10, 0x01, 0x00, 0xf8, 0x09, 0x00, 0x7c, 0x02, 0x0f, 0x04, 0x00, 0x05, 0x00,
+    0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x94, 0x01, 0x00, 0xc0, 0x02, 0x00, 0x1c, 0x2a, 0x00, 0x34,
+    0x09, 0x00, 0xc0, 0x02, 0x00, 0x3c, 0x17, 0x00, 0x60, 0x01, 0x00, 0xdc, 0x00, 0x00, 0x88, 0x01,
+    0x00, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x40, 0x00, 0x00, 0x90, 0x01, 0x0f,
+    0x84, 0x07, 0xf2, 0x03, 0x38, 0x06, 0x00, 0x44, 0x15, 0x00, 0x18, 0x2f, 0x00, 0x94, 0x08, 0x00,
+    0xb4, 0x02, 0x00, 0xc4, 0x0c, 0x00, 0xe4, 0x05, 0x00, 0xb8, 0x0d, 0x00, 0x48, 0x01, 0x0f, 0x54,
+    0x01, 0x05, 0x00, 0x1c, 0x00, 0x04, 0x04, 0x00, 0x04, 0x24, 0x00, 0x00, 0x88, 0x01, 0x00, 0x3c,
+    0x03, 0x00, 0x38, 0x19, 0x00, 0xb0, 0x03, 0x00, 0xd4, 0x0a, 0x00, 0x6c, 0x02, 0x00, 0x78, 0x01,
+    0x04, 0xb4, 0x02, 0x04, 0x34, 0x00, 0x0f, 0x08, 0x00, 0x35, 0x00, 0x7c, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x20, 0x02, 0x00, 0x64, 0x07, 0x00, 0x24, 0x07, 0x00, 0xdc, 0x04, 0x00, 0x7c, 0x07, 0x00,
+    0xec, 0x61, 0x00, 0xfc, 0x2d, 0x00, 0xe0, 0x37, 0x00, 0x5c, 0x3e, 0x00, 0x20, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x10, 0x02, 0x00, 0x34, 0x00, 0x0f, 0x84, 0x00, 0x15, 0x00, 0x58, 0x04, 0x00, 0xc0,
+    0x1b, 0x00, 0xe0, 0x00, 0x00, 0x4c, 0x32, 0x00, 0xa0, 0x25, 0x00, 0x2c, 0x01, 0x00, 0x38, 0x04,
+    0x01, 0x48, 0x12, 0x00, 0xd4, 0x0b, 0x03, 0x50, 0x01, 0x00, 0x6c, 0x13, 0x00, 0x50, 0x53, 0x00,
+    0x8c, 0x2b, 0x00, 0x64, 0x10, 0x00, 0x10, 0x0e, 0x00, 0x40, 0x0f, 0x00, 0x78, 0x14, 0x00, 0x20,
+    0x04, 0x00, 0x74, 0x00, 0x0f, 0x7c, 0x00, 0x01, 0x08, 0x0c, 0x03, 0x00, 0xcc, 0x00, 0x00, 0xa8,
+    0x00, 0x00, 0xe0, 0x17, 0x00, 0xfc, 0x07, 0x00, 0xa4, 0x43, 0x00, 0xb4, 0x22, 0x00, 0x4c, 0x29,
+    0x00, 0xe4, 0x16, 0x00, 0x84, 0x00, 0x0f, 0x84, 0x07, 0x79, 0x00, 0xfc, 0x08, 0x00, 0x58, 0x03,
+    0x00, 0x74, 0x09, 0x00, 0x60, 0x55, 0x00, 0xc8, 0x63, 0xa1, 0x16, 0xb7, 0xff, 0x0e, 0x16, 0xb6,
+    0xff, 0x0e, 0x0f, 0xb5, 0x08, 0xd2, 0x00, 0xec, 0xd0, 0x00, 0xcc, 0xae, 0x2f, 0xb9, 0xc7, 0x24,
+    0x5a, 0x33, 0x0f, 0xc0, 0x07, 0x05, 0x00, 0xa8, 0x34, 0x0f, 0x84, 0x07, 0x6e, 0x00, 0xec, 0x05,
+    0x00, 0xe4, 0x01, 0x04, 0x04, 0x00, 0x00, 0x40, 0x02, 0x00, 0xfc, 0x01, 0x00, 0xcc, 0x01, 0x00,
+    0x5c, 0x03, 0x00, 0x24, 0x0a, 0x00, 0xa0, 0x3f, 0x00, 0xa8, 0x09, 0x00, 0x28, 0x03, 0x00, 0xcc,
+    0x28, 0x00, 0x30, 0x11, 0x00, 0x20, 0x00, 0x00, 0xfc, 0x0d, 0x00, 0x14, 0x05, 0x04, 0x3c, 0x00,
+    0x04, 0x08, 0x00, 0x00, 0x38, 0x02, 0x0f, 0x04, 0x00, 0x45, 0x0f, 0xb0, 0x00, 0x01, 0x00, 0x88,
+    0x00, 0x00, 0x90, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x24, 0x08, 0x00, 0x28, 0x16, 0x00, 0x9c, 0x33,
+    0x00, 0xc0, 0x3a, 0x00, 0xd4, 0x36, 0x00, 0xd0, 0x00, 0x00, 0x90, 0x00, 0x00, 0xa0, 0x00, 0x01,
+    0x08, 0x00, 0x0f, 0x84, 0x07, 0x04, 0x01, 0x0c, 0x11, 0x00, 0x88, 0x09, 0x51, 0xb4, 0xff, 0x2b,
+    0x30, 0xb8, 0x1c, 0x09, 0x00, 0x94, 0x9e, 0x00, 0x38, 0x9a, 0x00, 0x40, 0xa9, 0x31, 0x4d, 0x53,
+    0xbd, 0xf4, 0x06, 0x02, 0x38, 0x18, 0x12, 0xb3, 0x88, 0x07, 0x00, 0x70, 0x0a, 0x00, 0x0c, 0x0c,
+    0x00, 0xec, 0x06, 0x00, 0x5c, 0x00, 0x00, 0x38, 0x07, 0x00, 0x68, 0x00, 0x0f, 0x04, 0x00, 0x09,
+    0x00, 0x08, 0x0c, 0x00, 0xd8, 0x03, 0x00, 0x98, 0x00, 0x00, 0x4c, 0x01, 0x00, 0xc8, 0x07, 0x00,
+    0xa4, 0x03, 0x0f, 0x84, 0x07, 0x11, 0x00, 0x1c, 0x81, 0xe1, 0x00, 0xb3, 0xff, 0x05, 0x00, 0xb5,
+    0xff, 0x30, 0x35, 0xb8, 0xff, 0x54, 0x5c, 0xbf, 0xd8, 0x64, 0x00, 0xa4, 0x00, 0xb2, 0x65, 0x6b,
+    0xc2, 0xff, 0x48, 0x4d, 0xbc, 0xff, 0x21, 0x3c, 0xbc, 0xb4, 0x01, 0x00, 0x64, 0x22, 0x00, 0xc4,
+    0x01, 0x00, 0x1c, 0x01, 0x00, 0x24, 0x01, 0x00, 0xa8, 0x03, 0x00, 0xa4, 0x00, 0x0f, 0x04, 0x00,
+    0x11, 0x00, 0xa0, 0x00, 0x00, 0x28, 0x00, 0x0f, 0x84, 0x07, 0x41, 0x0c, 0xc4, 0x01, 0x0f, 0x2c,
+    0x01, 0x09, 0x04, 0x1c, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x6c, 0x04, 0x00, 0xc4, 0x12, 0x00, 0x94,
+    0x08, 0x00, 0x7c, 0x10, 0x00, 0x4c, 0x0b, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x58, 0x73, 0x00, 0x18,
+    0x00, 0x00, 0x5c, 0x1c, 0x00, 0x14, 0x0c, 0x00, 0x04, 0x05, 0x00, 0x50, 0x6e, 0x00, 0xc8, 0x08,
+    0x00, 0x90, 0x04, 0x0f, 0x30, 0x06, 0x0d, 0x04, 0xfc, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x2c, 0x04,
+    0x0f, 0x84, 0x07, 0xf9, 0x00, 0x34, 0x06, 0x01, 0xcc, 0x0d, 0x12, 0xb4, 0x80, 0x2f, 0x00, 0x9c,
+    0x09, 0x00, 0x38, 0x07, 0x00, 0x28, 0x02, 0x00, 0xac, 0x01, 0x04, 0x3c, 0x01, 0x00, 0xb0, 0x01,
+    0x0f, 0x04, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x16,
+    0x00, 0x54, 0x70, 0x00, 0xb0, 0x03, 0x00, 0x90, 0x1d, 0x00, 0xb0, 0x01, 0x00, 0xa4, 0x01, 0x0f,
+    0xb4, 0x02, 0x21, 0x00, 0x54, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x7c, 0x00, 0x00, 0xa4, 0x00,
+    0x00, 0x0c, 0x03, 0x00, 0xc4, 0x5a, 0x00, 0xd0, 0x04, 0x00, 0x08, 0x17, 0x01, 0xd8, 0x00, 0x12,
+    0xb1, 0x8c, 0x96, 0x0f, 0x84, 0x07, 0x2d, 0x08, 0x64, 0x00, 0x00, 0xac, 0x02, 0x00, 0x78, 0x02,
+    0x00, 0x54, 0x00, 0x03, 0xbc, 0x03, 0x02, 0x40, 0x04, 0x07, 0x84, 0x07, 0x01, 0x7c, 0x00, 0x02,
+    0x78, 0x04, 0x01, 0x08, 0x52, 0x00, 0x10, 0x04, 0x00, 0x18, 0x04, 0x00, 0x20, 0x01, 0x01, 0x4c,
+    0x00, 0x03, 0x88, 0x55, 0x00, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe4, 0x00, 0x01, 0x0c, 0x03,
+    0x12, 0xef, 0xb4, 0x1e, 0x00, 0x0c, 0x03, 0x04, 0xf4, 0x02, 0x00, 0x38, 0x00, 0x00, 0xac, 0x14,
+    0x00, 0x7c, 0x07, 0x00, 0x60, 0x1f, 0x00, 0xe8, 0x26, 0x00, 0x4c, 0x08, 0x00, 0x30, 0x00, 0x04,
+    0x78, 0x03, 0x00, 0x40, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x04, 0x38, 0x00, 0x00, 0x7c, 0x00, 0x05,
+    0x04, 0x00, 0x03, 0xc0, 0x29, 0x0f, 0x48, 0x00, 0x15, 0x00, 0x44, 0x00, 0x00, 0x78, 0x01, 0x00,
+    0x3c, 0x08, 0x00, 0xac, 0x17, 0x00, 0xf0, 0x24, 0x00, 0xd4, 0x18, 0x00, 0x58, 0x11, 0x03, 0x98,
+    0x08, 0x00, 0x18, 0x98, 0x00, 0x6c, 0xa7, 0x13, 0x66, 0xcc, 0xbb, 0x00, 0x14, 0x5d, 0x00, 0xbc,
+    0xb7, 0x0f, 0x40, 0x07, 0x05, 0x0f, 0x18, 0x00, 0x31, 0x0f, 0x84, 0x07, 0x6e, 0x00, 0x18, 0x01,
+    0x00, 0x54, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x18, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x5c, 0x0c, 0x00,
+    0x38, 0x02, 0x00, 0x7c, 0x04, 0x00, 0xcc, 0x06, 0x00, 0x20, 0x11, 0x00, 0xe8, 0x4d, 0x00, 0xcc,
+    0x6c, 0x00, 0x14, 0x52, 0x00, 0x10, 0x00, 0x00, 0xa8, 0x09, 0x00, 0x20, 0x00, 0x00, 0x70, 0x76,
+    0x00, 0x7c, 0x09, 0x00, 0x38, 0x00, 0x00, 0x40, 0x00, 0x00, 0x48, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x04, 0x00, 0x0f, 0x9c, 0x01, 0x15, 0x0f, 0x28, 0x00, 0x19, 0x0f, 0xb0, 0x00, 0x05, 0x00, 0x64,
+    0x02, 0x00, 0x7c, 0x25, 0x00, 0x74, 0x06, 0x00, 0x34, 0x08, 0x00, 0xac, 0x1e, 0x00, 0xf0, 0x0c,
+    0x00, 0x80, 0x07, 0x00, 0x74, 0x09, 0x00, 0x80, 0x02, 0x00, 0x68, 0x00, 0x00, 0x40, 0x00, 0x04,
+    0x08, 0x00, 0x00, 0xac, 0x00, 0x00, 0x70, 0x08, 0x08, 0x08, 0x0f, 0x01, 0x90, 0x31, 0x00, 0xc8,
+    0x46, 0x11, 0xb4, 0x20, 0xfc, 0x00, 0x78, 0xaf, 0x00, 0xac, 0x75, 0x00, 0xa4, 0xbc, 0x00, 0xd8,
+    0xbf, 0x33, 0x6e, 0x77, 0xc5, 0x44, 0x82, 0x00, 0x30, 0x03, 0x03, 0x30, 0x92, 0x00, 0xc8, 0x19,
+    0x04, 0x84, 0x07, 0x00, 0x60, 0x00, 0x00, 0x84, 0x07, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x01, 0x0f,
+    0x04, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x24, 0x00, 0x00, 0x9c, 0x0a, 0x00, 0x34, 0x03, 0x00,
+    0xb8, 0x0f, 0x0f, 0x84, 0x07, 0x15, 0x01, 0x18, 0x89, 0x51, 0xb2, 0xff, 0x0b, 0x02, 0xb5, 0x7c,
+    0xbe, 0x31, 0x79, 0x82, 0xc9, 0xf8, 0xb8, 0x00, 0xec, 0x73, 0xf2, 0x00, 0x8f, 0x99, 0xd0, 0xff,
+    0x68, 0x70, 0xc4, 0xff, 0x33, 0x42, 0xbc, 0xff, 0x00, 0x3e, 0xbf, 0xe0, 0x0b, 0x00, 0xc4, 0x01,
+    0x00, 0xac, 0x01, 0x00, 0x24, 0x01, 0x00, 0x70, 0x00, 0x01, 0x00, 0x01, 0x0f, 0x48, 0x5a, 0x10,
+    0x00, 0xa8, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x5c, 0x05, 0x00, 0x64, 0x05, 0x00, 0x6c, 0x05, 0x0f,
+    0x08, 0x0f, 0x31, 0x00, 0x24, 0x01, 0x0f, 0x18, 0x01, 0x01, 0x0f, 0x14, 0x00, 0x05, 0x00, 0x88,
+    0x00, 0x00, 0x5c, 0x02, 0x04, 0x8c, 0x00, 0x00, 0x5c, 0x07, 0x00, 0xc0, 0x03, 0x00, 0x3c, 0x05,
+    0x00, 0x68, 0x04, 0x00, 0xe0, 0x00, 0x00, 0x90, 0x02, 0x00, 0xc0, 0x05, 0x00, 0x08, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x04, 0x10, 0x02, 0x00, 0x04,
+    0x01, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x1c, 0x0c, 0x10, 0x02, 0x00, 0x5c, 0x00, 0x08, 0x04, 0x00,
+    0x00, 0x74, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x84, 0x07, 0xf9, 0x00, 0x64, 0x51, 0x01, 0x2c, 0x06,
+    0x00, 0x3c, 0x06, 0x00, 0x00, 0x03, 0x12, 0xb3, 0x0c, 0x0f, 0x00, 0xb4, 0x46, 0x00, 0x20, 0x02,
+    0x00, 0xd8, 0x08, 0x00, 0xc4, 0x01, 0x04, 0xac, 0x01, 0x00, 0x40, 0x01, 0x0f, 0x04, 0x00, 0x05,
+    0x00, 0x04, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x88, 0x01, 0x00, 0xa0, 0x03, 0x00, 0x98, 0x01, 0x00,
+    0xb0, 0x03, 0x00, 0xb8, 0x03, 0x00, 0xc4, 0x03, 0x00, 0x84, 0x0e, 0x00, 0xb0, 0x01, 0x0f, 0xb4,
+    0x02, 0x1d, 0x00, 0x54, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0xdc, 0x01, 0x00, 0xa4, 0x00, 0x00,
+    0x84, 0x07, 0x00, 0xd0, 0x13, 0x00, 0xc0, 0x2c, 0x00, 0xb0, 0x1d, 0x01, 0x58, 0x08, 0x12, 0xb1,
+    0x28, 0x6a, 0x00, 0x30, 0x07, 0x00, 0x84, 0x00, 0x00, 0x80, 0x00, 0x00, 0x28, 0x00, 0x00, 0x34,
+    0x00, 0x00, 0xdc, 0x00, 0x0f, 0x5c, 0x00, 0x0d, 0x04, 0x20, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x64,
+    0x00, 0x00, 0x60, 0x04, 0x00, 0x74, 0x24, 0x00, 0x0c, 0x0c, 0x07, 0xc4, 0x12, 0x05, 0x84, 0x07,
+    0x0f, 0x54, 0x01, 0x01, 0x00, 0x64, 0x03, 0x00, 0x18, 0x10, 0x00, 0x18, 0x04, 0x00, 0x84, 0x07,
+    0x00, 0x7c, 0x00, 0x04, 0x30, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x68, 0x00, 0x00,
+    0x98, 0x03, 0x00, 0x38, 0x01, 0x00, 0x70, 0x07, 0x00, 0xc4, 0x00, 0x00, 0xc4, 0x16, 0x00, 0xfc,
+    0x02, 0x00, 0x38, 0x50, 0x00, 0xd4, 0x08, 0x00, 0x7c, 0x07, 0x00, 0x04, 0x12, 0x04, 0xb0, 0x22,
+    0x00, 0x2c, 0x0d, 0x00, 0x38, 0x00, 0x04, 0x7c, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x11,
+    0x00, 0x30, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00, 0x04,
+    0x04, 0x00, 0x0f, 0x40, 0x00, 0x11, 0x04, 0x24, 0x00, 0x00, 0x48, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x84, 0x07, 0x04, 0x74, 0x05, 0x00, 0xa8, 0x0f, 0x01, 0xd8, 0x13, 0x00, 0x74, 0x05, 0x02, 0x24,
+    0x5a, 0x00, 0x80, 0x55, 0x33, 0x93, 0x9e, 0xd3, 0xcc, 0xbb, 0x0f, 0xc8, 0xf3, 0x3f, 0x0c, 0xb8,
+    0x07, 0x0f, 0x84, 0x07, 0x6a, 0x00, 0x98, 0x14, 0x00, 0x24, 0x02, 0x00, 0x64, 0x02, 0x00, 0x04,
+    0x00, 0x04, 0x0c, 0x00, 0x00, 0xd0, 0x0d, 0x00, 0xbc, 0x01, 0x00, 0x80, 0x16, 0x00, 0x18, 0x11,
+    0x00, 0xec, 0x0a, 0x00, 0x34, 0x47, 0x00, 0xc4, 0x09, 0x00, 0xb8, 0x18, 0x00, 0x1c, 0x2b, 0x00,
+    0x30, 0x06, 0x00, 0x38, 0x3a, 0x00, 0x48, 0x12, 0x00, 0x44, 0x03, 0x00, 0x4c, 0x03, 0x04, 0x40,
+    0x00, 0x04, 0x4c, 0x00, 0x00, 0x60, 0x00, 0x04, 0x80, 0x01, 0x0f, 0x08, 0x00, 0x31, 0x00, 0x50,
+    0x00, 0x09, 0x64, 0x00, 0x12, 0xf5, 0x70, 0x3f, 0x00, 0x28, 0x05, 0x00, 0x44, 0x1a, 0x00, 0x80,
+    0x02, 0x00, 0x10, 0x04, 0x00, 0x7c, 0x05, 0x00, 0x98, 0x00, 0x00, 0x48, 0x0b, 0x00, 0xc4, 0x02,
+    0x00, 0x90, 0x00, 0x00, 0xf8, 0x01, 0x08, 0x84, 0x00, 0x04, 0x10, 0x02, 0x00, 0x50, 0x00, 0x04,
+    0x10, 0x02, 0x00, 0xc4, 0x28, 0x00, 0xe8, 0x00, 0x00, 0x94, 0x1f, 0x21, 0x00, 0xb4, 0x7c, 0xbc,
+    0x00, 0x70, 0xa9, 0x80, 0xb2, 0xbf, 0xe0, 0xff, 0xbf, 0xce, 0xe7, 0xff, 0xd4, 0x3d, 0x00, 0xe8,
+    0xcc, 0x02, 0xe0, 0x4c, 0x00, 0x84, 0x04, 0x03, 0xac, 0xdb, 0x00, 0x94, 0x08, 0x00, 0x7c, 0x0f,
+    0x00, 0x70, 0x00, 0x0c, 0x08, 0x01, 0x00, 0x7c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x78, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0xd4, 0x0d, 0x00, 0xac, 0x00, 0x00, 0x94, 0x11, 0x00, 0x40, 0x21, 0x0f,
+    0x08, 0x0f, 0x11, 0x10, 0x13, 0x34, 0x19, 0x91, 0xb2, 0xff, 0x0f, 0x07, 0xb5, 0xff, 0x56, 0x5d,
+    0xbf, 0x50, 0x20, 0x00, 0x34, 0x19, 0xf2, 0x08, 0xbf, 0xce, 0xe6, 0xff, 0xaa, 0xb7, 0xdc, 0xff,
+    0x7d, 0x86, 0xca, 0xff, 0x3e, 0x47, 0xbb, 0xff, 0x00, 0x10, 0xb7, 0xff, 0x00, 0x27, 0xba, 0xc4,
+    0x01, 0x00, 0x10, 0x0b, 0x00, 0xd4, 0x03, 0x00, 0xb8, 0x03, 0x00, 0x08, 0x01, 0x00, 0x44, 0x03,
+    0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x30, 0x03, 0x00, 0x20, 0x00, 0x00, 0x34, 0x00,
+    0x00, 0x64, 0x05, 0x0f, 0x84, 0x07, 0x35, 0x00, 0x8c, 0x01, 0x00, 0x10, 0x04, 0x00, 0x00, 0x01,
+    0x0f, 0x04, 0x00, 0x15, 0x00, 0x30, 0x01, 0x00, 0xec, 0x09, 0x00, 0x1c, 0x0a, 0x00, 0x6c, 0x01,
+    0x00, 0xe8, 0x01, 0x00, 0x30, 0x01, 0x00, 0x30, 0x45, 0x00, 0xec, 0x40, 0x00, 0x44, 0x05, 0x04,
+    0x04, 0x00, 0x00, 0x20, 0x18, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x1b, 0x00, 0x68, 0x0b, 0x00, 0x10,
+    0x02, 0x00, 0x94, 0x17, 0x00, 0x0c, 0x05, 0x04, 0x0c, 0x10, 0x00, 0x84, 0x00, 0x00, 0xdc, 0x00,
+    0x0f, 0x04, 0x00, 0x05, 0x04, 0xfc, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x0c, 0x06, 0x0f, 0x08, 0x0f,
+    0xff, 0x06, 0x00, 0x0c, 0x04, 0x00, 0xf4, 0x14, 0x00, 0x20, 0x31, 0x00, 0x38, 0x04, 0x00, 0xd8,
+    0x01, 0x0f, 0x54, 0x01, 0x05, 0x0f, 0x18, 0x00, 0x01, 0x00, 0x88, 0x01, 0x00, 0x04, 0x02, 0x00,
+    0x98, 0x01, 0x00, 0x88, 0x24, 0x00, 0x6c, 0x01, 0x00, 0x10, 0x0f, 0x00, 0x20, 0x1e, 0x00, 0x54,
+    0x06, 0x00, 0xb4, 0x02, 0x00, 0xdc, 0x07, 0x00, 0x3c, 0x00, 0x0f, 0xb4, 0x02, 0x11, 0x00, 0x28,
+    0x00, 0x0f, 0x04, 0x00, 0x11, 0x00, 0x78, 0x00, 0x00, 0x1c, 0x04, 0x00, 0xc4, 0x06, 0x00, 0x38,
+    0x04, 0x00, 0x30, 0x02, 0x01, 0x60, 0x08, 0x00, 0xf8, 0x9a, 0x0f, 0x84, 0x07, 0x35, 0x03, 0xb8,
+    0xa6, 0x00, 0xb4, 0x02, 0x0f, 0x08, 0x0f, 0x12, 0x00, 0xa0, 0x16, 0x03, 0x28, 0x83, 0x00, 0x34,
+    0x19, 0x00, 0x74, 0x03, 0x00, 0x80, 0x02, 0x00, 0x20, 0x01, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x4c, 0x0b, 0x00, 0x58, 0x00, 0x00, 0x8c, 0x0a, 0x00,
+    0x48, 0x26, 0x00, 0x2c, 0x3a, 0x00, 0x20, 0x0d, 0x00, 0x04, 0x03, 0x00, 0xa8, 0x1f, 0x00, 0xf8,
+    0x11, 0x00, 0xc4, 0x05, 0x00, 0x94, 0x04, 0x00, 0x40, 0x01, 0x00, 0x98, 0x04, 0x00, 0xf4, 0x00,
+    0x0f, 0x1c, 0x01, 0x11, 0x08, 0x24, 0x00, 0x0c, 0x74, 0x05, 0x00, 0x80, 0x00, 0x04, 0x04, 0x00,
+    0x00, 0x88, 0x00, 0x0f, 0x54, 0x00, 0x19, 0x04, 0x74, 0x05, 0x00, 0x34, 0x00, 0x0d, 0x08, 0x0f,
+    0x00, 0x84, 0x07, 0x51, 0xb4, 0xff, 0x4b, 0x52, 0xbd, 0xcc, 0xca, 0x00, 0xec, 0xbd, 0x3f, 0xc9,
+    0xd9, 0xec, 0x48, 0xec, 0x46, 0x08, 0x88, 0x07, 0x0f, 0x84, 0x07, 0x0a, 0x00, 0x6c, 0x04, 0x00,
+    0xb4, 0x0b, 0x00, 0x08, 0x01, 0x00, 0xfc, 0x08, 0x00, 0x84, 0x02, 0x00, 0xc8, 0x00, 0x0f, 0x04,
+    0x00, 0x2a, 0x03, 0x88, 0x57, 0x00, 0x68, 0x01, 0x00, 0x4c, 0x01, 0x00, 0x60, 0x05, 0x00, 0x84,
+    0x06, 0x00, 0xf0, 0x09, 0x00, 0x04, 0x00, 0x00, 0x34, 0x09, 0x00, 0xbc, 0x14, 0x00, 0xa0, 0x27,
+    0x00, 0xcc, 0x14, 0x00, 0xcc, 0x27, 0x01, 0x20, 0x0a, 0x03, 0x20, 0x02, 0x04, 0x0c, 0x00, 0x00,
+    0xc0, 0x17, 0x00, 0xc0, 0x2f, 0x00, 0xa4, 0x25, 0x00, 0x28, 0x03, 0x00, 0x50, 0x0a, 0x00, 0x40,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x08, 0x19, 0x00, 0x10, 0x19, 0x00, 0x68, 0x00,
+    0x01, 0xb8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x28, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0x38, 0x00,
+    0x03, 0xb4, 0x0d, 0x0f, 0xb0, 0x00, 0x05, 0x00, 0xb8, 0x12, 0x00, 0xf4, 0x09, 0x00, 0xb4, 0x03,
+    0x00, 0x18, 0x08, 0x00, 0x50, 0x93, 0x00, 0x30, 0x26, 0x00, 0xb4, 0x05, 0x00, 0x7c, 0x00, 0x00,
+    0x50, 0x05, 0x0d, 0x34, 0x01, 0x03, 0x5c, 0x56, 0x00, 0x10, 0x02, 0x00, 0x00, 0x01, 0x00, 0x4c,
+    0x0a, 0x0b, 0x84, 0x07, 0x00, 0x60, 0xcb, 0x00, 0xd0, 0x4c, 0x00, 0x00, 0xc0, 0x00, 0xb4, 0x01,
+    0x00, 0x98, 0x18, 0x00, 0x70, 0xbc, 0x00, 0xc8, 0x54, 0x02, 0x34, 0x1e, 0x03, 0x08, 0x0f, 0x00,
+    0xdc, 0x4e, 0x00, 0x94, 0x0d, 0x00, 0x08, 0x08, 0x00, 0x08, 0x01, 0x00, 0x1c, 0x03, 0x00, 0xa4,
+    0x22, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x28, 0x01, 0x00, 0x04, 0x00, 0x00, 0xa4, 0x4f, 0x00, 0x24,
+    0x0b, 0x00, 0x4c, 0x0f, 0x00, 0x4c, 0x38, 0x04, 0xd0, 0x04, 0x00, 0x40, 0x01, 0x00, 0xbc, 0x00,
+    0x00, 0xdc, 0x69, 0x00, 0xec, 0x02, 0x00, 0x40, 0x06, 0x00, 0x28, 0x00, 0x00, 0x4c, 0x0b, 0x12,
+    0x12, 0x84, 0x07, 0xb5, 0x11, 0x0a, 0xb5, 0xff, 0x5c, 0x64, 0xc1, 0xff, 0x9a, 0xa6, 0xd5, 0xec,
+    0xd0, 0x00, 0x8c, 0x07, 0x00, 0x74, 0xab, 0x00, 0xf8, 0xf9, 0x02, 0xa4, 0x00, 0x03, 0xb0, 0xe8,
+    0x00, 0xa8, 0x03, 0x00, 0x88, 0x06, 0x01, 0x58, 0x00, 0x00, 0x88, 0x17, 0x04, 0xdc, 0x12, 0x0f,
+    0x90, 0x01, 0x05, 0x03, 0x20, 0x01, 0x00, 0x84, 0x00, 0x00, 0x24, 0x02, 0x0f, 0x18, 0x2d, 0x05,
+    0x00, 0xb0, 0x00, 0x04, 0x58, 0x00, 0x00, 0xec, 0x01, 0x0f, 0xa8, 0x02, 0x02, 0x03, 0xc4, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0xcc, 0x00, 0x00, 0xfc, 0x04, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x01, 0x00,
+    0x70, 0x02, 0x01, 0x04, 0x00, 0x0f, 0x30, 0x01, 0x08, 0x00, 0x28, 0x00, 0x00, 0x70, 0x11, 0x00,
+    0xd4, 0x01, 0x00, 0x6c, 0x00, 0x00, 0x1c, 0x0a, 0x00, 0x60, 0x25, 0x00, 0x40, 0x1b, 0x01, 0x90,
+    0x02, 0x12, 0xb5, 0x3c, 0xe4, 0x00, 0x54, 0x0c, 0x00, 0xc4, 0x4b, 0x00, 0xcc, 0x10, 0x00, 0x50,
+    0x53, 0x00, 0xa4, 0x07, 0x00, 0xa0, 0x00, 0x00, 0xf0, 0x1b, 0x00, 0xac, 0x13, 0x00, 0xb8, 0x04,
+    0x00, 0x84, 0x00, 0x08, 0x10, 0x02, 0x00, 0xb4, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x24, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x04, 0x05, 0x00, 0x18, 0x06, 0x0f, 0x84, 0x07, 0xf6, 0x04, 0x08, 0x04,
+    0x00, 0x84, 0x0a, 0x12, 0xb4, 0xac, 0xde, 0x00, 0xe8, 0x08, 0x00, 0xc0, 0x24, 0x00, 0x08, 0x1a,
+    0x00, 0x5c, 0x05, 0x00, 0xe0, 0x01, 0x00, 0xac, 0x03, 0x00, 0x40, 0x01, 0x0f, 0x04, 0x00, 0x09,
+    0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x68, 0x02, 0x00, 0x88, 0x07, 0x00,
+    0x38, 0x06, 0x00, 0x04, 0x0e, 0x00, 0x5c, 0x42, 0x00, 0x68, 0x09, 0x00, 0x1c, 0x0f, 0x00, 0xb4,
+    0x02, 0x00, 0x48, 0x00, 0x00, 0x28, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0x64,
+    0x00, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x90, 0x06, 0x00, 0x54, 0x00,
+    0x00, 0xac, 0x03, 0x00, 0xf8, 0x16, 0x00, 0xf0, 0x06, 0x00, 0x30, 0x25, 0x04, 0x84, 0x07, 0x00,
+    0xbc, 0x83, 0x0f, 0x84, 0x07, 0x1d, 0x01, 0x64, 0x00, 0x08, 0x4c, 0x03, 0x03, 0x40, 0x03, 0x00,
+    0xf0, 0x02, 0x00, 0x10, 0x04, 0x0f, 0x84, 0x07, 0x19, 0x00, 0xd8, 0x08, 0x00, 0xe0, 0x1a, 0x00,
+    0xb8, 0x02, 0x00, 0x54, 0x01, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x20, 0x03, 0x00, 0x08,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x1c, 0x01, 0x00, 0xb0, 0x08, 0x00, 0x48, 0x17,
+    0x04, 0x68, 0x1e, 0x00, 0xd0, 0x4f, 0x00, 0xcc, 0x00, 0x00, 0xd4, 0x0b, 0x00, 0x14, 0x05, 0x00,
+    0x6c, 0x17, 0x00, 0xc4, 0x02, 0x00, 0xdc, 0x14, 0x00, 0xfc, 0x00, 0x00, 0x04, 0x01, 0x01, 0x04,
+    0x00, 0x08, 0xac, 0x00, 0x0c, 0x0c, 0x00, 0x03, 0xb0, 0x03, 0x00, 0x68, 0x01, 0x00, 0xc8, 0x01,
+    0x00, 0xc4, 0x07, 0x00, 0x24, 0x05, 0x00, 0x78, 0x00, 0x00, 0x34, 0x01, 0x00, 0xb0, 0x03, 0x00,
+    0x90, 0x04, 0x00, 0x74, 0x09, 0x00, 0x54, 0x03, 0x00, 0x58, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0x04,
+    0x00, 0x0d, 0x00, 0x24, 0x01, 0x00, 0xc4, 0x01, 0x00, 0x30, 0x00, 0x00, 0x28, 0x02, 0x00, 0x40,
+    0x08, 0x00, 0x3c, 0x02, 0x01, 0x8c, 0x16, 0x02, 0x84, 0x07, 0x00, 0x18, 0x25, 0x00, 0x04, 0x1e,
+    0x00, 0x44, 0xc5, 0x00, 0x74, 0x05, 0x0f, 0x04, 0x00, 0x51, 0x0f, 0x84, 0x07, 0x02, 0x00, 0x14,
+    0x20, 0x00, 0xcc, 0x08, 0x00, 0x58, 0x1f, 0x00, 0x64, 0x0e, 0x00, 0xdc, 0x00, 0x09, 0x8c, 0x10,
+    0x00, 0xe0, 0x01, 0x0f, 0x04, 0x00, 0x29, 0x00, 0x80, 0x05, 0x03, 0x20, 0x42, 0x00, 0x54, 0x01,
+    0x00, 0xc4, 0x15, 0x00, 0x24, 0x02, 0x00, 0x04, 0x12, 0x00, 0x98, 0x3e, 0x40, 0x71, 0xd3, 0xff,
+    0x01, 0x88, 0x0a, 0x00, 0xfc, 0x28, 0x00, 0x80, 0x21, 0x01, 0xac, 0x17, 0x00, 0x74, 0x03, 0x07,
+    0x04, 0x00, 0x21, 0x05, 0xb6, 0xd0, 0xa4, 0x10, 0x01, 0x2c, 0x02, 0x00, 0x94, 0x21, 0x00, 0xf0,
+    0x13, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x11, 0x00, 0x98, 0x15, 0x00, 0xf4, 0x04, 0x00, 0xbc, 0x01,
+    0x00, 0xbc, 0x00, 0x00, 0x98, 0x05, 0x00, 0x7c, 0x01, 0x0f, 0x04, 0x00, 0x26, 0x0c, 0xb0, 0x00,
+    0x12, 0xdf, 0xb0, 0x00, 0x01, 0x74, 0x00, 0x12, 0xd6, 0x1c, 0xb1, 0x00, 0x10, 0x00, 0x00, 0x64,
+    0x27, 0x00, 0xc0, 0x2d, 0x00, 0x80, 0x16, 0x00, 0x64, 0x03, 0x00, 0xbc, 0x08, 0x00, 0x38, 0x01,
+    0x00, 0x04, 0x00, 0x0d, 0x7c, 0x00, 0x03, 0x18, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x10, 0x06, 0x00,
+    0x10, 0x02, 0x00, 0x74, 0x08, 0x07, 0x08, 0x0f, 0x00, 0xc0, 0x4c, 0x00, 0x88, 0x16, 0x31, 0xc0,
+    0xcf, 0xe7, 0x38, 0x7a, 0x00, 0x94, 0xda, 0x00, 0x84, 0x07, 0x00, 0x3c, 0x76, 0x02, 0xe0, 0x06,
+    0x12, 0xb2, 0x94, 0x0e, 0x22, 0x3f, 0xbe, 0x98, 0xeb, 0x00, 0x08, 0x01, 0x00, 0x40, 0x01, 0x00,
+    0x90, 0x04, 0x00, 0xc4, 0x08, 0x00, 0x10, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x40, 0x15, 0x00, 0xfc, 0x0e, 0x00, 0x10, 0x31, 0x00, 0x3c, 0x03, 0x04, 0x2c,
+    0x07, 0x00, 0xf8, 0x06, 0x00, 0x38, 0x01, 0x13, 0xb2, 0xe4, 0x78, 0x00, 0x24, 0x0c, 0x00, 0x84,
+    0x07, 0x00, 0xf0, 0x07, 0x01, 0x84, 0x07, 0xf1, 0x02, 0xb1, 0xff, 0x11, 0x0b, 0xb5, 0xff, 0x5d,
+    0x65, 0xc1, 0xff, 0x9b, 0xa8, 0xd6, 0xff, 0xc3, 0xd2, 0xe9, 0xa4, 0x00, 0x01, 0xcc, 0xd4, 0x21,
+    0x91, 0xce, 0x78, 0x82, 0x02, 0x6c, 0x8a, 0x12, 0xb1, 0x68, 0x61, 0x00, 0x64, 0x00, 0x00, 0xc0,
+    0x06, 0x00, 0x58, 0x00, 0x00, 0x84, 0x03, 0x00, 0xfc, 0x00, 0x0d, 0x14, 0x01, 0x0b, 0x54, 0x02,
+    0x04, 0x24, 0x00, 0x04, 0x1c, 0x05, 0x00, 0xd8, 0x03, 0x00, 0x28, 0x13, 0x01, 0x10, 0x02, 0x12,
+    0xb2, 0x08, 0x94, 0x00, 0xe4, 0x06, 0x0f, 0x58, 0x00, 0x12, 0x00, 0xc4, 0x01, 0x12, 0xf8, 0xfc,
+    0x4e, 0x00, 0x94, 0x04, 0x00, 0xfc, 0x0f, 0x00, 0xd0, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x04, 0x00,
+    0x0f, 0x28, 0x01, 0x05, 0x00, 0x18, 0x00, 0x00, 0x28, 0x01, 0x00, 0x54, 0x01, 0x00, 0x28, 0x00,
+    0x00, 0x64, 0x09, 0x00, 0xc0, 0x12, 0x00, 0x9c, 0x11, 0x01, 0x80, 0x07, 0x00, 0xbc, 0x03, 0x04,
+    0x98, 0x02, 0x03, 0x0c, 0x00, 0x00, 0xd8, 0x81, 0x00, 0x70, 0x39, 0x00, 0xe0, 0x23, 0x00, 0xd8,
+    0x01, 0x00, 0xec, 0x0c, 0x00, 0x70, 0x10, 0x00, 0xfc, 0x03, 0x00, 0xd4, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0xfc, 0x00, 0x00, 0x08, 0x01, 0x00, 0x18, 0x04, 0x00, 0x04, 0x02, 0x0c, 0x04, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x14, 0x00, 0x00, 0xc0, 0x04, 0x0f, 0x84, 0x07, 0xe8, 0x0f, 0x04, 0x37, 0x0e,
+    0x00, 0x30, 0x03, 0x40, 0x43, 0xc0, 0xff, 0x01, 0xa4, 0x08, 0x00, 0x88, 0x0a, 0x00, 0x0c, 0x02,
+    0x00, 0xe0, 0x01, 0x00, 0x9c, 0x05, 0x00, 0x40, 0x01, 0x00, 0x64, 0x01, 0x00, 0x08, 0x00, 0x0c,
+    0x04, 0x00, 0x00, 0x78, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x68, 0x01, 0x00, 0x68, 0x0a, 0x00, 0x94,
+    0x01, 0x00, 0x34, 0x0b, 0x00, 0xd0, 0x0b, 0x00, 0xa0, 0x34, 0x00, 0xd8, 0x0d, 0x00, 0xb4, 0x02,
+    0x00, 0x7c, 0x01, 0x00, 0xcc, 0x03, 0x00, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x08, 0x00, 0x0f,
+    0x04, 0x00, 0x15, 0x04, 0x64, 0x00, 0x01, 0x68, 0x00, 0x03, 0x2c, 0x93, 0x00, 0x14, 0x07, 0x00,
+    0x3c, 0x06, 0x00, 0xdc, 0x06, 0x00, 0xac, 0x0b, 0x00, 0x78, 0x1d, 0x00, 0x70, 0x07, 0x00, 0xcc,
+    0x02, 0x04, 0x84, 0x07, 0x00, 0xb4, 0x3b, 0x00, 0x14, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x78, 0x06,
+    0x00, 0x88, 0x06, 0x00, 0x7c, 0x00, 0x00, 0x48, 0x00, 0x0c, 0x7c, 0x00, 0x09, 0x64, 0x00, 0x08,
+    0x40, 0x03, 0x03, 0x60, 0x04, 0x00, 0x74, 0x02, 0x04, 0xbc, 0x03, 0x00, 0x40, 0x0b, 0x01, 0x78,
+    0x15, 0x00, 0xb0, 0x02, 0x00, 0xcc, 0x08, 0x00, 0xd4, 0x17, 0x08, 0x04, 0x00, 0x03, 0x14, 0x00,
+    0x00, 0x24, 0x65, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x04, 0x00, 0x20, 0x04, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x04, 0x0c, 0x03, 0x00, 0x0c, 0x00, 0x00, 0xfc, 0x0c, 0x00, 0x0c, 0x03, 0x00, 0xa0,
+    0x23, 0x00, 0xb4, 0x07, 0x08, 0x0c, 0x03, 0x00, 0x58, 0x56, 0x00, 0xfc, 0x12, 0x00, 0xe0, 0x1a,
+    0x00, 0x14, 0x05, 0x00, 0xe8, 0x0b, 0x00, 0xc8, 0x02, 0x00, 0xfc, 0x00, 0x00, 0xc8, 0x00, 0x00,
+    0x58, 0x04, 0x01, 0x08, 0x00, 0x08, 0xb0, 0x00, 0x0c, 0x0c, 0x00, 0x03, 0xb0, 0x03, 0x00, 0xc8,
+    0x01, 0x00, 0x74, 0x07, 0x00, 0x88, 0x01, 0x00, 0x64, 0x05, 0x00, 0xe8, 0x16, 0x00, 0x88, 0x03,
+    0x00, 0xb4, 0x0c, 0x00, 0xac, 0x0d, 0x00, 0x3c, 0x05, 0x00, 0x20, 0x01, 0x00, 0x18, 0x01, 0x00,
+    0x0c, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x14, 0x01, 0x0f, 0x84, 0x07, 0x04, 0x00, 0xa8, 0x87, 0x00, 0xd8, 0x13, 0x00, 0x30, 0x34, 0x0f,
+    0x80, 0x07, 0x51, 0x00, 0x64, 0x00, 0x0f, 0x84, 0x07, 0x02, 0x00, 0x18, 0x08, 0x00, 0x10, 0x06,
+    0x00, 0xe8, 0x00, 0x00, 0x54, 0x0e, 0x04, 0xe4, 0x00, 0x00, 0x44, 0x01, 0x0f, 0x04, 0x00, 0x31,
+    0x00, 0x04, 0x01, 0x00, 0x0c, 0x0a, 0x00, 0xdc, 0x08, 0x00, 0xb4, 0x06, 0x00, 0xac, 0x01, 0x00,
+    0x1c, 0x2e, 0x00, 0xbc, 0x13, 0x00, 0x3c, 0x0c, 0x00, 0x58, 0x09, 0x00, 0x08, 0x6f, 0xd2, 0x26,
+    0xb9, 0xff, 0x06, 0x11, 0xb6, 0xff, 0x14, 0x12, 0xb5, 0xff, 0x1e, 0x1f, 0xc4, 0xe8, 0x90, 0x1f,
+    0x20, 0xb6, 0xff, 0x15, 0x14, 0xb5, 0xff, 0x07, 0x4c, 0x8e, 0x00, 0xac, 0xb4, 0x00, 0xc8, 0x5d,
+    0x00, 0x40, 0x06, 0x00, 0x38, 0x00, 0x00, 0x40, 0x00, 0x00, 0x68, 0x02, 0x00, 0x44, 0x03, 0x00,
+    0x60, 0x0a, 0x00, 0x7c, 0x02, 0x00, 0x68, 0x00, 0x00, 0x70, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xbc,
+    0x00, 0x25, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x01, 0x00, 0xb0, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x6c,
+    0x2f, 0x00, 0x30, 0x80, 0x00, 0x38, 0x0e, 0x00, 0x78, 0x00, 0x00, 0x44, 0x0e, 0x00, 0xf8, 0x1b,
+    0x00, 0x00, 0x04, 0x00, 0x34, 0x03, 0x00, 0x70, 0x05, 0x00, 0x3c, 0x02, 0x00, 0x34, 0x00, 0x0f,
+    0x74, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x2c, 0x02, 0x00, 0xa0, 0x00, 0x00, 0xd4, 0x09, 0x00,
+    0x88, 0x1a, 0x00, 0xdc, 0x05, 0x00, 0xc0, 0x6a, 0x03, 0x8c, 0x16, 0x00, 0x08, 0x0f, 0x00, 0xbc,
+    0x81, 0x04, 0xe0, 0xdb, 0x00, 0xac, 0x01, 0x00, 0x20, 0x02, 0x60, 0x53, 0x5a, 0xbe, 0xff, 0x17,
+    0x18, 0x78, 0xcb, 0x30, 0xb4, 0xff, 0x05, 0x48, 0x29, 0x00, 0x14, 0x10, 0x04, 0x08, 0x01, 0x00,
+    0x1c, 0x62, 0x00, 0x00, 0x06, 0x00, 0xc8, 0x0b, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00,
+    0x6c, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x74, 0x3c, 0x00, 0x98, 0x29, 0x04, 0x78, 0x04, 0x00, 0x28,
+    0x04, 0x00, 0xa4, 0x00, 0x00, 0xf8, 0x03, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x14, 0x04,
+    0x00, 0x1c, 0x04, 0x13, 0x11, 0x08, 0x0f, 0x00, 0x84, 0x07, 0x01, 0x08, 0x0f, 0x11, 0xd6, 0x68,
+    0x94, 0x00, 0x50, 0x02, 0x00, 0x5c, 0x55, 0x37, 0x86, 0x90, 0xce, 0x08, 0x0f, 0x12, 0xb2, 0xb4,
+    0x1b, 0x00, 0x24, 0x05, 0x00, 0x3c, 0x01, 0x00, 0x70, 0x83, 0x00, 0x30, 0x14, 0x00, 0xa0, 0x08,
+    0x0f, 0x1c, 0x01, 0x05, 0x04, 0x18, 0x00, 0x04, 0x24, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x5c, 0x01,
+    0x00, 0x98, 0x0c, 0x01, 0xfc, 0x06, 0x00, 0x44, 0x04, 0x07, 0x58, 0x00, 0x00, 0x44, 0x02, 0x00,
+    0x2c, 0x0a, 0x0f, 0x58, 0x00, 0x09, 0x00, 0xcc, 0x00, 0x00, 0x20, 0x00, 0x00, 0x4c, 0x00, 0x00,
+    0xec, 0x0c, 0x00, 0x1c, 0x17, 0x00, 0x78, 0x10, 0x00, 0x34, 0x02, 0x00, 0x04, 0x00, 0x0f, 0x2c,
+    0x01, 0x09, 0x00, 0x1c, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x19, 0x00, 0x6c, 0x13, 0x00, 0x28,
+    0x01, 0x00, 0xfc, 0x05, 0x00, 0xf8, 0x0e, 0x01, 0x7c, 0x04, 0x04, 0xc8, 0x04, 0x00, 0x98, 0x00,
+    0x03, 0x68, 0x72, 0x00, 0x48, 0x01, 0x00, 0x80, 0x07, 0x04, 0x08, 0x0c, 0x0f, 0x10, 0x02, 0x05,
+    0x00, 0x98, 0x00, 0x00, 0x08, 0x02, 0x0c, 0x04, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x14, 0x00, 0x00,
+    0xb0, 0x00, 0x00, 0x38, 0x01, 0x00, 0x40, 0x01, 0x00, 0xfc, 0x1c, 0x01, 0x1c, 0x02, 0x0f, 0x60,
+    0xb4, 0x63, 0x00, 0xe0, 0x01, 0x04, 0x04, 0x00, 0x0f, 0xac, 0x52, 0x52, 0x00, 0x64, 0x01, 0x01,
+    0x70, 0x09, 0x51, 0xb4, 0xff, 0x08, 0x0a, 0xb5, 0xc8, 0xec, 0x31, 0x1f, 0x22, 0xb7, 0xb8, 0xbf,
+    0x00, 0x10, 0x04, 0x50, 0x13, 0x14, 0xb6, 0xff, 0x06, 0x34, 0x0e, 0x00, 0x34, 0x06, 0x00, 0x14,
+    0x46, 0x00, 0x44, 0x04, 0x00, 0xd8, 0x01, 0x00, 0x48, 0x07, 0x04, 0x38, 0x07, 0x00, 0xc0, 0x02,
+    0x00, 0x48, 0x01, 0x0c, 0x04, 0x00, 0x00, 0x78, 0x01, 0x08, 0x68, 0x02, 0x00, 0x10, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x9c, 0x09, 0x00, 0xec, 0x09, 0x00, 0xd8, 0x03, 0x00, 0xd0, 0x33, 0x00, 0xec,
+    0x0d, 0x00, 0x18, 0x00, 0x00, 0x40, 0x00, 0x04, 0x94, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00,
+    0x11, 0x00, 0x54, 0x00, 0x00, 0x04, 0x00, 0x00, 0x68, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0xa4, 0x0f, 0x00, 0x20, 0x0c, 0x00, 0x50, 0x06, 0x00, 0x40, 0x3b, 0x00, 0xa8, 0x4a, 0x00,
+    0x9c, 0x49, 0x00, 0xe8, 0x2d, 0x01, 0x84, 0x07, 0x12, 0xb3, 0xf4, 0x30, 0x00, 0x68, 0x03, 0x00,
+    0x70, 0x03, 0x00, 0x50, 0x04, 0x00, 0x48, 0x04, 0x00, 0x7c, 0x00, 0x0f, 0xcc, 0x00, 0x01, 0x00,
+    0x24, 0x03, 0x00, 0x58, 0x00, 0x00, 0x64, 0x00, 0x08, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x80, 0x0e, 0x00, 0xc4, 0x06, 0x00, 0x38, 0x07, 0x00, 0x18, 0x07, 0x00, 0xd0, 0x1b,
+    0x03, 0x54, 0x01, 0x0e, 0x9c, 0x77, 0x03, 0xc8, 0x02, 0x00, 0x70, 0x97, 0x00, 0x94, 0x00, 0x00,
+    0x84, 0x23, 0x00, 0x20, 0x04, 0x04, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x04, 0x0c,
+    0x03, 0x00, 0x84, 0x19, 0x00, 0xf0, 0x11, 0x00, 0x20, 0x1c, 0x01, 0xbc, 0x00, 0x03, 0xc4, 0x07,
+    0x00, 0x14, 0x0f, 0x00, 0x40, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xec, 0x00, 0x00,
+    0xf4, 0x00, 0x00, 0xfc, 0x00, 0x01, 0x98, 0x00, 0x03, 0x50, 0x8d, 0x08, 0xb0, 0x00, 0x0c, 0x0c,
+    0x00, 0x00, 0x28, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x64, 0x07, 0x00, 0x84, 0x01, 0x00, 0xf0, 0x07,
+    0x00, 0xe0, 0x01, 0x00, 0xb4, 0x17, 0x00, 0x9c, 0x01, 0x00, 0xa4, 0x0d, 0x00, 0x58, 0x00, 0x00,
+    0x90, 0x0f, 0x00, 0x3c, 0x09, 0x00, 0x1c, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x98, 0x01, 0x09, 0x0f,
+    0x84, 0x07, 0x10, 0x00, 0x08, 0x0f, 0x00, 0x30, 0x43, 0x00, 0x30, 0x34, 0x04, 0xec, 0x02, 0x0f,
+    0x08, 0x00, 0x4d, 0x00, 0xd8, 0x05, 0x00, 0x7c, 0x0f, 0x00, 0x30, 0xbe, 0x02, 0xa8, 0x1f, 0x03,
+    0xac, 0x52, 0x00, 0x04, 0x02, 0x00, 0x58, 0x0a, 0x00, 0xd0, 0x02, 0x00, 0x58, 0x0a, 0x00, 0x80,
+    0x06, 0x00, 0x90, 0x07, 0x0f, 0x04, 0x00, 0x31, 0x00, 0x4c, 0x00, 0x00, 0x54, 0x00, 0x00, 0x14,
+    0x33, 0x00, 0x68, 0x09, 0x00, 0x1c, 0x02, 0x00, 0x3c, 0x0c, 0x01, 0xc8, 0x01, 0x40, 0xb5, 0xff,
+    0x00, 0x04, 0x60, 0x06, 0x02, 0x10, 0x02, 0x31, 0x1b, 0x1e, 0xb6, 0x60, 0xcc, 0x00, 0xbc, 0xd9,
+    0x00, 0x60, 0x90, 0x31, 0x59, 0x60, 0xc0, 0x3c, 0x3d, 0x20, 0x1e, 0x22, 0x08, 0x06, 0x02, 0x24,
+    0x00, 0x36, 0x00, 0x02, 0xb6, 0xa4, 0xa8, 0x00, 0x08, 0x14, 0x00, 0x2c, 0x05, 0x00, 0x8c, 0x03,
+    0x00, 0xc0, 0x14, 0x00, 0xc4, 0x02, 0x00, 0x70, 0x00, 0x0f, 0xb8, 0x00, 0x29, 0x00, 0x40, 0x00,
+    0x00, 0xb0, 0x00, 0x00, 0x0c, 0x01, 0x00, 0xe8, 0x18, 0x00, 0x1c, 0x01, 0x01, 0xb0, 0x00, 0x03,
+    0x74, 0x02, 0x61, 0x3a, 0xbe, 0xff, 0x00, 0x64, 0xcd, 0x88, 0xb0, 0x01, 0x6c, 0x02, 0x04, 0x6c,
+    0x00, 0x00, 0x04, 0x08, 0x04, 0x0c, 0x00, 0x0f, 0x08, 0x00, 0x01, 0x08, 0x58, 0x00, 0x00, 0x08,
+    0x01, 0x00, 0xdc, 0x02, 0x01, 0x24, 0x03, 0x00, 0x50, 0x0d, 0x11, 0xb4, 0x2c, 0xd3, 0x00, 0x88,
+    0x25, 0x04, 0x8c, 0x16, 0x00, 0xe8, 0x06, 0x00, 0xdc, 0x98, 0x00, 0xdc, 0xa7, 0x00, 0x7c, 0xd6,
+    0x00, 0xec, 0x9f, 0x00, 0x94, 0x04, 0x05, 0x4c, 0x03, 0x00, 0x08, 0x01, 0x00, 0x84, 0x3f, 0x00,
+    0x68, 0x30, 0x00, 0x08, 0x38, 0x00, 0x90, 0xab, 0x0f, 0x04, 0x00, 0x0d, 0x00, 0x70, 0x03, 0x04,
+    0x78, 0x01, 0x00, 0x38, 0x03, 0x00, 0x00, 0x11, 0x00, 0xdc, 0x02, 0x00, 0x60, 0x17, 0x00, 0xb4,
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x44, 0x01, 0x00, 0x1c, 0x1a, 0x00, 0x68, 0x0f, 0x00, 0x94, 0x03,
+    0x00, 0x64, 0x00, 0x61, 0x00, 0xb2, 0xff, 0x08, 0x00, 0xb5, 0x24, 0xdb, 0x09, 0x8c, 0x16, 0x21,
+    0xc4, 0xe2, 0xd8, 0x3e, 0x00, 0x7c, 0xc0, 0x02, 0xac, 0x0f, 0x12, 0xb3, 0x54, 0x52, 0x00, 0xf4,
+    0x11, 0x04, 0x58, 0x00, 0x00, 0x18, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x60, 0x00, 0x0f, 0x04, 0x00,
+    0x09, 0x04, 0x24, 0x00, 0x00, 0x48, 0x0e, 0x00, 0x18, 0x13, 0x00, 0xec, 0x08, 0x01, 0x88, 0x06,
+    0x00, 0xec, 0x06, 0x0f, 0x58, 0x00, 0x1c, 0x00, 0x4c, 0x00, 0x00, 0x78, 0x00, 0x00, 0x80, 0x0c,
+    0x00, 0xdc, 0x04, 0x00, 0x90, 0x00, 0x01, 0x4c, 0x00, 0x03, 0x44, 0x02, 0x00, 0xb0, 0x64, 0x13,
+    0x06, 0x04, 0x00, 0x1f, 0x07, 0x04, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x64, 0x01, 0x04, 0x30,
+    0x01, 0x01, 0x08, 0x00, 0x03, 0x04, 0x02, 0x01, 0x8c, 0x07, 0x00, 0x98, 0x00, 0x12, 0xb5, 0x70,
+    0x81, 0x01, 0x84, 0x07, 0x12, 0xdb, 0xc0, 0x25, 0x00, 0x78, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x08,
+    0x00, 0x04, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0xe8, 0x08, 0x00, 0x98, 0x04, 0x00, 0x1c, 0x08,
+    0x00, 0x3c, 0x04, 0x00, 0x44, 0x04, 0x00, 0x28, 0x04, 0x00, 0x08, 0x00, 0x00, 0x74, 0x05, 0x00,
+    0x14, 0x00, 0x00, 0xd0, 0x09, 0x00, 0xec, 0x1c, 0x00, 0x50, 0x00, 0x01, 0xb0, 0x00, 0x00, 0x1c,
+    0x02, 0x0f, 0x84, 0x07, 0x90, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0xcc, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x04, 0xf0, 0x00, 0x00, 0x88, 0x05, 0x00, 0x18,
+    0x01, 0x00, 0x3c, 0x0d, 0x00, 0xc8, 0x35, 0x03, 0x84, 0x07, 0x31, 0x01, 0x00, 0xb4, 0xe8, 0xc6,
+    0x00, 0x00, 0x12, 0x00, 0x88, 0xc1, 0x00, 0x08, 0x04, 0x00, 0xb0, 0xe8, 0x24, 0x40, 0x45, 0x08,
+    0x04, 0x00, 0x84, 0x01, 0x12, 0xb4, 0x20, 0x7f, 0x00, 0x08, 0xa0, 0x00, 0xb4, 0x08, 0x00, 0xbc,
+    0x08, 0x00, 0x70, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x60, 0x00, 0x04, 0x58, 0x01, 0x00, 0x14, 0x00,
+    0x00, 0x68, 0x00, 0x00, 0x78, 0x01, 0x00, 0x80, 0x01, 0x00, 0x6c, 0x8d, 0x00, 0x04, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x0c, 0x0b, 0x00, 0x5c, 0x13, 0x00, 0x08, 0x0c, 0x00, 0x08,
+    0x0e, 0x00, 0xfc, 0x09, 0x01, 0xbc, 0x11, 0x00, 0x40, 0x19, 0x00, 0x24, 0x15, 0x0f, 0x8c, 0x2b,
+    0x08, 0x0c, 0x64, 0x00, 0x00, 0x78, 0x09, 0x00, 0x88, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x60, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x34, 0x06, 0x00, 0x20, 0x0c, 0x00, 0xe8, 0x07, 0x00, 0xe4, 0x06, 0x00,
+    0x4c, 0x0c, 0x00, 0x3c, 0x02, 0x05, 0xd0, 0x09, 0x12, 0xb3, 0x04, 0x04, 0x00, 0x64, 0x04, 0x00,
+    0x30, 0x03, 0x00, 0x78, 0x04, 0x00, 0x20, 0x02, 0x04, 0xc8, 0x00, 0x00, 0xc0, 0x00, 0x04, 0xd0,
+    0x00, 0x00, 0xa8, 0x06, 0x00, 0x80, 0x06, 0x00, 0x24, 0x08, 0x00, 0x64, 0x00, 0x08, 0x5c, 0x02,
+    0x00, 0x6c, 0x00, 0x00, 0x14, 0x00, 0x08, 0xbc, 0x03, 0x00, 0xd4, 0x00, 0x01, 0xf0, 0x03, 0x00,
+    0xa8, 0x02, 0x00, 0x34, 0x01, 0x03, 0xfc, 0x02, 0x01, 0xc8, 0x02, 0x00, 0x0c, 0x00, 0x0f, 0x14,
+    0x00, 0x00, 0x00, 0x8c, 0x05, 0x0f, 0x0c, 0x03, 0x1e, 0x03, 0x4c, 0x00, 0x00, 0x18, 0x62, 0x00,
+    0x24, 0x1e, 0x00, 0xec, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xfc, 0x00, 0x04, 0x98, 0x00, 0x00, 0x08,
+    0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xbc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xec, 0x0e, 0x00, 0x88,
+    0x06, 0x00, 0x80, 0x13, 0x00, 0x28, 0x0c, 0x00, 0x2c, 0x01, 0x00, 0xac, 0x03, 0x00, 0x50, 0x34,
+    0x00, 0x90, 0x04, 0x00, 0xa8, 0x04, 0x00, 0x68, 0x01, 0x00, 0x14, 0x01, 0x00, 0x24, 0x01, 0x00,
+    0x20, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x04, 0x24, 0x00, 0x00, 0x38, 0x01, 0x00, 0x08, 0x0f, 0x00,
+    0x6c, 0x1d, 0x00, 0x08, 0x04, 0x00, 0x74, 0x0e, 0x01, 0xdc, 0x0a, 0x11, 0xb4, 0x88, 0x32, 0x00,
+    0x28, 0x34, 0x00, 0x18, 0x07, 0x0f, 0x7c, 0x07, 0x4d, 0x04, 0x60, 0x00, 0x00, 0xe0, 0x14, 0x00,
+    0xe4, 0xcb, 0x00, 0x34, 0x8f, 0x02, 0x34, 0x05, 0x03, 0x0c, 0xd2, 0x00, 0xe0, 0x14, 0x00, 0x60,
+    0x42, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x05, 0x00, 0x18, 0x03, 0x00, 0xa0, 0x02, 0x0f, 0x04, 0x00,
+    0x31, 0x00, 0x4c, 0x00, 0x00, 0x08, 0x14, 0x40, 0x72, 0xd3, 0xff, 0x01, 0x58, 0x05, 0x00, 0xc4,
+    0x0a, 0x00, 0x5c, 0x01, 0x01, 0x08, 0x01, 0x00, 0x64, 0x04, 0x00, 0x04, 0x00, 0x00, 0x40, 0x83,
+    0x11, 0xb2, 0x2c, 0x2e, 0x00, 0x38, 0x9a, 0x00, 0x34, 0x4c, 0x00, 0x14, 0x0e, 0x00, 0x58, 0x53,
+    0x00, 0x38, 0x2e, 0x00, 0x2c, 0x3b, 0x02, 0xb0, 0x00, 0x02, 0x28, 0x00, 0x02, 0xf8, 0x14, 0x00,
+    0x38, 0x00, 0x02, 0x58, 0xa5, 0x10, 0x01, 0x5c, 0x01, 0x00, 0x88, 0x07, 0x00, 0x68, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xbc, 0x00, 0x25, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x01, 0x22,
+    0x73, 0xd3, 0xfc, 0x16, 0x00, 0xcc, 0x3d, 0x01, 0xb0, 0x00, 0x03, 0x7c, 0x00, 0x53, 0x0f, 0xb7,
+    0xff, 0x00, 0x4a, 0x7c, 0x14, 0x61, 0x7c, 0xd8, 0xff, 0x01, 0x81, 0xdb, 0x04, 0x00, 0x0f, 0x70,
+    0x00, 0x0e, 0x05, 0x58, 0x00, 0x30, 0xd4, 0xff, 0x01, 0xbc, 0x41, 0x00, 0x94, 0x03, 0x00, 0x60,
+    0x02, 0x01, 0x08, 0x01, 0x11, 0xb3, 0x94, 0x25, 0x00, 0xf8, 0x0e, 0x31, 0xbd, 0xcb, 0xe5, 0xe8,
+    0x15, 0x00, 0xb4, 0x01, 0x00, 0xd8, 0x4c, 0x00, 0x90, 0xe9, 0x00, 0x60, 0xaa, 0x00, 0x04, 0xa8,
+    0x24, 0x31, 0x35, 0xbc, 0xda, 0x03, 0x8c, 0x00, 0x01, 0x3c, 0x00, 0x00, 0x08, 0x01, 0x00, 0x68,
+    0x03, 0x03, 0xa0, 0xeb, 0x01, 0xf8, 0x0a, 0x02, 0x10, 0x00, 0x02, 0x34, 0x01, 0x0f, 0x0c, 0x00,
+    0x01, 0x03, 0x64, 0x83, 0x00, 0xa8, 0x03, 0x00, 0x70, 0x0e, 0x00, 0x6c, 0x12, 0x00, 0xc0, 0x00,
+    0x00, 0x0c, 0x11, 0x00, 0x44, 0x01, 0x00, 0x20, 0x18, 0x00, 0xfc, 0x25, 0x00, 0x34, 0x0f, 0x01,
+    0xb4, 0x03, 0x00, 0x64, 0x00, 0x11, 0xb4, 0x0c, 0x08, 0x00, 0x14, 0x2d, 0x00, 0x0c, 0xe4, 0x00,
+    0xa0, 0x00, 0x00, 0x10, 0x1e, 0x31, 0x83, 0x8d, 0xcc, 0x0c, 0xa8, 0x05, 0x94, 0x01, 0x00, 0xdc,
+    0x0f, 0x13, 0x46, 0x78, 0x8a, 0x00, 0x4c, 0x12, 0x00, 0x58, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x08,
+    0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00, 0x7c, 0x12, 0x00, 0xc8, 0x03, 0x00, 0xb0,
+    0x0e, 0x05, 0xfc, 0x08, 0x03, 0xb0, 0x00, 0x00, 0x04, 0x11, 0x01, 0xb0, 0x00, 0x12, 0xd5, 0x70,
+    0x01, 0x04, 0x34, 0x00, 0x0c, 0x58, 0x00, 0x04, 0x18, 0x00, 0x40, 0x76, 0xd5, 0xff, 0x01, 0xd0,
+    0x06, 0x00, 0x4c, 0x25, 0x05, 0x6c, 0x01, 0x08, 0x3c, 0x01, 0x08, 0x0c, 0x00, 0x00, 0xe4, 0x00,
+    0x04, 0x04, 0x00, 0x0c, 0x18, 0x00, 0x0f, 0x44, 0x01, 0x01, 0x00, 0x14, 0x00, 0x11, 0xb4, 0x74,
+    0x80, 0x50, 0x01, 0x51, 0xc4, 0xff, 0x01, 0xbc, 0x0b, 0x00, 0x48, 0x05, 0x00, 0x44, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0x94, 0x00, 0x00, 0x48, 0x02, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x24,
+    0x0a, 0x00, 0x68, 0x04, 0x00, 0x48, 0x05, 0x01, 0x20, 0x04, 0x00, 0xb0, 0x14, 0x03, 0x94, 0x13,
+    0x00, 0x1c, 0x15, 0x00, 0x14, 0x00, 0x00, 0x60, 0x05, 0x00, 0x08, 0x06, 0x00, 0xb4, 0x00, 0x0f,
+    0x84, 0x07, 0x91, 0x00, 0x1c, 0x0d, 0x00, 0x64, 0x24, 0x00, 0xa8, 0x32, 0x00, 0x40, 0x11, 0x00,
+    0xc8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x05, 0x0f, 0x04, 0x00, 0x06, 0x03, 0x38, 0x15, 0x00,
+    0x3c, 0x05, 0x00, 0x7c, 0x05, 0x00, 0x1c, 0x01, 0x07, 0x14, 0x12, 0x00, 0xcc, 0xfb, 0x00, 0x64,
+    0xb9, 0x00, 0xd4, 0x93, 0x00, 0x24, 0xf0, 0x00, 0x08, 0xe5, 0x00, 0x10, 0x04, 0x00, 0xe4, 0x9b,
+    0x24, 0x32, 0x37, 0x00, 0x03, 0x12, 0xb2, 0x1c, 0x02, 0x00, 0x40, 0x07, 0x00, 0xdc, 0x1a, 0x00,
+    0xbc, 0x08, 0x00, 0x40, 0x01, 0x09, 0x7c, 0x00, 0x03, 0xe0, 0x14, 0x00, 0x1c, 0x08, 0x00, 0x7c,
+    0x12, 0x00, 0x10, 0x11, 0x00, 0xe0, 0x46, 0x00, 0x98, 0x01, 0x00, 0x04, 0x00, 0x00, 0xc8, 0x19,
+    0x00, 0xf8, 0x27, 0x00, 0xec, 0x1f, 0x00, 0x20, 0x02, 0x04, 0x00, 0x89, 0x00, 0xd4, 0x1a, 0x00,
+    0xbc, 0x00, 0x09, 0x4c, 0x00, 0x03, 0xa8, 0x01, 0x00, 0x18, 0x00, 0x09, 0x04, 0x00, 0x03, 0xc4,
+    0x01, 0x00, 0xc4, 0x0d, 0x00, 0xcc, 0x00, 0x00, 0xb8, 0x0b, 0x00, 0xec, 0x05, 0x00, 0x60, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x90, 0x0e, 0x00, 0xf8, 0x13, 0x00, 0x78, 0x0c, 0x00, 0xc0, 0x12, 0x01,
+    0x48, 0x04, 0x00, 0x38, 0x02, 0x03, 0xb8, 0x06, 0x00, 0xac, 0x03, 0x00, 0x84, 0x07, 0x00, 0xd0,
+    0x13, 0x00, 0x78, 0x03, 0x00, 0xa8, 0x00, 0x00, 0x34, 0x06, 0x01, 0x7c, 0x00, 0x03, 0x5c, 0x00,
+    0x04, 0xcc, 0x15, 0x00, 0x9c, 0x07, 0x00, 0x00, 0x12, 0x00, 0x58, 0x0a, 0x00, 0x7c, 0x1d, 0x00,
+    0xdc, 0x16, 0x00, 0x5c, 0x02, 0x00, 0x68, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x44,
+    0x00, 0x22, 0x71, 0xd2, 0xbc, 0x03, 0x00, 0xb8, 0x04, 0x00, 0xc4, 0x1b, 0x00, 0x64, 0x00, 0x0f,
+    0x04, 0x00, 0x12, 0x04, 0xfc, 0x02, 0x00, 0x08, 0x00, 0x08, 0x00, 0x03, 0x08, 0x0c, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0xc0, 0x00, 0x0c, 0x04, 0x00, 0x03, 0x18, 0x00, 0x80, 0x23, 0xb8, 0xff, 0x01,
+    0x4d, 0xc3, 0xff, 0x01, 0xf4, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0xa4, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x24, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x60, 0x14, 0x00,
+    0x4c, 0x0f, 0x00, 0x18, 0x15, 0x01, 0x78, 0x04, 0x00, 0x7c, 0x00, 0x03, 0xc4, 0xa9, 0x00, 0x8c,
+    0x1e, 0x00, 0x84, 0x07, 0x00, 0xd0, 0x01, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x09, 0x8c, 0x01,
+    0x0c, 0xa4, 0x01, 0x07, 0x68, 0x02, 0x00, 0x38, 0x01, 0x00, 0x6c, 0x1d, 0x00, 0x74, 0x0c, 0x00,
+    0x7c, 0x1d, 0x01, 0x38, 0x05, 0x0f, 0x84, 0x07, 0x63, 0x00, 0xd4, 0x05, 0x00, 0xe8, 0x05, 0x00,
+    0x7c, 0x1c, 0x14, 0x10, 0x28, 0xb0, 0x00, 0xc0, 0x08, 0x00, 0x78, 0x3a, 0x00, 0x14, 0x06, 0x00,
+    0x7c, 0x10, 0x00, 0xfc, 0x24, 0x00, 0x98, 0x0a, 0x00, 0xfc, 0x17, 0x00, 0x0c, 0x00, 0x0f, 0x04,
+    0x00, 0x29, 0x00, 0x44, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x58, 0x10, 0x00, 0xb0, 0x0e, 0x00, 0x0c,
+    0x67, 0xf0, 0x02, 0x23, 0xb8, 0xff, 0x05, 0x06, 0xb5, 0xff, 0x0e, 0x01, 0xb5, 0xff, 0x15, 0x0f,
+    0xb5, 0xff, 0x17, 0x15, 0x90, 0x02, 0x11, 0xb5, 0x64, 0xd9, 0x00, 0xac, 0x35, 0x00, 0x90, 0xd5,
+    0xb1, 0xa8, 0xb6, 0xdc, 0xff, 0xb9, 0xc7, 0xe3, 0xff, 0xab, 0xb8, 0xdd, 0xf4, 0x23, 0x00, 0x34,
+    0x2c, 0x22, 0x18, 0x19, 0x30, 0x0f, 0xf0, 0x02, 0x16, 0x14, 0xb5, 0xff, 0x15, 0x10, 0xb5, 0xff,
+    0x0e, 0x02, 0xb5, 0xff, 0x06, 0x05, 0xb5, 0xff, 0x01, 0x64, 0x3b, 0x00, 0x2c, 0x06, 0x00, 0xb4,
+    0x10, 0x00, 0x68, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x0f, 0xb8, 0x00, 0x21, 0x00, 0x38,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x3c, 0x00, 0x0c, 0xb0, 0x00, 0xf0, 0x05, 0x00, 0xb4, 0xff, 0x14,
+    0x0f, 0xb5, 0xff, 0x16, 0x25, 0xb8, 0xff, 0x12, 0x39, 0xbc, 0xff, 0x0a, 0x49, 0xc1, 0xff, 0x02,
+    0x70, 0x00, 0x00, 0x40, 0x04, 0x00, 0x34, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x38, 0x00, 0x0f, 0x04,
+    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x30,
+    0x0a, 0x00, 0xe8, 0x09, 0x00, 0xa4, 0x6d, 0x00, 0x58, 0x00, 0x21, 0x15, 0xb6, 0xe0, 0x06, 0x00,
+    0x24, 0x2f, 0x04, 0x08, 0x0f, 0x00, 0xe4, 0x06, 0x00, 0x04, 0x00, 0x31, 0xc4, 0xd3, 0xe9, 0x08,
+    0x01, 0x00, 0x24, 0x2d, 0x31, 0x50, 0x57, 0xbe, 0x20, 0xfa, 0x00, 0x0c, 0x0f, 0x00, 0xa4, 0x17,
+    0xa0, 0x15, 0x12, 0xb5, 0xff, 0x0f, 0x09, 0xb5, 0xff, 0x06, 0x00, 0x6c, 0xc4, 0x00, 0xd8, 0x0a,
+    0x0f, 0x04, 0x00, 0x15, 0x12, 0xb5, 0x14, 0x31, 0x00, 0xe8, 0x05, 0x00, 0x44, 0x12, 0x00, 0x24,
+    0x04, 0x00, 0xa4, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x9c, 0x4b,
+    0x00, 0xe8, 0x04, 0x01, 0xb4, 0x0b, 0x91, 0xb3, 0xff, 0x1e, 0x20, 0xb6, 0xff, 0x60, 0x68, 0xc2,
+    0x7c, 0xc1, 0x00, 0xa4, 0x0f, 0x00, 0x9c, 0x00, 0x00, 0x70, 0xa3, 0x00, 0x74, 0x73, 0x02, 0x38,
+    0x26, 0x02, 0x7c, 0x00, 0x10, 0x03, 0x8c, 0x0f, 0x00, 0x94, 0x56, 0x04, 0x58, 0x00, 0x00, 0xf4,
+    0x00, 0x00, 0xfc, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x1c,
+    0x00, 0x04, 0x24, 0x00, 0x00, 0x14, 0x0c, 0x00, 0xf8, 0x0a, 0x00, 0x28, 0x5b, 0x00, 0x4c, 0x00,
+    0x01, 0x8c, 0x03, 0x12, 0xb4, 0xb0, 0x00, 0x0f, 0x58, 0x00, 0x11, 0x04, 0x4c, 0x00, 0x00, 0x68,
+    0x00, 0x00, 0x6c, 0x10, 0x00, 0x68, 0x3e, 0xf2, 0x0b, 0x29, 0xb9, 0xff, 0x04, 0x0c, 0xb6, 0xff,
+    0x0c, 0x00, 0xb5, 0xff, 0x13, 0x0c, 0xb5, 0xff, 0x18, 0x15, 0xb5, 0xff, 0x19, 0x17, 0xb6, 0xff,
+    0x19, 0x18, 0xb6, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x20, 0x00, 0x61,
+    0x1a, 0xb6, 0xff, 0x19, 0x1b, 0xb6, 0x7c, 0xfd, 0x04, 0x04, 0x00, 0x71, 0x17, 0x19, 0xb6, 0xff,
+    0x11, 0x10, 0xb5, 0x94, 0xe5, 0x10, 0x02, 0x58, 0x14, 0x00, 0xb8, 0x1e, 0x00, 0x20, 0x08, 0x00,
+    0xc0, 0x0b, 0x00, 0x44, 0x01, 0x00, 0x04, 0x00, 0x00, 0x88, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x14,
+    0x00, 0x00, 0x14, 0x05, 0x00, 0x24, 0x0a, 0x00, 0x08, 0x06, 0x00, 0x90, 0x0d, 0x00, 0x9c, 0x0d,
+    0x00, 0x84, 0x06, 0x00, 0x40, 0x14, 0x00, 0x74, 0x05, 0x00, 0x54, 0x0d, 0x00, 0x08, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x6c, 0x17, 0x00, 0x8c, 0x16, 0x00, 0xec, 0x00, 0x01, 0x2c, 0x04, 0x0f, 0x08,
+    0x0f, 0x8c, 0x00, 0xd8, 0x00, 0x00, 0x1c, 0x05, 0x00, 0xa0, 0x0c, 0x00, 0xd4, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0xcc, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xb8,
+    0x06, 0x00, 0x74, 0x06, 0x00, 0x9c, 0x05, 0x00, 0x2c, 0x01, 0x01, 0xf4, 0x26, 0x11, 0xb2, 0x6c,
+    0xce, 0x00, 0xd0, 0x5e, 0x00, 0x40, 0xe5, 0x00, 0xe4, 0xb9, 0x00, 0x54, 0x7d, 0x00, 0x0c, 0xc9,
+    0x00, 0x84, 0xe8, 0x02, 0x88, 0x84, 0x00, 0x00, 0x06, 0x12, 0xb2, 0x2c, 0x3f, 0x00, 0xb0, 0x05,
+    0x00, 0x10, 0x22, 0x00, 0x64, 0x05, 0x00, 0x54, 0x01, 0x00, 0x58, 0x00, 0x01, 0x54, 0x01, 0x03,
+    0xc0, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x9c, 0x0e, 0x00, 0xc0, 0x28, 0x00, 0x2c, 0x08, 0x00, 0x04,
+    0x0c, 0x00, 0x94, 0x01, 0x00, 0x04, 0x00, 0x00, 0x68, 0x02, 0x00, 0x84, 0x22, 0x00, 0x10, 0x12,
+    0x00, 0x64, 0x46, 0x04, 0x08, 0x0f, 0x00, 0xd0, 0x07, 0x00, 0xbc, 0x00, 0x00, 0xa8, 0x00, 0x00,
+    0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x1c, 0x07, 0x00,
+    0x74, 0x0a, 0x00, 0x94, 0x00, 0x00, 0x60, 0x00, 0x00, 0x04, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x50,
+    0x15, 0x00, 0x54, 0x19, 0x00, 0xf8, 0x1d, 0x04, 0xcc, 0x02, 0x05, 0x08, 0x00, 0x03, 0x08, 0x0f,
+    0x00, 0x80, 0x03, 0x00, 0x84, 0x20, 0x00, 0xc8, 0x0e, 0x00, 0xcc, 0x08, 0x00, 0x58, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x7c, 0x00, 0x01, 0x08, 0x00, 0x03, 0x50, 0x23, 0x00, 0xbc, 0x0f, 0x00, 0xd8,
+    0x11, 0x00, 0xa4, 0x09, 0x00, 0x60, 0x00, 0x00, 0x5c, 0x02, 0x00, 0xe8, 0x02, 0x00, 0x40, 0x01,
+    0x00, 0x40, 0x03, 0x00, 0x14, 0x00, 0x07, 0xbc, 0x03, 0xb1, 0x06, 0x0d, 0xb6, 0xff, 0x0f, 0x0c,
+    0xb5, 0xff, 0x15, 0x16, 0xb6, 0xdc, 0xfe, 0x04, 0xc0, 0x02, 0x09, 0x08, 0x00, 0x00, 0xdc, 0x02,
+    0x00, 0xe4, 0x02, 0x1f, 0x19, 0x10, 0x03, 0x0c, 0x0f, 0x0c, 0x03, 0x04, 0xd0, 0x16, 0x18, 0xb6,
+    0xff, 0x11, 0x0c, 0xb5, 0xff, 0x09, 0x03, 0xb5, 0xff, 0x02, 0x98, 0x16, 0x00, 0xb0, 0x5a, 0x00,
+    0xf4, 0x00, 0x00, 0xfc, 0x00, 0x04, 0x98, 0x00, 0x00, 0xa4, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x08,
+    0x24, 0x00, 0x00, 0x5c, 0x1b, 0x00, 0x1c, 0x05, 0x00, 0x78, 0x1c, 0x01, 0x24, 0x01, 0x00, 0xdc,
+    0x07, 0x03, 0xdc, 0xc8, 0x00, 0xf8, 0x46, 0x00, 0x80, 0x3f, 0x00, 0xd4, 0x10, 0x00, 0x14, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x20, 0x01, 0x0f, 0x04, 0x00, 0x06, 0x03, 0xfc, 0x25, 0x00, 0xbc, 0x08,
+    0x00, 0x20, 0x09, 0x00, 0x80, 0x09, 0x00, 0xac, 0x0d, 0x0f, 0x08, 0x0f, 0x6c, 0x00, 0x3c, 0x05,
+    0x31, 0x9f, 0xac, 0xd8, 0x3c, 0x69, 0x00, 0x90, 0x1e, 0x00, 0xec, 0x48, 0x01, 0xe0, 0x14, 0x00,
+    0x6c, 0x63, 0x22, 0x03, 0xb6, 0xbc, 0x4b, 0x00, 0xc8, 0x1f, 0x00, 0x58, 0x04, 0x00, 0x08, 0x00,
+    0x0f, 0x04, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00, 0x00, 0x48, 0x00, 0x00, 0x50, 0x24,
+    0x00, 0xdc, 0x13, 0x61, 0x05, 0xb5, 0xff, 0x23, 0x27, 0xb7, 0x74, 0x16, 0x00, 0x04, 0x1d, 0x00,
+    0x78, 0xf9, 0x00, 0xec, 0x23, 0x00, 0xe0, 0x05, 0x00, 0x5c, 0x71, 0x00, 0xdc, 0x69, 0x04, 0x14,
+    0x1d, 0x00, 0x70, 0x0d, 0x00, 0xe0, 0x8f, 0x00, 0x34, 0xf2, 0x00, 0x94, 0x12, 0x00, 0x28, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x44, 0x08, 0x00, 0xa4, 0x16, 0x10, 0x26, 0x04, 0xec, 0x00, 0x9c, 0x27,
+    0x22, 0x01, 0xb6, 0x3c, 0x24, 0x00, 0x68, 0x00, 0x00, 0x70, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c,
+    0x00, 0x0f, 0x04, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x00, 0x04, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0c,
+    0x01, 0x00, 0x14, 0x01, 0x12, 0x04, 0xb0, 0x00, 0x00, 0xc0, 0x3b, 0x00, 0x9c, 0x1d, 0x00, 0xf0,
+    0xae, 0xb2, 0x4d, 0x56, 0xbe, 0xff, 0x35, 0x40, 0xbb, 0xff, 0x12, 0x26, 0xb8, 0x5c, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x20, 0x00, 0x07, 0x58, 0x00, 0x71, 0x20, 0x24, 0xb7, 0xff, 0x37, 0x3b, 0xb9, 0x58, 0x00, 0x00,
+    0xf0, 0xea, 0x00, 0x18, 0x3c, 0x04, 0xf0, 0x24, 0x00, 0xe4, 0x06, 0x04, 0x04, 0x00, 0x00, 0x08,
+    0x01, 0x00, 0xb8, 0x01, 0x00, 0x98, 0x16, 0x08, 0x08, 0x01, 0x00, 0x2c, 0x34, 0x00, 0x8c, 0x1d,
+    0x33, 0x27, 0x2b, 0xb7, 0x74, 0xc7, 0x00, 0x08, 0x07, 0x02, 0xd4, 0x08, 0x00, 0xa8, 0x07, 0x0f,
+    0x04, 0x00, 0x0e, 0x00, 0xf8, 0x01, 0x00, 0xcc, 0x16, 0x00, 0x3c, 0x03, 0x00, 0xa0, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x54, 0x01, 0x61, 0x07, 0xb5, 0xff, 0x23,
+    0x26, 0xb7, 0x90, 0xeb, 0x00, 0x10, 0x14, 0x00, 0xf8, 0xb6, 0x00, 0x58, 0xea, 0x00, 0x10, 0x73,
+    0x00, 0x9c, 0x00, 0x00, 0xcc, 0x20, 0x31, 0x99, 0xa5, 0xd5, 0xc8, 0x3c, 0x00, 0xe8, 0x2f, 0x00,
+    0xa8, 0x0f, 0x22, 0x19, 0x1d, 0x2c, 0x09, 0x01, 0xe0, 0x15, 0x04, 0x18, 0x01, 0x04, 0x58, 0x00,
+    0x00, 0x5c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x04, 0x24, 0x00, 0x00, 0x8c, 0x00, 0x00, 0xb4, 0x13,
+    0x00, 0x18, 0x13, 0x01, 0x88, 0x03, 0x07, 0xd0, 0x00, 0x04, 0xb0, 0x00, 0x0f, 0x58, 0x00, 0x0d,
+    0x04, 0x4c, 0x00, 0x00, 0x28, 0x00, 0x00, 0x54, 0x16, 0x21, 0x01, 0xb5, 0x38, 0xa1, 0x00, 0xb8,
+    0xce, 0x00, 0xc8, 0x08, 0x00, 0x48, 0x02, 0x00, 0x48, 0x01, 0x32, 0x61, 0x6a, 0xc2, 0x08, 0x00,
+    0x1f, 0x69, 0x08, 0x00, 0x13, 0x00, 0xa4, 0x11, 0x00, 0xa8, 0x02, 0x31, 0x5a, 0x61, 0xc0, 0xcc,
+    0xf2, 0x00, 0xd4, 0x4c, 0x14, 0x0f, 0x28, 0x08, 0x00, 0x70, 0x88, 0x00, 0xd4, 0x0c, 0x00, 0x7c,
+    0x00, 0x04, 0x04, 0x00, 0x00, 0xf4, 0x02, 0x00, 0xc4, 0x1f, 0x00, 0x50, 0x08, 0x00, 0x18, 0x90,
+    0x00, 0x68, 0x05, 0x00, 0xb0, 0x06, 0x00, 0x1c, 0x13, 0x00, 0x70, 0x07, 0x00, 0x3c, 0x06, 0x00,
+    0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x18, 0x00, 0x64, 0x05, 0x00, 0x10, 0x0c, 0x00, 0x2c,
+    0x04, 0x00, 0xec, 0x22, 0x03, 0x84, 0x07, 0x00, 0x08, 0xe4, 0x0f, 0x48, 0x4f, 0x51, 0x00, 0xd4,
+    0x01, 0x0f, 0x04, 0x00, 0x01, 0x01, 0x10, 0x1e, 0x21, 0xb0, 0xda, 0x9c, 0x0e, 0x10, 0x27, 0x74,
+    0x03, 0x01, 0x98, 0x00, 0x03, 0x1c, 0x05, 0x00, 0x74, 0x4d, 0x00, 0x40, 0x17, 0x00, 0xe4, 0x0f,
+    0x00, 0xc8, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd4, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x24, 0x00,
+    0x00, 0x18, 0x05, 0x00, 0x54, 0x05, 0x00, 0x6c, 0x3a, 0x00, 0x2c, 0x09, 0x00, 0xac, 0x01, 0x03,
+    0x58, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x24, 0x30, 0x00, 0x34, 0x0c, 0x00, 0x90, 0x00, 0x00, 0x78,
+    0x20, 0x00, 0x0c, 0x12, 0x09, 0xa8, 0x37, 0x00, 0x58, 0x0e, 0x00, 0xe4, 0x1f, 0x00, 0x7c, 0x10,
+    0x00, 0x38, 0x01, 0x00, 0x40, 0x01, 0x00, 0x58, 0x00, 0x04, 0x78, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x68, 0x01, 0x00, 0xdc, 0x18, 0x00, 0x24, 0x00, 0x00, 0x54, 0x01, 0x00, 0x50, 0x24, 0x00, 0xb8,
+    0x19, 0x00, 0xa4, 0x15, 0x00, 0xac, 0x01, 0x04, 0xd4, 0x60, 0x00, 0xa0, 0x01, 0x00, 0x54, 0x0f,
+    0x00, 0x90, 0x0d, 0x00, 0x44, 0x15, 0x00, 0x44, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x0f,
+    0x04, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00, 0x34, 0x00, 0x00, 0xd0, 0x0f, 0x00, 0x4c, 0x14, 0x00,
+    0x3c, 0x5d, 0x00, 0x54, 0x3f, 0x00, 0xf8, 0x01, 0x00, 0x64, 0x00, 0x00, 0x70, 0x00, 0x00, 0x84,
+    0x02, 0x0c, 0xcc, 0x02, 0x04, 0x14, 0x0f, 0x00, 0x40, 0x02, 0x00, 0xf4, 0x19, 0x00, 0xd4, 0x36,
+    0x00, 0xb0, 0x1b, 0x00, 0xb4, 0x15, 0x04, 0x58, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x0c, 0x00, 0x00,
+    0xe8, 0x1d, 0x00, 0xe4, 0x15, 0x00, 0xb0, 0x0f, 0x00, 0xa8, 0x06, 0x00, 0x48, 0x03, 0x00, 0xbc,
+    0x03, 0x00, 0x08, 0x00, 0x04, 0x70, 0x02, 0x00, 0x0c, 0x00, 0x04, 0xbc, 0x03, 0x21, 0x08, 0xb5,
+    0xe0, 0x47, 0x00, 0x28, 0x05, 0x00, 0x50, 0x01, 0x00, 0xb4, 0xcc, 0x00, 0xc0, 0x02, 0x0f, 0xf0,
+    0x02, 0x19, 0x0f, 0x2c, 0x00, 0x09, 0x00, 0x4c, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x60, 0x4a, 0x00,
+    0xcc, 0xf5, 0x00, 0xc0, 0x47, 0x10, 0x0e, 0x58, 0x01, 0x00, 0xe8, 0x00, 0x00, 0xc4, 0x78, 0x00,
+    0xfc, 0x00, 0x08, 0x98, 0x00, 0x00, 0x9c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x38, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x44, 0x00, 0x01, 0x04, 0x00, 0x00, 0x70,
+    0x09, 0x12, 0xb5, 0x50, 0xce, 0x00, 0x1c, 0x13, 0x00, 0xf4, 0x10, 0x00, 0xa8, 0x08, 0x00, 0x68,
+    0x22, 0x04, 0x18, 0x01, 0x00, 0x24, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x68,
+    0x02, 0x00, 0x20, 0x09, 0x00, 0x60, 0x13, 0x00, 0xb4, 0x08, 0x00, 0xa8, 0x13, 0x03, 0x68, 0x02,
+    0x00, 0x0c, 0x04, 0x00, 0x9c, 0x1d, 0x0f, 0x8c, 0x16, 0x59, 0x00, 0xd0, 0x02, 0x00, 0xc8, 0xf2,
+    0x00, 0xc4, 0xc6, 0x00, 0xd4, 0x03, 0x00, 0x64, 0x01, 0x02, 0xc4, 0xbc, 0x00, 0xec, 0x00, 0x00,
+    0x74, 0x08, 0x0f, 0x04, 0x00, 0x51, 0x11, 0xb3, 0x34, 0xae, 0x00, 0x08, 0x4a, 0x00, 0x64, 0x12,
+    0x00, 0xcc, 0xb5, 0x00, 0xc8, 0x9e, 0x00, 0xdc, 0xce, 0x00, 0x6c, 0xf3, 0x00, 0xf8, 0x0a, 0x00,
+    0xa8, 0x00, 0x04, 0x04, 0x00, 0x31, 0xba, 0xc9, 0xe4, 0xc0, 0x44, 0x00, 0x20, 0x00, 0x00, 0x28,
+    0x00, 0xe0, 0x98, 0xa3, 0xd5, 0xff, 0x89, 0x93, 0xcf, 0xff, 0x6a, 0x73, 0xc5, 0xff, 0x3d, 0x42,
+    0x04, 0xce, 0x00, 0x78, 0x06, 0x0f, 0xb8, 0x00, 0x49, 0x02, 0x08, 0xfd, 0x31, 0x69, 0x71, 0xc4,
+    0x80, 0x24, 0x00, 0x34, 0xf4, 0x91, 0x7b, 0x84, 0xc9, 0xff, 0x55, 0x5a, 0xbe, 0xff, 0x19, 0x7c,
+    0xdd, 0x00, 0x30, 0x11, 0x00, 0x04, 0x00, 0x0f, 0x84, 0x00, 0x1d, 0x51, 0xb3, 0xff, 0x35, 0x3a,
+    0xb9, 0x64, 0x16, 0x00, 0x74, 0xe9, 0x00, 0x80, 0x07, 0x0f, 0x4c, 0xa7, 0x09, 0x23, 0xba, 0xc8,
+    0x08, 0x01, 0x13, 0xa8, 0x08, 0x01, 0x21, 0xa4, 0xd5, 0xd0, 0xf4, 0x00, 0x18, 0x05, 0x24, 0x3f,
+    0x44, 0x08, 0x01, 0x00, 0xc8, 0x01, 0x0f, 0x04, 0x00, 0x1d, 0x0f, 0xb8, 0x00, 0x09, 0x11, 0xb4,
+    0xc8, 0xe2, 0x00, 0xac, 0x01, 0x31, 0x89, 0x94, 0xcf, 0x54, 0x94, 0x00, 0x78, 0x07, 0x04, 0x9c,
+    0x01, 0x40, 0xca, 0xd9, 0xec, 0x44, 0x90, 0x16, 0x00, 0x9c, 0x01, 0x00, 0x1c, 0xc6, 0x00, 0xc0,
+    0x1f, 0x00, 0xa0, 0xa8, 0x02, 0x04, 0x17, 0x0f, 0x58, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x11, 0x0f,
+    0xc8, 0x00, 0x05, 0x0f, 0x3c, 0x00, 0x11, 0x0c, 0x24, 0x00, 0x51, 0xb3, 0xff, 0x2a, 0x2e, 0xb8,
+    0xc0, 0x09, 0x00, 0x68, 0x11, 0x00, 0xe0, 0x14, 0x00, 0xe0, 0x2d, 0x00, 0xd4, 0xd8, 0x00, 0xbc,
+    0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x30, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x4c, 0x12, 0x00, 0x98,
+    0xb8, 0x00, 0xc4, 0x03, 0x10, 0x12, 0x64, 0x05, 0x01, 0xd4, 0x03, 0x0c, 0x74, 0x00, 0x08, 0x10,
+    0x00, 0x12, 0xb5, 0xf0, 0x19, 0x00, 0xd8, 0x2d, 0x00, 0x70, 0x2a, 0x00, 0xb0, 0x14, 0x00, 0x58,
+    0x78, 0x00, 0x54, 0x05, 0x00, 0x58, 0x14, 0x04, 0x08, 0x00, 0x00, 0xdc, 0x18, 0x00, 0x2c, 0x33,
+    0x00, 0x94, 0x05, 0x05, 0x2c, 0x04, 0x02, 0x08, 0xde, 0x31, 0x82, 0x8d, 0xcc, 0xf8, 0x6c, 0x04,
+    0x7c, 0x01, 0x0f, 0x08, 0x00, 0x59, 0x31, 0xc9, 0xd8, 0xec, 0x9c, 0x20, 0x00, 0xc4, 0x4d, 0x10,
+    0x1a, 0x00, 0x84, 0x01, 0x38, 0xa4, 0x02, 0x94, 0x1d, 0x50, 0x01, 0x56, 0xc6, 0xff, 0x01, 0x0c,
+    0x0f, 0x00, 0xc0, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd4, 0x00, 0x0f, 0x04, 0x00,
+    0x05, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0x22, 0x78, 0xd6, 0x2c, 0x18, 0x00,
+    0xac, 0x10, 0x01, 0xa8, 0x06, 0x00, 0x34, 0x01, 0x11, 0xb3, 0x1c, 0x21, 0x08, 0x24, 0x30, 0x00,
+    0x18, 0x03, 0x00, 0x80, 0x02, 0x00, 0x50, 0x06, 0x05, 0xf4, 0x18, 0x00, 0xb8, 0x05, 0x00, 0x6c,
+    0xa3, 0x00, 0x9c, 0x05, 0x00, 0x1c, 0x0e, 0x00, 0x6c, 0x14, 0x00, 0x58, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x60, 0x01, 0x00, 0x64, 0x00, 0x12, 0x7a, 0xc8, 0xb9, 0x01, 0x18, 0xc6,
+    0x01, 0x48, 0xb6, 0x00, 0x64, 0x00, 0x08, 0x04, 0x00, 0x12, 0xb3, 0x3c, 0x6e, 0x22, 0x4b, 0xc2,
+    0x44, 0x15, 0x00, 0xd0, 0x15, 0x04, 0x44, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00,
+    0x68, 0x00, 0x00, 0x20, 0x00, 0x04, 0xb8, 0x01, 0x00, 0xdc, 0x19, 0x00, 0x64, 0x0b, 0x01, 0x10,
+    0x02, 0x08, 0x14, 0x04, 0x0f, 0xcc, 0x02, 0x05, 0x12, 0xb3, 0x94, 0x20, 0x00, 0x74, 0x12, 0x00,
+    0xa0, 0x1a, 0x00, 0x0c, 0x1d, 0x00, 0xb0, 0x0d, 0x00, 0x58, 0x00, 0x00, 0x04, 0x00, 0x00, 0x5c,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x90, 0xa4, 0x21, 0x6c, 0xd0, 0xec, 0x15, 0x01,
+    0xac, 0x9d, 0x0d, 0x64, 0x00, 0x08, 0xd4, 0x00, 0x00, 0x0c, 0x00, 0x11, 0xb4, 0xa8, 0x9c, 0x00,
+    0xd4, 0x4e, 0x00, 0x3c, 0x01, 0x00, 0x44, 0x1a, 0x00, 0xc0, 0x02, 0x00, 0xf8, 0x02, 0x0f, 0xf0,
+    0x02, 0x15, 0x0f, 0x28, 0x00, 0x09, 0x00, 0x4c, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x74, 0xfd, 0x31,
+    0x76, 0x80, 0xc8, 0x4c, 0x1b, 0x20, 0x0e, 0x0d, 0x30, 0x0b, 0x00, 0x7c, 0x00, 0x0f, 0x04, 0x00,
+    0x2d, 0x08, 0x30, 0x01, 0x11, 0xb4, 0xc0, 0x75, 0x50, 0x01, 0x53, 0xc5, 0xff, 0x01, 0x28, 0x38,
+    0x00, 0x38, 0x11, 0x00, 0x10, 0x01, 0x00, 0x04, 0x00, 0x00, 0x20, 0x01, 0x0f, 0x04, 0x00, 0x05,
+    0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x02, 0x40, 0x79, 0xd7, 0xff, 0x01, 0xe8, 0x10,
+    0x00, 0x60, 0x13, 0x00, 0xe0, 0x0b, 0x01, 0x3c, 0x01, 0x11, 0xb3, 0x94, 0x1d, 0x00, 0x9c, 0x1d,
+    0x00, 0xa4, 0x1d, 0x0f, 0x50, 0x03, 0x59, 0x00, 0x6c, 0x00, 0x00, 0x10, 0x0f, 0x71, 0xa9, 0xb7,
+    0xdc, 0xff, 0x83, 0x8d, 0xcd, 0xd0, 0xe3, 0x20, 0x10, 0x11, 0x3c, 0x01, 0x00, 0xcc, 0x06, 0x02,
+    0xb4, 0xe0, 0x00, 0xb8, 0xe0, 0x0f, 0x04, 0x00, 0x3d, 0x02, 0x04, 0x26, 0x11, 0xb4, 0xe4, 0x2b,
+    0x00, 0x00, 0x0f, 0x00, 0xc4, 0x14, 0x00, 0x6c, 0x12, 0x00, 0x90, 0x42, 0x84, 0xc5, 0xd4, 0xe9,
+    0xee, 0xc4, 0xd4, 0xe9, 0xee, 0x60, 0x0d, 0x00, 0xa4, 0x00, 0x08, 0x04, 0x00, 0x40, 0xc7, 0xd6,
+    0xeb, 0xaa, 0x20, 0x00, 0x00, 0x28, 0x00, 0x00, 0xbc, 0x33, 0x31, 0xae, 0xbc, 0xde, 0xb8, 0x33,
+    0x00, 0x84, 0x09, 0x00, 0x24, 0x15, 0x04, 0x5c, 0x00, 0x0f, 0xb4, 0x00, 0x39, 0x04, 0x54, 0x00,
+    0x00, 0xc8, 0x11, 0x00, 0xb0, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x1c, 0x17, 0x00, 0xe4, 0xff, 0x00,
+    0x3c, 0xf4, 0x60, 0x74, 0x7c, 0xc7, 0xff, 0x39, 0x3c, 0x78, 0x8d, 0x00, 0x38, 0x01, 0x11, 0xb3,
+    0xec, 0xe1, 0x0f, 0x80, 0x00, 0x11, 0x04, 0x58, 0x00, 0x31, 0x14, 0x15, 0xb6, 0x6c, 0x04, 0x00,
+    0xd4, 0x24, 0x00, 0x58, 0x00, 0x00, 0x94, 0x01, 0x08, 0xf4, 0x00, 0x0f, 0x0c, 0x00, 0x01, 0x48,
+    0xc7, 0xd7, 0xeb, 0x88, 0x08, 0x01, 0x00, 0x5c, 0x3e, 0x00, 0x14, 0x08, 0x00, 0x2c, 0x25, 0x20,
+    0x20, 0x23, 0xb8, 0x26, 0x00, 0x8c, 0x00, 0x4f, 0xb5, 0xff, 0x06, 0x08, 0x04, 0x00, 0x10, 0x52,
+    0x07, 0xb5, 0xff, 0x06, 0x04, 0xc8, 0x16, 0x00, 0xcc, 0x16, 0x08, 0xbc, 0x00, 0x04, 0xa4, 0x00,
+    0x00, 0x94, 0xd5, 0x00, 0x58, 0x07, 0x00, 0x3c, 0x44, 0x00, 0x04, 0xdd, 0x00, 0x7c, 0x00, 0x0f,
+    0x98, 0x00, 0x01, 0x00, 0x40, 0x17, 0x00, 0xa8, 0xe4, 0x00, 0xa8, 0x0f, 0x00, 0x20, 0xb7, 0x02,
+    0x80, 0x0f, 0x06, 0x04, 0xe3, 0x08, 0x5c, 0x00, 0x0f, 0x0c, 0x00, 0x0f, 0x03, 0x94, 0x00, 0x00,
+    0x9c, 0x00, 0x00, 0xa4, 0x00, 0x04, 0xcc, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x04, 0x20,
+    0x00, 0x03, 0x60, 0xe3, 0x0f, 0x50, 0x00, 0x09, 0x11, 0x03, 0x6c, 0x0c, 0x00, 0x90, 0xe3, 0x02,
+    0xe4, 0x4b, 0x00, 0xc8, 0x0f, 0x00, 0xd0, 0x09, 0x00, 0x60, 0x0d, 0x00, 0xcc, 0x00, 0x40, 0xc5,
+    0xd4, 0xea, 0xee, 0xec, 0x17, 0x0f, 0x04, 0x00, 0x15, 0x40, 0xc5, 0xd5, 0xea, 0xcc, 0xa8, 0x10,
+    0x00, 0x8c, 0x7b, 0x00, 0x80, 0x04, 0x00, 0x64, 0x47, 0x24, 0x35, 0x39, 0x04, 0x02, 0x02, 0x3c,
+    0x03, 0x10, 0x07, 0xf4, 0xe3, 0x03, 0x9c, 0x00, 0x00, 0xa4, 0xdf, 0x00, 0x84, 0x00, 0x10, 0x01,
+    0xfc, 0x05, 0x00, 0x28, 0x6d, 0x00, 0x04, 0x04, 0x00, 0x94, 0x13, 0x00, 0x9c, 0x16, 0x00, 0x78,
+    0x0d, 0x00, 0x1c, 0x15, 0x00, 0x04, 0x00, 0x00, 0xbc, 0xd3, 0x00, 0x14, 0x00, 0x00, 0x50, 0x14,
+    0x00, 0xd4, 0x16, 0x00, 0xb0, 0x0d, 0x01, 0x54, 0x0c, 0x00, 0x8c, 0x04, 0x11, 0xb4, 0x00, 0x0e,
+    0x00, 0x94, 0x19, 0x00, 0xf0, 0x08, 0x0f, 0x80, 0x01, 0x01, 0x0f, 0x14, 0x00, 0x4d, 0x01, 0x08,
+    0x0f, 0x94, 0xb1, 0xda, 0xff, 0x6e, 0x76, 0xc5, 0xff, 0x2b, 0x2f, 0x94, 0x1d, 0x03, 0xa4, 0x1f,
+    0x00, 0xbc, 0x1b, 0x00, 0xc8, 0x0e, 0x00, 0x68, 0x0e, 0x00, 0xcc, 0x00, 0x0f, 0x04, 0x00, 0x11,
+    0x04, 0xf0, 0x00, 0x00, 0x3c, 0x15, 0x00, 0xb4, 0x18, 0x00, 0x1c, 0x01, 0x00, 0xe4, 0x10, 0xa1,
+    0x00, 0xb3, 0xff, 0x0a, 0x08, 0xb5, 0xff, 0x58, 0x5f, 0xc0, 0x9c, 0x0b, 0x00, 0xec, 0x03, 0x00,
+    0xdc, 0x00, 0x00, 0x80, 0x0a, 0x00, 0xf0, 0x03, 0x33, 0x4a, 0x50, 0xbc, 0x6c, 0x66, 0x03, 0x88,
+    0xb4, 0x00, 0xc0, 0x0e, 0x00, 0xf8, 0x14, 0x00, 0xd0, 0x14, 0x00, 0x40, 0x01, 0x00, 0x58, 0x00,
+    0x04, 0x80, 0x00, 0x00, 0x60, 0x01, 0x00, 0x14, 0x00, 0x00, 0x70, 0x01, 0x00, 0xb8, 0x1e, 0x61,
+    0x2a, 0xba, 0xff, 0x01, 0x06, 0xb5, 0x90, 0x01, 0x00, 0x98, 0x01, 0x00, 0x04, 0x00, 0x00, 0x84,
+    0xe1, 0x00, 0x64, 0xe5, 0x10, 0x01, 0x70, 0x2d, 0x00, 0x30, 0x16, 0x00, 0xfc, 0x08, 0x00, 0x48,
+    0x18, 0x00, 0x44, 0x00, 0x08, 0x4c, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x24,
+    0x00, 0x00, 0x34, 0x00, 0x00, 0xb8, 0x01, 0x61, 0x2f, 0xba, 0xff, 0x01, 0x0d, 0xb6, 0xd4, 0x1e,
+    0x00, 0x5c, 0x00, 0x00, 0x9c, 0x02, 0xe2, 0x07, 0x00, 0xb5, 0xff, 0x07, 0x03, 0xb5, 0xff, 0x06,
+    0x06, 0xb5, 0xff, 0x07, 0x08, 0x04, 0x00, 0x60, 0x06, 0x07, 0xb5, 0xff, 0x05, 0x03, 0x8c, 0x00,
+    0x30, 0xb5, 0xff, 0x01, 0x64, 0xfe, 0x00, 0x98, 0x1a, 0x00, 0x88, 0x08, 0x00, 0xc0, 0x15, 0x00,
+    0xb4, 0x1c, 0x04, 0x58, 0x00, 0x08, 0x74, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x24, 0x21, 0x00, 0xf8,
+    0x18, 0x1a, 0x13, 0x64, 0x00, 0x02, 0x68, 0x00, 0x02, 0x80, 0x02, 0x04, 0xbc, 0x03, 0x31, 0x1e,
+    0x21, 0xb6, 0xb0, 0x11, 0x00, 0x64, 0x06, 0x00, 0x5c, 0xe8, 0x00, 0x4c, 0x01, 0x00, 0x54, 0xf2,
+    0x00, 0xcc, 0xdb, 0x0f, 0xf0, 0x02, 0x15, 0x0f, 0x28, 0x00, 0x09, 0x31, 0xc5, 0xd5, 0xea, 0xa4,
+    0x38, 0x00, 0xa4, 0x10, 0x00, 0x0c, 0x13, 0x00, 0xec, 0x07, 0x02, 0xd0, 0x0d, 0x00, 0x84, 0x04,
+    0x02, 0x8c, 0x00, 0x00, 0x98, 0x00, 0x0f, 0x04, 0x00, 0x1b, 0x11, 0xb5, 0xfc, 0xe6, 0x00, 0x64,
+    0x1c, 0x00, 0x04, 0x00, 0x00, 0xd0, 0xee, 0x10, 0x02, 0xac, 0x10, 0x00, 0x8c, 0x2d, 0x00, 0x30,
+    0x18, 0x00, 0xac, 0x16, 0x00, 0xc4, 0x33, 0x08, 0x18, 0x01, 0x0f, 0x0c, 0x00, 0x09, 0x00, 0x48,
+    0x01, 0x08, 0x04, 0x02, 0x00, 0x78, 0x18, 0x01, 0x00, 0x1c, 0x00, 0x58, 0x03, 0x02, 0x34, 0xfe,
+    0x0f, 0x18, 0x2d, 0x5d, 0x00, 0xd0, 0x02, 0x04, 0x04, 0x00, 0x01, 0xe0, 0x14, 0x12, 0xab, 0x98,
+    0x16, 0x00, 0x68, 0x05, 0x00, 0xa8, 0x2d, 0x00, 0xdc, 0x14, 0x00, 0x74, 0x14, 0x0f, 0x04, 0x00,
+    0x41, 0x31, 0x55, 0x5d, 0xbf, 0x88, 0x26, 0x00, 0xec, 0x28, 0x00, 0xac, 0x05, 0x00, 0x58, 0x0b,
+    0x00, 0xd0, 0x04, 0x04, 0x90, 0x00, 0x0f, 0x08, 0x00, 0x19, 0x00, 0x3c, 0x05, 0x00, 0x4c, 0x05,
+    0x00, 0x54, 0x05, 0x00, 0x38, 0x42, 0x00, 0xbc, 0x00, 0x00, 0x70, 0x11, 0x0f, 0xb8, 0x00, 0x39,
+    0x00, 0x0c, 0x01, 0x00, 0x58, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x0c, 0x17, 0x00, 0xa4, 0x0f, 0x00,
+    0x28, 0x07, 0x40, 0xca, 0xda, 0xec, 0x22, 0x84, 0x05, 0x31, 0x91, 0x9c, 0xd2, 0xa8, 0x51, 0x31,
+    0x53, 0x5a, 0xbf, 0x4c, 0x16, 0x0f, 0x7c, 0x00, 0x15, 0x04, 0x58, 0x00, 0x00, 0x40, 0x08, 0x00,
+    0x4c, 0x0d, 0x00, 0x6c, 0x17, 0x00, 0x58, 0x00, 0x0f, 0x00, 0x01, 0x19, 0x04, 0x2c, 0x00, 0x40,
+    0xc6, 0xd5, 0xea, 0xcc, 0x2c, 0xf3, 0x00, 0x84, 0x0e, 0x31, 0x5d, 0x64, 0xc1, 0x60, 0x01, 0x0f,
+    0x08, 0x01, 0x31, 0x00, 0x44, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x88, 0x1b, 0x00,
+    0x6c, 0x01, 0x00, 0x74, 0x01, 0x04, 0x78, 0x00, 0x0f, 0x08, 0x00, 0x01, 0x00, 0x4c, 0x0a, 0x31,
+    0x96, 0xa2, 0xd4, 0x84, 0xb2, 0x00, 0xec, 0x01, 0x00, 0xec, 0x18, 0x0f, 0x14, 0x01, 0x15, 0x0f,
+    0x28, 0x00, 0x45, 0x31, 0x56, 0x5e, 0xbf, 0xe8, 0x08, 0x00, 0x74, 0x01, 0x31, 0x70, 0x79, 0xc6,
+    0x2c, 0x04, 0x00, 0x80, 0x07, 0x0f, 0xc0, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x1d, 0x00, 0x80, 0xb0,
+    0x00, 0xe0, 0x04, 0x31, 0x66, 0x6e, 0xc3, 0x00, 0x02, 0x00, 0x50, 0x18, 0x00, 0xc8, 0x00, 0x00,
+    0xd4, 0x2f, 0x00, 0x44, 0x06, 0x00, 0xb8, 0x09, 0x00, 0x34, 0x06, 0x72, 0x37, 0x3c, 0xb9, 0xff,
+    0x1d, 0x21, 0xb7, 0xa0, 0xd1, 0x00, 0x24, 0x0d, 0x00, 0xc0, 0x20, 0x00, 0x48, 0x15, 0x0f, 0x04,
+    0x00, 0x01, 0x00, 0x30, 0x22, 0x00, 0x94, 0x15, 0x61, 0x0c, 0xb6, 0xff, 0x18, 0x1c, 0xb6, 0xbc,
+    0x0f, 0x00, 0xd4, 0x08, 0x7f, 0x68, 0x71, 0xc4, 0xff, 0x95, 0xa1, 0xd3, 0x34, 0x13, 0x5e, 0x04,
+    0x14, 0x01, 0x40, 0xcc, 0xdc, 0xed, 0xaa, 0xcc, 0x4f, 0x00, 0xb4, 0x0b, 0x00, 0x2c, 0x04, 0x00,
+    0xc8, 0x12, 0x00, 0x50, 0x1a, 0x10, 0x0b, 0x28, 0x08, 0x00, 0x10, 0x15, 0x00, 0xf0, 0x88, 0x00,
+    0x3c, 0x20, 0x0f, 0xd4, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x05, 0x00, 0xf4, 0x1b, 0x00, 0xd8, 0x30,
+    0x00, 0xb0, 0x17, 0x61, 0x0e, 0xb6, 0xff, 0x1d, 0x21, 0xb6, 0xe4, 0xb1, 0x71, 0x4c, 0x52, 0xbd,
+    0xff, 0x74, 0x7d, 0xc7, 0x78, 0x0f, 0x40, 0xc4, 0xd3, 0xe9, 0xaa, 0x84, 0x00, 0x00, 0x9c, 0x1a,
+    0x00, 0xbc, 0x01, 0x00, 0x88, 0xc1, 0x00, 0x30, 0x2d, 0x00, 0x08, 0x08, 0x01, 0xf4, 0x18, 0x00,
+    0x00, 0x18, 0x00, 0x30, 0x01, 0x00, 0xe4, 0x1b, 0x0f, 0x68, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x03,
+    0xe4, 0x14, 0x31, 0x1b, 0x20, 0xb6, 0x90, 0x01, 0x00, 0x3c, 0x15, 0x00, 0x1c, 0x32, 0x00, 0x3c,
+    0x85, 0x00, 0x38, 0x06, 0x23, 0x16, 0x1b, 0x4c, 0x00, 0x00, 0x40, 0x15, 0x00, 0x84, 0x01, 0x0f,
+    0x4c, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x44, 0x19, 0x21, 0x0c, 0xb6,
+    0x4c, 0x00, 0x00, 0xd4, 0x64, 0x00, 0x5c, 0x00, 0x01, 0x14, 0x02, 0x21, 0x5f, 0xbf, 0x54, 0x08,
+    0x00, 0x1c, 0x02, 0x00, 0xd4, 0x28, 0x00, 0x1c, 0x02, 0x00, 0x20, 0x03, 0x00, 0x0c, 0x5e, 0x00,
+    0x64, 0x12, 0x00, 0x48, 0x01, 0x10, 0x03, 0x44, 0x01, 0x00, 0x04, 0x38, 0x00, 0x1c, 0x2e, 0x00,
+    0x18, 0x01, 0x0f, 0x68, 0x00, 0x01, 0x00, 0x60, 0x01, 0x00, 0xb0, 0x15, 0x61, 0x0d, 0xb6, 0xff,
+    0x11, 0x17, 0xb6, 0xfc, 0xd3, 0x00, 0xa4, 0x18, 0x00, 0x04, 0x6f, 0x00, 0x5c, 0x00, 0x00, 0x58,
+    0x00, 0x00, 0x08, 0x00, 0x08, 0xbc, 0x03, 0x00, 0x20, 0x05, 0x00, 0x4c, 0x1f, 0x00, 0x30, 0x07,
+    0x00, 0x48, 0x01, 0x0f, 0x04, 0x00, 0x41, 0x00, 0x04, 0xac, 0x00, 0x90, 0xc2, 0x00, 0xa8, 0x0b,
+    0x00, 0x30, 0x95, 0x00, 0xf8, 0x03, 0x01, 0xf8, 0x00, 0x21, 0x5e, 0xbf, 0x90, 0x00, 0x0f, 0x04,
+    0x00, 0x1d, 0x04, 0xc8, 0x00, 0x31, 0x51, 0x57, 0xbe, 0x14, 0x33, 0x00, 0x00, 0xf8, 0x10, 0x0e,
+    0x24, 0x09, 0x00, 0x3c, 0x42, 0x00, 0x34, 0x20, 0x00, 0x08, 0x01, 0x0f, 0x20, 0x01, 0x01, 0x0f,
+    0x14, 0x00, 0x09, 0x00, 0x74, 0x03, 0x00, 0x7c, 0x03, 0x03, 0x04, 0x02, 0x31, 0x2e, 0x32, 0xb8,
+    0x7c, 0x24, 0x00, 0x14, 0x04, 0x00, 0xd0, 0x0f, 0x00, 0x0c, 0x07, 0x0f, 0x1c, 0x01, 0x41, 0x0f,
+    0x54, 0x00, 0x11, 0x00, 0x98, 0x16, 0x00, 0x04, 0x15, 0x31, 0x94, 0x9f, 0xd3, 0x54, 0x06, 0x00,
+    0x14, 0x24, 0x00, 0x88, 0x19, 0x0f, 0x04, 0x00, 0x42, 0x21, 0x9e, 0xd2, 0x64, 0x00, 0x00, 0xf0,
+    0x2c, 0x00, 0x34, 0x0d, 0x00, 0x64, 0x16, 0x0f, 0xa4, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x05, 0x00,
+    0x4c, 0x05, 0x00, 0x1c, 0x15, 0x00, 0xb4, 0x12, 0x00, 0xbc, 0x00, 0x00, 0xd8, 0x33, 0x0f, 0xb8,
+    0x00, 0x3a, 0x07, 0xb0, 0x00, 0x00, 0x30, 0x08, 0x08, 0x00, 0x05, 0x00, 0x98, 0x88, 0x00, 0x20,
+    0xf2, 0x00, 0x0c, 0x0d, 0x31, 0x92, 0x9d, 0xd2, 0x28, 0x90, 0x0f, 0x7c, 0x00, 0x16, 0x08, 0x58,
+    0x00, 0x21, 0xae, 0xd9, 0x68, 0x13, 0x0f, 0xe4, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x11, 0x00, 0x1c,
+    0x16, 0x00, 0x24, 0x07, 0x0f, 0x08, 0x01, 0x39, 0x00, 0x4c, 0x01, 0x00, 0x54, 0x01, 0x00, 0xf8,
+    0x05, 0x00, 0x64, 0x01, 0x00, 0x6c, 0x01, 0x0f, 0x8c, 0x00, 0x0d, 0x00, 0x9c, 0x08, 0x00, 0x24,
+    0x10, 0x00, 0xd0, 0x1f, 0x01, 0x40, 0x00, 0x21, 0x9d, 0xd2, 0xc8, 0x98, 0x0f, 0x18, 0x01, 0x16,
+    0x2f, 0x9f, 0xd3, 0x30, 0x00, 0x3f, 0x22, 0x9e, 0xd3, 0x9c, 0x01, 0xa5, 0x9e, 0xd3, 0xff, 0x9e,
+    0xab, 0xd7, 0xff, 0xb5, 0xc3, 0xe1, 0x74, 0x2e, 0x0f, 0xd0, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x0d,
+    0x00, 0x94, 0x08, 0x31, 0xad, 0xba, 0xde, 0xd8, 0x07, 0x00, 0x00, 0x02, 0x00, 0x08, 0x02, 0x00,
+    0xec, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x60, 0x0b, 0x00, 0xb8, 0xe5, 0x00, 0x00,
+    0x17, 0x00, 0x5c, 0x06, 0x0f, 0xa0, 0x17, 0x1b, 0x11, 0xb3, 0xd4, 0x17, 0x00, 0x50, 0x05, 0x00,
+    0x00, 0x0a, 0x00, 0xdc, 0x01, 0x00, 0x70, 0x02, 0x0f, 0x74, 0xb8, 0x35, 0x0f, 0xdc, 0x00, 0x0d,
+    0x0f, 0x20, 0x00, 0x01, 0x00, 0xb0, 0x12, 0x00, 0xd0, 0x05, 0x00, 0x6c, 0x05, 0x00, 0xf4, 0x0c,
+    0x00, 0x00, 0x06, 0x00, 0x44, 0x0e, 0x05, 0x1c, 0x16, 0x01, 0xe0, 0x13, 0x0f, 0x84, 0x14, 0x25,
+    0x51, 0xb4, 0xff, 0x34, 0x38, 0xb9, 0x2c, 0x18, 0x7d, 0x80, 0x8a, 0xcc, 0xff, 0x9c, 0xa9, 0xd7,
+    0x94, 0x1a, 0x00, 0x5c, 0x02, 0x00, 0x1c, 0x0f, 0x31, 0x7a, 0x83, 0xc9, 0xdc, 0x05, 0x11, 0x28,
+    0xe8, 0xb4, 0x00, 0xd0, 0x0c, 0x0f, 0x74, 0x00, 0x15, 0x11, 0xb3, 0xd0, 0x05, 0x00, 0x90, 0x01,
+    0x00, 0x9c, 0x06, 0x00, 0xf4, 0x25, 0x00, 0x5c, 0x01, 0x00, 0x24, 0x06, 0x02, 0x44, 0x12, 0x0f,
+    0x4c, 0x00, 0x19, 0x0f, 0x74, 0x00, 0x05, 0x11, 0xb3, 0xd0, 0x3c, 0x00, 0xf4, 0x09, 0x00, 0x5c,
+    0x00, 0x00, 0xa4, 0x09, 0x00, 0x5c, 0x05, 0x00, 0x10, 0x02, 0x01, 0x1c, 0x02, 0x03, 0x0c, 0x00,
+    0x00, 0x5c, 0x03, 0x00, 0x5c, 0x18, 0x00, 0xc0, 0x09, 0x24, 0x3a, 0x40, 0x48, 0x1a, 0x0f, 0x54,
+    0x00, 0x05, 0x0e, 0x18, 0x00, 0x00, 0x30, 0x40, 0x00, 0x44, 0x08, 0x00, 0xac, 0x08, 0x00, 0x90,
+    0x01, 0x01, 0x5c, 0x00, 0x12, 0xa0, 0x40, 0x03, 0x01, 0x7c, 0x03, 0x21, 0x9c, 0xd2, 0x34, 0x02,
+    0x00, 0x18, 0x04, 0x08, 0x68, 0x31, 0x0f, 0xd8, 0x01, 0x01, 0x0f, 0x14, 0x00, 0x31, 0x00, 0x30,
+    0x0f, 0x00, 0xd4, 0x14, 0x00, 0x28, 0x09, 0x08, 0x0c, 0x03, 0x00, 0x98, 0x00, 0x0f, 0x04, 0x00,
+    0x1d, 0x00, 0x28, 0x1a, 0x31, 0x93, 0x9e, 0xd2, 0x14, 0x33, 0x91, 0x70, 0x7a, 0xc6, 0xff, 0x4a,
+    0x51, 0xbd, 0xff, 0x0d, 0xf4, 0x1b, 0x0e, 0x08, 0x01, 0x0f, 0x7c, 0x02, 0x1f, 0x51, 0xb3, 0xff,
+    0x2f, 0x34, 0xb8, 0x64, 0x39, 0x00, 0xb8, 0x0c, 0x00, 0xc0, 0x05, 0x00, 0x5c, 0x12, 0x31, 0xcb,
+    0xdb, 0xed, 0xec, 0x09, 0x0f, 0x0c, 0x01, 0x31, 0x0f, 0x44, 0x00, 0x21, 0x00, 0x40, 0x01, 0x00,
+    0x60, 0x03, 0x00, 0x6c, 0x0a, 0x00, 0x04, 0x00, 0x1f, 0xbf, 0x04, 0x00, 0x44, 0x00, 0x5c, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x74, 0x00, 0x0f, 0xac, 0x00, 0x21, 0x0c, 0x34, 0x00,
+    0x00, 0x08, 0x05, 0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xb8, 0x00, 0x39,
+    0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00, 0x60, 0x00, 0x0f, 0xb0, 0x00, 0x01, 0x00, 0x0c, 0x1d,
+    0x00, 0xb4, 0x51, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x7c, 0x00, 0x15, 0x00, 0x2c, 0x00,
+    0x00, 0x04, 0x00, 0x0f, 0x58, 0x00, 0x05, 0x0c, 0xe4, 0x00, 0x0f, 0x10, 0x00, 0x11, 0x00, 0x24,
+    0x15, 0x00, 0x50, 0x00, 0x00, 0x58, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x8c, 0x00, 0x15, 0x0f, 0x28,
+    0x00, 0x05, 0x00, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x54, 0x00, 0x00, 0x64, 0x01, 0x0f, 0x84,
+    0x00, 0x11, 0x04, 0x24, 0x00, 0x00, 0xd4, 0x0f, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x60,
+    0x00, 0x05, 0x0f, 0x18, 0x00, 0x59, 0x04, 0x88, 0x00, 0x0f, 0x10, 0x65, 0x41, 0x4c, 0xc8, 0xd8,
+    0xeb, 0x66, 0x04, 0x02, 0x00, 0xf4, 0x13, 0x00, 0x04, 0x00, 0x00, 0x6c, 0x54, 0x00, 0xc0, 0x08,
+    0x00, 0xec, 0x03, 0x00, 0x74, 0x0b, 0x02, 0xa0, 0x17, 0x00, 0xe8, 0x05, 0x00, 0x04, 0x00, 0x00,
+    0xb0, 0x13, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14,
+    0x00, 0x11, 0xb4, 0x04, 0x2c, 0x00, 0x68, 0x1b, 0x00, 0x8c, 0x27, 0x00, 0xb0, 0x0a, 0x00, 0x68,
+    0xbb, 0x04, 0x64, 0x01, 0x0f, 0x08, 0x00, 0x65, 0x40, 0xc5, 0xd4, 0xe9, 0xff, 0xf4, 0x0c, 0x73,
+    0x90, 0x9c, 0xd2, 0xff, 0x62, 0x6b, 0xc2, 0xa0, 0x25, 0x00, 0xb0, 0x00, 0x00, 0x04, 0x00, 0x04,
+    0xbc, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x06, 0x30, 0x00, 0x31, 0x08, 0x05, 0xb5,
+    0x14, 0x1b, 0x40, 0x82, 0x8c, 0xcc, 0xff, 0xd8, 0x11, 0x00, 0x78, 0x02, 0x0f, 0xe4, 0x00, 0x01,
+    0x00, 0x08, 0x0b, 0x00, 0x2c, 0x64, 0x00, 0x38, 0x64, 0x00, 0x8c, 0x28, 0x02, 0x78, 0x15, 0x00,
+    0x6c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x04, 0x00, 0x08, 0x14,
+    0x00, 0x11, 0xb4, 0x74, 0x64, 0x31, 0x7f, 0x89, 0xcb, 0xd4, 0x12, 0x00, 0xc8, 0x19, 0x00, 0x98,
+    0x09, 0x00, 0xa0, 0x2a, 0x00, 0x7c, 0x3f, 0x0a, 0x4c, 0x00, 0x08, 0x44, 0x00, 0x0f, 0x0c, 0x00,
+    0x0d, 0x00, 0x64, 0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x00, 0x11, 0xb4, 0xa4, 0x22, 0x00, 0x5c,
+    0x2a, 0x31, 0x9e, 0xaa, 0xd7, 0xa8, 0x15, 0x00, 0xcc, 0x00, 0x00, 0x10, 0x02, 0x00, 0xf4, 0x02,
+    0x13, 0xc0, 0x0c, 0x00, 0x00, 0xc8, 0x00, 0x31, 0xaa, 0xb7, 0xdd, 0x4c, 0xab, 0x00, 0xb0, 0x07,
+    0x00, 0x98, 0x1a, 0x02, 0xa4, 0x09, 0x02, 0x44, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x10, 0x00, 0x04,
+    0x04, 0x00, 0x04, 0x64, 0x00, 0x51, 0xb3, 0xff, 0x33, 0x38, 0xb9, 0x08, 0x19, 0x00, 0xe4, 0x1d,
+    0x00, 0x24, 0x20, 0x01, 0x5c, 0x00, 0x21, 0xcf, 0xe7, 0x68, 0x5e, 0x00, 0xf0, 0x02, 0x00, 0x04,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x7c, 0x16, 0x4f, 0xcf, 0xdf, 0xef, 0x22, 0x4c, 0x01, 0x01, 0x0f,
+    0x14, 0x00, 0x3d, 0x00, 0x20, 0x0a, 0x00, 0x50, 0x0e, 0x00, 0x7c, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x94, 0x00, 0x0f, 0x04, 0x00, 0x1e, 0x03, 0x20, 0x01, 0x00, 0x40, 0x00, 0x00, 0x38, 0x5f, 0x00,
+    0x90, 0x07, 0x00, 0x14, 0x66, 0x24, 0x2d, 0x30, 0x00, 0x19, 0x00, 0x0c, 0x01, 0x06, 0x08, 0x01,
+    0x0f, 0x28, 0x01, 0x03, 0x00, 0x24, 0x00, 0x08, 0x04, 0x00, 0x08, 0x30, 0x00, 0x11, 0xb5, 0x04,
+    0x1e, 0x00, 0x94, 0x03, 0x01, 0xa0, 0x08, 0x7f, 0xcc, 0xe6, 0xff, 0xcc, 0xdc, 0xed, 0x88, 0x0c,
+    0x01, 0x3d, 0x0f, 0x50, 0x00, 0xff, 0xff, 0xff, 0x7c, 0x00, 0xa4, 0x10, 0x00, 0xd4, 0x44, 0x00,
+    0xa0, 0x17, 0x00, 0x60, 0x37, 0x31, 0x46, 0x4d, 0xbc, 0x6c, 0x15, 0x00, 0x7c, 0x33, 0x0f, 0x04,
+    0x00, 0x02, 0x21, 0x53, 0xbd, 0x28, 0x06, 0x00, 0x24, 0x00, 0x00, 0x80, 0x16, 0x00, 0x44, 0x0d,
+    0x00, 0xcc, 0x07, 0x0f, 0xd4, 0x03, 0x79, 0x00, 0x1c, 0x1e, 0x31, 0xab, 0xb9, 0xdd, 0xc8, 0x0d,
+    0x00, 0x58, 0x1a, 0x00, 0x74, 0x15, 0x00, 0x64, 0x08, 0x0f, 0xd0, 0x00, 0x02, 0x2f, 0x54, 0xbd,
+    0x18, 0x00, 0x0a, 0x00, 0x4c, 0x2f, 0x00, 0xec, 0x1e, 0x00, 0xf8, 0x18, 0x31, 0x73, 0x7c, 0xc7,
+    0xac, 0x10, 0x00, 0xa4, 0x06, 0x0f, 0xf0, 0x00, 0x09, 0x00, 0x90, 0x08, 0x31, 0x96, 0xa1, 0xd4,
+    0x98, 0x16, 0x00, 0xd0, 0x15, 0x00, 0x80, 0x00, 0x2f, 0x4c, 0x53, 0x68, 0x00, 0x07, 0x00, 0x1c,
+    0x00, 0x00, 0x24, 0x00, 0x71, 0x4e, 0x54, 0xbd, 0xff, 0x6d, 0x75, 0xc5, 0xd0, 0x28, 0x00, 0x1c,
+    0x0e, 0x31, 0xc8, 0xd8, 0xeb, 0x6c, 0x0f, 0x00, 0x38, 0x0e, 0x00, 0x44, 0x15, 0x00, 0x70, 0x0d,
+    0x00, 0x28, 0x00, 0x00, 0x54, 0x00, 0x0f, 0xb4, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x02, 0x03, 0xb8,
+    0x01, 0x00, 0xe4, 0x23, 0x00, 0xdc, 0x0e, 0x00, 0x0c, 0x0e, 0x00, 0xb0, 0x1a, 0x0f, 0xc8, 0x00,
+    0x09, 0x00, 0x88, 0x1b, 0x00, 0x60, 0x13, 0x00, 0x10, 0x31, 0x00, 0xd0, 0x1a, 0x00, 0x08, 0x01,
+    0x00, 0x40, 0x00, 0x0f, 0x60, 0x00, 0x02, 0x03, 0x48, 0x01, 0x00, 0x04, 0x38, 0x00, 0x6c, 0x01,
+    0x00, 0x90, 0x2c, 0x00, 0x3c, 0x3d, 0x00, 0x90, 0xba, 0x0f, 0x44, 0x06, 0xc5, 0x40, 0xcb, 0xda,
+    0xec, 0xcc, 0xc8, 0x1e, 0x00, 0xb8, 0x2b, 0x00, 0xc8, 0x30, 0x04, 0xfc, 0x00, 0x0f, 0x20, 0x01,
+    0x09, 0x0f, 0x1c, 0x00, 0x05, 0x00, 0x50, 0x03, 0x00, 0x60, 0x01, 0x00, 0x3c, 0x10, 0x31, 0x6f,
+    0x79, 0xc6, 0x60, 0x39, 0x00, 0xe8, 0x07, 0x0f, 0xa0, 0x01, 0x09, 0x0f, 0x1c, 0x00, 0xff, 0xff,
+    0xff, 0xbc, 0x00, 0xa8, 0x0c, 0x00, 0xf4, 0x12, 0x00, 0x98, 0x14, 0x00, 0xd8, 0x27, 0x00, 0x3c,
+    0x05, 0x00, 0x60, 0x24, 0x0f, 0x04, 0x00, 0x05, 0x04, 0x24, 0x00, 0x00, 0x78, 0x15, 0x00, 0x80,
+    0x16, 0x00, 0xf4, 0x06, 0x0f, 0x10, 0x04, 0x7d, 0x00, 0x28, 0x07, 0x00, 0x48, 0x0c, 0x00, 0x54,
+    0x15, 0x00, 0xb0, 0x00, 0x00, 0x10, 0x15, 0x0f, 0xd0, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x0b, 0x11,
+    0xcf, 0xdc, 0x2f, 0x00, 0x58, 0x28, 0x00, 0xc4, 0x18, 0x0f, 0xb8, 0x06, 0x0d, 0x04, 0x08, 0x01,
+    0x00, 0x8c, 0x0f, 0x00, 0x04, 0x0e, 0x00, 0x5c, 0x00, 0x00, 0x80, 0x00, 0x0f, 0x54, 0x01, 0x0b,
+    0x02, 0x64, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x15, 0x00, 0x90, 0x01, 0x71, 0xcc, 0xdb, 0xed,
+    0xff, 0xd4, 0xe5, 0xf2, 0x88, 0x07, 0x00, 0x10, 0x0f, 0x00, 0xd4, 0x07, 0x00, 0xc4, 0x00, 0x02,
+    0x4c, 0x00, 0x11, 0xd0, 0xf0, 0x29, 0x00, 0x30, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0x3c, 0x00,
+    0x00, 0x44, 0x00, 0x00, 0x14, 0x21, 0x00, 0xc0, 0x28, 0x44, 0xc8, 0xd7, 0xeb, 0x66, 0xb0, 0x00,
+    0x0f, 0x08, 0x00, 0x05, 0x00, 0x6c, 0x26, 0x00, 0xe8, 0x10, 0x00, 0x20, 0x33, 0x04, 0x40, 0x00,
+    0x0f, 0x74, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00, 0xe0, 0x15, 0x3f, 0xaa, 0xb8, 0xdd, 0xa0, 0x13,
+    0x02, 0x0f, 0x6c, 0x00, 0x05, 0x0f, 0x18, 0x00, 0xa1, 0x00, 0x54, 0x13, 0x31, 0xa8, 0xb5, 0xdb,
+    0xe8, 0x19, 0x01, 0xfc, 0x00, 0x2f, 0x94, 0xcf, 0x9c, 0x01, 0x22, 0x00, 0x20, 0x02, 0x00, 0x40,
+    0x00, 0x00, 0x84, 0x03, 0x00, 0xec, 0x2d, 0x00, 0x80, 0x16, 0x3f, 0xcd, 0xdd, 0xee, 0xa0, 0x01,
+    0x0e, 0x0f, 0x34, 0x01, 0xa1, 0x0f, 0xb4, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x28, 0x1f, 0x00,
+    0x18, 0x14, 0x00, 0x70, 0x05, 0x00, 0x80, 0x21, 0x00, 0x00, 0x20, 0x0f, 0x04, 0x00, 0x0a, 0x21,
+    0xc7, 0xe3, 0x24, 0x20, 0x00, 0xa8, 0x0b, 0x00, 0x24, 0x06, 0x0f, 0x54, 0x03, 0x81, 0x40, 0xd0,
+    0xe0, 0xef, 0x22, 0x00, 0x06, 0x00, 0x54, 0x15, 0x00, 0x4c, 0x47, 0x00, 0xac, 0x0f, 0x0f, 0xd4,
+    0x00, 0x0a, 0x21, 0xc8, 0xe4, 0xd4, 0x00, 0x0d, 0x24, 0x00, 0x12, 0xc7, 0x14, 0x01, 0x00, 0x1c,
+    0x01, 0x00, 0xd8, 0x07, 0x0f, 0xec, 0x00, 0x19, 0x00, 0x20, 0x01, 0x00, 0x50, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x04, 0x24, 0x00, 0x00, 0x70, 0x73, 0xf1, 0x00,
+    0xca, 0xda, 0xec, 0xff, 0xd5, 0xe6, 0xf2, 0xff, 0xda, 0xea, 0xf5, 0xff, 0xd4, 0xe4, 0xf1, 0xd8,
+    0xd7, 0x00, 0xb0, 0x10, 0x01, 0xc4, 0x00, 0x03, 0x7c, 0x01, 0x0f, 0x4c, 0x00, 0x09, 0x0f, 0x1c,
+    0x00, 0x06, 0x00, 0x3c, 0x00, 0x21, 0xc7, 0xe4, 0x4c, 0x00, 0x0f, 0x80, 0x07, 0x11, 0x04, 0xec,
+    0x00, 0x00, 0xcc, 0x18, 0x00, 0xdc, 0x0f, 0x01, 0xa4, 0x00, 0x1f, 0xc7, 0x28, 0x01, 0x04, 0x04,
+    0x40, 0x01, 0x03, 0x64, 0x00, 0x00, 0xa0, 0x21, 0x3f, 0xc6, 0xd5, 0xea, 0xdc, 0x20, 0x36, 0x04,
+    0x8c, 0x00, 0x0f, 0x08, 0x00, 0x81, 0x00, 0x00, 0x19, 0x00, 0xd0, 0x59, 0x02, 0x68, 0x02, 0x02,
+    0x1c, 0x03, 0x0f, 0x84, 0x01, 0x06, 0x04, 0x28, 0x01, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x60, 0x01,
+    0x00, 0x68, 0x02, 0x00, 0x8c, 0x03, 0x4f, 0xca, 0xda, 0xec, 0xcc, 0xec, 0x00, 0x2c, 0x50, 0xff,
+    0x00, 0x00, 0x00, 0xff,
+    // titleDonkey
+    0x4f, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0xff, 0xff, 0xff, 0x3e, 0x6f, 0x8c, 0x7f, 0x00, 0x00,
+    0x8c, 0xff, 0x04, 0x00, 0xff, 0x48, 0x0f, 0xb0, 0x04, 0xff, 0xff, 0xff, 0x40, 0x0f, 0x50, 0x03,
+    0xff, 0xff, 0xff, 0x10, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x23, 0x8c,
+    0x81, 0xc4, 0x55, 0x00, 0x98, 0x5d, 0x0f, 0x04, 0x00, 0x11, 0x1f, 0xbf, 0xbc, 0x5d, 0xff, 0x48,
+    0x01, 0x18, 0x5f, 0x1f, 0x7e, 0x90, 0x01, 0x1c, 0x1f, 0x40, 0xa0, 0x62, 0xff, 0xff, 0xff, 0x3e,
+    0x0f, 0xf0, 0x5d, 0xff, 0xff, 0xaf, 0x01, 0x44, 0x06, 0x0f, 0x60, 0x65, 0xff, 0x49, 0x0f, 0x60,
+    0x01, 0x4e, 0x1f, 0x7f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x1f, 0x7e, 0xf0,
+    0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x01, 0x5c, 0x65, 0x0f, 0x8c, 0x5d, 0x4a, 0x3f, 0x63,
+    0xa5, 0xff, 0x04, 0x00, 0x52, 0x0f, 0xf4, 0x65, 0x81, 0x0f, 0xf8, 0x00, 0xb7, 0x0f, 0x74, 0x62,
+    0xff, 0xff, 0xaf, 0x0f, 0xc0, 0x02, 0xff, 0xff, 0xd7, 0x01, 0x28, 0x6d, 0x0f, 0xd0, 0x07, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x01, 0x90, 0x5d, 0x0f, 0xe4, 0xc2, 0x11, 0x04, 0x24, 0x00, 0x0f,
+    0xec, 0xc2, 0x1e, 0x0f, 0x94, 0x5c, 0x51, 0x0f, 0x64, 0x00, 0x51, 0x0f, 0xf0, 0x5d, 0x1e, 0x2f,
+    0x31, 0xf7, 0x88, 0x5e, 0x52, 0x0f, 0xfc, 0x00, 0x4d, 0x3f, 0x00, 0x31, 0xf7, 0xe0, 0x57, 0x21,
+    0x0f, 0xb4, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0x0f, 0x8c, 0xc1, 0x4e, 0x0f, 0xd4, 0x06,
+    0xb2, 0x00, 0x34, 0x07, 0x0f, 0xd0, 0x07, 0x1d, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0xb5, 0x0f,
+    0xfc, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x20, 0x0f, 0xb4, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39,
+    0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb6, 0x3f, 0x16, 0xa5, 0xec, 0xec, 0x56, 0xe6, 0x0f, 0xf0, 0x55, 0x20, 0x0f, 0xb4,
+    0xc3, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x4f, 0x63, 0xa5, 0xff, 0x81, 0xcc, 0x5b, 0x51, 0x0f, 0x48,
+    0x05, 0x20, 0x0f, 0x6c, 0x63, 0x1a, 0x0f, 0xc4, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x01,
+    0x00, 0x51, 0x0f, 0x98, 0x00, 0x1d, 0x0f, 0x93, 0x00, 0x50, 0x01, 0x63, 0x00, 0x0f, 0x98, 0x00,
+    0x1d, 0x0f, 0x30, 0x00, 0x51, 0x0f, 0x88, 0x02, 0x1d, 0x0f, 0x94, 0x00, 0x51, 0x00, 0x84, 0x03,
+    0x0f, 0xe8, 0xcb, 0xff, 0xff, 0xff, 0xff, 0x39, 0x4f, 0x63, 0xa5, 0xff, 0x7f, 0xb4, 0x04, 0x51,
+    0x0f, 0x48, 0x05, 0x1d, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0xc4, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x21,
+    0x01, 0xd9, 0x06, 0x0f, 0x05, 0x00, 0x4c, 0x0f, 0x98, 0x00, 0x1d, 0x0f, 0x8f, 0x00, 0x4c, 0x05,
+    0x5f, 0x00, 0x0f, 0x98, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x51, 0x0f, 0x58, 0x02, 0x84, 0x0f, 0xf4,
+    0x65, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x7f, 0x31, 0xf7, 0x81, 0x00, 0x31, 0xf7, 0x7f, 0x04,
+    0x00, 0x7c, 0x1f, 0x40, 0xd8, 0x59, 0x1d, 0x00, 0x0c, 0x5a, 0x03, 0xf4, 0x4d, 0x00, 0xc8, 0x55,
+    0x0f, 0x04, 0x00, 0x11, 0x1f, 0xbf, 0x68, 0x53, 0x81, 0x0f, 0x98, 0x53, 0x1d, 0x00, 0x5c, 0xc1,
+    0x0f, 0xc8, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x1d, 0x05, 0xfd, 0x54, 0x0f, 0x09, 0x00, 0x18, 0x0f,
+    0x64, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x51, 0x0f, 0xbf, 0x00, 0x18, 0x05, 0x2b, 0x00, 0x0f, 0x98,
+    0x00, 0x51, 0x0f, 0x64, 0x00, 0x1d, 0x0f, 0x58, 0x02, 0x1d, 0x0f, 0x60, 0x00, 0x1d, 0x0f, 0x30,
+    0x00, 0x24, 0x00, 0x84, 0x03, 0x0f, 0xac, 0x03, 0x11, 0x04, 0x24, 0x00, 0x1f, 0x81, 0x18, 0x04,
+    0x1d, 0x8f, 0x00, 0x31, 0xff, 0x40, 0x00, 0x31, 0xff, 0x7f, 0x04, 0x00, 0x1b, 0x0f, 0x10, 0x05,
+    0x4e, 0x0f, 0xc8, 0x00, 0x1f, 0x3f, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x1e, 0x0f, 0x34, 0x00, 0xff,
+    0xe2, 0x00, 0x6c, 0xc7, 0x0f, 0x04, 0x00, 0x7f, 0x0f, 0xd8, 0x59, 0x1e, 0x0f, 0x50, 0x04, 0x24,
+    0x0f, 0x70, 0x6b, 0x4e, 0x0f, 0x48, 0x05, 0x1d, 0x0f, 0x30, 0x00, 0x51, 0x0f, 0x2c, 0x01, 0x51,
+    0x05, 0xdd, 0x06, 0x0f, 0x09, 0x00, 0x14, 0x00, 0x94, 0x00, 0x0f, 0xfc, 0x00, 0x1d, 0x00, 0x34,
+    0x00, 0x0f, 0x04, 0x00, 0x1d, 0x0f, 0x64, 0x00, 0x1d, 0x0f, 0xbf, 0x00, 0x14, 0x09, 0x27, 0x00,
+    0x0f, 0x94, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xc8, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x1d,
+    0x0f, 0x94, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x51, 0x0f, 0xd4, 0x06, 0x1e, 0x02, 0xcc, 0x07, 0x1f,
+    0xff, 0x04, 0x00, 0x1b, 0x11, 0xf7, 0x28, 0x0b, 0x0f, 0x04, 0x00, 0x4a, 0x0f, 0x6c, 0x07, 0xff,
+    0xe2, 0x0f, 0xf4, 0x01, 0x51, 0x0f, 0xcc, 0x07, 0x7f, 0x00, 0x4c, 0x03, 0x0f, 0xd0, 0x07, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x0f, 0xcc,
+    0xbf, 0x1e, 0x0f, 0x6c, 0x52, 0x51, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x68, 0x53, 0x1d, 0x0f, 0x30,
+    0x00, 0x51, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x09, 0x01, 0x55, 0x0f, 0x0d, 0x00,
+    0x10, 0x00, 0x60, 0x00, 0x0f, 0xfc, 0x00, 0x1d, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x0f,
+    0x64, 0x00, 0x1d, 0x0f, 0xbb, 0x00, 0x10, 0x0d, 0x23, 0x00, 0x0f, 0x94, 0x00, 0x1d, 0x0f, 0x30,
+    0x00, 0x21, 0x0f, 0xc8, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0x94, 0x00, 0x21, 0x0f, 0x34,
+    0x00, 0x51, 0x0f, 0xf0, 0x55, 0x20, 0x1f, 0x7e, 0xec, 0x55, 0x1b, 0x00, 0x18, 0x56, 0x0f, 0xf0,
+    0x55, 0xff, 0xff, 0x76, 0x02, 0x5c, 0x65, 0x00, 0x30, 0x55, 0x0f, 0x04, 0x00, 0x4b, 0x0f, 0xf4,
+    0xc1, 0x1c, 0x0f, 0x4c, 0x04, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0x4c, 0x04, 0x51, 0x0f, 0x64,
+    0x00, 0x21, 0x0f, 0xcc, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x4d, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34,
+    0x00, 0xff, 0x7e, 0x0f, 0x24, 0x02, 0xe5, 0x0f, 0xf8, 0x00, 0x4d, 0x0f, 0x60, 0x00, 0x22, 0x0f,
+    0x34, 0x5b, 0x53, 0x0f, 0xc4, 0x65, 0xff, 0xe0, 0x02, 0x28, 0x6d, 0x0f, 0xcc, 0x07, 0x4b, 0x00,
+    0xbc, 0x02, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x0f, 0xd4, 0x62, 0x1e, 0x0f,
+    0xcc, 0x10, 0x1e, 0x0f, 0x30, 0x64, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x1a, 0x0f, 0xd0, 0x07, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x02, 0x90,
+    0x5d, 0x0f, 0xec, 0xc2, 0x19, 0x1f, 0xbf, 0x34, 0xb6, 0x4a, 0x0f, 0xec, 0x55, 0x59, 0x00, 0x6c,
+    0x00, 0x0f, 0x04, 0x00, 0x18, 0x0f, 0x60, 0x5c, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xff, 0xff, 0x47,
+    0x0f, 0xe0, 0x04, 0x1e, 0x0f, 0x9c, 0x5a, 0x55, 0x0f, 0xac, 0x04, 0x18, 0x0f, 0xc4, 0x00, 0x1e,
+    0x02, 0x5c, 0x00, 0x00, 0xdc, 0x05, 0x0f, 0x0c, 0x06, 0x19, 0x0f, 0xf0, 0x5d, 0xff, 0x80, 0x02,
+    0xc8, 0x01, 0x0f, 0x90, 0x5d, 0x4b, 0x0f, 0xf0, 0x02, 0x55, 0x0f, 0x68, 0x00, 0x19, 0x0f, 0xf8,
+    0x00, 0x21, 0x0f, 0x60, 0x00, 0x19, 0x0f, 0x2c, 0x00, 0x24, 0x0f, 0xa4, 0x06, 0xff, 0x4e, 0x0f,
+    0x0c, 0x63, 0x22, 0x0f, 0xcc, 0x01, 0x24, 0x0f, 0x6c, 0x00, 0x15, 0x0f, 0xf4, 0x01, 0xff, 0x1a,
+    0x0f, 0x54, 0x01, 0x15, 0x0f, 0x28, 0x00, 0x2a, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xd4, 0x00, 0x1e,
+    0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0x2c, 0x5d, 0xff, 0x1a, 0x0f, 0x2c, 0x01,
+    0x51, 0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0x10, 0x05, 0x4c, 0x0f, 0xe8, 0x02,
+    0x1e, 0x00, 0x90, 0x00, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0xdc, 0x05, 0xff, 0x1a, 0x0f, 0x2c, 0x01,
+    0x21, 0x0f, 0x2c, 0x02, 0x22, 0x00, 0x30, 0x02, 0x0f, 0x04, 0x00, 0x48, 0x0f, 0xc8, 0x00, 0x21,
+    0x0f, 0x34, 0x00, 0xe5, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e,
+    0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0xa4, 0x06, 0x51, 0x0f, 0x64, 0x00, 0xff,
+    0x1a, 0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0x0c, 0x05, 0x48, 0x0f, 0xe4, 0x02,
+    0x1e, 0x04, 0x8c, 0x00, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0xa8, 0x05, 0xe5, 0x0f, 0xf8, 0x00, 0x55,
+    0x0f, 0x30, 0x02, 0x26, 0x04, 0x38, 0x02, 0x0f, 0x08, 0x00, 0x40, 0x0f, 0xfc, 0x00, 0x55, 0x0f,
+    0x68, 0x00, 0xb1, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f,
+    0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0x6c, 0x07, 0xff, 0x1a, 0x0f, 0x2c, 0x01, 0x51,
+    0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0x04, 0x05, 0x40, 0x0f, 0xdc, 0x02, 0x1e,
+    0x0c, 0x84, 0x00, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0x74, 0x05, 0xb1, 0x0f, 0xc4, 0x00, 0x89, 0x0f,
+    0x38, 0x02, 0x2e, 0x0c, 0x48, 0x02, 0x0f, 0x10, 0x00, 0x30, 0x0f, 0x30, 0x01, 0x89, 0x0f, 0x9c,
+    0x00, 0x7d, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f, 0xc8,
+    0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0xa4, 0x06, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x1a, 0x0f,
+    0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xf4, 0x04, 0x30, 0x0f, 0xcc, 0x02, 0x1e, 0x0f,
+    0x74, 0x00, 0x0d, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0x40, 0x05, 0x7d, 0x0f, 0x90, 0x00, 0xbd, 0x0f,
+    0x48, 0x02, 0x3e, 0x0f, 0x68, 0x02, 0x0d, 0x0f, 0x20, 0x00, 0x10, 0x0f, 0x64, 0x01, 0xbd, 0x0f,
+    0xd0, 0x00, 0x49, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f,
+    0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0x6c, 0x07, 0xff, 0x1a, 0x0f, 0x2c, 0x01, 0x51,
+    0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xd4, 0x04, 0x10, 0x0f, 0xac, 0x02, 0x1e,
+    0x0f, 0x54, 0x00, 0x2d, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0x0c, 0x05, 0x49, 0x0f, 0x5c, 0x00, 0xf1,
+    0x0f, 0x68, 0x02, 0x5e, 0x0f, 0xa8, 0x02, 0x10, 0x0f, 0x98, 0x01, 0xf1, 0x0f, 0x04, 0x01, 0x15,
+    0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f, 0xc8, 0x00, 0x21,
+    0x0f, 0x34, 0x00, 0x1d, 0x0f, 0xa4, 0x06, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x1a, 0x0f, 0xc0, 0x01,
+    0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xd4, 0x04, 0x10, 0x0f, 0xac, 0x02, 0x1e, 0x0f, 0x54, 0x00,
+    0x2d, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0xd8, 0x04, 0x15, 0x0f, 0x28, 0x00, 0xff, 0x26, 0x0f, 0x68,
+    0x02, 0x5e, 0x0f, 0xa8, 0x02, 0x10, 0x0f, 0xcc, 0x01, 0xff, 0x1a, 0x0f, 0xc0, 0x01, 0x52, 0x0f,
+    0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f,
+    0x6c, 0x07, 0xff, 0x1a, 0x0f, 0x2c, 0x01, 0x51, 0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21,
+    0x0f, 0xd4, 0x04, 0x10, 0x0f, 0xac, 0x02, 0x1e, 0x0f, 0x54, 0x00, 0x2d, 0x0f, 0xc8, 0x00, 0x84,
+    0x0f, 0xdc, 0x05, 0xff, 0x1a, 0x0f, 0x2c, 0x01, 0x21, 0x0f, 0x68, 0x02, 0x5e, 0x0f, 0xa8, 0x02,
+    0x10, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0xe5, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04,
+    0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0xa4, 0x06,
+    0x51, 0x0f, 0x64, 0x00, 0xff, 0x1a, 0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xd4,
+    0x04, 0x10, 0x0f, 0xac, 0x02, 0x1e, 0x0f, 0x54, 0x00, 0x2d, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0xa8,
+    0x05, 0xe5, 0x0f, 0xf8, 0x00, 0x55, 0x0f, 0x68, 0x02, 0x5e, 0x0f, 0xa8, 0x02, 0x10, 0x0f, 0xfc,
+    0x00, 0x55, 0x0f, 0x68, 0x00, 0xb1, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc,
+    0x00, 0x1e, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0x6c, 0x07, 0xff, 0x1a, 0x0f,
+    0x2c, 0x01, 0x51, 0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xd4, 0x04, 0x10, 0x0f,
+    0xac, 0x02, 0x1e, 0x0f, 0x54, 0x00, 0x2d, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0x74, 0x05, 0xb1, 0x0f,
+    0xc4, 0x00, 0x89, 0x0f, 0x68, 0x02, 0x5e, 0x0f, 0xa8, 0x02, 0x10, 0x0f, 0x30, 0x01, 0x89, 0x0f,
+    0x9c, 0x00, 0x7d, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f,
+    0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0xa4, 0x06, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x1a,
+    0x0f, 0xc0, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xd4, 0x04, 0x10, 0x0f, 0xac, 0x02, 0x1e,
+    0x0f, 0x54, 0x00, 0x2d, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0x40, 0x05, 0x7d, 0x0f, 0x90, 0x00, 0xbd,
+    0x0f, 0x68, 0x02, 0x5e, 0x0f, 0xa8, 0x02, 0x10, 0x0f, 0x64, 0x01, 0xbd, 0x0f, 0xd0, 0x00, 0x49,
+    0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f, 0xc8, 0x00, 0x21,
+    0x0f, 0x34, 0x00, 0x1d, 0x0f, 0x6c, 0x07, 0xff, 0x1a, 0x0f, 0x2c, 0x01, 0x51, 0x0f, 0xc0, 0x01,
+    0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xd4, 0x04, 0x10, 0x0f, 0xac, 0x02, 0x1e, 0x0f, 0x54, 0x00,
+    0x2d, 0x0f, 0xc8, 0x00, 0x84, 0x0f, 0x0c, 0x05, 0x49, 0x0f, 0x5c, 0x00, 0xf1, 0x0f, 0x68, 0x02,
+    0x5e, 0x0f, 0xa8, 0x02, 0x10, 0x0f, 0x98, 0x01, 0xf1, 0x0f, 0x04, 0x01, 0x15, 0x0f, 0xc0, 0x01,
+    0x52, 0x0f, 0x1c, 0x04, 0x84, 0x0f, 0xfc, 0x00, 0x1e, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00,
+    0x1d, 0x0f, 0xa4, 0x06, 0x51, 0x0f, 0x64, 0x00, 0xe5, 0x02, 0x5c, 0x65, 0x0f, 0x8c, 0x5d, 0x4b,
+    0x00, 0xf0, 0x01, 0x0f, 0xa4, 0x04, 0x10, 0x0f, 0x7c, 0x02, 0x1e, 0x0f, 0x54, 0x00, 0xc0, 0x0f,
+    0xa4, 0x04, 0x15, 0x0f, 0x28, 0x00, 0xff, 0xff, 0xff, 0x50, 0x0f, 0x8c, 0x04, 0xf1, 0x0f, 0x04,
+    0x01, 0x12, 0x00, 0xdc, 0x05, 0x0f, 0x04, 0x00, 0x4f, 0x0f, 0xc4, 0x65, 0xff, 0x18, 0x0f, 0x1c,
+    0xbb, 0xe8, 0x0f, 0xb0, 0x02, 0x12, 0x0f, 0x34, 0x08, 0x5c, 0x0f, 0xa8, 0x07, 0xff, 0xff, 0xff,
+    0x50, 0x0f, 0x60, 0x03, 0x15, 0x0f, 0x1c, 0x04, 0x81, 0x0f, 0x94, 0x00, 0x82, 0x0f, 0xcc, 0x07,
+    0x4f, 0x00, 0x6c, 0x0e, 0x0f, 0xb4, 0xc3, 0xff, 0x18, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x02, 0x90, 0x5d, 0x0f, 0xe0,
+    0xbc, 0x19, 0x00, 0x10, 0xbd, 0x00, 0x54, 0x4f, 0x0f, 0x04, 0x00, 0x47, 0x0f, 0x34, 0x55, 0x5c,
+    0x0f, 0x18, 0x51, 0x82, 0x0f, 0x04, 0x01, 0x14, 0x0f, 0x90, 0x52, 0x15, 0x0f, 0x28, 0x00, 0xff,
+    0xff, 0xff, 0x50, 0x0f, 0x44, 0x04, 0xa9, 0x0f, 0xbc, 0x00, 0x5e, 0x0f, 0xf4, 0x55, 0x4f, 0x00,
+    0xa4, 0x06, 0x0f, 0xd4, 0x06, 0x19, 0x0f, 0xf0, 0x5d, 0xb7, 0x0f, 0x5c, 0x01, 0x4f, 0x0f, 0x30,
+    0x02, 0x5f, 0x0f, 0x0c, 0x07, 0x14, 0x0f, 0x98, 0x00, 0xb1, 0x0f, 0xa8, 0x07, 0xb9, 0x0f, 0x90,
+    0x01, 0xb1, 0x0f, 0xc4, 0x00, 0xff, 0x4e, 0x0f, 0xf0, 0x02, 0x85, 0x0f, 0xf8, 0x01, 0xff, 0x4b,
+    0x0f, 0xa4, 0x06, 0x52, 0x0f, 0x64, 0x6d, 0xb4, 0x0f, 0x2c, 0x01, 0x52, 0x1f, 0x8c, 0xd4, 0x07,
+    0xff, 0x47, 0x0f, 0xe0, 0x04, 0x85, 0x0f, 0x98, 0x00, 0x21, 0x0f, 0x14, 0x05, 0xff, 0x4b, 0x0f,
+    0xe4, 0x0a, 0xb4, 0x0f, 0x58, 0x02, 0x21, 0x0f, 0x34, 0x00, 0x51, 0x0f, 0xbc, 0x02, 0xff, 0x4b,
+    0x0f, 0xa4, 0x06, 0x52, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x02, 0x5c, 0x65, 0x0f, 0x28, 0x65, 0x47, 0x04, 0x78, 0x4f,
+    0x0f, 0x3c, 0x52, 0xb4, 0x0f, 0xa4, 0x51, 0xb1, 0x0f, 0xcc, 0x52, 0x51, 0x0f, 0x64, 0x00, 0x21,
+    0x0f, 0x5c, 0x01, 0x1d, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x34, 0x00, 0xff, 0xe2, 0x0f, 0x58, 0x02,
+    0x85, 0x0f, 0x98, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0xff, 0x4b, 0x04, 0xa8, 0x06, 0x0f, 0x08, 0x00,
+    0x4b, 0x0f, 0xc4, 0x65, 0x4f, 0x0f, 0x1c, 0xbb, 0xff, 0x7d, 0x0f, 0xb4, 0x03, 0x51, 0x0f, 0xd4,
+    0x06, 0x85, 0x0f, 0xfc, 0x00, 0x1d, 0x0f, 0xc8, 0x00, 0x85, 0x0f, 0x98, 0x00, 0xff, 0x7e, 0x0f,
+    0x58, 0x02, 0x85, 0x0f, 0x98, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0xff, 0x4b, 0x0f, 0xc8, 0x07, 0x4b,
+    0x04, 0x30, 0x0f, 0x0f, 0xb4, 0xc3, 0x4f, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x0f, 0xbc, 0x5d, 0xff, 0x79, 0x01, 0x34,
+    0x52, 0x2f, 0x31, 0xf7, 0x94, 0x54, 0xff, 0x7f, 0x0f, 0x90, 0x01, 0xff, 0xde, 0x01, 0x60, 0x54,
+    0x0f, 0x18, 0x05, 0xff, 0x81, 0x01, 0x98, 0x01, 0x00, 0x9c, 0x01, 0x0f, 0x04, 0x00, 0x43, 0x0f,
+    0xf0, 0x55, 0x83, 0x0f, 0x88, 0x02, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xb4, 0x0f, 0xd4, 0x06, 0xff,
+    0xde, 0x0f, 0xf0, 0x01, 0x89, 0x01, 0xf8, 0x0a, 0x0f, 0x58, 0x03, 0xb4, 0x0f, 0xcc, 0x00, 0xff,
+    0x47, 0x0f, 0xf4, 0x07, 0x1f, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcb, 0x01, 0x54, 0xc1, 0x0f, 0x7c, 0xbb, 0xff, 0xff, 0x0f, 0x00, 0x20, 0x02, 0x0f, 0x80,
+    0xbb, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xf8, 0xbf, 0x51, 0x0f, 0xc4, 0xc1, 0x89, 0x0f, 0x9c, 0x00,
+    0xff, 0x16, 0x0f, 0x28, 0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0xff, 0x14, 0x0f, 0xd0, 0x07, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x11, 0x7e,
+    0xb0, 0x58, 0x0f, 0xbc, 0x4e, 0x19, 0x00, 0xbc, 0x56, 0x0f, 0x04, 0x00, 0xff, 0xff, 0xa6, 0x0f,
+    0x54, 0x55, 0xff, 0x16, 0x0f, 0x28, 0x01, 0x89, 0x0f, 0x8c, 0x55, 0xff, 0xff, 0x14, 0x0f, 0xa0,
+    0x06, 0x51, 0x0f, 0x34, 0x07, 0x19, 0x02, 0x2c, 0x00, 0x5f, 0x7e, 0x00, 0x00, 0x00, 0xff, 0x04,
+    0x00, 0x1a, 0x02, 0x38, 0x00, 0x1f, 0xff, 0xa4, 0x07, 0x1a, 0x0f, 0xfc, 0x00, 0x51, 0x0f, 0x64,
+    0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01,
+    0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0,
+    0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff,
+    0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34,
+    0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2,
+    0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4,
+    0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f,
+    0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03,
+    0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64,
+    0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01,
+    0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0,
+    0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff,
+    0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34,
+    0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2,
+    0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4,
+    0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f,
+    0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03,
+    0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64,
+    0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01,
+    0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0,
+    0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff,
+    0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34,
+    0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f, 0xf4, 0x01, 0xff, 0xe2,
+    0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03, 0xff, 0xe2, 0x0f, 0xf4,
+    0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64, 0x00, 0xff, 0x4a, 0x0f,
+    0xf4, 0x01, 0xff, 0xe2, 0x0f, 0x50, 0x03, 0xff, 0x4a, 0x0f, 0x5c, 0x01, 0x51, 0x0f, 0xb4, 0x03,
+    0xff, 0xe2, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xc0, 0x02, 0x51, 0x0f, 0x64,
+    0x00, 0xff, 0x1a, 0x0f, 0xc4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0x90, 0x01, 0xff, 0x1a,
+    0x0f, 0x2c, 0x01, 0xff, 0xff, 0x43, 0x0f, 0xb0, 0x03, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0xb8,
+    0x02, 0xff, 0x7e, 0x0f, 0xc4, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xf8, 0x01, 0xff, 0x7a,
+    0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xf4, 0x01, 0xff, 0x7a, 0x0f, 0x8c, 0x01,
+    0xff, 0xe2, 0x0f, 0xb4, 0x03, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x5c, 0x02, 0xff, 0x7a, 0x0f,
+    0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xf4, 0x01, 0xff, 0xff, 0xff, 0x70, 0x0f, 0x80,
+    0x03, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x0f, 0xa8, 0x05, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f,
+    0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x12, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21,
+    0x0f, 0x8c, 0x01, 0xff, 0x12, 0x0f, 0x24, 0x01, 0x55, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00,
+    0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0xff, 0xff, 0x08, 0x0f, 0xb4, 0x03, 0x21,
+    0x0f, 0x34, 0x00, 0x21, 0x0f, 0x80, 0x03, 0xff, 0x7a, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00,
+    0x21, 0x0f, 0xf4, 0x01, 0xff, 0xff, 0xff, 0x70, 0x0f, 0x80, 0x03, 0xff, 0x7a, 0x0f, 0x8c, 0x01,
+    0x55, 0x0f, 0xa8, 0x05, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00,
+    0xff, 0x12, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x8c, 0x01, 0xff, 0x12, 0x0f,
+    0x24, 0x01, 0x55, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f,
+    0x68, 0x00, 0xff, 0xff, 0xff, 0x08, 0x0f, 0xb4, 0x03, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x80,
+    0x03, 0xff, 0x7a, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xf4, 0x01, 0xff, 0xff,
+    0xff, 0x70, 0x0f, 0x80, 0x03, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x0f, 0xa8, 0x05, 0x21, 0x0f,
+    0x34, 0x00, 0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x12, 0x0f, 0xc0, 0x01, 0x21,
+    0x0f, 0x34, 0x00, 0x21, 0x0f, 0x8c, 0x01, 0xff, 0x12, 0x0f, 0x24, 0x01, 0x55, 0x0f, 0xc0, 0x01,
+    0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0xff, 0xff, 0x08,
+    0x0f, 0xb4, 0x03, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x80, 0x03, 0xff, 0x7a, 0x0f, 0xc0, 0x01,
+    0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xf4, 0x01, 0xff, 0xff, 0xff, 0x70, 0x0f, 0x80, 0x03, 0xff,
+    0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x0f, 0xa8, 0x05, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xd0, 0x00,
+    0x55, 0x0f, 0x68, 0x00, 0xff, 0x12, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x8c,
+    0x01, 0xff, 0x12, 0x0f, 0x24, 0x01, 0x55, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f,
+    0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0xff, 0xff, 0x08, 0x0f, 0xb4, 0x03, 0x21, 0x0f, 0x34,
+    0x00, 0x21, 0x0f, 0x80, 0x03, 0xff, 0x7a, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f,
+    0xf4, 0x01, 0xff, 0xff, 0xff, 0x70, 0x0f, 0x80, 0x03, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x0f,
+    0xa8, 0x05, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x12,
+    0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x8c, 0x01, 0xff, 0x12, 0x0f, 0x24, 0x01,
+    0x55, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00,
+    0xff, 0xff, 0xff, 0x08, 0x0f, 0xb4, 0x03, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x80, 0x03, 0xff,
+    0x7a, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0xf4, 0x01, 0xff, 0xff, 0xff, 0x70,
+    0x0f, 0x80, 0x03, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x0f, 0xa8, 0x05, 0x21, 0x0f, 0x34, 0x00,
+    0x21, 0x0f, 0xd0, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x12, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x34,
+    0x00, 0x21, 0x0f, 0x8c, 0x01, 0xff, 0x12, 0x0f, 0x24, 0x01, 0x25, 0x0f, 0x90, 0x01, 0x21, 0x0f,
+    0x34, 0x00, 0x1d, 0x0f, 0x9c, 0x00, 0x1d, 0x01, 0x60, 0x00, 0x1f, 0xff, 0x04, 0x00, 0x1b, 0x0f,
+    0x64, 0x00, 0x1c, 0x0f, 0x60, 0xc9, 0x21, 0x0f, 0x90, 0x00, 0x1a, 0x2f, 0x31, 0xff, 0x64, 0x00,
+    0xb6, 0x01, 0xfc, 0xc6, 0x0f, 0x60, 0x01, 0x1c, 0x0f, 0x24, 0xca, 0x1e, 0x01, 0xf4, 0x01, 0x0f,
+    0x68, 0xc7, 0x1b, 0x0f, 0x60, 0x01, 0xb5, 0x0f, 0xc8, 0x00, 0x22, 0x0f, 0x90, 0x01, 0x1d, 0x0f,
+    0x4c, 0x03, 0x19, 0x01, 0x2c, 0x00, 0x1f, 0xf7, 0xc4, 0x01, 0x52, 0x01, 0x5c, 0x02, 0x0f, 0xfc,
+    0x01, 0x19, 0x0f, 0xf8, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0xff, 0x1a, 0x0f, 0x88, 0x01, 0x19, 0x0f,
+    0x2c, 0x00, 0x29, 0x0f, 0x94, 0x01, 0xff, 0x1a, 0x0f, 0x2c, 0x01, 0x1d, 0x0f, 0x98, 0x01, 0x29,
+    0x0f, 0x3c, 0x00, 0x15, 0x0f, 0x94, 0x00, 0x22, 0x0f, 0xcc, 0x07, 0x18, 0x00, 0x80, 0x04, 0x0f,
+    0x64, 0x00, 0x1c, 0x0f, 0x44, 0x05, 0x22, 0x00, 0x68, 0x00, 0x0f, 0x04, 0x00, 0x18, 0x0f, 0x64,
+    0x00, 0xb5, 0x01, 0x74, 0x05, 0x0f, 0x60, 0x01, 0x1c, 0x0f, 0x0c, 0x06, 0x51, 0x0f, 0x60, 0x01,
+    0xb5, 0x0f, 0xc8, 0x00, 0x22, 0x0f, 0x90, 0x01, 0x1d, 0x0f, 0xb8, 0x02, 0x18, 0x02, 0xb8, 0x0a,
+    0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb8, 0x0f, 0x58, 0x54, 0x15, 0x04, 0x28, 0x00, 0x0f, 0x0c, 0x51, 0x1d, 0x0f,
+    0x30, 0x00, 0xe9, 0x04, 0x34, 0x01, 0x0f, 0x08, 0x00, 0x49, 0x0f, 0x60, 0x01, 0x21, 0x0f, 0x90,
+    0x00, 0x1d, 0x0f, 0x64, 0x00, 0x1d, 0x2f, 0x31, 0xf7, 0x60, 0x5d, 0x22, 0x0f, 0x9c, 0x53, 0x21,
+    0x0f, 0x34, 0x00, 0xad, 0x01, 0xf0, 0x55, 0x0f, 0x90, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x20, 0x0f,
+    0x28, 0x01, 0xad, 0x0f, 0xc0, 0x00, 0x55, 0x01, 0x90, 0x01, 0x0f, 0xf0, 0x02, 0x20, 0x01, 0x38,
+    0x00, 0x0f, 0x98, 0x01, 0x15, 0x0f, 0x60, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x0f, 0x5c, 0x00, 0x15,
+    0x0f, 0x28, 0x00, 0x29, 0x00, 0x68, 0x00, 0x0f, 0x04, 0x00, 0xff, 0x16, 0x0f, 0x68, 0x01, 0x29,
+    0x0f, 0x3c, 0x00, 0x79, 0x0f, 0xf0, 0x01, 0xff, 0x16, 0x00, 0x28, 0x01, 0x0f, 0xb8, 0x01, 0x21,
+    0x00, 0x38, 0x00, 0x0f, 0x04, 0x00, 0xad, 0x0f, 0xf8, 0x00, 0x20, 0x0f, 0xb0, 0x05, 0x55, 0x0f,
+    0x68, 0x00, 0x81, 0x02, 0xd4, 0x5b, 0x0f, 0x54, 0x5f, 0x19, 0x0f, 0x5c, 0x65, 0x4f, 0x0f, 0x28,
+    0x01, 0x81, 0x0f, 0x94, 0x00, 0x21, 0x0f, 0x5c, 0x01, 0x22, 0x0f, 0x80, 0x03, 0xad, 0x00, 0xc0,
+    0x00, 0x0f, 0x84, 0x03, 0x20, 0x0f, 0x18, 0x60, 0x1e, 0x00, 0x68, 0x00, 0x0f, 0x04, 0x00, 0xe5,
+    0x0f, 0x60, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x81, 0x0f, 0xc0, 0x01, 0xe5, 0x0f, 0xf8, 0x00, 0x21,
+    0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x68, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x7d, 0x0f, 0xf8, 0x00, 0x20,
+    0x0f, 0xac, 0x05, 0x21, 0x0f, 0x34, 0x00, 0xb5, 0x0f, 0x74, 0x06, 0x22, 0x0f, 0x64, 0x01, 0x18,
+    0x0f, 0x28, 0x01, 0xb5, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x5c, 0x01, 0x22, 0x0f, 0x50, 0x03, 0x7d,
+    0x0f, 0x90, 0x00, 0x21, 0x0f, 0x20, 0x02, 0x18, 0x05, 0x5c, 0x10, 0x0f, 0x68, 0x00, 0x21, 0x0f,
+    0x34, 0x00, 0xe5, 0x0f, 0x60, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x81, 0x0f, 0xc0, 0x01, 0xe5, 0x0f,
+    0xf8, 0x00, 0x21, 0x0f, 0xc0, 0x01, 0x21, 0x0f, 0x68, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x7d, 0x0f,
+    0xf8, 0x00, 0x20, 0x0f, 0xac, 0x05, 0x21, 0x0f, 0x34, 0x00, 0xb5, 0x0f, 0x74, 0x06, 0x22, 0x0f,
+    0x64, 0x01, 0x18, 0x0f, 0x28, 0x01, 0xb5, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x5c, 0x01, 0x22, 0x0f,
+    0x50, 0x03, 0x7d, 0x0f, 0x90, 0x00, 0x21, 0x0f, 0x20, 0x02, 0x18, 0x0f, 0xd0, 0x07, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x2f, 0x00, 0x00, 0x04, 0x00, 0x1b, 0x35, 0x31, 0xf7,
+    0x7e, 0x1c, 0x48, 0x0f, 0x50, 0x48, 0x15, 0x0f, 0xac, 0x48, 0x21, 0x0f, 0x34, 0x00, 0xe5, 0x0f,
+    0x54, 0x01, 0x15, 0x08, 0x28, 0x00, 0x0f, 0x2c, 0x01, 0x4d, 0x08, 0x6c, 0x00, 0x0f, 0x0c, 0x00,
+    0x44, 0x0f, 0xc8, 0x4b, 0x21, 0x0f, 0x34, 0x00, 0xe9, 0x0f, 0xc4, 0x4c, 0x22, 0x0f, 0xbc, 0x01,
+    0x18, 0x0f, 0x5c, 0x01, 0xe9, 0x0f, 0xfc, 0x00, 0x21, 0x0f, 0x90, 0x01, 0x4d, 0x01, 0x74, 0x05,
+    0x0f, 0xe8, 0x03, 0x81, 0x0f, 0x94, 0x00, 0x4d, 0x0f, 0x60, 0x00, 0xb9, 0x0f, 0x80, 0x03, 0x18,
+    0x01, 0xf0, 0x01, 0x00, 0x6c, 0x07, 0x0f, 0x9c, 0x07, 0x19, 0x0f, 0x2c, 0x00, 0x21, 0x33, 0x31,
+    0xf7, 0x7f, 0x6c, 0x00, 0x0f, 0x3c, 0xc7, 0x17, 0x0f, 0x94, 0x01, 0xb9, 0x0f, 0xcc, 0x00, 0x4d,
+    0x0f, 0xf4, 0x01, 0x1f, 0x0f, 0x38, 0xc7, 0x1f, 0x0f, 0xc4, 0x00, 0x1d, 0x0f, 0x94, 0x00, 0x21,
+    0x0f, 0x34, 0x00, 0x1c, 0x0f, 0x44, 0x05, 0x21, 0x0f, 0x34, 0x00, 0xe9, 0x0f, 0x40, 0x06, 0x4d,
+    0x0f, 0x5c, 0x01, 0xe9, 0x0f, 0xfc, 0x00, 0x21, 0x0f, 0x90, 0x01, 0x4d, 0x01, 0x74, 0x05, 0x0f,
+    0xb8, 0x03, 0x1d, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0xb4, 0x03, 0x1c, 0x0f, 0x94, 0x00, 0x52, 0x0f,
+    0xc4, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x89, 0x0f, 0x60, 0x01, 0x1f, 0x1f, 0x7f, 0x6c, 0x0f, 0x1a,
+    0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbc, 0x0f, 0x24, 0xc2, 0x20, 0x01, 0x44, 0x51, 0x0f, 0x18, 0x50, 0x19, 0x0f, 0xe0,
+    0x50, 0x51, 0x0f, 0x90, 0x00, 0x19, 0x0f, 0x2c, 0x00, 0x24, 0x0f, 0x64, 0x53, 0x21, 0x0f, 0x34,
+    0x00, 0xe9, 0x0f, 0x60, 0x54, 0x4d, 0x0f, 0x5c, 0x01, 0xe9, 0x0f, 0xfc, 0x00, 0x21, 0x0f, 0x90,
+    0x01, 0x4d, 0x01, 0x18, 0x04, 0x0f, 0xec, 0x03, 0x80, 0x0f, 0x2c, 0x01, 0x1d, 0x0f, 0xc8, 0x00,
+    0x56, 0x0f, 0x2c, 0x01, 0x51, 0x0f, 0x64, 0x00, 0x1d, 0x0f, 0x1c, 0x05, 0x1f, 0x0f, 0xf0, 0x55,
+    0xff, 0x7b, 0x0f, 0xec, 0x02, 0x1d, 0x00, 0x30, 0x00, 0x0f, 0xa0, 0xbe, 0x82, 0x0f, 0x88, 0x02,
+    0x1f, 0x0f, 0xdc, 0x5f, 0x17, 0x03, 0x5c, 0x00, 0x00, 0xfc, 0x00, 0x0f, 0x04, 0x00, 0x51, 0x0f,
+    0x60, 0x01, 0x1d, 0x0f, 0x94, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x40, 0x06, 0x4d, 0x0f,
+    0x94, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x51, 0x0f, 0xc0, 0x01, 0x85, 0x0f, 0x90, 0x01, 0x4d, 0x0f,
+    0x08, 0x07, 0x85, 0x0f, 0xf4, 0x01, 0x21, 0x0f, 0xc4, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0xb6, 0x03,
+    0xec, 0x04, 0x01, 0xcc, 0x01, 0x0f, 0x0c, 0x00, 0x13, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x0f, 0x78, 0x58, 0x86, 0x0f, 0x3c, 0x58, 0x13, 0x0a, 0x84, 0x5d, 0x0f,
+    0x7c, 0x60, 0x1e, 0x0f, 0xd4, 0x5a, 0x1b, 0x0f, 0x08, 0x5a, 0x21, 0x0f, 0x34, 0x00, 0xb5, 0x0f,
+    0x28, 0x01, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0xf8, 0x00, 0x55, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00,
+    0x19, 0x0f, 0x98, 0x00, 0x55, 0x0f, 0x68, 0x00, 0x81, 0x0f, 0x28, 0x01, 0x19, 0x01, 0x2c, 0x00,
+    0x0f, 0x50, 0x03, 0x1e, 0x0b, 0x90, 0x03, 0x0f, 0xc4, 0x03, 0x11, 0x0f, 0x64, 0x00, 0x1d, 0x0f,
+    0x30, 0x00, 0xff, 0x4e, 0x0f, 0xb4, 0x01, 0x11, 0x0a, 0x24, 0x00, 0x0f, 0xc0, 0x5d, 0xff, 0x7b,
+    0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0x5f, 0x40, 0x00, 0x31, 0xf7, 0x7f, 0x04,
+    0x00, 0x18, 0x1f, 0x7e, 0xf8, 0x54, 0x86, 0x0f, 0xb0, 0x58, 0x51, 0x0a, 0x90, 0x57, 0x0f, 0x84,
+    0x59, 0x1f, 0x0f, 0x40, 0x00, 0x40, 0x0f, 0x00, 0x5b, 0x51, 0x0f, 0x64, 0xb6, 0x18, 0x05, 0x14,
+    0x01, 0x0f, 0x98, 0x00, 0x51, 0x0f, 0x64, 0x00, 0xff, 0xff, 0x43, 0x0f, 0xec, 0x02, 0x85, 0x0f,
+    0x98, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x4e, 0x0f, 0x74, 0x05, 0x51, 0x0f, 0x64, 0x00, 0x85, 0x3f,
+    0x31, 0xf7, 0x7e, 0x38, 0x07, 0x18, 0x00, 0x64, 0x07, 0x5f, 0x40, 0x00, 0x00, 0x00, 0xff, 0x04,
+    0x00, 0x7f, 0x2f, 0x8c, 0xff, 0xd4, 0x07, 0xe2, 0x0f, 0x8c, 0x07, 0x40, 0x0f, 0x70, 0x03, 0x31,
+    0x0f, 0xd4, 0x06, 0x51, 0x0f, 0xf0, 0x01, 0x1e, 0x01, 0x2c, 0x01, 0x0f, 0xc4, 0x65, 0x1b, 0x0f,
+    0x0c, 0x01, 0x31, 0x0f, 0x44, 0x00, 0x71, 0x0f, 0x90, 0x01, 0x51, 0x0f, 0x64, 0x00, 0x51, 0x01,
+    0x68, 0x64, 0x0f, 0xc4, 0x01, 0x1a, 0x0f, 0x64, 0x64, 0x20, 0x01, 0x28, 0x02, 0x0f, 0x38, 0x00,
+    0x80, 0x0f, 0x44, 0x06, 0x1c, 0x0f, 0x90, 0x01, 0xea, 0x0f, 0x2c, 0x01, 0x1c, 0x0f, 0x4c, 0x04,
+    0x1e, 0x0f, 0x60, 0x00, 0x86, 0x0f, 0x9c, 0x07, 0x81, 0x0f, 0x94, 0x00, 0x21, 0x0f, 0xd0, 0x07,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x0f, 0x08, 0x5a, 0x51, 0x0f, 0x64, 0x00, 0x21,
+    0x0f, 0x74, 0x59, 0x52, 0x0f, 0xcc, 0x5b, 0x1c, 0x0f, 0xc8, 0x00, 0x21, 0x0f, 0x34, 0x00, 0xff,
+    0xb2, 0x0f, 0x58, 0x5e, 0x1e, 0x0f, 0x00, 0x5c, 0x50, 0x0f, 0x58, 0x02, 0x85, 0x0f, 0x2c, 0x01,
+    0x1e, 0x0f, 0x84, 0x03, 0x1c, 0x01, 0x30, 0x61, 0x0f, 0x60, 0x01, 0x50, 0x0f, 0x80, 0x04, 0x52,
+    0x0f, 0xc8, 0x00, 0x1e, 0x0f, 0x2c, 0x5d, 0x21, 0x0f, 0x34, 0x00, 0x81, 0x0f, 0xc0, 0x5d, 0xff,
+    0x48, 0x0f, 0x18, 0x04, 0x86, 0x0f, 0xec, 0x02, 0x1e, 0x0f, 0x24, 0x02, 0x20, 0x0f, 0x4c, 0x04,
+    0x1c, 0x0f, 0x2c, 0x01, 0x85, 0x0f, 0x98, 0x00, 0xff, 0x4e, 0x0f, 0xa4, 0x06, 0x1e, 0x0f, 0xbc,
+    0x02, 0x50, 0x0f, 0xf4, 0x01, 0x85, 0x0f, 0x2c, 0x01, 0x1e, 0x0f, 0x84, 0x03, 0x1c, 0x0f, 0xd0,
+    0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x24, 0x5f, 0x81, 0x00, 0x00, 0x8c, 0x7f, 0x04, 0x00, 0x18, 0x1f, 0xbf, 0x80, 0x57, 0x83,
+    0x0f, 0x94, 0x54, 0x1c, 0x2f, 0x31, 0xf7, 0xd8, 0x51, 0x1e, 0x01, 0x10, 0x51, 0x0f, 0x44, 0x51,
+    0x18, 0x0f, 0x60, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x55, 0x0f, 0xc0, 0x01, 0x52, 0x0f, 0x28, 0x01,
+    0x18, 0x00, 0x58, 0x01, 0x0f, 0xfc, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x7e, 0x0f, 0xc4, 0x54,
+    0x1e, 0x0f, 0xf0, 0x55, 0xff, 0x19, 0x0f, 0xec, 0x02, 0x1d, 0x00, 0x88, 0x03, 0x0f, 0x1c, 0x04,
+    0x52, 0x0f, 0xc4, 0x01, 0x4f, 0x00, 0xa4, 0x06, 0x0f, 0xd4, 0x06, 0x19, 0x1f, 0x81, 0x18, 0xc3,
+    0x7f, 0x0f, 0x1c, 0x5e, 0x55, 0x01, 0xfc, 0x07, 0x0f, 0x84, 0xc3, 0xae, 0x0f, 0xec, 0x02, 0x1d,
+    0x00, 0x30, 0x00, 0x0f, 0x7c, 0x04, 0x1d, 0x00, 0x34, 0x00, 0x0f, 0x04, 0x00, 0x1d, 0x0f, 0x50,
+    0x03, 0xb4, 0x05, 0x58, 0xcb, 0x01, 0x24, 0x04, 0x0f, 0xdc, 0x07, 0x10, 0x0f, 0x28, 0x01, 0x1d,
+    0x00, 0x30, 0x00, 0x0f, 0x90, 0x01, 0x52, 0x0f, 0x84, 0xc2, 0x1a, 0x1f, 0xff, 0x24, 0x0a, 0x1e,
+    0x00, 0xc8, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x0f, 0xfc, 0x00, 0xb5, 0x0f, 0xc8, 0x00, 0x1d, 0x0f,
+    0x20, 0x03, 0xb5, 0x0f, 0xf4, 0x01, 0x86, 0x0f, 0x6c, 0x07, 0x4f, 0x0f, 0x3c, 0x06, 0x51, 0x1f,
+    0x7f, 0xa0, 0x07, 0xe7, 0x0f, 0x08, 0x08, 0x1d, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x32, 0x3f, 0x31, 0xf7, 0x7f, 0x94, 0x5b, 0x15, 0x05, 0x28, 0x00, 0x0f, 0x14, 0x58, 0x50,
+    0x0f, 0x10, 0x59, 0x22, 0x0f, 0x98, 0x00, 0x1c, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d,
+    0x0f, 0xa0, 0x5a, 0xb5, 0x0f, 0xc8, 0x00, 0x1e, 0x0f, 0xe4, 0x5d, 0x10, 0x05, 0x50, 0x02, 0x03,
+    0x2c, 0x00, 0x0f, 0x5c, 0x01, 0x1d, 0x00, 0x30, 0x00, 0x0f, 0x30, 0x5c, 0x1d, 0x00, 0x34, 0x00,
+    0x0f, 0x04, 0x00, 0x1d, 0x0f, 0x64, 0x00, 0x52, 0x0f, 0xbc, 0x02, 0x1c, 0x0f, 0x94, 0x00, 0x52,
+    0x0f, 0xec, 0x5e, 0x1c, 0x01, 0xd0, 0x01, 0x0f, 0xc8, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0xb4, 0x0f,
+    0x54, 0x02, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x0f, 0x84, 0x03, 0x1d, 0x0f, 0x64, 0x00, 0x51, 0x0f,
+    0x94, 0x00, 0x1d, 0x01, 0x30, 0x00, 0x03, 0xf0, 0x03, 0x01, 0x30, 0x02, 0x0f, 0x0c, 0x00, 0x13,
+    0x0f, 0xc0, 0x5d, 0xff, 0x18, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x0f,
+    0xa8, 0x57, 0x13, 0x05, 0xe8, 0xb9, 0x0f, 0x7c, 0x58, 0x21, 0x0f, 0x34, 0x00, 0x81, 0x01, 0xb0,
+    0x58, 0x0f, 0xa4, 0x5a, 0xb1, 0x0f, 0xc0, 0x01, 0x1c, 0x0f, 0x9c, 0x59, 0x18, 0x0f, 0xf4, 0x01,
+    0x26, 0x0f, 0x64, 0x00, 0x57, 0x1f, 0xff, 0x30, 0x5d, 0x1a, 0x0f, 0x88, 0x02, 0x1d, 0x01, 0xc8,
+    0x00, 0x0f, 0x24, 0x02, 0x1d, 0x01, 0x5c, 0x5d, 0x06, 0x3c, 0x01, 0x01, 0x44, 0x00, 0x0f, 0xa4,
+    0x01, 0x0c, 0x0f, 0x98, 0x00, 0x22, 0x0f, 0x54, 0x00, 0x0c, 0x0f, 0x78, 0x00, 0x11, 0x0f, 0x24,
+    0x00, 0x0a, 0x0f, 0xf8, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x84, 0x0f, 0x5c, 0x01, 0x1d, 0x0f, 0x30,
+    0x00, 0x85, 0x0f, 0xac, 0x01, 0x0a, 0x0f, 0x0c, 0x02, 0x01, 0x0f, 0x90, 0x01, 0x21, 0x0f, 0xbc,
+    0x02, 0x1f, 0x0f, 0xc0, 0x5d, 0xff, 0x7c, 0x01, 0x08, 0x02, 0x0f, 0x14, 0x05, 0x1b, 0x0f, 0x58,
+    0x02, 0x1d, 0x0f, 0x20, 0x03, 0x21, 0x0f, 0x6c, 0x07, 0x1d, 0x0f, 0x64, 0x00, 0x51, 0x0f, 0x94,
+    0x00, 0x1d, 0x0f, 0x30, 0x00, 0x56, 0x01, 0xc4, 0x01, 0x0f, 0x40, 0x06, 0x1b, 0x0f, 0x9c, 0x00,
+    0x4e, 0x0f, 0x94, 0x00, 0x51, 0x01, 0x64, 0x00, 0x0f, 0xbc, 0x02, 0x1c, 0x0f, 0xe4, 0x04, 0x21,
+    0x0f, 0x34, 0x00, 0x1d, 0x01, 0x98, 0x00, 0x0f, 0x90, 0x01, 0xe0, 0x0f, 0x28, 0x01, 0x1d, 0x0f,
+    0x30, 0x00, 0x54, 0x0f, 0x1c, 0x04, 0x51, 0x0f, 0x64, 0x00, 0x22, 0x01, 0x3c, 0x07, 0x0f, 0xc0,
+    0x02, 0x19, 0x0f, 0x54, 0x02, 0x1c, 0x00, 0x88, 0x02, 0x0f, 0x64, 0x01, 0x1d, 0x0f, 0x94, 0x00,
+    0x1e, 0x1f, 0xff, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0f, 0xe0, 0x57,
+    0x1d, 0x00, 0x30, 0x00, 0x00, 0x18, 0x58, 0x0f, 0x04, 0x00, 0x4c, 0x0f, 0x10, 0x59, 0x21, 0x0f,
+    0x34, 0x00, 0x1d, 0x0f, 0xc4, 0x5c, 0x4e, 0x00, 0x2c, 0x01, 0x0f, 0x04, 0x00, 0xb6, 0x1f, 0x00,
+    0x04, 0x00, 0xff, 0x7d, 0x1f, 0x8c, 0xc0, 0x02, 0xff, 0x17, 0x0f, 0x18, 0x04, 0x1d, 0x0f, 0x30,
+    0x00, 0x21, 0x0f, 0x14, 0x68, 0x19, 0x02, 0x2c, 0x00, 0x0f, 0x8c, 0x5d, 0x50, 0x0f, 0x7c, 0x04,
+    0x21, 0x0f, 0xd8, 0x05, 0x1f, 0x0f, 0xc0, 0x5d, 0xff, 0x7c, 0x0f, 0xf4, 0x01, 0x53, 0x0f, 0x6c,
+    0x6a, 0x1a, 0x00, 0xf0, 0x65, 0x0f, 0x54, 0x03, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0x10, 0x05,
+    0xff, 0x16, 0x02, 0x28, 0x01, 0x0f, 0xcc, 0x07, 0xff, 0x7a, 0x00, 0x8c, 0x01, 0x0f, 0xd0, 0x07,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x14, 0x5f, 0x40, 0x00, 0x31, 0xf7, 0x7f, 0x04, 0x00, 0x18, 0x12, 0x7e, 0x9c, 0x53,
+    0x0f, 0x0c, 0x52, 0x4c, 0x0f, 0xe4, 0x57, 0x1f, 0x0f, 0xf0, 0x55, 0x82, 0x0f, 0x20, 0x56, 0x1e,
+    0x00, 0xf8, 0x00, 0x0f, 0x20, 0x57, 0x21, 0x0f, 0x34, 0x00, 0x7f, 0x5f, 0xbf, 0x00, 0x00, 0x8c,
+    0x7f, 0x04, 0x00, 0x18, 0x1f, 0x81, 0xbc, 0x5d, 0xff, 0x7c, 0x01, 0xf0, 0x55, 0x1f, 0x81, 0xc0,
+    0x01, 0x18, 0x00, 0xec, 0x01, 0x00, 0xf4, 0x01, 0x0f, 0xf4, 0x5d, 0xaf, 0x2f, 0x31, 0xf7, 0xb8,
+    0x03, 0x1e, 0x0f, 0x30, 0x00, 0x51, 0x02, 0x94, 0x5d, 0x0f, 0x4c, 0xbb, 0x7c, 0x0f, 0x78, 0x04,
+    0x21, 0x3f, 0x31, 0xf7, 0x7e, 0x70, 0x06, 0x18, 0x00, 0x9c, 0x06, 0x1f, 0x40, 0x1c, 0x04, 0xff,
+    0x4c, 0x0f, 0xcc, 0x07, 0x4c, 0x0f, 0x24, 0x02, 0x23, 0x0f, 0xd0, 0x07, 0xb2, 0x00, 0x18, 0x04,
+    0x0f, 0x30, 0x09, 0x52, 0x0f, 0x64, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x1b, 0x0f, 0x44, 0x61, 0xff,
+    0x18, 0x0f, 0x84, 0x66, 0xb6, 0x01, 0xc0, 0x09, 0x0f, 0xd0, 0x07, 0xae, 0x00, 0x84, 0x03, 0x0f,
+    0x04, 0x00, 0x81, 0x0f, 0xd0, 0x07, 0x22, 0x0f, 0xb4, 0x03, 0x1b, 0x0f, 0xbc, 0x01, 0x54, 0x00,
+    0x2c, 0x0a, 0x0f, 0x04, 0x00, 0xff, 0x7a, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x0f, 0x90, 0x5d, 0xff, 0x81,
+    0x0f, 0x64, 0x53, 0x4d, 0x01, 0xf0, 0x5d, 0x0f, 0x34, 0x54, 0x54, 0x0f, 0xa4, 0x52, 0x47, 0x0f,
+    0xec, 0x55, 0x81, 0x00, 0x94, 0x00, 0x0f, 0xf0, 0x55, 0xff, 0xff, 0xdc, 0x0f, 0xa8, 0x58, 0x50,
+    0x00, 0x54, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f, 0xc0, 0x5d, 0x83, 0x0f, 0x0c, 0x06, 0x4d, 0x0f,
+    0x60, 0x00, 0xff, 0xe6, 0x0f, 0x98, 0x07, 0x47, 0x0f, 0x48, 0x03, 0x25, 0x0f, 0xe4, 0x03, 0x51,
+    0x00, 0x64, 0x00, 0x0f, 0xa0, 0x00, 0x25, 0x0f, 0x38, 0x00, 0xaf, 0x0f, 0xec, 0x03, 0xff, 0x7e,
+    0x0f, 0x84, 0x03, 0x7f, 0x0f, 0xe4, 0x02, 0x51, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f,
+    0xcc, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0x84, 0x03, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xb5,
+    0x0f, 0x4c, 0x04, 0x7f, 0x0f, 0xe4, 0x03, 0x51, 0x00, 0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f,
+    0x2c, 0x01, 0x7f, 0x0f, 0xc4, 0x00, 0x23, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0xb5, 0x0f,
+    0x58, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0x1b, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f, 0x24,
+    0x03, 0x23, 0x0f, 0xcc, 0x00, 0x1b, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8,
+    0x00, 0xff, 0x7e, 0x0f, 0xb8, 0x02, 0x4d, 0x0f, 0x60, 0x00, 0x1f, 0x0f, 0xe4, 0x03, 0x51, 0x00,
+    0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f, 0xcc, 0x00, 0x1f, 0x0f, 0x64, 0x00, 0x83, 0x0f, 0x84,
+    0x03, 0xff, 0xff, 0x11, 0x0f, 0xb8, 0x02, 0x51, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f,
+    0xcc, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0x84, 0x03, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xb5,
+    0x0f, 0xa4, 0x06, 0x7f, 0x0f, 0xe4, 0x03, 0x51, 0x00, 0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f,
+    0x2c, 0x01, 0x7f, 0x0f, 0xc4, 0x00, 0x23, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0xb5, 0x0f,
+    0x58, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0x1b, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f, 0x24,
+    0x03, 0x23, 0x0f, 0xcc, 0x00, 0x1b, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8,
+    0x00, 0xff, 0x7e, 0x0f, 0xb8, 0x02, 0x4d, 0x0f, 0x60, 0x00, 0x1f, 0x0f, 0xe4, 0x03, 0x51, 0x00,
+    0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f, 0xcc, 0x00, 0x1f, 0x0f, 0x64, 0x00, 0x83, 0x0f, 0x84,
+    0x03, 0xff, 0xff, 0x11, 0x0f, 0xb8, 0x02, 0x51, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f,
+    0xcc, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0x84, 0x03, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xb5,
+    0x0f, 0xa4, 0x06, 0x7f, 0x0f, 0xe4, 0x03, 0x51, 0x00, 0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f,
+    0x2c, 0x01, 0x7f, 0x0f, 0xc4, 0x00, 0x23, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0xb5, 0x0f,
+    0x58, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0x1b, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f, 0x24,
+    0x03, 0x23, 0x0f, 0xcc, 0x00, 0x1b, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8,
+    0x00, 0xff, 0x7e, 0x0f, 0xb8, 0x02, 0x4d, 0x0f, 0x60, 0x00, 0x1f, 0x0f, 0xe4, 0x03, 0x51, 0x00,
+    0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f, 0xcc, 0x00, 0x1f, 0x0f, 0x64, 0x00, 0x83, 0x0f, 0x84,
+    0x03, 0xff, 0xff, 0x11, 0x0f, 0xb8, 0x02, 0x51, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f,
+    0xcc, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0x84, 0x03, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xb5,
+    0x0f, 0xa4, 0x06, 0x7f, 0x0f, 0xe4, 0x03, 0x51, 0x00, 0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f,
+    0x2c, 0x01, 0x7f, 0x0f, 0xc4, 0x00, 0x23, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0xb5, 0x0f,
+    0x58, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0x1b, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f, 0x24,
+    0x03, 0x23, 0x0f, 0xcc, 0x00, 0x1b, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8,
+    0x00, 0xff, 0x7e, 0x0f, 0xb8, 0x02, 0x4d, 0x0f, 0x60, 0x00, 0x1f, 0x0f, 0xe4, 0x03, 0x51, 0x00,
+    0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f, 0xcc, 0x00, 0x1f, 0x0f, 0x64, 0x00, 0x83, 0x0f, 0x84,
+    0x03, 0xff, 0xff, 0x11, 0x0f, 0xb8, 0x02, 0x51, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f,
+    0xcc, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0x84, 0x03, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xb5,
+    0x0f, 0xa4, 0x06, 0x7f, 0x0f, 0xe4, 0x03, 0x51, 0x00, 0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f,
+    0x2c, 0x01, 0x7f, 0x0f, 0xc4, 0x00, 0x23, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0xb5, 0x0f,
+    0x58, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0x1b, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f, 0x24,
+    0x03, 0x23, 0x0f, 0xcc, 0x00, 0x1b, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8,
+    0x00, 0xff, 0x7e, 0x0f, 0xb8, 0x02, 0x4d, 0x0f, 0x60, 0x00, 0x1f, 0x0f, 0xe4, 0x03, 0x51, 0x00,
+    0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f, 0xcc, 0x00, 0x1f, 0x0f, 0x64, 0x00, 0x83, 0x0f, 0x84,
+    0x03, 0xff, 0xff, 0x11, 0x0f, 0xb8, 0x02, 0x51, 0x00, 0x84, 0x03, 0x0f, 0x04, 0x00, 0x51, 0x0f,
+    0xcc, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x1f, 0x0f, 0x84, 0x03, 0xff, 0x7e, 0x0f, 0x90, 0x01, 0xb5,
+    0x0f, 0xa4, 0x06, 0x7f, 0x0f, 0xe4, 0x03, 0x51, 0x00, 0x64, 0x00, 0x0f, 0x84, 0x03, 0x1f, 0x0f,
+    0x2c, 0x01, 0x7f, 0x0f, 0xc4, 0x00, 0x23, 0x0f, 0xbc, 0x02, 0xb5, 0x0f, 0xc8, 0x00, 0x4f, 0x8f,
+    0x63, 0xa5, 0xff, 0x81, 0x63, 0xa5, 0xff, 0x7f, 0x04, 0x00, 0x19, 0x0f, 0x34, 0xbf, 0x1c, 0x10,
+    0x7e, 0x8c, 0x02, 0x0f, 0x04, 0x00, 0x4d, 0x0f, 0x28, 0x02, 0x23, 0x0f, 0xf0, 0x02, 0x4b, 0x0f,
+    0xf4, 0x00, 0x4d, 0x04, 0x60, 0x00, 0x0f, 0xfc, 0x00, 0x1d, 0x04, 0x38, 0x00, 0x0f, 0x08, 0x00,
+    0x15, 0x30, 0x16, 0xa5, 0xec, 0xf8, 0xc0, 0x00, 0x00, 0xc1, 0x0f, 0x04, 0x00, 0x15, 0x0f, 0x5c,
+    0x65, 0xff, 0xe1, 0x0f, 0xac, 0x04, 0x4f, 0x02, 0x24, 0xc1, 0x01, 0xc4, 0x65, 0x0f, 0x88, 0x02,
+    0x15, 0x10, 0x7f, 0xbc, 0x02, 0x0f, 0xe8, 0x02, 0x15, 0x04, 0x28, 0x00, 0x0f, 0x50, 0x03, 0x4d,
+    0x04, 0x68, 0x00, 0x0f, 0x08, 0x00, 0x1d, 0x0f, 0x98, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x51, 0x0f,
+    0xc4, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x21, 0x30, 0x00, 0x00, 0x8c, 0x94, 0xc9, 0x0f, 0xf4, 0x01,
+    0x16, 0x0f, 0xcc, 0x06, 0x19, 0x03, 0x2c, 0x00, 0x0f, 0xb0, 0x04, 0xb6, 0x0f, 0x60, 0x01, 0x24,
+    0x0f, 0x14, 0x69, 0x1a, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x34, 0x00, 0x1d, 0x0f, 0xbc, 0x02, 0x51,
+    0x0f, 0x64, 0x00, 0x1d, 0x0f, 0xc4, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x25, 0x0f, 0x98, 0x00, 0x50,
+    0x0f, 0xec, 0xc2, 0xff, 0xe1, 0x0f, 0xa0, 0x07, 0x55, 0x0f, 0x68, 0x00, 0x4b, 0x03, 0xb0, 0x05,
+    0x0f, 0xc0, 0xca, 0x1a, 0x0f, 0x50, 0x03, 0x50, 0x0f, 0x90, 0x00, 0x1a, 0x04, 0x18, 0x04, 0x0f,
+    0x98, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x51, 0x04, 0x9c, 0x00, 0x0f, 0x08, 0x00, 0x49, 0x0f, 0xc8,
+    0x00, 0x1d, 0x0f, 0x8c, 0x00, 0x21, 0x02, 0x2c, 0x0a, 0x0f, 0x8c, 0x02, 0x4b, 0x0f, 0x64, 0x00,
+    0x51, 0x0f, 0xfc, 0x00, 0x23, 0x0f, 0xd8, 0x0e, 0x1b, 0x0f, 0x64, 0x00, 0x21, 0x0f, 0x34, 0x00,
+    0x1d, 0x0f, 0xf4, 0x01, 0x1d, 0x0f, 0x30, 0x00, 0x51, 0x0f, 0xc4, 0x00, 0x1d, 0x0f, 0x30, 0x00,
+    0x25, 0x0f, 0xcc, 0x00, 0x1d, 0x0f, 0x68, 0x00, 0x20, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0x03, 0x5c, 0x65, 0x0f, 0x1c, 0x58, 0x1a, 0x0f, 0x44, 0xc5, 0x1d, 0x0f, 0x2c, 0x54, 0x20, 0x0f,
+    0x90, 0x00, 0x1a, 0x04, 0x60, 0x00, 0x0f, 0xc4, 0x54, 0x50, 0x0f, 0x98, 0x00, 0x22, 0x04, 0xa0,
+    0x00, 0x0f, 0x08, 0x00, 0x45, 0x0f, 0xf8, 0x00, 0x84, 0x0f, 0xf0, 0x55, 0xff, 0xff, 0xdc, 0x0f,
+    0xdc, 0x03, 0x21, 0x0f, 0xb8, 0x03, 0x84, 0x0f, 0xe4, 0x04, 0x4e, 0x0f, 0xf8, 0x00, 0x85, 0x0f,
+    0xd8, 0x06, 0x50, 0x0f, 0xc4, 0x65, 0x4e, 0x0f, 0x7c, 0x60, 0x22, 0x1f, 0x31, 0xfc, 0x00, 0x1b,
+    0x0f, 0xec, 0x02, 0x21, 0x0f, 0x34, 0x00, 0x21, 0x0f, 0x28, 0x02, 0x85, 0x0f, 0xcc, 0x00, 0x21,
+    0x0f, 0x34, 0x00, 0x19, 0x0f, 0xf8, 0x00, 0x84, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x06, 0x0f, 0x14, 0x05, 0x4e, 0x0f, 0xd0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x03, 0xf0, 0x4d, 0x0f, 0xec, 0xc2, 0x19, 0x1f, 0xbf,
+    0x5c, 0x54, 0x19, 0x0f, 0x2c, 0x00, 0xff, 0xe9, 0x00, 0xe4, 0xc4, 0x0f, 0x58, 0x02, 0x19, 0x1f,
+    0x40, 0x3c, 0xb6, 0x51, 0x0f, 0x64, 0x00, 0xff, 0xff, 0x43, 0x4f, 0x63, 0xa5, 0xff, 0x40, 0x48,
+    0x05, 0x1c, 0x00, 0x1c, 0x03, 0x0f, 0xf8, 0x5c, 0x4e, 0x0f, 0x7c, 0x05, 0xff, 0xb1, 0x00, 0x6c,
+    0x07, 0x0f, 0x44, 0x05, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0x58, 0x02, 0x1e, 0x0f, 0x8c, 0x5d, 0x19,
+    0x00, 0x2c, 0x00, 0x0f, 0x58, 0x02, 0xff, 0xb1, 0x0f, 0x24, 0x02, 0x1f, 0x0f, 0x38, 0xbe, 0xb0,
+    0x0f, 0xfc, 0x07, 0xff, 0xff, 0x43, 0x04, 0x54, 0x02, 0x0f, 0x14, 0x05, 0xff, 0xe3, 0x0f, 0xc8,
+    0x64, 0x85, 0x0f, 0x98, 0x00, 0x84, 0x0f, 0x24, 0x03, 0xff, 0x7a, 0x04, 0xb8, 0x04, 0x0f, 0x08,
+    0x00, 0xff, 0xff, 0xff, 0x08, 0x0f, 0xac, 0x04, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x00, 0xdc,
+    0x0e, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x98, 0x00, 0xed, 0x0f, 0x00, 0x01, 0x55, 0x0f, 0x68, 0x00,
+    0xff, 0x12, 0x0f, 0xc8, 0x07, 0xff, 0xff, 0xff, 0x08, 0x04, 0x18, 0x03, 0x0f, 0x44, 0x04, 0xff,
+    0x12, 0x0f, 0x24, 0x01, 0xbd, 0x0f, 0xcc, 0x07, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0x00, 0x01, 0x55,
+    0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x98, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x7a,
+    0x04, 0xb8, 0x04, 0x0f, 0x08, 0x00, 0xff, 0xff, 0xff, 0x08, 0x0f, 0xac, 0x04, 0xff, 0x7a, 0x0f,
+    0x8c, 0x01, 0x55, 0x0f, 0x34, 0x07, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0x98, 0x00, 0xed, 0x0f, 0x00,
+    0x01, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x12, 0x0f, 0xc8, 0x07, 0xff, 0xff, 0xff, 0x08, 0x04, 0x18,
+    0x03, 0x0f, 0x44, 0x04, 0xff, 0x12, 0x0f, 0x24, 0x01, 0xbd, 0x00, 0xa4, 0x07, 0x0f, 0x04, 0x00,
+    0x19, 0x0f, 0x00, 0x01, 0x55, 0x0f, 0x94, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0x98, 0x00, 0x55,
+    0x0f, 0x68, 0x00, 0xff, 0x7a, 0x04, 0xb8, 0x04, 0x0f, 0x08, 0x00, 0xff, 0xff, 0xff, 0x08, 0x0f,
+    0xac, 0x04, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x00, 0x0c, 0x07, 0x0f, 0x04, 0x00, 0x19, 0x0f,
+    0x98, 0x00, 0xed, 0x0f, 0x00, 0x01, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x12, 0x0f, 0xc8, 0x07, 0xff,
+    0xff, 0xff, 0x08, 0x04, 0x18, 0x03, 0x0f, 0x44, 0x04, 0xff, 0x12, 0x0f, 0x24, 0x01, 0xbd, 0x0f,
+    0xcc, 0x07, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0x00, 0x01, 0x55, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00,
+    0x19, 0x0f, 0x98, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x7a, 0x04, 0xb8, 0x04, 0x0f, 0x08, 0x00,
+    0xff, 0xff, 0xff, 0x08, 0x0f, 0xac, 0x04, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x0f, 0x34, 0x07,
+    0x19, 0x00, 0x2c, 0x00, 0x0f, 0x98, 0x00, 0xed, 0x0f, 0x00, 0x01, 0x55, 0x0f, 0x68, 0x00, 0xff,
+    0x12, 0x0f, 0xc8, 0x07, 0xff, 0xff, 0xff, 0x08, 0x04, 0x18, 0x03, 0x0f, 0x44, 0x04, 0xff, 0x12,
+    0x0f, 0x24, 0x01, 0xbd, 0x00, 0xa4, 0x07, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x00, 0x01, 0x55, 0x0f,
+    0x94, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0x98, 0x00, 0x55, 0x0f, 0x68, 0x00, 0xff, 0x7a, 0x04,
+    0xb8, 0x04, 0x0f, 0x08, 0x00, 0xff, 0xff, 0xff, 0x08, 0x0f, 0xac, 0x04, 0xff, 0x7a, 0x0f, 0x8c,
+    0x01, 0x55, 0x00, 0x0c, 0x07, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x98, 0x00, 0xed, 0x0f, 0x00, 0x01,
+    0x55, 0x0f, 0x68, 0x00, 0xff, 0x12, 0x0f, 0xc8, 0x07, 0xff, 0xff, 0xff, 0x08, 0x04, 0x18, 0x03,
+    0x0f, 0x44, 0x04, 0xff, 0x12, 0x0f, 0x24, 0x01, 0xbd, 0x0f, 0xcc, 0x07, 0x19, 0x00, 0x2c, 0x00,
+    0x0f, 0x00, 0x01, 0x55, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x98, 0x00, 0x55, 0x0f,
+    0x68, 0x00, 0xff, 0x7a, 0x04, 0xb8, 0x04, 0x0f, 0x08, 0x00, 0xff, 0xff, 0xff, 0x08, 0x0f, 0xac,
+    0x04, 0xff, 0x7a, 0x0f, 0x8c, 0x01, 0x55, 0x0f, 0x34, 0x07, 0x19, 0x00, 0x2c, 0x00, 0x0f, 0x98,
+    0x00, 0x1c, 0x50, 0xff, 0x63, 0xa5, 0xff, 0xff,
+    // start
+    0x4f, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x3f, 0x0e,
+    0x1b, 0x0a, 0xe4, 0x06, 0xff, 0xff, 0xc4, 0x3f, 0x01, 0x01, 0x01, 0xd8, 0x02, 0xff, 0xff, 0xc4,
+    0x0f, 0x90, 0x0c, 0xff, 0xae, 0x3f, 0xfe, 0xfe, 0xfe, 0x04, 0x00, 0x0e, 0x04, 0xe4, 0x01, 0x0f,
+    0x28, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x04, 0x2c, 0x00, 0x08, 0x08, 0x00, 0x00, 0x18, 0x00, 0x0f,
+    0x04, 0x00, 0x05, 0x08, 0x28, 0x00, 0x04, 0x0c, 0x00, 0x0f, 0x2c, 0x00, 0x05, 0x08, 0x18, 0x00,
+    0x04, 0x2c, 0x00, 0x08, 0x08, 0x00, 0x08, 0x20, 0x00, 0x0f, 0x0c, 0x00, 0x05, 0x08, 0x30, 0x00,
+    0x0f, 0x0c, 0x00, 0x55, 0x0c, 0x8c, 0x00, 0x39, 0xfd, 0xfe, 0xfd, 0x04, 0x00, 0x04, 0x20, 0x00,
+    0x04, 0x90, 0x00, 0x00, 0x10, 0x00, 0x2f, 0xfd, 0xfd, 0x04, 0x00, 0x03, 0x35, 0xfe, 0xfe, 0xfd,
+    0xb0, 0x01, 0x04, 0x30, 0x00, 0x00, 0x08, 0x00, 0x00, 0x34, 0x00, 0x00, 0x04, 0x00, 0x31, 0xfc,
+    0xfe, 0xfb, 0x04, 0x00, 0x33, 0xfd, 0xfe, 0xfc, 0x04, 0x00, 0x1f, 0xfa, 0x30, 0x00, 0x02, 0xb1,
+    0xf3, 0xfa, 0xf6, 0xff, 0xf8, 0xfe, 0xf4, 0xff, 0xfa, 0xff, 0xfd, 0x04, 0x00, 0x39, 0xfb, 0xff,
+    0xfc, 0x04, 0x00, 0x3f, 0xfc, 0xff, 0xfc, 0x38, 0x00, 0x06, 0x00, 0xbc, 0x00, 0x5b, 0xf8, 0xfe,
+    0xfc, 0xff, 0xf9, 0x04, 0x00, 0x13, 0xfa, 0x7c, 0x00, 0x00, 0x88, 0x00, 0x00, 0x94, 0x00, 0x0f,
+    0x04, 0x00, 0x59, 0x00, 0x74, 0x00, 0x00, 0x04, 0x00, 0x35, 0xfb, 0xfc, 0xfb, 0xb8, 0x00, 0x00,
+    0x10, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x98, 0x00, 0x01, 0x1c, 0x00, 0x43, 0xfd, 0xff, 0xff,
+    0xfd, 0x04, 0x00, 0x1b, 0xfe, 0x04, 0x00, 0x31, 0xfa, 0xfd, 0xf6, 0x4c, 0x00, 0x04, 0x30, 0x00,
+    0x00, 0x08, 0x00, 0x01, 0x34, 0x00, 0x23, 0xfe, 0xfe, 0x5c, 0x01, 0x04, 0x64, 0x01, 0x00, 0x08,
+    0x00, 0x06, 0x78, 0x00, 0x00, 0x28, 0x00, 0x04, 0x04, 0x00, 0x02, 0x68, 0x01, 0xdd, 0xf6, 0xff,
+    0xfb, 0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfd, 0x04, 0x00, 0x04, 0x54, 0x00,
+    0x00, 0x08, 0x00, 0x08, 0x38, 0x00, 0xd0, 0xfa, 0xfc, 0xfa, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xfa,
+    0xfd, 0xfd, 0xff, 0xfa, 0x40, 0x00, 0x00, 0x04, 0x00, 0x92, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfd,
+    0xff, 0xfd, 0xfd, 0x08, 0x02, 0x04, 0x30, 0x00, 0x0f, 0x08, 0x00, 0x51, 0x00, 0xa0, 0x00, 0x0f,
+    0x04, 0x00, 0x19, 0x04, 0x94, 0x00, 0x00, 0x34, 0x00, 0x00, 0x08, 0x01, 0x0f, 0x04, 0x00, 0x09,
+    0x08, 0x2c, 0x00, 0x00, 0x30, 0x00, 0x04, 0x04, 0x00, 0x0f, 0x34, 0x00, 0x01, 0x04, 0x1c, 0x00,
+    0x00, 0x08, 0x00, 0x04, 0x38, 0x00, 0x00, 0x28, 0x00, 0x04, 0x68, 0x01, 0x31, 0xf7, 0xfb, 0xf7,
+    0x10, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x34, 0x00, 0x04, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x0f,
+    0x24, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x00, 0x30, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0x04, 0x00, 0x55,
+    0x00, 0x70, 0x00, 0x00, 0x80, 0x03, 0x13, 0xfa, 0x84, 0x03, 0x0f, 0x78, 0x00, 0x21, 0x01, 0x44,
+    0x00, 0x21, 0xfe, 0xff, 0xde, 0x03, 0x00, 0x0c, 0x00, 0x0c, 0x44, 0x00, 0x00, 0x14, 0x00, 0x62,
+    0xfa, 0xfb, 0xfe, 0xff, 0xfa, 0xfd, 0xb8, 0x02, 0x0c, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0xe8,
+    0x03, 0x00, 0xe4, 0x03, 0x35, 0xf8, 0xff, 0xfc, 0xbc, 0x0a, 0x00, 0x1c, 0x01, 0x04, 0x68, 0x01,
+    0x00, 0x44, 0x00, 0x00, 0x28, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x2f,
+    0xfb, 0xfe, 0x5c, 0x00, 0x03, 0x00, 0x20, 0x00, 0x31, 0xfc, 0xfd, 0xff, 0xe4, 0x00, 0x00, 0x0c,
+    0x00, 0x0c, 0x40, 0x00, 0x0f, 0x10, 0x00, 0x55, 0x00, 0x7c, 0x00, 0x00, 0xf6, 0x04, 0x0f, 0x68,
+    0x01, 0x2d, 0x00, 0x40, 0x04, 0x01, 0xde, 0x03, 0x25, 0xfe, 0xfe, 0x28, 0x01, 0x04, 0xc4, 0x00,
+    0x00, 0x64, 0x00, 0x62, 0xfb, 0xfd, 0xfd, 0xff, 0xfb, 0xfe, 0x50, 0x05, 0x04, 0x18, 0x00, 0x08,
+    0x08, 0x00, 0x0f, 0x68, 0x01, 0x29, 0x6f, 0xfa, 0xfe, 0xfc, 0xff, 0xfc, 0xfd, 0x5c, 0x00, 0x03,
+    0x00, 0x7c, 0x00, 0x13, 0xfc, 0x04, 0x00, 0x3d, 0xf7, 0xfa, 0xf7, 0x9c, 0x00, 0x08, 0x84, 0x00,
+    0x0f, 0x0c, 0x00, 0x49, 0x00, 0x88, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x0f, 0x80, 0x00, 0x0d, 0x00,
+    0x40, 0x00, 0x00, 0x68, 0x01, 0x10, 0xff, 0x46, 0x05, 0x0f, 0x68, 0x01, 0x04, 0x00, 0x24, 0x00,
+    0x04, 0x68, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x98, 0x02, 0x0c, 0xd0, 0x02,
+    0x31, 0xf9, 0xfe, 0xf6, 0x24, 0x01, 0x0f, 0x30, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x0c, 0xac,
+    0x00, 0x00, 0x24, 0x00, 0x31, 0xfc, 0xfe, 0xfd, 0x44, 0x00, 0x00, 0x80, 0x06, 0x0c, 0x20, 0x00,
+    0x0f, 0x10, 0x00, 0x59, 0x00, 0x8c, 0x00, 0x06, 0x04, 0x00, 0x11, 0xfb, 0x44, 0x08, 0x00, 0x6c,
+    0x03, 0x35, 0xfb, 0xfe, 0xfd, 0x14, 0x05, 0x0f, 0x90, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x00, 0x68,
+    0x01, 0x0f, 0xd0, 0x02, 0x09, 0x00, 0x24, 0x00, 0x00, 0x68, 0x01, 0x00, 0x54, 0x00, 0x71, 0xfb,
+    0xfc, 0xfe, 0xff, 0xfc, 0xfc, 0xff, 0x64, 0x00, 0x08, 0x04, 0x00, 0x00, 0xb0, 0x06, 0x0f, 0x68,
+    0x01, 0x05, 0x00, 0x90, 0x02, 0x0e, 0x04, 0x00, 0x11, 0xff, 0x6c, 0x07, 0x00, 0x5c, 0x00, 0x00,
+    0x04, 0x00, 0x0f, 0xa4, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x0f,
+    0x68, 0x01, 0x6d, 0x04, 0xa0, 0x00, 0x00, 0x90, 0x00, 0x11, 0xff, 0x44, 0x0b, 0x30, 0xff, 0xff,
+    0xfd, 0x70, 0x05, 0x07, 0x68, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x28, 0x00, 0x0c, 0x08, 0x00, 0x00,
+    0x1c, 0x00, 0x01, 0x04, 0x00, 0x0f, 0xe4, 0x05, 0x04, 0x00, 0x68, 0x05, 0x31, 0xfa, 0xfe, 0xfa,
+    0x38, 0x04, 0x10, 0xfc, 0x0c, 0x0a, 0x00, 0x64, 0x00, 0x00, 0xa0, 0x08, 0x00, 0x08, 0x00, 0x01,
+    0x80, 0x08, 0x9f, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0x68, 0x01, 0x02, 0x01,
+    0x5c, 0x00, 0x03, 0x2c, 0x00, 0x05, 0x0c, 0x00, 0x12, 0xff, 0x34, 0x08, 0x04, 0x10, 0x00, 0x0c,
+    0x94, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x00, 0x0f, 0xd0, 0x02, 0x75, 0x08, 0x94, 0x00, 0x00,
+    0x98, 0x00, 0x08, 0x04, 0x00, 0x00, 0x24, 0x01, 0x08, 0x10, 0x00, 0x04, 0x2c, 0x00, 0x08, 0x08,
+    0x00, 0x06, 0x20, 0x00, 0x02, 0xfc, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x20, 0x00,
+    0x31, 0xfa, 0xff, 0xf9, 0x68, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x0f, 0x68, 0x01,
+    0x15, 0x32, 0xf6, 0xf9, 0xf5, 0xc8, 0x02, 0x03, 0x6c, 0x01, 0x00, 0x64, 0x00, 0x0f, 0x04, 0x00,
+    0x05, 0x00, 0x6c, 0x00, 0x0f, 0x68, 0x01, 0x7d, 0x0f, 0xac, 0x00, 0x01, 0x00, 0x68, 0x01, 0x00,
+    0x04, 0x00, 0x22, 0xfb, 0xfb, 0x2c, 0x0e, 0x0f, 0x24, 0x00, 0x01, 0x00, 0xcc, 0x00, 0x02, 0x04,
+    0x00, 0x0f, 0x8c, 0x06, 0x07, 0x11, 0xf9, 0x68, 0x01, 0x0f, 0x14, 0x08, 0x03, 0x00, 0x54, 0x00,
+    0x00, 0x40, 0x00, 0x0f, 0x68, 0x01, 0x0d, 0x00, 0x28, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2c, 0x00,
+    0x01, 0x04, 0x00, 0x0f, 0x68, 0x01, 0xc1, 0x0f, 0x94, 0x09, 0x08, 0x01, 0xf4, 0x00, 0x01, 0xd8,
+    0x03, 0x0f, 0x68, 0x01, 0x58, 0x00, 0x64, 0x01, 0x00, 0x04, 0x00, 0x01, 0x78, 0x00, 0x0e, 0xe4,
+    0x08, 0x00, 0x90, 0x01, 0x00, 0x04, 0x00, 0x00, 0x9c, 0x00, 0x0f, 0xd0, 0x02, 0x71, 0x00, 0x88,
+    0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xcc, 0x02, 0x00, 0x04, 0x00, 0x04, 0x24, 0x00, 0x00, 0xbc,
+    0x00, 0x0c, 0x04, 0x00, 0x04, 0x1c, 0x00, 0x04, 0x70, 0x0f, 0x0f, 0x20, 0x00, 0x01, 0x3f, 0xf9,
+    0xff, 0xf8, 0xe4, 0x0a, 0x06, 0x00, 0x30, 0x00, 0x00, 0x44, 0x00, 0x0f, 0xd0, 0x02, 0x1e, 0x03,
+    0x64, 0x01, 0x00, 0x3c, 0x00, 0x04, 0x04, 0x00, 0x00, 0x4c, 0x00, 0x08, 0x04, 0x00, 0x00, 0x18,
+    0x00, 0x0f, 0x68, 0x01, 0x75, 0x00, 0xd8, 0x0e, 0x3e, 0xfb, 0xfe, 0xff, 0x04, 0x00, 0x16, 0xff,
+    0x70, 0x08, 0x00, 0xb0, 0x00, 0x08, 0xc0, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x1c, 0x00, 0x11, 0xfd,
+    0xd0, 0x06, 0x02, 0xd4, 0x0e, 0x08, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x20, 0x00, 0x31, 0xf9,
+    0xff, 0xfa, 0xe8, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x18, 0x00,
+    0x0c, 0x68, 0x01, 0x02, 0x14, 0x00, 0x03, 0x8c, 0x05, 0x0f, 0x30, 0x0a, 0x08, 0x00, 0x48, 0x0f,
+    0x31, 0xfd, 0xfe, 0xf8, 0xb4, 0x05, 0x0f, 0x58, 0x00, 0x01, 0x02, 0x20, 0x11, 0x0f, 0x40, 0x0b,
+    0x6b, 0x60, 0xf2, 0xf7, 0xf0, 0xff, 0xf8, 0xfd, 0x70, 0x11, 0x00, 0xf0, 0x07, 0x00, 0x08, 0x00,
+    0x17, 0xfb, 0x04, 0x00, 0x5f, 0xfa, 0xff, 0xf9, 0xfc, 0xf7, 0xc0, 0x00, 0x02, 0x08, 0xd0, 0x00,
+    0x00, 0x10, 0x01, 0x00, 0xec, 0x0d, 0x3f, 0xfa, 0xfe, 0xf9, 0x2c, 0x00, 0x02, 0x00, 0x20, 0x00,
+    0x71, 0xf7, 0xfe, 0xfa, 0xff, 0xf8, 0xfd, 0xfa, 0x9c, 0x12, 0x08, 0x3c, 0x00, 0x04, 0x0c, 0x00,
+    0x00, 0xa8, 0x0c, 0x31, 0xf8, 0xfe, 0xfa, 0x28, 0x00, 0x04, 0x14, 0x00, 0x00, 0x38, 0x00, 0x31,
+    0xf8, 0xfe, 0xf2, 0x94, 0x10, 0x00, 0x0c, 0x00, 0x04, 0x18, 0x00, 0x08, 0x08, 0x00, 0x00, 0x18,
+    0x00, 0x5f, 0xfb, 0xfc, 0xfc, 0xff, 0xfb, 0x50, 0x11, 0x00, 0x00, 0x28, 0x00, 0x9f, 0xf1, 0xf6,
+    0xf0, 0xff, 0xf7, 0xfe, 0xfb, 0xff, 0xf8, 0x30, 0x0e, 0x04, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00,
+    0x55, 0x00, 0xac, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x0f, 0x88, 0x00, 0x11, 0x04, 0x40, 0x00, 0x0f,
+    0x2c, 0x00, 0x05, 0x0f, 0x20, 0x00, 0x0d, 0x00, 0x38, 0x00, 0x0f, 0x24, 0x00, 0x01, 0x04, 0x14,
+    0x00, 0x00, 0xbc, 0x04, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x24, 0x00, 0x0f, 0x1c,
+    0x00, 0x01, 0x00, 0x14, 0x00, 0x0f, 0x20, 0x00, 0x0d, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0xff,
+    0xff, 0xd3, 0x7f, 0x19, 0x23, 0x10, 0xff, 0x1a, 0x22, 0x11, 0x14, 0x11, 0x66, 0x0f, 0x64, 0x03,
+    0xff, 0xff, 0xd3, 0x0f, 0xe4, 0x02, 0xff, 0xff, 0x13, 0x3f, 0x01, 0x00, 0x01, 0x1c, 0x23, 0xff,
+    0x4d, 0xd2, 0x02, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x08,
+    0x00, 0x0f, 0x48, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x43, 0x50, 0xff, 0x00, 0x00, 0x00, 0xff,
+    // startSelected
+    0x4f, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0xff, 0xff, 0xf0, 0x2f, 0xad, 0xf7, 0x04, 0x00, 0xeb,
+    0x0f, 0x04, 0x04, 0x4d, 0x0f, 0x5c, 0x01, 0xe9, 0x0f, 0xfc, 0x00, 0x01, 0x0f, 0x70, 0x01, 0x3d,
+    0x0f, 0x64, 0x00, 0x01, 0x0f, 0x14, 0x00, 0xf5, 0x6f, 0x00, 0x00, 0xff, 0x0e, 0x1b, 0x0a, 0xe4,
+    0x06, 0x2f, 0x0f, 0x50, 0x01, 0xf5, 0x0f, 0x08, 0x01, 0x09, 0x0f, 0xd8, 0x02, 0x2d, 0x0f, 0x5c,
+    0x00, 0x09, 0x0f, 0x1c, 0x00, 0xfd, 0x6f, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xd8, 0x02, 0x1f,
+    0x0f, 0x48, 0x01, 0xfd, 0x0f, 0x10, 0x01, 0x11, 0x0f, 0xd8, 0x02, 0x21, 0x0f, 0x58, 0x00, 0x11,
+    0x0f, 0x24, 0x00, 0xff, 0x02, 0x0f, 0x6c, 0x01, 0x19, 0x0f, 0x40, 0x01, 0xff, 0x02, 0x0f, 0x14,
+    0x01, 0x19, 0x0f, 0x6c, 0x01, 0x15, 0x0f, 0x54, 0x00, 0x19, 0x6f, 0xad, 0xf7, 0xff, 0xfe, 0xfe,
+    0xfe, 0x04, 0x00, 0x0e, 0x04, 0x70, 0x0b, 0x0f, 0x2c, 0x00, 0x19, 0x04, 0x34, 0x00, 0x00, 0x08,
+    0x00, 0x0f, 0x38, 0x00, 0x09, 0x00, 0x20, 0x00, 0x0c, 0x04, 0x00, 0x0f, 0x30, 0x00, 0x09, 0x04,
+    0x1c, 0x00, 0x0c, 0x34, 0x00, 0x00, 0x10, 0x00, 0x04, 0x1c, 0x00, 0x0f, 0x08, 0x00, 0x09, 0x00,
+    0x28, 0x00, 0x0f, 0x04, 0x00, 0x0a, 0x0f, 0x68, 0x01, 0x11, 0x0f, 0x64, 0x01, 0x2c, 0x39, 0xfd,
+    0xfe, 0xfd, 0x04, 0x00, 0x04, 0xb0, 0x00, 0x04, 0x98, 0x00, 0x00, 0x10, 0x00, 0x2f, 0xfd, 0xfd,
+    0x04, 0x00, 0x03, 0x35, 0xfe, 0xfe, 0xfd, 0xb0, 0x01, 0x04, 0x30, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x04, 0x00, 0x31, 0xfc, 0xfe, 0xfb, 0x04, 0x00, 0x33, 0xfd, 0xfe, 0xfc, 0x04,
+    0x00, 0x1f, 0xfa, 0x30, 0x00, 0x02, 0xb1, 0xf3, 0xfa, 0xf6, 0xff, 0xf8, 0xfe, 0xf4, 0xff, 0xfa,
+    0xff, 0xfd, 0x04, 0x00, 0x39, 0xfb, 0xff, 0xfc, 0x04, 0x00, 0x3f, 0xfc, 0xff, 0xfc, 0x38, 0x00,
+    0x06, 0x00, 0xbc, 0x00, 0x5b, 0xf8, 0xfe, 0xfc, 0xff, 0xf9, 0x04, 0x00, 0x13, 0xfa, 0x7c, 0x00,
+    0x00, 0x88, 0x00, 0x00, 0x94, 0x00, 0x0f, 0x04, 0x00, 0x0e, 0x0f, 0x6c, 0x01, 0x0d, 0x0f, 0x68,
+    0x01, 0x18, 0x00, 0x74, 0x00, 0x00, 0x04, 0x00, 0x35, 0xfb, 0xfc, 0xfb, 0xb8, 0x00, 0x00, 0x10,
+    0x00, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x98, 0x00, 0x01, 0x1c, 0x00, 0x43, 0xfd, 0xff, 0xff, 0xfd,
+    0x04, 0x00, 0x1b, 0xfe, 0x04, 0x00, 0x31, 0xfa, 0xfd, 0xf6, 0x4c, 0x00, 0x04, 0x30, 0x00, 0x00,
+    0x08, 0x00, 0x01, 0x34, 0x00, 0x23, 0xfe, 0xfe, 0x5c, 0x01, 0x04, 0x64, 0x01, 0x00, 0x08, 0x00,
+    0x06, 0x78, 0x00, 0x00, 0x28, 0x00, 0x04, 0x04, 0x00, 0x02, 0x68, 0x01, 0xdd, 0xf6, 0xff, 0xfb,
+    0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfd, 0x04, 0x00, 0x04, 0x54, 0x00, 0x00,
+    0x08, 0x00, 0x08, 0x38, 0x00, 0xd0, 0xfa, 0xfc, 0xfa, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xfa, 0xfd,
+    0xfd, 0xff, 0xfa, 0x40, 0x00, 0x00, 0x04, 0x00, 0x92, 0xfd, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff,
+    0xfd, 0xfd, 0x08, 0x02, 0x04, 0x30, 0x00, 0x0f, 0x08, 0x00, 0x0a, 0x0f, 0x68, 0x01, 0x09, 0x0f,
+    0x64, 0x01, 0x20, 0x00, 0xa8, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x04, 0x94, 0x00, 0x00, 0x2c, 0x00,
+    0x00, 0x08, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x08, 0x2c, 0x00, 0x00, 0x30, 0x00, 0x04, 0x04, 0x00,
+    0x0f, 0x34, 0x00, 0x01, 0x04, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x04, 0x38, 0x00, 0x00, 0x28, 0x00,
+    0x04, 0x68, 0x01, 0x22, 0xf7, 0xfb, 0x10, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x34, 0x00, 0x04,
+    0x04, 0x00, 0x00, 0x3c, 0x00, 0x0f, 0x24, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x2c, 0x00, 0x0f, 0x04, 0x00, 0x12, 0x0f, 0x6c, 0x01, 0x01, 0x0f, 0x64, 0x01, 0x18, 0x00, 0x64,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x80, 0x03, 0x13, 0xfa, 0x84, 0x03, 0x00, 0x14, 0x00, 0x0f, 0x04,
+    0x00, 0x1d, 0x01, 0x44, 0x00, 0x21, 0xfe, 0xff, 0xde, 0x03, 0x00, 0x0c, 0x00, 0x0c, 0x40, 0x00,
+    0x00, 0x14, 0x00, 0x62, 0xfa, 0xfb, 0xfe, 0xff, 0xfa, 0xfd, 0xb8, 0x02, 0x0c, 0x20, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0xe8, 0x03, 0x00, 0xe4, 0x03, 0x35, 0xf8, 0xff, 0xfc, 0x74, 0x11, 0x00, 0x1c,
+    0x01, 0x04, 0x68, 0x01, 0x00, 0x44, 0x00, 0x00, 0x28, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x38, 0x00, 0x2f, 0xfb, 0xfe, 0x5c, 0x00, 0x03, 0x00, 0x20, 0x00, 0x31, 0xfc, 0xfd, 0xff,
+    0xe4, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x40, 0x00, 0x0f, 0x10, 0x00, 0x16, 0x0c, 0x6c, 0x01, 0x0f,
+    0x68, 0x01, 0x22, 0x1f, 0xfb, 0x68, 0x01, 0x2e, 0x00, 0x40, 0x04, 0x01, 0xde, 0x03, 0x25, 0xfe,
+    0xfe, 0x28, 0x01, 0x04, 0xc4, 0x00, 0x00, 0xe0, 0x00, 0x62, 0xfb, 0xfd, 0xfd, 0xff, 0xfb, 0xfe,
+    0x50, 0x05, 0x04, 0x18, 0x00, 0x08, 0x08, 0x00, 0x0f, 0x68, 0x01, 0x29, 0x6f, 0xfa, 0xfe, 0xfc,
+    0xff, 0xfc, 0xfd, 0x5c, 0x00, 0x03, 0x00, 0x7c, 0x00, 0x13, 0xfc, 0x04, 0x00, 0x2f, 0xf7, 0xfa,
+    0x38, 0x13, 0x28, 0x0f, 0x68, 0x01, 0x30, 0x00, 0x8c, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x08, 0x10,
+    0x01, 0x0f, 0x0c, 0x00, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x68, 0x01, 0x10, 0xff, 0x46, 0x05, 0x0f,
+    0x68, 0x01, 0x04, 0x00, 0x24, 0x00, 0x04, 0x68, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x01,
+    0x00, 0x98, 0x02, 0x0c, 0xd0, 0x02, 0x31, 0xf9, 0xfe, 0xf6, 0x24, 0x01, 0x0f, 0x30, 0x00, 0x01,
+    0x0f, 0x14, 0x00, 0x01, 0x0c, 0xa0, 0x00, 0x00, 0x24, 0x00, 0x31, 0xfc, 0xfe, 0xfd, 0x44, 0x00,
+    0x00, 0x80, 0x06, 0x0c, 0x20, 0x00, 0x0f, 0x10, 0x00, 0x16, 0x0f, 0x68, 0x01, 0x2c, 0x00, 0x68,
+    0x00, 0x00, 0x8c, 0x00, 0x06, 0x04, 0x00, 0x11, 0xfb, 0x44, 0x08, 0x00, 0x6c, 0x03, 0x35, 0xfb,
+    0xfe, 0xfd, 0x14, 0x05, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x68,
+    0x01, 0x0f, 0xd0, 0x02, 0x09, 0x00, 0x24, 0x00, 0x00, 0x68, 0x01, 0x00, 0x54, 0x00, 0x71, 0xfb,
+    0xfc, 0xfe, 0xff, 0xfc, 0xfc, 0xff, 0x64, 0x00, 0x08, 0x04, 0x00, 0x00, 0xb0, 0x06, 0x0f, 0x68,
+    0x01, 0x05, 0x00, 0x90, 0x02, 0x0e, 0x04, 0x00, 0x11, 0xff, 0x6c, 0x07, 0x00, 0x5c, 0x00, 0x00,
+    0x04, 0x00, 0x0f, 0xa0, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x0f,
+    0x68, 0x01, 0x6d, 0x04, 0xa0, 0x00, 0x00, 0x90, 0x00, 0x11, 0xff, 0x44, 0x0b, 0x30, 0xff, 0xff,
+    0xfd, 0x70, 0x05, 0x07, 0x68, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x28, 0x00, 0x0c, 0x08, 0x00, 0x00,
+    0x1c, 0x00, 0x01, 0x04, 0x00, 0x0f, 0xe4, 0x05, 0x04, 0x00, 0x68, 0x05, 0x31, 0xfa, 0xfe, 0xfa,
+    0x38, 0x04, 0x10, 0xfc, 0x0c, 0x0a, 0x00, 0x64, 0x00, 0x00, 0xa0, 0x08, 0x00, 0x08, 0x00, 0x01,
+    0x80, 0x08, 0x9f, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0x68, 0x01, 0x02, 0x01,
+    0x5c, 0x00, 0x03, 0x2c, 0x00, 0x05, 0x0c, 0x00, 0x12, 0xff, 0x34, 0x08, 0x04, 0x10, 0x00, 0x0c,
+    0x94, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x00, 0x0f, 0xd0, 0x02, 0x75, 0x08, 0x94, 0x00, 0x00,
+    0x98, 0x00, 0x08, 0x04, 0x00, 0x00, 0x24, 0x01, 0x08, 0x10, 0x00, 0x04, 0x2c, 0x00, 0x08, 0x08,
+    0x00, 0x06, 0x20, 0x00, 0x02, 0xfc, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x20, 0x00,
+    0x31, 0xfa, 0xff, 0xf9, 0x68, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x0f, 0x68, 0x01,
+    0x15, 0x32, 0xf6, 0xf9, 0xf5, 0xc8, 0x02, 0x03, 0x6c, 0x01, 0x00, 0x64, 0x00, 0x0f, 0x04, 0x00,
+    0x05, 0x00, 0x6c, 0x00, 0x0f, 0x68, 0x01, 0x7d, 0x0f, 0xac, 0x00, 0x01, 0x00, 0x68, 0x01, 0x00,
+    0x04, 0x00, 0x22, 0xfb, 0xfb, 0x2c, 0x0e, 0x0f, 0x24, 0x00, 0x01, 0x00, 0xcc, 0x00, 0x02, 0x04,
+    0x00, 0x0f, 0x8c, 0x06, 0x07, 0x11, 0xf9, 0x68, 0x01, 0x0f, 0x14, 0x08, 0x03, 0x00, 0x54, 0x00,
+    0x00, 0x40, 0x00, 0x0f, 0x68, 0x01, 0x0d, 0x00, 0x28, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2c, 0x00,
+    0x01, 0x04, 0x00, 0x0f, 0x68, 0x01, 0xc1, 0x0f, 0x94, 0x09, 0x08, 0x01, 0xf4, 0x00, 0x01, 0xd8,
+    0x03, 0x0f, 0x68, 0x01, 0x58, 0x00, 0x64, 0x01, 0x00, 0x04, 0x00, 0x01, 0x78, 0x00, 0x0e, 0xe4,
+    0x08, 0x00, 0x90, 0x01, 0x00, 0x04, 0x00, 0x00, 0x9c, 0x00, 0x0f, 0xd0, 0x02, 0x42, 0x00, 0x18,
+    0x07, 0x0f, 0xdc, 0x09, 0x18, 0x00, 0x88, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x00, 0xcc, 0x02, 0x00,
+    0x04, 0x00, 0x04, 0x24, 0x00, 0x00, 0xbc, 0x00, 0x0c, 0x04, 0x00, 0x04, 0x1c, 0x00, 0x04, 0x70,
+    0x0f, 0x0f, 0x20, 0x00, 0x01, 0x3f, 0xf9, 0xff, 0xf8, 0xe4, 0x0a, 0x06, 0x00, 0x30, 0x00, 0x00,
+    0x44, 0x00, 0x0f, 0xd0, 0x02, 0x1e, 0x03, 0x64, 0x01, 0x00, 0x3c, 0x00, 0x04, 0x04, 0x00, 0x00,
+    0x4c, 0x00, 0x08, 0x04, 0x00, 0x00, 0x18, 0x00, 0x0f, 0x68, 0x01, 0x2e, 0x00, 0x54, 0x01, 0x0f,
+    0x04, 0x00, 0x01, 0x0f, 0x68, 0x01, 0x1c, 0x00, 0xd8, 0x0e, 0x3e, 0xfb, 0xfe, 0xff, 0x04, 0x00,
+    0x16, 0xff, 0x70, 0x08, 0x00, 0xb0, 0x00, 0x08, 0xc0, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x1c, 0x00,
+    0x11, 0xfd, 0xd0, 0x06, 0x02, 0xd4, 0x0e, 0x08, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x20, 0x00,
+    0x31, 0xf9, 0xff, 0xfa, 0xe8, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0c, 0x04, 0x00, 0x00,
+    0x18, 0x00, 0x0c, 0x68, 0x01, 0x02, 0x14, 0x00, 0x03, 0x8c, 0x05, 0x0f, 0x30, 0x0a, 0x08, 0x00,
+    0x48, 0x0f, 0x31, 0xfd, 0xfe, 0xf8, 0xb4, 0x05, 0x0f, 0x58, 0x00, 0x01, 0x02, 0x20, 0x11, 0x0f,
+    0x40, 0x0b, 0x28, 0x0f, 0x64, 0x01, 0x01, 0x04, 0x14, 0x00, 0x0f, 0x6c, 0x01, 0x14, 0x60, 0xf2,
+    0xf7, 0xf0, 0xff, 0xf8, 0xfd, 0x70, 0x11, 0x00, 0xf0, 0x07, 0x00, 0x08, 0x00, 0x17, 0xfb, 0x04,
+    0x00, 0x42, 0xfa, 0xff, 0xf9, 0xfc, 0xc8, 0x13, 0x0c, 0xc0, 0x00, 0x08, 0x10, 0x00, 0x00, 0x10,
+    0x01, 0x00, 0xec, 0x0d, 0x3f, 0xfa, 0xfe, 0xf9, 0xec, 0x00, 0x06, 0x71, 0xf7, 0xfe, 0xfa, 0xff,
+    0xf8, 0xfd, 0xfa, 0x9c, 0x12, 0x08, 0x3c, 0x00, 0x04, 0x0c, 0x00, 0x00, 0xa8, 0x0c, 0x31, 0xf8,
+    0xfe, 0xfa, 0x28, 0x00, 0x04, 0x14, 0x00, 0x00, 0x58, 0x00, 0x31, 0xf8, 0xfe, 0xf2, 0x94, 0x10,
+    0x00, 0x0c, 0x00, 0x04, 0x18, 0x00, 0x08, 0x08, 0x00, 0x00, 0x18, 0x00, 0x5f, 0xfb, 0xfc, 0xfc,
+    0xff, 0xfb, 0x50, 0x11, 0x00, 0x00, 0x28, 0x00, 0x9f, 0xf1, 0xf6, 0xf0, 0xff, 0xf7, 0xfe, 0xfb,
+    0xff, 0xf8, 0x30, 0x0e, 0x04, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x0a, 0x04, 0x50, 0x01, 0x0f,
+    0x08, 0x00, 0x09, 0x0f, 0x6c, 0x01, 0x14, 0x00, 0xac, 0x00, 0x0f, 0x04, 0x00, 0x09, 0x0f, 0x88,
+    0x00, 0x0a, 0x03, 0x64, 0x00, 0x04, 0x40, 0x00, 0x0f, 0x2c, 0x00, 0x05, 0x0f, 0x20, 0x00, 0x0d,
+    0x00, 0x38, 0x00, 0x0f, 0x24, 0x00, 0x01, 0x04, 0x14, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x24, 0x00,
+    0x0f, 0x04, 0x00, 0x01, 0x04, 0x24, 0x00, 0x0f, 0x1c, 0x00, 0x01, 0x00, 0x14, 0x00, 0x0f, 0x20,
+    0x00, 0x0d, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x02, 0x0f, 0x5c, 0x01, 0x09, 0x08, 0x1c, 0x00,
+    0x03, 0x04, 0x01, 0x0f, 0x44, 0x00, 0x02, 0x0f, 0x1c, 0x00, 0xff, 0x12, 0x08, 0x4c, 0x01, 0x0f,
+    0x0c, 0x00, 0x0d, 0x0f, 0x50, 0x01, 0xff, 0x12, 0x0f, 0x24, 0x01, 0x01, 0xaf, 0x00, 0x00, 0xff,
+    0x19, 0x23, 0x10, 0xff, 0x1a, 0x22, 0x11, 0x94, 0x1d, 0x13, 0x0f, 0x44, 0x00, 0x01, 0x0f, 0x14,
+    0x00, 0xff, 0x0e, 0x0f, 0xbc, 0x02, 0x0d, 0x0f, 0x20, 0x00, 0x05, 0x0f, 0x58, 0x01, 0xff, 0x0e,
+    0x08, 0x20, 0x01, 0x0f, 0x44, 0x01, 0x05, 0x0f, 0x18, 0x00, 0x15, 0x08, 0x4c, 0x00, 0x0f, 0x0c,
+    0x00, 0xff, 0x06, 0x0f, 0x4c, 0x01, 0x15, 0x0f, 0x28, 0x00, 0x15, 0x0f, 0x68, 0x01, 0xf9, 0x00,
+    0x18, 0x23, 0x2f, 0x00, 0x01, 0x1c, 0x23, 0x23, 0x0f, 0x70, 0x01, 0xff, 0x0e, 0x05, 0x20, 0x01,
+    0xd2, 0x02, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x08, 0x00,
+    0x05, 0x1c, 0x00, 0x0f, 0x50, 0x2e, 0xff, 0xff, 0xf2, 0x0f, 0x0c, 0x03, 0xff, 0x34, 0x50, 0xff,
+    0x00, 0x00, 0x00, 0xff,
+    // exit
+    0x4f, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xfd, 0x00, 0xfc, 0xfe, 0xfe, 0xff, 0xf8, 0xfc, 0xf4,
+    0xfa, 0xf8, 0xfd, 0xf4, 0xf7, 0xf8, 0xfd, 0xf5, 0x04, 0x00, 0x00, 0x20, 0x00, 0x04, 0xfc, 0x0f,
+    0x00, 0x0c, 0x00, 0xc8, 0xf7, 0xfd, 0xf6, 0xf5, 0xf8, 0xfd, 0xf6, 0xf6, 0xe4, 0xee, 0xe0, 0xfd,
+    0x18, 0x00, 0x75, 0xf8, 0xfc, 0xf4, 0xfb, 0xf9, 0xfd, 0xf7, 0x14, 0x00, 0x00, 0x1c, 0x00, 0xfb,
+    0x00, 0xf9, 0xfd, 0xf7, 0xff, 0xf8, 0xfd, 0xf2, 0xf8, 0xf9, 0xfe, 0xf3, 0xf4, 0xf9, 0xfe, 0xf4,
+    0x04, 0x00, 0x20, 0xf3, 0xf4, 0x50, 0x00, 0x00, 0x28, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00,
+    0x7d, 0xfb, 0xfe, 0xf4, 0xf1, 0xfb, 0xfe, 0xf5, 0x04, 0x00, 0x40, 0xfa, 0xfe, 0xf5, 0xf1, 0x20,
+    0x00, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0xa5, 0x00, 0xc0, 0x00, 0x31, 0xff, 0xfe, 0xfe, 0x08,
+    0x00, 0x0f, 0x04, 0x00, 0x05, 0x04, 0xdc, 0x00, 0x05, 0x20, 0x00, 0x12, 0xfd, 0x30, 0x00, 0x08,
+    0x18, 0x00, 0x79, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xfd, 0xfa, 0x90, 0x11, 0x71, 0xfe, 0xfe, 0xfb,
+    0xff, 0xff, 0xff, 0xfd, 0x1c, 0x00, 0x0e, 0x01, 0x00, 0x11, 0xfc, 0x74, 0x00, 0x08, 0x44, 0x00,
+    0x1f, 0xfe, 0x04, 0x00, 0x08, 0x00, 0x7c, 0x00, 0x04, 0x2c, 0x00, 0x0f, 0x08, 0x00, 0xa1, 0x00,
+    0xc0, 0x00, 0x00, 0xdc, 0x00, 0x1f, 0xfb, 0x6c, 0x01, 0x04, 0x35, 0xed, 0xf4, 0xec, 0x3c, 0x01,
+    0x00, 0x2c, 0x00, 0x01, 0x04, 0x00, 0x0f, 0x68, 0x01, 0x14, 0x01, 0x2c, 0x00, 0x03, 0x58, 0x00,
+    0x3f, 0xff, 0xfe, 0xfd, 0xd0, 0x01, 0x02, 0x04, 0x34, 0x01, 0x08, 0x2c, 0x00, 0xb1, 0xfc, 0xff,
+    0xfb, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf8, 0xfa, 0xf6, 0x8c, 0x01, 0x04, 0x1c, 0x00, 0x04, 0x2c,
+    0x00, 0x0f, 0x08, 0x00, 0xa1, 0x00, 0xc4, 0x00, 0x00, 0x68, 0x01, 0x00, 0x08, 0x00, 0x00, 0x04,
+    0x00, 0x0f, 0xc4, 0x00, 0x09, 0x00, 0x20, 0x00, 0x01, 0x04, 0x00, 0x0f, 0x68, 0x01, 0x14, 0x04,
+    0x4c, 0x00, 0x71, 0xf4, 0xf8, 0xf4, 0xff, 0xff, 0xff, 0xf9, 0xdb, 0x02, 0x00, 0x40, 0x00, 0x04,
+    0x18, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x31, 0xf7, 0xff, 0xf6, 0x68, 0x01, 0x0f, 0x2c, 0x00, 0x11,
+    0x0f, 0x44, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x7d, 0x00, 0xcc, 0x00, 0x0f, 0x68, 0x01, 0x4d, 0x3f,
+    0xf1, 0xf6, 0xf2, 0x68, 0x01, 0xf6, 0x0f, 0x38, 0x04, 0x01, 0x0c, 0x14, 0x02, 0x40, 0xb9, 0xd5,
+    0xaf, 0xed, 0x98, 0x01, 0x00, 0x04, 0x00, 0x40, 0xec, 0xf3, 0xec, 0xfe, 0x08, 0x00, 0x0c, 0x04,
+    0x00, 0x0c, 0x34, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x68, 0x01, 0x1d, 0x1f, 0xf8, 0xd0, 0x02, 0xc8,
+    0x00, 0x68, 0x01, 0x31, 0xfb, 0xfd, 0xfd, 0x04, 0x00, 0x31, 0xf7, 0xfc, 0xf7, 0x18, 0x05, 0x00,
+    0x24, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x60, 0x01, 0x6a, 0xfb, 0xfc, 0xfe, 0xff, 0xfb, 0xfe,
+    0xd0, 0x06, 0x0f, 0x30, 0x00, 0x01, 0x0f, 0x68, 0x01, 0x22, 0x03, 0xd8, 0x05, 0x0f, 0x50, 0x00,
+    0x01, 0x0f, 0x14, 0x00, 0xa1, 0x00, 0x30, 0x01, 0x05, 0x38, 0x04, 0x43, 0xfd, 0xfe, 0xff, 0xfd,
+    0x7c, 0x05, 0x00, 0x18, 0x00, 0x0f, 0xd0, 0x00, 0x09, 0x00, 0x20, 0x00, 0x7f, 0xfb, 0xfe, 0xfb,
+    0xff, 0xfb, 0xff, 0xfa, 0x94, 0x01, 0x0e, 0x0f, 0x68, 0x01, 0x1d, 0x01, 0xa0, 0x05, 0x0f, 0x68,
+    0x01, 0xc4, 0x00, 0xd0, 0x02, 0x00, 0x3c, 0x01, 0x08, 0x04, 0x00, 0x0c, 0x68, 0x01, 0x00, 0x1c,
+    0x00, 0x31, 0xf8, 0xfb, 0xf8, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x04, 0x00, 0x3f, 0xf3, 0xf7,
+    0xf2, 0x70, 0x01, 0x06, 0x0f, 0x68, 0x01, 0xf9, 0x04, 0x34, 0x01, 0x0c, 0x5c, 0x01, 0x08, 0x10,
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x0f, 0x0b, 0x79, 0xfe, 0xfe, 0xff, 0xff, 0xf4, 0xf9, 0xf6, 0xf0,
+    0x09, 0x00, 0xb4, 0x09, 0x1b, 0xfd, 0x40, 0x0b, 0x04, 0x3c, 0x00, 0x0f, 0x68, 0x01, 0xf5, 0x00,
+    0x24, 0x01, 0x04, 0x3c, 0x04, 0x04, 0x1c, 0x01, 0x0f, 0x08, 0x00, 0x01, 0x01, 0x68, 0x01, 0x12,
+    0xfe, 0x76, 0x0c, 0x2b, 0xf4, 0xf8, 0x68, 0x01, 0x65, 0xff, 0xfc, 0xff, 0xfd, 0xfe, 0xf9, 0x7c,
+    0x01, 0x08, 0x40, 0x00, 0x0f, 0x68, 0x01, 0xf6, 0x12, 0xfd, 0x88, 0x0d, 0x80, 0xf6, 0xfc, 0xf6,
+    0xfb, 0xfa, 0xfd, 0xfc, 0xff, 0x04, 0x00, 0x6a, 0xf9, 0xfc, 0xfa, 0xff, 0xf9, 0xfd, 0x7c, 0x05,
+    0x0f, 0x68, 0x01, 0x0b, 0x1d, 0xfb, 0x68, 0x01, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x71, 0xf8,
+    0xfd, 0xf9, 0xff, 0xff, 0xff, 0xfa, 0xec, 0x0d, 0x71, 0xf8, 0xfc, 0xf8, 0xff, 0xf8, 0xfc, 0xf9,
+    0x04, 0x00, 0x00, 0x1c, 0x00, 0x08, 0x90, 0x01, 0x04, 0x0c, 0x00, 0x01, 0x70, 0x08, 0x0f, 0xa0,
+    0x05, 0xc1, 0x90, 0xfd, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfc, 0xfd, 0x3c, 0x0f, 0x06, 0x04,
+    0x00, 0x00, 0x08, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x3f, 0x0f,
+    0x2e, 0xfe, 0xff, 0x78, 0x0f, 0x11, 0xfd, 0xc6, 0x0d, 0x0a, 0xd0, 0x02, 0x51, 0xf9, 0xff, 0xfa,
+    0xff, 0xfa, 0x2a, 0x07, 0x00, 0x80, 0x0f, 0x11, 0xfb, 0x68, 0x01, 0x11, 0xfd, 0x2a, 0x00, 0x03,
+    0x04, 0x00, 0x2f, 0xfe, 0xfe, 0x00, 0x03, 0x02, 0x32, 0xf7, 0xff, 0xf7, 0x28, 0x00, 0x0f, 0x20,
+    0x00, 0x04, 0x04, 0x90, 0x00, 0x0f, 0x08, 0x00, 0x99, 0x00, 0x3c, 0x01, 0x0f, 0x04, 0x00, 0x09,
+    0x44, 0xf3, 0xf9, 0xf3, 0xfe, 0xd0, 0x00, 0x0c, 0x28, 0x00, 0x0f, 0x18, 0x00, 0x01, 0x04, 0x14,
+    0x00, 0x00, 0x08, 0x00, 0x0c, 0x30, 0x00, 0x0f, 0x10, 0x00, 0x01, 0x00, 0x28, 0x00, 0x0c, 0x04,
+    0x00, 0x08, 0x28, 0x00, 0x0c, 0x1c, 0x00, 0x0f, 0x10, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x50, 0xff, 0x00, 0x00, 0x00, 0xff,
+    // exitSelected
+    0x4f, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0xff, 0xff, 0xf1, 0x1f, 0xb5, 0x04, 0x00, 0xec, 0x0f,
+    0x04, 0x04, 0x4d, 0x0f, 0x5c, 0x01, 0xe9, 0x0f, 0xfc, 0x00, 0x01, 0x0f, 0x70, 0x01, 0x3d, 0x0f,
+    0x64, 0x00, 0x01, 0x0f, 0x14, 0x00, 0xf5, 0x0f, 0x6c, 0x01, 0x35, 0x0f, 0x50, 0x01, 0xf5, 0x0f,
+    0x08, 0x01, 0x09, 0x0f, 0x6c, 0x01, 0x2d, 0x0f, 0x5c, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0xfd, 0x0f,
+    0x6c, 0x01, 0x25, 0x0f, 0x48, 0x01, 0xfd, 0x0f, 0x10, 0x01, 0x11, 0x0f, 0x6c, 0x01, 0x1b, 0x4f,
+    0x1a, 0x25, 0xa1, 0xf4, 0x50, 0x08, 0xeb, 0x0f, 0x54, 0x01, 0x11, 0x0f, 0x24, 0x00, 0x05, 0x0f,
+    0x6c, 0x01, 0x19, 0x0f, 0x44, 0x00, 0x05, 0x0f, 0x18, 0x00, 0xff, 0x16, 0x0f, 0x6c, 0x01, 0x15,
+    0x0f, 0x50, 0x01, 0xff, 0x16, 0x0f, 0x28, 0x01, 0x05, 0x0f, 0x68, 0x01, 0x11, 0x0f, 0x3c, 0x00,
+    0x05, 0x0f, 0x18, 0x00, 0x27, 0xfd, 0x00, 0xfc, 0xfe, 0xfe, 0xff, 0xf8, 0xfc, 0xf4, 0xfa, 0xf8,
+    0xfd, 0xf4, 0xf7, 0xf8, 0xfd, 0xf5, 0x04, 0x00, 0x00, 0x20, 0x00, 0x04, 0xa8, 0x04, 0x00, 0x0c,
+    0x00, 0xc8, 0xf7, 0xfd, 0xf6, 0xf5, 0xf8, 0xfd, 0xf6, 0xf6, 0xe4, 0xee, 0xe0, 0xfd, 0x18, 0x00,
+    0x75, 0xf8, 0xfc, 0xf4, 0xfb, 0xf9, 0xfd, 0xf7, 0x14, 0x00, 0x00, 0x1c, 0x00, 0xfb, 0x00, 0xf9,
+    0xfd, 0xf7, 0xff, 0xf8, 0xfd, 0xf2, 0xf8, 0xf9, 0xfe, 0xf3, 0xf4, 0xf9, 0xfe, 0xf4, 0x04, 0x00,
+    0x20, 0xf3, 0xf4, 0x50, 0x00, 0x00, 0x28, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x7d, 0xfb,
+    0xfe, 0xf4, 0xf1, 0xfb, 0xfe, 0xf5, 0x04, 0x00, 0x40, 0xfa, 0xfe, 0xf5, 0xf1, 0x20, 0x00, 0x00,
+    0x28, 0x00, 0x0f, 0x04, 0x00, 0x33, 0x0f, 0x6c, 0x01, 0x0d, 0x0f, 0x50, 0x01, 0x27, 0x0f, 0xa0,
+    0x00, 0x05, 0x00, 0xc0, 0x00, 0x31, 0xff, 0xfe, 0xfe, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x04,
+    0x3c, 0x00, 0x05, 0x20, 0x00, 0x12, 0xfd, 0x30, 0x00, 0x08, 0x18, 0x00, 0x79, 0xff, 0xff, 0xfe,
+    0xff, 0xfb, 0xfd, 0xfa, 0x8c, 0x0e, 0x71, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0x1c, 0x00,
+    0x0e, 0x01, 0x00, 0x11, 0xfc, 0x74, 0x00, 0x08, 0x44, 0x00, 0x1f, 0xfe, 0x04, 0x00, 0x08, 0x00,
+    0x7c, 0x00, 0x04, 0x2c, 0x00, 0x0f, 0x08, 0x00, 0x2f, 0x0f, 0x68, 0x01, 0x09, 0x0f, 0x64, 0x01,
+    0x3f, 0x00, 0xb0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xdc, 0x00, 0x1f, 0xfb, 0x6c, 0x01, 0x04, 0x35,
+    0xed, 0xf4, 0xec, 0x3c, 0x01, 0x00, 0x2c, 0x00, 0x01, 0x04, 0x00, 0x0f, 0x68, 0x01, 0x14, 0x01,
+    0x2c, 0x00, 0x03, 0x58, 0x00, 0x3f, 0xff, 0xfe, 0xfd, 0xd0, 0x01, 0x02, 0x00, 0x84, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x2c, 0x00, 0xb1, 0xfc, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf8, 0xfa,
+    0xf6, 0x8c, 0x01, 0x04, 0x1c, 0x00, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x37, 0x0f, 0x6c, 0x01,
+    0x01, 0x0f, 0x64, 0x01, 0x43, 0x00, 0xb4, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x68, 0x01, 0x00, 0x08,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x20, 0x00, 0x01, 0x04,
+    0x00, 0x0f, 0x68, 0x01, 0x14, 0x04, 0x48, 0x00, 0x71, 0xf4, 0xf8, 0xf4, 0xff, 0xff, 0xff, 0xf9,
+    0xdb, 0x02, 0x00, 0x40, 0x00, 0x04, 0x18, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x31, 0xf7, 0xff, 0xf6,
+    0x68, 0x01, 0x0f, 0x2c, 0x00, 0x11, 0x0f, 0x44, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x13, 0x0c, 0x6c,
+    0x01, 0x0f, 0x68, 0x01, 0xab, 0x3f, 0xf1, 0xf6, 0xf2, 0x68, 0x01, 0xf6, 0x0f, 0x38, 0x04, 0x01,
+    0x0c, 0x14, 0x02, 0x40, 0xb9, 0xd5, 0xaf, 0xed, 0x64, 0x02, 0x00, 0x04, 0x00, 0x40, 0xec, 0xf3,
+    0xec, 0xfe, 0x08, 0x00, 0x0c, 0x04, 0x00, 0x0c, 0x34, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x68, 0x01,
+    0x1d, 0x1f, 0xf8, 0xd0, 0x02, 0xc8, 0x00, 0x68, 0x01, 0x31, 0xfb, 0xfd, 0xfd, 0x04, 0x00, 0x31,
+    0xf7, 0xfc, 0xf7, 0x18, 0x05, 0x00, 0x24, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x60, 0x01, 0x6a,
+    0xfb, 0xfc, 0xfe, 0xff, 0xfb, 0xfe, 0xd0, 0x06, 0x0f, 0x30, 0x00, 0x01, 0x0f, 0x68, 0x01, 0x22,
+    0x03, 0xd8, 0x05, 0x0f, 0x50, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x37, 0x0f, 0x38, 0x04, 0x64, 0x43,
+    0xfd, 0xfe, 0xff, 0xfd, 0x7c, 0x05, 0x00, 0x48, 0x01, 0x0f, 0xd0, 0x00, 0x09, 0x00, 0x20, 0x00,
+    0x7f, 0xfb, 0xfe, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0x94, 0x01, 0x0e, 0x0f, 0x68, 0x01, 0x1d, 0x01,
+    0xa0, 0x05, 0x0f, 0x68, 0x01, 0xc4, 0x00, 0xd0, 0x02, 0x00, 0x3c, 0x01, 0x08, 0x04, 0x00, 0x0c,
+    0x68, 0x01, 0x00, 0x1c, 0x00, 0x31, 0xf8, 0xfb, 0xf8, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x04,
+    0x00, 0x3f, 0xf3, 0xf7, 0xf2, 0x70, 0x01, 0x06, 0x0f, 0x68, 0x01, 0xf9, 0x04, 0x34, 0x01, 0x0c,
+    0x5c, 0x01, 0x08, 0x10, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0f, 0x0b, 0x79, 0xfe, 0xfe, 0xff, 0xff,
+    0xf4, 0xf9, 0xf6, 0xf0, 0x09, 0x00, 0xb4, 0x09, 0x1b, 0xfd, 0x40, 0x0b, 0x04, 0x3c, 0x00, 0x0f,
+    0x68, 0x01, 0xf5, 0x00, 0x24, 0x01, 0x04, 0xdc, 0x09, 0x04, 0x1c, 0x01, 0x0f, 0x08, 0x00, 0x01,
+    0x01, 0x68, 0x01, 0x12, 0xfe, 0x76, 0x0c, 0x2b, 0xf4, 0xf8, 0x68, 0x01, 0x65, 0xff, 0xfc, 0xff,
+    0xfd, 0xfe, 0xf9, 0x7c, 0x01, 0x08, 0x40, 0x00, 0x0f, 0x68, 0x01, 0x97, 0x00, 0xb0, 0x05, 0x0f,
+    0xdc, 0x09, 0x43, 0x01, 0x3c, 0x01, 0x12, 0xfd, 0x88, 0x0d, 0x80, 0xf6, 0xfc, 0xf6, 0xfb, 0xfa,
+    0xfd, 0xfc, 0xff, 0x04, 0x00, 0x6a, 0xf9, 0xfc, 0xfa, 0xff, 0xf9, 0xfd, 0x7c, 0x05, 0x01, 0x2c,
+    0x00, 0x0f, 0x68, 0x01, 0x06, 0x1d, 0xfb, 0x68, 0x01, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x71,
+    0xf8, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xfa, 0xec, 0x0d, 0x71, 0xf8, 0xfc, 0xf8, 0xff, 0xf8, 0xfc,
+    0xf9, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x08, 0x90, 0x01, 0x04, 0x0c, 0x00, 0x01, 0x70, 0x08, 0x0f,
+    0xa0, 0x05, 0x4e, 0x00, 0x54, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x0f, 0x68, 0x01, 0x47, 0x00, 0xab,
+    0x0d, 0x60, 0xfd, 0xfc, 0xff, 0xff, 0xfc, 0xfd, 0x3c, 0x0f, 0x06, 0x04, 0x00, 0x00, 0x08, 0x01,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x3f, 0x0f, 0x2e, 0xfe, 0xff, 0x78,
+    0x0f, 0x11, 0xfd, 0xc6, 0x0d, 0x0a, 0xd0, 0x02, 0x51, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0x2a, 0x07,
+    0x00, 0x80, 0x0f, 0x11, 0xfb, 0x68, 0x01, 0x11, 0xfd, 0x2a, 0x00, 0x03, 0x04, 0x00, 0x2f, 0xfe,
+    0xfe, 0x00, 0x03, 0x02, 0x32, 0xf7, 0xff, 0xf7, 0x28, 0x00, 0x0f, 0x20, 0x00, 0x04, 0x04, 0x90,
+    0x00, 0x0f, 0x08, 0x00, 0x2b, 0x0f, 0x64, 0x01, 0x01, 0x04, 0x14, 0x00, 0x0f, 0x6c, 0x01, 0x3f,
+    0x00, 0x3c, 0x01, 0x0f, 0x04, 0x00, 0x09, 0x44, 0xf3, 0xf9, 0xf3, 0xfe, 0xd0, 0x00, 0x0c, 0x28,
+    0x00, 0x0f, 0x18, 0x00, 0x01, 0x04, 0x14, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x30, 0x00, 0x0f, 0x10,
+    0x00, 0x01, 0x00, 0x28, 0x00, 0x0c, 0x04, 0x00, 0x08, 0x28, 0x00, 0x0c, 0x1c, 0x00, 0x0f, 0x10,
+    0x00, 0x33, 0x04, 0x50, 0x01, 0x0f, 0x08, 0x00, 0x09, 0x0f, 0x6c, 0x01, 0x3f, 0x0f, 0xbc, 0x00,
+    0x33, 0x0f, 0x98, 0x00, 0x95, 0x0f, 0x5c, 0x01, 0x09, 0x08, 0x1c, 0x00, 0x0f, 0xd0, 0x00, 0x95,
+    0x0f, 0xa8, 0x00, 0x85, 0x08, 0x4c, 0x01, 0x0f, 0x0c, 0x00, 0x0d, 0x0f, 0xc4, 0x00, 0x85, 0x0f,
+    0x98, 0x00, 0x8d, 0x0f, 0x58, 0x01, 0x0d, 0x0c, 0x20, 0x00, 0x0f, 0xd0, 0x00, 0x8d, 0x0f, 0xa0,
+    0x00, 0x81, 0x0c, 0x44, 0x01, 0x0f, 0x10, 0x00, 0x15, 0x0f, 0xcc, 0x00, 0x81, 0x0f, 0x94, 0x00,
+    0x85, 0x0f, 0x54, 0x01, 0x15, 0x0f, 0x28, 0x00, 0x05, 0x0f, 0xd8, 0x00, 0x85, 0x0f, 0x98, 0x00,
+    0x79, 0x0f, 0x3c, 0x01, 0x05, 0x0f, 0x18, 0x00, 0x25, 0x0f, 0xdc, 0x00, 0x79, 0x0f, 0x8c, 0x00,
+    0x6d, 0x0f, 0x44, 0x01, 0x25, 0x0f, 0x38, 0x00, 0x19, 0x0f, 0xe4, 0x00, 0x6d, 0x0f, 0x80, 0x00,
+    0x63, 0x3f, 0x0f, 0x2b, 0xaa, 0x2c, 0x2e, 0xff, 0xff, 0xf2, 0x0f, 0x28, 0x04, 0x19, 0x0f, 0x2c,
+    0x00, 0xff, 0x2b, 0x50, 0xff, 0x00, 0x00, 0x00, 0xff,
+};
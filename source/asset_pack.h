@@ -0,0 +1,29 @@
+/* Compressed asset pack, generated by tools/mkassets.py from the images in art/. Do not edit. */
+
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#define ASSET_TITLE_SCREEN 0
+#define ASSET_TITLEDONKEY 1
+#define ASSET_START 2
+#define ASSET_STARTSELECTED 3
+#define ASSET_EXIT 4
+#define ASSET_EXITSELECTED 5
+#define NUM_ASSETS 6
+
+#define ASSET_PACK_BYTES 85576
+#define ASSET_DECODED_WORDS 261060 // ARGB pixels of every asset together.
+
+struct asset
+{
+    unsigned int offset;  // Start of the LZ4 block in asset_pack.
+    unsigned int size;    // Compressed bytes.
+    unsigned int width;
+    unsigned int height;
+    unsigned int decoded; // Start of the decoded pixels in the decode buffer, in words.
+};
+
+extern const struct asset asset_table[NUM_ASSETS];
+extern const unsigned char asset_pack[ASSET_PACK_BYTES];
+
+#endif
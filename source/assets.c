@@ -0,0 +1,32 @@
+#include "hal.h"
+#include "lz4.h"
+#include "assets.h"
+
+// Large images (the title art and menu buttons) are kept LZ4-compressed in asset_pack and decoded the first time
+// they are needed. Decoded pixels stay cached, so going back to the start menu doesn't decode them again.
+
+static unsigned int decode_buffer[ASSET_DECODED_WORDS];
+static int decoded[NUM_ASSETS];
+
+/* Returns an asset's ARGB pixels and size, decompressing it if this is the first time it's used. Returns 0 if the
+ * asset is corrupt. */
+const unsigned int *asset_load(int id, int *width, int *height)
+{
+    const struct asset *a = &asset_table[id];
+    unsigned int *pixels = &decode_buffer[a->decoded];
+    int bytes = a->width * a->height * 4;
+
+    if (!decoded[id]) {
+        if (lz4_decompress(&asset_pack[a->offset], a->size, (unsigned char *) pixels, bytes) != bytes) {
+            hal_log("Asset ");
+            hal_log_hex(id);
+            hal_log(" is corrupt\n");
+            return 0;
+        }
+        decoded[id] = 1;
+    }
+
+    *width = a->width;
+    *height = a->height;
+    return pixels;
+}
@@ -0,0 +1,8 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "asset_pack.h"
+
+const unsigned int *asset_load(int id, int *width, int *height);
+
+#endif
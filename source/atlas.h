@@ -0,0 +1,1337 @@
+/* Sprite atlas, generated by tools/mkatlas.py from the images in art/. Do not edit. */
+
+#define ATLAS_MARIO_RIGHT1 0
+#define ATLAS_MARIO_RIGHT2 1
+#define ATLAS_BIRD_RIGHT1 2
+#define ATLAS_BIRD_RIGHT2 3
+#define ATLAS_BIRD_RIGHT3 4
+#define ATLAS_BANANARANGPACK 5
+#define ATLAS_COINPACK 6
+#define ATLAS_EMPTYPACK 7
+#define ATLAS_HEARTPACK 8
+#define ATLAS_TELEPORTER 9
+#define ATLAS_ENEMY 10
+#define ATLAS_DK_RIGHT1 11
+#define ATLAS_DK_RIGHT2 12
+#define ATLAS_DK_UP1 13
+#define ATLAS_DK_UP2 14
+#define ATLAS_BANANARANG 15
+#define ATLAS_BANANARANG2 16
+#define ATLAS_BANANARANG3 17
+#define ATLAS_FRAMES 18
+
+struct atlas_frame
+{
+    unsigned int offset; // In words from the start of atlas_spans.
+    unsigned int width;
+    unsigned int height;
+};
+
+static const struct atlas_frame atlas_frames[ATLAS_FRAMES] = {
+    { 0, 32, 32 }, // mario_right1, 598 of 1024 pixels drawn
+    { 785, 32, 32 }, // mario_right2, 592 of 1024 pixels drawn
+    { 1551, 32, 32 }, // bird_right1, 468 of 1024 pixels drawn
+    { 2127, 32, 32 }, // bird_right2, 406 of 1024 pixels drawn
+    { 2599, 32, 32 }, // bird_right3, 430 of 1024 pixels drawn
+    { 3098, 32, 32 }, // bananarangpack, 547 of 1024 pixels drawn
+    { 3811, 32, 32 }, // coinpack, 501 of 1024 pixels drawn
+    { 4415, 32, 32 }, // emptypack, 106 of 1024 pixels drawn
+    { 4558, 32, 32 }, // heartpack, 513 of 1024 pixels drawn
+    { 5149, 32, 32 }, // teleporter, 411 of 1024 pixels drawn
+    { 5700, 32, 32 }, // enemy, 1024 of 1024 pixels drawn
+    { 6788, 32, 32 }, // dk_right1, 585 of 1024 pixels drawn
+    { 7494, 32, 32 }, // dk_right2, 579 of 1024 pixels drawn
+    { 8153, 32, 32 }, // dk_up1, 611 of 1024 pixels drawn
+    { 8851, 32, 32 }, // dk_up2, 601 of 1024 pixels drawn
+    { 9525, 32, 32 }, // bananarang, 126 of 1024 pixels drawn
+    { 9719, 32, 32 }, // bananarang2, 117 of 1024 pixels drawn
+    { 9897, 32, 32 }, // bananarang3, 100 of 1024 pixels drawn
+};
+
+#define ATLAS_WORDS 10051
+
+static unsigned int atlas_spans[ATLAS_WORDS] __attribute__((aligned(64))) = {
+    // mario_right1
+    0x00000001, 0x000c0019, 0xca1d1c1b, 0x9f1d1c1b, 0x9b1d1c1b, 0x7a1d1c1b, 0x6f1d1c1b, 0x6f1d1c1b,
+    0x611d1c1b, 0xa81d1c1b, 0xa81d1c1b, 0xa81d1c1b, 0xa11d1c1b, 0xd31d1c1b, 0x00000003, 0x000a0007,
+    0xc91d1c1b, 0xb81d1c1b, 0xd31d1c1b, 0x00000010, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713,
+    0xfff83612, 0xfff83e24, 0xfff83713, 0xfffbb6b2, 0x00000007, 0xacfdd9d7, 0x3cfeefee, 0xa61d1c1b,
+    0x00000005, 0x000a0003, 0xa61d1c1b, 0x00000002, 0xfff83713, 0x00000009, 0xdbf83713, 0xf9f83713,
+    0xfcf83713, 0xfef83713, 0x0000000a, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713, 0xfffee3e2,
+    0x0000000f, 0xb2feeeed, 0x4cfee3e2, 0xc91d1c1b, 0x931d1c1b, 0x9c1d1c1b, 0x081d1c1b, 0x011d1c1b,
+    0x00000005, 0x000a0003, 0x8b1d1c1b, 0x0000001a, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713,
+    0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713,
+    0xfff83713, 0x00000005, 0xb8f83713, 0xeaf83713, 0x00000002, 0xff1d1c1b, 0x00000003, 0x011d1c1b,
+    0x00000005, 0x00090009, 0xa81d1c1b, 0xb81d1c1b, 0xa0bf601c, 0xfec05f1c, 0x00000012, 0xffc05f1c,
+    0xffc46522, 0xffdf8942, 0xffed994e, 0xffe28c44, 0xffce7331, 0xffde8944, 0xffeb9850, 0xffef9d52,
+    0x00000003, 0xdeef984e, 0x00000002, 0xff1d1c1b, 0x00000005, 0x0bf65d2b, 0x041d1c1b, 0x00000005,
+    0x0008000b, 0xb31d1c1b, 0x841d1c1b, 0x6da8782d, 0xdcc19041, 0xfece9c4b, 0x00000012, 0xffc49344,
+    0xffad7d31, 0xffd09e4d, 0xffe7b25b, 0xffd7a451, 0xff9d6e21, 0xff9d6e21, 0xffd3a04e, 0xffe6b15a,
+    0x00000005, 0xeeebb65e, 0xa7ebb55d, 0x00000002, 0xff1d1c1b, 0x00000003, 0x021d1c1b, 0x00000007,
+    0x00070007, 0xda1d1c1b, 0xe41d1c1b, 0x4890610e, 0x00000014, 0xff9d6e21, 0xffcd9c4b, 0xffe7b35c,
+    0xffd8a653, 0xff9d6e21, 0xffb48538, 0xffd3a24f, 0xffdeac57, 0xffe7e7e7, 0xff1d1c1b, 0x00000003,
+    0xeadaa854, 0x00000002, 0xffe6b25b, 0x00000007, 0xfeeab65e, 0xfbeab65e, 0xf5eab65e, 0x00000002,
+    0xff1d1c1b, 0x00000003, 0x011d1c1b, 0x00000009, 0x00070005, 0x791d1c1b, 0x38926313, 0x00000002,
+    0xff9d6e21, 0x00000003, 0xe5a7782c, 0x00000012, 0xffce9d4b, 0xffe8b45d, 0xffd9a753, 0xff9d6e21,
+    0xff9d6e21, 0xffc49344, 0xffe3b05a, 0xffe8b45d, 0xffe6b35c, 0x00000005, 0xc8d6a451, 0xd9d5a250,
+    0x00000004, 0xffe0ad57, 0xffe9b55d, 0x00000005, 0xfee8b55d, 0xf9e9b55e, 0x00000002, 0xff1d1c1b,
+    0x00010003, 0x011e1c1b, 0x00000005, 0x00070009, 0x841d1c1b, 0x63936413, 0xd9926312, 0xfda5762a,
+    0x00000012, 0xffcc9b4b, 0xffe7b45c, 0xffe1ae58, 0xffca9949, 0xffc49445, 0xffd6a451, 0xffdeab56,
+    0xffd09e4d, 0xffc79747, 0x00000003, 0xa2352812, 0x0000000c, 0xff50370d, 0xff50370d, 0xff50370d,
+    0xff50370d, 0xff50370d, 0xff1d1c1b, 0x00000003, 0x011d1c1b, 0x00000007, 0x00070003, 0x931d1c1b,
+    0x00000002, 0xff1d1c1b, 0x00000003, 0xa3926312, 0x00000004, 0xff9d6e21, 0xff9d6e21, 0x00000003,
+    0xfbd9a653, 0x0000001a, 0xffe8b35c, 0xffe8b45c, 0xffe8b45d, 0xffe9b55d, 0xffdfac57, 0xffc49445,
+    0xff795416, 0xff795416, 0xff795416, 0xff795416, 0xff795416, 0xff795416, 0xff1d1c1b, 0x00000003,
+    0x031d1c1b, 0x00000006, 0x00080007, 0xa81d1c1b, 0xc91d1c1b, 0x7f926414, 0x00000002, 0xff9d6e21,
+    0x00000005, 0xcacd8640, 0xf9ea9e55, 0x00000014, 0xffeab15f, 0xffe9b662, 0xffe9b660, 0xffe9b65e,
+    0xffe2af59, 0xffca9948, 0xffb37d26, 0xffb37d26, 0xffb37d26, 0xffb37d26, 0x00000003, 0xeab37d26,
+    0x00000002, 0xff1d1c1b, 0x00000008, 0x00090005, 0x9e1d1c1b, 0x931d1c1b, 0x00000002, 0xff1d1c1b,
+    0x00000005, 0xa0de5d80, 0xf4d67898, 0x0000000a, 0xffcf9ea1, 0xffcea8a2, 0xffdbaf8a, 0xffe7b569,
+    0xffe9b55e, 0x00000005, 0xf9e8b35c, 0xd5e6b25b, 0x00000002, 0xff795416, 0x00000003, 0xea795416,
+    0x00000004, 0xff1d1c1b, 0xff1d1c1b, 0x00000005, 0x000a0003, 0xa81d1c1b, 0x0000000e, 0xff6284fb,
+    0xff7893f2, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xffd6a493, 0x00000007, 0xf7e8a569,
+    0xcdebad5c, 0x6bebb35c, 0x00000002, 0xff1d1c1b, 0x00000003, 0x051d1c1b, 0x00000002, 0x00090016,
+    0xff1d1c1b, 0xfff83713, 0xff7893f2, 0xff7893f2, 0xffe14e30, 0xfff04356, 0xffe14e30, 0xff6284fb,
+    0xff6284fb, 0xff6284fb, 0xff6284fb, 0x00000005, 0x32ed6c63, 0x501d1c1b, 0x00000002, 0x0008001a,
+    0xff1d1c1b, 0xff1d1c1b, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xfff2404c, 0xfff8381c, 0xfff8381d,
+    0xffe14e30, 0xffdc558d, 0xff6284fb, 0xfff5ea15, 0xff7893f2, 0x0000000d, 0x6f1d1c1b, 0xa91d1c1b,
+    0xa81d1c1b, 0xa81d1c1b, 0xa81d1c1b, 0xb81d1c1b, 0x00000005, 0x00060005, 0x521d1c1b, 0x621d1c1b,
+    0x0000001a, 0xff1d1c1b, 0xfff83713, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xffc2391d, 0xffc2391d,
+    0xfff83712, 0xfff83717, 0xfff53c39, 0xffe14e30, 0xff6284fb, 0xff6284fb, 0x0000000b, 0x75bcb3ee,
+    0xb0eae8fa, 0xcfffffff, 0x8bffffff, 0x39ffffff, 0x00000002, 0xff1d1c1b, 0x00000005, 0x6d1d1c1b,
+    0x741d1c1b, 0x00000003, 0x00060003, 0x171d1c1b, 0x0000001a, 0xff1d1c1b, 0xfff83713, 0xfff83713,
+    0xff7893f2, 0xff6284fb, 0xff6284fb, 0xffb63318, 0xffb63318, 0xffc2391d, 0xfff83713, 0xfff83714,
+    0xfff63a31, 0xffed445d, 0x00000013, 0xfee9456b, 0xfef0a3b0, 0xfefae3e7, 0xfaffffff, 0xebffffff,
+    0xdaffffff, 0xb1ffffff, 0x53ffffff, 0xde1d1c1b, 0x00000002, 0x00080020, 0xff1d1c1b, 0xffb63318,
+    0xff7893f2, 0xff7893f2, 0xff6284fb, 0xff6284fb, 0xffb6270a, 0xffc2391d, 0xfff83710, 0xfff83713,
+    0xfff83715, 0xfff7371b, 0xfff53c39, 0xfff53c39, 0xfffddcdb, 0xfffffcfc, 0x0000000b, 0xfeffffff,
+    0xfcffffff, 0xd2ffffff, 0x63ffffff, 0xf11e1d1c, 0x00000003, 0x00090003, 0xea1d1c1b, 0x0000001e,
+    0xff7893f2, 0xff7893f2, 0xff7893f2, 0xff6284fb, 0xff6284fb, 0xffb63318, 0xffb63318, 0xffc2391d,
+    0xfff83713, 0xfff83712, 0xfff8350f, 0xfff83715, 0xfffa9f9a, 0xfffddcdb, 0xfffffcfc, 0x00000009,
+    0xfeffffff, 0xd4ffffff, 0x64ffffff, 0xf11e1d1c, 0x00000003, 0x00090003, 0x611d1c1b, 0x0000001a,
+    0xff7893f2, 0xff7893f2, 0xff7893f2, 0xff7893f2, 0xff6984e3, 0xff6284fb, 0xffb63318, 0xffb63318,
+    0xffb63318, 0xffc2391d, 0xffc2391d, 0xffc2391d, 0xffc2391d, 0x0000000d, 0xf6facecf, 0xf0fefbfb,
+    0xefffffff, 0xbfffffff, 0xd31d1c1b, 0xac1e1d1c, 0x00000003, 0x00090003, 0xc91d1c1b, 0x00000018,
+    0xff7893f2, 0xff7893f2, 0xff6284fb, 0xff7893f2, 0xff6984e3, 0xff6984e3, 0xff6984e3, 0xff6284fb,
+    0xffb6270a, 0xffb63318, 0xffb63318, 0xffb63318, 0x0000000d, 0xe4b63318, 0xe41d1c1b, 0xc91d1c1b,
+    0x8d1d1c1b, 0xac1d1c1b, 0xd31d1c1b, 0x00000003, 0x00090003, 0xc91d1c1b, 0x00000018, 0xff7893f2,
+    0xff6984e3, 0xff7893f2, 0xff7893f2, 0xff6984e3, 0xff6484fa, 0xff6984e3, 0xff6984e3, 0xff6984e3,
+    0xff6284fb, 0xff6284fb, 0xff6284fb, 0x00000007, 0xb9807ded, 0xe41d1c1b, 0x9e1d1c1b, 0x00000005,
+    0x00090003, 0x901d1c1b, 0x0000001a, 0xff6984e3, 0xff6384fa, 0xff6984e3, 0xff6984e3, 0xff6984e3,
+    0xff6984e3, 0xff6284fb, 0xff6384fb, 0xff6984e3, 0xff6984e3, 0xff6984e3, 0xff6984e3, 0xff6984e3,
+    0x00000003, 0x674364f0, 0x00000002, 0xff1d1c1b, 0x00000003, 0xac1d1c1b, 0x00000005, 0x00030007,
+    0x651d1c1b, 0xec1d1c1b, 0xba1d1c1b, 0x00000004, 0xff1d1c1b, 0xff1d1c1b, 0x00000009, 0xdb1d1c1b,
+    0x881d1c1b, 0xe46384fa, 0xe46384fa, 0x00000014, 0xff6984e3, 0xff6284fb, 0xff6284fb, 0xff6284fb,
+    0xff6284fb, 0xff5571d3, 0xff5571d3, 0xff5571d3, 0xff5576f5, 0xff4a6bf1, 0x00000009, 0xe94a6bf1,
+    0xa95475f5, 0x4b6182fa, 0xba1d1c1b, 0x00000006, 0x00030007, 0xea1d1c1b, 0xfc946312, 0xec946312,
+    0x00000006, 0xff946312, 0xff946312, 0xff946312, 0x00000007, 0xc3936424, 0xe46384fa, 0xe46384fa,
+    0x00000014, 0xff6384fa, 0xff6284fb, 0xff6284fb, 0xff5571d3, 0xff5571d3, 0xff5571d3, 0xff4f6ff3,
+    0xff4a6af1, 0xff4767f0, 0xff5070f3, 0x00000007, 0xfe5b7df8, 0xe06284fb, 0x876284fb, 0x00000002,
+    0xff1d1c1b, 0x00000009, 0x00030003, 0xd31d1c1b, 0x00000002, 0xff946312, 0x00000005, 0xd3946312,
+    0xd3946312, 0x00000004, 0xff946312, 0xff946312, 0x00000007, 0xc9946312, 0xec6384fa, 0xfc6384fa,
+    0x00000004, 0xff6384fa, 0xff6284fb, 0x00000003, 0xfe6284fb, 0x0000000e, 0xff5571d3, 0xff4363ef,
+    0xff4363ef, 0xff4363ef, 0xff4363ef, 0xff5571d3, 0xff5e80f9, 0x00000009, 0xee6284fb, 0xb56284fb,
+    0x576284fb, 0xa61d1c1b, 0x00000007, 0x00030003, 0xd31d1c1b, 0x00000002, 0xff946312, 0x00000009,
+    0xf4946312, 0xf4946312, 0xba946312, 0xec936413, 0x00000002, 0xff946312, 0x00000005, 0xad6384fa,
+    0xea6384fa, 0x00000014, 0xff6384fa, 0xff5571d3, 0xff5571d3, 0xff4363ef, 0xff4363ef, 0xff4363ef,
+    0xff5571d3, 0xff5571d3, 0xff6283fa, 0xff6283fa, 0x00000009, 0xd16383fa, 0xf46383fa, 0xd31d1c1b,
+    0xd91d1c1b, 0x00000005, 0x00030013, 0xa81d1c1b, 0xea946312, 0xd3946312, 0xd3946312, 0xec946312,
+    0xfa936413, 0xfb936410, 0xba6384fa, 0xec6384fa, 0x00000008, 0xff6384fa, 0xff4363ef, 0xff4363ef,
+    0xff1d1c1b, 0x00000005, 0xd31d1c1b, 0xd31d1c1b, 0x0000000a, 0xff5571d3, 0xff946312, 0xff946312,
+    0xff946312, 0xff946312, 0x00000005, 0xf4946312, 0xd31d1c1b, 0x00000006, 0x00030003, 0xa81d1c1b,
+    0x00000002, 0xff946312, 0x00000017, 0xf4946312, 0xf4946312, 0xf7936414, 0xe1936414, 0xf41d1c1b,
+    0xd31d1c1b, 0xc91d1c1b, 0xc91d1c1b, 0xea1d1c1b, 0xc91d1c1b, 0xea1d1c1b, 0x0001000d, 0xa11d1c1b,
+    0xea946312, 0xe4946312, 0xe4946312, 0xd3946312, 0xf4946312, 0x00000002, 0xff946312, 0x00000005,
+    0xea1d1c1b, 0xa81d1c1b, 0x00000006, 0x00030007, 0x9e1d1c1b, 0x9e946312, 0xc9946312, 0x00000002,
+    0xff946312, 0x00000007, 0xe41d1c1b, 0xe41d1c1b, 0x1f936414, 0x0007000f, 0xa81d1c1b, 0xea1d1c1b,
+    0xdf936416, 0xe4936416, 0xd3936416, 0xd0936416, 0xb8946312, 0x00000004, 0xff946312, 0xff946312,
+    0x00000003, 0xba1d1c1b, 0x00000004, 0x00030007, 0xc91d1c1b, 0xc9946312, 0xc9946312, 0x00000002,
+    0xff1d1c1b, 0x00000003, 0x59936414, 0x00090015, 0x2f936414, 0x861d1c1b, 0xf8936414, 0x92936414,
+    0xfd936414, 0xf8936414, 0xed936414, 0xdd936414, 0x9f936414, 0xd31d1c1b, 0x00000005, 0x00030005,
+    0xea1d1c1b, 0xa81d1c1b, 0x00000002, 0xff1d1c1b, 0x000b000f, 0x3e936414, 0xd31d1c1b, 0xd31d1c1b,
+    0x931d1c1b, 0x931d1c1b, 0x9e1d1c1b, 0xc91d1c1b, 0x00000004, 0xff1d1c1b, 0xff1d1c1b, 0x00000003,
+    0xe41d1c1b,
+    // mario_right2
+    0x00000004, 0x000a0007, 0xba1d1c1b, 0xc41d1c1b, 0xd31d1c1b, 0x00000002, 0xff1d1c1b, 0x0000000b,
+    0xba1d1c1b, 0xec1d1c1b, 0xe71d1c1b, 0x9b1d1c1b, 0xa81d1c1b, 0x00000002, 0xff1d1c1b, 0x00000004,
+    0x00090002, 0xff1d1c1b, 0x0000000d, 0x58f83713, 0xd7f83713, 0xe1f83713, 0xf8f83713, 0xecf83713,
+    0xfcf83612, 0x00000004, 0xfff83c1e, 0xfff85b4d, 0x00000007, 0xeafcc8c5, 0xa7fff8f7, 0xd11d1c1b,
+    0x00000003, 0x00080009, 0xe41d1c1b, 0x7bf83713, 0xf3f83713, 0xfef83713, 0x0000000e, 0xfff83713,
+    0xfff83713, 0xfff83713, 0xfff83200, 0xfff85b4d, 0xfffcd3d1, 0xfffef4f3, 0x0000000b, 0xaffef2f1,
+    0xec1d1c1b, 0xba1d1c1b, 0xcc1d1c1b, 0xcc1d1c1b, 0x00000003, 0x00080005, 0xba1d1c1b, 0x7cf23c13,
+    0x00000012, 0xfff23c13, 0xfff23c13, 0xfff23d14, 0xfff5481d, 0xfff74d22, 0xfff6491d, 0xfff34320,
+    0xfff6644e, 0xfff86f5a, 0x0000000d, 0xf8f7654c, 0xe7f74d24, 0xd7f83b16, 0xd6f83713, 0x71f83713,
+    0xd31d1c1b, 0x00000003, 0x00080005, 0xea1d1c1b, 0x90a66b21, 0x00000014, 0xffa86c22, 0xffa66a20,
+    0xffa3661c, 0xffd49a4a, 0xffeeb25c, 0xffdca150, 0xffae7229, 0xffae7229, 0xffeaae59, 0xffebb05a,
+    0x00000009, 0xddebaf5a, 0x48ee9e50, 0xa81d1c1b, 0x871d1c1b, 0x00000003, 0x00070007, 0xa71d1c1b,
+    0x8f936414, 0xfac49445, 0x00000014, 0xffe6b25b, 0xffdba955, 0xffa7782c, 0xffcb9a4a, 0xffe9b55e,
+    0xffdba954, 0xffffffff, 0xff1d1c1b, 0xffd09e4d, 0xffebb75e, 0x0000000b, 0xfceab65e, 0xedeab65e,
+    0xeceab65e, 0x87eab65e, 0x931d1c1b, 0x00000003, 0x00070005, 0xe41d1c1b, 0xac936414, 0x0000001c,
+    0xffc69646, 0xffecb75f, 0xffe1ae58, 0xffa6772b, 0xff966719, 0xffc49344, 0xffe8b45d, 0xffe5b15b,
+    0xffe4b15a, 0xffe4b15a, 0xffe6b35c, 0xffeab65e, 0xffeab65e, 0xffeab65e, 0x00000007, 0xfaeab65e,
+    0xa0eab65e, 0xba1d1c1b, 0x00000003, 0x00060007, 0xd31d1c1b, 0xd3936414, 0xfc936414, 0x0000001c,
+    0xffc79647, 0xffebb75f, 0xffe2ae59, 0xffad7d32, 0xff9a6b1e, 0xffc39344, 0xffe8b45d, 0xffe5b15b,
+    0xffe4b15a, 0xffbf8f41, 0xffb9893c, 0xffe2af59, 0xffe4b15a, 0xffe4b15a, 0x00000007, 0xfae7b35c,
+    0xabeab65e, 0xec1d1c1b, 0x00000003, 0x00060005, 0xc91d1c1b, 0xe5936414, 0x0000001e, 0xff936414,
+    0xffc39344, 0xffe7b35c, 0xffe9b55d, 0xffe5b25b, 0xffe4b15a, 0xffe8b45d, 0xffddaa55, 0xffac7d31,
+    0xff9e6f23, 0xff50370d, 0xff50370d, 0xff50370d, 0xff50370d, 0xff50370d, 0x00000005, 0x91a47529,
+    0xec1d1c1b, 0x00000003, 0x00060009, 0x26936414, 0x931d1c1b, 0xd8936414, 0xf5966719, 0x00000016,
+    0xffb7883a, 0xffe3af59, 0xffe9b55e, 0xffeab65e, 0xffeab65e, 0xffe9b55d, 0xffe0ad58, 0xffb18236,
+    0xff9b6c1f, 0xff9d6e22, 0xff9d6e22, 0x00000009, 0xfe9c6e21, 0xf3966719, 0x73936413, 0xba1d1c1b,
+    0x00000004, 0x0007000d, 0x0a936414, 0xa81d1c1b, 0xd31d1c1b, 0xc3956617, 0xedaa7b2f, 0xfcdca955,
+    0x0000000a, 0xffe5b25b, 0xffe4b15a, 0xffe6b25b, 0xffe9b55d, 0xffe6b25b, 0x0000000b, 0xf3e4b15a,
+    0xe9e4b05a, 0xeae4b15a, 0xa5e4b05a, 0x41d9a753, 0x00000002, 0xff1d1c1b, 0x00000003, 0x000b0005,
+    0xf41d1c1b, 0xdc99715c, 0x00000008, 0xff9a7157, 0xff986f57, 0xffb18358, 0xffe6ab5a, 0x00000011,
+    0xfeecb05b, 0x89e3ad76, 0x20bea3b9, 0x931d1c1b, 0xec1d1c1b, 0xc61d1c1b, 0x07ffffff, 0xc41d1c1b,
+    0x00000005, 0x00090007, 0xc91d1c1b, 0xa61d1c1b, 0xf46284fb, 0x0000000c, 0xff6284fb, 0xff6284fb,
+    0xff6284fb, 0xff6284fb, 0xffe8596e, 0xfff54f32, 0x00000003, 0xf7c16cb9, 0x00000004, 0xff6284fb,
+    0xff1d1c1b, 0x0000000b, 0x039db0fd, 0x0cffffff, 0xec1d1c1b, 0x93ffffff, 0xf41d1c1b, 0x00000006,
+    0x00080002, 0xff1d1c1b, 0x00000007, 0x85f8370b, 0xf2f53b33, 0xfef04151, 0x0000000e, 0xfff04253,
+    0xfff1404e, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xffdb568f, 0xfff33e42, 0x00000003, 0xfbce5fa6,
+    0x00000004, 0xff6284fb, 0xff1d1c1b, 0x0000000b, 0xa3fffcfa, 0xf8ffffff, 0xfcffffff, 0xd4ffffff,
+    0xa81d1c1b, 0x00000007, 0x00070007, 0xd31d1c1b, 0xb2f83713, 0xf9f83713, 0x00000014, 0xfff83713,
+    0xfff83713, 0xfff83713, 0xfff83711, 0xfff63a2b, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xffcf5ea5,
+    0xffd75997, 0x00000003, 0xfc9876df, 0x00000002, 0xff6284fb, 0x00000003, 0xf8fcdcdc, 0x00000004,
+    0xffffffff, 0xffffffff, 0x00000005, 0xe6ffffff, 0xa81d1c1b, 0x00000003, 0x00060007, 0xd31d1c1b,
+    0xd3f83713, 0xfcf83713, 0x00000020, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713,
+    0xfffa3400, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xffc862af, 0xfff83717, 0xffe24e7e, 0xff6284fb,
+    0xffded9f6, 0xfffffcfa, 0xfffffdfd, 0x00000005, 0xd3fef7f6, 0xa81d1c1b, 0x00000003, 0x00060005,
+    0xd31d1c1b, 0xe5f83713, 0x00000020, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713, 0xfff83713,
+    0xfff83711, 0xfff63a2b, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xffc862af, 0xfffb3300, 0xffe84a70,
+    0xff6284fb, 0xffd66ca5, 0xfffdbdb7, 0x00000007, 0xfcfddddb, 0x89f97971, 0xb41d1c1b, 0x00000003,
+    0x00050007, 0xba1d1c1b, 0x45f83713, 0xe7f83713, 0x0000001e, 0xfff83713, 0xfff83713, 0xfff83713,
+    0xfff83713, 0xfff83718, 0xfff43d3d, 0xff6284fb, 0xff7580f3, 0xff6685fa, 0xff7690f4, 0xffc770b1,
+    0xfff53934, 0xffe9506d, 0xff9c88de, 0xffd96295, 0x00000007, 0xf9fa4c30, 0xb3f96256, 0x5d1d1c1b,
+    0x00000003, 0x00040009, 0xaf1d1c1b, 0x5df83713, 0xebf83713, 0xfdf83713, 0x0000001a, 0xfff83713,
+    0xfff8370f, 0xfff63b32, 0xfff04151, 0xffed455e, 0xff6284fb, 0xff6284fb, 0xff6083fc, 0xff6284fb,
+    0xffd7dca7, 0xffb9bfc9, 0xffad68ce, 0xffed7966, 0x00000009, 0xfeefdd75, 0xf3f59b4d, 0x87f81100,
+    0xa81d1c1b, 0x00000003, 0x00040007, 0xea1d1c1b, 0x66f96154, 0xfbf96154, 0x0000001c, 0xfff96154,
+    0xfff96154, 0xfffa5f4c, 0xffde729d, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6184fb, 0xff6284fb,
+    0xff6485fa, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0x00000007, 0xf46284fb, 0xea1d1c1b,
+    0xd31d1c1b, 0x00000003, 0x00040007, 0xa81d1c1b, 0x66fef6f5, 0xfbfef6f5, 0x0000001c, 0xfffef6f5,
+    0xfffef6f5, 0xfffff6f5, 0xfffdf8f8, 0xffeaecfe, 0xff6284fb, 0xff5d81fb, 0xff6284fb, 0xff6284fb,
+    0xff6f87ed, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0x00000003, 0xd31d1c1b, 0x00000003,
+    0x00040007, 0xd31d1c1b, 0x66ffffff, 0xfbffffff, 0x0000001e, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffefeff, 0xffeaedfe, 0xff6284fb, 0xff5d81fb, 0xff6284fb, 0xff6284fb, 0xff6f87ed, 0xff6f87ed,
+    0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0x00000003, 0xa61d1c1b, 0x00000005, 0x00040009,
+    0xd31d1c1b, 0x5dffffff, 0xebffffff, 0xfdffffff, 0x0000001c, 0xffffffff, 0xffffffff, 0xffe1e5fe,
+    0xff8199fb, 0xff6586fb, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6f87ed, 0xff6f87ed,
+    0xff6483f8, 0xff6782f2, 0xff6284fb, 0x00000003, 0xc91d1c1b, 0x00020003, 0x1e936414, 0x00010003,
+    0x1c1d1c1b, 0x00000005, 0x00050002, 0xff1d1c1b, 0x00000009, 0x40ffffff, 0xd4ffffff, 0xecffffff,
+    0xf5fcfdff, 0x00000018, 0xffd6dbfd, 0xff3e5ce5, 0xff5b76ee, 0xff6f87ed, 0xff6f87ed, 0xff6284fb,
+    0xff6284fb, 0xff6284fb, 0xff6f87ed, 0xff6f87ed, 0xff6284fb, 0xff6284fb, 0x00000005, 0xa81d1c1b,
+    0x24956200, 0x00030005, 0x07946312, 0x6d1d1c1b, 0x00000005, 0x00060005, 0xa81d1c1b, 0x14f9f8f7,
+    0x00000002, 0xff1d1c1b, 0x00000003, 0x9b8b9df5, 0x00000016, 0xff6882f5, 0xff2448e7, 0xff5b76ee,
+    0xff6f87ed, 0xff6f87ed, 0xff6f87ed, 0xff6284fb, 0xff6284fb, 0xff6284fb, 0xff6984e3, 0xff6284fb,
+    0x00000007, 0xea6284fb, 0xa81d1c1b, 0x34936410, 0x00000005, 0x00060003, 0xe41d1c1b, 0x00000002,
+    0xff1d1c1b, 0x00000005, 0xb1936411, 0xf97c77bf, 0x00000018, 0xff6183fc, 0xff597af7, 0xff2448e7,
+    0xff3e5ce5, 0xff5b76ee, 0xff5b76ee, 0xff6f87ed, 0xff6284fb, 0xff6284fb, 0xff6384fa, 0xff6981ee,
+    0xff6981ee, 0x0000000f, 0x931d1c1b, 0x451d1c1b, 0x2f1d1c1b, 0x661d1c1b, 0xf41d1c1b, 0xd31d1c1b,
+    0x601d1c1b, 0x00000005, 0x00050009, 0xe41d1c1b, 0xce936414, 0xeb936414, 0xf9936412, 0x0000000c,
+    0xff7e75b6, 0xff6583f6, 0xff6283fa, 0xff5e7ff9, 0xff2448e7, 0xff2448e7, 0x00000003, 0xfa3b5bec,
+    0x00000010, 0xff5b76ee, 0xff6284fb, 0xff5b76ee, 0xff6384fa, 0xff6484f9, 0xff6882f2, 0xff946312,
+    0xff1d1c1b, 0x0000000d, 0xea1d1c1b, 0xa81d1c1b, 0xba946312, 0xec946312, 0xba1d1c1b, 0x2a1d1c1b,
+    0x0000000b, 0x00040003, 0x9a1d1c1b, 0x00000002, 0xff936414, 0x00000003, 0xfb936414, 0x0000000a,
+    0xff936414, 0xff936414, 0xff926533, 0xff85709d, 0xff6981ef, 0x0000000b, 0xfe6384fa, 0xf15f81fa,
+    0xee5e7ff9, 0xa55e7ff9, 0xe41d1c1b, 0x00000006, 0xff3e5ce5, 0xff5571d3, 0xff6384fa, 0x00000003,
+    0xfd6882f2, 0x00000004, 0xff946312, 0xff946312, 0x00000005, 0xfd936413, 0xfa946313, 0x00000004,
+    0xff936413, 0xff936413, 0x00000007, 0xf2936413, 0xe21d1c1b, 0x381d1c1b, 0x0000000b, 0x00040003,
+    0xa81d1c1b, 0x00000002, 0xff936414, 0x00000005, 0xeb936414, 0xfd936414, 0x00000004, 0xff936414,
+    0xff936410, 0x00000003, 0xf8926528, 0x00000002, 0xff1d1c1b, 0x0000000b, 0xa81d1c1b, 0xa81d1c1b,
+    0xe41d1c1b, 0xcc1d1c1b, 0xe41d1c1b, 0x0000000a, 0xff3e5ce5, 0xff4363ef, 0xff6384fa, 0xff946312,
+    0xff946312, 0x00000003, 0xc6936410, 0x00000008, 0xff946312, 0xff946312, 0xff936413, 0xff936413,
+    0x00000005, 0xd31d1c1b, 0x401d1c1b, 0x00000007, 0x00050004, 0xff1d1c1b, 0xff936414, 0x00000003,
+    0xe7936414, 0x00000006, 0xff936414, 0xff936414, 0xff1d1c1b, 0x00000005, 0x208f6757, 0x076a80ec,
+    0x0004000d, 0xc91d1c1b, 0xb81d1c1b, 0xc91d1c1b, 0xd31d1c1b, 0xdb1d1c1b, 0xb3936413, 0x00000004,
+    0xff936413, 0xff936413, 0x00000005, 0xf4936413, 0xd31d1c1b, 0x00000005, 0x00060004, 0xff1d1c1b,
+    0xff936414, 0x00000003, 0xfc936414, 0x00000002, 0xff936414, 0x00000005, 0xb6936414, 0xd31d1c1b,
+    0x0009000b, 0x541d1c1b, 0xb31d1c1b, 0xf4936413, 0xf4936413, 0xf41d1c1b, 0x00000005, 0x00070005,
+    0xec1d1c1b, 0xba1d1c1b, 0x00000004, 0xff1d1c1b, 0xff1d1c1b, 0x00000005, 0xd31d1c1b, 0x22936414,
+    0x00090007, 0x631d1c1b, 0xd31d1c1b, 0xd31d1c1b, 0x00030003, 0x441d1c1b,
+    // bird_right1
+    0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00090002, 0xff231f1f, 0x00000003, 0x477a9f2d,
+    0x00000001, 0x00080006, 0xff231f1f, 0xff6e7c7f, 0xff231f1f, 0x00000006, 0x00050002, 0xff231f1f,
+    0x00000003, 0x307ca22f, 0x0000000a, 0xff231f1f, 0xff365b4a, 0xff73bdd6, 0xff7b8279, 0xff231f1f,
+    0x00090002, 0xff231f1f, 0x00000003, 0x069dcc3d, 0x00000002, 0xff231f1f, 0x00000003, 0x00040010,
+    0xff231f1f, 0xff6997a6, 0xff231f1f, 0xff231f1f, 0xff095e75, 0xff23b0d9, 0xff9abcc7, 0xff231f1f,
+    0x00050004, 0xff231f1f, 0xff231f1f, 0x00010008, 0xff231f1f, 0xff336879, 0xff231f1f, 0xff231f1f,
+    0x00000002, 0x00040012, 0xff231f1f, 0xff3db1d4, 0xff93afb8, 0xff3c4b1f, 0xff00627d, 0xff01a7d1,
+    0xff61c3e2, 0xff829497, 0xff231f1f, 0x00030010, 0xff231f1f, 0xff35574d, 0xff587370, 0xff231f1f,
+    0xff2f2007, 0xff0788aa, 0xff63adc5, 0xff231f1f, 0x00000003, 0x00030003, 0x0f9ccb3c, 0x00000014,
+    0xff231f1f, 0xff02a1c9, 0xff74c7e4, 0xff9aa6aa, 0xff155266, 0xff0094b9, 0xff08b2dd, 0xff89cae0,
+    0xff757d77, 0xff231f1f, 0x00020010, 0xff231f1f, 0xff165564, 0xff31a2c2, 0xff6aa3b5, 0xff293831,
+    0xff0083a4, 0xff38afd1, 0xff231f1f, 0x00000007, 0x00040018, 0xff231f1f, 0xff0090b4, 0xff00afda,
+    0xff79c8e3, 0xff7f959b, 0xff185d74, 0xff00a2ca, 0xff14b4de, 0xff89bed0, 0xff566944, 0xff231f1f,
+    0xff231f1f, 0x00000003, 0x0c9dcc3d, 0x00000002, 0xff231f1f, 0x00000003, 0xd3085e74, 0x00000006,
+    0xff17a3c9, 0xff378aa2, 0xff027e9d, 0x00000003, 0xfc1eabd0, 0x00000002, 0xff231f1f, 0x00000005,
+    0x00040016, 0xff231f1f, 0xff007694, 0xff009dc4, 0xff00b1dd, 0xff62c2e1, 0xff849ca4, 0xff205e74,
+    0xff0088aa, 0xff206c83, 0xff27505f, 0xff1e4d54, 0x00000009, 0xf41f5761, 0xf4255458, 0xf42e5045,
+    0xf40c2d33, 0x00000006, 0xff00566c, 0xff03a0c7, 0xff0196bb, 0x00000003, 0xec14a3c8, 0x00000002,
+    0xff231f1f, 0x00000002, 0x00030005, 0x0f8db735, 0xb862858e, 0x00000026, 0xff231f1f, 0xff0080a0,
+    0xff00a1c9, 0xff00b0dc, 0xff56bde0, 0xff7fa1ac, 0xff1d4250, 0xff0096bc, 0xff00a9d3, 0xff009dc4,
+    0xff00a2ca, 0xff0093b7, 0xff0084a5, 0xff0097bd, 0xff0095bb, 0xff0097bd, 0xff00add8, 0xff058daf,
+    0xff231f1f, 0x00000002, 0x00030003, 0x116f9127, 0x0000002a, 0xff231f1f, 0xff5aadc7, 0xff38616e,
+    0xff007593, 0xff009fc7, 0xff00b0dc, 0xff3eb9de, 0xff6398a8, 0xff206b84, 0xff00abd5, 0xff00b1dd,
+    0xff00b1dd, 0xff00acd6, 0xff00a5ce, 0xff00afdb, 0xff00b1dd, 0xff00b1dd, 0xff00a3cb, 0xff01627b,
+    0xff231f1f, 0xff231f1f, 0x00000002, 0x00030003, 0x1a719428, 0x0000002a, 0xff231f1f, 0xff0ab0da,
+    0xff3cadcf, 0xff4d8597, 0xff246379, 0xff0099bf, 0xff00b1dd, 0xff2fb6dd, 0xff5d92a3, 0xff167591,
+    0xff00afdb, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00afdb, 0xff00b0dc,
+    0xff00abd5, 0xff0583a4, 0xff231f1f, 0x00000004, 0x00030003, 0x1891bd37, 0x00000028, 0xff231f1f,
+    0xff0092b7, 0xff00acd7, 0xff16b2dc, 0xff3dabcc, 0xff2b839b, 0xff039cc3, 0xff00b1dd, 0xff2db4db,
+    0xff427483, 0xff0291b6, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff008aad,
+    0xff005167, 0xff0080a0, 0xff009ac1, 0x00000003, 0xf4057d9c, 0x00000002, 0xff231f1f, 0x00000002,
+    0x00040003, 0x8b526c21, 0x0000002a, 0xff231f1f, 0xff0088aa, 0xff00a6cf, 0xff00b0dc, 0xff05b0db,
+    0xff05a8d1, 0xff00b1dc, 0xff00b1dd, 0xff31acce, 0xff225768, 0xff00a9d3, 0xff00b1dd, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff009bc1, 0xff00171f, 0xff000205, 0xff001b24, 0xff003c4d, 0xff231f1f,
+    0x00000002, 0x00040003, 0x35526d21, 0x00000032, 0xff231f1f, 0xff4b6a75, 0xff306c82, 0xff1793b6,
+    0xff01aed9, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff05b1dd, 0xff3889a2, 0xff0086a8, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00acd7, 0xff007f9f, 0xffbdbdbd, 0xffbdbdbd, 0xff5b5b5b,
+    0xff000000, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0x00000008, 0x00030003, 0x3483aa32,
+    0x00000002, 0xff231f1f, 0x00000003, 0xea026078, 0x00000028, 0xff40a8c7, 0xff4daccc, 0xff30a5c6,
+    0xff07aad3, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff1aa8ce, 0xff045e76, 0xff00b0dc,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00a1ca, 0xffbdbdbd, 0xff231f1f, 0xffaaa9a9,
+    0xffc0a139, 0x00000005, 0xe4c0a139, 0xe4c0a139, 0x00000002, 0xffc0a139, 0x00000003, 0x72b0922b,
+    0x00000002, 0xff231f1f, 0x00000002, 0x00030036, 0xff231f1f, 0xff0d1303, 0xff001e27, 0xff006b86,
+    0xff008db1, 0xff0099c0, 0xff00a2cb, 0xff00a8d2, 0xff00aad4, 0xff00aad4, 0xff00a8d2, 0xff009fc6,
+    0xff015469, 0xff00abd6, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00afdb, 0xff00a7d0, 0xff0e83a4,
+    0xff768c97, 0xff85939b, 0xffae902a, 0xffae902a, 0xffae902a, 0xffac8a16, 0xff231f1f, 0x00000003,
+    0x0b8cb636, 0x00000002, 0x00030003, 0x346e8f28, 0x00000032, 0xff231f1f, 0xff231f1f, 0xff231f1f,
+    0xff004457, 0xff006681, 0xff00728f, 0xff007897, 0xff007a99, 0xff007796, 0xff00728e, 0xff006782,
+    0xff004e63, 0xff00abd6, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00abd6, 0xff00a2cb, 0xff00a1c9,
+    0xff00a1c9, 0xff0083a3, 0xff9c8020, 0xff9c8020, 0xff231f1f, 0xff231f1f, 0x00000002, 0x00040005,
+    0x1150691c, 0x2d28370a, 0x0000002c, 0xff231f1f, 0xff044253, 0xff007491, 0xff006c88, 0xff00627c,
+    0xff006079, 0xff00647f, 0xff05708c, 0xff288399, 0xff549fb1, 0xff6fbacd, 0xff7bbccb, 0xff7bbccb,
+    0xff6ebace, 0xff54b7d2, 0xff25b3d9, 0xff049dc4, 0xff00a7d0, 0xff008eb1, 0xffa5892a, 0xff9c8020,
+    0xff231f1f, 0x00000004, 0x00040007, 0x2a779b2c, 0x1c81a730, 0x5e9ac83b, 0x00000028, 0xff231f1f,
+    0xff0095bb, 0xff00afda, 0xff00afda, 0xff11afd9, 0xff6cb7ce, 0xffb7c4bb, 0xffd9cab2, 0xffe6cdaf,
+    0xffebcdad, 0xffeccead, 0xffeccdad, 0xffe8ccad, 0xffe5ccae, 0xffd8cab3, 0xffb5c4bd, 0xff60b7d1,
+    0xff0693b7, 0xffac8a16, 0xffa5892a, 0x00000003, 0xd6a5892a, 0x00000002, 0xff231f1f, 0x00000002,
+    0x0007002a, 0xff231f1f, 0xff007290, 0xff01a6d0, 0xff3eb5d7, 0xffb3c4be, 0xffeccdad, 0xfff0ceac,
+    0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xffefcdab, 0xfff0ceac, 0xfff0ceac,
+    0xffefcdab, 0xffdec1a1, 0xff768582, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0x00000003, 0x0c88b033,
+    0x00000001, 0x00070024, 0xff231f1f, 0xff2b5551, 0xff438fa7, 0xffc5c2af, 0xffefceac, 0xfff0ceac,
+    0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac,
+    0xffefcdaa, 0xffe5c19d, 0xffcaa784, 0xff231f1f, 0x00000001, 0x00080020, 0xff231f1f, 0xff857966,
+    0xffd9b48f, 0xffe8c4a1, 0xffefcdaa, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xffeeceac, 0xfff0ceac,
+    0xfff0ceac, 0xffefcdab, 0xffecc8a5, 0xffe0bb97, 0xffcaa784, 0xff231f1f, 0x00000002, 0x0009001c,
+    0xff231f1f, 0xff8b7359, 0xffd0ac88, 0xffe0bb95, 0xffe6c29f, 0xffebc8a4, 0xffeac9a7, 0xffebc8a6,
+    0xffebc8a5, 0xffe7c4a0, 0xffe1bd98, 0xffd8b38e, 0xff231f1f, 0xff231f1f, 0x00000003, 0x0d8ab435,
+    0x00000002, 0x000a0016, 0xff231f1f, 0xff655e3d, 0xffae8f70, 0xffd3ae8a, 0xffdbb690, 0xffdbb590,
+    0xffdcb690, 0xffdcb690, 0xffd5b08b, 0xff231f1f, 0xff231f1f, 0x00000003, 0x506a862b, 0x00000005,
+    0x000b0003, 0x0d9dcc3d, 0x00000008, 0xff231f1f, 0xff2f2007, 0xff2f2007, 0xff2f2007, 0x00000005,
+    0xb82f2007, 0xc42f2007, 0x00000002, 0xff231f1f, 0x00000005, 0x3b6b8b29, 0x0295c239, 0x00000001,
+    0x000e0005, 0x0198c63b, 0x018fba36, 0x00000000, 0x00000000, 0x00000001, 0x00010003, 0x44b1dc59,
+    // bird_right2
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00150006, 0xff231f1f, 0xff231f1f, 0xff231f1f,
+    0x00000001, 0x0012000c, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff1a6377, 0xff61a8bd, 0xff231f1f,
+    0x00000001, 0x0011000e, 0xff231f1f, 0xff418da4, 0xff628c96, 0xff231f1f, 0xff0a647c, 0xff34b1d6,
+    0xff231f1f, 0x00000001, 0x0011000e, 0xff231f1f, 0xff08657d, 0xff33a9cd, 0xff518b9d, 0xff0d586d,
+    0xff18afd6, 0xff231f1f, 0x00000001, 0x000d0016, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f,
+    0xff231f1f, 0xff231f1f, 0xff006b86, 0xff1ca7cd, 0xff176f88, 0xff0badd6, 0xff231f1f, 0x00000001,
+    0x000b001a, 0xff231f1f, 0xff231f1f, 0xff1f616e, 0xff0b7591, 0xff056983, 0xff047997, 0xff086178,
+    0xff06576d, 0xff004557, 0xff007c9b, 0xff00a1ca, 0xff06aad3, 0xff231f1f, 0x00000001, 0x000a001c,
+    0xff231f1f, 0xff126379, 0xff00a1c9, 0xff00b0db, 0xff00b0db, 0xff00a4ce, 0xff00aad4, 0xff008eb2,
+    0xff0098bf, 0xff00afda, 0xff00a4cd, 0xff00add8, 0xff0094b9, 0xff231f1f, 0x00000001, 0x00090020,
+    0xff231f1f, 0xff057896, 0xff00add8, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd,
+    0xff01add8, 0xff06afd9, 0xff00b1dd, 0xff00b1dd, 0xff00aed9, 0xff0084a6, 0xff2e5a56, 0xff231f1f,
+    0x00000001, 0x00080024, 0xff231f1f, 0xff175664, 0xff0097bd, 0xff00afdb, 0xff00b1dd, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff09b1db, 0xff02b0dc, 0xff00b1dd, 0xff00add8, 0xff00a5ce,
+    0xff00aed9, 0xff00a2ca, 0xff2b5d5e, 0xff231f1f, 0x00000001, 0x00080024, 0xff231f1f, 0xff007a99,
+    0xff0088aa, 0xff00a3cb, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b0dc,
+    0xff00b1dd, 0xff00b1dd, 0xff00a5ce, 0xff003747, 0xff005c74, 0xff0083a4, 0xff008bae, 0xff231f1f,
+    0x00000002, 0x00070003, 0xea231f1f, 0x00000026, 0xff285a5b, 0xff0086a8, 0xff0087a9, 0xff009dc4,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd,
+    0xff00afda, 0xff004c61, 0xff000000, 0xff000000, 0xff00222e, 0xff192d22, 0xff231f1f, 0x00000002,
+    0x00060003, 0x2b26330a, 0x00000028, 0xff231f1f, 0xff005e79, 0xff0087a9, 0xff0089ab, 0xff00a6cf,
+    0xff00b1dd, 0xff00b1dd, 0xff06b2dc, 0xff01b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd,
+    0xff00b1dd, 0xff009bc2, 0xff667882, 0xffd9d9d9, 0xff848484, 0xff000000, 0xff231f1f, 0x00000001,
+    0x0007002a, 0xff161d00, 0xff007b9b, 0xff0096bb, 0xff00a0c8, 0xff00a3cc, 0xff00b0dc, 0xff03b2dd,
+    0xff06b1db, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00add7,
+    0xff487c92, 0xffe4e4e4, 0xff231f1f, 0xff584727, 0xffd99f10, 0xff231f1f, 0x00000002, 0x00040007,
+    0x094a6219, 0x30231f1f, 0x31231f1f, 0x0000002c, 0xff040100, 0xff006b86, 0xff006f8d, 0xff006884,
+    0xff00536b, 0xff006884, 0xff00708e, 0xff007a9b, 0xff008bae, 0xff00a5cd, 0xff00b1dd, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff00a9d3, 0xff0093b8, 0xff5a8090, 0xff878581, 0xffd99f10, 0xffd99f10,
+    0xffd99f10, 0xff231f1f, 0x00000002, 0x00040005, 0x45231f1f, 0xea231f1f, 0x00000030, 0xff231f1f,
+    0xff1c5c6d, 0xff4e7f90, 0xff78a1b0, 0xff89b6c6, 0xff8fbecf, 0xff8cbccd, 0xff83b1c2, 0xff618e9e,
+    0xff023441, 0xff008fb3, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b0dc, 0xff009ec6, 0xff00a7d1,
+    0xff0096bc, 0xff786441, 0xffd99f10, 0xffd99f10, 0xffd99f10, 0xffd99f10, 0xff231f1f, 0x00000001,
+    0x00040034, 0xff231f1f, 0xff113034, 0xff006079, 0xff14758f, 0xff157c98, 0xff0081a1, 0xff0093b8,
+    0xff00a9d3, 0xff00afdc, 0xff00a2cb, 0xff007694, 0xff325a63, 0xff5bb3ca, 0xff70bbcd, 0xff76bbcc,
+    0xff6ebace, 0xff58b7d2, 0xff30b4d7, 0xff00a5cc, 0xff009cc3, 0xff3b6371, 0xffa67705, 0xffa27505,
+    0xffaf8212, 0xffaf8212, 0xff231f1f, 0x00000002, 0x00030002, 0xff231f1f, 0x00010030, 0xff55828e,
+    0xff5692a7, 0xff3c9cb8, 0xff1297b9, 0xff0499bf, 0xff09a9d1, 0xff01aad4, 0xff0097bd, 0xff006e8b,
+    0xff645c53, 0xffd3bb9f, 0xffe5cdaf, 0xffe9cdae, 0xffeacdad, 0xffe8cdae, 0xffe4ccaf, 0xffd6cab3,
+    0xffb7c4bc, 0xff6db8cf, 0xff0b94b7, 0xffa27505, 0xffaf8212, 0xff231f1f, 0xff231f1f, 0x00000001,
+    0x00030030, 0xff231f1f, 0xff1f8fb0, 0xff33a2c5, 0xff0389ab, 0xff047795, 0xff0180a0, 0xff0098bf,
+    0xff019ac0, 0xff0080a1, 0xff12556a, 0xff7e6e5e, 0xffdebf9f, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac,
+    0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xffe3c7a8, 0xff8a9996, 0xff231f1f,
+    0xff231f1f, 0x00000003, 0x00020006, 0xff231f1f, 0xff164650, 0xff076983, 0x00000003, 0xaa3d6675,
+    0x00000028, 0xff2c839b, 0xff0f94b5, 0xff0093b8, 0xff0084a5, 0xff035d75, 0xff55534f, 0xffb59b81,
+    0xffeac8a7, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac,
+    0xfff0ceac, 0xffebc8a5, 0xffdab591, 0xff7d6a50, 0xff231f1f, 0x00000001, 0x0003002c, 0xff231f1f,
+    0xff69a1b2, 0xff36a6c6, 0xff0792b5, 0xff0486a6, 0xff03637d, 0xff0f3237, 0xff826b53, 0xffd3b08d,
+    0xffedcaa8, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac,
+    0xffefcdab, 0xffe8c4a0, 0xffdab590, 0xff9c8064, 0xff231f1f, 0x00000001, 0x0002002c, 0xff231f1f,
+    0xff379ab6, 0xff1b97bb, 0xff0081a1, 0xff0a637b, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f,
+    0xffb99978, 0xffdcb791, 0xffe6c29e, 0xffeccaa7, 0xffefccaa, 0xffefcdab, 0xffefcdaa, 0xffedcaa8,
+    0xffe9c5a2, 0xffe0bb97, 0xffd3ae89, 0xff967c61, 0xff231f1f, 0x00000002, 0x0002000a, 0xff231f1f,
+    0xff0087aa, 0xff016984, 0xff231f1f, 0xff231f1f, 0x00040018, 0xff231f1f, 0xff9e8266, 0xffd3af8a,
+    0xffdbb690, 0xffdeb993, 0xffdfba95, 0xffdfb994, 0xffdcb791, 0xffd7b28c, 0xffb59575, 0xff695d40,
+    0xff231f1f, 0x00000002, 0x00020006, 0xff231f1f, 0xff0b586d, 0xff231f1f, 0x00070014, 0xff231f1f,
+    0xff231f1f, 0xff997e62, 0xffae9071, 0xffb79777, 0xffaf9172, 0xff9d8265, 0xff645a3c, 0xff231f1f,
+    0xff231f1f, 0x00000002, 0x00030002, 0xff231f1f, 0x000a000c, 0xff231f1f, 0xff231f1f, 0xff231f1f,
+    0xff231f1f, 0xff231f1f, 0xff231f1f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    // bird_right3
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00150004, 0xff231f1f, 0xff231f1f,
+    0x00000003, 0x1b8db736, 0x00000001, 0x0011000e, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f,
+    0xff006781, 0xff231f1f, 0xff231f1f, 0x00000001, 0x00100010, 0xff231f1f, 0xff2b4f45, 0xff3c98b4,
+    0xff639db0, 0xff231f1f, 0xff02647d, 0xff20b0d7, 0xff231f1f, 0x00000001, 0x0011000e, 0xff231f1f,
+    0xff125c6f, 0xff11a1c7, 0xff4697af, 0xff0b5a70, 0xff14b0d9, 0xff231f1f, 0x00000001, 0x000c0018,
+    0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff00556b,
+    0xff07a2c8, 0xff0b82a2, 0xff0daed7, 0xff231f1f, 0x00000001, 0x000a001c, 0xff231f1f, 0xff231f1f,
+    0xff0e7692, 0xff0092b6, 0xff0092b7, 0xff008aad, 0xff0090b4, 0xff007796, 0xff007b9b, 0xff007897,
+    0xff007f9f, 0xff00aad4, 0xff02a8d2, 0xff231f1f, 0x00000001, 0x0009001e, 0xff231f1f, 0xff16697e,
+    0xff00a3cc, 0xff00b1dd, 0xff00b1dd, 0xff00b0dc, 0xff00afda, 0xff00abd5, 0xff0098be, 0xff00a7d1,
+    0xff00b1dd, 0xff00aeda, 0xff00acd7, 0xff007c9b, 0xff231f1f, 0x00000001, 0x00080022, 0xff231f1f,
+    0xff0d6f88, 0xff00acd7, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd,
+    0xff00b0dc, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b0dc, 0xff00a4cd, 0xff097894, 0xff231f1f,
+    0x00000001, 0x00070026, 0xff231f1f, 0xff265455, 0xff0084a6, 0xff009dc4, 0xff00b1dc, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00a5cf,
+    0xff007fa0, 0xff009cc3, 0xff00aad4, 0xff0583a3, 0xff231f1f, 0x00000001, 0x00070028, 0xff231f1f,
+    0xff006d8a, 0xff0087a9, 0xff008db1, 0xff00aed9, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00a9d4, 0xff003442, 0xff00131a, 0xff004558,
+    0xff006e8a, 0xff214848, 0xff231f1f, 0x00000001, 0x00070028, 0xff231f1f, 0xff0080a0, 0xff0087a9,
+    0xff008db1, 0xff00aed9, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff00afda, 0xff006c88, 0xff313c41, 0xff666666, 0xff4c4c4c, 0xff000003,
+    0xff231f1f, 0x00000002, 0x00050005, 0x3427360b, 0xc9231f1f, 0x00000028, 0xff1b4f58, 0xff048bad,
+    0xff008bae, 0xff009ec6, 0xff00b0db, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00add8, 0xff678898, 0xfff5f5f5, 0xffc6c6c6,
+    0xff111111, 0xff231f1f, 0x00000002, 0x00040007, 0x48231f1f, 0x29231f1f, 0xd6231f1f, 0x0000002a,
+    0xff005166, 0xff0496ba, 0xff0088aa, 0xff007897, 0xff007594, 0xff0083a4, 0xff008eb2, 0xff009cc4,
+    0xff00a5cf, 0xff00b0dc, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00aed9, 0xff1181a1,
+    0xffa5acb0, 0xff231f1f, 0xff8c6f38, 0xffd3b065, 0xff231f1f, 0x00000004, 0x00030005, 0x8b231f1f,
+    0x44000000, 0x00000002, 0xff231f1f, 0x00000003, 0xea111801, 0x0000002c, 0xff242e34, 0xff727f83,
+    0xff709199, 0xff7fa0ad, 0xff89a8b5, 0xff80a1ae, 0xff6b919d, 0xff6d8890, 0xff425f6b, 0xff00a2cb,
+    0xff00b1dd, 0xff00b1dd, 0xff00b1dd, 0xff00b0db, 0xff009dc4, 0xff00a4cd, 0xff008caf, 0xff505755,
+    0xffd99f0e, 0xfff7b718, 0xfff4bf4e, 0xff231f1f, 0x00000002, 0x00040002, 0xff231f1f, 0x00010030,
+    0xff577076, 0xff80b9cb, 0xff67bcda, 0xff43b5d9, 0xff13b0d9, 0xff00b2dd, 0xff04b4df, 0xff2ab8e0,
+    0xff53bde1, 0xff367085, 0xff049ec3, 0xff13b3da, 0xff17b3da, 0xff0db2db, 0xff00b1dc, 0xff00acd7,
+    0xff00a3cb, 0xff0098be, 0xff45585c, 0xff976d05, 0xff9d7106, 0xffa57808, 0xffb48e36, 0xff231f1f,
+    0x00000001, 0x00040032, 0xff231f1f, 0xff1e434f, 0xff419eb9, 0xff0c92b4, 0xff008bad, 0xff008aac,
+    0xff009ec6, 0xff07afd9, 0xff03b1dd, 0xff00b1dd, 0xff00afda, 0xff345c6b, 0xffb4b8aa, 0xffc9c8b7,
+    0xffcbc8b6, 0xffc5c7b8, 0xffb8c5bc, 0xff9bc0c4, 0xff6bb6cb, 0xff19acd3, 0xff1393b7, 0xff9a721d,
+    0xffba8607, 0xff231f1f, 0xff231f1f, 0x00000001, 0x0004002e, 0xff231f1f, 0xff025970, 0xff086f8b,
+    0xff266074, 0xff448194, 0xff16a1c5, 0xff00b0dc, 0xff00afdb, 0xff06b0da, 0xff00b1dd, 0xff009ec5,
+    0xff6c6257, 0xffedcbaa, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xffeeceac, 0xffeacdae,
+    0xffcdc7b6, 0xff68a2b3, 0xff2e5052, 0xff231f1f, 0x00000001, 0x0004002c, 0xff231f1f, 0xff34454c,
+    0xff6b9aa8, 0xff64bbd6, 0xff24b2da, 0xff01a7d1, 0xff009bc2, 0xff00a4cd, 0xff00b0dc, 0xff00a6cf,
+    0xff0e6078, 0xffb79c82, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac,
+    0xffefcdaa, 0xffe4c09c, 0xffb19679, 0xff231f1f, 0x00000001, 0x0004002a, 0xff231f1f, 0xff49a6c1,
+    0xff21b3db, 0xff02a1c8, 0xff0090b4, 0xff017f9f, 0xff0186a7, 0xff00aed9, 0xff00a3cc, 0xff007998,
+    0xff726557, 0xffe9c8a7, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xfff0ceac, 0xffeecba8,
+    0xffe2bd98, 0xffc6a381, 0xff231f1f, 0x00000001, 0x0003002a, 0xff231f1f, 0xff147188, 0xff02a8d2,
+    0xff0090b5, 0xff017a99, 0xff1b657b, 0xff1d839f, 0xff01aad4, 0xff009ac1, 0xff007f9f, 0xff3a4a51,
+    0xffd3b496, 0xffedccac, 0xfff0ceac, 0xfff0ceac, 0xffefcdab, 0xffedcba9, 0xffe7c4a0, 0xffdcb791,
+    0xffc09e7c, 0xff231f1f, 0x00000001, 0x00030028, 0xff231f1f, 0xff027390, 0xff008bae, 0xff186880,
+    0xff5d7a83, 0xff43a7c4, 0xff09a4cd, 0xff008fb4, 0xff0081a2, 0xff254c5b, 0xffa88b6e, 0xffe1bc98,
+    0xffe4c09d, 0xffe5c19f, 0xffe5c19d, 0xffe1bc98, 0xffddb792, 0xffceaa86, 0xff9a7f63, 0xff231f1f,
+    0x00000003, 0x00030012, 0xff231f1f, 0xff0f5669, 0xff176780, 0xff8ca0a7, 0xff62bcdb, 0xff009abf,
+    0xff0089ab, 0xff0081a2, 0xff154e5b, 0x00000003, 0xee444624, 0x00000012, 0xffa4866a, 0xffc8a582,
+    0xffceaa86, 0xffcfab87, 0xffcca885, 0xffc2a07e, 0xff93785e, 0xff231f1f, 0xff231f1f, 0x00000001,
+    0x00040020, 0xff231f1f, 0xff678188, 0xff61bbd7, 0xff0091b6, 0xff0087a9, 0xff0080a0, 0xff1a4f5a,
+    0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f, 0xff231f1f,
+    0xff231f1f, 0x00000001, 0x0004000e, 0xff231f1f, 0xff64aec4, 0xff048fb3, 0xff0087a9, 0xff007e9e,
+    0xff1d4d53, 0xff231f1f, 0x00000001, 0x0004000c, 0xff231f1f, 0xff198faf, 0xff0087a9, 0xff0080a0,
+    0xff1e4e54, 0xff231f1f, 0x00000001, 0x0004000a, 0xff231f1f, 0xff0082a2, 0xff0083a4, 0xff18505d,
+    0xff231f1f, 0x00000001, 0x00040008, 0xff231f1f, 0xff006f8c, 0xff035e76, 0xff231f1f, 0x00000001,
+    0x00050004, 0xff231f1f, 0xff231f1f,
+    // bananarangpack
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00080003, 0x18a92f2f, 0x00000005, 0x0008000b,
+    0x0ee3e4e4, 0x07e3e4e4, 0x04ff1111, 0x07cc9a9a, 0x08db394e, 0x00010003, 0x26cc9a9a, 0x00010005,
+    0x17e3e4e4, 0x08db394e, 0x00020003, 0x06a92f2f, 0x00030003, 0x02cc9a9a, 0x00000006, 0x00060005,
+    0x9adb394e, 0xd3db394e, 0x00000002, 0xffffffff, 0x0000000b, 0x9acc9a9a, 0x03d6c0c1, 0xdadb394e,
+    0x03d6c0c1, 0x0dd6c0c1, 0x00010005, 0x1bd6c0c1, 0x163a0342, 0x00010009, 0x0dcc9a9a, 0x0ed6c0c1,
+    0x05db394e, 0x06cc9a9a, 0x00020003, 0x09ff1111, 0x00000002, 0x00050006, 0xffcc9a9a, 0xffd6c0c1,
+    0xffd6c0c1, 0x00000023, 0xe8d6c0c1, 0x9cd6c0c1, 0xd3cc9a9a, 0x05d6c0c1, 0x01d6c0c1, 0x04d6c0c1,
+    0x09cc9a9a, 0x22d6c0c1, 0x0cd6c0c1, 0x18d6c0c1, 0x22d6c0c1, 0x0cd6c0c1, 0x06d6c0c1, 0x04d6c0c1,
+    0x05db394e, 0x02d6c0c1, 0x043a0342, 0x00000006, 0x0003000e, 0xffcc9a9a, 0xffdb394e, 0xffd6c0c1,
+    0xffd6c0c1, 0xff0d0a08, 0xff0d0a08, 0xffd6c0c1, 0x00000009, 0xd3d6c0c1, 0x81946363, 0x93db394e,
+    0x0b7b7373, 0x00010005, 0x1ad6c0c1, 0x26d6c0c1, 0x00010005, 0x10946363, 0x02946363, 0x00010005,
+    0x017b7373, 0x017b7373, 0x00010003, 0x03d6c0c1, 0x00000007, 0x00040004, 0xffcc9a9a, 0xffd6c0c1,
+    0x00000003, 0xea0d0a08, 0x00000006, 0xff50360b, 0xff543b11, 0xff0d0a08, 0x00000003, 0xd3d6c0c1,
+    0x00000002, 0xffffffff, 0x00000011, 0xa43a0342, 0x05e90b0b, 0x07951a1a, 0x17c8bebe, 0x05c8bebe,
+    0x03951a1a, 0x05e90000, 0x01ff0000, 0x00050005, 0x01d6c0c1, 0x0f102704, 0x00000006, 0x00020002,
+    0xffa92f2f, 0x0001000a, 0xffffffff, 0xffd6c0c1, 0xff0d0a08, 0xff543b11, 0xff5d451c, 0x00000005,
+    0xf40d0a08, 0xe2d6c0c1, 0x00000002, 0xffd6c0c1, 0x00000011, 0xe4d6c0c1, 0xb4e90b0b, 0x02e90b0b,
+    0x029d5656, 0x059d5656, 0x03e90c0c, 0x01fa0000, 0x02ff0000, 0x0001000b, 0x01f00000, 0x03a70000,
+    0xf4cc9a9a, 0x8be90b0b, 0xea3a0342, 0x0000000a, 0x00040009, 0x6ecc9a9a, 0xd6d6c0c1, 0x768f7b6f,
+    0xd70d0a08, 0x00000002, 0xff0d0a08, 0x00000007, 0xd32e2311, 0x598f7b6f, 0xecd6c0c1, 0x00000004,
+    0xffd6c0c1, 0xffcc9a9a, 0x00000003, 0xb80e1d08, 0x0001000d, 0x03d20000, 0x03fd0000, 0x01ff0000,
+    0x01ff0000, 0x01ff0000, 0x14d6c0c1, 0x00000002, 0xffffffff, 0x00000005, 0x78e90b0b, 0xd3d6c0c1,
+    0x00000002, 0xffcc9a9a, 0x00000005, 0x383a0342, 0x05ff1111, 0x00000007, 0x00040002, 0xffdb394e,
+    0x00000007, 0xd6d6c0c1, 0x778f7b6f, 0xd72e2311, 0x00000004, 0xffdcad32, 0xffefc148, 0x00000009,
+    0xd72e2311, 0x6d2e2311, 0xdbd6c0c1, 0x9ed6c0c1, 0x00000002, 0xffd6c0c1, 0x0000000f, 0xa9e90b0b,
+    0x3fcc9a9a, 0x84cc9a9a, 0x04ff0000, 0x9e3a0342, 0x11ff0000, 0x83e90b0b, 0x0000000c, 0xffd6c0c1,
+    0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffcc9a9a, 0x0000000b, 0x00030003, 0x4fa92f2f,
+    0x00000002, 0xffcc9a9a, 0x00000003, 0xd6d6c0c1, 0x0000000a, 0xffd6c0c1, 0xff2e2311, 0xffe1af27,
+    0xffecbb3c, 0xfff2bb4d, 0x00000005, 0xdb2e2311, 0x882e2311, 0x00000006, 0xffd6c0c1, 0xffd6c0c1,
+    0xffd6c0c1, 0x00000003, 0xc9d6c0c1, 0x0000000c, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1,
+    0xffd6c0c1, 0xffd6c0c1, 0x00000009, 0xd82e2311, 0xd92e2311, 0x512e2311, 0xead6c0c1, 0x00000002,
+    0xff3a0342, 0x00000003, 0xa8e90b0b, 0x0000000a, 0x00020003, 0x91cc9a9a, 0x00000002, 0xffffffff,
+    0x00000005, 0x3a0e1d08, 0xd6d6c0c1, 0x0000000e, 0xffd6c0c1, 0xff2e2311, 0xffdfad23, 0xffe4b331,
+    0xfff1c248, 0xfff8cc57, 0xff2e2311, 0x00000005, 0x9e2e2311, 0x91d6c0c1, 0x00000008, 0xffd6c0c1,
+    0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0x00000009, 0xe4d6c0c1, 0x1a2e2311, 0xdb2e2311, 0xec2e2311,
+    0x00000008, 0xff7e653d, 0xff7e653d, 0xff2e2311, 0xffd6c0c1, 0x00000003, 0xeacc9a9a, 0x00000002,
+    0xffffffff, 0x00000007, 0x00030003, 0xf9db394e, 0x00010014, 0xffcc9a9a, 0xffd6c0c1, 0xff2e2311,
+    0xffdfad23, 0xffdeac22, 0xffe8b93d, 0xfff6cb57, 0xfffad05e, 0xff2e2311, 0xff2e2311, 0x00000005,
+    0x352e2311, 0xaed6c0c1, 0x00000002, 0xffd6c0c1, 0x00000007, 0x85d6c0c1, 0x372e2311, 0xea2e2311,
+    0x0000000c, 0xff2e2311, 0xfff6c951, 0xffe0b036, 0xffc69921, 0xff2e2311, 0xffd6c0c1, 0x00000003,
+    0xeccc9a9a, 0x00000008, 0x00040005, 0x3dff1111, 0xeacc9a9a, 0x00000002, 0xffd6c0c1, 0x00000005,
+    0xba8f7b6f, 0xec2e2311, 0x0000000c, 0xffdfac23, 0xffdeac22, 0xffe9b838, 0xfff5c851, 0xfff9ce5a,
+    0xfff9cf5d, 0x00000005, 0xdb2e2311, 0xf92e2311, 0x00000002, 0xff2e2311, 0x00000005, 0xe02e2311,
+    0xe02e2311, 0x00000010, 0xfffdd25e, 0xfff3c64e, 0xffeebe41, 0xffe0b030, 0xffb78d1e, 0xff2e2311,
+    0xffd6c0c1, 0xffffffff, 0x00000002, 0x00050009, 0xa7db394e, 0xf0d6c0c1, 0xecd6c0c1, 0xfc2e2311,
+    0x00000028, 0xffd7a622, 0xffdaa922, 0xffdeac22, 0xffe7b631, 0xfff2c141, 0xfff9cc54, 0xfffdd35f,
+    0xfffed566, 0xfffed666, 0xfffdd462, 0xfffdd25e, 0xfff6c850, 0xffe6b532, 0xffdeac22, 0xffcd9e20,
+    0xff2e2311, 0xffd6c0c1, 0xffd6c0c1, 0xff3a0342, 0xffe90b0b, 0x00000004, 0x00040007, 0x23cc9a9a,
+    0x4ddb394e, 0xb6d6c0c1, 0x00000002, 0xffd6c0c1, 0x00000005, 0xba8f7b6f, 0xec2e2311, 0x00000022,
+    0xffcc9d20, 0xffdaa922, 0xffdeac22, 0xffe6b42c, 0xffeab936, 0xfff0c24b, 0xfff0c34d, 0xfff0c34d,
+    0xfff0c44d, 0xffefc149, 0xffe7b632, 0xffe0ad20, 0xffd3a321, 0xffb78e30, 0xff2e2311, 0xffd6c0c1,
+    0xffcc9a9a, 0x00000004, 0x00050003, 0x4b3a0342, 0x00000004, 0xffd6c0c1, 0xffd6c0c1, 0x00000007,
+    0xecd6c0c1, 0x928f7b6f, 0xd72e2311, 0x00000022, 0xffcd9e20, 0xffd1a121, 0xffd9a820, 0xffe1ad20,
+    0xffe3af20, 0xffe2af22, 0xffdfad20, 0xffdfad22, 0xffdeac21, 0xffdfad23, 0xffd4a421, 0xffb78e30,
+    0xff2e2311, 0xffd6c0c1, 0xffd6c0c1, 0xffcc9a9a, 0xff0e1d08, 0x00000006, 0x00060004, 0xffffffff,
+    0xffd6c0c1, 0x00000003, 0xc9d6c0c1, 0x00000002, 0xffd6c0c1, 0x00000007, 0x6f8f7b6f, 0xec2e2311,
+    0xfcb68c28, 0x0000001a, 0xffca9b1f, 0xffd1a01f, 0xffd3a220, 0xffd2a222, 0xffcfa021, 0xffd0a022,
+    0xffcfa021, 0xffc3962d, 0xff2e2311, 0xff2e2311, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0x00000003,
+    0x0acc9a9a, 0x00000006, 0x00060007, 0x21a92f2f, 0xa8db394e, 0x6fdb394e, 0x00000004, 0xffd6c0c1,
+    0xffd6c0c1, 0x00000007, 0xba7d7071, 0xe22e2311, 0xf4b48a1e, 0x00000012, 0xffc3951f, 0xffc2951f,
+    0xffc2951f, 0xffc2951f, 0xffc3961f, 0xffb78e30, 0xff2e2311, 0xff8f7b6f, 0xffd6c0c1, 0x00000007,
+    0xfcd6c0c1, 0xecd6c0c1, 0x37ff1111, 0x00000002, 0xff3a0342, 0x00000005, 0x00060003, 0x79a92f2f,
+    0x00010008, 0xffffffff, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0x00000007, 0xd3d6c0c1, 0x5b78634d,
+    0xd72e2311, 0x00000010, 0xff2e2311, 0xff2e2311, 0xff2e2311, 0xff6b5320, 0xff5f4a1f, 0xff8f7b6f,
+    0xffd6c0c1, 0xffd6c0c1, 0x00000005, 0xecd6c0c1, 0xba3a0342, 0x00000004, 0x00080005, 0xa8db394e,
+    0x1ad6c0c1, 0x00000018, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1,
+    0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0x00000007, 0xc9d6c0c1,
+    0x0e3a0342, 0xd30e1d08, 0x00000002, 0xffcc9a9a, 0x00000005, 0x00070002, 0xffcc9a9a, 0x00020002,
+    0xffdb394e, 0x00000003, 0x9ed6c0c1, 0x00000010, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1,
+    0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0x00000007, 0xeccc9a9a, 0x883a0342, 0xba0e1d08,
+    0x00000003, 0x000b0002, 0xffdb394e, 0x00000005, 0x2ed6c0c1, 0x5ed6c0c1, 0x0000000e, 0xffd6c0c1,
+    0xffd6c0c1, 0xffd1bcbf, 0xffffffff, 0xffa92f2f, 0xffcc9a9a, 0xff3a0342, 0x00000003, 0x000c0005,
+    0x48cc9a9a, 0x6da92f2f, 0x00000008, 0xff3a0342, 0xff590b16, 0xff4f0811, 0xffa92f2f, 0x00000003,
+    0xba3a0342, 0x00000001, 0x000f0004, 0xff5b0f0f, 0xff590b16, 0x00000001, 0x00070024, 0xff5e5c57,
+    0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff671721,
+    0xff4f0811, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff514f4c, 0xff514f4c,
+    0xff514f4c, 0x00000001, 0x0005002c, 0xff3f3d3a, 0xff5e5c57, 0xff5e5c57, 0xff4c4b47, 0xff3f3d3a,
+    0xff4c4b47, 0xff4c4b47, 0xff070605, 0xff590b16, 0xff671721, 0xff671721, 0xff590b16, 0xff590b16,
+    0xff671721, 0xff070605, 0xff4c4b47, 0xff4c4b47, 0xff3f3d3a, 0xff4c4b47, 0xff514f4c, 0xff3f3d3a,
+    0xff3f3d3a, 0x00000001, 0x00040030, 0xff3f3d3a, 0xff4c4b47, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a,
+    0xff3f3d3a, 0xff4c4b47, 0xff4c4b47, 0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff070605,
+    0xff070605, 0xff070605, 0xff070605, 0xff42413d, 0xff42413d, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a,
+    0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0x00000001, 0x00040030, 0xff514f4c, 0xff514f4c, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0xff3f3d3a, 0xff454440, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff454440, 0xff4c4b47, 0xff454440, 0xff454440, 0xff454440, 0xff42413d, 0xff42413d, 0xff3f3d3a,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff3f3d3a, 0xff3f3d3a, 0x00000001, 0x00030034, 0xff3f3d3a,
+    0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a,
+    0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a,
+    0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a, 0xff3f3d3a,
+    0xff3f3d3a,
+    // coinpack
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00080003, 0xcc4e473e, 0x00000002,
+    0xff605b55, 0x00000003, 0x66523528, 0x00010002, 0xff5a362d, 0x00030002, 0xff992f24, 0x00020002,
+    0xff903025, 0x00040002, 0xff5f4b43, 0x00000006, 0x00080002, 0xff5d352a, 0x00020006, 0xffca261e,
+    0xff948482, 0xffa92f2f, 0x00010002, 0xffaf9c9c, 0x00020006, 0xff94706d, 0xffaf2b22, 0xff66362f,
+    0x00000003, 0x66524238, 0x00020003, 0x66523528, 0x00000003, 0x000a0003, 0xaa3d2239, 0x00010012,
+    0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2,
+    0xffe0201a, 0x00020002, 0xff756764, 0x00000003, 0x00060003, 0x444e433a, 0x0000001c, 0xff685c57,
+    0xffe0201a, 0xff877876, 0xffbaa6a6, 0xffcfb9ba, 0xffd6c0c1, 0xffd6c0c1, 0xffb4a2a2, 0xffb4a2a2,
+    0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffc0acac, 0x00010006, 0xff9c373c, 0xffbba8a8,
+    0xff6c5f5a, 0x00000001, 0x00050028, 0xff6f3327, 0xff5f4b43, 0xff763733, 0xffb9a6a6, 0xff706867,
+    0xffb4a2a2, 0xffb4a2a2, 0xff8f6e6e, 0xff9f9791, 0xff81560b, 0xff805916, 0xff805914, 0xff867461,
+    0xffb4a2a2, 0xffb4a2a2, 0xffd6c0c1, 0xffd6c0c1, 0xff7b7373, 0xffad9b9a, 0xff7f716e, 0x00000002,
+    0x00020003, 0xaa54352a, 0x0002002a, 0xff74716d, 0xff3c1b3c, 0xfff71614, 0xffd2bdbd, 0xffa79696,
+    0xffb4a2a2, 0xff888282, 0xff7c5518, 0xffb39052, 0xfff7c268, 0xfffabf41, 0xfffabf44, 0xffcb9632,
+    0xff6d350e, 0xff915955, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xff4a382e, 0xff9b2e24, 0xff70342b,
+    0x00000001, 0x0004002c, 0xff5d4942, 0xff3f322d, 0xff61554f, 0xffceb9b9, 0xffb4a2a2, 0xffb4a2a2,
+    0xff888282, 0xff888282, 0xfff3c47a, 0xfff4d8a7, 0xfffaf2b0, 0xfffee75e, 0xfffee860, 0xffeec94b,
+    0xffe1932a, 0xffa16d26, 0xff888282, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xff645852, 0xff665954,
+    0x00000001, 0x0005002c, 0xffd7221b, 0xff746662, 0xff888282, 0xffb4a2a2, 0xff888282, 0xff9d7c46,
+    0xfff6d699, 0xfff9f8d6, 0xfff4eaa8, 0xfff4d251, 0xfff4d154, 0xfff4d052, 0xfff7da59, 0xfffee65f,
+    0xffedc148, 0xff93642b, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xff91817f, 0xff79332c, 0xff5f3428,
+    0x00000001, 0x0005002a, 0xff725853, 0xffd6c0c1, 0xffb4a2a2, 0xffb4a2a2, 0xff795418, 0xfff4c27d,
+    0xfffaf8d6, 0xfff9db67, 0xffe7b23d, 0xff844300, 0xffe6891f, 0xffe48b1c, 0xffeba637, 0xfff5d656,
+    0xfffde662, 0xffe5ab3c, 0xff6c3f18, 0xff888282, 0xffb4a2a2, 0xffb4a2a2, 0xff3b1040, 0x00000004,
+    0x00020002, 0xff5d4942, 0x00010002, 0xff972f24, 0x0001002a, 0xffc6b2b2, 0xffb4a2a2, 0xffae928c,
+    0xffb38f52, 0xfff6d8a8, 0xfff6eaa9, 0xffe6b23d, 0xff844300, 0xfffaba40, 0xfffaba40, 0xfffaba40,
+    0xfffaba40, 0xffeabd47, 0xfff9e05b, 0xffefc54a, 0xffa9782c, 0xff888282, 0xffb4a2a2, 0xffb4a2a2,
+    0xffb09e9d, 0xff725853, 0x00000003, 0xcc4e473e, 0x00000001, 0x0006002a, 0xffaf9d9d, 0xff888282,
+    0xff844300, 0xfff8c16a, 0xfff9f1b2, 0xfff4d051, 0xffe38d1e, 0xfffaba40, 0xfffaba40, 0xfffbbc3c,
+    0xfffbd851, 0xfffbe85e, 0xfff9cf52, 0xfffccc4c, 0xfffbe95d, 0xffe5a535, 0xff844000, 0xffb4a2a2,
+    0xffb4a2a2, 0xffc6b2b2, 0xffa82c22, 0x00000002, 0x0004002c, 0xff972f24, 0xffb98c8b, 0xffb4a2a2,
+    0xffb4a2a2, 0xff815b0f, 0xfffbbf3e, 0xfffbe462, 0xfff3cf55, 0xffe78c23, 0xfffaba40, 0xfffaba40,
+    0xfffad854, 0xfffbe65e, 0xfff9e98c, 0xfff8d289, 0xfff9d050, 0xfffde562, 0xffe4a537, 0xff844300,
+    0xffb4a2a2, 0xffb4a2a2, 0xffad9b9a, 0x00000003, 0xcc3d2139, 0x00000002, 0x00050028, 0xff9c302e,
+    0xff90817f, 0xffad9c9c, 0xff844300, 0xfff9c044, 0xfff9e560, 0xfff3cf58, 0xffe38e25, 0xfff9bb45,
+    0xfff8d55a, 0xfffbe563, 0xfff6ea88, 0xfff7f3d6, 0xfff6dbb9, 0xfff8ce52, 0xfffce35f, 0xffe2a437,
+    0xff824300, 0xffb4a2a2, 0xffb4a2a2, 0x00000005, 0x223d2636, 0x6652352a, 0x00000002, 0x00040002,
+    0xff785c58, 0x0001002a, 0xffa62d22, 0xffa99897, 0xffa28d80, 0xffcd9b3a, 0xfffad953, 0xfff7d95b,
+    0xffe7a839, 0xfff3bd43, 0xfffbea5c, 0xfffced86, 0xfffaf6d0, 0xfff6f1e5, 0xfff7d791, 0xfffbdb58,
+    0xfff4ce51, 0xffc0852c, 0xff8c6f62, 0xffb4a2a2, 0xffb19f9f, 0xffa9a8a6, 0xff9f2e23, 0x00000001,
+    0x0006002a, 0xff66342b, 0xffb4a2a2, 0xffb7a7a7, 0xff79551d, 0xfff8bf3a, 0xfffee861, 0xfff2d857,
+    0xffeabd46, 0xfffbd24d, 0xfffcd786, 0xfffadcb9, 0xfff9d590, 0xfff9da57, 0xffffe860, 0xffe8ab3c,
+    0xff844300, 0xffb4a2a2, 0xffb4a2a2, 0xff3c213a, 0xff60544e, 0xff69524c, 0x00000001, 0x00060026,
+    0xff972f24, 0xffb4a2a2, 0xffb4a2a2, 0xffb6a8a5, 0xff844300, 0xfffcd251, 0xfffde95f, 0xfff7e155,
+    0xfffccf4e, 0xfffcd04e, 0xfffdd04c, 0xfffcdb57, 0xfffee75e, 0xfff1cc4c, 0xff844300, 0xffb4a2a2,
+    0xffb4a2a2, 0xffb4a2a2, 0xffd7221b, 0x00000001, 0x00070026, 0xff94312d, 0xffac9b9a, 0xffb4a2a2,
+    0xff888282, 0xff844300, 0xfffac751, 0xfff9d655, 0xffffe85e, 0xfffce862, 0xfffce95f, 0xfff2d150,
+    0xffe8aa3b, 0xffb28434, 0xff888282, 0xffb4a2a2, 0xffb4a2a2, 0xffe3e4e4, 0xff93312d, 0xff673427,
+    0x00000001, 0x00070022, 0xff665a55, 0xffd1394b, 0xffb4a2a2, 0xffb4a2a2, 0xffbdb5ab, 0xff844300,
+    0xffc0963b, 0xfff7c843, 0xfff9c646, 0xfffac548, 0xffd19e36, 0xff804409, 0xffada6a1, 0xffd6c4c5,
+    0xffa08f8e, 0xffc6b2b2, 0xffd7394d, 0x00000001, 0x0009001c, 0xff868080, 0xff868080, 0xffb4a2a2,
+    0xffb4a2a2, 0xffad9f95, 0xff844300, 0xff844300, 0xff844300, 0xff844300, 0xffb4a2a3, 0xffb4a2a2,
+    0xffb4a2a2, 0xffcc9a9a, 0xff1e2a0f, 0x00000003, 0x00070002, 0xffa37b7a, 0x00020016, 0xffe11f19,
+    0xffa99796, 0xffd6c0c1, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2,
+    0xff726e6a, 0xffc09190, 0x00010002, 0xffc3c3c2, 0x00000001, 0x000b0012, 0xffd1394b, 0xff70635f,
+    0xff90807f, 0xffb4a2a2, 0xffb4a2a2, 0xffb4a2a2, 0xffffffff, 0xffa92f2f, 0xffcc9a9a, 0x00000001,
+    0x000c0010, 0xff7e605c, 0xff7b332c, 0xff3a0342, 0xff590b16, 0xff4f0811, 0xffa92f2f, 0xff3c1b3c,
+    0xffa92f2f, 0x00000001, 0x000f0004, 0xff5b0f0f, 0xff590b16, 0x00000001, 0x00070024, 0xff5e5c57,
+    0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff671721,
+    0xff4f0811, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff514f4c, 0xff514f4c,
+    0xff514f4c, 0x00000005, 0x00050003, 0x443f3d3a, 0x00000006, 0xff5e5c57, 0xff5e5c57, 0xff4c4b47,
+    0x00000003, 0x443f3d3a, 0x0000001e, 0xff4c4b47, 0xff4c4b47, 0xff070605, 0xff590b16, 0xff671721,
+    0xff671721, 0xff590b16, 0xff590b16, 0xff671721, 0xff070605, 0xff4c4b47, 0xff4c4b47, 0xff53524e,
+    0xff4c4b47, 0xff514f4c, 0x00000005, 0x443f3d3a, 0x443f3d3a, 0x00000009, 0x00040003, 0x443f3d3a,
+    0x00000002, 0xff4c4b47, 0x00000003, 0x443f3d3a, 0x0000001a, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff070605,
+    0xff070605, 0xff070605, 0x00000003, 0xaa42413d, 0x00000006, 0xff4c4b47, 0xff53524e, 0xff53524e,
+    0x00000003, 0x443f3d3a, 0x00000002, 0xff4c4b47, 0x00000005, 0x443f3d3a, 0x443f3d3a, 0x00000006,
+    0x0004000a, 0xff4c4b47, 0xff53524e, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0x00000003, 0x443f3d3a,
+    0x00000014, 0xff454440, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff53524e, 0xff4c4b47, 0xff53524e,
+    0xff4c4b47, 0xff454440, 0xff53524e, 0x00000003, 0xaa42413d, 0x0000000c, 0xff4c4b47, 0xff4c4b47,
+    0xff53524e, 0xff53524e, 0xff53524e, 0xff53524e, 0x00000003, 0x443f3d3a, 0x00000003, 0x00030003,
+    0x443f3d3a, 0x0000002e, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff53524e, 0xff4c4b47, 0xff53524e,
+    0xff4c4b47, 0xff53524e, 0xff4c4b47, 0xff53524e, 0xff53524e, 0xff53524e, 0xff53524e, 0xff53524e,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff53524e, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff53524e, 0x00000005, 0x443f3d3a, 0x443f3d3a,
+    // emptypack
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00070024, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57,
+    0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff514f4c, 0xff514f4c, 0xff514f4c, 0x00000001,
+    0x00060026, 0xff5e5c57, 0xff5e5c57, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff070605,
+    0xff590b16, 0xff671721, 0xff671721, 0xff590b16, 0xff590b16, 0xff671721, 0xff070605, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff514f4c, 0x00000001, 0x0005002a, 0xff4c4b47, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff070605, 0xff070605, 0xff070605,
+    0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff52514f, 0xff4c4b47, 0xff4c4b47, 0x00000001, 0x0004002e, 0xff514f4c, 0xff514f4c, 0xff52514f,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff454440, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff454440, 0xff4c4b47, 0xff454440, 0xff454440, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f,
+    0xff52514f, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0x00000001, 0x00030032, 0xff4c4b47, 0xff4c4b47,
+    0xff4c4b47, 0xff52514f, 0xff52514f, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f, 0xff52514f,
+    0xff52514f, 0xff52514f, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f, 0xff52514f, 0xff52514f,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f, 0xff52514f, 0xff4c4b47,
+    // heartpack
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00080002, 0xff86322c, 0x00000005, 0x0008000a,
+    0xffdbdcdc, 0xffdcdddd, 0xffb92920, 0xffcc9a9a, 0xffdb394e, 0x00010002, 0xffcc9a9a, 0x00010004,
+    0xffe3e4e4, 0xffcb3849, 0x00020002, 0xff99312e, 0x00030002, 0xffcc9a9a, 0x00000002, 0x0008001c,
+    0xffa92f2f, 0xffcb9999, 0xffcfbabb, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xff403629, 0xffd6c0c1,
+    0xff3a0342, 0xff403629, 0xffcc9a9a, 0xffcfbabb, 0xffbd3845, 0xffc89797, 0x00020002, 0xffff1111,
+    0x00000001, 0x00070024, 0xffb5a2a2, 0xffcc9a9a, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1,
+    0xffd6c0c1, 0xffcc9a9a, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xffc6b2b2,
+    0xffc6b2b2, 0xffdb394e, 0xffd6c0c1, 0xff3a0342, 0x00000001, 0x00050028, 0xff102704, 0xff998987,
+    0xffdb394e, 0xffd6c0c1, 0xff7b7373, 0xff946363, 0xff946363, 0xff946363, 0xff7b7373, 0xff403629,
+    0xffd6c0c1, 0xffd6c0c1, 0xff403629, 0xff946363, 0xff946363, 0xff946363, 0xff7b7373, 0xff7b7373,
+    0xffd6c0c1, 0xffd6c0c1, 0x00000001, 0x0005002c, 0xffff1111, 0xffcc9a9a, 0xffd6c0c1, 0xff7b7373,
+    0xffad3a3a, 0xffff7373, 0xffff7474, 0xffff4f4f, 0xffe90b0b, 0xff951a1a, 0xffc8bebe, 0xffc8bebe,
+    0xff951a1a, 0xffe90000, 0xffff0000, 0xffe90000, 0xff946363, 0xff660000, 0xffd6c0c1, 0xffd6c0c1,
+    0xffd6c0c1, 0xff102704, 0x00000002, 0x00020002, 0xffa92f2f, 0x0002002a, 0xffe3e4e4, 0xffd6c0c1,
+    0xffd6c0c1, 0xffbe4040, 0xfff17e7e, 0xffffe3e3, 0xffffe5e5, 0xffffa0a0, 0xfffa2424, 0xffe90b0b,
+    0xff9d5656, 0xff9d5656, 0xffe90c0c, 0xfffa0000, 0xffff0000, 0xfffa0000, 0xfff00000, 0xffa70000,
+    0xff734343, 0xffd6c0c1, 0xffd6c0c1, 0x00000001, 0x00040030, 0xffcc9a9a, 0xff3a0342, 0xff766965,
+    0xffd6c0c1, 0xffc50000, 0xffff9191, 0xfffff5f5, 0xffffcece, 0xffff8080, 0xffff1b1b, 0xfffd0000,
+    0xffd20000, 0xffd20000, 0xfffd0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffb50000,
+    0xff680000, 0xffd6c0c1, 0xffd6c0c1, 0xff3b0f40, 0xffd0241d, 0x00000001, 0x0005002e, 0xffe71d18,
+    0xff81726f, 0xffd6c0c1, 0xffc50000, 0xffff8282, 0xffffd0d0, 0xffff7676, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffb50000, 0xff680000, 0xffd6c0c1, 0xffd6c0c1, 0xff403629, 0xff8b322d, 0x00000002, 0x00030002,
+    0xff8e322d, 0x0001002c, 0xffcc9a9a, 0xffd6c0c1, 0xffd6c0c1, 0xffc50000, 0xffff3e3e, 0xffff6868,
+    0xffff3a3a, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffb50000, 0xff690000, 0xffd6c0c1, 0xffd6c0c1, 0xff9e302e,
+    0x00000002, 0x00020002, 0xffcc9a9a, 0x00010030, 0xff0e1d08, 0xffcc9a9a, 0xffc7b3b3, 0xffd6c0c1,
+    0xffc50000, 0xffff6d6d, 0xffffb2b2, 0xffff6a6a, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffb50000, 0xff6b0000,
+    0xffd6c0c1, 0xffd6c0c1, 0xffcc9a9a, 0xffe3e4e4, 0x00000002, 0x00060028, 0xffcc9a9a, 0xffd6c0c1,
+    0xffc22828, 0xfffa8b8b, 0xffffe0e0, 0xffff8686, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xfffd0000, 0xfff90000, 0xffb00000, 0xff712b2b,
+    0xffd6c0c1, 0xffd6c0c1, 0x00010002, 0xffdb394e, 0x00000001, 0x0004002c, 0xffc8261e, 0xffcc9a9a,
+    0xffa99796, 0xffd6c0c1, 0xffaaa4a4, 0xff9b3333, 0xfffb4040, 0xfffe2323, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xfffe0000, 0xffe50000, 0xffa80101,
+    0xffd6c0c1, 0xffa5a4a4, 0xffd6c0c1, 0xffc2aeae, 0x00000001, 0x0006002a, 0xffdb394e, 0xffcfb9ba,
+    0xffd6c0c1, 0xffab8b8b, 0xffcb0000, 0xfff00000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xfffe0000, 0xffed0000, 0xffbc0000, 0xff7e0000, 0xff938b8b, 0xffd6c0c1,
+    0xffc6b2b2, 0xff3c213a, 0xff91312d, 0x00000002, 0x00040002, 0xffb38786, 0x00010028, 0xffe3e4e4,
+    0xff3d2438, 0xffc9b4b5, 0xffe3e4e4, 0xff876767, 0xffcd3838, 0xfff60000, 0xfffe0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xfffd0000, 0xfff00000, 0xffc40000, 0xff733838, 0xff6f6767, 0xffd6c0c1,
+    0xffd6c0c1, 0xffccb7b7, 0xffd7d8d8, 0x00000001, 0x0006002a, 0xff6a342b, 0xff584d45, 0xffbaa6a6,
+    0xffd6c0c1, 0xffd2cfcf, 0xff927373, 0xffce0000, 0xfffd0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xfff50000, 0xffbc0000, 0xff7c0000, 0xff7b7373, 0xffd6c0c1, 0xffcfb9ba, 0xffb5a2a2, 0xff3c1b3c,
+    0xff746662, 0xffcc9a9a, 0x00000001, 0x00070026, 0xff665a55, 0xff102704, 0xffd6c0c1, 0xffd6c0c1,
+    0xffd6c0c1, 0xffb98282, 0xffcc1313, 0xfff80000, 0xffff0000, 0xfff10000, 0xffc40000, 0xff831313,
+    0xff908282, 0xffd6c0c1, 0xffc2aeae, 0xff8e7e7c, 0xff8f7f7d, 0xffff1111, 0xff5a554e, 0x00000002,
+    0x00060024, 0xff72342b, 0xff7c6e6b, 0xffdb394e, 0xffa9a8a7, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1,
+    0xff946363, 0xffde2424, 0xffec0000, 0xffd30000, 0xff7c2424, 0xff706363, 0xffc3c3c3, 0xffd6c0c1,
+    0xffa08f8e, 0xffd6c0c1, 0xffe3e4e4, 0x00010002, 0xff8a3125, 0x00000002, 0x00060002, 0xff8b322d,
+    0x0002001e, 0xff847572, 0xffff1111, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1, 0xff8c5555, 0xff980000,
+    0xff8e0000, 0xff685555, 0xffd6c0c1, 0xffd6c0c1, 0xffa1908f, 0xffcc9a9a, 0xff102704, 0xffdb394e,
+    0x00000001, 0x0009001a, 0xff5f534d, 0xffaa9898, 0xff102704, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1,
+    0xff857171, 0xff857171, 0xffcbcbcb, 0xffd6c0c1, 0xffd6c0c1, 0xff52473f, 0xffd6c0c1, 0x00000002,
+    0x00070002, 0xffcc9a9a, 0x0002001a, 0xff716460, 0xffb09e9d, 0xffd6c0c1, 0xffd6c0c1, 0xffd6c0c1,
+    0xff959494, 0xff959494, 0xffe4e4e4, 0xffe3e4e4, 0xff726e6a, 0xffc69595, 0xff3c1b3c, 0xffd2d3d2,
+    0x00000001, 0x000b0012, 0xffdb394e, 0xff70635f, 0xff90807f, 0xffd6c0c1, 0xffd6c0c1, 0xffd1bcbf,
+    0xffffffff, 0xffa92f2f, 0xffcc9a9a, 0x00000001, 0x000c000e, 0xff7e605c, 0xff7b332c, 0xff3a0342,
+    0xff590b16, 0xff4f0811, 0xffa92f2f, 0xff3c1b3c, 0x00000001, 0x000f0004, 0xff5b0f0f, 0xff590b16,
+    0x00000001, 0x00070024, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57,
+    0xff5e5c57, 0xff5e5c57, 0xff671721, 0xff4f0811, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff4c4b47, 0xff514f4c, 0xff514f4c, 0xff514f4c, 0x00000001, 0x00050028, 0xff4c4b47, 0xff5e5c57,
+    0xff5e5c57, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff070605, 0xff590b16, 0xff671721,
+    0xff671721, 0xff590b16, 0xff590b16, 0xff671721, 0xff070605, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff4c4b47, 0xff514f4c, 0x00000003, 0x0005000c, 0xff4c4b47, 0xff4c4b47, 0xff5a5954, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0x00000005, 0xf44c4b47, 0xf4070605, 0x0000001a, 0xff070605, 0xff070605,
+    0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff4c4b47, 0xff4c4b47, 0xff5a5954,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0x00000003, 0x0004000e, 0xff4c4b47, 0xff514f4c, 0xff4c4b47,
+    0xff4c4b47, 0xff5a5954, 0xff4c4b47, 0xff4c4b47, 0x00000005, 0xd34c4b47, 0xd34c4b47, 0x0000001c,
+    0xff4c4b47, 0xff4c4b47, 0xff454440, 0xff4c4b47, 0xff454440, 0xff454440, 0xff454440, 0xff4c4b47,
+    0xff4c4b47, 0xff5a5954, 0xff4c4b47, 0xff5a5954, 0xff5a5954, 0xff4c4b47, 0x00000001, 0x0004002e,
+    0xff4c4b47, 0xff5a5954, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff5a5954, 0xff4c4b47, 0xff5a5954,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff5a5954, 0xff4c4b47, 0xff4c4b47, 0xff5a5954,
+    0xff5a5954, 0xff5a5954, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff5a5954,
+    // teleporter
+    0x00000000, 0x00000000, 0x00000003, 0x000a0003, 0x503e5e18, 0x00010002, 0xff470d14, 0x00000003,
+    0xa8a02837, 0x00000004, 0x000d0003, 0x87ffffff, 0x00050002, 0xff470d14, 0x00000003, 0x240d0506,
+    0x00010002, 0xff470d14, 0x00000006, 0x000a0002, 0xff470d14, 0x00000005, 0x7da02837, 0x91fb6275,
+    0x00010002, 0xff470d14, 0x00010005, 0xc90d0506, 0x72a02837, 0x00000002, 0xff470d14, 0x00010003,
+    0xb83c1045, 0x00000001, 0x000b0005, 0x9e0d0506, 0x84fb6275, 0x00000006, 0x00060002, 0xff470d14,
+    0x00010003, 0xea3c1045, 0x00020002, 0xff470d14, 0x00020008, 0xff671721, 0xff671721, 0xff671721,
+    0xff671721, 0x00020002, 0xff3e5e18, 0x00010005, 0xc9a02837, 0x600d0506, 0x00000005, 0x00070003,
+    0x65fb6275, 0x00020003, 0x493c1045, 0x0002000c, 0xff671721, 0xff4f0d15, 0xff4f0d15, 0xff4f0d15,
+    0xff4f0d15, 0xff671721, 0x00030002, 0xff470d14, 0x00020002, 0xffffffff, 0x00000006, 0x00050002,
+    0xff470d14, 0x00040002, 0xff470d14, 0x00010010, 0xff671721, 0xff4f0d15, 0xff4f0d15, 0xff470d14,
+    0xff470d14, 0xff4f0d15, 0xff4f0d15, 0xff671721, 0x00020004, 0xff470d14, 0xff470d14, 0x00000003,
+    0x843c1045, 0x00010002, 0xff470d14, 0x00000002, 0x00070003, 0x74101645, 0x00030014, 0xff671721,
+    0xff4f0d15, 0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff4f0d15,
+    0xff671721, 0x00000005, 0x00070002, 0xff470d14, 0x00010002, 0xff470d14, 0x00010014, 0xff671721,
+    0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff3d080e, 0xff3d080e, 0xff3d080e, 0xff470d14, 0xff4f0d15,
+    0xff671721, 0x00020003, 0xb8a02837, 0x00010003, 0x68fb6275, 0x00000004, 0x00050003, 0x65a02837,
+    0x00020005, 0x2a0d0506, 0x220d0506, 0x00010014, 0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e,
+    0xff33090e, 0xff33090e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721, 0x00030002, 0xff470d14,
+    0x00000003, 0x00080003, 0x27ffffff, 0x00010018, 0xff671721, 0xff671721, 0xff4f0d15, 0xff470d14,
+    0xff3d080e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721, 0xff671721,
+    0x00010007, 0x9e0d0506, 0x480d0506, 0x68101645, 0x00000004, 0x00080003, 0x313c1045, 0x00010018,
+    0xff671721, 0xff4f0d15, 0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff33090e, 0xff33090e, 0xff3d080e,
+    0xff470d14, 0xff4f0d15, 0xff4f0d15, 0xff671721, 0x00010003, 0x7afb6275, 0x00010002, 0xff470d14,
+    0x00000003, 0x00040005, 0x91ffffff, 0x3cfb6275, 0x00000002, 0xff470d14, 0x0003001a, 0xff671721,
+    0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff3d080e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff3d080e,
+    0xff470d14, 0xff4f0d15, 0xff671721, 0xff470d14, 0x00000008, 0x00040003, 0xa83e5e18, 0x00010002,
+    0xff470d14, 0x00000003, 0x720d0506, 0x00000002, 0xff470d14, 0x00000003, 0xc9a02837, 0x00000018,
+    0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff33090e, 0xff33090e, 0xff33090e, 0xff33090e,
+    0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721, 0x00010002, 0xff470d14, 0x00020002, 0xff470d14,
+    0x00000003, 0x00070003, 0x68101645, 0x00020018, 0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e,
+    0xff33090e, 0xff33090e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721,
+    0x00030003, 0x68a02837, 0x00000003, 0x000a001a, 0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e,
+    0xff33090e, 0xff33090e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721,
+    0xff470d14, 0x00020002, 0xff470d14, 0x00000003, 0x79ffffff, 0x00000004, 0x00060003, 0x3ba02837,
+    0x00010003, 0x243c1045, 0x00010018, 0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff33090e,
+    0xff33090e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721, 0x00000007,
+    0x790d0506, 0x403c1045, 0x6e0d0506, 0x00000005, 0x00050003, 0xc90d0506, 0x00010003, 0x22ffffff,
+    0x00000002, 0xff470d14, 0x00010018, 0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff33090e,
+    0xff33090e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721, 0x00020002,
+    0xff470d14, 0x00000003, 0x00080002, 0xff470d14, 0x00010003, 0xea671721, 0x00000016, 0xff4f0d15,
+    0xff470d14, 0xff3d080e, 0xff3d080e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff3d080e, 0xff470d14,
+    0xff4f0d15, 0xff671721, 0x00000004, 0x000a0003, 0xc9671721, 0x00000016, 0xff4f0d15, 0xff4f0d15,
+    0xff470d14, 0xff3d080e, 0xff33090e, 0xff33090e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff4f0d15,
+    0xff671721, 0x00020002, 0xff470d14, 0x00000003, 0xc90d0506, 0x00000003, 0x00080003, 0xb80d0506,
+    0x00020014, 0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff33090e, 0xff33090e, 0xff3d080e,
+    0xff470d14, 0xff4f0d15, 0xff671721, 0x00020005, 0x843e5e18, 0x6afb6275, 0x00000006, 0x00070002,
+    0xff470d14, 0x00010003, 0x69a02837, 0x00010014, 0xff671721, 0xff4f0d15, 0xff470d14, 0xff3d080e,
+    0xff3d080e, 0xff3d080e, 0xff3d080e, 0xff470d14, 0xff4f0d15, 0xff671721, 0x00010002, 0xff470d14,
+    0x00000003, 0x9e0d0506, 0x00010002, 0xff470d14, 0x00000004, 0x00090003, 0x9a0d0506, 0x00010003,
+    0xea671721, 0x00000012, 0xff4f0d15, 0xff4f0d15, 0xff470d14, 0xff3d080e, 0xff3d080e, 0xff470d14,
+    0xff4f0d15, 0xff4f0d15, 0xff671721, 0x00010003, 0xb13c1045, 0x00000004, 0x000a0003, 0xa8ffffff,
+    0x00010010, 0xff671721, 0xff4f0d15, 0xff4f0d15, 0xff470d14, 0xff470d14, 0xff4f0d15, 0xff4f0d15,
+    0xff671721, 0x00010005, 0xeca02837, 0x66a02837, 0x00000002, 0xff470d14, 0x00000002, 0x000a0004,
+    0xff470d14, 0xfffb6275, 0x0001000c, 0xff671721, 0xff4f0d15, 0xff4f0d15, 0xff4f0d15, 0xff4f0d15,
+    0xff671721, 0x00000003, 0x0007000e, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57, 0xff5e5c57,
+    0xff5e5c57, 0xff070605, 0x00000011, 0xea671721, 0xea671721, 0xc9671721, 0xea671721, 0xea070605,
+    0xea4c4b47, 0xea4c4b47, 0xea4c4b47, 0x00000006, 0xff514f4c, 0xff514f4c, 0xff514f4c, 0x00000001,
+    0x00060026, 0xff5e5c57, 0xff5e5c57, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff070605,
+    0xff590b16, 0xff671721, 0xff671721, 0xff590b16, 0xff590b16, 0xff671721, 0xff070605, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff514f4c, 0x00000001, 0x0005002a, 0xff4c4b47, 0xff4c4b47,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff070605, 0xff070605, 0xff070605,
+    0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff070605, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff52514f, 0xff4c4b47, 0xff4c4b47, 0x00000001, 0x0004002e, 0xff514f4c, 0xff514f4c, 0xff52514f,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff454440, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47,
+    0xff454440, 0xff4c4b47, 0xff454440, 0xff454440, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f,
+    0xff52514f, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0x00000001, 0x00030032, 0xff4c4b47, 0xff4c4b47,
+    0xff4c4b47, 0xff52514f, 0xff52514f, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f, 0xff52514f,
+    0xff52514f, 0xff52514f, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f, 0xff52514f, 0xff52514f,
+    0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff4c4b47, 0xff52514f, 0xff52514f, 0xff4c4b47,
+    // enemy
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffefefe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfffefefe, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xfffffefe,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000001, 0x00000040,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    // dk_right1
+    0x00000000, 0x00000001, 0x000f000c, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0x00000001, 0x000e0010, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0x000d0003, 0xadf73100, 0x00000010, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003,
+    0xadffa563, 0x00000001, 0x000c0018, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xfff73100,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffffa563, 0x00000001,
+    0x000c0018, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffffff, 0xffffffff, 0xffffa563, 0x00000002, 0x000a0018, 0xffffa563,
+    0xffffa563, 0xfff73100, 0xffffa563, 0xffffa563, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffffff, 0x00010004, 0xffffa563, 0xff8c0000, 0x00000002, 0x000a001e,
+    0xffffa563, 0xffffa563, 0xfff73100, 0xffffa563, 0xffffa563, 0xffeca516, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0x00000003,
+    0xa6ffa563, 0x00000002, 0x000a0020, 0xffffa563, 0xffffa563, 0xfff73100, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0x99ffa563, 0x00000003, 0x000a0003, 0xc2f73100,
+    0x0000001e, 0xffeca516, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0xffeca516, 0xffeca516,
+    0x00000003, 0x99eca516, 0x00000003, 0x00090003, 0x998c0000, 0x00000020, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000003, 0x998c0000,
+    0x00000002, 0x00080005, 0xb78c0000, 0xe28c0000, 0x00000020, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000002, 0x00060003, 0x668c0000,
+    0x00000026, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516,
+    0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0x00050005, 0x7a8c0000, 0xe08c0000,
+    0x00000024, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00030003, 0xcbffa563, 0x00000004, 0x00050003, 0x998c0000,
+    0x00000026, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0x66ffa563, 0x00020004, 0xffffa563,
+    0xffffa563, 0x00000004, 0x00040003, 0xfe8c0000, 0x00000026, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0x00000009, 0x01ffa563, 0x99ffa563, 0xfeffa563, 0xfef73100, 0x00000006, 0xffffa563, 0xffffa563,
+    0xffffa563, 0x00000003, 0x00040028, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000005,
+    0x018c0000, 0x99ffa563, 0x0000000a, 0xffffa563, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563,
+    0x00000001, 0x00030038, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100, 0xff8c0000,
+    0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000002, 0x00020003,
+    0x85ffa563, 0x00000038, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000002, 0x00010003,
+    0x99ffa563, 0x0000003a, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000007,
+    0x00010003, 0xb6ffa563, 0x0000000c, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffeca516, 0x00000005, 0xb78c0000, 0xe28c0000, 0x0000001e, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000005, 0xd4ffa563, 0xd4ffa563, 0x00000006,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0xe2ffa563, 0x00000006, 0x0001000e, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00010003, 0x998c0000,
+    0x0000001e, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xffffa563,
+    0x00000005, 0x66ffa563, 0x66ffa563, 0x00000006, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003,
+    0x99f73100, 0x00000007, 0x00010003, 0xd6ffa563, 0x0000000c, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00010003, 0x998c0000, 0x0000001e, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0xffffa563, 0x00000005, 0xa3eca516, 0xa3eca516,
+    0x00000002, 0xffffa563, 0x00000003, 0x99ffa563, 0x00000006, 0x00010003, 0x99ffa563, 0x00000006,
+    0xffffa563, 0xfff73100, 0xffffa563, 0x00000005, 0x66ffa563, 0x66ffa563, 0x00000002, 0xffffa563,
+    0x00010003, 0x998c0000, 0x00000024, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffeca516, 0xffffa563, 0xfff73100, 0xfff73100, 0xffffa563,
+    0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000005, 0x00020003, 0xa6ffa563,
+    0x00000002, 0xffffa563, 0x00000003, 0x6bffa563, 0x00030005, 0x948c0000, 0xd48c0000, 0x00000024,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0xff8c0000, 0xffeca516,
+    0xffeca516, 0xfff73100, 0x00000002, 0x00030002, 0xffffa563, 0x0004002a, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xffffa563,
+    0xffffa563, 0xfff73100, 0xffffa563, 0x00000002, 0x00070003, 0x98ffa563, 0x0000002a, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffeca516, 0xfff73100, 0xff8c0000, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000001, 0x0007002c, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000005, 0x0008000a, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0x84ffa563, 0x00010003, 0x328c0000, 0x00060003,
+    0x848c0000, 0x0000000a, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003,
+    0x0008000a, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00090003, 0x668c0000,
+    0x0000000a, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0x00090003,
+    0xa9f73100, 0x00000006, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000007, 0xe8ffa563, 0xd8ffa563,
+    0xd8ffa563, 0x00000000,
+    // dk_right2
+    0x00000001, 0x000f000c, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0x00000001, 0x000e0010, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0x00000002, 0x000d0012, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0xdeffa563, 0x00000001,
+    0x000c0018, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffffa563, 0x00000001, 0x000c0018, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffffff, 0xffffffff, 0xffffa563, 0x00000003, 0x000a0003, 0xeaffa563, 0x00000016, 0xffffa563,
+    0xfff73100, 0xffffa563, 0xffffa563, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffffff, 0x00010004, 0xffffa563, 0xff8c0000, 0x00000001, 0x000a0020, 0xffffa563,
+    0xffffa563, 0xfff73100, 0xffffa563, 0xffffa563, 0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0xffffa563, 0x00000002,
+    0x000a0020, 0xffffa563, 0xffffa563, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0x00000003, 0xc2ffa563, 0x00000001, 0x000a0022, 0xfff73100, 0xffeca516, 0xfff73100,
+    0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffeca516, 0xffeca516, 0xffeca516, 0xffffa563, 0x00000001, 0x00090024,
+    0xffeca516, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffeca516, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xffeca516, 0x00000001, 0x00080024, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffeca516, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000001, 0x00070026,
+    0xffeca516, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0xffeca516,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00000001, 0x00060026, 0xffeca516, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0x00000001, 0x00040028, 0xffeca516, 0xffeca516, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000001, 0x0002002c,
+    0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0002002c,
+    0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100,
+    0xffeca516, 0xffeca516, 0xffeca516, 0xffeca516, 0xffeca516, 0xff8c0000, 0x00000002, 0x0001002e,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0x00030005,
+    0x68ffa563, 0x27f73100, 0x00000002, 0x0001002e, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00030007, 0xeaffa563, 0xc9f73100, 0x3ff73100, 0x00000002,
+    0x00010038, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000005, 0x9affa563, 0x6fffa563,
+    0x00000002, 0x00010038, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000005, 0xc9ffa563,
+    0xc9ffa563, 0x00000001, 0x00040036, 0xff8c0000, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100,
+    0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100, 0x00000001, 0x00040036,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffeca516,
+    0xffeca516, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xfff73100, 0x00000001, 0x00040034, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffeca516, 0xffffa563, 0xfff73100, 0xff8c0000,
+    0xff8c0000, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100, 0xfff73100, 0x00000001,
+    0x0004002a, 0xffeca516, 0xffeca516, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100,
+    0xffffa563, 0xffffa563, 0xfff73100, 0xfff73100, 0xfff73100, 0xffffa563, 0x00000001, 0x0001002e,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000001,
+    0x0001002e, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0x00000001, 0x0001002e, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0x00000005, 0x00010010, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000003, 0x9e8c0000, 0x00040002, 0xff8c0000, 0x00000003,
+    0xd68c0000, 0x0000000c, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100,
+    0x00000003, 0x0001000a, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0x00000003,
+    0xc98c0000, 0x0008000c, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0x00000003, 0x00010008, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0x00000003, 0xc98c0000,
+    0x0009000c, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000002,
+    0x00010003, 0xd8ffa563, 0x000d000e, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0x00000000,
+    // dk_up1
+    0x00000000, 0x00000002, 0x00070008, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0x00000005,
+    0xe0ffa563, 0xccf73100, 0x00000001, 0x0005000c, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0x00000001, 0x0005000c, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0x00000002, 0x00050022, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0x00000003, 0xcff73100, 0x00000003,
+    0x00040003, 0xc3eca516, 0x00000022, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000005, 0xec8c0000, 0x9c8c0000, 0x00000002,
+    0x00020003, 0xbc8c0000, 0x00000030, 0xff8c0000, 0xffeca516, 0xffffa563, 0xffffa563, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xffffa563, 0xffffa563, 0x00000002, 0x00010005, 0xdc8c0000, 0xf68c0000, 0x00000030,
+    0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100,
+    0x00000001, 0x00010034, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0x00000001, 0x00010034, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0x00000002, 0x00010034, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xff8c0000, 0x00000003, 0xa18c0000, 0x00000002, 0x00010038,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0x00000003, 0xbc8c0000, 0x00000003, 0x00020003,
+    0xd68c0000, 0x00000034, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0x00000005, 0xe48c0000, 0x9a8c0000, 0x00000002,
+    0x00020003, 0xbc8c0000, 0x00000038, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001,
+    0x00050034, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x00050034, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000002,
+    0x00050030, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0x00000003, 0xbc8c0000, 0x00000003, 0x00040003, 0x848c0000, 0x0000002c, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000005, 0xe08c0000, 0xcc8c0000,
+    0x00000002, 0x00020003, 0xbc8c0000, 0x00000030, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000002, 0x00020003, 0xbc8c0000, 0x00000030,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0x00000002, 0x00020003, 0xbc8c0000, 0x00000030, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000002, 0x00020003, 0xbc8c0000, 0x00000030,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0x00000002, 0x00020003, 0xbc8c0000, 0x00000030, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0003002c, 0xffffa563, 0xffffa563,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0003002c, 0xffffa563, 0xffffa563,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0003002c, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000004, 0x00040003, 0xc3ffa563, 0x00000008,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00050010, 0xffeca516, 0xffeca516, 0xffeca516,
+    0xffeca516, 0xffeca516, 0xffeca516, 0xffeca516, 0xffeca516, 0x00000003, 0xececa516, 0x00000003,
+    0x00050008, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00050010, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000003, 0xcfffa563,
+    0x00000002, 0x000e000c, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0x00000005, 0xc2ffa563, 0x65ffa563, 0x00000001, 0x000e000c, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0x00000001, 0x000e0008, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0x00000000,
+    // dk_up2
+    0x00000000, 0x00000001, 0x000c001c, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0x00000003, 0x000a0005, 0xf78c0000, 0xf78c0000, 0x0000001c, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0x0000000b, 0xf78c0000, 0xf78c0000, 0xf7ffa563,
+    0xf7ffa563, 0xf7ffa563, 0x00000001, 0x000a002a, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xffffa563, 0xffffa563,
+    0xffffa563, 0x00000002, 0x0003000b, 0xf3ffa563, 0xf3ffa563, 0xf3ffa563, 0xf38c0000, 0xf38c0000,
+    0x0002002a, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xffffa563, 0x00000002, 0x0002000c,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0x0002002a, 0xfff73100,
+    0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xffffa563, 0x00000003, 0x0002000c, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0x00000005, 0xd68c0000, 0xd68c0000, 0x00000028,
+    0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0001003a, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0001003a, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffeca516, 0xffeca516, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0x00000001, 0x0002003a, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0x00000002, 0x00010003, 0xdaf73100, 0x0000003a, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0x00000001, 0x0002003a, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0x00000002, 0x00020009, 0xf5f73100, 0xf5f73100, 0xf5ffa563, 0xf5ffa563, 0x00000032,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0x00000001, 0x00060032, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x00060032, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001,
+    0x00060032, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0x00000001, 0x00070030, 0xfff73100, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0008002c, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x0008002c, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x000a0028, 0xffffa563, 0xffffa563,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0x00000001, 0x000a0028, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xfff73100, 0xfff73100, 0xfff73100, 0xfff73100, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0x00000001, 0x000a0028, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000001, 0x000a0028,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000002, 0x00110003, 0xa9ffa563, 0x00000014,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0x00000001, 0x00120014, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff8c0000, 0x00000002, 0x00110003,
+    0xa3ffa563, 0x0000000c, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffeca516, 0xffeca516,
+    0x00000001, 0x00100010, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0x00000001, 0x00100010, 0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563,
+    0xffffa563, 0xffffa563, 0xffffa563, 0xffffa563, 0x00000001, 0x00100010, 0xfff73100, 0xfff73100,
+    0xffffa563, 0xffffa563, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0x00000002, 0x0010000c,
+    0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0xfff73100, 0xfff73100, 0x00000005, 0xf7ffa563,
+    0xf7ffa563, 0x00000001, 0x0010000c, 0xfff73100, 0xfff73100, 0xffffa563, 0xffffa563, 0xfff73100,
+    0xfff73100, 0x00000000,
+    // bananarang
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000001, 0x00090003, 0xf7302b26, 0x00000002, 0x00070006, 0xff2d2b2a, 0xff50360b, 0xff50360b,
+    0x00000003, 0xea2d2b2a, 0x00000002, 0x00070003, 0xc22d2b2a, 0x00000006, 0xff603c00, 0xff50360b,
+    0xff1d1c1b, 0x00000004, 0x00080005, 0xea2d2b2a, 0xfb352c1e, 0x00000002, 0xff624c1c, 0x000c0002,
+    0xff624c1c, 0x00000003, 0xb9524631, 0x00000002, 0x00090006, 0xfff2bf39, 0xfff2bf39, 0xff1d1c1b,
+    0x000a0007, 0x6f1d1c1b, 0xcba17d36, 0xd31d1c1b, 0x00000003, 0x00090008, 0xfff2bf39, 0xfff8ca50,
+    0xfff2bf39, 0xff9a792c, 0x00080006, 0xff624c1c, 0xfff2bf39, 0xfff2bf39, 0x00000003, 0xd11d1c1b,
+    0x00000003, 0x0009000a, 0xfff2bf39, 0xfff2bf39, 0xfffbdc78, 0xfff2bf39, 0xff9a792c, 0x00050003,
+    0x9773591d, 0x0000000a, 0xff624c1c, 0xfffbdc78, 0xfff2bf39, 0xfff2bf39, 0xff624c1c, 0x00000004,
+    0x00080003, 0xea1d1c1b, 0x0000000c, 0xffc59d38, 0xfff2bf39, 0xfff8ca50, 0xfffbdc78, 0xfffbdc78,
+    0xff9a792c, 0x00000003, 0xc99a792c, 0x00000012, 0xff9a792c, 0xff9a792c, 0xff9a792c, 0xff9a792c,
+    0xfffbdc78, 0xfff8ca50, 0xfff2bf39, 0xffe5b431, 0xff624c1c, 0x00000002, 0x0009001a, 0xff1d1c1b,
+    0xffdeb13a, 0xfff2bf39, 0xfff8ca50, 0xfff8ca50, 0xfffbdc78, 0xfffbdc78, 0xfffbdc78, 0xfffbdc78,
+    0xfffbdc78, 0xfffbdc78, 0xfffbdc78, 0xfff2bf3a, 0x00000005, 0xece5b431, 0xba1d1c1b, 0x00000002,
+    0x000a0018, 0xff624c1c, 0xfff2bf39, 0xfff2bf39, 0xffedb92a, 0xfff8ca50, 0xfff8ca50, 0xfff8ca50,
+    0xfff8ca50, 0xfff2bf39, 0xfff8ca50, 0xfff4c445, 0xffedc14b, 0x00000005, 0xfce5b431, 0x9b1d1c1b,
+    0x00000001, 0x000a001a, 0xff624c1c, 0xffcda02d, 0xfff2bf39, 0xfff2bf39, 0xfff2bf39, 0xfff2bf39,
+    0xfff2bf39, 0xfff2bf39, 0xfff2bf39, 0xfff2bf39, 0xfff2bf39, 0xffe5b431, 0xff1d1c1b, 0x00000004,
+    0x000b000e, 0xff1d1c1b, 0xffcda02d, 0xfff2bf39, 0xfff2bf39, 0xfff2bf39, 0xffe5b431, 0xffe5b431,
+    0x00000003, 0xd7f2bf39, 0x00000004, 0xfff2bf39, 0xffe5b431, 0x00000003, 0xba1d1c1b, 0x00000001,
+    0x000c0014, 0xff1d1c1b, 0xffc79a22, 0xffe5b431, 0xffe5b431, 0xffe5b431, 0xffcda02d, 0xfff2bf39,
+    0xfff2bf39, 0xff1d1c1b, 0xff624c1c, 0x00000005, 0x000d0004, 0xff1d1c1b, 0xff624c1c, 0x00000003,
+    0xd31d1c1b, 0x00000002, 0xff624c1c, 0x00000005, 0xd31d1c1b, 0x9a1d1c1b, 0x00000002, 0xff624c1c,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000,
+    // bananarang2
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+    0x0006000a, 0xff9a792c, 0xff9a792c, 0xff9a792c, 0xff9a792c, 0xff9a792c, 0x00000001, 0x00050012,
+    0xff7a6125, 0xfffbdc78, 0xfffddc78, 0xfffdd971, 0xfffcce55, 0xfffdd668, 0xff9a792c, 0xff9a792c,
+    0xff46484a, 0x00000002, 0x00040014, 0xff7a6125, 0xfffad670, 0xfffacc56, 0xfff9cc55, 0xfff9cb52,
+    0xfff9cb52, 0xfff9cb53, 0xfff9cb52, 0xfffacc57, 0xfff5c857, 0x00000003, 0xea9a792c, 0x00000003,
+    0x00030003, 0x9e7a6125, 0x00000016, 0xfff3ce67, 0xfffacc55, 0xfff9cb53, 0xfff1c13d, 0xfff0c03b,
+    0xfff0c03b, 0xfff1c13d, 0xfff0c03b, 0xfff2c240, 0xfff3c64a, 0xfff9ce59, 0x00000003, 0xc99a792c,
+    0x00000003, 0x00030003, 0xea493a1c, 0x00000018, 0xfff8d975, 0xfff3c443, 0xffeebd34, 0xffecb726,
+    0xffebb51f, 0xffebb51f, 0xffefbd34, 0xffefbd34, 0xffeebd34, 0xffefbd35, 0xfff5c649, 0xfff8c94e,
+    0x00000003, 0xc99a792c, 0x00000002, 0x0003001c, 0xff493a1c, 0xfff1c03c, 0xffedba2d, 0xffebb51f,
+    0xffebb51f, 0xffeab41f, 0xffe6b11f, 0xffcb9c21, 0xffe1ad1f, 0xffe8b21f, 0xffebb520, 0xffecb624,
+    0xffebb622, 0xffe6b11e, 0x00000003, 0x44493a1c, 0x00000003, 0x00020012, 0xff493a1c, 0xfff6c74a,
+    0xffefbc36, 0xffebb51e, 0xffe9b41f, 0xffb98e17, 0xff9b7a35, 0xff493a1c, 0xff493a1c, 0x00000005,
+    0x651d1c1b, 0x751d1c1b, 0x0000000a, 0xffc69921, 0xffe8b31e, 0xffebb51f, 0xffeab41f, 0xffa07c27,
+    0x00000004, 0x0002000a, 0xff493a1c, 0xfff1bf41, 0xffebb524, 0xffe9b31f, 0xffad8518, 0x00000003,
+    0x801d1c1b, 0x00050003, 0xc9493a1c, 0x0000000a, 0xff6b5322, 0xffc4971c, 0xffe9b41f, 0xffc1941c,
+    0xff493a1c, 0x00000003, 0x00020008, 0xff493a1c, 0xffeeb92a, 0xffe9b31f, 0xffba9020, 0x00000003,
+    0x631d1c1b, 0x00080008, 0xff45423c, 0xff765c25, 0xffbf9018, 0xff493a1c, 0x00000003, 0x00020006,
+    0xff493a1c, 0xffe8b21e, 0xffc89a1b, 0x000c0002, 0xff46391e, 0x00000003, 0xea493a1c, 0x00000001,
+    0x00030004, 0xffd9a71d, 0xff9b7822, 0x00000001, 0x00030004, 0xff2d2b2a, 0xff201f1e, 0x00000001,
+    0x00030004, 0xff603c00, 0xff69430b, 0x00000001, 0x00030004, 0xff5e3c07, 0xff68430b, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000,
+    // bananarang3
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+    0x0015000a, 0xff9a792c, 0xff9a792c, 0xff9a792c, 0xff9a792c, 0xff9a792c, 0x00000002, 0x00120003,
+    0xc946484a, 0x00000010, 0xff9a792c, 0xff9a792c, 0xfffdd668, 0xfffcce55, 0xfffdd971, 0xfffddc78,
+    0xfffbdc78, 0xff7a6125, 0x00000002, 0x00110003, 0xa89a792c, 0x00000014, 0xfff5c857, 0xfffacc57,
+    0xfff9cb52, 0xfff9cb53, 0xfff9cb52, 0xfff9cb52, 0xfff9cc55, 0xfffacc56, 0xfffad670, 0xff7a6125,
+    0x00000003, 0x00100003, 0x739a792c, 0x00000016, 0xfff9ce59, 0xfff3c64a, 0xfff2c240, 0xfff0c03b,
+    0xfff1c13d, 0xfff0c03b, 0xfff0c03b, 0xfff1c13d, 0xfff9cb53, 0xfffacc55, 0xfff3ce67, 0x00000003,
+    0xea7a6125, 0x00000002, 0x000f0005, 0xb89a792c, 0xc9f8c94e, 0x00000018, 0xfff5c649, 0xffefbd35,
+    0xffeebd34, 0xffefbd34, 0xffefbd34, 0xffebb51f, 0xffebb51f, 0xffecb726, 0xffeebd34, 0xfff3c443,
+    0xfff8d975, 0xffedba2d, 0x00000001, 0x000f001c, 0xffe6b11e, 0xffebb622, 0xffecb624, 0xffebb520,
+    0xffe8b21f, 0xffe1ad1f, 0xffcb9c21, 0xffe6b11f, 0xffeab41f, 0xffebb51f, 0xffebb51f, 0xffedba2d,
+    0xfff1c03c, 0xffedba2d, 0x00000002, 0x000e000a, 0xffa07c27, 0xffeab41f, 0xffebb51f, 0xffe8b31e,
+    0xffc69921, 0x0004000c, 0xff9b7a35, 0xffb98e17, 0xffe9b41f, 0xffebb51e, 0xffefbc36, 0xfff6c74a,
+    0x00000002, 0x000e0008, 0xffc1941c, 0xffe9b41f, 0xffc4971c, 0xff6b5322, 0x00070008, 0xffad8518,
+    0xffe9b31f, 0xffebb524, 0xfff1bf41, 0x00000002, 0x000e0005, 0xeabf9018, 0xea765c25, 0x000a0006,
+    0xffba9020, 0xffe9b31f, 0xffeeb92a, 0x00000001, 0x001b0004, 0xffc89a1b, 0xffe8b21e, 0x00000001,
+    0x001b0004, 0xff9b7822, 0xffd9a71d, 0x00000001, 0x001b0004, 0xff201f1e, 0xff2d2b2a, 0x00000001,
+    0x001b0004, 0xff69430b, 0xff603c00, 0x00000001, 0x001b0004, 0xff68430b, 0xff5e3c07, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000,
+};
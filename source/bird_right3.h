@@ -1,155 +0,0 @@
-/* GIMP RGBA C-Source image dump (bird_right3.c) */
-
-static const struct
-{
-  unsigned int width;
-  unsigned int height;
-  unsigned int bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  unsigned char pixel_data[32 * 32 * 4 + 1];
-} bird_right3 = {
-    32,
-    32,
-    4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377\215\267\066"
-    "\033\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037"
-    "\037\377#\037\037\377#\037\037\377\000g\201\377#\037\037\377#\037\037\377\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377+OE\377<\230\264\377c\235"
-    "\260\377#\037\037\377\002d}\377\040\260\327\377#\037\037\377\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\022\\o\377\021\241\307\377"
-    "F\227\257\377\013Zp\377\024\260\331\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377"
-    "#\037\037\377#\037\037\377#\037\037\377#\037\037\377#\037\037\377#\037\037\377\000Uk\377"
-    "\007\242\310\377\013\202\242\377\015\256\327\377#\037\037\377\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037"
-    "\377\016v\222\377\000\222\266\377\000\222\267\377\000\212\255\377\000\220\264\377"
-    "\000w\226\377\000{\233\377\000x\227\377\000\177\237\377\000\252\324\377\002\250\322\377"
-    "#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000#\037\037\377\026i~\377\000\243\314\377\000\261\335\377\000\261\335\377\000\260\334"
-    "\377\000\257\332\377\000\253\325\377\000\230\276\377\000\247\321\377\000\261\335\377"
-    "\000\256\332\377\000\254\327\377\000|\233\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\015o\210\377\000\254\327\377\000"
-    "\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261"
-    "\335\377\000\260\334\377\000\261\335\377\000\261\335\377\000\261\335\377\000\260\334"
-    "\377\000\244\315\377\011x\224\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000#\037\037\377&TU\377\000\204\246\377\000\235\304\377\000\261\334\377\000\261"
-    "\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335"
-    "\377\000\261\335\377\000\261\335\377\000\245\317\377\000\177\240\377\000\234\303\377"
-    "\000\252\324\377\005\203\243\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037"
-    "\037\377\000m\212\377\000\207\251\377\000\215\261\377\000\256\331\377\000\261\335\377"
-    "\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000"
-    "\261\335\377\000\261\335\377\000\251\324\377\000\064B\377\000\023\032\377\000EX\377\000"
-    "n\212\377!HH\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\000\200\240\377"
-    "\000\207\251\377\000\215\261\377\000\256\331\377\000\261\335\377\000\261\335\377\000"
-    "\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261"
-    "\335\377\000\257\332\377\000l\210\377\061<A\377fff\377LLL\377\000\000\003\377#\037\037"
-    "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000'\066\013\064#\037\037\311\033OX\377\004\213\255\377\000\213\256\377\000"
-    "\236\306\377\000\260\333\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261"
-    "\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335"
-    "\377\000\255\330\377g\210\230\377\365\365\365\377\306\306\306\377\021\021\021"
-    "\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000#\037\037H#\037\037)#\037\037\326\000Qf\377\004\226\272\377\000\210\252"
-    "\377\000x\227\377\000u\224\377\000\203\244\377\000\216\262\377\000\234\304\377\000\245"
-    "\317\377\000\260\334\377\000\261\335\377\000\261\335\377\000\261\335\377\000\261\335"
-    "\377\000\256\331\377\021\201\241\377\245\254\260\377#\037\037\377\214o\070\377"
-    "\323\260e\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000#\037\037\213\000\000\000D#\037\037\377\021\030\001\352$.\064\377r\177\203\377p"
-    "\221\231\377\177\240\255\377\211\250\265\377\200\241\256\377k\221\235\377"
-    "m\210\220\377B_k\377\000\242\313\377\000\261\335\377\000\261\335\377\000\261\335"
-    "\377\000\260\333\377\000\235\304\377\000\244\315\377\000\214\257\377PWU\377\331\237"
-    "\016\377\367\267\030\377\364\277N\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\000\000\000\000Wpv\377\200\271\313\377"
-    "g\274\332\377C\265\331\377\023\260\331\377\000\262\335\377\004\264\337\377*\270"
-    "\340\377S\275\341\377\066p\205\377\004\236\303\377\023\263\332\377\027\263\332"
-    "\377\015\262\333\377\000\261\334\377\000\254\327\377\000\243\313\377\000\230\276\377"
-    "EX\\\377\227m\005\377\235q\006\377\245x\010\377\264\216\066\377#\037\037\377\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\036CO\377A\236\271"
-    "\377\014\222\264\377\000\213\255\377\000\212\254\377\000\236\306\377\007\257\331\377"
-    "\003\261\335\377\000\261\335\377\000\257\332\377\064\\k\377\264\270\252\377\311"
-    "\310\267\377\313\310\266\377\305\307\270\377\270\305\274\377\233\300\304"
-    "\377k\266\313\377\031\254\323\377\023\223\267\377\232r\035\377\272\206\007\377"
-    "#\037\037\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000#\037\037\377\002Yp\377\010o\213\377&`t\377D\201\224\377\026\241\305\377"
-    "\000\260\334\377\000\257\333\377\006\260\332\377\000\261\335\377\000\236\305\377lb"
-    "W\377\355\313\252\377\360\316\254\377\360\316\254\377\360\316\254\377\360"
-    "\316\254\377\356\316\254\377\352\315\256\377\315\307\266\377h\242\263\377"
-    ".PR\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000#\037\037\377\064EL\377k\232\250\377d\273\326\377$\262\332"
-    "\377\001\247\321\377\000\233\302\377\000\244\315\377\000\260\334\377\000\246\317\377"
-    "\016`x\377\267\234\202\377\360\316\254\377\360\316\254\377\360\316\254\377"
-    "\360\316\254\377\360\316\254\377\360\316\254\377\357\315\252\377\344\300"
-    "\234\377\261\226y\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377I\246\301\377!\263\333"
-    "\377\002\241\310\377\000\220\264\377\001\177\237\377\001\206\247\377\000\256\331\377"
-    "\000\243\314\377\000y\230\377reW\377\351\310\247\377\360\316\254\377\360\316"
-    "\254\377\360\316\254\377\360\316\254\377\360\316\254\377\356\313\250\377"
-    "\342\275\230\377\306\243\201\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\024q\210\377"
-    "\002\250\322\377\000\220\265\377\001z\231\377\033e{\377\035\203\237\377\001\252\324"
-    "\377\000\232\301\377\000\177\237\377:JQ\377\323\264\226\377\355\314\254\377\360"
-    "\316\254\377\360\316\254\377\357\315\253\377\355\313\251\377\347\304\240"
-    "\377\334\267\221\377\300\236|\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\002"
-    "s\220\377\000\213\256\377\030h\200\377]z\203\377C\247\304\377\011\244\315\377"
-    "\000\217\264\377\000\201\242\377%L[\377\250\213n\377\341\274\230\377\344\300"
-    "\235\377\345\301\237\377\345\301\235\377\341\274\230\377\335\267\222\377"
-    "\316\252\206\377\232\177c\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377"
-    "\017Vi\377\027g\200\377\214\240\247\377b\274\333\377\000\232\277\377\000\211\253"
-    "\377\000\201\242\377\025N[\377DF$\356\244\206j\377\310\245\202\377\316\252\206"
-    "\377\317\253\207\377\314\250\205\377\302\240~\377\223x^\377#\037\037\377#\037"
-    "\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377g\201\210\377a\273"
-    "\327\377\000\221\266\377\000\207\251\377\000\200\240\377\032OZ\377#\037\037\377#\037"
-    "\037\377#\037\037\377#\037\037\377#\037\037\377#\037\037\377#\037\037\377#\037\037\377"
-    "#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037"
-    "\377d\256\304\377\004\217\263\377\000\207\251\377\000~\236\377\035MS\377#\037\037"
-    "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\031"
-    "\217\257\377\000\207\251\377\000\200\240\377\036NT\377#\037\037\377\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\000\202\242"
-    "\377\000\203\244\377\030P]\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000#\037\037\377\000o\214\377\003^v\377#\037"
-    "\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000#\037\037\377#\037\037\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
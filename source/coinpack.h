@@ -1,152 +0,0 @@
-/* GIMP RGBA C-Source image dump (coinpack.c) */
-
-static const struct
-{
-  unsigned int width;
-  unsigned int height;
-  unsigned int bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  unsigned char pixel_data[32 * 32 * 4 + 1];
-} coinpack = {
-    32,
-    32,
-    4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000NG>\314`[U\377R\065(f\000\000\000\000Z\066-\377\000\000\000\000\000\000\000\000\000\000\000\000\231"
-    "/$\377\000\000\000\000\000\000\000\000\220\060%\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000_KC\377"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000]\065*\377\000\000\000\000\000\000\000\000"
-    "\312&\036\377\224\204\202\377\251//\377\000\000\000\000\257\234\234\377\000\000\000\000\000"
-    "\000\000\000\224pm\377\257+\"\377f\066/\377RB\070f\000\000\000\000\000\000\000\000R\065(f\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000=\"\071\252\000\000\000"
-    "\000\264\242\242\377\264\242\242\377\264\242\242\377\264\242\242\377\264\242"
-    "\242\377\264\242\242\377\264\242\242\377\264\242\242\377\340\040\032\377\000"
-    "\000\000\000\000\000\000\000ugd\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000NC:Dh\\W\377"
-    "\340\040\032\377\207xv\377\272\246\246\377\317\271\272\377\326\300\301\377"
-    "\326\300\301\377\264\242\242\377\264\242\242\377\264\242\242\377\264\242"
-    "\242\377\264\242\242\377\264\242\242\377\300\254\254\377\000\000\000\000\234\067<"
-    "\377\273\250\250\377l_Z\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000o\063'\377_KC\377v\067\063"
-    "\377\271\246\246\377phg\377\264\242\242\377\264\242\242\377\217nn\377\237"
-    "\227\221\377\201V\013\377\200Y\026\377\200Y\024\377\206ta\377\264\242\242\377"
-    "\264\242\242\377\326\300\301\377\326\300\301\377{ss\377\255\233\232\377\177"
-    "qn\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000T\065*\252\000\000\000\000\000\000\000\000tqm\377<\033<\377\367\026\024\377\322\275\275"
-    "\377\247\226\226\377\264\242\242\377\210\202\202\377|U\030\377\263\220R\377"
-    "\367\302h\377\372\277A\377\372\277D\377\313\226\062\377m\065\016\377\221YU\377"
-    "\264\242\242\377\264\242\242\377\264\242\242\377J\070.\377\233.$\377p\064+"
-    "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000]IB\377?\062-\377aUO\377\316\271\271\377\264\242\242\377\264\242"
-    "\242\377\210\202\202\377\210\202\202\377\363\304z\377\364\330\247\377\372"
-    "\362\260\377\376\347^\377\376\350`\377\356\311K\377\341\223*\377\241m&\377"
-    "\210\202\202\377\264\242\242\377\264\242\242\377\264\242\242\377dXR\377f"
-    "YT\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\327\"\033\377tfb\377\210\202\202\377\264\242\242\377"
-    "\210\202\202\377\235|F\377\366\326\231\377\371\370\326\377\364\352\250\377"
-    "\364\322Q\377\364\321T\377\364\320R\377\367\332Y\377\376\346_\377\355\301"
-    "H\377\223d+\377\264\242\242\377\264\242\242\377\264\242\242\377\221\201\177"
-    "\377y\063,\377_\064(\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000rXS\377\326\300\301\377\264\242\242\377\264"
-    "\242\242\377yT\030\377\364\302}\377\372\370\326\377\371\333g\377\347\262="
-    "\377\204C\000\377\346\211\037\377\344\213\034\377\353\246\067\377\365\326V\377"
-    "\375\346b\377\345\253<\377l?\030\377\210\202\202\377\264\242\242\377\264\242"
-    "\242\377;\020@\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000]IB\377\000\000\000\000\227/$\377\000\000\000\000\306\262\262\377\264\242\242\377"
-    "\256\222\214\377\263\217R\377\366\330\250\377\366\352\251\377\346\262=\377"
-    "\204C\000\377\372\272@\377\372\272@\377\372\272@\377\372\272@\377\352\275G"
-    "\377\371\340[\377\357\305J\377\251x,\377\210\202\202\377\264\242\242\377"
-    "\264\242\242\377\260\236\235\377rXS\377NG>\314\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\257\235\235\377\210"
-    "\202\202\377\204C\000\377\370\301j\377\371\361\262\377\364\320Q\377\343\215"
-    "\036\377\372\272@\377\372\272@\377\373\274<\377\373\330Q\377\373\350^\377"
-    "\371\317R\377\374\314L\377\373\351]\377\345\245\065\377\204@\000\377\264\242"
-    "\242\377\264\242\242\377\306\262\262\377\250,\"\377\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\227/$\377\271\214\213"
-    "\377\264\242\242\377\264\242\242\377\201[\017\377\373\277>\377\373\344b\377"
-    "\363\317U\377\347\214#\377\372\272@\377\372\272@\377\372\330T\377\373\346"
-    "^\377\371\351\214\377\370\322\211\377\371\320P\377\375\345b\377\344\245\067"
-    "\377\204C\000\377\264\242\242\377\264\242\242\377\255\233\232\377=!\071\314"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\234\060.\377\220\201\177\377\255\234\234\377\204C\000\377\371\300D"
-    "\377\371\345`\377\363\317X\377\343\216%\377\371\273E\377\370\325Z\377\373"
-    "\345c\377\366\352\210\377\367\363\326\377\366\333\271\377\370\316R\377\374"
-    "\343_\377\342\244\067\377\202C\000\377\264\242\242\377\264\242\242\377=&\066"
-    "\"R\065*f\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000x\\X\377\000\000\000\000\246-\"\377\251\230\227\377\242\215\200\377\315\233"
-    ":\377\372\331S\377\367\331[\377\347\250\071\377\363\275C\377\373\352\\\377"
-    "\374\355\206\377\372\366\320\377\366\361\345\377\367\327\221\377\373\333"
-    "X\377\364\316Q\377\300\205,\377\214ob\377\264\242\242\377\261\237\237\377"
-    "\251\250\246\377\237.#\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000f\064+\377\264\242\242\377\267\247"
-    "\247\377yU\035\377\370\277:\377\376\350a\377\362\330W\377\352\275F\377\373"
-    "\322M\377\374\327\206\377\372\334\271\377\371\325\220\377\371\332W\377\377"
-    "\350`\377\350\253<\377\204C\000\377\264\242\242\377\264\242\242\377<!:\377"
-    "`TN\377iRL\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\227/$\377\264\242\242\377\264\242\242\377"
-    "\266\250\245\377\204C\000\377\374\322Q\377\375\351_\377\367\341U\377\374\317"
-    "N\377\374\320N\377\375\320L\377\374\333W\377\376\347^\377\361\314L\377\204"
-    "C\000\377\264\242\242\377\264\242\242\377\264\242\242\377\327\"\033\377\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\224\061-\377\254\233\232\377\264\242"
-    "\242\377\210\202\202\377\204C\000\377\372\307Q\377\371\326U\377\377\350^\377"
-    "\374\350b\377\374\351_\377\362\321P\377\350\252;\377\262\204\064\377\210\202"
-    "\202\377\264\242\242\377\264\242\242\377\343\344\344\377\223\061-\377g\064"
-    "'\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000fZU\377\321\071K\377\264\242\242\377\264"
-    "\242\242\377\275\265\253\377\204C\000\377\300\226;\377\367\310C\377\371\306"
-    "F\377\372\305H\377\321\236\066\377\200D\011\377\255\246\241\377\326\304\305"
-    "\377\240\217\216\377\306\262\262\377\327\071M\377\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\206\200\200\377\206\200\200\377"
-    "\264\242\242\377\264\242\242\377\255\237\225\377\204C\000\377\204C\000\377\204"
-    "C\000\377\204C\000\377\264\242\243\377\264\242\242\377\264\242\242\377\314\232"
-    "\232\377\036*\017\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\243{z\377\000\000\000\000\000\000\000\000\341\037\031\377\251\227\226\377\326\300\301\377"
-    "\264\242\242\377\264\242\242\377\264\242\242\377\264\242\242\377\264\242"
-    "\242\377\264\242\242\377rnj\377\300\221\220\377\000\000\000\000\303\303\302\377\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\321\071K\377pc_\377\220\200\177\377\264\242\242\377\264\242"
-    "\242\377\264\242\242\377\377\377\377\377\251//\377\314\232\232\377\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000~`\\\377{\063,\377:\003B\377Y\013\026"
-    "\377O\010\021\377\251//\377<\033<\377\251//\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000[\017\017\377Y\013\026\377\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000^\\W\377^\\W\377^\\W\377^\\W\377^\\W\377^\\W\377"
-    "^\\W\377^\\W\377g\027!\377O\010\021\377LKG\377LKG\377LKG\377LKG\377LKG\377Q"
-    "OL\377QOL\377QOL\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000?=:D^\\W\377^\\W\377LKG\377?"
-    "=:DLKG\377LKG\377\007\006\005\377Y\013\026\377g\027!\377g\027!\377Y\013\026\377Y\013\026"
-    "\377g\027!\377\007\006\005\377LKG\377LKG\377SRN\377LKG\377QOL\377?=:D?=:D\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000?=:DLK"
-    "G\377?=:DLKG\377LKG\377LKG\377LKG\377LKG\377\007\006\005\377\007\006\005\377\007\006\005\377"
-    "\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377BA=\252LKG\377SRN\377S"
-    "RN\377?=:DLKG\377?=:D?=:D\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000LKG\377SRN\377LKG\377LKG\377LKG\377?=:DED@\377LKG\377LKG"
-    "\377LKG\377SRN\377LKG\377SRN\377LKG\377ED@\377SRN\377BA=\252LKG\377LKG\377"
-    "SRN\377SRN\377SRN\377SRN\377?=:D\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000?=:DLKG\377LKG\377LKG\377SRN\377LKG\377SRN\377LKG\377SRN"
-    "\377LKG\377SRN\377SRN\377SRN\377SRN\377SRN\377LKG\377LKG\377LKG\377LKG\377"
-    "SRN\377LKG\377LKG\377LKG\377SRN\377?=:D?=:D\000\000\000\000\000\000\000\000\000\000\000\000",
-};
@@ -0,0 +1,119 @@
+#include "gpio.h"
+#include "mmu.h"
+#include "dma.h"
+
+// DMA blitter. Copies are queued as a chain of 2D control blocks and run by one channel of the BCM2711 DMA
+// controller while the CPU carries on. Sources must already be in memory (see dcache_clean); destinations are the
+// framebuffer, which the CPU never caches. There are two pools of control blocks, so the next chain can be queued in
+// one while the other runs.
+
+#define DMA_CHANNEL   5 // Not used by the firmware.
+#define DMA_BASE      (MMIO_BASE + 0x7000 + DMA_CHANNEL * 0x100)
+#define DMA_CS        ((volatile unsigned int*)(DMA_BASE + 0x00))
+#define DMA_CONBLK_AD ((volatile unsigned int*)(DMA_BASE + 0x04))
+#define DMA_ENABLE    ((volatile unsigned int*)(MMIO_BASE + 0x7FF0))
+
+// CS bits
+#define CS_ACTIVE     (1 << 0)
+#define CS_END        (1 << 1)
+#define CS_INT        (1 << 2)
+#define CS_PRIORITY(p) ((p) << 16)
+#define CS_PANIC(p)   ((p) << 20)
+#define CS_WAIT_WRITES (1 << 28)
+#define CS_RESET      (1 << 31)
+
+// Transfer information bits
+#define TI_TDMODE     (1 << 1)  // 2D: TXFR_LEN is rows and row length, STRIDE the gaps between rows.
+#define TI_WAIT_RESP  (1 << 3)
+#define TI_DEST_INC   (1 << 4)
+#define TI_DEST_WIDTH (1 << 5)  // 128 bit writes
+#define TI_SRC_INC    (1 << 8)
+#define TI_SRC_WIDTH  (1 << 9)  // 128 bit reads
+#define TI_BURST(n)   ((n) << 12)
+
+#define BUS_ADDR(p)   (((unsigned int)(unsigned long)(p) & 0x3FFFFFFF) | 0xC0000000) // Uncached alias of ARM RAM.
+
+#define DMA_BLOCKS 256
+
+struct dma_cb
+{
+    unsigned int ti;
+    unsigned int source;
+    unsigned int dest;
+    unsigned int length;
+    unsigned int stride;
+    unsigned int next;
+    unsigned int reserved[2];
+} __attribute__((aligned(32)));
+
+static struct dma_cb pools[2][DMA_BLOCKS];
+static int pool = 0;       // Pool being queued into. The other holds the chain last started.
+static int num_blocks = 0; // Blocks queued since the last dma_start.
+static int running = 0;    // Set while a chain may still be running.
+
+void dma_init()
+{
+#ifdef __aarch64__
+    *DMA_ENABLE |= 1 << DMA_CHANNEL;
+    *DMA_CS = CS_RESET;
+    while (*DMA_CS & CS_RESET);
+#endif
+    num_blocks = 0;
+    running = 0;
+}
+
+/* Queues a copy of height rows of width bytes. Rows are dpitch and spitch bytes apart. Nothing moves until dma_start,
+ * and a chain already running carries on undisturbed. Returns 0 if the queue is full, or there is no DMA engine (the
+ * simulator), and the caller should copy the pixels itself. */
+int dma_copy_2d(void *dst, int dpitch, const void *src, int spitch, int width, int height)
+{
+#ifdef __aarch64__
+    struct dma_cb *blocks = pools[pool];
+
+    if (num_blocks == DMA_BLOCKS || height <= 0 || width <= 0) return 0;
+
+    struct dma_cb *cb = &blocks[num_blocks];
+    cb->ti = TI_TDMODE | TI_WAIT_RESP | TI_DEST_INC | TI_DEST_WIDTH | TI_SRC_INC | TI_SRC_WIDTH | TI_BURST(8);
+    cb->source = BUS_ADDR(src);
+    cb->dest = BUS_ADDR(dst);
+    cb->length = ((height - 1) << 16) | width;
+    cb->stride = (((dpitch - width) & 0xFFFF) << 16) | ((spitch - width) & 0xFFFF);
+    cb->next = 0;
+    if (num_blocks > 0) blocks[num_blocks - 1].next = BUS_ADDR(cb);
+    num_blocks++;
+    return 1;
+#else
+    (void) dst; (void) dpitch; (void) src; (void) spitch; (void) width; (void) height;
+    return 0;
+#endif
+}
+
+/* Starts the queued chain and returns once it is running. The channel runs one chain at a time, so this first waits
+ * for the one before, if it is still going. */
+void dma_start()
+{
+    if (num_blocks == 0) return;
+    while (dma_busy());
+
+    dcache_clean(pools[pool], num_blocks * sizeof(struct dma_cb));
+    *DMA_CS = CS_END | CS_INT;
+    *DMA_CONBLK_AD = BUS_ADDR(pools[pool]);
+    *DMA_CS = CS_ACTIVE | CS_PRIORITY(8) | CS_PANIC(15) | CS_WAIT_WRITES;
+    pool = 1 - pool;
+    num_blocks = 0;
+    running = 1;
+}
+
+/* Returns 1 while a started chain is still copying. */
+int dma_busy()
+{
+    if (running && !(*DMA_CS & CS_ACTIVE)) running = 0;
+    return running;
+}
+
+/* Completion fence: starts anything queued and returns once every copy has landed. */
+void dma_wait()
+{
+    dma_start();
+    while (dma_busy());
+}
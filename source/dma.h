@@ -0,0 +1,10 @@
+#ifndef DMA_H
+#define DMA_H
+
+void dma_init();
+int dma_copy_2d(void *dst, int dpitch, const void *src, int spitch, int width, int height);
+void dma_start();
+int dma_busy();
+void dma_wait();
+
+#endif
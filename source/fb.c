@@ -1,91 +1,630 @@
-#include "uart.h"
-#include "mbox.h"
+#include "hal.h"
 #include "terminal.h"
+#include "fb.h"
+#include "dma.h"
+#include "smp.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
 
 unsigned int width, height, pitch, isrgb;
-unsigned char *fb;
+unsigned char *fb; // Buffer being drawn to. With double buffering this is the page that is not on screen.
+
+// Pixel format of the framebuffer: 32 bits ARGB, 16 bits RGB565 or 8 bits indexing a 3-3-2 palette. Everything in
+// RAM (sprites, surfaces, the glyph cache) stays ARGB and is converted by the kernels as it is stored to the screen.
+unsigned int depth = 32;
+static int bytes_pp = 4;
+
+// Double buffering: the virtual framebuffer is two screens tall, and fb_present flips between the halves.
+unsigned char *fb_base;  // Start of the whole virtual framebuffer.
+static unsigned long fb_bytes; // Size of the whole virtual framebuffer.
+int fb_pages = 1;        // 2 if the firmware gave us room for a back buffer.
+int fb_front = 0;        // Index of the page currently on screen.
+
+#define MAXDAMAGE 128
+
+// Rectangles drawn to the back buffer since the last fb_present. After a flip they are copied from the new front
+// buffer into the new back buffer, so drawing can keep updating the screen incrementally.
+struct rect
+{
+    int x, y, w, h;
+};
+
+// One list per core, since bands of a frame may be drawn on all of them at once.
+static struct rect damage[SMP_CORES][MAXDAMAGE];
+static int num_damage[SMP_CORES];
+
+// With DMA on, opaque cell copies and the copy forward after a flip are queued for the DMA engine instead of done by
+// the CPU. Anything the CPU draws waits for them first (see fb_damage), so drawing order is kept.
+static int use_dma = 0;
+
+static const unsigned int *glyph_slot(unsigned char attr);
+static unsigned int from_native(unsigned int c);
+
+/* Loads the 3-3-2 palette used at 8 bits per pixel, so a pixel's index is its own color. */
+static void load_palette()
+{
+    unsigned int colors[256];
+
+    for (int i = 0; i < 256; i++) colors[i] = from_native(i);
+    hal_fb_palette(colors, 256);
+}
+
+/* Sets up a w x h screen with bpp bits per pixel (32, 16 or 8). Falls back to 32 if the platform won't give us bpp.
+ * The display scaler stretches the framebuffer to the monitor's resolution, so a smaller one is cheaper to draw
+ * without changing what is seen. */
+void fb_init(int w, int h, int bpp)
+{
+    struct hal_fb info;
+
+    if (hal_fb_open(w, h, bpp, &info)) {
+        width = info.width;
+        height = info.height;
+        pitch = info.pitch;
+        isrgb = info.isrgb;
+        depth = bpp;
+        bytes_pp = bpp / 8;
+        fb_base = info.base;
+        fb_bytes = info.bytes;
+        fb_pages = info.pages;
+        fb_front = 0;
+        fb = fb_base + (fb_pages - 1) * height * pitch;
+        for (int i = 0; i < SMP_CORES; i++) num_damage[i] = 0;
+
+        if (depth == 8) load_palette();
+
+        // Expand the font for the default white on black text now rather than on the first string drawn.
+        glyph_slot(0x0F);
+    } else if (bpp != 32) {
+        hal_log("Depth not supported, using 32 bits per pixel\n");
+        fb_init(w, h, 32);
+    }
+}
+
+/* Gives the memory the framebuffer occupies, for mapping it. */
+void fb_region(unsigned long *start, unsigned long *size)
+{
+    *start = (unsigned long) fb_base;
+    *size = fb_bytes ? fb_bytes : fb_pages * height * pitch;
+}
+
+static void add_damage(int x, int y, int w, int h)
+{
+    if (fb_pages < 2) return;
+
+    // Clip to the screen.
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > (int)width) w = width - x;
+    if (y + h > (int)height) h = height - y;
+    if (w <= 0 || h <= 0) return;
+
+    int core = smp_core();
+    struct rect *list = damage[core];
+    int n = num_damage[core];
+
+    if (n > 0) {
+        struct rect *last = &list[n - 1];
+
+        // Drawing that continues along the same rows (strings, numbers) extends the last rectangle, and so does
+        // drawing that continues down the same columns (rows stored one at a time).
+        if (last->y == y && last->h == h && last->x + last->w == x) {
+            last->w += w;
+            return;
+        }
+        if (last->x == x && last->w == w && last->y + last->h == y) {
+            last->h += h;
+            return;
+        }
+    }
+
+    if (n == MAXDAMAGE) {
+        // Out of room, fold everything into one bounding rectangle.
+        int x1 = x, y1 = y, x2 = x + w, y2 = y + h;
+        for (int i = 0; i < n; i++) {
+            if (list[i].x < x1) x1 = list[i].x;
+            if (list[i].y < y1) y1 = list[i].y;
+            if (list[i].x + list[i].w > x2) x2 = list[i].x + list[i].w;
+            if (list[i].y + list[i].h > y2) y2 = list[i].y + list[i].h;
+        }
+        x = x1; y = y1; w = x2 - x1; h = y2 - y1;
+        n = 0;
+    }
+
+    list[n].x = x;
+    list[n].y = y;
+    list[n].w = w;
+    list[n].h = h;
+    num_damage[core] = n + 1;
+}
+
+/* Records that a rectangle of the back buffer is about to be drawn to by the CPU. The drawing functions in this file
+ * do this themselves; anything that writes pixels some other way (drawPixel) must call it first. Waits for queued DMA
+ * copies, which may cover the same pixels. */
+void fb_damage(int x, int y, int w, int h)
+{
+    if (use_dma) dma_wait();
+    add_damage(x, y, w, h);
+}
 
-void fb_init()
+/* Turns the DMA blitter on or off. */
+void fb_use_dma(int on)
 {
-    mbox[0] = 35*4; // Length of message in bytes
-    mbox[1] = MBOX_REQUEST;
+    if (use_dma) dma_wait();
+    if (on) dma_init();
+    use_dma = on;
+}
 
-    mbox[2] = MBOX_TAG_SETPHYWH; // Tag identifier
-    mbox[3] = 8; // Value size in bytes
-    mbox[4] = 0;
-    mbox[5] = 1920; // Value(width)
-    mbox[6] = 1080; // Value(height)
+/* Returns 1 while DMA copies for the frame are still running. */
+int fb_busy()
+{
+    return use_dma && dma_busy();
+}
 
-    mbox[7] = MBOX_TAG_SETVIRTWH;
-    mbox[8] = 8;
-    mbox[9] = 8;
-    mbox[10] = 1920;
-    mbox[11] = 1080;
+/* Starts any copies queued for the DMA engine without waiting for them. */
+void fb_flush()
+{
+    if (use_dma) dma_start();
+}
 
-    mbox[12] = MBOX_TAG_SETVIRTOFF;
-    mbox[13] = 8;
-    mbox[14] = 8;
-    mbox[15] = 0; // Value(x)
-    mbox[16] = 0; // Value(y)
+/* Completion fence: returns once everything drawn so far is in the framebuffer. */
+void fb_sync()
+{
+    if (use_dma) dma_wait();
+}
 
-    mbox[17] = MBOX_TAG_SETDEPTH;
-    mbox[18] = 4;
-    mbox[19] = 4;
-    mbox[20] = 32; // Bits per pixel
+/* Pixel kernels. Each one walks h rows of w pixels, with dst advancing by dpitch bytes and src by sstride pixels
+ * per row, so the same code serves the framebuffer and offscreen surfaces. */
 
-    mbox[21] = MBOX_TAG_SETPXLORDR;
-    mbox[22] = 4;
-    mbox[23] = 4;
-    mbox[24] = 1; // RGB
+/* Straight copy. With NEON, rows are moved 16 pixels at a time. */
+static void copy_kernel(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h)
+{
+    while (h--) {
+        unsigned int *d = (unsigned int *) dst;
+        const unsigned int *s = src;
+        int n = w;
+#ifdef __ARM_NEON
+        for (; n >= 16; n -= 16, s += 16, d += 16) {
+            uint32x4_t a = vld1q_u32(s);
+            uint32x4_t b = vld1q_u32(s + 4);
+            uint32x4_t c = vld1q_u32(s + 8);
+            uint32x4_t e = vld1q_u32(s + 12);
+            vst1q_u32(d, a);
+            vst1q_u32(d + 4, b);
+            vst1q_u32(d + 8, c);
+            vst1q_u32(d + 12, e);
+        }
+        for (; n >= 4; n -= 4, s += 4, d += 4) vst1q_u32(d, vld1q_u32(s));
+#endif
+        while (n--) *d++ = *s++;
+        dst += dpitch;
+        src += sstride;
+    }
+}
 
-    mbox[25] = MBOX_TAG_GETFB;
-    mbox[26] = 8;
-    mbox[27] = 8;
-    mbox[28] = 4096; // FrameBufferInfo.pointer
-    mbox[29] = 0;    // FrameBufferInfo.size
+/* Copy that leaves pixels equal to key or with zero alpha untouched. With NEON, 4 pixels are tested at once and the
+ * destination is only read back when a group is partially transparent. */
+static void key_kernel(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h, unsigned int key)
+{
+#ifdef __ARM_NEON
+    uint32x4_t vkey = vdupq_n_u32(key);
+    uint32x4_t valpha = vdupq_n_u32(0xFF000000);
+#endif
 
-    mbox[30] = MBOX_TAG_GETPITCH;
-    mbox[31] = 4;
-    mbox[32] = 4;
-    mbox[33] = 0; // Bytes per line
+    while (h--) {
+        unsigned int *d = (unsigned int *) dst;
+        const unsigned int *s = src;
+        int n = w;
+#ifdef __ARM_NEON
+        for (; n >= 4; n -= 4, s += 4, d += 4) {
+            uint32x4_t p = vld1q_u32(s);
+            // All ones in every lane that should be skipped.
+            uint32x4_t skip = vorrq_u32(vceqq_u32(p, vkey), vceqzq_u32(vandq_u32(p, valpha)));
 
-    mbox[34] = MBOX_TAG_LAST;
+            if (vmaxvq_u32(skip) == 0) vst1q_u32(d, p);
+            else if (vminvq_u32(skip) == 0) vst1q_u32(d, vbslq_u32(skip, vld1q_u32(d), p));
+        }
+#endif
+        for (; n > 0; n--, s++, d++) {
+            if (*s != key && (*s & 0xFF000000)) *d = *s;
+        }
+        dst += dpitch;
+        src += sstride;
+    }
+}
+
+/* Blends one ARGB pixel over another using the source's alpha. The result is always opaque. */
+static unsigned int blend_pixel(unsigned int src, unsigned int dst)
+{
+    unsigned int a = src >> 24;
+    unsigned int out = 0xFF000000;
 
-    // Check call is successful and we have a pointer with depth 32
-    if (mbox_call(MBOX_CH_PROP) && mbox[20] == 32 && mbox[28] != 0) {
-        mbox[28] &= 0x3FFFFFFF; // Convert GPU address to ARM address
-        width = mbox[10];       // Actual physical width
-        height = mbox[11];      // Actual physical height
-        pitch = mbox[33];       // Number of bytes per line
-        isrgb = mbox[24];       // Pixel order
-        fb = (unsigned char *)((long)mbox[28]);
+    for (int shift = 0; shift < 24; shift += 8) {
+        unsigned int t = ((src >> shift) & 0xFF) * a + ((dst >> shift) & 0xFF) * (255 - a);
+        t = (t + ((t + 128) >> 8) + 128) >> 8; // t / 255, rounded
+        out |= t << shift;
     }
+    return out;
 }
 
+#ifdef __ARM_NEON
+/* Blends 8 pixels. They are split into channel planes with one load and blended together; groups that are fully
+ * opaque or fully transparent skip the destination read entirely. */
+static inline void alpha_8(unsigned int *d, const unsigned int *s)
+{
+    uint8x8x4_t sp = vld4_u8((const uint8_t *) s); // planes are B, G, R, A
+    uint8x8_t a = sp.val[3];
+
+    if (vmaxv_u8(a) == 0) return;
+    if (vminv_u8(a) == 255) {
+        vst1q_u32(d, vld1q_u32(s));
+        vst1q_u32(d + 4, vld1q_u32(s + 4));
+        return;
+    }
+
+    uint8x8x4_t dp = vld4_u8((const uint8_t *) d);
+    uint8x8_t ia = vmvn_u8(a);
+    for (int c = 0; c < 3; c++) {
+        uint16x8_t t = vmlal_u8(vmull_u8(sp.val[c], a), dp.val[c], ia);
+        dp.val[c] = vrshrn_n_u16(vrsraq_n_u16(t, t, 8), 8); // t / 255, rounded
+    }
+    dp.val[3] = vdup_n_u8(0xFF);
+    vst4_u8((uint8_t *) d, dp);
+}
+#endif
+
+/* Alpha blend over the destination. With NEON, 8 pixels are blended at a time. */
+static void alpha_kernel(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h)
+{
+    while (h--) {
+        unsigned int *d = (unsigned int *) dst;
+        const unsigned int *s = src;
+        int n = w;
+#ifdef __ARM_NEON
+        for (; n >= 8; n -= 8, s += 8, d += 8) alpha_8(d, s);
+#endif
+        for (; n > 0; n--, s++, d++) {
+            unsigned int a = *s >> 24;
+            if (a == 255) *d = *s;
+            else if (a) *d = blend_pixel(*s, *d);
+        }
+        dst += dpitch;
+        src += sstride;
+    }
+}
+
+/* Framebuffer formats below 32 bits. These kernels read ARGB like the ones above and convert each pixel as it is
+ * stored, so a 16 bit screen moves half the bytes and an 8 bit one a quarter. Blending reads the screen pixel back,
+ * widens it to ARGB, and blends as usual. */
+
+/* Converts an ARGB color to the framebuffer's format. */
+static unsigned int to_native(unsigned int argb)
+{
+    if (bytes_pp == 2) return ((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F);
+    if (bytes_pp == 1) return ((argb >> 16) & 0xE0) | ((argb >> 11) & 0x1C) | ((argb >> 6) & 0x03);
+    return argb;
+}
+
+/* Widens a framebuffer pixel back to opaque ARGB, repeating the top bits of each channel into the low ones. For 8 bits
+ * this is also the palette loaded by fb_init. */
+static unsigned int from_native(unsigned int c)
+{
+    unsigned int r, g, b;
+
+    if (bytes_pp == 2) {
+        r = (c >> 11) & 0x1F; r = (r << 3) | (r >> 2);
+        g = (c >> 5) & 0x3F;  g = (g << 2) | (g >> 4);
+        b = c & 0x1F;         b = (b << 3) | (b >> 2);
+    } else if (bytes_pp == 1) {
+        r = (c >> 5) & 7;     r = (r << 5) | (r << 2) | (r >> 1);
+        g = (c >> 2) & 7;     g = (g << 5) | (g << 2) | (g >> 1);
+        b = c & 3;            b *= 0x55;
+    } else {
+        return c;
+    }
+    return 0xFF000000 | (r << 16) | (g << 8) | b;
+}
+
+static void put_native(unsigned char *d, unsigned int c)
+{
+    if (bytes_pp == 2) *(unsigned short *) d = c;
+    else if (bytes_pp == 1) *d = c;
+    else *(unsigned int *) d = c;
+}
+
+static unsigned int get_native(const unsigned char *d)
+{
+    if (bytes_pp == 2) return *(const unsigned short *) d;
+    if (bytes_pp == 1) return *d;
+    return *(const unsigned int *) d;
+}
+
+#ifdef __ARM_NEON
+/* Packs 8 ARGB pixels, split into B, G, R, A planes by vld4_u8, to RGB565. */
+static uint16x8_t pack_565(uint8x8x4_t p)
+{
+    uint16x8_t v = vshll_n_u8(p.val[2], 8);
+    v = vsriq_n_u16(v, vshll_n_u8(p.val[1], 8), 5);
+    return vsriq_n_u16(v, vshll_n_u8(p.val[0], 8), 11);
+}
+
+/* Packs 8 ARGB pixels, split into planes, to 3-3-2 palette indices. */
+static uint8x8_t pack_332(uint8x8x4_t p)
+{
+    return vsri_n_u8(vsri_n_u8(p.val[2], p.val[1], 3), p.val[0], 6);
+}
+
+/* Stores 8 planar pixels in the framebuffer's format. */
+static void store_8(unsigned char *d, uint8x8x4_t p)
+{
+    if (bytes_pp == 2) vst1q_u16((uint16_t *) d, pack_565(p));
+    else vst1_u8(d, pack_332(p));
+}
+#endif
+
+/* Copy, converting to the framebuffer's format. */
+static void convert_kernel(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h)
+{
+    while (h--) {
+        unsigned char *d = dst;
+        const unsigned int *s = src;
+        int n = w;
+#ifdef __ARM_NEON
+        for (; n >= 8; n -= 8, s += 8, d += 8 * bytes_pp) store_8(d, vld4_u8((const uint8_t *) s));
+#endif
+        for (; n > 0; n--, s++, d += bytes_pp) put_native(d, to_native(*s));
+        dst += dpitch;
+        src += sstride;
+    }
+}
+
+/* Keyed copy, converting to the framebuffer's format. */
+static void convert_key_kernel(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h, unsigned int key)
+{
+    while (h--) {
+        unsigned char *d = dst;
+        const unsigned int *s = src;
+
+        for (int n = w; n > 0; n--, s++, d += bytes_pp) {
+            if (*s != key && (*s & 0xFF000000)) put_native(d, to_native(*s));
+        }
+        dst += dpitch;
+        src += sstride;
+    }
+}
+
+static void convert_alpha_pixel(unsigned char *d, unsigned int s)
+{
+    unsigned int a = s >> 24;
+
+    if (a == 255) put_native(d, to_native(s));
+    else if (a) put_native(d, to_native(blend_pixel(s, from_native(get_native(d)))));
+}
+
+/* Alpha blend, converting to the framebuffer's format. With NEON, groups of 8 that are fully opaque or transparent
+ * are stored or skipped together; only the edges of a sprite take the per pixel path. */
+static void convert_alpha_kernel(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h)
+{
+    while (h--) {
+        unsigned char *d = dst;
+        const unsigned int *s = src;
+        int n = w;
+#ifdef __ARM_NEON
+        for (; n >= 8; n -= 8, s += 8, d += 8 * bytes_pp) {
+            uint8x8x4_t sp = vld4_u8((const uint8_t *) s);
+            uint8x8_t a = sp.val[3];
+
+            if (vmaxv_u8(a) == 0) continue;
+            if (vminv_u8(a) == 255) {
+                store_8(d, sp);
+                continue;
+            }
+            for (int i = 0; i < 8; i++) convert_alpha_pixel(d + i * bytes_pp, s[i]);
+        }
+#endif
+        for (; n > 0; n--, s++, d += bytes_pp) convert_alpha_pixel(d, *s);
+        dst += dpitch;
+        src += sstride;
+    }
+}
+
+/* Entry points for drawing to the framebuffer, picking the kernels for its format. */
+static void store_copy(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h)
+{
+    if (bytes_pp == 4) copy_kernel(dst, dpitch, src, sstride, w, h);
+    else convert_kernel(dst, dpitch, src, sstride, w, h);
+}
+
+static void store_key(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h, unsigned int key)
+{
+    if (bytes_pp == 4) key_kernel(dst, dpitch, src, sstride, w, h, key);
+    else convert_key_kernel(dst, dpitch, src, sstride, w, h, key);
+}
+
+static void store_alpha(unsigned char *dst, int dpitch, const unsigned int *src, int sstride, int w, int h)
+{
+    if (bytes_pp == 4) alpha_kernel(dst, dpitch, src, sstride, w, h);
+    else convert_alpha_kernel(dst, dpitch, src, sstride, w, h);
+}
+
+/* Solid fills. Once caches are on, black spans are zeroed a cache block at a time with DC ZVA, which allocates the
+ * lines without reading them first. It faults on device memory, so it stays off until fb_enable_zva is called. */
+#ifdef __aarch64__
+static int zva_enabled = 0;
+static unsigned int zva_size = 0; // Bytes zeroed by one DC ZVA.
+#endif
+
+/* Enables DC ZVA fills, if the CPU allows them. Only call this once the MMU maps the framebuffer as normal memory. */
+void fb_enable_zva()
+{
+#ifdef __aarch64__
+    unsigned long dczid;
+
+    asm volatile ("mrs %0, dczid_el0" : "=r" (dczid));
+    if (dczid & 16) return; // DZP set, DC ZVA is prohibited.
+
+    zva_size = 4 << (dczid & 15);
+    zva_enabled = 1;
+#endif
+}
+
+/* Fills n pixels of size bytes each with color, which is already in that format. */
+static void fill_span(unsigned char *d, int n, unsigned int color, int size)
+{
+    unsigned int bytes = n * size;
+
+#ifdef __aarch64__
+    if (color == 0 && zva_enabled && bytes >= 2 * zva_size) {
+        // Zero up to a block boundary by hand, then a whole block per instruction.
+        while ((unsigned long) d & (zva_size - 1)) {
+            *d++ = 0;
+            bytes--;
+        }
+        for (; bytes >= zva_size; bytes -= zva_size, d += zva_size) {
+            asm volatile ("dc zva, %0" : : "r" (d) : "memory");
+        }
+    }
+#endif
+    // Repeat the color across a word. Spans start on a pixel, so the pattern lines up wherever it is stored.
+    if (size == 2) color = (color & 0xFFFF) * 0x10001;
+    else if (size == 1) color = (color & 0xFF) * 0x01010101;
+
+#ifdef __ARM_NEON
+    uint8x16_t v = vreinterpretq_u8_u32(vdupq_n_u32(color));
+    for (; bytes >= 64; bytes -= 64, d += 64) {
+        vst1q_u8(d, v);
+        vst1q_u8(d + 16, v);
+        vst1q_u8(d + 32, v);
+        vst1q_u8(d + 48, v);
+    }
+    for (; bytes >= 16; bytes -= 16, d += 16) vst1q_u8(d, v);
+#endif
+    for (; bytes >= 4 && !((unsigned long) d & 3); bytes -= 4, d += 4) *(unsigned int *) d = color;
+    for (int i = 0; bytes > 0; bytes--, i++) *d++ = color >> (8 * (i & 3));
+}
+
+/* Fills h rows of w pixels. Rows that run edge to edge are contiguous, so they are filled as one span. */
+static void fill_kernel(unsigned char *dst, int dpitch, unsigned int color, int w, int h, int size)
+{
+    if (dpitch == w * size) {
+        fill_span(dst, w * h, color, size);
+        return;
+    }
+    while (h--) {
+        fill_span(dst, w, color, size);
+        dst += dpitch;
+    }
+}
+
+/* Fills a rectangle of the back buffer with an ARGB color, clipped to the screen, without recording damage. */
+static void fill_rect(int x, int y, int w, int h, unsigned int color)
+{
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > (int)width) w = width - x;
+    if (y + h > (int)height) h = height - y;
+    if (w <= 0 || h <= 0) return;
+
+    fill_kernel(fb + y * pitch + x * bytes_pp, pitch, to_native(color), w, h, bytes_pp);
+}
+
+/* Copies a rectangle between two buffers with the framebuffer's pitch. Pixels are moved as raw bytes, whatever the
+ * format. */
+static void copy_rect(unsigned char *dst, const unsigned char *src, int x, int y, int w, int h)
+{
+    int offs = y * pitch + x * bytes_pp;
+    int bytes = w * bytes_pp;
+
+    dst += offs;
+    src += offs;
+    while (h--) {
+        unsigned char *d = dst;
+        const unsigned char *s = src;
+        int n = bytes;
+#ifdef __ARM_NEON
+        for (; n >= 64; n -= 64, s += 64, d += 64) {
+            uint8x16_t a = vld1q_u8(s);
+            uint8x16_t b = vld1q_u8(s + 16);
+            uint8x16_t c = vld1q_u8(s + 32);
+            uint8x16_t e = vld1q_u8(s + 48);
+            vst1q_u8(d, a);
+            vst1q_u8(d + 16, b);
+            vst1q_u8(d + 32, c);
+            vst1q_u8(d + 48, e);
+        }
+        for (; n >= 16; n -= 16, s += 16, d += 16) vst1q_u8(d, vld1q_u8(s));
+#endif
+        for (; n >= 4 && !(((unsigned long) d | (unsigned long) s) & 3); n -= 4, s += 4, d += 4) {
+            *(unsigned int *) d = *(const unsigned int *) s;
+        }
+        while (n--) *d++ = *s++;
+        dst += pitch;
+        src += pitch;
+    }
+}
+
+/* Shows everything drawn since the last call. Waits for vertical sync, then flips the display to the back buffer
+ * by moving the virtual offset. Drawing then continues in the other page, which is first brought up to date with
+ * the areas that changed. Does nothing without double buffering, where drawing goes straight to the screen. */
+void fb_present()
+{
+    if (fb_pages < 2) return;
+    fb_sync();
+
+    int back = 1 - fb_front;
+
+    hal_fb_show(back);
+
+    fb_front = back;
+    unsigned char *front = fb;
+    fb = fb_base + (1 - fb_front) * height * pitch;
+
+    // The copy forward is left running on the DMA engine, if it's on, while the game gets on with the next frame.
+    for (int c = 0; c < SMP_CORES; c++) {
+        for (int i = 0; i < num_damage[c]; i++) {
+            struct rect *r = &damage[c][i];
+            int offs = r->y * pitch + r->x * bytes_pp;
+
+            if (!use_dma || !dma_copy_2d(fb + offs, pitch, front + offs, pitch, r->w * bytes_pp, r->h))
+                copy_rect(fb, front, r->x, r->y, r->w, r->h);
+        }
+        num_damage[c] = 0;
+    }
+    fb_flush();
+}
+
+/* Does not record damage, callers drawing with it directly must call fb_damage. */
 void drawPixel(int x, int y, unsigned char attr)
 {
-    int offs = (y * pitch) + (x * 4);
-    *((unsigned int*)(fb + offs)) = vgapal[attr & 0x0f];
+    put_native(fb + y * pitch + x * bytes_pp, to_native(vgapal[attr & 0x0f]));
 }
 
 void myDrawPixel(int x, int y, int argb_color) {
-    int offs = (y * pitch) + (x * 4);
-    *((unsigned int*)(fb + offs)) = argb_color;
+    put_native(fb + y * pitch + x * bytes_pp, to_native(argb_color));
+}
+
+/* Fills a rectangle of the screen with an ARGB color. */
+void fb_fill_rect(int x, int y, int w, int h, unsigned int color)
+{
+    fb_damage(x, y, w, h);
+    fill_rect(x, y, w, h, color);
 }
 
 void drawRect(int x1, int y1, int x2, int y2, unsigned char attr, int fill)
 {
-    int y=y1;
+    int w = x2 - x1 + 1;
+    int h = y2 - y1 + 1;
+    unsigned int border = vgapal[attr & 0x0f];
 
-    while (y <= y2) {
-       int x=x1;
-       while (x <= x2) {
-	  if ((x == x1 || x == x2) || (y == y1 || y == y2)) drawPixel(x, y, attr);
-	  else if (fill) drawPixel(x, y, (attr & 0xf0) >> 4);
-          x++;
-       }
-       y++;
-    }
+    if (w <= 0 || h <= 0) return;
+
+    fb_damage(x1, y1, w, h);
+    if (fill && w > 2 && h > 2) fill_rect(x1 + 1, y1 + 1, w - 2, h - 2, vgapal[(attr & 0xf0) >> 4]);
+    fill_rect(x1, y1, w, 1, border);
+    fill_rect(x1, y2, w, 1, border);
+    fill_rect(x1, y1, 1, h, border);
+    fill_rect(x2, y1, 1, h, border);
 }
 
 void drawLine(int x1, int y1, int x2, int y2, unsigned char attr)  
@@ -98,6 +637,8 @@ void drawLine(int x1, int y1, int x2, int y2, unsigned char attr)
     y = y1;
     p = 2*dy-dx;
 
+    fb_damage(x1, y1, dx + 1, dy + 1);
+
     while (x<x2) {
        if (p >= 0) {
           drawPixel(x,y,attr);
@@ -116,7 +657,8 @@ void drawCircle(int x0, int y0, int radius, unsigned char attr, int fill)
     int x = radius;
     int y = 0;
     int err = 0;
- 
+
+    fb_damage(x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1);
     while (x >= y) {
 	if (fill) {
 	   drawLine(x0 - y, y0 + x, x0 + y, y0 + x, (attr & 0xf0) >> 4);
@@ -145,45 +687,469 @@ void drawCircle(int x0, int y0, int radius, unsigned char attr, int fill)
     }
 }
 
-void drawChar(unsigned char ch, int x, int y, unsigned char attr)
+/* A line of ARGB pixels for drawing that has to be prepared before it is stored: mirrored spans, and text or images
+ * headed for a framebuffer that isn't 32 bits. Each core has its own. */
+#define SCRATCH_MAX 2048
+
+static unsigned int scratch_line[SMP_CORES][SCRATCH_MAX];
+
+/* Glyph cache. Each slot holds the whole font expanded to 32bpp for one foreground/background attribute, so text
+ * is drawn with row copies instead of a bit test and palette lookup per pixel. */
+#define GLYPH_SLOTS 4
+#define GLYPH_PIXELS (FONT_WIDTH * FONT_HEIGHT)
+
+static unsigned int glyph_cache[GLYPH_SLOTS][FONT_NUMGLYPHS * GLYPH_PIXELS];
+static int glyph_attr[GLYPH_SLOTS] = { -1, -1, -1, -1 };
+static int glyph_next = 0; // Slot reused when an attribute isn't cached yet.
+
+/* Returns the expanded font for attr, expanding it into the oldest slot if it isn't cached. */
+static const unsigned int *glyph_slot(unsigned char attr)
 {
-    unsigned char *glyph = (unsigned char *)&font + (ch < FONT_NUMGLYPHS ? ch : 0) * FONT_BPG;
+    for (int i = 0; i < GLYPH_SLOTS; i++) {
+        if (glyph_attr[i] == attr) return glyph_cache[i];
+    }
 
-    for (int i=0;i<FONT_HEIGHT;i++) {
-	for (int j=0;j<FONT_WIDTH;j++) {
-	    unsigned char mask = 1 << j;
-	    unsigned char col = (*glyph & mask) ? attr & 0x0f : (attr & 0xf0) >> 4;
+    int slot = glyph_next;
+    unsigned int fg = vgapal[attr & 0x0f];
+    unsigned int bg = vgapal[(attr & 0xf0) >> 4];
+    unsigned int *p = glyph_cache[slot];
 
-	    drawPixel(x+j, y+i, col);
-	}
-	glyph += FONT_BPL;
+    for (int ch = 0; ch < FONT_NUMGLYPHS; ch++) {
+        for (int i = 0; i < FONT_HEIGHT; i++) {
+            unsigned char bits = font[ch][i * FONT_BPL];
+            for (int j = 0; j < FONT_WIDTH; j++) *p++ = (bits & (1 << j)) ? fg : bg;
+        }
+    }
+
+    glyph_attr[slot] = attr;
+    glyph_next = (slot + 1) % GLYPH_SLOTS;
+    return glyph_cache[slot];
+}
+
+static const unsigned int *glyph(const unsigned int *slot, unsigned char ch)
+{
+    return slot + (ch < FONT_NUMGLYPHS ? ch : 0) * GLYPH_PIXELS;
+}
+
+/* Writes row i of n characters to d. */
+static void glyph_row(unsigned int *d, const unsigned int *slot, const char *s, int n, int i)
+{
+    for (int c = 0; c < n; c++, d += FONT_WIDTH) {
+        const unsigned int *g = glyph(slot, s[c]) + i * FONT_WIDTH;
+#ifdef __ARM_NEON
+        vst1q_u32(d, vld1q_u32(g));
+        vst1q_u32(d + 4, vld1q_u32(g + 4));
+#else
+        for (int j = 0; j < FONT_WIDTH; j++) d[j] = g[j];
+#endif
+    }
+}
+
+/* Draws n characters on one line of a pitch-wide buffer with size bytes per pixel. Each glyph row is written across
+ * the whole run before moving down, so the stores for a line of text stay contiguous. Below 32 bits a row is built in
+ * the scratch line and converted on the way out. */
+static void glyph_run(unsigned char *dst, int dpitch, int size, const char *s, int n, unsigned char attr)
+{
+    const unsigned int *slot = glyph_slot(attr);
+    const int max = SCRATCH_MAX / FONT_WIDTH;
+    unsigned int *scratch = scratch_line[smp_core()];
+
+    for (int i = 0; i < FONT_HEIGHT; i++, dst += dpitch) {
+        if (size == 4) {
+            glyph_row((unsigned int *) dst, slot, s, n, i);
+            continue;
+        }
+        for (int c = 0; c < n; c += max) {
+            int m = n - c < max ? n - c : max;
+            glyph_row(scratch, slot, s + c, m, i);
+            convert_kernel(dst + c * FONT_WIDTH * size, dpitch, scratch, 0, m * FONT_WIDTH, 1);
+        }
     }
 }
 
+void drawChar(unsigned char ch, int x, int y, unsigned char attr)
+{
+    fb_damage(x, y, FONT_WIDTH, FONT_HEIGHT);
+    store_copy(fb + y * pitch + x * bytes_pp, pitch, glyph(glyph_slot(attr), ch), FONT_WIDTH, FONT_WIDTH, FONT_HEIGHT);
+}
+
 void drawString(int x, int y, char *s, unsigned char attr)
 {
     while (*s) {
        if (*s == '\r') {
           x = 0;
+          s++;
        } else if(*s == '\n') {
           x = 0; y += FONT_HEIGHT;
+          s++;
        } else {
-	  drawChar(*s, x, y, attr);
-          x += FONT_WIDTH;
+          // Draw everything up to the next line break in one pass.
+          int n = 0;
+          while (s[n] && s[n] != '\r' && s[n] != '\n') n++;
+
+          fb_damage(x, y, n * FONT_WIDTH, FONT_HEIGHT);
+          glyph_run(fb + y * pitch + x * bytes_pp, pitch, bytes_pp, s, n, attr);
+          x += n * FONT_WIDTH;
+          s += n;
        }
-       s++;
     }
 }
 
+/* Rasterizes a single line of text into a surface, which must be at least strlen(s) * 8 by 8 pixels. Used for labels
+ * that are drawn every frame, which can then go to the screen with fb_copy_surface. */
+void fb_render_label(struct surface *label, char *s, unsigned char attr)
+{
+    int n = 0;
+    while (s[n]) n++;
+
+    glyph_run((unsigned char *) label->pixels, label->width * 4, 4, s, n, attr);
+}
+
 /* FOR GIMP EXPORTED C SOURCE FILES this method handles it: it takes a pixel and converts rgba to argb*/
 void myDrawImage(unsigned char * img, int width, int height, int offx, int offy) {
-    int * img_buff = (int *) img; // each pixel is 4 bites. So should offset by 4bytes in indexing and fetch 4 bytes in accessing value casting to (int *) would be ideal.
-    for (int i = 0; i < width; i++) for (int j = 0; j < height; j++) {
-        int x = i+offx;
-        int y = j+offy;
-        int rgba_color = img_buff[width*j + i];
-        int argb_color = __builtin_bswap32(rgba_color); // match endianness by reversing lower 32 bits
-        argb_color = (argb_color << 24) | (argb_color >> 8); // rgba argb
-        myDrawPixel(x,y,argb_color);
+    unsigned int *src = (unsigned int *) img;
+    unsigned char *row = fb + offy * pitch + offx * bytes_pp;
+    unsigned int *scratch = scratch_line[smp_core()];
+
+    if (bytes_pp != 4 && width > SCRATCH_MAX) return;
+    fb_damage(offx, offy, width, height);
+
+    // Walk the image a row at a time so consecutive writes land next to each other in the framebuffer.
+    for (int j = 0; j < height; j++) {
+        unsigned int *dst = bytes_pp == 4 ? (unsigned int *) row : scratch;
+        for (int i = 0; i < width; i++) {
+            unsigned int rgba = *src++; // bytes R G B A, read little endian as 0xAABBGGRR
+            dst[i] = (rgba & 0xFF00FF00) | ((rgba & 0xFF) << 16) | ((rgba >> 16) & 0xFF);
+        }
+        if (bytes_pp != 4) convert_kernel(row, pitch, scratch, width, width, 1);
+        row += pitch;
+    }
+}
+
+/* Converts a GIMP RGBA image to the framebuffer's ARGB order in place. Done once per sprite at boot
+ * so that fb_blit can copy pixels straight through. */
+void fb_swizzle(unsigned char *img, int width, int height)
+{
+    unsigned int *p = (unsigned int *) img;
+    unsigned int *end = p + width * height;
+
+    while (p < end) {
+        unsigned int rgba = *p;
+        *p++ = (rgba & 0xFF00FF00) | ((rgba & 0xFF) << 16) | ((rgba >> 16) & 0xFF);
+    }
+}
+
+/* Draws an image that is already in framebuffer ARGB order (see fb_swizzle) with its top left corner at (offx, offy).
+ * The hot loop is a single store per pixel, with the destination advanced by pointer increments. */
+void fb_blit(const unsigned int *img, int width, int height, int offx, int offy)
+{
+    fb_damage(offx, offy, width, height);
+    store_copy(fb + offy * pitch + offx * bytes_pp, pitch, img, width, width, height);
+}
+
+/* Like fb_blit, but pixels equal to key or with zero alpha are left untouched, so whatever is already on screen
+ * shows through. */
+void fb_blit_key(const unsigned int *img, int width, int height, int offx, int offy, unsigned int key)
+{
+    fb_damage(offx, offy, width, height);
+    store_key(fb + offy * pitch + offx * bytes_pp, pitch, img, width, width, height, key);
+}
+
+/* Like fb_blit, but each pixel is alpha blended over what is already on screen. */
+void fb_blit_alpha(const unsigned int *img, int width, int height, int offx, int offy)
+{
+    fb_damage(offx, offy, width, height);
+    store_alpha(fb + offy * pitch + offx * bytes_pp, pitch, img, width, width, height);
+}
+
+/* Span-encoded sprites, as generated by tools/mkatlas.py. Each row is a count of spans, and each span a header word
+ * (skip << 16 | length << 1 | blend) followed by its pixels. Transparent pixels are never read or written. */
+static void reverse_row(unsigned int *d, const unsigned int *s, int n)
+{
+    const unsigned int *end = s + n;
+#ifdef __ARM_NEON
+    for (; n >= 4; n -= 4, d += 4) {
+        end -= 4;
+        uint32x4_t v = vrev64q_u32(vld1q_u32(end));
+        vst1q_u32(d, vcombine_u32(vget_high_u32(v), vget_low_u32(v)));
+    }
+#endif
+    while (n--) *d++ = *--end;
+}
+
+/* Draws one row of a span-encoded sprite of the given width into a buffer row, with the sprite's left edge at offx and
+ * only pixels 0 to clipw - 1 of the row written. Goes to the framebuffer if to_fb is set and to a 32 bit surface
+ * otherwise. Returns the start of the next row. */
+static const unsigned int *span_row(unsigned char *row, int offx, int clipw, const unsigned int *spans, int width, int mirrored, int to_fb)
+{
+    int size = to_fb ? bytes_pp : 4;
+    unsigned int *scratch = scratch_line[smp_core()];
+    int n = *spans++;
+    int x = 0;
+
+    while (n--) {
+        unsigned int header = *spans++;
+        int len = (header >> 1) & 0x7FFF;
+        const unsigned int *src = spans;
+        int dx;
+
+        x += header >> 16;
+        dx = x;
+        if (mirrored && len <= SCRATCH_MAX) {
+            reverse_row(scratch, spans, len);
+            src = scratch;
+            dx = width - x - len;
+        }
+        spans += len;
+        x += len;
+
+        // Clip the span to the row.
+        int a = offx + dx;
+        int b = a + len;
+        if (a < 0) a = 0;
+        if (b > clipw) b = clipw;
+        if (a >= b) continue;
+        src += a - offx - dx;
+
+        if (to_fb) {
+            if (header & 1) store_alpha(row + a * size, 0, src, b - a, b - a, 1);
+            else store_copy(row + a * size, 0, src, b - a, b - a, 1);
+        } else {
+            if (header & 1) alpha_kernel(row + a * size, 0, src, b - a, b - a, 1);
+            else copy_kernel(row + a * size, 0, src, b - a, b - a, 1);
+        }
+    }
+    return spans;
+}
+
+/* Returns the start of the row after this one without drawing anything. */
+static const unsigned int *span_skip(const unsigned int *spans)
+{
+    int n = *spans++;
+
+    while (n--) spans += 1 + ((*spans >> 1) & 0x7FFF);
+    return spans;
+}
+
+/* Draws a span-encoded sprite. With mirrored set it is flipped left to right, each span being reversed into a scratch
+ * line on the way. */
+void fb_blit_spans(const unsigned int *spans, int width, int height, int offx, int offy, int mirrored)
+{
+    unsigned char *row = fb + offy * pitch;
+
+    fb_damage(offx, offy, width, height);
+    for (int i = 0; i < height; i++, row += pitch) spans = span_row(row, offx, width + offx, spans, width, mirrored, 1);
+}
+
+/* Draws the next row of a span-encoded sprite into row offy of a surface, with the sprite's left edge at offx. Returns
+ * the start of the following row, so a sprite can be drawn a row at a time in step with other drawing. */
+const unsigned int *surface_span_row(struct surface *s, const unsigned int *spans, int width, int offx, int offy, int mirrored)
+{
+    return span_row((unsigned char *)(s->pixels + offy * s->width), offx, s->width, spans, width, mirrored, 0);
+}
+
+/* Draws a whole span-encoded sprite onto a surface, clipped to its edges. */
+void surface_blit_spans(struct surface *s, const unsigned int *spans, int width, int height, int offx, int offy, int mirrored)
+{
+    for (int i = 0; i < height; i++) {
+        int y = offy + i;
+
+        if (y < 0 || y >= s->height) spans = span_skip(spans);
+        else spans = span_row((unsigned char *)(s->pixels + y * s->width), offx, s->width, spans, width, mirrored, 0);
     }
 }
+
+/* Clips an image placed at (*offx, *offy) to a surface. Returns 0 if nothing is left, otherwise adjusts the position,
+ * size and image pointer to the visible part. */
+static int clip_to_surface(struct surface *s, const unsigned int **img, int stride, int *width, int *height, int *offx, int *offy)
+{
+    if (*offx < 0) { *img -= *offx; *width += *offx; *offx = 0; }
+    if (*offy < 0) { *img -= *offy * stride; *height += *offy; *offy = 0; }
+    if (*offx + *width > s->width) *width = s->width - *offx;
+    if (*offy + *height > s->height) *height = s->height - *offy;
+    return *width > 0 && *height > 0;
+}
+
+/* Draws an ARGB image onto an offscreen surface, clipped to its edges. */
+void surface_blit(struct surface *s, const unsigned int *img, int width, int height, int offx, int offy)
+{
+    int stride = width;
+
+    if (!clip_to_surface(s, &img, stride, &width, &height, &offx, &offy)) return;
+    copy_kernel((unsigned char *)(s->pixels + offy * s->width + offx), s->width * 4, img, stride, width, height);
+}
+
+/* Alpha blends an ARGB image onto an offscreen surface, clipped to its edges. */
+void surface_blit_alpha(struct surface *s, const unsigned int *img, int width, int height, int offx, int offy)
+{
+    int stride = width;
+
+    if (!clip_to_surface(s, &img, stride, &width, &height, &offx, &offy)) return;
+    alpha_kernel((unsigned char *)(s->pixels + offy * s->width + offx), s->width * 4, img, stride, width, height);
+}
+
+/* Draws an ARGB image onto an offscreen surface, leaving pixels equal to key or with zero alpha out. */
+void surface_blit_key(struct surface *s, const unsigned int *img, int width, int height, int offx, int offy, unsigned int key)
+{
+    int stride = width;
+
+    if (!clip_to_surface(s, &img, stride, &width, &height, &offx, &offy)) return;
+    key_kernel((unsigned char *)(s->pixels + offy * s->width + offx), s->width * 4, img, stride, width, height, key);
+}
+
+/* Copies a width x height block of surface src, starting at (sx, sy), into dst at (offx, offy), clipped to dst. */
+void surface_copy(struct surface *dst, struct surface *src, int sx, int sy, int width, int height, int offx, int offy)
+{
+    const unsigned int *img = src->pixels + sy * src->width + sx;
+
+    if (!clip_to_surface(dst, &img, src->width, &width, &height, &offx, &offy)) return;
+    copy_kernel((unsigned char *)(dst->pixels + offy * dst->width + offx), dst->width * 4, img, src->width, width, height);
+}
+
+/* Fills a rectangle of an offscreen surface with an ARGB color, clipped to its edges. */
+void surface_fill(struct surface *s, int x, int y, int width, int height, unsigned int color)
+{
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if (x + width > s->width) width = s->width - x;
+    if (y + height > s->height) height = s->height - y;
+    if (width <= 0 || height <= 0) return;
+
+    fill_kernel((unsigned char *)(s->pixels + y * s->width + x), s->width * 4, color, width, height, 4);
+}
+
+/* Returns 1 and sets *color if every pixel of an image is the same, so it can be drawn as a fill. */
+int fb_solid_color(const unsigned int *img, int width, int height, unsigned int *color)
+{
+    int n = width * height;
+
+    for (int i = 1; i < n; i++) {
+        if (img[i] != img[0]) return 0;
+    }
+    *color = img[0];
+    return 1;
+}
+
+/* Copies a width x height block of a surface, starting at (sx, sy), to the screen at (offx, offy). */
+void fb_copy_surface(struct surface *s, int sx, int sy, int width, int height, int offx, int offy)
+{
+    fb_damage(offx, offy, width, height);
+    store_copy(fb + offy * pitch + offx * bytes_pp, pitch, s->pixels + sy * s->width + sx, s->width, width, height);
+}
+
+/* Like fb_copy_surface, for blocks composed in a small cached buffer that won't be read again. At 32 bits the rows go
+ * out with non-temporal STNP stores, so they stream to memory without pulling framebuffer lines into the cache or
+ * evicting the buffer. */
+void fb_stream_surface(struct surface *s, int sx, int sy, int width, int height, int offx, int offy)
+{
+#ifdef __aarch64__
+    if (bytes_pp == 4) {
+        unsigned char *dst = fb + offy * pitch + offx * 4;
+        const unsigned int *src = s->pixels + sy * s->width + sx;
+
+        fb_damage(offx, offy, width, height);
+        for (int j = 0; j < height; j++, dst += pitch, src += s->width) {
+            unsigned int *d = (unsigned int *) dst;
+            const unsigned int *p = src;
+            int n = width;
+
+            // Both sides must be 16 byte aligned, as either may still be device memory.
+            for (; n > 0 && ((unsigned long) d & 15); n--) *d++ = *p++;
+            for (; n >= 8 && !((unsigned long) p & 15); n -= 8, d += 8, p += 8) {
+                asm volatile ("ldp q0, q1, [%1]\n\tstnp q0, q1, [%0]" : : "r" (d), "r" (p) : "v0", "v1", "memory");
+            }
+            while (n--) *d++ = *p++;
+        }
+        return;
+    }
+#endif
+    fb_copy_surface(s, sx, sy, width, height, offx, offy);
+}
+
+/* Cell grid. Every tile and sprite in the game is FB_CELL pixels square and sits on a fixed grid, so the offset of
+ * each cell in a page is worked out once and the blitters below are built for that one size. */
+#define GRID_MAX (25 * 25)
+
+static unsigned int grid_offset[GRID_MAX]; // Byte offset of each cell's top left pixel from the start of a page.
+static short grid_x[GRID_MAX];
+static short grid_y[GRID_MAX];
+
+/* Builds the cell table for a cols x rows grid starting at (left, top). Call it again if fb_init is. */
+void fb_set_grid(int left, int top, int cell_width, int cell_height, int cols, int rows)
+{
+    for (int i = 0; i < cols * rows && i < GRID_MAX; i++) {
+        grid_x[i] = left + (i % cols) * cell_width;
+        grid_y[i] = top + (i / cols) * cell_height;
+        grid_offset[i] = grid_y[i] * pitch + grid_x[i] * bytes_pp;
+    }
+}
+
+/* Copies an FB_CELL square block at 32 bits. Each row is eight NEON loads and stores with no loop. */
+static void cell_copy_kernel(unsigned char *dst, const unsigned int *src, int sstride)
+{
+    for (int j = 0; j < FB_CELL; j++, dst += pitch, src += sstride) {
+        unsigned int *d = (unsigned int *) dst;
+#ifdef __ARM_NEON
+        uint32x4_t p0 = vld1q_u32(src);
+        uint32x4_t p1 = vld1q_u32(src + 4);
+        uint32x4_t p2 = vld1q_u32(src + 8);
+        uint32x4_t p3 = vld1q_u32(src + 12);
+        uint32x4_t p4 = vld1q_u32(src + 16);
+        uint32x4_t p5 = vld1q_u32(src + 20);
+        uint32x4_t p6 = vld1q_u32(src + 24);
+        uint32x4_t p7 = vld1q_u32(src + 28);
+        vst1q_u32(d, p0);
+        vst1q_u32(d + 4, p1);
+        vst1q_u32(d + 8, p2);
+        vst1q_u32(d + 12, p3);
+        vst1q_u32(d + 16, p4);
+        vst1q_u32(d + 20, p5);
+        vst1q_u32(d + 24, p6);
+        vst1q_u32(d + 28, p7);
+#else
+        for (int i = 0; i < FB_CELL; i++) d[i] = src[i];
+#endif
+    }
+}
+
+/* Alpha blends an FB_CELL square sprite at 32 bits, four groups of 8 per row with no loop. */
+static void cell_alpha_kernel(unsigned char *dst, const unsigned int *src)
+{
+    for (int j = 0; j < FB_CELL; j++, dst += pitch, src += FB_CELL) {
+#ifdef __ARM_NEON
+        unsigned int *d = (unsigned int *) dst;
+        alpha_8(d, src);
+        alpha_8(d + 8, src + 8);
+        alpha_8(d + 16, src + 16);
+        alpha_8(d + 24, src + 24);
+#else
+        alpha_kernel(dst, pitch, src, FB_CELL, FB_CELL, 1);
+#endif
+    }
+}
+
+/* Copies an FB_CELL square block of pixels, rows stride pixels apart, to a cell. With DMA on, at 32 bits, the copy is
+ * only queued, so the pixels must already be in memory (see dcache_clean) and stay unchanged until fb_sync. */
+void fb_cell_copy(int cell, const unsigned int *img, int stride)
+{
+    unsigned char *dst = fb + grid_offset[cell];
+
+    if (use_dma && bytes_pp == 4 && dma_copy_2d(dst, pitch, img, stride * 4, FB_CELL * 4, FB_CELL)) {
+        add_damage(grid_x[cell], grid_y[cell], FB_CELL, FB_CELL);
+        return;
+    }
+
+    fb_damage(grid_x[cell], grid_y[cell], FB_CELL, FB_CELL);
+    if (bytes_pp == 4) cell_copy_kernel(dst, img, stride);
+    else convert_kernel(dst, pitch, img, stride, FB_CELL, FB_CELL);
+}
+
+/* Alpha blends an FB_CELL square ARGB sprite over a cell. */
+void fb_cell_blend(int cell, const unsigned int *img)
+{
+    unsigned char *dst = fb + grid_offset[cell];
+
+    fb_damage(grid_x[cell], grid_y[cell], FB_CELL, FB_CELL);
+    if (bytes_pp == 4) cell_alpha_kernel(dst, img);
+    else convert_alpha_kernel(dst, pitch, img, FB_CELL, FB_CELL, FB_CELL);
+}
@@ -1,7 +1,51 @@
-void fb_init();
+#ifndef FB_H
+#define FB_H
+
+// An offscreen image in framebuffer (ARGB) order, kept in normal RAM.
+struct surface
+{
+    unsigned int *pixels;
+    int width;
+    int height;
+};
+
+#define FB_CELL 32 // Size of the square sprites drawn by fb_cell_copy and fb_cell_blend.
+
+void fb_init(int w, int h, int bpp);
+void fb_present();
+void fb_region(unsigned long *start, unsigned long *size);
+void fb_damage(int x, int y, int w, int h);
+void fb_enable_zva();
+void fb_use_dma(int on);
+int fb_busy();
+void fb_flush();
+void fb_sync();
+void fb_fill_rect(int x, int y, int w, int h, unsigned int color);
 void drawPixel(int x, int y, unsigned char attr);
 void drawChar(unsigned char ch, int x, int y, unsigned char attr);
 void drawString(int x, int y, char *s, unsigned char attr);
 void drawRect(int x1, int y1, int x2, int y2, unsigned char attr, int fill);
 void drawCircle(int x0, int y0, int radius, unsigned char attr, int fill);
 void drawLine(int x1, int y1, int x2, int y2, unsigned char attr);
+void myDrawImage(unsigned char *img, int width, int height, int offx, int offy);
+void fb_swizzle(unsigned char *img, int width, int height);
+void fb_blit(const unsigned int *img, int width, int height, int offx, int offy);
+void fb_blit_key(const unsigned int *img, int width, int height, int offx, int offy, unsigned int key);
+void fb_blit_alpha(const unsigned int *img, int width, int height, int offx, int offy);
+void fb_blit_spans(const unsigned int *spans, int width, int height, int offx, int offy, int mirrored);
+void surface_blit(struct surface *s, const unsigned int *img, int width, int height, int offx, int offy);
+void surface_blit_alpha(struct surface *s, const unsigned int *img, int width, int height, int offx, int offy);
+void surface_blit_key(struct surface *s, const unsigned int *img, int width, int height, int offx, int offy, unsigned int key);
+void surface_blit_spans(struct surface *s, const unsigned int *spans, int width, int height, int offx, int offy, int mirrored);
+void surface_copy(struct surface *dst, struct surface *src, int sx, int sy, int width, int height, int offx, int offy);
+const unsigned int *surface_span_row(struct surface *s, const unsigned int *spans, int width, int offx, int offy, int mirrored);
+void surface_fill(struct surface *s, int x, int y, int width, int height, unsigned int color);
+int fb_solid_color(const unsigned int *img, int width, int height, unsigned int *color);
+void fb_render_label(struct surface *label, char *s, unsigned char attr);
+void fb_copy_surface(struct surface *s, int sx, int sy, int width, int height, int offx, int offy);
+void fb_stream_surface(struct surface *s, int sx, int sy, int width, int height, int offx, int offy);
+void fb_set_grid(int left, int top, int cell_width, int cell_height, int cols, int rows);
+void fb_cell_copy(int cell, const unsigned int *img, int stride);
+void fb_cell_blend(int cell, const unsigned int *img);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef HAL_H
+#define HAL_H
+
+// Platform layer: everything the game needs from the machine it runs on. hal_rpi4.c drives the Raspberry Pi 4 and is
+// built into the kernel; host/hal_host.c stands in for it in the headless simulator (make sim).
+
+#define HAL_BUTTONS 16 // Controller buttons, in SNES shift register order: B, Y, Select, Start, Up, Down, Left, Right, A...
+
+// A framebuffer as handed out by the platform.
+struct hal_fb
+{
+    unsigned char *base; // First page. Pages follow each other height * pitch bytes apart.
+    unsigned long bytes; // Size of all pages, or 0 if not known.
+    unsigned int width, height, pitch, depth, isrgb;
+    int pages;           // 2 if there is room for a back buffer, otherwise 1.
+};
+
+void hal_init();
+
+int hal_fb_depth(int depth);
+int hal_fb_open(int width, int height, int depth, struct hal_fb *fb);
+void hal_fb_palette(const unsigned int *argb, int n);
+void hal_fb_show(int page);
+
+unsigned int hal_time();
+void hal_wait(int us);
+
+int hal_read_input(int *buttons);
+
+void hal_log(char *s);
+void hal_log_hex(unsigned int n);
+
+// Input recordings (replay.c). hal_replay_mode picks one of these at startup; to replay, it also fills buf with up to
+// max bytes of recording and sets *len. hal_replay_save is handed the whole recording again after every read it adds.
+#define HAL_LIVE 0        // Play from the controller.
+#define HAL_RECORD 1      // Play from the controller, recording it.
+#define HAL_REPLAY 2      // Play back a recording at the speed it was made.
+#define HAL_REPLAY_FAST 3 // Play back a recording as fast as possible.
+
+int hal_replay_mode(unsigned char *buf, int max, int *len);
+void hal_replay_save(const unsigned char *buf, int len);
+void hal_replay_end(char *why);
+
+#endif
@@ -0,0 +1,332 @@
+#include "gpio.h"
+#include "uart.h"
+#include "mbox.h"
+#include "hal.h"
+#include "irq.h"
+
+// Raspberry Pi 4 platform: the framebuffer comes from the firmware through the mailbox, time from the system timer,
+// input from a SNES controller on the GPIO pins and the log goes out of the UART.
+
+#define CLO ((volatile unsigned int*)(MMIO_BASE + 0x3004)) // System timer, counting microseconds.
+
+#define RECORD_UART 0 // 1 to record the controller and clock, sending the recording out of the UART as it grows.
+#define RECORD_LINE 32 // Bytes of recording per line sent.
+
+// SNES controller lines.
+#define CLK 11
+#define LAT 9
+#define DAT 10
+
+static volatile unsigned int *gpio = GPFSEL0;
+
+static unsigned int fb_height; // For finding the pages when flipping.
+
+///////////////////////////////
+// Init GPIO Code from Dylan //
+///////////////////////////////
+
+#define INPUT 0b000
+#define OUTPUT 0b001
+
+static void init_gpio(int pin, int func)
+{
+    // find the index / corresponding function select register for the pin
+    // -> hint: 10 pins per rgister
+    // 16 / 10 -> 1.6 -> 1
+    // 23 / 10 -> 2
+    int index = pin / 10; // tell us which GPFSEL register to use
+
+    int bit_shift = (pin % 10) * 3; // bit shift we want to mask out / replace
+
+    // gpio[index] = gpio[index] & ~(0b111 << bit_shift);
+    // right now: we have the gpio function select register, with
+    // the bits for our function cleared.
+    // the last thing to do is actually set these bits to funciton
+    gpio[index] = (gpio[index] & ~(0b111 << bit_shift)) | (func << bit_shift);
+}
+
+// val is either 0 (for clearing) or 1 (for setting)
+static void write_gpio(int pin_number, int val)
+{
+    // find which register we want to modify
+
+    // so if val is 0 -> we want to set a bit in clear registers
+    // if val is 1 -> we want to set a bit in the set registers
+
+    // it's kind of like a latch where we have to send a 1 to reset to clear it, and a 1 to data to write to it.
+
+    if (val == 1)
+    {
+        // if val is 1 -> we want to set a bit in the set registers
+        // you would want to check if the pin >= 32
+        // if this was the case, target_addr = set register 1
+        (*GPSET0) = 1 << pin_number;
+    }
+    else
+    {
+        (*GPCLR0) = 1 << pin_number;
+    }
+}
+
+static int read_gpio(int pin_number)
+{
+    // GPLEV0 encodes the first 0-31 GPIO pin values
+    // to read pin x, we shift right by x so GPIO pin value x is at bit 0.
+    // then, we can and with 1 to delete the rest of the data.
+
+    return ((*GPLEV0) >> pin_number) & 1;
+}
+
+static void init_snes_lines()
+{
+    // initialize GPIO lines for CLK, DAT, LAT
+    // set CLK and LAT to outputs (we write to these)
+    init_gpio(CLK, OUTPUT);
+    init_gpio(LAT, OUTPUT);
+    // set DATA as an input (we read the SNES buttons from)
+    init_gpio(DAT, INPUT);
+}
+
+// Read SNES using method from lecture.
+// Returns 1 if any button has been pressed, 0 if not.
+int hal_read_input(int *array)
+{
+    int data;
+
+    write_gpio(CLK, 1);
+    write_gpio(LAT, 1);
+    hal_wait(12);
+
+    write_gpio(LAT, 0);
+
+    // flag will be turned on if we read 0 from any button.
+    int flag = 0;
+
+    int i = 1;
+    while (i <= HAL_BUTTONS)
+    {
+        hal_wait(6);
+        write_gpio(CLK, 0);
+        hal_wait(6);
+        data = read_gpio(DAT);
+        array[i - 1] = data;
+        if (data == 0)
+        {
+            flag = 1;
+        }
+        write_gpio(CLK, 1);
+        ++i;
+    }
+
+    return flag;
+}
+
+
+void hal_init()
+{
+    init_snes_lines();
+    // From here on logging only queues the text, and only core 0 may log.
+    irq_init();
+    uart_irq_init();
+}
+
+#define CMDLINE_WORDS 194 // Room for the command line in a mailbox message.
+
+/* Returns the bits per pixel set by "depth=" in cmdline.txt, or depth if there is none. */
+int hal_fb_depth(int depth)
+{
+    static const char key[] = "depth=";
+    char *s = (char *)&mbox[5];
+    unsigned int len;
+
+    mbox[0] = (6 + CMDLINE_WORDS) * 4;
+    mbox[1] = MBOX_REQUEST;
+
+    mbox[2] = MBOX_TAG_GETCMDLINE;
+    mbox[3] = CMDLINE_WORDS * 4;
+    mbox[4] = 0;
+
+    mbox[5 + CMDLINE_WORDS] = MBOX_TAG_LAST;
+
+    if (!mbox_call(MBOX_CH_PROP)) return depth;
+
+    len = mbox[4] & 0x7FFFFFFF; // Length of the command line, which may have been cut short.
+    if (len > CMDLINE_WORDS * 4) len = CMDLINE_WORDS * 4;
+
+    // The firmware adds settings of its own, so only a word starting "depth=" counts.
+    for (unsigned int i = 0; i < len; i++) {
+        unsigned int k = 0;
+        int n = 0;
+
+        if (i > 0 && s[i - 1] != ' ') continue;
+        while (key[k] && i + k < len && s[i + k] == key[k]) k++;
+        if (key[k]) continue;
+
+        for (i += k; i < len && s[i] >= '0' && s[i] <= '9'; i++) n = n * 10 + s[i] - '0';
+        return n ? n : depth;
+    }
+    return depth;
+}
+
+/* Asks the firmware for a width x height screen with depth bits per pixel, with a second page below it for a back
+ * buffer. Returns 0 if the firmware won't give us that depth. */
+int hal_fb_open(int w, int h, int depth, struct hal_fb *fb)
+{
+    mbox[0] = 35*4; // Length of message in bytes
+    mbox[1] = MBOX_REQUEST;
+
+    mbox[2] = MBOX_TAG_SETPHYWH; // Tag identifier
+    mbox[3] = 8; // Value size in bytes
+    mbox[4] = 0;
+    mbox[5] = w; // Value(width)
+    mbox[6] = h; // Value(height)
+
+    mbox[7] = MBOX_TAG_SETVIRTWH;
+    mbox[8] = 8;
+    mbox[9] = 8;
+    mbox[10] = w;
+    mbox[11] = 2 * h; // Room for a back buffer below the visible screen.
+
+    mbox[12] = MBOX_TAG_SETVIRTOFF;
+    mbox[13] = 8;
+    mbox[14] = 8;
+    mbox[15] = 0; // Value(x)
+    mbox[16] = 0; // Value(y)
+
+    mbox[17] = MBOX_TAG_SETDEPTH;
+    mbox[18] = 4;
+    mbox[19] = 4;
+    mbox[20] = depth; // Bits per pixel
+
+    mbox[21] = MBOX_TAG_SETPXLORDR;
+    mbox[22] = 4;
+    mbox[23] = 4;
+    mbox[24] = 1; // RGB
+
+    mbox[25] = MBOX_TAG_GETFB;
+    mbox[26] = 8;
+    mbox[27] = 8;
+    mbox[28] = 4096; // FrameBufferInfo.pointer
+    mbox[29] = 0;    // FrameBufferInfo.size
+
+    mbox[30] = MBOX_TAG_GETPITCH;
+    mbox[31] = 4;
+    mbox[32] = 4;
+    mbox[33] = 0; // Bytes per line
+
+    mbox[34] = MBOX_TAG_LAST;
+
+    // Check call is successful and we have a pointer with the depth we asked for
+    if (!mbox_call(MBOX_CH_PROP) || mbox[20] != (unsigned int) depth || mbox[28] == 0) return 0;
+
+    mbox[28] &= 0x3FFFFFFF; // Convert GPU address to ARM address
+    fb->base = (unsigned char *)((long)mbox[28]);
+    fb->bytes = mbox[29];
+    fb->width = mbox[10];   // Actual physical width
+    fb->height = mbox[6];   // Actual physical height
+    fb->pitch = mbox[33];   // Number of bytes per line
+    fb->depth = depth;
+    fb->isrgb = mbox[24];   // Pixel order
+
+    // Only double buffer if we really got a virtual screen twice the physical height.
+    fb->pages = (mbox[11] >= 2 * fb->height) ? 2 : 1;
+    fb_height = fb->height;
+    return 1;
+}
+
+/* Loads the first n entries of the palette used at 8 bits per pixel. */
+void hal_fb_palette(const unsigned int *argb, int n)
+{
+    mbox[0] = (8 + n) * 4;
+    mbox[1] = MBOX_REQUEST;
+
+    mbox[2] = MBOX_TAG_SETPALETTE;
+    mbox[3] = (2 + n) * 4;
+    mbox[4] = (2 + n) * 4;
+    mbox[5] = 0; // First index
+    mbox[6] = n; // Number of entries
+
+    // Entries are 0x00BBGGRR.
+    for (int i = 0; i < n; i++) mbox[7 + i] = ((argb[i] & 0xFF) << 16) | (argb[i] & 0xFF00) | ((argb[i] >> 16) & 0xFF);
+
+    mbox[7 + n] = MBOX_TAG_LAST;
+
+    mbox_call(MBOX_CH_PROP);
+}
+
+/* Waits for vertical sync, then shows a page by moving the virtual offset to it. */
+void hal_fb_show(int page)
+{
+    mbox[0] = 12*4;
+    mbox[1] = MBOX_REQUEST;
+
+    mbox[2] = MBOX_TAG_WAITVSYNC;
+    mbox[3] = 4;
+    mbox[4] = 4;
+    mbox[5] = 0;
+
+    mbox[6] = MBOX_TAG_SETVIRTOFF;
+    mbox[7] = 8;
+    mbox[8] = 8;
+    mbox[9] = 0;                 // Value(x)
+    mbox[10] = page * fb_height; // Value(y)
+
+    mbox[11] = MBOX_TAG_LAST;
+
+    mbox_call(MBOX_CH_PROP);
+}
+
+/* Returns the system timer's count of microseconds. */
+unsigned int hal_time()
+{
+    return *CLO;
+}
+
+void hal_wait(int dur)
+{
+    unsigned c = *CLO + dur;
+    while (c > *CLO)
+        ;
+}
+
+void hal_log(char *s)
+{
+    uart_puts(s);
+}
+
+void hal_log_hex(unsigned int n)
+{
+    uart_hex(n);
+}
+
+/* The Pi has nowhere to load a recording from, so it can only record. */
+int hal_replay_mode(unsigned char *buf, int max, int *len)
+{
+    *len = 0;
+    return RECORD_UART ? HAL_RECORD : HAL_LIVE;
+}
+
+/* Sends the recording out of the UART in "REC <hex>" lines as soon as there are RECORD_LINE bytes that can no longer
+ * change (all but the last). Get it back from a capture of the UART with: sed -n 's/^REC //p' log | xxd -r -p */
+void hal_replay_save(const unsigned char *buf, int len)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    static int sent;
+    char line[4 + 2 * RECORD_LINE + 2] = "REC ";
+
+    for (; len - 1 - sent >= RECORD_LINE; sent += RECORD_LINE) {
+        for (int i = 0; i < RECORD_LINE; i++) {
+            line[4 + 2 * i] = digits[buf[sent + i] >> 4];
+            line[5 + 2 * i] = digits[buf[sent + i] & 0xF];
+        }
+        line[4 + 2 * RECORD_LINE] = '\n';
+        line[5 + 2 * RECORD_LINE] = 0;
+        uart_puts_wait(line); // A gap would spoil the recording.
+    }
+}
+
+void hal_replay_end(char *why)
+{
+    hal_log(why);
+    hal_log("\n");
+}
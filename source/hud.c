@@ -0,0 +1,129 @@
+#include "fb.h"
+#include "hud.h"
+
+// Incremental HUD. Each field remembers the characters it last put on screen, so an update only redraws the digit
+// cells that changed - usually one or two for the time counter, nothing at all for lives.
+
+#define CHAR_WIDTH 8   // Matches the font in terminal.h.
+#define CHAR_HEIGHT 8
+#define HUD_DIGITS 10  // Enough for any unsigned int.
+#define HUD_ATTR 0xF   // White on black.
+
+struct hud_field
+{
+    char *text;
+    struct surface label;
+    int labeled;                // Label is on screen.
+    int valid;                  // value and shown match the screen.
+    int value;
+    char shown[HUD_DIGITS];     // Right-aligned digits on screen, ' ' for blank cells.
+};
+
+static unsigned int score_label_pixels[6 * CHAR_WIDTH * CHAR_HEIGHT];
+static unsigned int time_label_pixels[5 * CHAR_WIDTH * CHAR_HEIGHT];
+static unsigned int lives_label_pixels[6 * CHAR_WIDTH * CHAR_HEIGHT];
+
+static struct hud_field fields[HUD_FIELDS] = {
+    { "SCORE:", { score_label_pixels, 6 * CHAR_WIDTH, CHAR_HEIGHT } },
+    { "TIME:", { time_label_pixels, 5 * CHAR_WIDTH, CHAR_HEIGHT } },
+    { "LIVES:", { lives_label_pixels, 6 * CHAR_WIDTH, CHAR_HEIGHT } },
+};
+
+static const unsigned int powers[HUD_DIGITS] = {
+    1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1
+};
+
+static int hud_x, hud_right, hud_top;
+
+/* Formats n right-aligned into HUD_DIGITS characters. Each digit is found by subtracting its power of ten, at most
+ * nine times, so there is no divide. */
+static void format(unsigned int n, char *out)
+{
+    int lead = 1;
+
+    for (int i = 0; i < HUD_DIGITS; i++) {
+        char d = '0';
+        while (n >= powers[i]) {
+            n -= powers[i];
+            d++;
+        }
+        if (d != '0' || i == HUD_DIGITS - 1) lead = 0;
+        out[i] = lead ? ' ' : d;
+    }
+}
+
+/* Sets where the HUD goes: labels start at labelx, numbers end with their last digit drawn at right, and the first
+ * field is on line top. Rasterizes the labels. */
+void hud_init(int labelx, int right, int top)
+{
+    hud_x = labelx;
+    hud_right = right;
+    hud_top = top;
+
+    for (int f = 0; f < HUD_FIELDS; f++) fb_render_label(&fields[f].label, fields[f].text, HUD_ATTR);
+    hud_invalidate();
+}
+
+/* Shows value in a field. Values below zero show as 0. */
+void hud_set(int field, int value)
+{
+    struct hud_field *f = &fields[field];
+    int y = hud_top + field * CHAR_HEIGHT;
+    char text[HUD_DIGITS + 1];
+
+    if (value < 0) value = 0;
+
+    if (!f->labeled) {
+        fb_copy_surface(&f->label, 0, 0, f->label.width, f->label.height, hud_x, y);
+        f->labeled = 1;
+    }
+
+    if (f->valid && f->value == value) return;
+
+    format(value, text);
+
+    // Redraw each run of changed cells.
+    for (int i = 0; i < HUD_DIGITS;) {
+        if (text[i] == f->shown[i]) {
+            i++;
+            continue;
+        }
+
+        int start = i;
+        while (i < HUD_DIGITS && text[i] != f->shown[i]) {
+            f->shown[i] = text[i];
+            i++;
+        }
+
+        char saved = text[i];
+        text[i] = '\0';
+        drawString(hud_right - (HUD_DIGITS - 1 - start) * CHAR_WIDTH, y, &text[start], HUD_ATTR);
+        text[i] = saved;
+    }
+
+    f->value = value;
+    f->valid = 1;
+}
+
+/* Forgets what the HUD looks like, so the next update of each field redraws it completely. For when something else
+ * has drawn over it. */
+void hud_invalidate()
+{
+    for (int f = 0; f < HUD_FIELDS; f++) {
+        fields[f].labeled = 0;
+        fields[f].valid = 0;
+        for (int i = 0; i < HUD_DIGITS; i++) fields[f].shown[i] = '\0';
+    }
+}
+
+/* Blanks the HUD area. Fields stay hidden until they are next set. */
+void hud_clear()
+{
+    drawRect(hud_x, hud_top, hud_right + CHAR_WIDTH - 1, hud_top + HUD_FIELDS * CHAR_HEIGHT - 1, 0x0, 1);
+
+    for (int f = 0; f < HUD_FIELDS; f++) {
+        fields[f].labeled = 0;
+        fields[f].valid = 0;
+        for (int i = 0; i < HUD_DIGITS; i++) fields[f].shown[i] = ' ';
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef HUD_H
+#define HUD_H
+
+// Fields shown in the HUD, one per line from the top.
+#define HUD_SCORE 0
+#define HUD_TIME 1
+#define HUD_LIVES 2
+#define HUD_FIELDS 3
+
+void hud_init(int labelx, int right, int top);
+void hud_set(int field, int value);
+void hud_invalidate();
+void hud_clear();
+
+#endif
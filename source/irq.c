@@ -0,0 +1,95 @@
+#include "irq.h"
+
+// Interrupts, on core 0 only. start.S has the exception vectors: an IRQ saves everything a C call may clobber and
+// comes to irq_handle, which asks the GIC-400 which interrupt it is and calls the handler connected to it. Any other
+// exception stops the core. Handlers run with IRQs masked.
+
+#define GICD_BASE 0xFF841000 // Distributor
+#define GICC_BASE 0xFF842000 // CPU interface
+
+#define GICD_CTLR       ((volatile unsigned int*)(GICD_BASE + 0x000))
+#define GICD_ISENABLER  ((volatile unsigned int*)(GICD_BASE + 0x100))
+#define GICD_IPRIORITYR ((volatile unsigned char*)(GICD_BASE + 0x400))
+#define GICD_ITARGETSR  ((volatile unsigned char*)(GICD_BASE + 0x800))
+#define GICD_ICFGR      ((volatile unsigned int*)(GICD_BASE + 0xC00))
+#define GICC_CTLR       ((volatile unsigned int*)(GICC_BASE + 0x000))
+#define GICC_PMR        ((volatile unsigned int*)(GICC_BASE + 0x004))
+#define GICC_IAR        ((volatile unsigned int*)(GICC_BASE + 0x00C))
+#define GICC_EOIR       ((volatile unsigned int*)(GICC_BASE + 0x010))
+
+#define IRQ_PRIORITY 0xA0
+#define IRQ_SPURIOUS 1020 // Interrupt IDs from here up mean there is nothing to handle.
+#define IRQ_HANDLERS 4
+
+static struct
+{
+    unsigned int id;
+    void (*fn)();
+} handlers[IRQ_HANDLERS];
+static int num_handlers;
+
+#ifdef __aarch64__
+extern char irq_vectors[]; // start.S
+#endif
+
+/* Installs the exception vectors on core 0, turns on the GIC and unmasks IRQs. */
+void irq_init()
+{
+#ifdef __aarch64__
+    unsigned long el, hcr;
+
+    asm volatile ("mrs %0, CurrentEL" : "=r" (el));
+    if (((el >> 2) & 3) == 2) {
+        asm volatile ("msr vbar_el2, %0" : : "r" (irq_vectors));
+        // HCR_EL2.IMO routes physical IRQs to EL2, where we run, instead of to EL1.
+        asm volatile ("mrs %0, hcr_el2" : "=r" (hcr));
+        asm volatile ("msr hcr_el2, %0" : : "r" (hcr | (1 << 4)));
+    } else {
+        asm volatile ("msr vbar_el1, %0" : : "r" (irq_vectors));
+    }
+    asm volatile ("isb");
+
+    *GICC_PMR = 0xF0; // Let through every priority above the lowest.
+    *GICC_CTLR = 1;
+    *GICD_CTLR = 1;
+
+    asm volatile ("msr daifclr, #2");
+#endif
+}
+
+/* Calls fn whenever the GIC raises interrupt id, which must be level triggered. Returns 0 if there is no room for
+ * another handler. */
+int irq_connect(unsigned int id, void (*fn)())
+{
+    if (num_handlers == IRQ_HANDLERS) return 0;
+
+    unsigned long daif = irq_save();
+    handlers[num_handlers].id = id;
+    handlers[num_handlers].fn = fn;
+    num_handlers++;
+#ifdef __aarch64__
+    GICD_IPRIORITYR[id] = IRQ_PRIORITY;
+    GICD_ITARGETSR[id] = 1;                       // Core 0.
+    GICD_ICFGR[id / 16] &= ~(2 << 2 * (id % 16)); // Level triggered.
+    GICD_ISENABLER[id / 32] = 1 << (id % 32);
+#endif
+    irq_restore(daif);
+    return 1;
+}
+
+/* Entered from the IRQ vector in start.S. Handles every pending interrupt. */
+void irq_handle()
+{
+#ifdef __aarch64__
+    for (;;) {
+        unsigned int iar = *GICC_IAR;
+        unsigned int id = iar & 0x3FF;
+
+        if (id >= IRQ_SPURIOUS) break;
+        for (int i = 0; i < num_handlers; i++) {
+            if (handlers[i].id == id) handlers[i].fn();
+        }
+        *GICC_EOIR = iar;
+    }
+#endif
+}
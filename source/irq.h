@@ -0,0 +1,26 @@
+#ifndef IRQ_H
+#define IRQ_H
+
+#define IRQ_UART 153 // The PL011 UARTs: VideoCore interrupt 57, which the GIC sees as SPI 153.
+
+void irq_init();
+int irq_connect(unsigned int id, void (*fn)());
+
+/* Masks IRQs on this core, returning the old mask for irq_restore. */
+static inline unsigned long irq_save()
+{
+    unsigned long daif = 0;
+#ifdef __aarch64__
+    asm volatile ("mrs %0, daif\n\tmsr daifset, #2" : "=r" (daif) : : "memory");
+#endif
+    return daif;
+}
+
+static inline void irq_restore(unsigned long daif)
+{
+#ifdef __aarch64__
+    asm volatile ("msr daif, %0" : : "r" (daif) : "memory");
+#endif
+}
+
+#endif
@@ -0,0 +1,64 @@
+#include "lz4.h"
+
+// Decoder for the LZ4 block format, as written by tools/mkassets.py. A block is a run of sequences, each a token
+// byte (literal length << 4 | match length - 4), the literals, then a 2-byte little-endian offset back into the
+// output and the rest of the match. Lengths of 15 continue in following bytes. The last sequence has no match.
+
+// Reads the extra bytes of a length that didn't fit in its 4 bits. Returns -1 if the block ends first.
+static int extra_length(const unsigned char **ip, const unsigned char *iend)
+{
+    int len = 0;
+    unsigned char b;
+
+    do {
+        if (*ip >= iend) return -1;
+        b = *(*ip)++;
+        len += b;
+    } while (b == 255);
+    return len;
+}
+
+/* Decompresses an LZ4 block into dst. Returns the number of bytes written, or -1 if the block is corrupt or would
+ * not fit. */
+int lz4_decompress(const unsigned char *src, int srclen, unsigned char *dst, int dstlen)
+{
+    const unsigned char *ip = src;
+    const unsigned char *iend = src + srclen;
+    unsigned char *op = dst;
+    unsigned char *oend = dst + dstlen;
+
+    while (ip < iend) {
+        unsigned int token = *ip++;
+        int len = token >> 4;
+        int extra;
+
+        // Literals...
+        if (len == 15) {
+            if ((extra = extra_length(&ip, iend)) < 0) return -1;
+            len += extra;
+        }
+        if (len > iend - ip || len > oend - op) return -1;
+        while (len--) *op++ = *ip++;
+
+        if (ip == iend) break; // Last sequence, no match.
+
+        // ...then the match.
+        if (iend - ip < 2) return -1;
+        int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op - dst) return -1;
+
+        len = token & 15;
+        if (len == 15) {
+            if ((extra = extra_length(&ip, iend)) < 0) return -1;
+            len += extra;
+        }
+        len += 4;
+        if (len > oend - op) return -1;
+
+        // Byte by byte, as the match may overlap what it is producing.
+        const unsigned char *match = op - offset;
+        while (len--) *op++ = *match++;
+    }
+    return op - dst;
+}
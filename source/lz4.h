@@ -0,0 +1,6 @@
+#ifndef LZ4_H
+#define LZ4_H
+
+int lz4_decompress(const unsigned char *src, int srclen, unsigned char *dst, int dstlen);
+
+#endif
@@ -1,61 +1,30 @@
-#include "gpio.h"
-#include "uart.h"
+#include "hal.h"
 #include "fb.h"
+#include "hud.h"
+#include "mmu.h"
+#include "smp.h"
+#include "render.h"
+#include "replay.h"
+#include "prof.h"
 
 //#include <stdio.h>
 //#include <unistd.h>
 
 // include images
 // #include "dk_image.h"
-#include "dk_up1.h"
-#include "dk_up2.h"
 //#include "dk_left0.h"
-#include "dk_left1.h"
-#include "dk_left2.h"
 //#include "dk_right0.h"
-#include "dk_right1.h"
-#include "dk_right2.h"
-
-#include "mario_left1.h"
-#include "mario_left2.h"
-#include "mario_right1.h"
-#include "mario_right2.h"
-
-#include "bird_left1.h"
-#include "bird_left2.h"
-#include "bird_left3.h"
-#include "bird_right1.h"
-#include "bird_right2.h"
-#include "bird_right3.h"
-
-#include "bananarang.h"
-#include "bananarang2.h"
-#include "bananarang3.h"
-#include "bananarangpack.h"
-#include "emptypack.h"
-
-#include "enemy.h"
+
+// Actor, pack and teleporter frames, packed into one array of visible spans. Left-facing frames are drawn mirrored.
+#include "atlas.h"
+
+
 #include "coin.h"
 #include "health.h"
 #include "black.h"
-#include "heartpack.h"
-#include "coinpack.h"
-#include "teleporter.h"
 
-<<<<<<<< HEAD:build/fast source/main.c
-/*
-========
->>>>>>>> 506ed3f028e60503dade4f8018f253560320668c:source/main.c
-#include "start.h"
-#include "startSelected.h"
-#include "exit.h"
-#include "exitSelected.h"
-#include "title_screen.h"
-#include "titleDonkey.h"
-<<<<<<<< HEAD:build/fast source/main.c
-*/
-========
->>>>>>>> 506ed3f028e60503dade4f8018f253560320668c:source/main.c
+// Title art and menu buttons, compressed and decoded when the start menu needs them.
+#include "assets.h"
 
 #include "ladder.h"
 #include "platform.h"
@@ -63,145 +32,37 @@
 #include "structures.c"
 
 #define MAXOBJECTS 30
-#define SCREENWIDTH 1888
+// Framebuffer size. The display scaler stretches it to fill the monitor, so a smaller framebuffer means fewer pixels
+// to draw each frame. The game box is 25 cells of at least 32 pixels (the sprite size), so 800 lines is the least
+// that fits. Set SCREEN_REDUCED to 1 for a 1424x800 framebuffer with 32 pixel cells instead of 40.
+#define SCREEN_REDUCED 0
+
+#if SCREEN_REDUCED
+#define FB_WIDTH 1424
+#define FB_HEIGHT 800
+#define SCREENHEIGHT 800
+#else
+#define FB_WIDTH 1920
+#define FB_HEIGHT 1080
 #define SCREENHEIGHT 1000
+#endif
+#define SCREENWIDTH (FB_WIDTH - 32)
 #define JUMPHEIGHT 100
 
 #define LEFTEND (SCREENWIDTH - SCREENHEIGHT) / 2 // Left end of "game box" in pixels.
 #define RIGHTEND LEFTEND + SCREENHEIGHT          // box has side length of SCREENHEIGHT.
 
+// Framebuffer bits per pixel: 32, 16 (RGB565) or 8 (3-3-2 palette). This is the default, which can be changed at boot
+// with depth= in cmdline.txt on the Pi, or SIM_DEPTH in the simulator. The DMA cell copies and the streaming stores
+// of the tile renderer only work at 32.
+#define SCREEN_DEPTH 32
+
 #define FONT_WIDTH 8
 #define FONT_HEIGHT 8
 
-// GPIO macros
-
-#define GPIO_BASE 0xFE200000
-#define CLO_REG 0xFE003004
-#define GPSET0_s 7
-#define GPCLR0_s 10
-#define GPLEV0_s 13
-
-#define CLK 11
-#define LAT 9
-#define DAT 10
-
-#define INP_GPIO(p) *(gpio + ((p) / 10)) &= ~(7 << (((p) % 10) * 3))
-#define OUT_GPIO(p) *(gpio + ((p) / 10)) |= (1 << (((p) % 10) * 3))
-
-unsigned int *gpio = (unsigned *)GPIO_BASE;
-unsigned int *clo = (unsigned *)CLO_REG;
-
 // Some method signatures...
 void erase_state(struct gamestate *state);
 int is_valid_cell(int x, int y, struct gamestate *state);
-void myDrawImage(unsigned char * img, int width, int height, int offx, int offy);
-
-///////////////////////////////
-// Init GPIO Code from Dylan //
-///////////////////////////////
-
-#define INPUT 0b000
-#define OUTPUT 0b001
-
-void init_gpio(int pin, int func)
-{
-    // find the index / corresponding function select register for the pin
-    // -> hint: 10 pins per rgister
-    // 16 / 10 -> 1.6 -> 1
-    // 23 / 10 -> 2
-    int index = pin / 10; // tell us which GPFSEL register to use
-
-    int bit_shift = (pin % 10) * 3; // bit shift we want to mask out / replace
-
-    // gpio[index] = gpio[index] & ~(0b111 << bit_shift);
-    // right now: we have the gpio function select register, with
-    // the bits for our function cleared.
-    // the last thing to do is actually set these bits to funciton
-    gpio[index] = (gpio[index] & ~(0b111 << bit_shift)) | (func << bit_shift);
-}
-
-// val is either 0 (for clearing) or 1 (for setting)
-void write_gpio(int pin_number, int val)
-{
-    // find which register we want to modify
-
-    // so if val is 0 -> we want to set a bit in clear registers
-    // if val is 1 -> we want to set a bit in the set registers
-
-    // it's kind of like a latch where we have to send a 1 to reset to clear it, and a 1 to data to write to it.
-
-    if (val == 1)
-    {
-        // if val is 1 -> we want to set a bit in the set registers
-        // you would want to check if the pin >= 32
-        // if this was the case, target_addr = set register 1
-        (*GPSET0) = 1 << pin_number;
-    }
-    else
-    {
-        (*GPCLR0) = 1 << pin_number;
-    }
-}
-
-int read_gpio(int pin_number)
-{
-    // GPLEV0 encodes the first 0-31 GPIO pin values
-    // to read pin x, we shift right by x so GPIO pin value x is at bit 0.
-    // then, we can and with 1 to delete the rest of the data.
-
-    return ((*GPLEV0) >> pin_number) & 1;
-}
-
-void init_snes_lines()
-{
-    // initialize GPIO lines for CLK, DAT, LAT
-    // set CLK and LAT to outputs (we write to these)
-    init_gpio(CLK, OUTPUT);
-    init_gpio(LAT, OUTPUT);
-    // set DATA as an input (we read the SNES buttons from)
-    init_gpio(DAT, INPUT);
-}
-
-void wait(int dur)
-{
-    unsigned c = *clo + dur;
-    while (c > *clo)
-        ;
-}
-
-// Read SNES using method from lecture.
-// Returns 1 if any button has been pressed, 0 if not.
-int read_SNES(int *array)
-{
-    int data;
-
-    write_gpio(CLK, 1);
-    write_gpio(LAT, 1);
-    wait(12);
-
-    write_gpio(LAT, 0);
-
-    // flag will be turned on if we read 0 from any button.
-    int flag = 0;
-
-    int i = 1;
-    while (i <= 16)
-    {
-        wait(6);
-        write_gpio(CLK, 0);
-        wait(6);
-        data = read_gpio(DAT);
-        array[i - 1] = data;
-        if (data == 0)
-        {
-            flag = 1;
-        }
-        write_gpio(CLK, 1);
-        ++i;
-    }
-
-    return flag;
-}
 
 // Array to track which buttons have been pressed;
 int buttons[16];
@@ -333,179 +194,738 @@ int grid_to_pixel_y(int y, int height)
     return y * (SCREENHEIGHT / height);
 }
 
-// Draws an object at its current grid coordinates.
-void draw_grid(struct object *o, int width, int height)
+// Screen position of every cell, so drawing looks them up instead of dividing. Built by build_cell_table once the
+// grid size is known, which also gives fb.c its table of cell addresses.
+int cell_x[25 * 25];
+int cell_y[25 * 25];
+int cell_width, cell_height;
+
+void build_cell_table(struct gamestate *state)
+{
+    cell_width = (RIGHTEND - LEFTEND) / state->width;
+    cell_height = SCREENHEIGHT / state->height;
+
+    for (int i = 0; i < state->width * state->height; ++i) {
+        cell_x[i] = grid_to_pixel_x(i % state->width, state->width);
+        cell_y[i] = grid_to_pixel_y(i / state->width, state->height);
+    }
+    fb_set_grid(LEFTEND, 0, cell_width, cell_height, state->width, state->height);
+}
+
+// Ways of drawing a sprite over a cell. Tiles are opaque, DK and the boomerang sit on a black
+// background that is keyed out, and the other sprites carry a real alpha channel.
+#define DRAW_OPAQUE 0
+#define DRAW_KEY 1
+#define DRAW_ALPHA 2
+#define DRAW_MIRROR 4 // Or'ed with one of the above to flip the sprite left to right.
+
+#define KEY_COLOR 0xFF000000 // Opaque black.
+
+// Returns 1 if an image is a frame of the atlas, which holds span-encoded rows rather than plain pixels.
+int in_atlas(struct image *img)
+{
+    unsigned int *p = (unsigned int*)img->img;
+    return p >= atlas_spans && p < atlas_spans + ATLAS_WORDS;
+}
+
+// Draws a sprite at the given pixel offsets using one of the modes above. Atlas frames carry their own transparency,
+// so for them only DRAW_MIRROR matters.
+void draw_sprite(struct image *img, int offx, int offy, int mode)
 {
-    if (!(*o).trampled) myDrawImage((*o).sprite.img, (*o).sprite.width, (*o).sprite.height, grid_to_pixel_x((*o).loc.x, width), grid_to_pixel_y((*o).loc.y, height));
+    if (in_atlas(img)) fb_blit_spans((unsigned int*)img->img, img->width, img->height, offx, offy, mode & DRAW_MIRROR);
+    else if (mode == DRAW_KEY) fb_blit_key((unsigned int*)img->img, img->width, img->height, offx, offy, KEY_COLOR);
+    else if (mode == DRAW_ALPHA) fb_blit_alpha((unsigned int*)img->img, img->width, img->height, offx, offy);
+    else fb_blit((unsigned int*)img->img, img->width, img->height, offx, offy);
+}
+
+// Draws a sprite over cell i. Plain sprites of the grid's size go through the fixed-size cell blitters.
+void draw_cell_sprite(struct image *img, int i, int mode)
+{
+    int cell_sized = img->width == FB_CELL && img->height == FB_CELL && !in_atlas(img);
+
+    if (cell_sized && mode == DRAW_ALPHA) fb_cell_blend(i, (unsigned int*)img->img);
+    else if (cell_sized && mode == DRAW_OPAQUE) fb_cell_copy(i, (unsigned int*)img->img, FB_CELL);
+    else draw_sprite(img, cell_x[i], cell_y[i], mode);
 }
 
 // Draws an int at specified pixel offsets (right end of number at offx)
 void draw_int(unsigned int n, int offx, int offy, unsigned char attr)
 {
+    char digits[11];
+    int i = 10;
+
+    // Write the digits into a string back to front, then draw them in one go.
+    digits[i] = '\0';
     while (n > 0)
     {
-        // Print the smallest digit of n.
-        char digit = (n % 10) + 48;
-        drawChar(digit, offx, offy, attr);
-        offx -= FONT_WIDTH;
+        digits[--i] = (n % 10) + 48;
         n = n / 10;
     }
+    if (i < 10) drawString(offx - (9 - i) * FONT_WIDTH, offy, &digits[i], attr);
 }
 
 // Draws an image structure at specified pixel offsets
 void draw_image(struct image myimg, int offx, int offy)
 {
-    myDrawImage(myimg.img, myimg.width, myimg.height, offx, offy);
+    fb_blit((unsigned int*)myimg.img, myimg.width, myimg.height, offx, offy);
 }
 
-// Main drawing method - draws a game state.
-// Coordinates of all objects are in grid coords, so need to convert these to pixel
-// coords in order to draw.
-void draw_state(struct gamestate * state, unsigned int init_time) {
-    // Draw DK...
-    // draw_grid(state->dk, state->width, state->height);
-    // Drawing of DK moved to DKmove.
+// Converts every sprite used in game from GIMP RGBA to framebuffer ARGB order. Must be called exactly
+// once at boot, before anything is drawn with fb_blit.
+#define SWIZZLE(sprite) fb_swizzle((sprite).pixel_data, (sprite).width, (sprite).height)
 
-    // Draw each enemy...
-    for (int i = 0; i < state->num_enemies; ++i)
-    {
-        // Print state->enemies[i] with grid coords (x, y) at location (x * SCREENWIDTH/state->width, y * SCREENHEIGHT/state->height)
-        if (state->enemies[i].exists) draw_grid(&(state->enemies[i]), state->width, state->height);
+void prepare_sprites()
+{
+
+    SWIZZLE(coin_image);
+    SWIZZLE(health_image);
+    SWIZZLE(black_image);
+
+    SWIZZLE(ladder);
+    SWIZZLE(platform);
+
+    // The DMA engine reads these straight from memory.
+    dcache_clean(coin_image.pixel_data, sizeof(coin_image.pixel_data));
+    dcache_clean(health_image.pixel_data, sizeof(health_image.pixel_data));
+    dcache_clean(black_image.pixel_data, sizeof(black_image.pixel_data));
+    dcache_clean(ladder.pixel_data, sizeof(ladder.pixel_data));
+    dcache_clean(platform.pixel_data, sizeof(platform.pixel_data));
+}
+
+
+////////////////////
+// BANDED DRAWING //
+////////////////////
+
+// Large redraws are split into horizontal bands, one per core, which smp_run draws at the same time. Each band only
+// writes its own rows, and smp_run returns once all of them are done, so the frame is complete before it is presented.
+
+// Returns the first of n rows in band b of bands. Band b covers rows band_start(b) up to band_start(b + 1).
+int band_start(int band, int bands, int n)
+{
+    return band * n / bands;
+}
+
+// Runs a drawing job on every core. Anything queued for the DMA engine is finished first, since the bands may draw over
+// it. Only the core doing the drawing may queue DMA copies or call smp_run: the render core during play, or core 0
+// once render_sync has returned.
+void draw_bands(void (*job)(int band, int bands, void *arg), void *arg)
+{
+    fb_sync();
+    smp_run(job, arg);
+}
+
+struct fill_job
+{
+    int x, y, width, height;
+    unsigned int color;
+};
+
+void fill_band(int band, int bands, void *arg)
+{
+    struct fill_job *f = arg;
+    int y0 = band_start(band, bands, f->height);
+    int y1 = band_start(band + 1, bands, f->height);
+
+    fb_fill_rect(f->x, f->y + y0, f->width, y1 - y0, f->color);
+}
+
+// Fills a rectangle of the screen, a band per core.
+void fill_rect_banded(int x, int y, int width, int height, unsigned int color)
+{
+    struct fill_job f = { x, y, width, height, color };
+    draw_bands(fill_band, &f);
+}
+
+struct blit_job
+{
+    const unsigned int *pixels;
+    int width, height, offx, offy;
+};
+
+void blit_band(int band, int bands, void *arg)
+{
+    struct blit_job *b = arg;
+    int y0 = band_start(band, bands, b->height);
+    int y1 = band_start(band + 1, bands, b->height);
+
+    if (y1 > y0) fb_blit(b->pixels + y0 * b->width, b->width, y1 - y0, b->offx, b->offy + y0);
+}
+
+// Draws an ARGB image at specified pixel offsets, a band per core.
+void blit_banded(const unsigned int *pixels, int width, int height, int offx, int offy)
+{
+    struct blit_job b = { pixels, width, height, offx, offy };
+    draw_bands(blit_band, &b);
+}
+
+
+///////////////////////
+// STATIC TILE LAYER //
+///////////////////////
+
+// The level's background, platforms and ladders, rendered once per level into normal RAM in framebuffer format.
+// It covers the whole game box, so restoring a cell after an actor leaves it is a straight row copy from here,
+// and the background can be any image rather than plain black.
+unsigned int static_pixels[SCREENHEIGHT * SCREENHEIGHT];
+struct surface static_layer = { static_pixels, SCREENHEIGHT, SCREENHEIGHT };
+
+// Set when the background is a single color, so background cells can be filled without reading any sprite memory.
+int background_solid = 0;
+unsigned int background_color;
+
+// Renders the static layer for the map currently in state->map_tiles.
+void build_static_layer(struct gamestate *state)
+{
+    // Nothing may still be drawing or copying out of the old layer.
+    render_sync();
+    fb_sync();
+
+    background_solid = fb_solid_color((unsigned int*)state->background.img, state->background.width, state->background.height, &background_color);
+
+    // Cover the whole box with the background, gaps between cells included...
+    if (background_solid) {
+        surface_fill(&static_layer, 0, 0, static_layer.width, static_layer.height, background_color);
+    } else {
+        for (int y = 0; y < static_layer.height; y += state->background.height) {
+            for (int x = 0; x < static_layer.width; x += state->background.width) {
+                surface_blit(&static_layer, (unsigned int*)state->background.img, state->background.width, state->background.height, x, y);
+            }
+        }
     }
 
-    // Draw each pack...
-    for (int i = 0; i < state->num_packs; ++i)
-    {
-        // Print state->packs[i] with grid coords (x, y) at location (x * SCREENWIDTH/state->width, y * SCREENHEIGHT/state->height)
-        if (state->packs[i].exists && !(state->packs[i].trampled))
-            draw_grid(&(state->packs[i]), state->width, state->height);
+    // ...then the platforms and ladders. Platform art is opaque, ladders let the background show through.
+    for (int i = 0; i < state->width * state->height; ++i) {
+        int x = cell_x[i] - LEFTEND;
+        int y = cell_y[i];
+
+        if (state->map_tiles[i] == 1) surface_blit(&static_layer, (unsigned int*)state->platform.img, state->platform.width, state->platform.height, x, y);
+        else if (state->map_tiles[i] == 2) surface_blit_alpha(&static_layer, (unsigned int*)state->ladder.img, state->ladder.width, state->ladder.height, x, y);
     }
 
-    // Draw each vehicle...
-    for (int i = 0; i < state->num_vehicles; ++i)
-    {
-        // Draw start...
-        if (!(state->vehicles[i].start.trampled)) draw_grid(&(state->vehicles[i].start), state->width, state->height);
-        // Draw finish...
-        if (!(state->vehicles[i].finish.trampled))draw_grid(&(state->vehicles[i].finish), state->width, state->height);
+    // Tile restores may be done by the DMA engine, which reads memory rather than the cache.
+    dcache_clean(static_pixels, sizeof(static_pixels));
+}
+
+// Restores a block of the game box, given in screen pixels, from the static layer.
+void draw_static(int offx, int offy, int width, int height)
+{
+    fb_copy_surface(&static_layer, offx - LEFTEND, offy, width, height, offx, offy);
+}
+
+// Restores a tile of cell i from the static layer.
+void draw_static_cell(int i, struct image *tile)
+{
+    if (tile->width == FB_CELL && tile->height == FB_CELL)
+        fb_cell_copy(i, static_pixels + cell_y[i] * static_layer.width + cell_x[i] - LEFTEND, static_layer.width);
+    else draw_static(cell_x[i], cell_y[i], tile->width, tile->height);
+}
+
+// Draws the background of one cell at specified pixel offsets.
+void draw_background(struct image *background, int offx, int offy)
+{
+    if (background_solid) fb_fill_rect(offx, offy, background->width, background->height, background_color);
+    else draw_static(offx, offy, background->width, background->height);
+}
+
+
+////////////////
+// COMPOSITOR //
+////////////////
+
+// The compositor keeps an ordered stack of layers for every grid cell, bottom to top.
+// The HUD sits outside the game box, so it never shares a cell with these and is drawn on its own.
+#define LAYER_TILE 0       // Platform, ladder or background, copied from the static layer.
+#define LAYER_PACK 1       // Packs, vehicle entrances/exits and the stage exit.
+#define LAYER_ACTOR 2      // Enemies, then DK on top.
+#define LAYER_PROJECTILE 3 // The boomerang.
+#define NUM_LAYERS 4
+
+struct layer
+{
+    struct image sprite; // sprite.img is 0 if nothing is in this layer.
+    int mode;            // DRAW_OPAQUE, DRAW_KEY or DRAW_ALPHA, possibly with DRAW_MIRROR.
+};
+
+struct cell
+{
+    struct layer layers[NUM_LAYERS];
+};
+
+// What drawing a frame needs from the gamestate. It is copied with the frame's cell stacks, so the render core never
+// reads the gamestate while core 0 changes it for the next frame.
+struct comp_grid
+{
+    int width, height;
+    struct image background;
+};
+
+// Cell stacks for the frames being built and drawn. A cell is only redrawn when its stack differs from the one last
+// drawn. With a render core, one frame can be drawn while the next is built, and the frame before it is what the
+// drawn one is compared with, so three are kept.
+#define COMP_FRAMES 3
+
+struct cell comp_cells[COMP_FRAMES][25 * 25];
+struct comp_grid comp_grids[COMP_FRAMES];
+unsigned int comp_seq[COMP_FRAMES]; // Render command that draws each frame.
+int comp_current = 0;               // Frame built next.
+struct cell *comp_last = comp_cells[COMP_FRAMES - 1]; // Frame last drawn. Belongs to the render side.
+int comp_redraw_all = 1; // Set when the screen no longer matches the last drawn frame. Belongs to the render side.
+
+// Puts a sprite into one layer of the cell at loc. Sprites outside the grid are ignored.
+void comp_put(struct cell *cells, int layer, struct image *sprite, struct coord loc, int mode, struct gamestate *state)
+{
+    if (loc.x < 0 || loc.x >= state->width || loc.y < 0 || loc.y >= state->height) return;
+
+    struct layer *l = &cells[state->width * loc.y + loc.x].layers[layer];
+    l->sprite = *sprite;
+    l->mode = mode;
+}
+
+// Returns 1 if two cell stacks would draw the same thing.
+int comp_same(struct cell *a, struct cell *b)
+{
+    for (int l = 0; l < NUM_LAYERS; ++l) {
+        if (a->layers[l].sprite.img != b->layers[l].sprite.img) return 0;
+        if (a->layers[l].sprite.img && a->layers[l].mode != b->layers[l].mode) return 0;
     }
+    return 1;
+}
 
-    // Draw the exit...
-    if (!(state->exit.trampled))draw_grid(&(state->exit), state->width, state->height);
+// Returns 1 if the tile of a cell is plain background of a single color, which is filled rather than copied.
+int comp_solid_tile(struct cell *c, struct comp_grid *grid)
+{
+    return background_solid && c->layers[LAYER_TILE].sprite.img == grid->background.img;
+}
 
-    // Update and print score...
-    state->score = state->time + (250000 * state->lives) + (250000 * state->dk.num_coins_grabbed) + (250000 * state->dk.num_killed);
-    draw_int(state->score, SCREENWIDTH, FONT_HEIGHT, 0xF);
-    drawString(SCREENWIDTH - 200, FONT_HEIGHT, "SCORE:", 0xF);
+// Draws every layer of cell i above the tile, bottom to top.
+void comp_draw_cell(int i, struct cell *c)
+{
+    for (int l = LAYER_TILE + 1; l < NUM_LAYERS; ++l) {
+        if (c->layers[l].sprite.img) draw_cell_sprite(&c->layers[l].sprite, i, c->layers[l].mode);
+    }
+}
 
-    // Update and print time remaining...
+// Renderers for the changed cells. RENDER_CELLS draws each cell layer by layer straight to the screen, the other two
+// compose in cached memory first so that the framebuffer never sees overdraw.
+#define RENDER_CELLS 0
+#define RENDER_SCANLINE 1
+#define RENDER_TILES 2
+#define RENDERER RENDER_SCANLINE
 
-    // First calculate time elapsed by this iteration of loop.
-    init_time = (*clo - init_time) / 1000; // init_time is time elapsed in thousandths of a second.
-    state->time -= init_time;
+// Core that draws the game loop's frames while core 0 runs the logic for the next one, or 0 to draw them on core 0.
+// The render core then draws two of a frame's bands itself.
+#define RENDER_CORE 1
 
-    // If state.time is now leq 0, set loseflag.
-    if (state->time <= 0)
-        state->loseflag = 1;
+// Scanline renderer. The changed cells of a grid row are composed one pixel row at a time in a line buffer, from the
+// static layer and the sprites over it, and each finished row is stored to the screen once. Writes to the framebuffer
+// go top to bottom in long runs.
 
-    draw_int(state->time, SCREENWIDTH, 2 * FONT_HEIGHT, 0xF);
-    drawString(SCREENWIDTH - 200, 2 * FONT_HEIGHT, "TIME:", 0xF);
+unsigned int scan_pixels[SMP_CORES][SCREENHEIGHT]; // A line buffer per band.
 
-    // Print lives remaining... (replace with hearts later)
-    draw_int(state->lives, SCREENWIDTH, 3 * FONT_HEIGHT, 0xF);
-    drawString(SCREENWIDTH - 200, 3 * FONT_HEIGHT, "LIVES:", 0xF);
+// A sprite being drawn a row at a time.
+struct scan_sprite
+{
+    struct layer *layer;
+    const unsigned int *row; // Next row to draw: plain pixels, or a span-encoded row for atlas frames.
+    int x;                   // Left edge within the line buffer.
+};
 
-    // End of drawing gamestate.
+// Composes and stores the cells first..end-1 of grid row gy in line buffer line. Sprites never reach outside their
+// cell, so drawing cell by cell, bottom layer first, keeps the same order as comp_draw_cell.
+void scan_run(struct surface *line, struct cell *row, int gy, int first, int end, struct comp_grid *grid)
+{
+    struct scan_sprite sprites[25 * (NUM_LAYERS - 1)];
+    int num_sprites = 0;
+    int x0 = cell_x[gy * grid->width + first] - LEFTEND;
+    int w = (end - first) * cell_width;
+    int y0 = cell_y[gy * grid->width];
+
+    for (int gx = first; gx < end; ++gx) {
+        for (int l = LAYER_TILE + 1; l < NUM_LAYERS; ++l) {
+            struct layer *layer = &row[gx].layers[l];
+            if (!layer->sprite.img) continue;
+
+            sprites[num_sprites].layer = layer;
+            sprites[num_sprites].row = (unsigned int*)layer->sprite.img;
+            sprites[num_sprites].x = cell_x[gy * grid->width + gx] - LEFTEND;
+            num_sprites++;
+        }
+    }
+
+    for (int py = 0; py < cell_height; ++py) {
+        int y = y0 + py;
+
+        surface_blit(line, static_pixels + y * static_layer.width + x0, w, 1, x0, 0);
+
+        for (int i = 0; i < num_sprites; ++i) {
+            struct scan_sprite *s = &sprites[i];
+            struct image *img = &s->layer->sprite;
+            int mode = s->layer->mode;
+
+            if (py >= img->height) continue;
+            if (in_atlas(img)) {
+                s->row = surface_span_row(line, s->row, img->width, s->x, 0, mode & DRAW_MIRROR);
+                continue;
+            }
+            if (mode == DRAW_KEY) surface_blit_key(line, s->row, img->width, 1, s->x, 0, KEY_COLOR);
+            else if (mode == DRAW_ALPHA) surface_blit_alpha(line, s->row, img->width, 1, s->x, 0);
+            else surface_blit(line, s->row, img->width, 1, s->x, 0);
+            s->row += img->width;
+        }
+
+        fb_copy_surface(line, x0, 0, w, 1, LEFTEND + x0, y);
+    }
 }
 
+// The frame a renderer's bands are drawing: the cell stacks to draw, those last drawn, and whether to redraw all.
+struct frame_job
+{
+    struct cell *cells;
+    struct cell *last;
+    struct comp_grid *grid;
+    int all;
+};
 
-// Print black at every cell of the gamestate.
-void black_screen(struct gamestate *state)
+// Redraws the changed cells of one band of grid rows, a grid row at a time. Each row is split into runs of
+// neighbouring changed cells, so unchanged pixels are never written.
+void scan_band(int band, int bands, void *arg)
 {
-    for (int i = 0; i < state->width; ++i)
-    {
-        for (int j = 0; j < state->height; ++j)
-        {
-            myDrawImage((unsigned char*)black_image.pixel_data, black_image.width, black_image.height, grid_to_pixel_x(i, state->width), grid_to_pixel_y(j, state->height));
+    struct frame_job *f = arg;
+    struct comp_grid *grid = f->grid;
+    struct surface line = { scan_pixels[band], SCREENHEIGHT, 1 };
+    int all = f->all;
+
+    for (int gy = band_start(band, bands, grid->height); gy < band_start(band + 1, bands, grid->height); ++gy) {
+        struct cell *row = &f->cells[gy * grid->width];
+        struct cell *last_row = &f->last[gy * grid->width];
+        int gx = 0;
+
+        while (gx < grid->width) {
+            int first;
+
+            while (gx < grid->width && !all && comp_same(&row[gx], &last_row[gx])) gx++;
+            first = gx;
+            while (gx < grid->width && (all || !comp_same(&row[gx], &last_row[gx]))) gx++;
+            if (gx > first) scan_run(&line, row, gy, first, gx, grid);
         }
     }
 }
 
+// Redraws every changed cell, or every cell if all is set, with the grid rows split into a band per core.
+void scan_draw(struct cell *cells, struct cell *last, struct comp_grid *grid, int all)
+{
+    struct frame_job f = { cells, last, grid, all };
+    draw_bands(scan_band, &f);
+}
 
-// Print platforms and ladders at required position in game state....
-// This method will only be called at the very beginning of level. After that, platforms and ladders will be re-printed
-// only in necessary cells after DK/enemies move.
-void set_screen(struct gamestate *state)
+// Tile-binned renderer. The game box is split into square tiles. Changed cells mark the tiles they touch, every cell
+// with sprites is binned into the marked tiles it overlaps, and each marked tile is then composed in a buffer small
+// enough to stay in the L1 cache and streamed out to the screen. Overlapping sprites cost cache bandwidth instead of
+// framebuffer writes.
+#define TILE_SIZE 64
+#define TILES_ACROSS ((SCREENHEIGHT + TILE_SIZE - 1) / TILE_SIZE)
+#define TILE_BIN_MAX 16 // A tile overlaps at most 3x3 cells of 32 pixels or more.
+
+unsigned int __attribute__((aligned(16))) tile_pixels[SMP_CORES][TILE_SIZE * TILE_SIZE]; // A tile buffer per band.
+
+struct tile_bin
 {
+    int dirty;
+    int num_cells;
+    short cells[TILE_BIN_MAX]; // Cells with sprites that overlap the tile.
+};
 
-    for(int i = 0; i < (state->width * state->height); ++i){
-        if(state->map_tiles[i] == 0){
-            draw_image(state->background, grid_to_pixel_x((i % 25), state->width), grid_to_pixel_y((i / 25), state->height));
-        }
-        else if(state->map_tiles[i] == 1){        //Draw Platform
-            draw_image(state->platform, grid_to_pixel_x((i % 25), state->width), grid_to_pixel_y((i / 25), state->height));
+struct tile_bin tile_bins[TILES_ACROSS * TILES_ACROSS];
+
+// Marks the tiles under cell i as dirty, or if bin is set, adds the cell to every dirty tile under it.
+void tile_mark(int i, int bin)
+{
+    int x = cell_x[i] - LEFTEND;
+    int y = cell_y[i];
+    int tx1 = (x + cell_width - 1) / TILE_SIZE;
+    int ty1 = (y + cell_height - 1) / TILE_SIZE;
+
+    for (int ty = y / TILE_SIZE; ty <= ty1; ++ty) {
+        for (int tx = x / TILE_SIZE; tx <= tx1; ++tx) {
+            struct tile_bin *t = &tile_bins[ty * TILES_ACROSS + tx];
+
+            if (!bin) t->dirty = 1;
+            else if (t->dirty && t->num_cells < TILE_BIN_MAX) t->cells[t->num_cells++] = i;
         }
-        else if(state->map_tiles[i] == 2){        //Draw Ladder
-            draw_image(state->ladder, grid_to_pixel_x((i % 25), state->width), grid_to_pixel_y((i / 25), state->height));
+    }
+}
+
+// Draws a sprite onto a surface, like draw_sprite does to the screen.
+void draw_sprite_to(struct surface *s, struct image *img, int offx, int offy, int mode)
+{
+    if (in_atlas(img)) surface_blit_spans(s, (unsigned int*)img->img, img->width, img->height, offx, offy, mode & DRAW_MIRROR);
+    else if (mode == DRAW_KEY) surface_blit_key(s, (unsigned int*)img->img, img->width, img->height, offx, offy, KEY_COLOR);
+    else if (mode == DRAW_ALPHA) surface_blit_alpha(s, (unsigned int*)img->img, img->width, img->height, offx, offy);
+    else surface_blit(s, (unsigned int*)img->img, img->width, img->height, offx, offy);
+}
+
+// Composes one tile in buffer from the static layer and the cells binned into it, then streams it to the screen.
+void tile_compose(struct surface *buffer, int t, struct cell *cells)
+{
+    struct tile_bin *bin = &tile_bins[t];
+    int x = (t % TILES_ACROSS) * TILE_SIZE;
+    int y = (t / TILES_ACROSS) * TILE_SIZE;
+    int w = SCREENHEIGHT - x < TILE_SIZE ? SCREENHEIGHT - x : TILE_SIZE;
+    int h = SCREENHEIGHT - y < TILE_SIZE ? SCREENHEIGHT - y : TILE_SIZE;
+
+    surface_copy(buffer, &static_layer, x, y, w, h, 0, 0);
+
+    for (int j = 0; j < bin->num_cells; ++j) {
+        int i = bin->cells[j];
+        int offx = cell_x[i] - LEFTEND - x;
+        int offy = cell_y[i] - y;
+
+        for (int l = LAYER_TILE + 1; l < NUM_LAYERS; ++l) {
+            struct layer *layer = &cells[i].layers[l];
+            if (layer->sprite.img) draw_sprite_to(buffer, &layer->sprite, offx, offy, layer->mode);
         }
     }
+
+    fb_stream_surface(buffer, 0, 0, w, h, LEFTEND + x, y);
 }
 
+// Composes the marked tiles of one band of tile rows.
+void tile_band(int band, int bands, void *arg)
+{
+    struct frame_job *f = arg;
+    struct surface buffer = { tile_pixels[band], TILE_SIZE, TILE_SIZE };
+    int t0 = band_start(band, bands, TILES_ACROSS) * TILES_ACROSS;
+    int t1 = band_start(band + 1, bands, TILES_ACROSS) * TILES_ACROSS;
 
-// Erases every object in the gamestate.
-void erase_state(struct gamestate *state) {
-    // Erase DK...
-    draw_image(state->background, grid_to_pixel_x(state->dk.loc.x, state->width), grid_to_pixel_y(state->dk.loc.y, state->height));
+    for (int t = t0; t < t1; ++t) {
+        if (tile_bins[t].dirty) tile_compose(&buffer, t, f->cells);
+    }
+}
 
-    // Erase each enemy...
-    for (int i = 0; i < state->num_enemies; ++i)
-    {
-        draw_image(state->background, grid_to_pixel_x(state->enemies[i].loc.x, state->width), grid_to_pixel_y(state->enemies[i].loc.y, state->height));
+// Redraws every tile touched by a changed cell, or every tile if all is set. Tiles are marked and binned here, then
+// composed with the tile rows split into a band per core.
+void tile_draw(struct cell *cells, struct cell *last, struct comp_grid *grid, int all)
+{
+    int num_cells = grid->width * grid->height;
+
+    for (int t = 0; t < TILES_ACROSS * TILES_ACROSS; ++t) {
+        tile_bins[t].dirty = all;
+        tile_bins[t].num_cells = 0;
     }
 
-    // Erase each pack...
-    for (int i = 0; i < state->num_packs; ++i)
-    {
-        draw_image(state->background, grid_to_pixel_x(state->packs[i].loc.x, state->width), grid_to_pixel_y(state->packs[i].loc.y, state->height));
+    for (int i = 0; i < num_cells; ++i) {
+        if (!all && !comp_same(&cells[i], &last[i])) tile_mark(i, 0);
     }
 
-    // Erase each vehicle...
-    for (int i = 0; i < state->num_vehicles; ++i)
-    {
-        draw_image(state->background, grid_to_pixel_x(state->vehicles[i].start.loc.x, state->width), grid_to_pixel_y(state->vehicles[i].start.loc.y, state->height));
-        draw_image(state->background, grid_to_pixel_x(state->vehicles[i].finish.loc.x, state->width), grid_to_pixel_y(state->vehicles[i].finish.loc.y, state->height));
+    for (int i = 0; i < num_cells; ++i) {
+        for (int l = LAYER_TILE + 1; l < NUM_LAYERS; ++l) {
+            if (cells[i].layers[l].sprite.img) {
+                tile_mark(i, 1);
+                break;
+            }
+        }
     }
 
-    // Erase exit...
-    draw_image(state->background, grid_to_pixel_x(state->exit.loc.x, state->width), grid_to_pixel_y(state->exit.loc.y, state->height));
+    struct frame_job f = { cells, last, grid, all };
+    draw_bands(tile_band, &f);
+}
 
-    // Erase time, score, lives...
-    drawRect(SCREENWIDTH - 200, 0, SCREENWIDTH + 50, 3*FONT_HEIGHT + 50, 0x0, 1);
+void comp_redraw(void *arg, int a, int b)
+{
+    comp_redraw_all = 1;
+}
+
+// Forces every cell to be redrawn by the next compose_frame, e.g. after something was drawn over the game box.
+void comp_invalidate()
+{
+    render_push(comp_redraw, 0, 0, 0);
+}
+
+// Render command: redraws the cells of frame f whose stacks changed since the last frame drawn.
+void comp_render(void *arg, int f, int unused)
+{
+    struct comp_grid *grid = &comp_grids[f];
+    struct cell *cells = comp_cells[f];
+    struct cell *last = comp_last;
+    struct prof_mark t = prof_start();
+
+#if RENDERER == RENDER_SCANLINE
+    scan_draw(cells, last, grid, comp_redraw_all);
+#elif RENDERER == RENDER_TILES
+    tile_draw(cells, last, grid, comp_redraw_all);
+#else
+    int num_cells = grid->width * grid->height;
+
+    // A full redraw copies the whole static layer in one go, then adds whatever is on top of it.
+    if (comp_redraw_all) {
+        draw_static(LEFTEND, 0, static_layer.width, static_layer.height);
+        for (int i = 0; i < num_cells; ++i) comp_draw_cell(i, &cells[i]);
+    } else {
+        short changed[25 * 25];
+        int num_changed = 0;
+
+        for (int i = 0; i < num_cells; ++i) {
+            if (!comp_same(&cells[i], &last[i])) changed[num_changed++] = i;
+        }
+
+        // Restore the tiles of all the changed cells before drawing over any of them. Background fills go first, as
+        // CPU drawing waits for queued DMA copies. The other tiles may then be queued for the DMA engine as one chain,
+        // and all the sprites drawn after it, so the CPU waits for it once a frame rather than once a cell.
+        for (int j = 0; j < num_changed; ++j) {
+            int i = changed[j];
+            if (comp_solid_tile(&cells[i], grid)) draw_background(&grid->background, cell_x[i], cell_y[i]);
+        }
+        for (int j = 0; j < num_changed; ++j) {
+            int i = changed[j];
+            if (!comp_solid_tile(&cells[i], grid)) draw_static_cell(i, &cells[i].layers[LAYER_TILE].sprite);
+        }
+        fb_flush();
+
+        for (int j = 0; j < num_changed; ++j) comp_draw_cell(changed[j], &cells[changed[j]]);
+    }
+#endif
+
+    comp_redraw_all = 0;
+    comp_last = cells;
+    prof_stop(PROF_RENDER, t);
+}
+
+// Builds the layer stacks for the current gamestate and queues them to be drawn. Only the cells whose stacks changed
+// since the last frame are redrawn. Draw order is fixed by the layers, so overlapping objects always come out right.
+void compose_frame(struct gamestate *state)
+{
+    struct cell *cells = comp_cells[comp_current];
+    int num_cells = state->width * state->height;
+
+    // The frame this one overwrites is what the next oldest frame is compared with, so that must be drawn first.
+    render_wait(comp_seq[(comp_current + 1) % COMP_FRAMES]);
 
-    // Erase all ladders and platforms...
-    for (int i = 0; i < state->width*state->height; ++i) {
-        if (state->map_tiles[i] > 0) draw_image(state->background, grid_to_pixel_x(i % state->width, state->width), grid_to_pixel_y(i / state->width, state->height));
+    // Tiles...
+    for (int i = 0; i < num_cells; ++i) {
+        struct cell *c = &cells[i];
+        for (int l = 1; l < NUM_LAYERS; ++l) c->layers[l].sprite.img = 0;
+
+        if (state->map_tiles[i] == 0) c->layers[LAYER_TILE].sprite = state->background;
+        else if (state->map_tiles[i] == 1) c->layers[LAYER_TILE].sprite = state->platform;
+        else c->layers[LAYER_TILE].sprite = state->ladder;
+        c->layers[LAYER_TILE].mode = DRAW_OPAQUE;
+    }
+
+    // Packs, vehicles and the exit...
+    for (int i = 0; i < state->num_packs; ++i) {
+        if (state->packs[i].exists) comp_put(cells, LAYER_PACK, &state->packs[i].sprite, state->packs[i].loc, DRAW_ALPHA, state);
+    }
+    for (int i = 0; i < state->num_vehicles; ++i) {
+        comp_put(cells, LAYER_PACK, &state->vehicles[i].start.sprite, state->vehicles[i].start.loc, DRAW_ALPHA, state);
+        comp_put(cells, LAYER_PACK, &state->vehicles[i].finish.sprite, state->vehicles[i].finish.loc, DRAW_ALPHA, state);
     }
+    if (state->exit.exists) comp_put(cells, LAYER_PACK, &state->exit.sprite, state->exit.loc, DRAW_ALPHA, state);
 
+    // Enemies, then DK so that he is never hidden...
+    for (int i = 0; i < state->num_enemies; ++i) {
+        if (state->enemies[i].exists) comp_put(cells, LAYER_ACTOR, &state->enemies[i].sprite, state->enemies[i].loc, DRAW_ALPHA | (state->enemies[i].mirrored ? DRAW_MIRROR : 0), state);
+    }
+    comp_put(cells, LAYER_ACTOR, &state->dk.sprite, state->dk.loc, DRAW_KEY | (state->dk.mirrored ? DRAW_MIRROR : 0), state);
+
+    // The boomerang, unless it is back in DK's hands.
+    if (state->boomerang.exists && !(state->boomerang.loc.x == state->dk.loc.x && state->boomerang.loc.y == state->dk.loc.y))
+        comp_put(cells, LAYER_PROJECTILE, &state->boomerang.sprite, state->boomerang.loc, DRAW_KEY, state);
+
+    comp_grids[comp_current].width = state->width;
+    comp_grids[comp_current].height = state->height;
+    comp_grids[comp_current].background = state->background;
+
+    // Redraw what changed.
+    comp_seq[comp_current] = render_push(comp_render, 0, comp_current, 0);
+    comp_current = (comp_current + 1) % COMP_FRAMES;
 }
 
+// Render command: shows value in a HUD field.
+void hud_update(void *arg, int field, int value)
+{
+    hud_set(field, value);
+}
 
-// Draws background at specified coordinates. In particular, draws platform/ladder if specified in mapTiles,
-// else draw black.
-void draw_background(int x, int y, struct gamestate *state) {
-    if (state->map_tiles[(state->width)*y + x] == 0) draw_image(state->background, grid_to_pixel_x(x, state->width), grid_to_pixel_y(y, state->height));
-    else if (state->map_tiles[(state->width)*y + x] == 1) draw_image(state->platform, grid_to_pixel_x(x, state->width), grid_to_pixel_y(y, state->height));
-    else draw_image(state->ladder, grid_to_pixel_x(x, state->width), grid_to_pixel_y(y, state->height));
+// Render command: shows the frame drawn so far.
+void present_frame(void *arg, int a, int b)
+{
+    struct prof_mark t = prof_start();
+    fb_present();
+    prof_stop(PROF_PRESENT, t);
 }
 
+// Main drawing method - draws a game state.
+// Coordinates of all objects are in grid coords, so need to convert these to pixel
+// coords in order to draw.
+void draw_state(struct gamestate * state, unsigned int elapsed) {
+    // Draw DK, enemies, packs, vehicles, the exit and the boomerang in every cell that changed...
+    compose_frame(state);
 
-// Draws black at every pixel on screen. Only used for testing.
-void all_black() {
-    for (int i = 0; i < SCREENWIDTH; ++i) {
-        for (int j = 0; j < SCREENHEIGHT; ++j) {
-            drawPixel(i, j, 0x0);
+    // Update and print score...
+    state->score = state->time + (250000 * state->lives) + (250000 * state->dk.num_coins_grabbed) + (250000 * state->dk.num_killed);
+    render_push(hud_update, 0, HUD_SCORE, state->score);
+
+    // Update and print time remaining...
+
+    // Take off the time elapsed since the last frame, in thousandths of a second.
+    state->time -= elapsed / 1000;
+
+    // If state.time is now leq 0, set loseflag.
+    if (state->time <= 0)
+        state->loseflag = 1;
+
+    render_push(hud_update, 0, HUD_TIME, state->time);
+
+    // Print lives remaining... (replace with hearts later)
+    render_push(hud_update, 0, HUD_LIVES, state->lives);
+
+    // End of drawing gamestate.
+}
+
+
+// Clear the game box to black.
+void black_screen(struct gamestate *state)
+{
+    fill_rect_banded(LEFTEND, 0, SCREENHEIGHT, SCREENHEIGHT, 0);
+}
+
+
+// Print platforms and ladders at required position in game state....
+// This method will only be called at the very beginning of level, or after something was drawn over the game box.
+// The compositor redraws every cell on the next frame, after that only cells that change are redrawn.
+void set_screen(struct gamestate *state)
+{
+    comp_invalidate();
+}
+
+
+// Erases every object in the gamestate.
+void erase_state(struct gamestate *state) {
+    render_sync();
+
+    struct cell *last = comp_last;
+
+    // Only cells that aren't plain background on screen need erasing...
+    for (int i = 0; i < state->width * state->height; ++i) {
+        if (comp_redraw_all || last[i].layers[LAYER_TILE].sprite.img != state->background.img || last[i].layers[LAYER_PACK].sprite.img
+            || last[i].layers[LAYER_ACTOR].sprite.img || last[i].layers[LAYER_PROJECTILE].sprite.img) {
+            draw_background(&state->background, cell_x[i], cell_y[i]);
         }
     }
+
+    // The screen no longer shows the last composed frame.
+    comp_invalidate();
+
+    // Erase time, score, lives...
+    hud_clear();
+}
+
+
+// Draws black at every pixel on screen. Only used for testing.
+void all_black() {
+    fill_rect_banded(0, 0, SCREENWIDTH, SCREENHEIGHT, 0);
+    hud_invalidate();
 }
 
 
@@ -513,7 +933,8 @@ void all_black() {
 void display_score(struct gamestate *state) {
     drawString(SCREENWIDTH/2 - 100, SCREENHEIGHT/2, "Final score:", 0xF);
     draw_int(state->score, SCREENWIDTH/2 + 100, SCREENHEIGHT/2, 0xF);
-    wait(2000000);      // display for 2 seconds...
+    fb_present();
+    replay_wait(2000000);      // display for 2 seconds...
     // Erase.
     drawRect(SCREENWIDTH/2 - 150, SCREENHEIGHT/2 - 25, SCREENWIDTH/2 + 150, SCREENHEIGHT/2 + 25, 0x0, 1);
 }
@@ -527,7 +948,6 @@ void display_score(struct gamestate *state) {
  * Start Menu option selection logic. Can either select "Start" or "Quit" in initial menu.
  * Returns 1 if start is selected, -1 if quit is selected, and 0 if nothing has been selected.
  */
- /*
 int startMenuSelectOption(int *buttons, struct startMenu *start)
 {
     if (buttons[4] == 0)
@@ -565,6 +985,15 @@ int startMenuSelectOption(int *buttons, struct startMenu *start)
 }
 
 
+// Draws a compressed asset at specified pixel offsets.
+void draw_asset(int id, int offx, int offy)
+{
+    int width, height;
+    const unsigned int *pixels = asset_load(id, &width, &height);
+
+    if (pixels) blit_banded(pixels, width, height, offx, offy);
+}
+
 // Draws start menu, runs start menu selection process.
 // Returns start_flag - equal to 1 if start was selected, -1 if quit was selected.
 int start_menu(struct startMenu *sm, int *buttons) {
@@ -575,28 +1004,29 @@ int start_menu(struct startMenu *sm, int *buttons) {
 
     // Draw rectangle border...
     //drawRect(SCREENWIDTH / 2 - 100, SCREENHEIGHT / 2 - 100, SCREENWIDTH / 2 + 100, SCREENHEIGHT / 2 + 100, 0xF, 0);
-    myDrawImage((unsigned char*)title_screen.pixel_data, title_screen.width, title_screen.height, SCREENWIDTH / 2 - 240, 150);
-    myDrawImage((unsigned char*)title_donkey.pixel_data, title_donkey.width, title_donkey.height, SCREENWIDTH / 2 - 250, 275);
+    draw_asset(ASSET_TITLE_SCREEN, SCREENWIDTH / 2 - 240, 150);
+    draw_asset(ASSET_TITLEDONKEY, SCREENWIDTH / 2 - 250, 275);
 
     while (start_flag == 0)
     {
         // Display selection options with currently selected option being pointed to...
         if (sm->startGameSelected)
         {
-            myDrawImage((unsigned char*)start_selected.pixel_data, start_selected.width, start_selected.height, SCREENWIDTH / 2 - 48, 700);
-            myDrawImage((unsigned char*)exit.pixel_data, exit.width, exit.height, SCREENWIDTH / 2 - 48, 750);
+            draw_asset(ASSET_STARTSELECTED, SCREENWIDTH / 2 - 48, 700);
+            draw_asset(ASSET_EXIT, SCREENWIDTH / 2 - 48, 750);
         }
         else
         {
-            myDrawImage((unsigned char*)start.pixel_data, start.width, start.height, SCREENWIDTH / 2 - 48, 700);
-            myDrawImage((unsigned char*)exit_selected.pixel_data, exit_selected.width, exit_selected.height, SCREENWIDTH / 2 - 48, 750);
+            draw_asset(ASSET_START, SCREENWIDTH / 2 - 48, 700);
+            draw_asset(ASSET_EXITSELECTED, SCREENWIDTH / 2 - 48, 750);
         }
 
         drawString(0, 0, "Benjamin Frey 30088566", 0xF);
         drawString(0, 10, "Adam Mogensen 30071819", 0xF);
+        fb_present();
         // Loop while startMenuSelectOption returns 0 - so breaks when player presses
         // A on either start or quit option.
-        read_SNES(buttons);
+        replay_input(buttons);
         // Pass address of sm so that flag attributes can be modified by function.
         // Function will automatically erase text when selection moves up/down.
         start_flag = startMenuSelectOption(buttons, sm);
@@ -607,7 +1037,6 @@ int start_menu(struct startMenu *sm, int *buttons) {
 
     return start_flag;
 }
-*/
 
 
 // Returns 0 to return to gameplay, 1 to exit game, 2 to restart.
@@ -615,7 +1044,9 @@ int pause_menu(int *buttons, struct gamestate *state) {
     int restart_pressed = 1;
     int pressed_a = 0;
     int exit_game = 0;
-    wait(500000); // Wait for a bit to stop menu from immediately closing.
+    render_sync(); // The menu draws over the game box, so the frame being drawn must be finished first.
+    prof_dump();
+    replay_wait(500000); // Wait for a bit to stop menu from immediately closing.
 
     // Draw white rectangle border and black rectangle fill...
     drawRect(SCREENWIDTH / 2 - 75, SCREENHEIGHT / 2 - 50, SCREENWIDTH / 2 + 200, SCREENHEIGHT / 2 + 100, 0x0, 1);
@@ -632,15 +1063,16 @@ int pause_menu(int *buttons, struct gamestate *state) {
                     drawString(SCREENWIDTH / 2, SCREENHEIGHT / 2, "   RESTART GAME", 0xF);
                     drawString(SCREENWIDTH / 2, SCREENHEIGHT / 2 + 50, "-> QUIT GAME", 0xF);
                 }
+        fb_present();
 
         // Read controller...
-        read_SNES(buttons);
+        replay_input(buttons);
 
         // If start is pressed again, wait for a bit and then break (to prevent pause
         // menu from immediately opening again).
         if (buttons[4 - 1] == 0)
         {
-            wait(500000);
+            replay_wait(500000);
             break;
         }
 
@@ -679,7 +1111,8 @@ int pause_menu(int *buttons, struct gamestate *state) {
         if (restart_pressed) exit_game = 2; // Restart first level.
         else {
             drawString(SCREENWIDTH / 2 - 25, SCREENHEIGHT / 2, "Exiting...", 0xF);
-            wait(2000000);
+            fb_present();
+            replay_wait(2000000);
             drawString(SCREENWIDTH / 2 - 25, SCREENHEIGHT / 2, "          ", 0xF);
             exit_game = 1;
         }
@@ -698,7 +1131,7 @@ void DKmove(int *buttons, struct gamestate *state)
 
     int pressed = 0;
 
-    // Record old coordinates so that background can be drawn there.
+    // Record old coordinates.
     int oldx = (*state).dk.loc.x;
     int oldy = (*state).dk.loc.y;
 
@@ -712,7 +1145,7 @@ void DKmove(int *buttons, struct gamestate *state)
         if (oldx + (*state).dk.speed <= (*state).width - 1)
         {
             // Ensure that DK does not step outside of screen
-            // uart_puts("Right\n");
+            // hal_log("Right\n");
             pressed = 7;
             newx = (*state).dk.loc.x + (*state).dk.speed;
             (*state).dk.enemy_direction = 1;
@@ -724,7 +1157,7 @@ void DKmove(int *buttons, struct gamestate *state)
         if (oldx - (*state).dk.speed >= 0)
         {
             // Ensure that DK does not step outside of screen
-            // uart_puts("Left\n");
+            // hal_log("Left\n");
             pressed = 6;
             newx = (*state).dk.loc.x - (*state).dk.speed;
             (*state).dk.enemy_direction = 0;
@@ -736,7 +1169,7 @@ void DKmove(int *buttons, struct gamestate *state)
         if (oldy - (*state).dk.speed >= 0)
         {
             // Ensure that DK does not step outside of screen
-            // uart_puts("Up\n");
+            // hal_log("Up\n");
             pressed = 4;
             newy = (*state).dk.loc.y - (*state).dk.speed;
             (*state).dk.enemy_direction = 2;
@@ -748,7 +1181,7 @@ void DKmove(int *buttons, struct gamestate *state)
         if (oldy + (*state).dk.speed <= (*state).height - 1)
         {
             // Ensure that DK does not step outside of screen
-            // uart_puts("Down\n");
+            // hal_log("Down\n");
             pressed = 5;
             newy = (*state).dk.loc.y + (*state).dk.speed;
             (*state).dk.enemy_direction = 2;
@@ -758,71 +1191,57 @@ void DKmove(int *buttons, struct gamestate *state)
     // If the cell DK wants to move to (may be current cell) is valid, update drawing and position of DK.
     if (is_valid_cell(newx, newy, state)) {
 
-        // uart_puts("Valid\n");
+        // hal_log("Valid\n");
 
         // Move DK to new valid cell...
         state->dk.loc.x = newx;
         state->dk.loc.y = newy;
 
-        // If DK moved, he loses his immunity and we redraw the background at his old location.
-        // If DK hasn't moved we don't redraw the background - this is to prevent DK from fading
-        // in and out of black.
+        // If DK moved, he loses his immunity. The compositor redraws both his old and new cells.
         if (pressed > 0)
         {
             (*state).dk.dk_immunity = 0;
-
-            // Redraw background at old location... will depend on whether cell is occupied by a ladder, platform, or nothing.
-            draw_background(oldx, oldy, state);
-            // draw_image((*state).background, grid_to_pixel_x(oldx, (*state).width), grid_to_pixel_y(oldy, (*state).height));
-
-            // Check for vehicle trampling...
-            // DK can only trample vehicle exits by colliding with them, but need to untrample both exits and entrances
-            // as DK can trample them by teleporting.
-            for (int i = 0; i < state->num_vehicles; ++i) {
-                // If new location corresponds to a vehicle exit, trample if not bidirectional...
-                if (state->vehicles[i].finish.loc.x == newx && state->vehicles[i].finish.loc.y == newy && !(state->vehicles[i].bidirectional)) {
-                    state->vehicles[i].finish.trampled = 1;
-                }
-                // If old location corresponds to a vehicle exit, untrample...
-                if (state->vehicles[i].finish.loc.x == oldx && state->vehicles[i].finish.loc.y == oldy) {
-                    state->vehicles[i].finish.trampled = 0;
-                }
-                // If old location corresponds to a vehicle entrance, untrample...
-                if (state->vehicles[i].start.loc.x == oldx && state->vehicles[i].start.loc.y == oldy) {
-                    state->vehicles[i].start.trampled = 0;
-                }
-            }
         }
-
-        // Regardless of whether DK moved, draw him at his new location...
-        draw_grid(&((*state).dk), (*state).width, (*state).height);
-        // draw_image((*state).dk.sprite, (*state).dk.loc.x * (SCREENWIDTH / (*state).width), (*state).dk.loc.y * (SCREENHEIGHT / (*state).height));
     }
 
     // Else, cell is invalid - do not move DK.
     // I think that I've set this up so that DKs sprite will still update when he tries to move to a non-valid cell,
     // which I think is what we want.
-    else {
-        // Draw DK at his old (and current) location....
-        draw_grid(&(state->dk), state->width, state->height);
-    }
+}
+
+
+// Points a sprite at a frame of the atlas.
+void atlas_image(struct image *img, int frame)
+{
+    img->img = (unsigned char*) &atlas_spans[atlas_frames[frame].offset];
+    img->width = atlas_frames[frame].width;
+    img->height = atlas_frames[frame].height;
+}
+
+// Points an object's sprite at a frame of the atlas. Mirrored frames are drawn flipped left to right.
+void set_frame(struct object *obj, int frame, int mirrored)
+{
+    obj->frame = frame;
+    obj->mirrored = mirrored;
+    atlas_image(&obj->sprite, frame);
+}
+
+// Same for the boomerang, which is never mirrored.
+void set_boomerang_frame(struct projectile *boomerang, int frame)
+{
+    boomerang->frame = frame;
+    atlas_image(&boomerang->sprite, frame);
 }
 
 
 // Updates DKs sprite to be consistent with the direction he's facing.
 // Flag indicates whether to use the first or second sprite.
 void updateDKdirection(struct gamestate *state, int flag) {
-    if (state->dk.enemy_direction == 1) {
-        // Facing right...
-        if (flag) state->dk.sprite.img = (unsigned char*) dk_right1.pixel_data;
-        else state->dk.sprite.img = (unsigned char*) dk_right2.pixel_data;
-    } else if (state->dk.enemy_direction == 0) {
-        // Facing left...
-        if (flag) state->dk.sprite.img = (unsigned char*) dk_left1.pixel_data;
-        else state->dk.sprite.img = (unsigned char*) dk_left2.pixel_data;
+    if (state->dk.enemy_direction == 1 || state->dk.enemy_direction == 0) {
+        // Facing right, or left using the mirrored right frames...
+        set_frame(&state->dk, flag ? ATLAS_DK_RIGHT1 : ATLAS_DK_RIGHT2, state->dk.enemy_direction == 0);
     } else if (state->dk.enemy_direction == 2) {
-        if (flag) state->dk.sprite.img = (unsigned char*) dk_ladder1.pixel_data;
-        else state->dk.sprite.img = (unsigned char*) dk_ladder2.pixel_data;
+        set_frame(&state->dk, flag ? ATLAS_DK_UP1 : ATLAS_DK_UP2, 0);
     }
 }
 
@@ -830,38 +1249,17 @@ void updateDKdirection(struct gamestate *state, int flag) {
 // Updates enemy sprite to be consistent with direction being faced.
 // Flag indicates whether to use first or second sprite.
 void updateEnemyDirection(struct object *enemy, int flag) {
+    int left = (enemy->enemy_direction == 0);
+
+    if (enemy->enemy_direction != 0 && enemy->enemy_direction != 1) return;
+
     if (!(enemy->flying)) {
         // Non-flying enemy sprites...
-        if (enemy->enemy_direction == 1) {
-            // Facing right
-            // First right sprite
-            if (flag) enemy->sprite.img = (unsigned char*) mario_right1.pixel_data;
-            // Second right sprite
-            else enemy->sprite.img = (unsigned char*) mario_right2.pixel_data;
-
-        } else if (enemy->enemy_direction == 0) {
-            // Facing left
-            // First left sprite
-            if (flag) enemy->sprite.img = (unsigned char*) mario_left1.pixel_data;
-            // Second left sprite
-            else enemy->sprite.img = (unsigned char*) mario_left2.pixel_data;
-        }
+        set_frame(enemy, flag ? ATLAS_MARIO_RIGHT1 : ATLAS_MARIO_RIGHT2, left);
     } else {
-        // Flying enemy sprites...
-        if (enemy->enemy_direction == 1) {
-            // Facing right
-            // First right sprite
-            if (flag) enemy->sprite.img = (unsigned char*) bird_right1.pixel_data;
-            // Second right sprite
-            else enemy->sprite.img = (unsigned char*) bird_right3.pixel_data;
-
-        } else if (enemy->enemy_direction == 0) {
-            // Facing left
-            // First left sprite
-            if (flag) enemy->sprite.img = (unsigned char*) bird_left1.pixel_data;
-            // Second left sprite
-            else enemy->sprite.img = (unsigned char*) bird_left2.pixel_data;
-        }
+        // Flying enemy sprites. Facing right the wings go between frames 1 and 3, facing left between 1 and 2.
+        if (left) set_frame(enemy, flag ? ATLAS_BIRD_RIGHT1 : ATLAS_BIRD_RIGHT2, 1);
+        else set_frame(enemy, flag ? ATLAS_BIRD_RIGHT1 : ATLAS_BIRD_RIGHT3, 0);
     }
 }
 
@@ -874,10 +1272,6 @@ void updateEnemyDirection(struct object *enemy, int flag) {
  */
 void updateBoomerang(struct gamestate *state)
 {
-    // Store old location of boomerang for drawing purposes
-    int oldx = (*state).boomerang.loc.x;
-    int oldy = (*state).boomerang.loc.y;
-
     // Move boomerang in specified direction.
     if ((*state).boomerang.direction == 0 && (*state).boomerang.loc.x != 0)
     {
@@ -926,29 +1320,20 @@ void updateBoomerang(struct gamestate *state)
         (*state).dk.has_boomerang = 1;
     }
 
-    if ((*state).boomerang.sprite.img == bananarang.pixel_data)
+    if ((*state).boomerang.frame == ATLAS_BANANARANG)
     {
-        (*state).boomerang.sprite.img = (unsigned char*) bananarang2.pixel_data;
+        set_boomerang_frame(&(*state).boomerang, ATLAS_BANANARANG2);
     }
-    else if ((*state).boomerang.sprite.img == bananarang2.pixel_data)
+    else if ((*state).boomerang.frame == ATLAS_BANANARANG2)
     {
-        (*state).boomerang.sprite.img = (unsigned char*) bananarang3.pixel_data;
+        set_boomerang_frame(&(*state).boomerang, ATLAS_BANANARANG3);
     }
-    else if ((*state).boomerang.sprite.img == bananarang3.pixel_data)
+    else if ((*state).boomerang.frame == ATLAS_BANANARANG3)
     {
-        (*state).boomerang.sprite.img = (unsigned char*) bananarang.pixel_data;
+        set_boomerang_frame(&(*state).boomerang, ATLAS_BANANARANG);
     }
 
-    // Draw boomerang if current position is not dk's position.
-    if ((*state).boomerang.loc.x != (*state).dk.loc.x)
-    {
-        draw_image((*state).boomerang.sprite, grid_to_pixel_x((*state).boomerang.loc.x, (*state).width), grid_to_pixel_y((*state).boomerang.loc.y, (*state).height));
-    }
-    // Draw background if previous position is not dk's position (as to not erase dk)
-    if (oldx != (*state).dk.loc.x)
-    {
-        draw_background(oldx, oldy, state);
-    }
+    // The compositor draws the boomerang at its new location and restores its old one.
 }
 
 
@@ -1019,9 +1404,6 @@ void checkDKCollisions(struct gamestate *state) {
                 state->dk.loc.y = state->vehicles[i].finish.loc.y;
 
                 state->dk.dk_immunity = 1; // Set immunity.
-
-                // Trample finish...
-                state->vehicles[i].finish.trampled = 1;
             }
 
             // Check for collision with finish (only teleports DK if vehicle is bidirectional)
@@ -1036,9 +1418,6 @@ void checkDKCollisions(struct gamestate *state) {
                 state->dk.loc.y = state->vehicles[i].start.loc.y;
 
                 state->dk.dk_immunity = 1; // Set immunity.
-
-                // Trample start...
-                state->vehicles[i].start.trampled = 1;
             }
         }
     }
@@ -1066,7 +1445,7 @@ int is_valid_cell(int x, int y, struct gamestate *state) {
 
 
 // Spawns a pack randomly in the gamestate.
-// Random location is simulated by the clock register.
+// Random location comes from replay_random, so that replays spawn the same packs.
 // If flag is 1, spawn a health pack. If 0, spawn a point pack.
 void spawn_pack(struct gamestate *state, int flag) {
 
@@ -1082,8 +1461,8 @@ void spawn_pack(struct gamestate *state, int flag) {
 
         while (!is_valid_cell(x, y, state) || pack_there || is_ladder) {
             // Select a random cell on the game map until a valid cell is found...
-            x = *clo % state->width;
-            y = *clo % state->height;
+            x = replay_random() % state->width;
+            y = replay_random() % state->height;
 
             // Check if there is a pack at (x, y)...
             pack_there = 0;
@@ -1114,67 +1493,28 @@ void spawn_pack(struct gamestate *state, int flag) {
         state->packs[state->num_packs - 1].loc.y = y;
 
         state->packs[state->num_packs - 1].exists = 1;
-        state->packs[state->num_packs - 1].trampled = 0;
 
         if (flag) {
             // Spawn a health pack at coordinates (x, y)...
-            state->packs[state->num_packs - 1].sprite.img = (unsigned char*) heartpack.pixel_data;
-            state->packs[state->num_packs - 1].sprite.width = heartpack.width;
-            state->packs[state->num_packs - 1].sprite.height = heartpack.height;
+            set_frame(&state->packs[state->num_packs - 1], ATLAS_HEARTPACK, 0);
             state->packs[state->num_packs - 1].health_pack = 1;
             state->packs[state->num_packs - 1].point_pack = 0;
             state->packs[state->num_packs - 1].boomerang_pack = 0;
         } else {
             // Spawn a point pack at coordinates (x, y)...
-            state->packs[state->num_packs - 1].sprite.img = (unsigned char*) coinpack.pixel_data;
-            state->packs[state->num_packs - 1].sprite.width = coinpack.width;
-            state->packs[state->num_packs - 1].sprite.height = coinpack.height;
+            set_frame(&state->packs[state->num_packs - 1], ATLAS_COINPACK, 0);
             state->packs[state->num_packs - 1].health_pack = 0;
             state->packs[state->num_packs - 1].point_pack = 1;
             state->packs[state->num_packs - 1].boomerang_pack = 0;
         }
 
-        uart_puts("Pack spawned...\n");
+        hal_log("Pack spawned...\n");
 
     }
 
 }
 
 
-// Set trampled of any vehicles or packs occupying cell (x, y) to true.
-void setTrampled(struct gamestate *state, int x, int y) {
-    // Check packs...
-    for (int i = 0; i < state->num_packs; ++i) {
-        if (state->packs[i].loc.x == x && state->packs[i].loc.y == y) state->packs[i].trampled = 1;
-    }
-    // Check vehicles...
-    for (int i = 0; i < state->num_vehicles; ++i) {
-        if (state->vehicles[i].start.loc.x == x && state->vehicles[i].start.loc.y == y) state->vehicles[i].start.trampled = 1;
-        // vehicle entrances and exits are never located at the same cell...
-        else if (state->vehicles[i].finish.loc.x == x && state->vehicles[i].finish.loc.y == y) state->vehicles[i].finish.trampled = 1;
-    }
-    // Check exit..
-    if (state->exit.loc.x == x && state->exit.loc.y == y) state->exit.trampled = 1;
-}
-
-
-// Untramples any pack, vehicle, or exit located at cell (x, y).
-void untrample(struct gamestate *state, int x, int y) {
-    // Check packs...
-    for (int i = 0; i < state->num_packs; ++i) {
-        if (state->packs[i].loc.x == x && state->packs[i].loc.y == y) state->packs[i].trampled = 0;
-    }
-    // Check vehicles...
-    for (int i = 0; i < state->num_vehicles; ++i) {
-        if (state->vehicles[i].start.loc.x == x && state->vehicles[i].start.loc.y == y) state->vehicles[i].start.trampled = 0;
-        // vehicle entrances and exits are never located at the same cell...
-        else if (state->vehicles[i].finish.loc.x == x && state->vehicles[i].finish.loc.y == y) state->vehicles[i].finish.trampled = 0;
-    }
-    // Check exit..
-    if (state->exit.loc.x == x && state->exit.loc.y == y) state->exit.trampled = 0;
-}
-
-
 //////////
 // MAIN //
 //////////
@@ -1182,13 +1522,7 @@ void untrample(struct gamestate *state, int x, int y) {
 int main()
 {
 
-    // Define printf using provided uart methods.
-    void printf(char *str)
-    {
-        uart_puts(str);
-    }
-
-    uart_puts("Running\n");
+    hal_log("Running\n");
 
     /////////////////////////////
     // First, set up driver... //
@@ -1199,22 +1533,35 @@ int main()
     for (int i = 0; i < 16; ++i)
         buttons[i] = 1;
 
-    // Initialize SNES lines and frame buffer.
-    init_snes_lines();
-    fb_init();
+    // Initialize the platform (SNES lines on the Pi) and frame buffer.
+    hal_init();
+    replay_init();
+    prof_init();
+    fb_init(FB_WIDTH, FB_HEIGHT, hal_fb_depth(SCREEN_DEPTH));
 
-    uart_puts("Initialized\n");
+    // Turn on the MMU and caches now that we know where the framebuffer is. Once it is normal memory, fills can use
+    // DC ZVA.
+    unsigned long fb_start, fb_size;
+    fb_region(&fb_start, &fb_size);
+    mmu_init(fb_start, fb_size);
+    fb_enable_zva();
+    fb_use_dma(1);
+
+    // Wake the other three cores to draw bands of large redraws, and give one of them the game loop's drawing.
+    smp_init();
+    if (RENDER_CORE) render_start(RENDER_CORE);
+
+    prepare_sprites();
+    hud_init(SCREENWIDTH - 200, SCREENWIDTH, FONT_HEIGHT);
+
+    hal_log("Initialized\n");
 
     // Uncomment the below to fully clear screen...
     //all_black();
 
-<<<<<<<< HEAD:build/fast source/main.c
-// No start menu in this version.
-========
     /////////////////////////////////
     // START MENU - BASICALLY DONE //
     /////////////////////////////////
->>>>>>>> 506ed3f028e60503dade4f8018f253560320668c:source/main.c
 
     struct gamestate state;
 
@@ -1226,10 +1573,20 @@ int main()
 
 start_menu:
 
+    {
+        struct startMenu sm;
+        if (start_menu(&sm, buttons) == -1) {
+            drawString(SCREENWIDTH / 2 - 25, SCREENHEIGHT / 2, "Exiting...", 0xF);
+            fb_present();
+            return 0;
+        }
+    }
+
 first_stage:
 
     state.width = 25;
     state.height = 25;
+    build_cell_table(&state);
 
     // The below chunk of variables ARE NOT RESET BETWEEN LEVELS - should transfer
     // from level to level.
@@ -1259,10 +1616,9 @@ first_stage:
 
     // DK data...
 
-    state.dk.sprite.img = (unsigned char*) dk_right1.pixel_data; // Initial image of DK will be standing, facing right.
-    state.dk.sprite.width = dk_right1.width;
-    state.dk.sprite.height = dk_right1.height;
+    set_frame(&state.dk, ATLAS_DK_RIGHT1, 0); // Initial image of DK will be standing, facing right.
 
+    state.dk.enemy_direction = 1;
     state.dk.loc.x = 3;
     state.dk.loc.y = 24;
 
@@ -1270,7 +1626,6 @@ first_stage:
     state.dk.dk_immunity = 0;
     state.dk.has_boomerang = 0;
     
-    state.dk.trampled = 0;
 
     // Enemies
 
@@ -1278,15 +1633,12 @@ first_stage:
 
     for (int i = 0; i < 3; ++i)
     {
-        state.enemies[i].sprite.img = (unsigned char*) mario_right1.pixel_data;
-        state.enemies[i].sprite.width = mario_right1.width;
-        state.enemies[i].sprite.height = mario_right1.height;
+        set_frame(&state.enemies[i], ATLAS_MARIO_RIGHT1, 0);
 
         state.enemies[i].speed = 1;
         state.enemies[i].enemy_direction = 0;
         state.enemies[i].exists = 1;
         
-        state.enemies[i].trampled = 0;
 
         state.enemies[i].flying = 0;
     }
@@ -1302,15 +1654,12 @@ first_stage:
 
     // Fourth enemy, flying...
 
-    state.enemies[3].sprite.img = (unsigned char*) bird_right1.pixel_data;
-    state.enemies[3].sprite.width = bird_right1.width;
-    state.enemies[3].sprite.height = bird_right1.height;
+    set_frame(&state.enemies[3], ATLAS_BIRD_RIGHT1, 0);
 
     state.enemies[3].speed = 1;
     state.enemies[3].enemy_direction = 0;
     state.enemies[3].exists = 1;
 
-    state.enemies[3].trampled = 0;
 
     state.enemies[3].flying = 1;
 
@@ -1325,9 +1674,7 @@ first_stage:
 
     for (int i = 0; i < 1; ++i)
     {
-        state.packs[i].sprite.img = (unsigned char*) heartpack.pixel_data;
-        state.packs[i].sprite.width = heartpack.width;
-        state.packs[i].sprite.height = heartpack.height;
+        set_frame(&state.packs[i], ATLAS_HEARTPACK, 0);
 
         state.packs[i].health_pack = 1;
         state.packs[i].point_pack = 0;
@@ -1341,9 +1688,7 @@ first_stage:
 
     for (int i = 1; i < 3; ++i)
     {
-        state.packs[i].sprite.img = (unsigned char*) coinpack.pixel_data;
-        state.packs[i].sprite.width = coinpack.width;
-        state.packs[i].sprite.height = coinpack.height;
+        set_frame(&state.packs[i], ATLAS_COINPACK, 0);
 
         state.packs[i].health_pack = 0;
         state.packs[i].point_pack = 1;
@@ -1357,9 +1702,7 @@ first_stage:
     state.packs[2].loc.y = 14;
 
     // Create boomerang pack
-    state.packs[3].sprite.img = (unsigned char*) bananarangpack.pixel_data;
-    state.packs[3].sprite.width = bananarangpack.width;
-    state.packs[3].sprite.height = bananarangpack.height;
+    set_frame(&state.packs[3], ATLAS_BANANARANGPACK, 0);
 
     state.packs[3].health_pack = 0;
     state.packs[3].point_pack = 0;
@@ -1371,15 +1714,12 @@ first_stage:
 
     // Boomerang setup;
 
-    state.boomerang.sprite.img = (unsigned char*) bananarang.pixel_data;
-    state.boomerang.sprite.width = bananarang.width;
-    state.boomerang.sprite.height = bananarang.height;
+    set_boomerang_frame(&state.boomerang, ATLAS_BANANARANG);
 
     state.boomerang.tiles_per_second = 20;
     state.boomerang.exists = 0;    // Projectile not in game yet.
     state.boomerang.direction = 1; // 1 = right, 0 = left
     
-    for (int i = 0; i < state.num_packs; ++i) state.packs[i].trampled = 0;
     
     
     // Vehicles...
@@ -1388,12 +1728,8 @@ first_stage:
 
     // First vehicle... maybe a vine? For now using health pack image.
     // This one will be unidirectional...
-    state.vehicles[0].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[0].start.sprite.width = teleporter.width;
-    state.vehicles[0].start.sprite.height = teleporter.height;
-    state.vehicles[0].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[0].finish.sprite.width = emptypack.width;
-    state.vehicles[0].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[0].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[0].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[0].start.loc.x = 16;
     state.vehicles[0].start.loc.y = 10;
@@ -1405,12 +1741,8 @@ first_stage:
 
     // Second vehicle... maybe a vine? For now using health pack image.
     // This one will be unidirectional...
-    state.vehicles[1].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[1].start.sprite.width = teleporter.width;
-    state.vehicles[1].start.sprite.height = teleporter.height;
-    state.vehicles[1].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[1].finish.sprite.width = emptypack.width;
-    state.vehicles[1].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[1].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[1].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[1].start.loc.x = 10;
     state.vehicles[1].start.loc.y = 5;
@@ -1422,12 +1754,8 @@ first_stage:
     
     // Third vehicle... maybe a vine? For now using health pack image.
     // This one will be unidirectional...
-    state.vehicles[2].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[2].start.sprite.width = teleporter.width;
-    state.vehicles[2].start.sprite.height = teleporter.height;
-    state.vehicles[2].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[2].finish.sprite.width = emptypack.width;
-    state.vehicles[2].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[2].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[2].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[2].start.loc.x = 21;
     state.vehicles[2].start.loc.y = 5;
@@ -1439,12 +1767,8 @@ first_stage:
 
     // Fourth vehicle... bidirectional.
 
-    state.vehicles[3].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[3].start.sprite.width = teleporter.width;
-    state.vehicles[3].start.sprite.height = teleporter.height;
-    state.vehicles[3].finish.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[3].finish.sprite.width = teleporter.width;
-    state.vehicles[3].finish.sprite.height = teleporter.height;
+    set_frame(&state.vehicles[3].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[3].finish, ATLAS_TELEPORTER, 0);
 
     state.vehicles[3].start.loc.x = 7;
     state.vehicles[3].start.loc.y = 2;
@@ -1454,10 +1778,6 @@ first_stage:
 
     state.vehicles[3].bidirectional = 1;
     
-    for (int i = 0; i < state.num_vehicles; ++i) {
-        state.vehicles[i].start.trampled = 0;
-        state.vehicles[i].finish.trampled = 0;
-    }
 
     // Exit... will be located at coords (5, 0), middle of top of screen...
     // Set up exit... (temporarily using coin image)
@@ -1469,7 +1789,6 @@ first_stage:
     state.exit.loc.x = 17;
     state.exit.loc.y = 0;
     state.exit.exists = 1;
-    state.exit.trampled = 0;
 
     for (int i = 0; i < 25*25; ++i) state.map_tiles[i] = map1[i];
 
@@ -1477,11 +1796,13 @@ first_stage:
     // FIRST STAGE LOOP //
     //////////////////////
 
-    unsigned int time0;
-    unsigned int enemy_move_reference_time = *clo;
-    unsigned int dk_sprite_change_reference = *clo;
-    unsigned int boomerang_reference = *clo;
-    unsigned int pack_spawn_timer = *clo;
+    // All game logic times itself by time0, read once a frame, so that recordings can replay it.
+    unsigned int time0 = replay_clock(), last_time0;
+    int select_held = 0;
+    unsigned int enemy_move_reference_time = time0;
+    unsigned int dk_sprite_change_reference = time0;
+    unsigned int boomerang_reference = time0;
+    unsigned int pack_spawn_timer = time0;
 
     int dk_sprite_change_interval = 500000; // Suppose to be 0.5 second
     int enemy_move_delay = 1000000;         // Suppose to be 1 second
@@ -1494,19 +1815,30 @@ gameloop:
         state.enemies[i].sprite_tracker = 1;
     }
 
-    // Set screen...
+    // Render this level's platforms and ladders once, then set screen...
+    build_static_layer(&state);
     set_screen(&state);
 
+    // Don't count the time spent changing stage against the clock.
+    time0 = replay_clock();
+
     // this loop will run while we're in the first level - break if either win flag or lose flag is set.
     while (!state.winflag && !state.loseflag)
     {
 
-        // Record clock register contents so that we can calculate the time elapsed by each iteration of this loop,
-        // then subtract that from the amount of time remaining.
-        time0 = *clo;
-
-        // Read controller.
-        read_SNES(buttons);
+        // Read the clock so that we can calculate the time elapsed by each iteration of this loop, then subtract that
+        // from the amount of time remaining. Then read controller.
+        struct prof_mark frame_start = prof_start(), t = frame_start;
+        last_time0 = time0;
+        time0 = replay_frame(buttons);
+        prof_stop(PROF_INPUT, t);
+
+        // Select logs the profile of the frames so far, once per press.
+        if (buttons[3 - 1] == 0 && !select_held) {
+            render_sync();
+            prof_dump();
+        }
+        select_held = (buttons[3 - 1] == 0);
 
         // If start has been pressed, enter pause menu...
         if (buttons[4 - 1] == 0) {
@@ -1514,7 +1846,8 @@ gameloop:
             // If exit_game selected, print message and exit.
             if (exit_game == 1) {
                 drawString(SCREENWIDTH / 2 - 25, SCREENHEIGHT / 2, "Exiting...", 0xF);
-                wait(1000000);
+                fb_present();
+                replay_wait(1000000);
                 drawString(SCREENWIDTH / 2 - 25, SCREENHEIGHT / 2, "          ", 0xF);
                 display_score(&state);
                 return 1;
@@ -1526,20 +1859,21 @@ gameloop:
 
             // Otherwise, start was pressed. Redraw game state in case anything was erased by pause menu.
             set_screen(&state);
+            frame_start = prof_start(); // Don't count the pause as part of the frame.
 
         }
 
         // This block of code is entered every 0.5 seconds.
         // Flips spriteTracker flag
         // UPDATE - FLIPS FOR BOTH DK AND ENEMIES
-        if (dk_sprite_change_reference + dk_sprite_change_interval <= *clo) {
+        if (dk_sprite_change_reference + dk_sprite_change_interval <= time0) {
             // Change sprite of DK.
             state.dk.sprite_tracker = 1 - state.dk.sprite_tracker;
             for (int i = 0; i < state.num_enemies; ++i) {
                 state.enemies[i].sprite_tracker = 1 - state.enemies[i].sprite_tracker;
             }
             // Reset reference...
-            dk_sprite_change_reference = *clo;
+            dk_sprite_change_reference = time0;
         }
 
         // Update direction being faced by DK...
@@ -1548,20 +1882,22 @@ gameloop:
         // Update enemy direction being faced by enemy.
         for (int i = 0; i < state.num_enemies; ++i) {
             updateEnemyDirection(&state.enemies[i], state.enemies[i].sprite_tracker);
-            // Quick and dirty fix to sprite glitching - set trampled at every enemies current
-            // location here.
-            setTrampled(&state, state.enemies[i].loc.x, state.enemies[i].loc.y);
         }
 
         // Move DK based on SNES input.
+        t = prof_start();
         DKmove(buttons, &state);
+        prof_stop(PROF_MOVE, t);
 
         // Check for collisions...
+        t = prof_start();
         checkDKCollisions(&state);
+        prof_stop(PROF_COLLIDE, t);
 
         // If sufficient time has elapsed, move enemies...
         if (enemy_move_reference_time + enemy_move_delay <= time0)
         {
+            t = prof_start();
             for (int i = 0; i < state.num_enemies; i++)
             {
                 if (state.enemies[i].exists) {
@@ -1600,24 +1936,12 @@ gameloop:
                         }
                     }
 
-                    // Current enemy location is (newx, oldy). Check to see if there is a pack
-                    // or vehicle at this location, and if so set trampled to true.
-                    // We only need to do this if the enemy moved - otherwise, trampled will have already been
-                    // set when enemy moved to current location.
-                    if (oldx != newx) {
-                        setTrampled(&state, newx, oldy);
-                        // Untrample any object at old location...
-                        untrample(&state, oldx, oldy);
-                    }
-
-                    // Draw enemy at new location and erase at old location.
-                    draw_background(oldx, oldy, &state);
-                    // draw_image(state.background, grid_to_pixel_x(oldx, state.width), grid_to_pixel_y(oldy, state.height));
-                    draw_grid(&(state.enemies[i]), state.width, state.height);
+                    // The compositor erases the enemy at its old location and draws it at the new one.
                 }
-                
+
             }
-            enemy_move_reference_time = *clo;
+            enemy_move_reference_time = time0;
+            prof_stop(PROF_ENEMIES, t);
         }
 
         // Boomerang logic
@@ -1641,8 +1965,10 @@ gameloop:
         {
             if (boomerang_reference + (enemy_move_delay / state.boomerang.tiles_per_second) <= time0)
             {
-                boomerang_reference = *clo;
+                boomerang_reference = time0;
+                t = prof_start();
                 updateBoomerang(&state);
+                prof_stop(PROF_BOOMERANG, t);
             }
         }
 
@@ -1654,20 +1980,27 @@ gameloop:
         }
 
         // Check to see if 30 seconds have elapsed since the last pack was spawned. If so, spawn a pack...
-        if (pack_spawn_timer + pack_spawn_delay <= *clo) {
-            // flag = *clo % 2 to simulate random spawn of either health or point pack.
-            spawn_pack(&state, *clo % 2);
+        if (pack_spawn_timer + pack_spawn_delay <= time0) {
+            // flag = replay_random() % 2 to simulate random spawn of either health or point pack.
+            t = prof_start();
+            spawn_pack(&state, replay_random() % 2);
+            prof_stop(PROF_SPAWN, t);
             // Reset spawn pack timer.
-            pack_spawn_timer = *clo;
+            pack_spawn_timer = time0;
         }
 
 
-        // draw game state.
-        draw_state(&state, time0);
+        // draw game state, then flip it onto the screen. With a render core both only queue the work, and the next
+        // pass of the loop starts while the frame is drawn.
+        t = prof_start();
+        draw_state(&state, time0 - last_time0);
+        render_push(present_frame, 0, 0, 0);
+        prof_stop(PROF_DRAW, t);
+        prof_stop(PROF_FRAME, frame_start);
 
         // Lastly, wait for a brief period before executing loop body again. Quick fix to slow down
         // DK when holding down Jpad.
-        wait(100000);
+        replay_wait(100000);
     }
 
     // First stage exited...
@@ -1679,42 +2012,22 @@ gameloop:
     if (state.loseflag)
     {
         drawString(SCREENWIDTH/2 - 25, SCREENHEIGHT/2, "Game over!", 0xF);
-        wait(2000000);
+        fb_present();
+        replay_wait(2000000);
         drawString(SCREENWIDTH/2 - 25, SCREENHEIGHT/2, "           ", 0xF);
 
         display_score(&state);
 
-        // Copyable code to erase score/time/lives counters (functions which call drawString aren't working, so I can't make this into a function):
-
-        // Erase time, score, lives before terminating...
-        drawString(SCREENWIDTH - 200, FONT_HEIGHT, "       ", 0xF);     // Erase "SCORE:"
-        drawString(SCREENWIDTH - 200, 2 * FONT_HEIGHT, "      ", 0xF);  // Erase "TIME:"
-        drawString(SCREENWIDTH - 200, 3 * FONT_HEIGHT, "       ", 0xF); // ERASE "LIVES:"
-
-        // Erase numbers (big buffer used, during testing time counter has been holding some crazy values):
-        drawString(SCREENWIDTH - 100, FONT_HEIGHT, "                        ", 0xF);
-        drawString(SCREENWIDTH - 100, 2 * FONT_HEIGHT, "                        ", 0xF);
-        drawString(SCREENWIDTH - 100, 3 * FONT_HEIGHT, "                        ", 0xF);
-
         state.loseflag = 0;
 
         goto return_to_menu;
     }
 
-    // If we didn't enter that code block, first stage won! Move on to next stage, but first erase score/times/lives...
-
-    // Erase time, score, lives before terminating...
-    drawString(SCREENWIDTH - 200, FONT_HEIGHT, "       ", 0xF);     // Erase "SCORE:"
-    drawString(SCREENWIDTH - 200, 2 * FONT_HEIGHT, "      ", 0xF);  // Erase "TIME:"
-    drawString(SCREENWIDTH - 200, 3 * FONT_HEIGHT, "       ", 0xF); // ERASE "LIVES:"
-
-    // Erase numbers (big buffer used, during testing time counter has been holding some crazy values):
-    drawString(SCREENWIDTH - 100, FONT_HEIGHT, "                        ", 0xF);
-    drawString(SCREENWIDTH - 100, 2 * FONT_HEIGHT, "                        ", 0xF);
-    drawString(SCREENWIDTH - 100, 3 * FONT_HEIGHT, "                        ", 0xF);
+    // If we didn't enter that code block, first stage won! Move on to next stage (erase_state has already cleared the HUD)...
 
     drawString(SCREENWIDTH / 2 - 25, SCREENHEIGHT/2, "Stage won!", 0xF);
-    wait(1000000);
+    fb_present();
+    replay_wait(1000000);
     drawString(SCREENWIDTH / 2 - 25, SCREENHEIGHT/2, "                 ", 0xF);
     
     // Determine next stage...
@@ -1743,7 +2056,6 @@ gameloop:
     state.dk.dk_immunity = 0;
     state.dk.has_boomerang = 0;
     
-    state.dk.trampled = 0;
 
     // Enemies
 
@@ -1751,15 +2063,12 @@ gameloop:
 
     for (int i = 0; i < 4; ++i)
     {
-        state.enemies[i].sprite.img = (unsigned char*) enemy_image.pixel_data;
-        state.enemies[i].sprite.width = enemy_image.width;
-        state.enemies[i].sprite.height = enemy_image.height;
+        set_frame(&state.enemies[i], ATLAS_ENEMY, 0);
 
         state.enemies[i].speed = 1;
         state.enemies[i].enemy_direction = 0;
         state.enemies[i].exists = 1;
         
-        state.enemies[i].trampled = 0;
         state.enemies[i].flying = 0;
     }
 
@@ -1783,9 +2092,7 @@ gameloop:
 
     for (int i = 0; i < 1; ++i)
     {
-        state.packs[i].sprite.img = (unsigned char*) heartpack.pixel_data;
-        state.packs[i].sprite.width = heartpack.width;
-        state.packs[i].sprite.height = heartpack.height;
+        set_frame(&state.packs[i], ATLAS_HEARTPACK, 0);
 
         state.packs[i].health_pack = 1;
         state.packs[i].point_pack = 0;
@@ -1799,9 +2106,7 @@ gameloop:
 
     for (int i = 1; i < 3; ++i)
     {
-        state.packs[i].sprite.img = (unsigned char*) coinpack.pixel_data;
-        state.packs[i].sprite.width = coinpack.width;
-        state.packs[i].sprite.height = coinpack.height;
+        set_frame(&state.packs[i], ATLAS_COINPACK, 0);
 
         state.packs[i].health_pack = 0;
         state.packs[i].point_pack = 1;
@@ -1815,9 +2120,7 @@ gameloop:
     state.packs[2].loc.y = 21;
 
     // Create boomerang pack
-    state.packs[3].sprite.img = (unsigned char*) bananarangpack.pixel_data;
-    state.packs[3].sprite.width = bananarangpack.width;
-    state.packs[3].sprite.height = bananarangpack.height;
+    set_frame(&state.packs[3], ATLAS_BANANARANGPACK, 0);
 
     state.packs[3].health_pack = 0;
     state.packs[3].point_pack = 0;
@@ -1829,27 +2132,20 @@ gameloop:
 
     // Boomerang setup;
 
-    state.boomerang.sprite.img = (unsigned char*) bananarang.pixel_data;
-    state.boomerang.sprite.width = bananarang.width;
-    state.boomerang.sprite.height = bananarang.height;
+    set_boomerang_frame(&state.boomerang, ATLAS_BANANARANG);
 
     state.boomerang.tiles_per_second = 20;
     state.boomerang.exists = 0;    // Projectile not in game yet.
     state.boomerang.direction = 1; // 1 = right, 0 = left
     
-    for (int i = 0; i < state.num_packs; ++i) state.packs[i].trampled = 0;
     
     
     // Vehicles...
 
     state.num_vehicles = 6;
 
-    state.vehicles[0].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[0].start.sprite.width = teleporter.width;
-    state.vehicles[0].start.sprite.height = teleporter.height;
-    state.vehicles[0].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[0].finish.sprite.width = emptypack.width;
-    state.vehicles[0].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[0].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[0].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[0].start.loc.x = 17;
     state.vehicles[0].start.loc.y = 8;
@@ -1859,12 +2155,8 @@ gameloop:
 
     state.vehicles[0].bidirectional = 0;
 
-    state.vehicles[1].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[1].start.sprite.width = teleporter.width;
-    state.vehicles[1].start.sprite.height = teleporter.height;
-    state.vehicles[1].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[1].finish.sprite.width = emptypack.width;
-    state.vehicles[1].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[1].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[1].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[1].start.loc.x = 12;
     state.vehicles[1].start.loc.y = 3;
@@ -1874,12 +2166,8 @@ gameloop:
 
     state.vehicles[1].bidirectional = 0;
     
-    state.vehicles[2].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[2].start.sprite.width = teleporter.width;
-    state.vehicles[2].start.sprite.height = teleporter.height;
-    state.vehicles[2].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[2].finish.sprite.width = emptypack.width;
-    state.vehicles[2].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[2].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[2].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[2].start.loc.x = 6;
     state.vehicles[2].start.loc.y = 8;
@@ -1889,12 +2177,8 @@ gameloop:
 
     state.vehicles[2].bidirectional = 0;
 
-    state.vehicles[3].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[3].start.sprite.width = teleporter.width;
-    state.vehicles[3].start.sprite.height = teleporter.height;
-    state.vehicles[3].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[3].finish.sprite.width = emptypack.width;
-    state.vehicles[3].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[3].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[3].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[3].start.loc.x = 21;
     state.vehicles[3].start.loc.y = 1;
@@ -1904,12 +2188,8 @@ gameloop:
 
     state.vehicles[3].bidirectional = 0;
 
-    state.vehicles[4].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[4].start.sprite.width = teleporter.width;
-    state.vehicles[4].start.sprite.height = teleporter.height;
-    state.vehicles[4].finish.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[4].finish.sprite.width = teleporter.width;
-    state.vehicles[4].finish.sprite.height = teleporter.height;
+    set_frame(&state.vehicles[4].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[4].finish, ATLAS_TELEPORTER, 0);
 
     state.vehicles[4].start.loc.x = 5;
     state.vehicles[4].start.loc.y = 14;
@@ -1919,12 +2199,8 @@ gameloop:
 
     state.vehicles[4].bidirectional = 1;
 
-    state.vehicles[5].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[5].start.sprite.width = teleporter.width;
-    state.vehicles[5].start.sprite.height = teleporter.height;
-    state.vehicles[5].finish.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[5].finish.sprite.width = teleporter.width;
-    state.vehicles[5].finish.sprite.height = teleporter.height;
+    set_frame(&state.vehicles[5].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[5].finish, ATLAS_TELEPORTER, 0);
 
     state.vehicles[5].start.loc.x = 16;
     state.vehicles[5].start.loc.y = 8;
@@ -1934,10 +2210,6 @@ gameloop:
 
     state.vehicles[5].bidirectional = 1;
 
-    for (int i = 0; i < state.num_vehicles; ++i) {
-        state.vehicles[i].start.trampled = 0;
-        state.vehicles[i].finish.trampled = 0;
-    }
 
     state.exit.sprite.img = (unsigned char*) ladder.pixel_data;
     state.exit.sprite.width = coin_image.width;
@@ -1947,7 +2219,6 @@ gameloop:
     state.exit.loc.x = 4;
     state.exit.loc.y = 0;
     state.exit.exists = 1;
-    state.exit.trampled = 0;
 
     for (int i = 0; i < 25*25; ++i) state.map_tiles[i] = map2[i];
 
@@ -1962,7 +2233,6 @@ third_stage:
     state.dk.dk_immunity = 0;
     state.dk.has_boomerang = 0;
     
-    state.dk.trampled = 0;
 
     // Enemies
 
@@ -1970,15 +2240,12 @@ third_stage:
 
     for (int i = 0; i < 6; ++i)
     {
-        state.enemies[i].sprite.img = (unsigned char*) mario_right1.pixel_data;
-        state.enemies[i].sprite.width = mario_right1.width;
-        state.enemies[i].sprite.height = mario_right1.height;
+        set_frame(&state.enemies[i], ATLAS_MARIO_RIGHT1, 0);
 
         state.enemies[i].speed = 1;
         state.enemies[i].enemy_direction = 0;
         state.enemies[i].exists = 1;
         
-        state.enemies[i].trampled = 0;
     }
 
     for (int i = 0; i < 6; ++i) state.enemies[i].flying = 0;
@@ -2014,15 +2281,12 @@ third_stage:
     state.enemies[7].flying = 1;
 
     for (int i = 6; i < 8; ++i) {
-        state.enemies[i].sprite.img = (unsigned char*) bird_right1.pixel_data;
-        state.enemies[i].sprite.width = bird_right1.width;
-        state.enemies[i].sprite.height = bird_right1.height;
+        set_frame(&state.enemies[i], ATLAS_BIRD_RIGHT1, 0);
 
         state.enemies[i].speed = 1;
         state.enemies[i].enemy_direction = 0;
         state.enemies[i].exists = 1;
         
-        state.enemies[i].trampled = 0;
     }
 
     // Packs
@@ -2031,9 +2295,7 @@ third_stage:
 
 
     // Create boomerang pack
-    state.packs[0].sprite.img = (unsigned char*) bananarangpack.pixel_data;
-    state.packs[0].sprite.width = bananarangpack.width;
-    state.packs[0].sprite.height = bananarangpack.height;
+    set_frame(&state.packs[0], ATLAS_BANANARANGPACK, 0);
 
     state.packs[0].health_pack = 0;
     state.packs[0].point_pack = 0;
@@ -2045,15 +2307,12 @@ third_stage:
 
     // Boomerang setup;
 
-    state.boomerang.sprite.img = (unsigned char*) bananarang.pixel_data;
-    state.boomerang.sprite.width = bananarang.width;
-    state.boomerang.sprite.height = bananarang.height;
+    set_boomerang_frame(&state.boomerang, ATLAS_BANANARANG);
 
     state.boomerang.tiles_per_second = 20;
     state.boomerang.exists = 0;    // Projectile not in game yet.
     state.boomerang.direction = 1; // 1 = right, 0 = left
     
-    for (int i = 0; i < state.num_packs; ++i) state.packs[i].trampled = 0;
     
     // No vehicles in this level...
 
@@ -2068,7 +2327,6 @@ third_stage:
     state.exit.loc.x = 17;
     state.exit.loc.y = 0;
     state.exit.exists = 1;
-    state.exit.trampled = 0;
 
     for (int i = 0; i < 25*25; ++i) state.map_tiles[i] = map3[i];
 
@@ -2083,7 +2341,6 @@ fourth_stage:
     state.dk.dk_immunity = 0;
     state.dk.has_boomerang = 0;
     
-    state.dk.trampled = 0;
 
     // Enemies - 8 flying enemies in this stage.
 
@@ -2091,15 +2348,12 @@ fourth_stage:
 
     for (int i = 0; i < 8; ++i)
     {
-        state.enemies[i].sprite.img = (unsigned char*) bird_right1.pixel_data;
-        state.enemies[i].sprite.width = bird_right1.width;
-        state.enemies[i].sprite.height = bird_right1.height;
+        set_frame(&state.enemies[i], ATLAS_BIRD_RIGHT1, 0);
 
         state.enemies[i].speed = 1;
         state.enemies[i].enemy_direction = 0;
         state.enemies[i].exists = 1;
         
-        state.enemies[i].trampled = 0;
         state.enemies[i].flying = 1;
     }
 
@@ -2133,9 +2387,7 @@ fourth_stage:
 
 
     // Create boomerang pack
-    state.packs[0].sprite.img = (unsigned char*) bananarangpack.pixel_data;
-    state.packs[0].sprite.width = bananarangpack.width;
-    state.packs[0].sprite.height = bananarangpack.height;
+    set_frame(&state.packs[0], ATLAS_BANANARANGPACK, 0);
 
     state.packs[0].health_pack = 0;
     state.packs[0].point_pack = 0;
@@ -2147,24 +2399,17 @@ fourth_stage:
 
     // Boomerang setup;
 
-    state.boomerang.sprite.img = (unsigned char*) bananarang.pixel_data;
-    state.boomerang.sprite.width = bananarang.width;
-    state.boomerang.sprite.height = bananarang.height;
+    set_boomerang_frame(&state.boomerang, ATLAS_BANANARANG);
 
     state.boomerang.tiles_per_second = 20;
     state.boomerang.exists = 0;    // Projectile not in game yet.
     state.boomerang.direction = 1; // 1 = right, 0 = left
     
-    for (int i = 0; i < state.num_packs; ++i) state.packs[i].trampled = 0;
 
     state.num_vehicles = 1;
 
-    state.vehicles[0].start.sprite.img = (unsigned char*) teleporter.pixel_data;
-    state.vehicles[0].start.sprite.width = teleporter.width;
-    state.vehicles[0].start.sprite.height = teleporter.height;
-    state.vehicles[0].finish.sprite.img = (unsigned char*) emptypack.pixel_data;
-    state.vehicles[0].finish.sprite.width = emptypack.width;
-    state.vehicles[0].finish.sprite.height = emptypack.height;
+    set_frame(&state.vehicles[0].start, ATLAS_TELEPORTER, 0);
+    set_frame(&state.vehicles[0].finish, ATLAS_EMPTYPACK, 0);
 
     state.vehicles[0].start.loc.x = 12;
     state.vehicles[0].start.loc.y = 18;
@@ -2174,8 +2419,6 @@ fourth_stage:
 
     state.vehicles[0].bidirectional = 0;
 
-    state.vehicles[0].start.trampled = 0;
-    state.vehicles[0].finish.trampled = 0;
 
     // Exit...
     state.exit.sprite.img = (unsigned char*) ladder.pixel_data;
@@ -2185,7 +2428,6 @@ fourth_stage:
     state.exit.loc.x = 19;
     state.exit.loc.y = 0;
     state.exit.exists = 1;
-    state.exit.trampled = 0;
 
     for (int i = 0; i < 25*25; ++i) state.map_tiles[i] = map4[i];
 
@@ -2195,7 +2437,8 @@ fourth_stage:
 game_won:
 
     drawString(SCREENWIDTH/2 - 50, SCREENHEIGHT/2, "Game won! Congratulations!", 0xF);
-    wait(1000000);
+    fb_present();
+    replay_wait(1000000);
     drawString(SCREENWIDTH/2 - 50, SCREENHEIGHT/2, "                            ", 0xF);
     display_score(&state);
 
@@ -2203,8 +2446,9 @@ game_won:
 // Here, we wait for the player to press any button, and return to the main menu when this is done.
 return_to_menu:
     drawString(SCREENWIDTH/2 - 100, SCREENHEIGHT/2, "Press any button...", 0xF);
+    fb_present();
     while (1) {
-        read_SNES(buttons);
+        replay_input(buttons);
         for (int i = 0; i < 16; ++i) {
             if (buttons[i] == 0) goto start_menu;
         }
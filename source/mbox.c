@@ -24,9 +24,11 @@
  */
 
 #include "gpio.h"
+#include "mbox.h"
+#include "mmu.h"
 
 // mailbox message buffer
-volatile unsigned int  __attribute__((aligned(16))) mbox[36];
+volatile unsigned int  __attribute__((aligned(16))) mbox[MBOX_WORDS];
 
 #define VIDEOCORE_MBOX  (MMIO_BASE+0x0000B880)
 #define MBOX_READ       ((volatile unsigned int*)(VIDEOCORE_MBOX+0x0))
@@ -45,6 +47,10 @@ volatile unsigned int  __attribute__((aligned(16))) mbox[36];
 int mbox_call(unsigned char ch)
 {
     unsigned int r = (((unsigned int)((unsigned long)&mbox)&~0xF) | (ch&0xF));
+
+    // with the data cache on, the message must reach memory before the GPU reads it
+    dcache_clean(mbox, sizeof(mbox));
+
     // wait until we can write to the mailbox
     do {
         asm volatile("nop");
@@ -61,6 +67,8 @@ int mbox_call(unsigned char ch)
         } while(*MBOX_STATUS & MBOX_EMPTY);
         // is it a response to our message?
         if(r == *MBOX_READ) {
+            // drop our cached copy so we read the GPU's reply
+            dcache_clean_invalidate(mbox, sizeof(mbox));
             // is it a valid successful response?
             return mbox[1]==MBOX_RESPONSE;
         }
@@ -23,8 +23,9 @@
  *
  */
 
-// a properly aligned buffer
-extern volatile unsigned int mbox[36];
+// a properly aligned buffer, big enough for a full 256 entry palette
+#define MBOX_WORDS 264
+extern volatile unsigned int mbox[MBOX_WORDS];
 
 #define MBOX_REQUEST    0
 
@@ -43,14 +44,17 @@ extern volatile unsigned int mbox[36];
 #define MBOX_TAG_SETPOWER       0x28001
 #define MBOX_TAG_GETSERIAL      0x10004
 #define MBOX_TAG_SETCLKRATE     0x38002
+#define MBOX_TAG_GETCMDLINE     0x50001
 
 #define MBOX_TAG_SETPHYWH       0x48003
 #define MBOX_TAG_SETVIRTWH      0x48004
 #define MBOX_TAG_SETVIRTOFF     0x48009
 #define MBOX_TAG_SETDEPTH       0x48005
 #define MBOX_TAG_SETPXLORDR     0x48006
+#define MBOX_TAG_SETPALETTE     0x4800B
 #define MBOX_TAG_GETFB          0x40001
 #define MBOX_TAG_GETPITCH       0x40008
+#define MBOX_TAG_WAITVSYNC      0x4800E
 
 #define MBOX_TAG_LAST           0
 
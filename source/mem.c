@@ -0,0 +1,42 @@
+// There is no C library in this kernel, but GCC is free to emit calls to these for struct copies
+// and simple loops once optimizations are enabled, so we provide them ourselves.
+
+typedef unsigned long size_t;
+
+void *memcpy(void *dest, const void *src, size_t n)
+{
+    unsigned char *d = dest;
+    const unsigned char *s = src;
+    while (n--) *d++ = *s++;
+    return dest;
+}
+
+void *memmove(void *dest, const void *src, size_t n)
+{
+    unsigned char *d = dest;
+    const unsigned char *s = src;
+    if (d < s) {
+        while (n--) *d++ = *s++;
+    } else {
+        d += n;
+        s += n;
+        while (n--) *--d = *--s;
+    }
+    return dest;
+}
+
+void *memset(void *dest, int c, size_t n)
+{
+    unsigned char *d = dest;
+    while (n--) *d++ = (unsigned char)c;
+    return dest;
+}
+
+int memcmp(const void *a, const void *b, size_t n)
+{
+    const unsigned char *p = a, *q = b;
+    for (; n--; p++, q++) {
+        if (*p != *q) return *p - *q;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include "mmu.h"
+
+// Translation tables and caches. Everything runs identity mapped. The 4GB address space is covered in 2MB blocks
+// that are one of the following:
+// - normal write-back cacheable memory: code, data, stack and assets;
+// - device memory: the peripherals from 0xFC000000 up;
+// - normal non-cacheable memory: the framebuffer. Its stores are gathered into bursts, like write-combining, but
+//   never sit in the cache where the GPU can't see them.
+
+// Attribute indices, and the MAIR value that defines them.
+#define ATTR_DEVICE 0 // Device-nGnRnE
+#define ATTR_NORMAL 1 // Inner and outer write-back, read and write allocate
+#define ATTR_NC     2 // Inner and outer non-cacheable
+#define MAIR_VALUE  ((0x00UL << (8 * ATTR_DEVICE)) | (0xFFUL << (8 * ATTR_NORMAL)) | (0x44UL << (8 * ATTR_NC)))
+
+// Descriptor bits.
+#define PT_BLOCK    0x1
+#define PT_TABLE    0x3
+#define PT_ATTR(i)  ((unsigned long)(i) << 2)
+#define PT_ISH      (3UL << 8)  // Inner shareable
+#define PT_OSH      (2UL << 8)  // Outer shareable
+#define PT_AF       (1UL << 10) // Access flag, set so the first access doesn't fault
+
+#define BLOCK_SIZE  (1UL << 21)
+#define DEVICE_BASE 0xFC000000UL
+
+#ifdef __aarch64__
+// One level 1 table of 1GB entries, each pointing at a level 2 table of 2MB blocks.
+static unsigned long __attribute__((aligned(4096))) level1[512];
+static unsigned long __attribute__((aligned(4096))) level2[4][512];
+
+// Builds a system register access for the exception level we run at. The firmware may start us in EL2 or EL1.
+#define MSR_EL(el, reg, v) do { \
+        if ((el) == 2) asm volatile ("msr " #reg "_el2, %0" : : "r" (v)); \
+        else asm volatile ("msr " #reg "_el1, %0" : : "r" (v)); \
+    } while (0)
+#define MRS_EL(el, reg, v) do { \
+        if ((el) == 2) asm volatile ("mrs %0, " #reg "_el2" : "=r" (v)); \
+        else asm volatile ("mrs %0, " #reg "_el1" : "=r" (v)); \
+    } while (0)
+
+static unsigned long line_size()
+{
+    unsigned long ctr;
+
+    asm volatile ("mrs %0, ctr_el0" : "=r" (ctr));
+    return 4UL << ((ctr >> 16) & 15);
+}
+#endif
+
+/* Writes any dirty cache lines covering size bytes at addr back to memory, so another bus master sees them. */
+void dcache_clean(const volatile void *addr, unsigned long size)
+{
+#ifdef __aarch64__
+    unsigned long line = line_size();
+    unsigned long p = (unsigned long) addr & ~(line - 1);
+
+    for (; p < (unsigned long) addr + size; p += line) asm volatile ("dc cvac, %0" : : "r" (p) : "memory");
+    asm volatile ("dsb sy" : : : "memory");
+#endif
+}
+
+/* Like dcache_clean, then drops the lines so the next read fetches what another bus master wrote. */
+void dcache_clean_invalidate(const volatile void *addr, unsigned long size)
+{
+#ifdef __aarch64__
+    unsigned long line = line_size();
+    unsigned long p = (unsigned long) addr & ~(line - 1);
+
+    for (; p < (unsigned long) addr + size; p += line) asm volatile ("dc civac, %0" : : "r" (p) : "memory");
+    asm volatile ("dsb sy" : : : "memory");
+#endif
+}
+
+/* Builds the tables and turns on the MMU and caches. fb_start and fb_size give the framebuffer, which is mapped
+ * non-cacheable; call this after fb_init. */
+void mmu_init(unsigned long fb_start, unsigned long fb_size)
+{
+#ifdef __aarch64__
+    unsigned long el;
+
+    asm volatile ("mrs %0, CurrentEL" : "=r" (el));
+    el = (el >> 2) & 3;
+
+    // EL2 has a single execute-never bit (54), EL1 has one per privilege level (54 and 53).
+    unsigned long xn = (el == 2) ? (1UL << 54) : (3UL << 53);
+
+    for (int i = 0; i < 4; i++) level1[i] = (unsigned long) level2[i] | PT_TABLE;
+
+    for (unsigned long i = 0; i < 4 * 512; i++) {
+        unsigned long addr = i * BLOCK_SIZE;
+        unsigned long desc = addr | PT_BLOCK | PT_AF;
+
+        if (addr >= DEVICE_BASE) desc |= PT_ATTR(ATTR_DEVICE) | PT_OSH | xn;
+        else if (addr + BLOCK_SIZE > fb_start && addr < fb_start + fb_size) desc |= PT_ATTR(ATTR_NC) | PT_OSH | xn;
+        else desc |= PT_ATTR(ATTR_NORMAL) | PT_ISH;
+
+        level2[i / 512][i % 512] = desc;
+    }
+    dcache_clean(level1, sizeof(level1));
+    dcache_clean(level2, sizeof(level2));
+
+    mmu_enable();
+#endif
+}
+
+/* Turns on the MMU and caches of the calling core with the tables built by mmu_init. The secondary cores call this
+ * themselves once core 0 has run mmu_init. */
+void mmu_enable()
+{
+#ifdef __aarch64__
+    unsigned long el, sctlr, tcr;
+
+    asm volatile ("mrs %0, CurrentEL" : "=r" (el));
+    el = (el >> 2) & 3;
+
+    // 4GB of input address (T0SZ = 32), 4KB granule, walks cacheable and inner shareable, 32 bit physical addresses.
+    // TTBR1 walks are disabled at EL1; EL2 has no TTBR1, and bits 31 and 23 of its TCR are RES1.
+    tcr = 32 | (1UL << 8) | (1UL << 10) | (3UL << 12);
+    if (el == 2) tcr |= (1UL << 31) | (1UL << 23);
+    else tcr |= 1UL << 23; // EPD1
+
+    MSR_EL(el, mair, MAIR_VALUE);
+    MSR_EL(el, tcr, tcr);
+    MSR_EL(el, ttbr0, (unsigned long) level1);
+    asm volatile ("isb");
+
+    // The A72 invalidates its caches on reset, so only stale TLB entries and instructions need throwing away.
+    if (el == 2) asm volatile ("tlbi alle2");
+    else asm volatile ("tlbi vmalle1");
+    asm volatile ("dsb ish\n\tic iallu\n\tdsb ish\n\tisb" : : : "memory");
+
+    // MMU, data and instruction caches on; alignment checks off so unaligned NEON and memcpy accesses are fine.
+    MRS_EL(el, sctlr, sctlr);
+    sctlr |= (1 << 0) | (1 << 2) | (1 << 12);
+    sctlr &= ~(1UL << 1);
+    MSR_EL(el, sctlr, sctlr);
+    asm volatile ("isb");
+#endif
+}
@@ -0,0 +1,9 @@
+#ifndef MMU_H
+#define MMU_H
+
+void mmu_init(unsigned long fb_start, unsigned long fb_size);
+void mmu_enable();
+void dcache_clean(const volatile void *addr, unsigned long size);
+void dcache_clean_invalidate(const volatile void *addr, unsigned long size);
+
+#endif
@@ -0,0 +1,245 @@
+#include "hal.h"
+#include "smp.h"
+#include "prof.h"
+
+// Frame phase profiler. Probes read the calling core's PMU counters either side of a phase: the cycle counter
+// (PMCCNTR_EL0) and the six event counters, set up to count the events below. Each phase keeps a histogram of how
+// many cycles it took, exact below 4, then 4 buckets to every power of two, so percentiles come out within 25%, and,
+// if PROFILE is 2, a total for each event. Every core records into a table of its own, so probes take no locks and can go in code that
+// runs on several cores at once, like the drawing bands. prof_dump logs a summary of everything recorded since the
+// last one.
+
+#define SUB_BITS 2                // Buckets per power of two, as a power of two.
+#define BUCKETS (64 << SUB_BITS)
+
+struct phase
+{
+    unsigned long count, sum, min, max;
+    unsigned long events[PROF_EVENTS];
+    unsigned int hist[BUCKETS];
+};
+
+static struct phase phases[SMP_CORES][PROF_PHASES];
+static unsigned long probe_cycles[SMP_CORES]; // What a probe costs on each core, measured by prof_init.
+
+// Longest line prof_dump logs: a phase name, a number of up to 20 digits for each event and the IPC, the IPC's two
+// decimals, the newline and the NUL.
+#define DUMP_LINE (10 + (PROF_EVENTS + 1) * 20 + 5)
+
+static const char *names[PROF_PHASES] = {
+    "frame", "input", "move", "collide", "enemies", "boomerang", "spawn", "draw", "render", "present", "bands"
+};
+
+// What the event counters count: Cortex-A72 event numbers. Others worth swapping in when chasing stores are 0x43
+// (L1D_CACHE_REFILL_WR) and 0x67 (MEM_ACCESS_WR).
+static const struct
+{
+    unsigned int code;
+    const char *name;
+} events[PROF_EVENTS] = {
+    { 0x03, "L1D refill" }, // L1D_CACHE_REFILL
+    { 0x17, "L2D refill" }, // L2D_CACHE_REFILL
+    { 0x05, "TLB refill" }, // L1D_TLB_REFILL
+    { 0x10, "mispredict" }, // BR_MIS_PRED
+    { 0x13, "mem access" }, // MEM_ACCESS
+    { 0x08, "instrs" },     // INST_RETIRED
+};
+
+static int bucket(unsigned long cycles)
+{
+    if (cycles < (1 << SUB_BITS)) return cycles;
+
+    int log = 63 - __builtin_clzl(cycles);
+    return ((log - SUB_BITS + 1) << SUB_BITS) | ((cycles >> (log - SUB_BITS)) & ((1 << SUB_BITS) - 1));
+}
+
+/* Returns the largest count of cycles that falls in bucket b. */
+static unsigned long bucket_top(int b)
+{
+    if (b < (1 << SUB_BITS)) return b;
+
+    int shift = (b >> SUB_BITS) - 1;
+    unsigned long low = (unsigned long) ((1 << SUB_BITS) | (b & ((1 << SUB_BITS) - 1))) << shift;
+    return low + (1UL << shift) - 1;
+}
+
+/* Starts the cycle and event counters on the calling core. Every core that runs probes must call this once. */
+void prof_init()
+{
+#ifdef __aarch64__
+    unsigned long pmcr, el;
+
+    // Event counters from MDCR_EL2.HPMN up are kept for EL2 and not started by PMCR_EL0. We run in EL2 and want them
+    // all, so move that line past the last one.
+    asm volatile ("mrs %0, pmcr_el0" : "=r" (pmcr));
+    asm volatile ("mrs %0, CurrentEL" : "=r" (el));
+    if (((el >> 2) & 3) == 2) {
+        unsigned long mdcr;
+
+        asm volatile ("mrs %0, mdcr_el2" : "=r" (mdcr));
+        asm volatile ("msr mdcr_el2, %0" : : "r" ((mdcr & ~0x1FUL) | ((pmcr >> 11) & 0x1F)));
+    }
+
+    // NSH (bit 27): count in EL2 as well as EL1 and EL0.
+    for (unsigned long i = 0; i < PROF_EVENTS; i++) {
+        asm volatile ("msr pmselr_el0, %0\n\tisb" : : "r" (i));
+        asm volatile ("msr pmxevtyper_el0, %0" : : "r" ((1UL << 27) | events[i].code));
+    }
+    asm volatile ("msr pmccfiltr_el0, %0" : : "r" (1UL << 27));
+
+    // LC: 64 bit cycle counter; C, P: reset the counters; E: enable.
+    asm volatile ("msr pmcr_el0, %0" : : "r" ((1UL << 6) | (1 << 2) | (1 << 1) | 1));
+    asm volatile ("msr pmcntenset_el0, %0" : : "r" ((1UL << 31) | ((1UL << PROF_EVENTS) - 1)));
+    asm volatile ("isb");
+#endif
+
+    // Time a run of empty probes for prof_dump to report, then forget them.
+    if (PROFILE) {
+        struct prof_mark start, end;
+        int core = smp_core();
+
+        prof_read(&start);
+        for (int i = 0; i < 16; i++) {
+            struct prof_mark t = prof_start();
+            prof_stop(PROF_FRAME, t);
+        }
+        prof_read(&end);
+        probe_cycles[core] = (end.cycles - start.cycles) / 16;
+        phases[core][PROF_FRAME] = (struct phase) {0};
+    }
+}
+
+/* Adds a pass through a phase, from counter readings at its start and end, to the calling core's table. */
+void prof_record(int phase, const struct prof_mark *start, const struct prof_mark *end)
+{
+    struct phase *p = &phases[smp_core()][phase];
+    unsigned long cycles = end->cycles - start->cycles;
+
+    if (p->count == 0 || cycles < p->min) p->min = cycles;
+    if (cycles > p->max) p->max = cycles;
+    p->count++;
+    p->sum += cycles;
+    p->hist[bucket(cycles)]++;
+
+    // The event counters are 32 bits, which is plenty for one pass.
+    if (PROFILE >= 2) {
+        for (int i = 0; i < PROF_EVENTS; i++) p->events[i] += (unsigned int) (end->events[i] - start->events[i]);
+    }
+}
+
+/* Appends s to a line, left-aligned in width characters, or right-aligned in -width. */
+static char *put_str(char *line, const char *s, int width)
+{
+    int len = 0;
+
+    while (s[len]) len++;
+    for (; width < -len; width++) *line++ = ' ';
+    while (*s) *line++ = *s++;
+    for (; width > len; width--) *line++ = ' ';
+    return line;
+}
+
+/* Appends n to a line, right-aligned in width characters. */
+static char *put_num(char *s, unsigned long n, int width)
+{
+    char digits[20];
+    int len = 0;
+
+    do digits[len++] = '0' + n % 10; while (n /= 10);
+    for (; width > len; width--) *s++ = ' ';
+    while (len) *s++ = digits[--len];
+    return s;
+}
+
+static void put_line(char *line, char *end)
+{
+    *end++ = '\n';
+    *end = 0;
+    hal_log(line);
+}
+
+/* Logs two tables for every phase that ran since the last dump, then starts over: count, min, mean, 99th percentile
+ * and max cycles, then the mean of each event per pass and the instructions per cycle. Call while no other core is
+ * running probes. */
+void prof_dump()
+{
+    struct phase total[PROF_PHASES];
+    unsigned long any_events = 0;
+    char line[DUMP_LINE], *s;
+
+    // Add up the cores' tables.
+    for (int i = 0; i < PROF_PHASES; i++) {
+        struct phase *t = &total[i];
+
+        *t = (struct phase) {0};
+        for (int c = 0; c < SMP_CORES; c++) {
+            struct phase *p = &phases[c][i];
+
+            if (p->count == 0) continue;
+            if (t->count == 0 || p->min < t->min) t->min = p->min;
+            if (p->max > t->max) t->max = p->max;
+            t->count += p->count;
+            t->sum += p->sum;
+            for (int e = 0; e < PROF_EVENTS; e++) t->events[e] += p->events[e];
+            for (int b = 0; b < BUCKETS; b++) t->hist[b] += p->hist[b];
+            *p = (struct phase) {0};
+        }
+        for (int e = 0; e < PROF_EVENTS; e++) any_events |= t->events[e];
+    }
+
+    hal_log("phase          count        min       mean        p99        max (cycles)\n");
+    for (int i = 0; i < PROF_PHASES; i++) {
+        struct phase *t = &total[i];
+        unsigned long seen = 0, p99 = t->max;
+        int b;
+
+        if (t->count == 0) continue;
+
+        // The bucket holding the sample 99% of the way up.
+        for (b = 0; b < BUCKETS; b++) {
+            seen += t->hist[b];
+            if (seen * 100 >= t->count * 99) break;
+        }
+        if (bucket_top(b) < p99) p99 = bucket_top(b);
+
+        s = put_str(line, names[i], 10);
+        s = put_num(s, t->count, 10);
+        s = put_num(s, t->min, 11);
+        s = put_num(s, t->sum / t->count, 11);
+        s = put_num(s, p99, 11);
+        s = put_num(s, t->max, 11);
+        put_line(line, s);
+    }
+
+    // Every figure above includes about this much.
+    s = put_str(line, "probe cost", 0);
+    s = put_num(s, probe_cycles[smp_core()], 10);
+    s = put_str(s, " cycles", 0);
+    put_line(line, s);
+
+    // Off the Pi, or with PROFILE below 2, there are no event counts to show.
+    if (!any_events) return;
+
+    s = put_str(line, "phase", 10);
+    for (int e = 0; e < PROF_EVENTS; e++) s = put_str(s, events[e].name, -11);
+    s = put_str(s, "    IPC (per pass)", 0);
+    put_line(line, s);
+
+    for (int i = 0; i < PROF_PHASES; i++) {
+        struct phase *t = &total[i];
+        unsigned long ipc;
+
+        if (t->count == 0) continue;
+
+        s = put_str(line, names[i], 10);
+        for (int e = 0; e < PROF_EVENTS; e++) s = put_num(s, t->events[e] / t->count, 11);
+
+        // Instructions (the last event) over cycles, to two places.
+        ipc = t->sum ? t->events[PROF_EVENTS - 1] * 100 / t->sum : 0;
+        s = put_num(s, ipc / 100, 4);
+        *s++ = '.';
+        *s++ = '0' + ipc / 10 % 10;
+        *s++ = '0' + ipc % 10;
+        put_line(line, s);
+    }
+}
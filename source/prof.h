@@ -0,0 +1,83 @@
+#ifndef PROF_H
+#define PROF_H
+
+// 0 compiles the probes out. 1 times phases with the cycle counter alone, so that a probe stays at a few dozen cycles.
+// 2 also has the probes read the six event counters, which costs several times as much. prof_dump reports the cost.
+#define PROFILE 1
+
+// Timed phases of a game frame. The first ones run on core 0 in the game loop, the last ones wherever the render
+// commands and drawing bands run.
+#define PROF_FRAME 0     // The whole game loop pass, up to its wait.
+#define PROF_INPUT 1     // Reading the clock and controller.
+#define PROF_MOVE 2      // DKmove.
+#define PROF_COLLIDE 3   // checkDKCollisions.
+#define PROF_ENEMIES 4   // Moving the enemies.
+#define PROF_BOOMERANG 5 // updateBoomerang.
+#define PROF_SPAWN 6     // spawn_pack.
+#define PROF_DRAW 7      // draw_state, which only queues the drawing when there is a render core.
+#define PROF_RENDER 8    // Drawing the frame (comp_render).
+#define PROF_PRESENT 9   // Flipping it onto the screen (fb_present).
+#define PROF_BANDS 10    // One core's band of a banded redraw (smp_run), on every core.
+#define PROF_PHASES 11
+
+#define PROF_EVENTS 6 // PMU event counters, all the A72 has. prof.c says which events they count.
+
+// A reading of the calling core's counters. The events are only read if PROFILE is 2.
+struct prof_mark
+{
+    unsigned long cycles;
+    unsigned int events[PROF_EVENTS];
+};
+
+void prof_init();
+void prof_record(int phase, const struct prof_mark *start, const struct prof_mark *end);
+void prof_dump();
+
+static inline void prof_read(struct prof_mark *m)
+{
+#if defined(__aarch64__)
+    unsigned long e[PROF_EVENTS];
+
+    if (PROFILE < 2) {
+        asm volatile ("mrs %0, pmccntr_el0" : "=r" (m->cycles));
+        return;
+    }
+    asm volatile ("mrs %0, pmevcntr0_el0" : "=r" (e[0]));
+    asm volatile ("mrs %0, pmevcntr1_el0" : "=r" (e[1]));
+    asm volatile ("mrs %0, pmevcntr2_el0" : "=r" (e[2]));
+    asm volatile ("mrs %0, pmevcntr3_el0" : "=r" (e[3]));
+    asm volatile ("mrs %0, pmevcntr4_el0" : "=r" (e[4]));
+    asm volatile ("mrs %0, pmevcntr5_el0" : "=r" (e[5]));
+    asm volatile ("mrs %0, pmccntr_el0" : "=r" (m->cycles));
+    for (int i = 0; i < PROF_EVENTS; i++) m->events[i] = e[i];
+#else
+    m->cycles = 0;
+#if defined(__x86_64__)
+    m->cycles = __builtin_ia32_rdtsc();
+#endif
+    if (PROFILE >= 2) {
+        for (int i = 0; i < PROF_EVENTS; i++) m->events[i] = 0;
+    }
+#endif
+}
+
+/* Probes: struct prof_mark t = prof_start(); ... prof_stop(PROF_x, t); */
+static inline struct prof_mark prof_start()
+{
+    struct prof_mark m;
+
+    m.cycles = 0;
+    if (PROFILE) prof_read(&m);
+    return m;
+}
+
+static inline void prof_stop(int phase, struct prof_mark start)
+{
+    struct prof_mark end;
+
+    if (!PROFILE) return;
+    prof_read(&end);
+    prof_record(phase, &start, &end);
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include "smp.h"
+#include "render.h"
+
+// Render core. The game loop on core 0 records its drawing as commands in a ring, and a core of its own runs them, so
+// the logic for the next frame overlaps drawing and presenting this one. There is one producer (core 0) and one
+// consumer (the render core), so the ring needs no lock: each side only ever writes its own counter.
+//
+// Without a render core, render_push runs each command at once, and the game draws exactly as before.
+
+#define RENDER_QUEUE 64 // Commands; must be a power of two.
+
+struct render_cmd
+{
+    void (*fn)(void *arg, int a, int b);
+    void *arg;
+    int a, b;
+};
+
+static struct render_cmd queue[RENDER_QUEUE];
+static unsigned int head; // Commands pushed. Only written by the producer.
+static unsigned int tail; // Commands finished. Only written by the consumer.
+static int running = 0;
+
+static void wait_event()
+{
+#ifdef __aarch64__
+    asm volatile ("wfe");
+#endif
+}
+
+static void send_event()
+{
+#ifdef __aarch64__
+    asm volatile ("dsb sy\n\tsev" : : : "memory");
+#endif
+}
+
+/* The render core's loop. */
+static void render_main()
+{
+    for (;;) {
+        while (__atomic_load_n(&head, __ATOMIC_ACQUIRE) == tail) wait_event();
+
+        struct render_cmd *c = &queue[tail & (RENDER_QUEUE - 1)];
+        c->fn(c->arg, c->a, c->b);
+
+        // The framebuffer is non-cacheable, so its stores must have landed before anyone is told they're done.
+        send_event();
+        __atomic_store_n(&tail, tail + 1, __ATOMIC_RELEASE);
+        send_event();
+    }
+}
+
+/* Hands commands to a core of their own from now on. Call from core 0 after smp_init. If the core isn't running,
+ * commands keep running on core 0. */
+void render_start(int core)
+{
+    render_sync();
+    running = smp_launch(core, render_main);
+}
+
+/* Queues fn(arg, a, b) to run on the render core, waiting for room if the ring is full. Returns the command's sequence
+ * number for render_wait. Anything arg points to must stay untouched until the command has run. */
+unsigned int render_push(void (*fn)(void *arg, int a, int b), void *arg, int a, int b)
+{
+    if (!running) {
+        fn(arg, a, b);
+        tail = ++head;
+        return head;
+    }
+
+    while (head - __atomic_load_n(&tail, __ATOMIC_ACQUIRE) == RENDER_QUEUE) wait_event();
+
+    struct render_cmd *c = &queue[head & (RENDER_QUEUE - 1)];
+    c->fn = fn;
+    c->arg = arg;
+    c->a = a;
+    c->b = b;
+    __atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+    send_event();
+    return head;
+}
+
+/* Returns once the command with sequence number seq, and every one before it, has run. */
+void render_wait(unsigned int seq)
+{
+    while ((int)(__atomic_load_n(&tail, __ATOMIC_ACQUIRE) - seq) < 0) wait_event();
+}
+
+/* Fence: returns once every queued command has run. Core 0 must call this before drawing anything itself. */
+void render_sync()
+{
+    render_wait(head);
+}
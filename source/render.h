@@ -0,0 +1,9 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+void render_start(int core);
+unsigned int render_push(void (*fn)(void *arg, int a, int b), void *arg, int a, int b);
+void render_wait(unsigned int seq);
+void render_sync();
+
+#endif
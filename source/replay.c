@@ -0,0 +1,247 @@
+#include "hal.h"
+#include "replay.h"
+
+// Input recording and replay. Everything the game logic takes from the outside world comes through here: controller
+// reads, the clock it times moves by and its random numbers (replay_random, seeded from the clock at startup). When
+// recording, every controller and clock read is appended to a stream; when replaying, they come back out of the
+// stream instead, so the game takes exactly the same path again. The platform decides which it is and where
+// recordings live (hal_replay_mode).
+//
+// The stream is a 12 byte header (magic, random seed, first clock reading) followed by a record per read or run of
+// reads. The top two bits of a record give the kind of read: the controller (replay_input), the clock (replay_clock)
+// or both at the start of a frame (replay_frame). Then either
+//
+//   kk0nnnnn        n + 1 reads with the same buttons down as the last, and/or the same time apart as the last two
+//   kk1000bi ...    one read with something new: if b, the buttons down follow (2 bytes, bit i set for button i); if
+//                   i, the change in the time between clock reads follows, in microseconds, zigzag coded 7 bits a byte
+//
+// Runs are counted up in place, so only the last byte of a stream being recorded ever changes. A game frame that
+// holds the same buttons as the last costs nothing more than a count in a run.
+
+#define REPLAY_MAX (1 << 20)    // Bytes of recording. Menus polling the controller cost a byte per 32 reads.
+#define REPLAY_MAGIC 0x31524B44 // "DKR1"
+#define REPLAY_HEADER 12
+
+#define READ_INPUT 0x00
+#define READ_CLOCK 0x40
+#define READ_FRAME 0x80
+
+#define REC_KIND 0xC0
+#define REC_NEW 0x20      // Set for a read with something new, clear for a run of repeats.
+#define REC_COUNT 0x1F    // Repeats in a run, less one.
+#define REC_BUTTONS 0x01  // New buttons follow.
+#define REC_INTERVAL 0x02 // A new time between clock reads follows.
+
+static unsigned char stream[REPLAY_MAX];
+static int len;           // Bytes in the stream.
+static int pos;           // Bytes of the stream played back.
+static int run_at = -1;   // Run record still being counted up when recording, or -1.
+static int run, run_kind; // Reads left in the run being played back, and their kind.
+static int mode = HAL_LIVE;
+
+static unsigned int buttons_down; // Last controller read, bit i set for button i.
+static unsigned int clock_time;   // Last clock read.
+static unsigned int interval;     // Time between the last two clock reads.
+static unsigned int seed;
+
+static unsigned int first_time;   // Clock at startup in the recording.
+static unsigned int replay_start; // Clock at startup in this run, for replaying at recorded speed.
+
+static unsigned int get32(int at)
+{
+    return stream[at] | (stream[at + 1] << 8) | (stream[at + 2] << 16) | ((unsigned int) stream[at + 3] << 24);
+}
+
+static void put32(unsigned int n)
+{
+    for (int i = 0; i < 4; i++) stream[len++] = n >> (8 * i);
+}
+
+static int replaying()
+{
+    return mode == HAL_REPLAY || mode == HAL_REPLAY_FAST;
+}
+
+/* Appends a read of the given kind to the recording. */
+static void record(int kind, unsigned int down, unsigned int gap)
+{
+    int changed = 0;
+
+    if (len > REPLAY_MAX - 8) {
+        hal_log("Recording full\n");
+        mode = HAL_LIVE;
+        return;
+    }
+
+    if (kind != READ_CLOCK && down != buttons_down) changed |= REC_BUTTONS;
+    if (kind != READ_INPUT && gap != interval) changed |= REC_INTERVAL;
+
+    if (!changed) {
+        if (run_at >= 0 && (stream[run_at] & REC_KIND) == kind && (stream[run_at] & REC_COUNT) < REC_COUNT) {
+            stream[run_at]++;
+        } else {
+            run_at = len;
+            stream[len++] = kind;
+        }
+    } else {
+        stream[len++] = kind | REC_NEW | changed;
+        if (changed & REC_BUTTONS) {
+            stream[len++] = down;
+            stream[len++] = down >> 8;
+        }
+        if (changed & REC_INTERVAL) {
+            int change = gap - interval;
+            unsigned int zigzag = ((unsigned int) change << 1) ^ (change >> 31);
+
+            for (; zigzag >= 0x80; zigzag >>= 7) stream[len++] = zigzag | 0x80;
+            stream[len++] = zigzag;
+        }
+        run_at = -1;
+    }
+    hal_replay_save(stream, len);
+}
+
+/* Stops replaying and goes back to live input. */
+static int stop(char *why)
+{
+    mode = HAL_LIVE;
+    hal_replay_end(why);
+    return 0;
+}
+
+/* Takes the next read of the given kind out of the recording. Returns 0, having gone back to live input, if the
+ * recording has run out or the game has gone out of step with it. */
+static int play(int kind)
+{
+    if (run == 0) {
+        if (pos >= len) return stop("replay finished");
+
+        int tag = stream[pos++];
+        if ((tag & REC_KIND) != kind) return stop("replay out of step");
+
+        if (tag & REC_NEW) {
+            if (tag & REC_BUTTONS) {
+                buttons_down = stream[pos] | (stream[pos + 1] << 8);
+                pos += 2;
+            }
+            if (tag & REC_INTERVAL) {
+                unsigned int zigzag = 0;
+                for (int shift = 0; pos < len; shift += 7) {
+                    zigzag |= (stream[pos] & 0x7F) << shift;
+                    if (!(stream[pos++] & 0x80)) break;
+                }
+                interval += (zigzag >> 1) ^ -(zigzag & 1);
+            }
+            return 1;
+        }
+        run = (tag & REC_COUNT) + 1;
+        run_kind = kind;
+    } else if (run_kind != kind) {
+        return stop("replay out of step");
+    }
+    run--;
+    return 1;
+}
+
+/* Reads the clock and/or the controller, live or from the recording. Returns the clock. */
+static unsigned int sample(int kind, int *buttons)
+{
+    if (replaying() && play(kind)) {
+        if (kind != READ_INPUT) clock_time += interval;
+
+        // At recorded speed, wait until as much time has passed since startup as had in the recording.
+        if (kind != READ_INPUT && mode == HAL_REPLAY) {
+            int ahead = (clock_time - first_time) - (hal_time() - replay_start);
+            if (ahead > 0) hal_wait(ahead);
+        }
+    } else {
+        unsigned int down = buttons_down, gap = interval;
+
+        if (kind != READ_INPUT) {
+            unsigned int now = hal_time();
+            gap = now - clock_time;
+            clock_time = now;
+        }
+        if (kind != READ_CLOCK) {
+            hal_read_input(buttons);
+            down = 0;
+            for (int i = 0; i < HAL_BUTTONS; i++) {
+                if (buttons[i] == 0) down |= 1 << i;
+            }
+        }
+
+        if (mode == HAL_RECORD) record(kind, down, gap);
+        buttons_down = down;
+        interval = gap;
+    }
+
+    if (kind != READ_CLOCK) {
+        for (int i = 0; i < HAL_BUTTONS; i++) buttons[i] = !(buttons_down & (1 << i));
+    }
+    return clock_time;
+}
+
+/* Starts recording or replaying, if the platform asks for it. Call once, after hal_init and before the game reads the
+ * controller or clock. */
+void replay_init()
+{
+    mode = hal_replay_mode(stream, REPLAY_MAX, &len);
+
+    if (replaying()) {
+        if (len < REPLAY_HEADER || get32(0) != REPLAY_MAGIC) {
+            stop("not a recording");
+        } else {
+            seed = get32(4);
+            first_time = get32(8);
+            pos = REPLAY_HEADER;
+            clock_time = first_time;
+            replay_start = hal_time();
+            return;
+        }
+    }
+
+    first_time = clock_time = hal_time();
+    seed = first_time | 1; // xorshift never leaves 0.
+    if (mode == HAL_RECORD) {
+        len = 0;
+        put32(REPLAY_MAGIC);
+        put32(seed);
+        put32(first_time);
+        hal_replay_save(stream, len);
+    }
+}
+
+/* Reads the controller into buttons, 0 for each button pressed, as hal_read_input does. Returns 1 if any button is
+ * pressed. */
+int replay_input(int *buttons)
+{
+    sample(READ_INPUT, buttons);
+    return buttons_down != 0;
+}
+
+/* Returns the time in microseconds that the game logic goes by. */
+unsigned int replay_clock()
+{
+    return sample(READ_CLOCK, 0);
+}
+
+/* Starts a game frame: reads the clock, then the controller into buttons. Returns the clock. */
+unsigned int replay_frame(int *buttons)
+{
+    return sample(READ_FRAME, buttons);
+}
+
+/* Returns a pseudo-random number (xorshift32), the same sequence again on replay. */
+unsigned int replay_random()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+/* Waits for us microseconds, or not at all when replaying as fast as possible. */
+void replay_wait(int us)
+{
+    if (mode != HAL_REPLAY_FAST) hal_wait(us);
+}
@@ -0,0 +1,11 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+void replay_init();
+int replay_input(int *buttons);
+unsigned int replay_clock();
+unsigned int replay_frame(int *buttons);
+unsigned int replay_random();
+void replay_wait(int us);
+
+#endif
@@ -0,0 +1,148 @@
+#include "gpio.h"
+#include "mmu.h"
+#include "smp.h"
+#include "prof.h"
+
+// Secondary cores. The firmware holds cores 1 to 3 in a spin table, each waiting for an address to jump to. smp_init
+// points them at _secondary in start.S, which gives each one a stack here and calls smp_secondary_main. From then on
+// they wait for smp_run to hand them a band of work, unless smp_launch gives one a job of its own.
+
+#define SPIN_TABLE ((volatile unsigned long*)0xD8) // One entry per core, core 0 first.
+#define TIMER_CLO ((volatile unsigned int*)(MMIO_BASE + 0x3004))
+#define START_TIMEOUT 100000 // Microseconds to wait for the secondary cores to come up.
+
+unsigned char __attribute__((aligned(16))) smp_stacks[SMP_CORES - 1][1 << SMP_STACK_SHIFT];
+
+// One cache line per core, so cores polling their own slot don't disturb each other.
+struct smp_slot
+{
+    unsigned int online; // Set by the core once it is waiting for work.
+    unsigned int go;     // Bumped by the core calling smp_run or smp_launch to hand out a job.
+    unsigned int done;   // Set to go by the core once its band is finished.
+    void (*launch)();    // Set by smp_launch: run this instead of the next band.
+} __attribute__((aligned(64)));
+
+static struct smp_slot slots[SMP_CORES];
+// Cores that came up in time and are given bands. Read by smp_run without synchronization, so smp_launch must have
+// taken its core out before any other core calls smp_run.
+static int started[SMP_CORES];
+
+static void (*job_fn)(int band, int bands, void *arg);
+static void *job_arg;
+
+#ifdef __aarch64__
+void _secondary();
+#endif
+
+/* Returns the number of the core we are running on, 0 to SMP_CORES - 1. */
+int smp_core()
+{
+#ifdef __aarch64__
+    unsigned long mpidr;
+
+    asm volatile ("mrs %0, mpidr_el1" : "=r" (mpidr));
+    return mpidr & 3;
+#else
+    return 0;
+#endif
+}
+
+/* Starts the secondary cores. Call after mmu_init, as they take their translation tables from it. Cores that don't
+ * answer within START_TIMEOUT are left alone, and their bands are drawn by whichever core calls smp_run. */
+void smp_init()
+{
+#ifdef __aarch64__
+    for (int i = 1; i < SMP_CORES; i++) SPIN_TABLE[i] = (unsigned long) _secondary;
+
+    // The waiting cores have their caches off.
+    dcache_clean(SPIN_TABLE, SMP_CORES * sizeof(unsigned long));
+    asm volatile ("sev");
+
+    unsigned int t = *TIMER_CLO;
+    for (int i = 1; i < SMP_CORES; i++) {
+        while (!__atomic_load_n(&slots[i].online, __ATOMIC_ACQUIRE) && *TIMER_CLO - t < START_TIMEOUT);
+        started[i] = slots[i].online;
+    }
+#endif
+}
+
+#ifdef __aarch64__
+/* Entered from start.S by each secondary core, on its own stack. Never returns. */
+void smp_secondary_main(int core)
+{
+    struct smp_slot *s = &slots[core];
+    unsigned int seen = 0;
+
+    mmu_enable();
+    prof_init();
+    __atomic_store_n(&s->online, 1, __ATOMIC_RELEASE);
+
+    for (;;) {
+        while (__atomic_load_n(&s->go, __ATOMIC_ACQUIRE) == seen) asm volatile ("wfe");
+        seen = s->go;
+
+        if (s->launch) s->launch();
+
+        struct prof_mark t = prof_start();
+        job_fn(core, SMP_CORES, job_arg);
+        prof_stop(PROF_BANDS, t);
+
+        // The framebuffer is non-cacheable, so its stores must have landed before core 0 presents the frame.
+        asm volatile ("dsb sy" : : : "memory");
+        __atomic_store_n(&s->done, seen, __ATOMIC_RELEASE);
+        asm volatile ("sev");
+    }
+}
+#endif
+
+/* Hands a secondary core fn to run, which must never return. The core stops taking bands. Returns 0 if the core isn't
+ * running. */
+int smp_launch(int core, void (*fn)())
+{
+    if (core <= 0 || core >= SMP_CORES || !started[core]) return 0;
+
+    started[core] = 0;
+    slots[core].launch = fn;
+    __atomic_store_n(&slots[core].go, slots[core].go + 1, __ATOMIC_RELEASE);
+#ifdef __aarch64__
+    asm volatile ("dsb ish\n\tsev" : : : "memory");
+#endif
+    return 1;
+}
+
+/* Runs job(band, SMP_CORES, arg) once for every band, band n on core n, and returns when all of them have finished.
+ * Bands whose core isn't taking bands are done by the calling core, one after the other, so the result is the same
+ * either way. Jobs must only draw to their own band. Only one core may call this at a time. */
+void smp_run(void (*job)(int band, int bands, void *arg), void *arg)
+{
+    job_fn = job;
+    job_arg = arg;
+
+    for (int i = 1; i < SMP_CORES; i++) {
+        if (started[i]) __atomic_store_n(&slots[i].go, slots[i].go + 1, __ATOMIC_RELEASE);
+    }
+#ifdef __aarch64__
+    asm volatile ("dsb ish\n\tsev" : : : "memory");
+#endif
+
+    struct prof_mark t = prof_start();
+    job(0, SMP_CORES, arg);
+    prof_stop(PROF_BANDS, t);
+    for (int i = 1; i < SMP_CORES; i++) {
+        if (!started[i]) {
+            t = prof_start();
+            job(i, SMP_CORES, arg);
+            prof_stop(PROF_BANDS, t);
+        }
+    }
+
+    // Barrier: wait for the other cores' bands.
+    for (int i = 1; i < SMP_CORES; i++) {
+        if (!started[i]) continue;
+        while (__atomic_load_n(&slots[i].done, __ATOMIC_ACQUIRE) != slots[i].go) {
+#ifdef __aarch64__
+            asm volatile ("wfe");
+#endif
+        }
+    }
+}
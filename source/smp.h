@@ -0,0 +1,14 @@
+#ifndef SMP_H
+#define SMP_H
+
+#define SMP_CORES 4
+#define SMP_STACK_SHIFT 16 // Each secondary core gets a 64KB stack.
+
+#ifndef __ASSEMBLER__
+void smp_init();
+int smp_core();
+int smp_launch(int core, void (*fn)());
+void smp_run(void (*job)(int band, int bands, void *arg), void *arg);
+#endif
+
+#endif
@@ -57,11 +57,12 @@ struct object
     // Boolean used for packs and exits, removes them from the map after DK collides with them.
     int exists;
 
-    // Boolean used to indicate that an enemy has collided with a pack, a vehicle, or an exit.
-    int trampled;
-
     int sprite_tracker;
 
+    // Atlas frame and whether it's drawn flipped, only used for DK and enemies.
+    int frame;
+    int mirrored;
+
     // Used to indicate whether an enemy is flying or not.
     int flying;
 };
@@ -85,6 +86,8 @@ struct projectile
 
     struct image sprite;
     struct coord loc;
+
+    int frame; // Atlas frame of the sprite.
 };
 
 // Gamestate structure
@@ -1,135 +0,0 @@
-/* GIMP RGBA C-Source image dump (teleporter.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[32 * 32 * 4 + 1];
-} teleporter = {
-  32, 32, 4,
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000>^\030P\000\000\000\000G\015\024\377\240(\067\250\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\377\377\377\207\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000G\015"
-  "\024\377\015\005\006$\000\000\000\000G\015\024\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000G\015\024\377\240(\067}\373bu\221"
-  "\000\000\000\000G\015\024\377\000\000\000\000\015\005\006\311\240(\067rG\015\024\377\000\000\000\000<\020E\270"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\005\006\236\373bu\204\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000G\015\024\377\000\000\000\000<\020E\352\000\000\000\000"
-  "\000\000\000\000G\015\024\377\000\000\000\000\000\000\000\000g\027!\377g\027!\377g\027!\377g\027!\377\000"
-  "\000\000\000\000\000\000\000>^\030\377\000\000\000\000\240(\067\311\015\005\006`\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\373bue\000\000\000\000\000\000\000\000<\020EI\000\000\000\000\000\000\000\000g"
-  "\027!\377O\015\025\377O\015\025\377O\015\025\377O\015\025\377g\027!\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000G\015\024\377\000\000\000\000\000\000\000\000\377\377\377\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000G\015"
-  "\024\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000G\015\024\377\000\000\000\000g\027!\377O\015\025"
-  "\377O\015\025\377G\015\024\377G\015\024\377O\015\025\377O\015\025\377g\027!\377\000\000"
-  "\000\000\000\000\000\000G\015\024\377G\015\024\377<\020E\204\000\000\000\000G\015\024\377\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\020\026Et\000\000\000\000\000\000\000\000\000\000\000\000g\027!\377O\015\025\377O\015\025"
-  "\377G\015\024\377=\010\016\377=\010\016\377G\015\024\377O\015\025\377O\015\025\377g\027"
-  "!\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000G\015\024\377\000\000\000\000G\015\024\377\000\000\000\000g\027!\377O\015\025\377G\015\024\377"
-  "=\010\016\377=\010\016\377=\010\016\377=\010\016\377G\015\024\377O\015\025\377g\027!\377"
-  "\000\000\000\000\000\000\000\000\240(\067\270\000\000\000\000\373buh\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240(\067e\000\000\000"
-  "\000\000\000\000\000\015\005\006*\015\005\006\"\000\000\000\000g\027!\377O\015\025\377G\015\024\377=\010\016"
-  "\377\063\011\016\377\063\011\016\377=\010\016\377G\015\024\377O\015\025\377g\027!\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000G\015\024\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\377\377\377'\000\000\000\000g\027!\377g\027!\377O\015\025\377G\015\024\377="
-  "\010\016\377\063\011\016\377\063\011\016\377=\010\016\377G\015\024\377O\015\025\377g\027"
-  "!\377g\027!\377\000\000\000\000\015\005\006\236\015\005\006H\020\026Eh\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000<\020E\061\000\000\000\000g\027!\377O\015\025\377O\015\025\377G\015\024\377"
-  "=\010\016\377\063\011\016\377\063\011\016\377=\010\016\377G\015\024\377O\015\025\377O\015"
-  "\025\377g\027!\377\000\000\000\000\373buz\000\000\000\000G\015\024\377\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\221"
-  "\373bu<G\015\024\377\000\000\000\000\000\000\000\000\000\000\000\000g\027!\377O\015\025\377G\015\024\377"
-  "=\010\016\377=\010\016\377\063\011\016\377\063\011\016\377=\010\016\377=\010\016\377G\015"
-  "\024\377O\015\025\377g\027!\377G\015\024\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000>^"
-  "\030\250\000\000\000\000G\015\024\377\015\005\006rG\015\024\377\240(\067\311g\027!\377O\015\025"
-  "\377G\015\024\377=\010\016\377\063\011\016\377\063\011\016\377\063\011\016\377\063\011\016"
-  "\377=\010\016\377G\015\024\377O\015\025\377g\027!\377\000\000\000\000G\015\024\377\000\000\000\000"
-  "\000\000\000\000G\015\024\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\026Eh\000\000\000\000\000\000\000\000g\027!\377"
-  "O\015\025\377G\015\024\377=\010\016\377\063\011\016\377\063\011\016\377\063\011\016\377"
-  "\063\011\016\377=\010\016\377G\015\024\377O\015\025\377g\027!\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\240(\067h\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000g\027"
-  "!\377O\015\025\377G\015\024\377=\010\016\377\063\011\016\377\063\011\016\377\063\011\016"
-  "\377\063\011\016\377=\010\016\377G\015\024\377O\015\025\377g\027!\377G\015\024\377\000"
-  "\000\000\000\000\000\000\000G\015\024\377\377\377\377y\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\240(\067;\000\000\000\000<"
-  "\020E$\000\000\000\000g\027!\377O\015\025\377G\015\024\377=\010\016\377\063\011\016\377\063\011"
-  "\016\377\063\011\016\377\063\011\016\377=\010\016\377G\015\024\377O\015\025\377g\027!\377"
-  "\015\005\006y<\020E@\015\005\006n\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\005\006\311\000\000\000\000\377\377"
-  "\377\"G\015\024\377\000\000\000\000g\027!\377O\015\025\377G\015\024\377=\010\016\377\063\011"
-  "\016\377\063\011\016\377\063\011\016\377\063\011\016\377=\010\016\377G\015\024\377O\015"
-  "\025\377g\027!\377\000\000\000\000\000\000\000\000G\015\024\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000G\015\024\377\000\000\000\000g\027!\352O\015\025\377G\015\024\377=\010"
-  "\016\377=\010\016\377\063\011\016\377\063\011\016\377=\010\016\377=\010\016\377G\015\024"
-  "\377O\015\025\377g\027!\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000g\027!\311O\015\025\377O\015\025\377G"
-  "\015\024\377=\010\016\377\063\011\016\377\063\011\016\377=\010\016\377G\015\024\377O\015"
-  "\025\377O\015\025\377g\027!\377\000\000\000\000\000\000\000\000G\015\024\377\015\005\006\311\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\005\006\270\000\000\000\000\000\000\000\000g\027!\377O\015"
-  "\025\377G\015\024\377=\010\016\377\063\011\016\377\063\011\016\377=\010\016\377G\015\024"
-  "\377O\015\025\377g\027!\377\000\000\000\000\000\000\000\000>^\030\204\373buj\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000G\015\024\377\000\000\000\000\240(\067i\000\000\000\000g\027!\377O\015"
-  "\025\377G\015\024\377=\010\016\377=\010\016\377=\010\016\377=\010\016\377G\015\024\377"
-  "O\015\025\377g\027!\377\000\000\000\000G\015\024\377\015\005\006\236\000\000\000\000G\015\024\377\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\005\006\232\000\000\000\000g\027!\352"
-  "O\015\025\377O\015\025\377G\015\024\377=\010\016\377=\010\016\377G\015\024\377O\015\025"
-  "\377O\015\025\377g\027!\377\000\000\000\000<\020E\261\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\250\000\000\000\000"
-  "g\027!\377O\015\025\377O\015\025\377G\015\024\377G\015\024\377O\015\025\377O\015\025\377"
-  "g\027!\377\000\000\000\000\240(\067\354\240(\067fG\015\024\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000G\015\024\377\373bu\377\000\000"
-  "\000\000g\027!\377O\015\025\377O\015\025\377O\015\025\377O\015\025\377g\027!\377\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000^\\W\377^\\W\377^\\W\377^\\W\377^\\W\377^\\W\377\007\006\005\377g\027"
-  "!\352g\027!\352g\027!\311g\027!\352\007\006\005\352LKG\352LKG\352LKG\352QOL\377QO"
-  "L\377QOL\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\\W\377^\\W\377LKG\377LKG\377"
-  "LKG\377LKG\377\007\006\005\377Y\013\026\377g\027!\377g\027!\377Y\013\026\377Y\013\026\377"
-  "g\027!\377\007\006\005\377LKG\377LKG\377LKG\377LKG\377QOL\377\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000LKG\377LKG\377LKG\377LKG\377LKG\377LKG\377LKG\377\007\006\005\377\007\006\005\377"
-  "\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377\007\006\005\377LKG\377LKG\377"
-  "LKG\377RQO\377LKG\377LKG\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000QOL\377QOL\377RQO\377LKG\377LKG\377L"
-  "KG\377ED@\377LKG\377LKG\377LKG\377LKG\377ED@\377LKG\377ED@\377ED@\377LKG"
-  "\377LKG\377LKG\377RQO\377RQO\377LKG\377LKG\377LKG\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000LKG\377LKG\377LKG\377RQO\377"
-  "RQO\377LKG\377LKG\377LKG\377RQO\377RQO\377RQO\377RQO\377LKG\377LKG\377LK"
-  "G\377RQO\377RQO\377RQO\377LKG\377LKG\377LKG\377LKG\377RQO\377RQO\377LKG\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
-};
-
@@ -1,8436 +0,0 @@
-/* GIMP RGBA C-Source image dump (titleScreen.c) */
-
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 pixel_data[481 * 100 * 4 + 1];
-} title_screen = {
-  481, 100, 4,
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311D\352\325\306\314\352\324"
-  "\305\356\352\325\305\314\352\325\306\314\352\325\306\314\352\325\306\314"
-  "\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325"
-  "\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314"
-  "\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325"
-  "\306\314\352\325\306\314\352\325\306\314\352\325\305\314\352\324\305\356"
-  "\352\326\306\252\355\332\313\"\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\354\332\312\"\352\325\306\314\352\324\305\356\352\325\305"
-  "\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352"
-  "\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306"
-  "\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352"
-  "\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306"
-  "\314\352\325\306\314\352\325\305\314\352\324\305\356\352\325\306\314\354"
-  "\331\312D\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\355\332\313\"\352\326\306\252\352\324"
-  "\305\356\352\325\305\314\352\325\306\314\352\325\306\314\352\325\306\314"
-  "\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325"
-  "\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314"
-  "\352\325\306\314\352\325\306\314\352\325\306\314\352\325\306\314\352\325"
-  "\306\314\352\325\306\314\352\325\306\314\352\325\305\314\352\324\305\356"
-  "\352\325\306\314\354\331\312?\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\355\334\314\210\353\326\307\377\352\324\305\377\352\325\305"
-  "\377\352\325\306\377\352\325\306\377\352\325\306\377\352\325\306\377\352"
-  "\325\306\377\352\325\306\377\352\325\306\377\352\325\306\377\352\325\306"
-  "\377\352\325\306\377\352\325\306\377\352\325\306\377\352\325\306\377\352"
-  "\325\305\377\352\324\305\377\352\325\306\377\354\332\312\356\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\346\314\275\377\334\267\251\377\327\253\236\377\326\250\234\377\327"
-  "\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236"
-  "\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327"
-  "\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236"
-  "\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327"
-  "\252\236\377\327\252\236\377\327\252\235\377\326\250\234\377\330\254\240"
-  "\377\336\273\255\377\350\321\302\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347"
-  "\320\301\377\336\272\254\377\330\254\240\377\326\250\234\377\327\252\235"
-  "\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327"
-  "\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236"
-  "\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327"
-  "\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236"
-  "\377\327\252\236\377\327\252\235\377\326\250\234\377\330\253\237\377\335"
-  "\270\252\377\346\315\276\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\320\301\377\336\272\255\377\330"
-  "\254\240\377\326\250\234\377\327\252\235\377\327\252\236\377\327\252\236"
-  "\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327"
-  "\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236"
-  "\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327"
-  "\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236"
-  "\377\326\250\234\377\327\253\237\377\334\267\252\377\346\314\276\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\340\276\260\377\331\256"
-  "\241\377\326\251\234\377\327\251\235\377\327\252\236\377\327\252\236\377"
-  "\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252"
-  "\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377"
-  "\327\252\236\377\327\252\236\377\327\252\235\377\326\250\234\377\330\254"
-  "\237\377\335\271\254\377\347\317\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\335\271"
-  "\254\377\330\254\237\377\326\250\234\377\327\252\235\377\327\252\236\377"
-  "\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252"
-  "\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377"
-  "\327\252\236\377\327\252\236\377\327\252\236\377\327\251\235\377\326\251"
-  "\234\377\331\256\241\377\337\276\260\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\343\306\270\377\332\262\245\377\327\251\235\377"
-  "\327\251\234\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252"
-  "\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377"
-  "\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252"
-  "\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377"
-  "\327\251\235\377\327\251\235\377\332\261\244\377\342\304\266\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\371\362\341\"\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\370\362\341\"\371\362\341\"\000\000\000\377\000\000\000\377\350\320"
-  "\301f\336\272\255\377\330\254\240\377\326\250\234\377\327\252\235\377\327"
-  "\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236"
-  "\377\327\252\236\377\327\252\236\377\327\251\235\377\327\251\235\377\332"
-  "\260\244\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\371\362\341\"\370\362\341\"\000\000\000\377"
-  "\000\000\000\377\343\307\271\377\333\263\246\377\327\252\235\377\327\251\234\377"
-  "\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252"
-  "\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377"
-  "\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252"
-  "\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377"
-  "\327\252\236\377\327\252\236\377\327\252\236\377\327\252\236\377\327\252"
-  "\236\377\327\251\235\377\326\250\234\377\330\255\241\377\337\274\257\377"
-  "\351\322\303\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\323\304\377\332\261\244"
-  "\377\313\211\177\377\303of\377\302ha\377\303ld\377\303me\377\303me\377\303"
-  "me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me"
-  "\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377"
-  "\303me\377\303me\377\302kc\377\302ha\377\304sj\377\316\222\207\377\336\272"
-  "\254\377\354\331\312D\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\353\330\310f\335\270\252\377\315\220"
-  "\205\377\304ri\377\302h`\377\303lc\377\303me\377\303me\377\303me\377\303"
-  "me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me"
-  "\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377"
-  "\303me\377\303ld\377\302h`\377\304pg\377\314\213\201\377\333\263\246\377"
-  "\352\325\306\314\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\354\331\311D\335\271\254\377\316\221\206\377\304rj\377\302h`\377\302"
-  "kc\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me"
-  "\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377"
-  "\303me\377\303me\377\303me\377\303me\377\303me\377\303ld\377\302ha\377\303"
-  "og\377\313\212\200\377\332\262\245\377\351\324\305\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\356"
-  "\335\315f\340\300\262\377\320\230\215\377\305vm\377\302ia\377\302kc\377\303"
-  "me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me"
-  "\377\303me\377\303me\377\303me\377\303me\377\303me\377\303ld\377\302h`\377"
-  "\304qh\377\315\216\204\377\334\266\251\377\353\327\307\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\353\327\310\377\334\267"
-  "\251\377\315\217\204\377\304qi\377\302h`\377\303ld\377\303me\377\303me\377"
-  "\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303"
-  "me\377\303me\377\303me\377\303me\377\302kc\377\302ia\377\305vm\377\320\230"
-  "\215\377\340\277\261\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\313\275"
-  "\377\326\246\232\377\310\200v\377\302kc\377\302ia\377\303me\377\303me\377"
-  "\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303"
-  "me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me"
-  "\377\302ja\377\302jb\377\307}t\377\324\243\227\377\344\310\272\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\271\254\377\316\221"
-  "\206\377\304rj\377\302h`\377\303lc\377\303me\377\303me\377\303me\377\303"
-  "me\377\303me\377\303me\377\303me\377\302jb\377\302jb\377\307|s\377\324\241"
-  "\225\377\344\307\271\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\346\315\276\314\327\251"
-  "\235\377\311\202x\377\303ld\377\302ia\377\303me\377\303me\377\303me\377\303"
-  "me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me"
-  "\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377\303me\377"
-  "\303me\377\303me\377\303me\377\303me\377\303me\377\302kc\377\302ia\377\305"
-  "tk\377\317\225\212\377\337\274\257\377\355\333\313\252\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\354\331\312D\354\331\312D\354\331\312D\000\000\000\377\000\000\000\377\351"
-  "\324\305\356\337\275\260\377\317\225\212\377\277^W\377\267'$\377\265\004\007"
-  "\377\266\034\034\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377"
-  "\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266"
-  "\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037"
-  "\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\040\037\377\266\030\030"
-  "\377\265\004\006\377\270\063/\377\302kc\377\323\237\224\377\342\304\266\377\353"
-  "\326\307\252\000\000\000\377\355\332\313\"\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\355\332"
-  "\313\"\000\000\000\377\352\326\306\252\341\302\264\377\322\235\221\377\302h`\377"
-  "\270\060,\377\265\004\006\377\266\031\031\377\266\040\037\377\266\037\037\377\266\037"
-  "\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037"
-  "\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377"
-  "\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266"
-  "\037\037\377\266\033\033\377\265\003\006\377\267*&\377\300bZ\377\320\230\214\377"
-  "\340\277\261\377\352\324\305\356\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\355\332\313\"\000\000"
-  "\000\377\353\326\307\252\342\303\265\377\323\236\223\377\302jb\377\270\062."
-  "\377\265\004\006\377\266\030\030\377\266\040\037\377\266\037\037\377\266\037\037\377"
-  "\266\037\037\377\266\037\037\377\266\037\037\377\266\040\037\377\266!\037\377\266"
-  "!\037\377\266\"\037\377\266\"\037\377\266!\037\377\266\040\037\377\266\037\037\377"
-  "\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266"
-  "\034\033\377\265\004\006\377\267(%\377\300_X\377\317\226\213\377\337\276\260\377"
-  "\352\324\305\377\355\333\313\252\355\333\313\252\354\331\312\356\354\331"
-  "\312\356\354\331\312\356\355\333\313\252\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\355\334\314\210\354\331\312\356\354\331"
-  "\311\356\354\331\312\356\354\331\312\356\354\331\312\356\354\331\312\356"
-  "\354\332\312\314\355\333\314\252\353\330\310\377\344\310\272\377\326\246"
-  "\232\377\305ul\377\271;\067\377\265\010\012\377\265\024\024\377\266\040\037\377"
-  "\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266"
-  "\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037"
-  "\037\377\266\040\037\377\266\032\032\377\265\003\006\377\267.*\377\301f^\377\321\233"
-  "\220\377\341\301\263\377\352\325\306\377\355\333\314\314\355\333\313\314"
-  "\354\331\312\377\354\331\312\377\354\331\312\377\355\333\314\314\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\357\340\320\"\355\333\313\314\354\331\312\377\354\331\312"
-  "\377\354\331\312\377\354\331\312\377\354\331\312\377\354\331\312\377\354"
-  "\331\312\377\354\331\312\377\354\331\312\377\354\331\312\377\354\331\312"
-  "\377\354\331\312\377\354\331\312\377\354\331\312\377\354\331\312\377\354"
-  "\331\312\377\354\331\312\377\354\331\312\377\354\331\312\377\354\331\311"
-  "\377\354\331\312\377\355\334\314\252\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\341\302\264"
-  "\377\321\233\220\377\301f_\377\270.+\377\265\003\006\377\266\031\031\377\266\040"
-  "\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037"
-  "\377\266\037\037\377\266\037\037\377\266\037\037\377\266\040\037\377\266\040\037\377"
-  "\266!\037\377\266\"\037\377\266\027\025\377\265\013\011\377\271;\066\377\305sk\377"
-  "\325\245\231\377\344\311\272\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302D\333\264\247"
-  "\377\312\207}\377\274OH\377\266\031\027\377\265\011\014\377\266\037\036\377\266"
-  "\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037"
-  "\037\377\266\040\037\377\266!\037\377\266\"\037\377\267\"\037\377\267\"\037\377"
-  "\267\"\037\377\267\"\037\377\267\"\037\377\267\"\037\377\267\"\037\377\266\020"
-  "\016\377\266\026\023\377\273ID\377\311\202y\377\332\261\244\377\347\316\277"
-  "\252\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\303\265\377\323\236\223\377\302"
-  "jb\377\270\061-\377\265\004\006\377\266\030\030\377\266\040\037\377\266\037\037\377"
-  "\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\040\037\377\265"
-  "\015\017\377\266\022\022\377\273GB\377\310\200v\377\331\257\242\377\347\316\300"
-  "\252\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\350\321\302D\334\266\251\377\314\212\200\377\275RL\377\266\034\032"
-  "\377\265\010\012\377\266\037\036\377\266\037\037\377\266\037\037\377\266\037\037\377"
-  "\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266"
-  "\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037"
-  "\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037\377\266\037\037"
-  "\377\266\037\037\377\266\037\037\377\266\040\037\377\266\026\026\377\265\005\007\377"
-  "\270\066\062\377\303og\377\324\242\226\377\343\306\270\377\353\327\310\377"
-  "\355\333\313\252\355\332\313\314\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\343\307\270\377\334\267\252\377\332\261\244\377\332\261\244"
-  "\377\332\262\245\377\333\263\246\377\333\263\246\377\330\255\240\377\321"
-  "\231\216\377\305tk\377\271=\071\377\263\000\000\377\261\000\000\377\262\000\000\377\262"
-  "\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\264\000\000\377\274KF\377\310~t\377\323\237"
-  "\223\377\331\257\242\377\332\262\245\377\333\263\246\377\336\273\256\377"
-  "\347\316\277\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\346\315\276\377\336\273\255\377\333\263\246\377\332\262\245\377\331"
-  "\256\242\377\322\235\222\377\307{r\377\273HB\377\264\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\261\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\263\000\000\377\272A<\377\305"
-  "vn\377\321\232\217\377\330\255\241\377\333\263\246\377\333\263\246\377\332"
-  "\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245"
-  "\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332"
-  "\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332\261\245"
-  "\377\332\260\243\377\333\262\246\377\337\275\260\377\350\320\301\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\347\316\277\377\336\273\256\377\333\263\246\377\332\262\245"
-  "\377\331\257\242\377\323\236\223\377\307}s\377\273JD\377\264\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\263"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\263\000\000\377\272"
-  "?:\377\305ul\377\321\231\216\377\330\255\240\377\333\263\246\377\333\263"
-  "\246\377\332\262\245\377\332\261\244\377\332\261\244\377\334\267\252\377"
-  "\343\306\270\377\354\331\312\356\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\357\337\317\""
-  "\345\313\275\377\336\272\254\377\332\261\244\377\332\260\243\377\332\262"
-  "\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377"
-  "\333\263\246\377\332\260\244\377\324\242\227\377\312\204z\377\275UN\377\265"
-  "\000\003\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\264"
-  "\000\000\377\273F@\377\306zq\377\322\234\221\377\331\256\242\377\333\263\246"
-  "\377\333\263\246\377\332\262\245\377\332\260\244\377\332\261\244\377\335"
-  "\270\253\377\344\311\273\377\356\335\315\210\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\355\332\313\356\343\306\270\377\334"
-  "\267\251\377\332\261\244\377\332\261\244\377\332\262\245\377\332\262\245"
-  "\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332"
-  "\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245"
-  "\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332"
-  "\262\245\377\332\262\245\377\332\260\243\377\332\261\245\377\336\272\254"
-  "\377\346\314\275\377\357\337\317D\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\347\317\301\377\335\271\253\377\322\235\222\377\306xo\377\273"
-  "E@\377\264\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\262\000"
-  "\000\377\265\002\002\377\275SL\377\311\201x\377\325\244\230\377\340\276\261\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\343"
-  "\307\270\377\331\256\242\377\315\217\204\377\301e]\377\267*'\377\262\000\000"
-  "\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000"
-  "\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000"
-  "\377\263\000\000\377\263\000\000\377\267#\040\377\300c[\377\314\215\203\377\326\250"
-  "\233\377\332\262\245\377\333\263\246\377\332\262\245\377\332\262\245\377"
-  "\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262"
-  "\245\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245\377"
-  "\332\260\244\377\332\261\244\377\335\271\254\377\346\314\275\356\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\347\316\300\252\336\273\256\377\332\262\245\377\332"
-  "\260\243\377\332\262\245\377\332\262\245\377\332\262\245\377\332\262\245"
-  "\377\332\261\244\377\332\260\243\377\333\263\246\377\337\275\260\377\350"
-  "\320\301f\000\000\000\377\000\000\000\377\371\363\342D\371\362\341\"\000\000\000\377\000\000\000"
-  "\377\345\313\274\377\335\271\254\377\332\261\244\377\332\260\244\377\332"
-  "\262\245\377\333\263\246\377\333\263\246\377\331\257\242\377\322\236\223"
-  "\377\307}s\377\273JD\377\264\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\261\000\000\377\262\000\000\377\266\037\035\377\277_W\377\314\212\200\377\327\253"
-  "\237\377\342\304\266\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\343\305\267\377\334\266"
-  "\251\377\332\262\245\377\332\261\245\377\327\252\236\377\316\222\210\377"
-  "\302jb\377\270.+\377\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\261"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\264\000\000\377\274"
-  "OI\377\310\200w\377\323\240\225\377\331\257\243\377\332\262\245\377\333\263"
-  "\246\377\337\274\257\377\347\317\301\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\344\311"
-  "\272\377\325\245\231\377\311\204z\377\305tl\377\305tl\377\306wn\377\306x"
-  "o\377\306xo\377\305tk\377\301f^\377\274MG\377\267($\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\270\061"
-  "-\377\275SM\377\302jb\377\305ul\377\305tl\377\306xo\377\315\216\204\377\333"
-  "\263\246\377\351\324\305\356\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-  "\322\303\377\332\261\244\377\314\214\202\377\306xo\377\305ul\377\305ul\377"
-  "\302ia\377\275RK\377\270/+\377\265\000\000\377\264\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\267*&\377\274NH\377\301g_\377"
-  "\305tl\377\306xo\377\306xo\377\306wn\377\306wn\377\306wn\377\306wn\377\306"
-  "wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn"
-  "\377\306wn\377\305vm\377\305sj\377\306yp\377\316\222\207\377\334\267\252"
-  "\377\353\327\307\210\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\351\323\304\377\332\262\245\377\315\215\203\377\306xo"
-  "\377\305tl\377\305ul\377\302jb\377\275SL\377\270\061,\377\265\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\267"
-  ")%\377\274MG\377\301f_\377\305tk\377\306xo\377\306xo\377\306wn\377\305tk"
-  "\377\305tl\377\312\204z\377\326\246\232\377\345\313\274\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\350\320\301\377\331\256\241\377\313\212\200\377\305vm\377\305"
-  "tk\377\306wn\377\306wn\377\306wn\377\306wn\377\306xo\377\306yp\377\305vm"
-  "\377\303me\377\276XQ\377\271\070\063\377\265\010\005\377\264\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\270-)\377\275QJ\377\302"
-  "ia\377\305ul\377\306xo\377\306xo\377\306wn\377\305tk\377\305ul\377\312\207"
-  "}\377\327\252\236\377\346\315\276\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\344\310\272\377\325\244\230\377\311\203y\377"
-  "\305tl\377\305tl\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306"
-  "wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn"
-  "\377\306wn\377\306wn\377\306wn\377\306wn\377\305tk\377\305vm\377\314\212"
-  "\200\377\331\257\242\377\350\321\302\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\353\327\310\377\334\267\251\377\315\217\204\377\302jb\377\273JD"
-  "\377\267+'\377\265\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377"
-  "\264\000\000\377\265\005\004\377\270\063.\377\275QK\377\304rj\377\320\230\215\377"
-  "\340\277\261\377\000\000\000\377\000\000\000\377\371\362\341\"\000\000\000\377\000\000\000\377\345"
-  "\313\274\377\326\247\232\377\310\177v\377\277]U\377\271>\071\377\266\034\030"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000"
-  "\377\264\000\000\377\264\000\000\377\264\000\000\377\266\026\024\377\272A<\377\277^W\377"
-  "\304ph\377\306wn\377\306xo\377\306xo\377\306wn\377\306wn\377\306wn\377\306"
-  "wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn\377\306wn\377\305tk"
-  "\377\305vm\377\313\211\177\377\331\257\242\377\350\320\302f\000\000\000\377\000\000"
-  "\000\377\333\264\247\377\314\215\203\377\306wn\377\305sk\377\306wn\377\306"
-  "wn\377\306wn\377\306wn\377\305vm\377\305sj\377\306yp\377\316\222\207\377"
-  "\334\267\252\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\317"
-  "\300\210\330\255\240\377\313\211\177\377\305vm\377\305tk\377\306wn\377\306"
-  "xo\377\306xo\377\305um\377\302jb\377\275SL\377\270\060,\377\265\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\266\025\022\377\271"
-  ":\065\377\276XR\377\307zq\377\324\241\226\377\343\307\271\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\343"
-  "\307\270\377\324\243\227\377\311\202x\377\305ul\377\305ul\377\304ri\377\300"
-  "bZ\377\273F@\377\266\037\033\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\265\002"
-  "\000\377\270\064/\377\275UO\377\302kc\377\305ul\377\305tl\377\306yp\377\316"
-  "\220\206\377\334\265\250\377\352\326\306\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302\377\332\262\245"
-  "\377\311\203y\377\274MG\377\267$!\377\267$!\377\267.+\377\267.+\377\267."
-  "+\377\267,*\377\267%$\377\266\030\032\377\266\021\013\377\270\040\001\377\274\064"
-  "\000\377\277B\000\377\301H\000\377\302I\000\377\301I\000\377\301I\000\377\301I\000\377"
-  "\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000"
-  "\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\302I\000\377\302I\000\377\301"
-  "G\000\377\277?\000\377\273\060\000\377\267\034\002\377\266\021\017\377\266\033\034\377"
-  "\267(&\377\267+(\377\266\040\036\377\270\060,\377\300`Y\377\320\226\213\377"
-  "\340\277\261\377\353\327\310\210\000\000\000\377\000\000\000\377\353\326\307\252\337"
-  "\275\260\377\317\223\211\377\277]V\377\270.*\377\266\040\036\377\267,)\377"
-  "\267'%\377\266\033\034\377\266\021\016\377\267\035\002\377\273\061\000\377\277@\000\377"
-  "\301G\000\377\302I\000\377\302I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000"
-  "\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301"
-  "I\000\377\301I\000\377\301I\000\377\301I\000\377\302I\000\377\301H\000\377\277A\000\377"
-  "\273\063\000\377\270\037\001\377\266\021\014\377\266\031\032\377\267&$\377\267-*\377"
-  "\270/+\377\270/+\377\270/+\377\270/+\377\270.+\377\267.+\377\267.+\377\267"
-  ".+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+"
-  "\377\267+(\377\266\037\035\377\270\064\060\377\301f_\377\321\233\217\377\342"
-  "\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\354\331\311D\340\276\261\377\317\225\212\377\300_X\377\270\060,\377\266\040"
-  "\036\377\267+(\377\267'%\377\266\033\034\377\266\021\016\377\267\034\002\377\273"
-  "\060\000\377\277?\000\377\301G\000\377\302I\000\377\302I\000\377\301I\000\377\302I\000\377"
-  "\302I\000\377\300E\000\377\275:\000\377\271)\000\377\267\033\000\377\271&\000\377\274"
-  "\067\000\377\300D\000\377\301I\000\377\302I\000\377\301I\000\377\301I\000\377\302I\000\377"
-  "\301H\000\377\277A\000\377\274\064\000\377\270\040\001\377\266\021\014\377\266\031\032"
-  "\377\267%$\377\267-*\377\270/+\377\270/+\377\270/+\377\266\"\037\377\267#"
-  "\040\377\275RL\377\315\217\204\377\341\301\263\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\356\336\316D\356\335\315f\356\335\316f\356\336\316D\356"
-  "\336\316D\356\336\316D\356\336\316D\356\336\316D\356\336\316D\356\336\316"
-  "D\357\337\317\"\357\336\317D\352\325\306\377\336\273\255\377\315\220\205"
-  "\377\276YR\377\267+(\377\266\040\036\377\267-*\377\267.+\377\267.+\377\267"
-  ".+\377\267.+\377\270/,\377\267.+\377\267)'\377\266\036\036\377\265\022\021\377"
-  "\267\030\003\377\272-\000\377\276=\000\377\301F\000\377\302I\000\377\302I\000\377\301"
-  "I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377"
-  "\302I\000\377\302I\000\377\301G\000\377\277@\000\377\273\062\000\377\270\037\001\377\266"
-  "\023\015\377\266\033\033\377\267'%\377\267-*\377\267.+\377\267.+\377\267.+\377"
-  "\266\"\037\377\267(%\377\275SM\377\313\212\177\377\334\267\251\377\352\324"
-  "\305\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302\377"
-  "\332\261\244\377\311\202x\377\274LF\377\267$!\377\267$!\377\267.+\377\267"
-  ".+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+"
-  "\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377"
-  "\267-*\377\266\040\036\377\267,(\377\276ZS\377\315\220\205\377\336\273\256"
-  "\377\353\327\307\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302\377\325\246"
-  "\231\377\302jb\377\267-*\377\264\000\000\377\265\013\004\377\270\037\001\377\273\062"
-  "\000\377\277@\000\377\301G\000\377\302I\000\377\302I\000\377\301I\000\377\301I\000\377"
-  "\301I\000\377\301I\000\377\302I\000\377\302I\000\377\300F\000\377\276<\000\377\272+\000"
-  "\377\266\023\000\377\265\000\000\377\265\000\000\377\265\003\003\377\265\000\000\377\265\000\000"
-  "\377\271;\066\377\306yp\377\332\261\244\377\000\000\000\377\000\000\000\377\371\363\342"
-  "D\000\000\000\377\000\000\000\377\341\301\263\377\315\217\204\377\275QK\377\265\021\021"
-  "\377\265\000\000\377\266\025\007\377\271'\000\377\275\071\000\377\300D\000\377\301I\000\377"
-  "\302I\000\377\301I\000\377\302I\000\377\302I\000\377\301H\000\377\277A\000\377\273\063"
-  "\000\377\270\036\000\377\265\003\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\003\006\377\266\025"
-  "\025\377\266\"!\377\267+(\377\267.+\377\270.,\377\267.+\377\267.+\377\267"
-  ".+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+\377\267.+"
-  "\377\267-*\377\266!\037\377\267*'\377\276WQ\377\316\221\206\377\336\273\256"
-  "\377\346\315\276\314\340\277\261\377\320\227\214\377\277_W\377\270/+\377"
-  "\266\037\035\377\267,)\377\267.+\377\267.+\377\267.+\377\267+(\377\266\037\035"
-  "\377\270\065\060\377\301g_\377\322\234\220\377\342\303\265\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\335\271\254\377\315\216\203\377\276WP\377\267"
-  "*'\377\266!\037\377\267-*\377\267.+\377\267.,\377\267-*\377\267'%\377\266"
-  "\033\034\377\266\021\016\377\267\034\002\377\273\060\000\377\277@\000\377\301G\000\377"
-  "\302I\000\377\302I\000\377\301I\000\377\302I\000\377\302I\000\377\300E\000\377\275;\000"
-  "\377\271)\000\377\266\027\006\377\265\000\000\377\265\005\010\377\273IC\377\312\207}"
-  "\377\336\273\256\377\000\000\000\377\000\000\000\377\370\362\340\"\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\350\320\301f\331\257\242\377\310\177v\377\273ID\377"
-  "\267#!\377\267%\"\377\267,)\377\266#\"\377\266\026\027\377\266\022\010\377\271"
-  "%\000\377\274\067\000\377\300D\000\377\301H\000\377\302I\000\377\301I\000\377\301I\000\377"
-  "\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000"
-  "\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301I\000\377\301"
-  "I\000\377\301I\000\377\302I\000\377\302I\000\377\301G\000\377\276>\000\377\272/\000\377"
-  "\267\032\002\377\265\021\020\377\266\034\035\377\267(&\377\267+(\377\266\040\035\377"
-  "\270\063/\377\301d\\\377\321\231\216\377\341\301\263\377\354\332\312\314\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\355\332\313\"\344\310\271\377"
-  "\332\260\243\377\315\217\204\377\300bZ\377\266\040\036\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\265\000\000\377\274\066\000\377\307W\001\377\320l\000\377\325v\000\377\326x\000"
-  "\377\326w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325"
-  "w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377"
-  "\325w\000\377\326w\000\377\326x\000\377\324t\000\377\316h\000\377\304Q\001\377\272,\000"
-  "\377\264\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\263\000\000"
-  "\377\271=\070\377\305vm\377\322\235\222\377\333\263\246\377\336\273\256\377"
-  "\336\273\256\377\332\262\245\377\321\233\220\377\305tk\377\271\071\065\377"
-  "\263\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\264\000\000\377"
-  "\272/\000\377\305R\001\377\317i\000\377\324u\000\377\326x\000\377\326w\000\377\325w\000"
-  "\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325"
-  "w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\326w\000\377"
-  "\326x\000\377\325u\000\377\317k\000\377\306U\001\377\273\063\000\377\264\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\263"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\261\000\000\377\263\000\000\377\272D>\377\306yp\377\323\240\225\377\337"
-  "\274\257\377\351\322\303\377\000\000\000\377\000\000\000\377\000\000\000\377\347\320\301\377"
-  "\335\271\254\377\322\234\220\377\305sj\377\271;\067\377\263\000\000\377\261\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\264\000\000\377\272-\000\377\304Q\001"
-  "\377\316i\000\377\324u\000\377\326x\000\377\326w\000\377\325w\000\377\326x\000\377\326"
-  "w\000\377\323q\000\377\313a\000\377\301F\000\377\273\061\000\377\277A\000\377\311\\\000"
-  "\377\322o\000\377\325w\000\377\326x\000\377\325w\000\377\326w\000\377\326x\000\377\325"
-  "v\000\377\320l\000\377\306V\001\377\274\065\000\377\265\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\262\000\000\377\262\000"
-  "\000\377\271;\066\377\313\211\177\377\341\301\263\377\000\000\000\377\000\000\000\377\353"
-  "\327\307\377\342\304\266\377\336\272\254\377\335\267\252\377\335\270\253"
-  "\377\335\271\253\377\335\271\253\377\335\271\253\377\335\271\253\377\335"
-  "\271\253\377\335\271\253\377\335\271\254\377\336\272\255\377\336\272\254"
-  "\377\332\261\244\377\321\231\216\377\304pg\377\270\064\060\377\263\000\000\377"
-  "\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\271$\000\377\302"
-  "L\001\377\315e\001\377\323s\000\377\326x\000\377\326x\000\377\325w\000\377\325w\000\377"
-  "\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\326w\000\377\326x\000"
-  "\377\324u\000\377\317k\000\377\306U\001\377\274\066\000\377\265\002\000\377\263\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377"
-  "\262\000\000\377\267+(\377\302h`\377\317\224\211\377\333\264\247\377\345\312"
-  "\274\377\356\334\315\252\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\354\332\312\356\344\307\271\377\331\260\243"
-  "\377\315\216\204\377\300aZ\377\266\037\035\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\263"
-  "\000\000\377\270\064\060\377\303nf\377\320\230\215\377\334\267\251\377\347\317"
-  "\300\377\357\340\320\"\000\000\000\377\347\317\300\377\324\241\225\377\277]U\377"
-  "\264\000\000\377\262\000\000\377\265\000\000\377\274\065\000\377\306U\001\377\317j\000\377\324"
-  "u\000\377\326x\000\377\326w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377"
-  "\326x\000\377\326w\000\377\323r\000\377\313b\000\377\301G\000\377\270\037\000\377\264"
-  "\000\001\377\264\000\001\377\265\000\000\377\264\000\000\377\262\000\000\377\266\026\023\377\303"
-  "me\377\330\254\237\377\000\000\000\377\000\000\000\377\372\364\343f\000\000\000\377\000\000\000\377"
-  "\340\277\262\377\313\210~\377\271<\067\377\262\000\000\377\263\000\000\377\270\035"
-  "\000\377\300D\000\377\312_\001\377\322p\000\377\325w\000\377\326x\000\377\325w\000\377"
-  "\326w\000\377\326x\000\377\325u\000\377\317k\000\377\306U\000\377\273\063\000\377\265"
-  "\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\264\000\001\377\264\000\001\377\263\000\000\377\263\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\261\000\000\377\263\000\000\377\270\061-\377\304qh\377\321\231"
-  "\216\377\327\252\235\377\322\235\221\377\306wn\377\271;\066\377\263\000\000\377"
-  "\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\261\000\000\377\263\000\000\377\272E?\377\307{r\377\323\240\225\377\333\264\247"
-  "\377\336\274\256\377\336\273\255\377\332\260\244\377\320\230\215\377\303"
-  "nf\377\270\061-\377\263\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\264\000\000\377\272-\000\377\304Q\001"
-  "\377\316i\000\377\324u\000\377\326x\000\377\326w\000\377\325w\000\377\326x\000\377\326"
-  "w\000\377\323q\000\377\313b\001\377\301H\001\377\270#\000\377\263\000\000\377\262\000\000\377"
-  "\270\060,\377\310~t\377\335\270\252\377\000\000\000\377\000\000\000\377\371\363\342D\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\343\307\271\377\331\256\242\377\314\214\202"
-  "\377\277^W\377\266\031\030\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\266\012\000\377\276>\000\377\311\\\001\377\321o\000\377\325w\000\377"
-  "\326x\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000"
-  "\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\325"
-  "w\000\377\325w\000\377\325w\000\377\325w\000\377\325w\000\377\326w\000\377\326x\000\377"
-  "\324t\000\377\316g\000\377\303O\001\377\271)\000\377\263\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\261\000\000\377\263\000\000\377\272A<\377\306wn\377\323\237"
-  "\223\377\336\273\256\377\350\321\302\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\344\310\272\377\325\245\231\377\311\201w\377\300`X\377\272>\071\377\266"
-  "\022\020\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264"
-  "\000\000\377\264\000\000\377\264\000\000\377\267\035\000\377\303M\000\377\323r\001\377\341\213"
-  "\000\377\350\226\000\377\351\231\000\377\351\230\000\377\351\227\000\377\351\227\000"
-  "\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377"
-  "\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351"
-  "\227\000\377\351\230\000\377\351\231\000\377\347\225\000\377\336\206\000\377\317k\001"
-  "\377\300C\000\377\266\017\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000"
-  "\377\264\000\000\377\267'$\377\275QJ\377\303me\377\307}s\377\311\203y\377\311"
-  "\203y\377\307|s\377\303ld\377\274OI\377\267%!\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\263\000\000\377\266\022\000\377\300E\000\377\320l\001\377\337"
-  "\210\000\377\347\225\000\377\351\231\000\377\351\230\000\377\351\227\000\377\351\227"
-  "\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000"
-  "\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377"
-  "\351\227\000\377\351\230\000\377\351\231\000\377\350\226\000\377\340\212\000\377\322"
-  "p\001\377\302J\000\377\267\032\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\267+'"
-  "\377\274NH\377\303og\377\316\222\207\377\335\271\253\377\353\327\307\210"
-  "\000\000\000\377\351\324\304\356\333\264\247\377\314\215\202\377\302kc\377\273"
-  "JD\377\267&\"\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000"
-  "\377\266\020\000\377\300D\000\377\320k\001\377\336\207\000\377\347\225\000\377\351\231"
-  "\000\377\351\230\000\377\351\230\000\377\351\231\000\377\351\230\000\377\344\221\000"
-  "\377\330|\000\377\310[\000\377\277A\000\377\306U\000\377\325w\000\377\343\216\000\377"
-  "\350\227\000\377\351\231\000\377\351\230\000\377\351\230\000\377\351\231\000\377\350"
-  "\226\000\377\340\212\000\377\322q\001\377\302L\000\377\267\034\000\377\264\000\000\377\264"
-  "\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\263"
-  "\000\000\377\272?:\377\313\212\200\377\340\300\262\377\356\334\315\210\354\332"
-  "\312\314\340\277\261\377\321\232\217\377\311\203y\377\307}t\377\310\200w"
-  "\377\311\201w\377\311\201w\377\311\201w\377\311\201w\377\311\201w\377\311"
-  "\201w\377\311\201w\377\311\202x\377\311\202x\377\307{r\377\302jb\377\274"
-  "LF\377\266!\035\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000"
-  "\000\377\265\001\000\377\275;\000\377\315e\000\377\334\203\000\377\346\223\000\377\351"
-  "\231\000\377\351\230\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227"
-  "\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\230\000\377\351\231\000"
-  "\377\347\225\000\377\337\210\000\377\321n\001\377\301G\000\377\267\024\000\377\263\000"
-  "\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\266\033\030\377\272C=\377\301d\\\377\312\205{\377\327\252"
-  "\236\377\346\314\275\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\344\310\271\377\325\245\231\377\310\200w\377"
-  "\300_X\377\272>\071\377\266\021\017\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\266!\036\377\273GA\377\302h`\377\313\211\177\377\332\261\244\377\350\322"
-  "\303\377\357\337\317D\347\317\300\377\324\243\227\377\300`X\377\264\000\000\377"
-  "\262\000\000\377\266\012\000\377\301F\000\377\320m\001\377\337\210\000\377\347\225\000\377"
-  "\351\231\000\377\351\230\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351"
-  "\227\000\377\351\231\000\377\351\230\000\377\345\222\000\377\332\200\000\377\312`\000"
-  "\377\274\065\000\377\265\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\263\000\000"
-  "\377\266\040\035\377\304pg\377\330\255\240\377\000\000\000\377\000\000\000\377\371\363"
-  "\342D\000\000\000\377\000\000\000\377\340\276\260\377\313\210~\377\272@;\377\262\000\000"
-  "\377\263\000\000\377\272*\000\377\307X\000\377\327z\000\377\343\217\000\377\351\230\000"
-  "\377\351\231\000\377\351\230\000\377\351\230\000\377\351\231\000\377\347\226\000\377"
-  "\340\211\000\377\322p\000\377\302I\000\377\267\033\000\377\264\000\000\377\264\000\000\377"
-  "\265\002\000\377\265\001\000\377\265\001\000\377\265\000\000\377\265\001\000\377\265\002\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\266\037\034\377\274MG\377\302jb\377\305vm\377\303me\377\275RK"
-  "\377\267&\"\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\267-)\377\275UN\377\304"
-  "og\377\310~t\377\311\203y\377\311\202y\377\307{r\377\302ia\377\274KE\377"
-  "\266\036\033\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\263\000\000\377\266\020\000\377\300D\000\377\320k\001\377\336"
-  "\207\000\377\347\225\000\377\351\231\000\377\351\230\000\377\351\230\000\377\351\231"
-  "\000\377\351\230\000\377\344\221\000\377\331}\000\377\311]\000\377\273\060\000\377\263"
-  "\000\000\377\262\000\000\377\270\065\061\377\310\177v\377\335\270\253\377\000\000\000\377"
-  "\000\000\000\377\371\363\341D\000\000\000\377\000\000\000\377\343\306\270\377\324\243\227\377"
-  "\310\177u\377\277]V\377\271<\067\377\265\015\013\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\271(\000\377\306U\000\377\326x\000\377\343"
-  "\216\000\377\350\227\000\377\351\231\000\377\351\230\000\377\351\227\000\377\351\227"
-  "\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000"
-  "\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377"
-  "\351\227\000\377\351\227\000\377\351\227\000\377\351\227\000\377\351\230\000\377\351"
-  "\231\000\377\346\224\000\377\335\205\000\377\316h\001\377\277@\000\377\266\011\000\377"
-  "\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\267)&\377\274"
-  "MG\377\303nf\377\315\220\205\377\334\265\250\377\352\325\305\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\336\273\255\377\313\210~\377\274MG\377\266\031\030\377\265"
-  "\007\007\377\266\027\010\377\271%\000\377\274\064\000\377\276>\000\377\277A\000\377\277"
-  "A\000\377\277A\000\377\276>\000\377\276=\000\377\302I\000\377\315f\000\377\336\206\000"
-  "\377\354\235\000\377\363\250\000\377\365\252\000\377\365\251\000\377\364\251\000\377"
-  "\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364"
-  "\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251"
-  "\000\377\364\251\000\377\365\252\000\377\365\252\000\377\362\246\000\377\351\231\000"
-  "\377\332\177\000\377\312_\000\377\300E\000\377\276=\000\377\276?\000\377\275;\000\377"
-  "\273/\000\377\270\036\000\377\266\025\017\377\266\"\040\377\270\060-\377\271\071\064"
-  "\377\271<\067\377\271<\067\377\271\070\064\377\270\060,\377\266!\037\377\266\025"
-  "\016\377\270\037\000\377\273\060\000\377\276<\000\377\276?\000\377\276=\000\377\301F\000"
-  "\377\313a\000\377\333\201\000\377\352\232\000\377\363\247\000\377\365\252\000\377\365"
-  "\252\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251"
-  "\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000"
-  "\377\364\251\000\377\364\251\000\377\364\251\000\377\365\252\000\377\365\252\000\377"
-  "\363\250\000\377\353\234\000\377\335\204\000\377\314d\000\377\301H\000\377\276=\000\377"
-  "\276?\000\377\276=\000\377\273\061\000\377\270!\000\377\267\027\000\377\270$\000\377\274"
-  "\064\000\377\276>\000\377\277A\000\377\277B\000\377\277A\000\377\277A\000\377\277A\000\377"
-  "\277A\000\377\277A\000\377\277B\000\377\277@\000\377\275:\000\377\272-\000\377\267\035"
-  "\001\377\266\022\014\377\265\005\007\377\270\061.\377\302ia\377\325\245\231\377\347"
-  "\317\300\377\000\000\000\377\345\313\274\377\322\236\222\377\300aZ\377\267+(\377"
-  "\265\003\005\377\266\024\014\377\270\037\000\377\273/\000\377\275;\000\377\276?\000\377"
-  "\276=\000\377\300E\000\377\312_\000\377\332\200\000\377\352\231\000\377\363\247\000\377"
-  "\365\252\000\377\365\252\000\377\364\251\000\377\365\252\000\377\365\252\000\377\357"
-  "\242\000\377\341\213\000\377\315f\000\377\302I\000\377\312_\000\377\335\205\000\377\355"
-  "\237\000\377\364\251\000\377\365\253\000\377\364\251\000\377\365\252\000\377\365\252"
-  "\000\377\363\250\000\377\354\235\000\377\335\205\000\377\315e\000\377\301I\000\377\276"
-  "=\000\377\276>\000\377\276=\000\377\273\063\000\377\270\"\000\377\266\015\000\377\264\000"
-  "\000\377\264\000\000\377\272@;\377\311\204z\377\334\266\251\377\347\317\300\377"
-  "\344\310\271\377\325\244\230\377\303og\377\272@;\377\270/+\377\271\067\063"
-  "\377\271:\066\377\271:\066\377\271:\066\377\271:\066\377\271:\066\377\271:\066"
-  "\377\271:\066\377\271;\066\377\271;\066\377\271\070\063\377\267.+\377\266\040\036"
-  "\377\266\025\014\377\270\040\000\377\273\061\000\377\276=\000\377\277A\000\377\277B\000"
-  "\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277@\000\377\276<\000\377\277"
-  "B\000\377\310Z\000\377\327z\000\377\347\225\000\377\361\245\000\377\365\252\000\377\365"
-  "\252\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251"
-  "\000\377\364\251\000\377\364\251\000\377\365\252\000\377\365\253\000\377\363\247\000"
-  "\377\351\230\000\377\327z\000\377\304P\000\377\271&\000\377\270\"\000\377\274\066\000"
-  "\377\277?\000\377\277B\000\377\277A\000\377\276=\000\377\273\063\000\377\270#\000\377"
-  "\266\026\012\377\265\005\005\377\266\040\036\377\275UN\377\315\217\204\377\341\300"
-  "\263\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\356\335\316\210\336\272\255\377\312\207}\377\274MG\377\266\031\027\377"
-  "\265\007\007\377\266\027\010\377\271%\000\377\274\064\000\377\276>\000\377\277A\000\377"
-  "\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000"
-  "\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277"
-  "A\000\377\276<\000\377\273\061\000\377\270\040\000\377\266\025\014\377\265\003\005\377\267"
-  "&#\377\277[T\377\320\230\215\377\344\307\271\377\356\335\315\210\347\320"
-  "\301\377\325\245\231\377\300b[\377\265\006\016\377\262\000\000\377\267\023\000\377"
-  "\304O\000\377\327z\000\377\351\230\000\377\363\247\000\377\365\253\000\377\365\252"
-  "\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\365\252\000"
-  "\377\365\252\000\377\361\244\000\377\345\223\000\377\325v\000\377\305T\000\377\274"
-  "\066\000\377\270!\000\377\266\024\000\377\264\000\000\377\263\000\000\377\267(%\377\304r"
-  "i\377\331\256\242\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\333"
-  "\263\246\377\310\201w\377\272@;\377\263\000\000\377\263\000\000\377\273\060\000\377"
-  "\313b\000\377\337\210\000\377\356\240\000\377\364\251\000\377\365\253\000\377\364\251"
-  "\000\377\365\252\000\377\365\252\000\377\363\247\000\377\353\234\000\377\335\204\000"
-  "\377\314d\000\377\301H\000\377\276=\000\377\276?\000\377\276<\000\377\273\061\000\377"
-  "\270!\000\377\267\027\000\377\270$\000\377\274\064\000\377\276>\000\377\277A\000\377\277"
-  "A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377"
-  "\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000\377\277A\000"
-  "\377\276=\000\377\273\061\000\377\270!\000\377\266\025\014\377\266\040\036\377\267."
-  "+\377\270\065\061\377\270\060-\377\266\"\040\377\266\026\016\377\270\037\000\377\273"
-  "\060\000\377\276<\000\377\277A\000\377\277B\000\377\277@\000\377\275:\000\377\272-\000\377"
-  "\267\035\001\377\266\027\021\377\267$\"\377\270\062.\377\271\071\064\377\271<\067"
-  "\377\271;\066\377\271\070\063\377\270.+\377\266\040\035\377\266\026\014\377\270"
-  "!\000\377\273\062\000\377\276=\000\377\277A\000\377\277A\000\377\277A\000\377\277?\000\377"
-  "\276<\000\377\300E\000\377\312_\000\377\332\200\000\377\352\231\000\377\363\247\000\377"
-  "\365\252\000\377\365\252\000\377\364\251\000\377\365\252\000\377\365\252\000\377\357"
-  "\242\000\377\341\214\000\377\316h\000\377\274\070\000\377\263\000\000\377\262\000\000\377"
-  "\271:\066\377\311\202x\377\335\271\254\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\350\320\301f\330\255\241\377\307}s\377\273HB\377\266\031\031\377\265"
-  "\013\013\377\266\026\007\377\271%\000\377\274\065\000\377\276>\000\377\276>\000\377\276"
-  ">\000\377\303N\000\377\320m\000\377\341\214\000\377\356\240\000\377\364\251\000\377\365"
-  "\252\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251"
-  "\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000"
-  "\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377\364\251\000\377"
-  "\364\251\000\377\364\251\000\377\365\252\000\377\365\252\000\377\362\246\000\377\350"
-  "\227\000\377\331}\000\377\311]\000\377\300D\000\377\276=\000\377\276?\000\377\275;\000"
-  "\377\272.\000\377\267\035\001\377\266\023\015\377\265\012\014\377\270/,\377\300aZ"
-  "\377\320\226\213\377\341\300\263\377\355\333\313\252\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\334"
-  "\266\251\377\307|r\377\270.*\377\262\000\000\377\263\000\000\377\270\"\000\377\300"
-  "E\001\377\311]\001\377\320l\000\377\322q\000\377\323r\000\377\322q\000\377\322p\000\377"
-  "\321o\000\377\324t\000\377\334\203\000\377\350\226\000\377\362\246\000\377\367\256"
-  "\000\377\371\257\000\377\370\257\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\257\000\377\371\257\000\377\367\254\000\377\360\243\000\377\345\222\000\377\332\177"
-  "\000\377\323s\000\377\322p\000\377\322o\000\377\316g\000\377\305T\001\377\274\065\000\377"
-  "\265\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\263\000\000\377\263\000\000\377\265\004\000\377\274\067\000\377\306U\001\377"
-  "\316h\000\377\322p\000\377\322p\000\377\323s\000\377\332\177\000\377\346\223\000\377"
-  "\360\243\000\377\367\255\000\377\371\257\000\377\370\257\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\257\000\377\371\257\000\377\367\255\000\377\361\245\000\377"
-  "\347\225\000\377\333\202\000\377\324t\000\377\322p\000\377\322p\000\377\317j\000\377"
-  "\306V\000\377\275:\000\377\271)\000\377\277A\000\377\311\\\000\377\321m\000\377\323s"
-  "\000\377\323s\000\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377"
-  "\323r\000\377\322p\000\377\315f\000\377\305S\001\377\274\066\000\377\266\004\000\377\262"
-  "\000\000\377\264\000\000\377\276WP\377\323\237\223\377\347\316\277\377\000\000\000\377"
-  "\344\311\273\377\320\227\214\377\274LF\377\263\000\000\377\262\000\000\377\266\021"
-  "\000\377\275:\000\377\306V\001\377\316h\000\377\322p\000\377\322p\000\377\323s\000\377"
-  "\332\177\000\377\345\222\000\377\360\243\000\377\367\255\000\377\371\257\000\377\370"
-  "\257\000\377\370\256\000\377\371\260\000\377\370\257\000\377\363\247\000\377\343\217"
-  "\000\377\317j\000\377\302L\000\377\313b\000\377\340\211\000\377\361\244\000\377\370\256"
-  "\000\377\371\260\000\377\370\257\000\377\370\257\000\377\371\257\000\377\367\255\000"
-  "\377\362\245\000\377\347\226\000\377\334\202\000\377\324t\000\377\322p\000\377\322"
-  "p\000\377\317j\000\377\310Z\000\377\277@\000\377\267\035\000\377\264\000\000\377\264\000\000"
-  "\377\270\065\060\377\303og\377\321\232\217\377\331\257\243\377\326\247\233"
-  "\377\312\205{\377\274LF\377\264\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\266\011\000\377"
-  "\275;\000\377\307Y\001\377\320k\000\377\323r\000\377\323s\000\377\323q\000\377\322q\000"
-  "\377\322q\000\377\322q\000\377\322p\000\377\321o\000\377\322q\000\377\330|\000\377\343"
-  "\217\000\377\356\240\000\377\366\253\000\377\370\257\000\377\370\257\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\257\000\377\371\260\000\377\366\254\000\377\354\235\000\377"
-  "\331~\000\377\305T\000\377\275\070\000\377\302I\000\377\313b\000\377\321o\000\377\323"
-  "s\000\377\323r\000\377\317k\000\377\310[\001\377\277A\000\377\270\035\000\377\263\000\000"
-  "\377\262\000\000\377\271:\065\377\312\206|\377\337\276\260\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\356\336\316f\334\267"
-  "\252\377\307|s\377\267-)\377\262\000\000\377\263\000\000\377\270#\000\377\300E\001\377"
-  "\311^\001\377\320l\000\377\322q\000\377\323r\000\377\322q\000\377\322q\000\377\322q\000"
-  "\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377\322"
-  "q\000\377\322q\000\377\323r\000\377\322q\000\377\317i\000\377\307X\001\377\276=\000\377"
-  "\267\027\000\377\263\000\000\377\263\000\000\377\272C>\377\315\217\205\377\342\304\266"
-  "\377\355\334\314\252\347\320\301\377\325\245\231\377\300c[\377\265\005\016\377"
-  "\262\000\000\377\267\025\000\377\305R\000\377\331~\000\377\354\235\000\377\366\254\000\377"
-  "\371\260\000\377\370\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\371\257\000\377\370\257\000\377\365\253\000\377\355\237\000\377\342\215"
-  "\000\377\325w\000\377\313a\000\377\301G\000\377\271*\000\377\265\000\000\377\263\000\000\377"
-  "\267(%\377\304sj\377\331\257\242\377\000\000\000\377\000\000\000\377\000\000\000\377\347\316"
-  "\277\252\334\267\252\377\320\227\214\377\303lc\377\270\064\060\377\262\000\000"
-  "\377\262\000\000\377\272-\000\377\314d\000\377\341\214\000\377\361\245\000\377\370\256"
-  "\000\377\371\260\000\377\370\257\000\377\370\257\000\377\371\257\000\377\367\255\000"
-  "\377\361\245\000\377\347\225\000\377\333\201\000\377\324t\000\377\322p\000\377\322"
-  "p\000\377\317j\000\377\307X\000\377\276=\000\377\272.\000\377\277B\000\377\311\\\000\377"
-  "\320l\000\377\322q\000\377\323r\000\377\322q\000\377\322q\000\377\322q\000\377\322q\000"
-  "\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377\322q\000\377\322"
-  "q\000\377\323r\000\377\322q\000\377\317j\000\377\307X\001\377\275;\000\377\266\012\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\266\022\000\377"
-  "\275:\000\377\306V\001\377\316h\000\377\322q\000\377\323s\000\377\322p\000\377\315f\000"
-  "\377\305S\001\377\274\065\000\377\266\014\000\377\264\000\000\377\264\000\000\377\264\000\000"
-  "\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\267\032\000"
-  "\377\276?\000\377\310Y\001\377\317j\000\377\322q\000\377\323r\000\377\322q\000\377\322"
-  "p\000\377\321o\000\377\323r\000\377\332\177\000\377\345\222\000\377\360\243\000\377\367"
-  "\255\000\377\371\257\000\377\370\257\000\377\370\256\000\377\371\260\000\377\370\257"
-  "\000\377\363\247\000\377\344\221\000\377\320k\000\377\275:\000\377\263\000\000\377\262"
-  "\000\000\377\271;\066\377\311\203y\377\336\274\256\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\345\311\273\377\332\260\243\377\314\214\202\377\277[T\377\265\022\023"
-  "\377\262\000\000\377\263\000\000\377\267\035\000\377\300D\001\377\311^\001\377\320l\000\377"
-  "\322p\000\377\322p\000\377\325v\000\377\336\207\000\377\352\232\000\377\364\250\000\377"
-  "\370\256\000\377\371\257\000\377\370\257\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\371\257\000\377"
-  "\366\254\000\377\357\242\000\377\344\220\000\377\331}\000\377\323r\000\377\322p\000\377"
-  "\321o\000\377\315g\000\377\305R\001\377\273\063\000\377\265\000\000\377\262\000\000\377\263"
-  "\000\000\377\271<\070\377\305um\377\323\240\224\377\337\275\260\377\351\322\303"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\334\266\251\377\307}s\377\270\060-\377\262\000\000\377\263\000\000\377\273"
-  "\060\000\377\310[\000\377\330{\000\377\342\216\000\377\346\224\000\377\347\225\000\377"
-  "\346\224\000\377\346\223\000\377\346\223\000\377\347\225\000\377\352\232\000\377\360"
-  "\242\000\377\365\252\000\377\367\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\364"
-  "\250\000\377\356\241\000\377\351\231\000\377\347\224\000\377\347\224\000\377\345\223"
-  "\000\377\337\210\000\377\322p\001\377\303L\000\377\267\032\000\377\263\000\000\377\263\000"
-  "\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\263\000"
-  "\000\377\270\036\000\377\303N\000\377\323r\001\377\340\211\000\377\346\223\000\377\347"
-  "\224\000\377\347\225\000\377\352\231\000\377\357\241\000\377\364\251\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\365\251\000\377\357\242\000\377\352\232"
-  "\000\377\347\225\000\377\347\224\000\377\346\223\000\377\341\213\000\377\324t\000\377"
-  "\305R\000\377\276=\000\377\307X\000\377\326y\000\377\342\215\000\377\347\225\000\377"
-  "\347\225\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346"
-  "\224\000\377\347\225\000\377\345\222\000\377\336\206\000\377\321m\001\377\301H\000\377"
-  "\267\023\000\377\262\000\000\377\264\000\000\377\276XQ\377\323\236\223\377\346\315\276"
-  "\377\000\000\000\377\344\310\272\377\320\227\213\377\274MG\377\263\000\000\377\262"
-  "\000\000\377\270\036\000\377\303N\000\377\323q\001\377\337\211\000\377\345\223\000\377\347"
-  "\224\000\377\347\224\000\377\351\231\000\377\357\241\000\377\364\250\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\371\257\000\377\370\257\000"
-  "\377\363\247\000\377\343\217\000\377\317i\000\377\302K\000\377\313b\000\377\337\211"
-  "\000\377\361\244\000\377\370\256\000\377\371\260\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\367\256\000\377\365\252\000\377\360\242\000\377\352\232\000\377"
-  "\347\225\000\377\346\224\000\377\346\223\000\377\341\213\000\377\325w\000\377\306U"
-  "\000\377\271)\000\377\264\000\000\377\264\000\000\377\267$\040\377\274OI\377\303og\377"
-  "\310~u\377\306xo\377\277^W\377\270\062.\377\264\000\000\377\263\000\000\377\263\000"
-  "\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000"
-  "\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000"
-  "\000\377\270\"\000\377\305R\000\377\324u\001\377\341\213\000\377\346\224\000\377\347"
-  "\225\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346\223"
-  "\000\377\346\223\000\377\346\224\000\377\351\230\000\377\356\237\000\377\363\247\000"
-  "\377\367\255\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\257\000\377\371\260\000\377\366\254\000\377\354\234\000\377\331}\000\377\306T\000\377"
-  "\301F\000\377\314c\000\377\333\201\000\377\344\221\000\377\350\226\000\377\347\225"
-  "\000\377\341\214\000\377\326x\001\377\306W\000\377\272*\000\377\263\000\000\377\262\000\000"
-  "\377\271<\067\377\312\206|\377\337\275\257\377\360\340\320\"\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\356\335\315\210\334\266\251"
-  "\377\307|s\377\270/,\377\262\000\000\377\263\000\000\377\273\061\000\377\311\\\000\377"
-  "\330{\000\377\342\216\000\377\346\224\000\377\347\225\000\377\346\224\000\377\346\224"
-  "\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346\224\000"
-  "\377\346\224\000\377\346\224\000\377\346\224\000\377\346\224\000\377\347\225\000\377"
-  "\346\223\000\377\340\212\000\377\324t\001\377\305R\000\377\271$\000\377\262\000\000\377"
-  "\262\000\000\377\273E@\377\315\220\205\377\342\304\266\377\355\334\314\252\347"
-  "\320\301\377\325\245\231\377\300c[\377\265\005\016\377\262\000\000\377\267\025\000"
-  "\377\305R\000\377\331~\000\377\354\234\000\377\366\254\000\377\371\260\000\377\370"
-  "\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\366\254\000\377\363\247\000\377\356\237\000\377\346\223\000"
-  "\377\332\177\000\377\313b\000\377\275:\000\377\265\000\000\377\262\000\000\377\267'%\377"
-  "\304sj\377\332\260\243\377\000\000\000\377\000\000\000\377\347\316\277\252\330\255\240"
-  "\377\313\212\177\377\302jb\377\273IC\377\267#\040\377\263\000\000\377\263\000\000"
-  "\377\273\061\000\377\314e\000\377\341\214\000\377\361\245\000\377\370\256\000\377\371"
-  "\260\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\364\251"
-  "\000\377\357\242\000\377\352\232\000\377\347\225\000\377\346\224\000\377\346\223\000"
-  "\377\341\213\000\377\324s\000\377\305R\000\377\276?\000\377\307Y\000\377\326y\000\377"
-  "\342\215\000\377\346\224\000\377\347\225\000\377\346\224\000\377\346\224\000\377\346"
-  "\224\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346\224\000\377\346\224"
-  "\000\377\346\224\000\377\346\224\000\377\346\224\000\377\347\225\000\377\346\223\000"
-  "\377\341\213\000\377\324u\001\377\305S\000\377\270#\000\377\263\000\000\377\263\000\000\377"
-  "\264\000\000\377\263\000\000\377\263\000\000\377\270\037\000\377\303N\000\377\323r\001\377\340"
-  "\211\000\377\346\223\000\377\350\226\000\377\345\222\000\377\336\206\000\377\321m\001"
-  "\377\301H\000\377\267\027\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000"
-  "\377\264\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\271'\000\377\305T\000\377"
-  "\325v\001\377\341\213\000\377\346\224\000\377\347\225\000\377\346\224\000\377\346\223"
-  "\000\377\346\223\000\377\346\224\000\377\351\231\000\377\357\241\000\377\364\251\000"
-  "\377\367\255\000\377\370\256\000\377\370\256\000\377\370\256\000\377\371\257\000\377"
-  "\370\257\000\377\363\247\000\377\344\220\000\377\317k\000\377\275\071\000\377\263\000"
-  "\000\377\262\000\000\377\271;\066\377\311\203z\377\336\274\256\377\000\000\000\377\000\000"
-  "\000\377\344\310\271\377\325\244\230\377\311\202x\377\300`Y\377\271<\067\377"
-  "\265\000\002\377\262\000\000\377\264\000\000\377\273\062\000\377\311]\001\377\330|\000\377\343"
-  "\216\000\377\346\224\000\377\346\224\000\377\347\226\000\377\353\234\000\377\361\244"
-  "\000\377\366\253\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\363\250\000\377\356\240\000\377\351\230\000"
-  "\377\347\224\000\377\347\224\000\377\345\222\000\377\336\207\000\377\321n\001\377\302"
-  "I\000\377\267\025\000\377\263\000\000\377\263\000\000\377\267&\"\377\274OH\377\304qi\377"
-  "\316\222\207\377\333\265\250\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377"
-  "\271\070\063\377\262\000\000\377\264\000\000\377\275\071\000\377\316h\000\377\341\214\000"
-  "\377\357\241\000\377\364\250\000\377\364\251\000\377\363\247\000\377\363\247\000\377"
-  "\363\247\000\377\363\250\000\377\364\251\000\377\365\252\000\377\366\254\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\364"
-  "\250\000\377\363\250\000\377\364\251\000\377\363\247\000\377\354\234\000\377\335\205"
-  "\000\377\314d\000\377\277A\000\377\271%\000\377\266\025\000\377\266\011\000\377\265\000\000"
-  "\377\265\000\000\377\266\012\000\377\267\026\000\377\271&\000\377\300C\000\377\315f\000\377"
-  "\336\207\000\377\354\235\000\377\363\247\000\377\364\251\000\377\363\250\000\377\364"
-  "\251\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\254\000\377\365\252\000\377\364\251\000\377\363\250\000\377\364\251"
-  "\000\377\363\247\000\377\355\237\000\377\337\210\000\377\317j\000\377\307W\000\377\316"
-  "i\000\377\336\206\000\377\352\232\000\377\360\242\000\377\362\245\000\377\363\247\000"
-  "\377\363\247\000\377\363\250\000\377\363\247\000\377\364\250\000\377\364\251\000\377"
-  "\362\246\000\377\351\231\000\377\330}\000\377\305S\000\377\270\034\000\377\262\000\000\377"
-  "\264\000\000\377\276WP\377\320\230\215\377\342\303\265\377\351\323\303\377\340"
-  "\277\262\377\316\221\206\377\274NG\377\263\000\000\377\262\000\000\377\271&\000\377"
-  "\307Y\000\377\333\201\000\377\353\233\000\377\363\247\000\377\364\251\000\377\363\250"
-  "\000\377\364\250\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377"
-  "\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\254\000\377\365\252\000\377\364\251\000\377\363\250\000\377\364\251"
-  "\000\377\363\247\000\377\355\236\000\377\336\207\000\377\313a\000\377\273\060\000\377"
-  "\264\000\000\377\264\000\000\377\265\015\013\377\267%!\377\271\066\062\377\272?:\377"
-  "\271<\067\377\267.+\377\266\033\027\377\267\031\002\377\271&\000\377\273\063\000\377"
-  "\275\070\000\377\275:\000\377\275\071\000\377\275\071\000\377\275\071\000\377\275\071\000"
-  "\377\275\071\000\377\275\071\000\377\275\071\000\377\275\071\000\377\274\066\000\377\274"
-  "\066\000\377\301F\000\377\314e\000\377\334\202\000\377\350\227\000\377\357\241\000\377"
-  "\362\245\000\377\362\246\000\377\363\247\000\377\363\250\000\377\363\247\000\377\363"
-  "\247\000\377\363\247\000\377\363\247\000\377\364\250\000\377\365\252\000\377\366\253"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\257\000\377\365\253\000\377\353\233\000\377\330{\000\377\306U"
-  "\000\377\304O\000\377\323r\000\377\346\223\000\377\361\244\000\377\365\252\000\377\364"
-  "\251\000\377\355\237\000\377\337\210\000\377\314c\000\377\273\062\000\377\263\000\000\377"
-  "\263\000\000\377\272>\071\377\310\201w\377\333\264\247\377\353\327\307\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\323\304\377"
-  "\331\256\241\377\306xo\377\270\063\060\377\262\000\000\377\264\000\000\377\275:\000\377"
-  "\316i\000\377\341\214\000\377\357\241\000\377\364\250\000\377\364\251\000\377\363\247"
-  "\000\377\363\247\000\377\363\247\000\377\363\247\000\377\363\247\000\377\363\247\000"
-  "\377\363\247\000\377\363\247\000\377\363\247\000\377\363\247\000\377\363\250\000\377"
-  "\364\251\000\377\363\247\000\377\354\235\000\377\335\204\000\377\311^\000\377\272,"
-  "\000\377\262\000\000\377\263\000\000\377\273KE\377\316\222\207\377\342\305\267\377"
-  "\355\334\314\252\347\320\301\377\325\245\231\377\300c[\377\265\005\016\377\262"
-  "\000\000\377\267\025\000\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370"
-  "\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\365\253\000"
-  "\377\361\244\000\377\344\221\000\377\322p\000\377\300C\000\377\265\000\000\377\262\000"
-  "\000\377\267&%\377\305sk\377\332\261\244\377\000\000\000\377\000\000\000\377\340\300\262"
-  "\377\315\216\203\377\275UO\377\267(%\377\266\025\023\377\266\026\013\377\267"
-  "\025\000\377\271)\000\377\301I\000\377\321o\000\377\343\217\000\377\361\245\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\366\254\000\377\365\252\000\377\364\251\000\377\363\250\000\377\364\251\000"
-  "\377\363\247\000\377\354\235\000\377\334\203\000\377\312^\000\377\301H\000\377\315"
-  "e\000\377\340\211\000\377\356\240\000\377\364\250\000\377\364\251\000\377\363\247\000"
-  "\377\363\247\000\377\363\247\000\377\363\247\000\377\363\247\000\377\363\247\000\377"
-  "\363\247\000\377\363\247\000\377\363\247\000\377\363\247\000\377\363\250\000\377\364"
-  "\251\000\377\363\247\000\377\355\237\000\377\340\212\000\377\317j\000\377\301H\000\377"
-  "\274\066\000\377\274\065\000\377\274\067\000\377\272*\000\377\267\030\000\377\272,\000\377"
-  "\310Z\000\377\333\201\000\377\353\233\000\377\363\247\000\377\365\253\000\377\362\246"
-  "\000\377\351\231\000\377\330|\000\377\305S\000\377\270\037\000\377\263\000\000\377\264\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000"
-  "\000\377\272.\000\377\312`\000\377\336\206\000\377\355\236\000\377\363\247\000\377\364"
-  "\251\000\377\363\250\000\377\363\247\000\377\363\247\000\377\363\250\000\377\364\250"
-  "\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\217\000\377"
-  "\317k\000\377\275\071\000\377\263\000\000\377\262\000\000\377\271\067\063\377\307}t\377"
-  "\333\263\246\377\350\320\301f\347\316\277\252\331\256\242\377\307|r\377\273"
-  "IC\377\266\"\040\377\266\026\024\377\266\025\006\377\267\030\000\377\273/\000\377\304"
-  "P\000\377\324t\000\377\344\221\000\377\360\242\000\377\364\250\000\377\364\250\000\377"
-  "\363\250\000\377\364\251\000\377\365\253\000\377\367\254\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366"
-  "\254\000\377\365\252\000\377\364\250\000\377\363\250\000\377\364\251\000\377\362\246"
-  "\000\377\353\233\000\377\334\203\000\377\313b\000\377\276?\000\377\270\"\000\377\266"
-  "\024\000\377\266\027\020\377\266\030\027\377\270\064\060\377\300`Y\377\317\224\211"
-  "\377\340\277\261\377\355\333\313\252\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377\271\070\063\377\262\000\000\377"
-  "\264\000\000\377\275;\000\377\320m\000\377\345\221\000\377\363\247\000\377\370\257\000"
-  "\377\371\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\371"
-  "\257\000\377\367\255\000\377\362\246\000\377\347\226\000\377\332\200\000\377\316h\000"
-  "\377\304P\000\377\274\064\000\377\266\016\000\377\263\000\000\377\264\000\000\377\267\032"
-  "\000\377\275\071\000\377\305S\000\377\317j\000\377\333\201\000\377\350\227\000\377\362"
-  "\246\000\377\367\256\000\377\371\257\000\377\370\256\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\256\000"
-  "\377\363\250\000\377\351\230\000\377\334\203\000\377\324u\000\377\326w\000\377\334"
-  "\203\000\377\343\217\000\377\352\232\000\377\361\244\000\377\365\253\000\377\370\256"
-  "\000\377\370\257\000\377\370\256\000\377\370\257\000\377\371\260\000\377\367\254\000"
-  "\377\355\236\000\377\333\201\000\377\306T\000\377\267\027\000\377\261\000\000\377\264"
-  "\000\000\377\273JD\377\311\203y\377\327\251\235\377\334\266\251\377\325\245\231"
-  "\377\307}s\377\272B=\377\264\000\000\377\263\000\000\377\271(\000\377\311]\000\377\336"
-  "\206\000\377\357\241\000\377\367\255\000\377\371\260\000\377\370\256\000\377\370\256"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377"
-  "\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\371\260\000\377\370\256"
-  "\000\377\361\245\000\377\342\214\000\377\315e\000\377\273\063\000\377\264\000\001\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264"
-  "\000\000\377\266\011\000\377\273\061\000\377\303M\001\377\312`\000\377\317i\000\377\320k"
-  "\000\377\317k\000\377\317j\000\377\317j\000\377\317j\000\377\317j\000\377\317j\000\377"
-  "\317j\000\377\317j\000\377\317j\000\377\317j\000\377\321m\000\377\325v\000\377\333\202"
-  "\000\377\342\215\000\377\351\230\000\377\357\242\000\377\365\252\000\377\367\256\000"
-  "\377\370\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\253\000"
-  "\377\353\233\000\377\327z\000\377\305S\000\377\304P\000\377\326w\000\377\352\232\000"
-  "\377\366\254\000\377\372\262\000\377\371\260\000\377\362\245\000\377\342\215\000\377"
-  "\315e\000\377\273\060\000\377\262\000\000\377\262\000\000\377\270\064\060\377\303ne\377"
-  "\321\233\220\377\336\273\256\377\350\321\302\377\357\340\320\"\000\000\000\377"
-  "\000\000\000\377\356\336\316f\347\316\277\377\335\270\252\377\317\225\212\377\301"
-  "f^\377\267*(\377\262\000\000\377\263\000\000\377\275\070\000\377\320l\000\377\345\221"
-  "\000\377\363\247\000\377\370\257\000\377\371\257\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\371\260\000\377\370"
-  "\257\000\377\361\244\000\377\340\213\000\377\313b\000\377\272.\000\377\262\000\000\377"
-  "\263\000\000\377\273KE\377\316\222\207\377\342\305\267\377\355\334\314\252\347"
-  "\320\301\377\325\245\231\377\300c[\377\265\005\016\377\262\000\000\377\267\025\000"
-  "\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\364\251\000"
-  "\377\350\227\000\377\324u\000\377\300F\000\377\265\000\000\377\262\000\000\377\267'%\377"
-  "\305tl\377\332\262\245\377\000\000\000\377\000\000\000\377\336\274\256\377\311\201w\377"
-  "\270\063.\377\262\000\000\377\263\000\000\377\270\037\000\377\276=\000\377\306V\001\377\320"
-  "m\000\377\335\204\000\377\351\231\000\377\363\247\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\371\260\000\377\370\257\000\377\361"
-  "\245\000\377\340\211\000\377\313a\000\377\301I\000\377\316h\000\377\343\216\000\377\363"
-  "\247\000\377\370\257\000\377\371\257\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\256\000\377"
-  "\363\250\000\377\351\230\000\377\334\203\000\377\322q\000\377\317j\000\377\317j\000\377"
-  "\315f\000\377\306V\000\377\276<\000\377\274\064\000\377\311\\\000\377\336\206\000\377"
-  "\360\242\000\377\370\257\000\377\372\262\000\377\367\255\000\377\355\236\000\377\333"
-  "\201\000\377\305T\000\377\267\031\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\273\061\000\377\314"
-  "d\000\377\341\213\000\377\361\244\000\377\370\256\000\377\371\260\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\217\000\377\317k\000\377\275\071\000"
-  "\377\264\000\000\377\263\000\000\377\270.+\377\303ld\377\321\233\220\377\333\264"
-  "\247\377\331\260\243\377\315\220\205\377\276YS\377\265\006\013\377\262\000\000\377"
-  "\264\000\000\377\270\040\000\377\277A\001\377\310[\000\377\323r\000\377\340\212\000\377"
-  "\354\236\000\377\365\252\000\377\370\257\000\377\370\257\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256"
-  "\000\377\370\256\000\377\370\256\000\377\371\257\000\377\367\255\000\377\361\245\000"
-  "\377\347\224\000\377\331~\000\377\315g\000\377\303N\001\377\273\062\000\377\265\004\000"
-  "\377\262\000\000\377\263\000\000\377\271\067\063\377\305sk\377\323\240\224\377\340"
-  "\277\261\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\335\267\252\377\310\177u\377\271\070\063\377\262\000\000\377\264\000\000\377\275"
-  ";\000\377\320m\000\377\345\221\000\377\363\247\000\377\370\257\000\377\371\260\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\256"
-  "\000\377\365\252\000\377\360\243\000\377\351\230\000\377\337\210\000\377\322p\000\377"
-  "\303M\000\377\270\040\000\377\263\000\000\377\263\000\000\377\271'\000\377\305Q\000\377\323"
-  "r\000\377\340\211\000\377\351\230\000\377\360\243\000\377\365\252\000\377\370\256\000"
-  "\377\370\257\000\377\370\256\000\377\370\256\000\377\367\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\257\000\377\370\256\000\377\365\253\000\377\360"
-  "\244\000\377\352\232\000\377\343\217\000\377\334\203\000\377\326x\000\377\325v\000\377"
-  "\335\204\000\377\351\230\000\377\363\250\000\377\370\256\000\377\371\257\000\377\370"
-  "\256\000\377\370\257\000\377\371\260\000\377\367\255\000\377\355\237\000\377\333\201"
-  "\000\377\306U\000\377\267\032\000\377\262\000\000\377\264\000\000\377\270\065\061\377\300"
-  "aY\377\307}t\377\313\207}\377\307{q\377\277\\U\377\270/+\377\264\000\000\377"
-  "\263\000\000\377\271(\000\377\311]\000\377\336\206\000\377\357\241\000\377\367\255\000"
-  "\377\371\260\000\377\370\257\000\377\370\256\000\377\367\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367"
-  "\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337"
-  "\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000"
-  "\377\370\256\000\377\371\260\000\377\370\256\000\377\361\245\000\377\342\214\000\377"
-  "\315f\000\377\273\063\000\377\264\000\001\377\264\000\001\377\265\000\000\377\265\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\267\023\000\377\300D\000\377"
-  "\316i\001\377\333\202\000\377\342\216\000\377\344\221\000\377\344\220\000\377\343\217"
-  "\000\377\343\217\000\377\343\217\000\377\343\217\000\377\343\217\000\377\343\217\000"
-  "\377\343\217\000\377\344\220\000\377\344\220\000\377\342\215\000\377\335\205\000\377"
-  "\327z\000\377\324u\000\377\333\200\000\377\347\225\000\377\362\246\000\377\367\256"
-  "\000\377\371\257\000\377\370\257\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\253"
-  "\000\377\353\233\000\377\327z\000\377\305S\000\377\304P\000\377\326w\000\377\352\232"
-  "\000\377\366\254\000\377\372\262\000\377\371\260\000\377\362\245\000\377\342\215\000"
-  "\377\315f\000\377\273\061\000\377\263\000\000\377\263\000\000\377\267$!\377\274NH\377"
-  "\304ph\377\315\220\205\377\332\260\243\377\347\317\300\377\000\000\000\377\357"
-  "\337\317D\345\313\274\377\330\253\237\377\314\213\201\377\303lc\377\273H"
-  "C\377\266\034\033\377\262\000\000\377\264\000\000\377\275\071\000\377\320l\000\377\345\221"
-  "\000\377\363\247\000\377\370\257\000\377\371\260\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\371\260\000\377\370"
-  "\257\000\377\361\244\000\377\340\212\000\377\313b\000\377\272.\000\377\262\000\000\377"
-  "\263\000\000\377\273KE\377\316\222\207\377\342\305\267\377\355\334\314\252\347"
-  "\320\301\377\325\245\231\377\300c[\377\265\005\016\377\262\000\000\377\267\025\000"
-  "\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\251\000"
-  "\377\350\227\000\377\324u\000\377\301F\000\377\265\000\000\377\262\000\000\377\267'%\377"
-  "\305tk\377\332\262\245\377\000\000\000\377\000\000\000\377\336\273\256\377\310\201w\377"
-  "\270\061-\377\262\000\000\377\263\000\000\377\272.\000\377\307W\001\377\325v\001\377\341"
-  "\214\000\377\352\232\000\377\360\244\000\377\365\252\000\377\367\255\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\370\256\000\377\370\257\000\377\371\260\000\377\370\257\000\377"
-  "\361\245\000\377\340\211\000\377\313a\000\377\302I\000\377\316h\000\377\343\216\000\377"
-  "\363\247\000\377\370\257\000\377\371\260\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\256\000"
-  "\377\365\253\000\377\360\243\000\377\352\231\000\377\345\222\000\377\344\220\000\377"
-  "\344\220\000\377\340\212\000\377\326w\000\377\307W\000\377\277@\000\377\311]\000\377"
-  "\336\206\000\377\360\242\000\377\370\257\000\377\372\262\000\377\367\255\000\377\355"
-  "\237\000\377\333\201\000\377\306U\000\377\267\033\000\377\263\000\000\377\264\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377"
-  "\273\061\000\377\314d\000\377\341\213\000\377\361\244\000\377\370\256\000\377\371\260"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\217\000\377\317"
-  "k\000\377\275\071\000\377\264\000\000\377\263\000\000\377\266\040\035\377\274OI\377\304"
-  "sj\377\312\206|\377\311\202x\377\302ia\377\271=\070\377\264\000\000\377\262\000"
-  "\000\377\264\000\000\377\274\065\000\377\311^\001\377\330|\000\377\344\220\000\377\354\235"
-  "\000\377\362\246\000\377\366\254\000\377\370\257\000\377\370\257\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\256\000\377\365"
-  "\252\000\377\357\242\000\377\350\227\000\377\336\207\000\377\321n\001\377\302K\000\377"
-  "\267\032\000\377\262\000\000\377\263\000\000\377\266\037\035\377\274OI\377\305tk\377\317"
-  "\224\212\377\333\264\247\377\350\321\302\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\335\267\252\377\310\177u\377\271\070\063\377\262\000\000\377\264\000\000\377"
-  "\275;\000\377\320l\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\366\254\000\377\366\253\000\377\363\247\000\377\354\235\000\377\336"
-  "\207\000\377\315f\000\377\277@\000\377\267\030\000\377\265\001\000\377\273\062\000\377\312"
-  "`\000\377\335\205\000\377\354\235\000\377\363\250\000\377\366\253\000\377\366\254\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366"
-  "\254\000\377\366\253\000\377\364\250\000\377\356\237\000\377\340\212\000\377\320l\000"
-  "\377\307Y\000\377\320l\000\377\342\215\000\377\361\244\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\256\000\377\370\256\000\377\366\253\000\377\355\237"
-  "\000\377\335\205\000\377\312`\000\377\275\070\000\377\267\027\000\377\266\015\000\377\266"
-  "\034\027\377\270\062.\377\272C>\377\273IC\377\272B<\377\270\060+\377\266\026\023"
-  "\377\264\000\000\377\263\000\000\377\271(\000\377\311\\\000\377\335\205\000\377\356\240"
-  "\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K"
-  "\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244"
-  "\000\377\341\213\000\377\314e\000\377\273\062\000\377\264\000\000\377\264\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\267"
-  "\035\000\377\304P\000\377\327z\000\377\350\226\000\377\361\244\000\377\363\247\000\377"
-  "\362\246\000\377\362\246\000\377\362\246\000\377\362\246\000\377\362\246\000\377\362"
-  "\246\000\377\362\246\000\377\362\246\000\377\363\247\000\377\362\246\000\377\357\241"
-  "\000\377\343\217\000\377\323r\000\377\310Z\000\377\315f\000\377\336\207\000\377\357\241"
-  "\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256"
-  "\000\377\365\253\000\377\354\235\000\377\332\200\000\377\312_\000\377\310Z\000\377\326"
-  "w\000\377\347\225\000\377\362\245\000\377\366\254\000\377\367\254\000\377\361\244\000"
-  "\377\344\217\000\377\321n\000\377\300E\000\377\270!\000\377\266\013\000\377\266\026\016"
-  "\377\266\036\034\377\270\063/\377\277[T\377\315\217\205\377\340\300\262\377"
-  "\355\333\314\314\354\331\311\377\336\272\254\377\313\207}\377\275TN\377\270"
-  ".+\377\266\035\032\377\266\024\012\377\266\014\000\377\271&\000\377\302K\000\377\324"
-  "s\000\377\346\223\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\366"
-  "\254\000\377\364\250\000\377\354\235\000\377\334\204\000\377\311]\000\377\272+\000\377"
-  "\262\000\000\377\263\000\000\377\273KE\377\316\222\207\377\342\305\267\377\355\334"
-  "\314\252\347\320\301\377\325\245\231\377\300c[\377\265\005\016\377\262\000\000\377"
-  "\267\025\000\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364"
-  "\250\000\377\347\226\000\377\324t\000\377\300E\000\377\265\000\000\377\262\000\000\377\267"
-  "%#\377\303og\377\327\253\237\377\347\316\300\252\351\322\303\"\334\265\250"
-  "\377\310~u\377\271\067\063\377\262\000\000\377\264\000\000\377\274\067\000\377\315f\000"
-  "\377\340\211\000\377\356\237\000\377\364\251\000\377\366\253\000\377\366\254\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\366\254"
-  "\000\377\364\251\000\377\355\236\000\377\336\206\000\377\315f\000\377\306V\000\377\322"
-  "p\000\377\344\221\000\377\362\246\000\377\367\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\363\250\000\377\362\246"
-  "\000\377\363\247\000\377\362\246\000\377\356\240\000\377\342\216\000\377\321o\000\377"
-  "\306V\000\377\314c\000\377\334\203\000\377\354\234\000\377\364\250\000\377\367\255"
-  "\000\377\365\253\000\377\355\237\000\377\335\205\000\377\312`\000\377\275\070\000\377"
-  "\267\031\000\377\266\015\000\377\265\005\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\264\000\000\377\264\000\000\377\273\060\000\377\314c\000\377\340\212\000\377\360\243\000"
-  "\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246"
-  "\000\377\343\217\000\377\317k\000\377\275\071\000\377\264\000\000\377\263\000\000\377\265"
-  "\014\013\377\267(%\377\271=\070\377\273HB\377\273FA\377\271\070\064\377\267\""
-  "\036\377\266\021\005\377\266\021\000\377\272-\000\377\304P\000\377\325u\000\377\345\222"
-  "\000\377\360\243\000\377\365\252\000\377\366\254\000\377\367\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\366\254\000\377\366\253\000\377\363\247\000\377\353\234"
-  "\000\377\335\205\000\377\314c\000\377\276>\000\377\270\035\000\377\266\015\000\377\266"
-  "\030\022\377\266\040\035\377\271\070\064\377\300b[\377\320\226\213\377\342\303"
-  "\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377"
-  "\271\070\063\377\262\000\000\377\264\000\000\377\275;\000\377\320l\000\377\344\220\000\377"
-  "\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\362\246\000\377\350\226\000\377\332\200\000\377\315f\000\377\302"
-  "J\000\377\273\060\000\377\275\070\000\377\314d\000\377\341\214\000\377\361\245\000\377"
-  "\370\256\000\377\371\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370\256\000"
-  "\377\362\246\000\377\342\215\000\377\315f\000\377\301G\000\377\313a\000\377\337\211"
-  "\000\377\361\244\000\377\370\256\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\366\254\000\377\360\243\000\377\344\221\000\377\326y\000\377\313"
-  "a\000\377\302I\000\377\273\061\000\377\266\022\000\377\264\000\000\377\264\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\271"
-  "(\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246"
-  "\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\361\244\000\377\341\213\000\377\314e\000\377\273\062"
-  "\000\377\264\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\264\000\000\377\263\000\000\377\267\030\000\377\305R\000\377\332\177\000\377\354"
-  "\235\000\377\366\254\000\377\371\257\000\377\370\256\000\377\367\256\000\377\367\256"
-  "\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\370\256\000"
-  "\377\371\257\000\377\371\257\000\377\364\251\000\377\346\224\000\377\321o\000\377\302"
-  "J\000\377\307X\000\377\333\201\000\377\355\237\000\377\366\254\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\256\000\377\366\253\000\377\357\241\000\377"
-  "\342\215\000\377\326x\000\377\322p\000\377\327z\000\377\340\211\000\377\347\225\000\377"
-  "\356\240\000\377\363\247\000\377\362\245\000\377\351\230\000\377\334\202\000\377\316"
-  "i\000\377\304Q\000\377\275\071\000\377\270\036\000\377\264\000\000\377\263\000\000\377\270"
-  "\063/\377\310\177v\377\336\272\255\377\354\332\312\356\353\327\310\377\333"
-  "\263\246\377\305ul\377\267%\"\377\262\000\000\377\264\000\000\377\270#\000\377\276"
-  "=\000\377\306U\000\377\320l\000\377\335\205\000\377\352\233\000\377\364\250\000\377\367"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\364\251\000\377\360\243\000\377\352\232\000\377\341\213\000\377"
-  "\323s\001\377\304Q\000\377\270#\000\377\262\000\000\377\262\000\000\377\273E@\377\315\220"
-  "\205\377\342\304\266\377\355\334\314\252\347\320\301\377\325\245\231\377"
-  "\300c[\377\265\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377\331}\000\377\353"
-  "\234\000\377\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\370\256\000\377\364\250\000\377\347\226\000\377\324t\000\377\300"
-  "E\000\377\265\000\000\377\262\000\000\377\266\036\036\377\300aZ\377\320\226\213\377\334"
-  "\266\250\377\335\271\254\377\323\237\223\377\303nf\377\267.+\377\262\000\000"
-  "\377\263\000\000\377\274\067\000\377\317j\000\377\344\220\000\377\362\246\000\377\370"
-  "\256\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\364\251\000\377\360\243\000\377\352\232\000\377\343\217\000\377"
-  "\333\201\000\377\323s\000\377\323r\000\377\334\203\000\377\351\231\000\377\364\250"
-  "\000\377\370\256\000\377\370\257\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256"
-  "\000\377\365\252\000\377\353\233\000\377\336\206\000\377\323s\000\377\323r\000\377\332"
-  "\177\000\377\342\216\000\377\352\231\000\377\360\243\000\377\363\247\000\377\357\242"
-  "\000\377\345\221\000\377\327y\000\377\313`\000\377\302I\000\377\273\060\000\377\266\023"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\273\061"
-  "\000\377\314d\000\377\341\213\000\377\361\244\000\377\370\256\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\362\245\000\377\343\217\000\377\317i\000\377"
-  "\274\066\000\377\264\000\000\377\263\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\270#\000\377\277@\000\377\307"
-  "Y\000\377\322q\000\377\340\212\000\377\355\236\000\377\365\252\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\255\000\377\362\246\000\377\347\225\000\377\331~\000\377\315"
-  "e\000\377\303M\000\377\274\065\000\377\267\031\000\377\263\000\000\377\263\000\000\377\272"
-  "@;\377\313\210~\377\340\277\261\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-  "\267\252\377\310\177u\377\271\070\063\377\262\000\000\377\264\000\000\377\275;\000\377"
-  "\320l\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\360\242\000\377\350"
-  "\227\000\377\336\207\000\377\321n\000\377\303M\000\377\277?\000\377\314d\000\377\341"
-  "\214\000\377\362\246\000\377\370\257\000\377\371\260\000\377\367\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\257\000\377\370\257\000\377\362\246\000\377\342\215\000\377\315e\000\377\300E"
-  "\000\377\312_\000\377\337\210\000\377\361\244\000\377\370\256\000\377\371\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\367\254\000\377\363\250\000\377\355"
-  "\237\000\377\346\223\000\377\334\202\000\377\317j\001\377\301H\000\377\267\034\000\377"
-  "\264\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\265\000\000\377"
-  "\264\000\000\377\264\000\001\377\271(\000\377\311\\\000\377\335\205\000\377\356\240\000\377"
-  "\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313"
-  "a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341"
-  "\213\000\377\314e\000\377\273\062\000\377\264\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\267\026\000\377\305"
-  "R\000\377\332\177\000\377\355\236\000\377\367\254\000\377\371\260\000\377\370\257\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\257\000\377\371\260\000\377\371\260\000\377\365\252\000\377\347"
-  "\224\000\377\321n\000\377\301H\000\377\306V\000\377\332\200\000\377\355\237\000\377\366"
-  "\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\366"
-  "\254\000\377\363\247\000\377\354\235\000\377\345\222\000\377\337\207\000\377\331}\000"
-  "\377\325w\000\377\330|\000\377\342\215\000\377\355\237\000\377\363\247\000\377\360"
-  "\243\000\377\351\230\000\377\337\211\000\377\324s\001\377\306U\001\377\272-\000\377\263"
-  "\000\000\377\262\000\000\377\267,)\377\310~t\377\336\272\254\377\354\332\313\356"
-  "\353\327\310\377\333\263\246\377\305sk\377\266\034\032\377\261\000\000\377\264"
-  "\000\000\377\274\064\000\377\310Z\001\377\325w\001\377\341\213\000\377\352\231\000\377\361"
-  "\244\000\377\365\252\000\377\367\255\000\377\367\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\254\000\377\361\245\000\377\350\226\000\377"
-  "\333\202\000\377\320l\000\377\306U\001\377\275:\000\377\267\027\000\377\263\000\000\377"
-  "\263\000\000\377\272D>\377\315\217\205\377\342\304\266\377\355\334\314\252\347"
-  "\320\301\377\325\245\231\377\300c[\377\265\005\016\377\262\000\000\377\267\025\000"
-  "\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000"
-  "\377\347\226\000\377\324t\000\377\300E\000\377\265\000\000\377\263\000\000\377\265\023\024"
-  "\377\273IC\377\304rj\377\314\213\201\377\315\215\203\377\306yp\377\275SM"
-  "\377\266\040\037\377\262\000\000\377\263\000\000\377\274\066\000\377\317k\000\377\344\220"
-  "\000\377\363\247\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\367\254\000\377\362\245\000\377\347\226\000\377\334"
-  "\203\000\377\326w\000\377\327y\000\377\334\202\000\377\342\215\000\377\351\230\000\377"
-  "\360\243\000\377\365\252\000\377\367\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\257\000\377\370\257\000\377\366\254\000\377\361\245\000\377\352\232\000\377\343"
-  "\216\000\377\334\204\000\377\327z\000\377\325w\000\377\333\201\000\377\346\224\000\377"
-  "\360\243\000\377\362\246\000\377\356\240\000\377\346\223\000\377\334\202\000\377\317"
-  "j\000\377\301H\000\377\270\037\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264\000"
-  "\000\377\264\000\000\377\273\061\000\377\314d\000\377\341\213\000\377\361\244\000\377\370"
-  "\256\000\377\371\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\245\000\377"
-  "\343\217\000\377\316i\000\377\274\065\000\377\263\000\001\377\263\000\001\377\265\000\000\377"
-  "\265\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\262\000\000\377\265\000\000\377"
-  "\275\070\000\377\312_\001\377\330{\000\377\343\216\000\377\354\234\000\377\362\246\000"
-  "\377\367\254\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000"
-  "\377\357\242\000\377\347\226\000\377\336\206\000\377\321o\001\377\304O\000\377\271"
-  "&\000\377\263\000\000\377\262\000\000\377\271;\066\377\312\206|\377\340\276\261\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377\271\070"
-  "\063\377\262\000\000\377\264\000\000\377\275;\000\377\320l\000\377\344\220\000\377\362\246"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\254\000\377\365\252\000\377\363\247\000\377\354\235\000\377\336\206"
-  "\000\377\315f\000\377\304Q\000\377\315g\000\377\337\210\000\377\356\240\000\377\365\252"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366"
-  "\253\000\377\365\252\000\377\365\251\000\377\365\252\000\377\366\253\000\377\367\254"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362"
-  "\246\000\377\343\217\000\377\320m\000\377\305S\000\377\315e\000\377\337\207\000\377\356"
-  "\240\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\366\254\000\377\365\252\000\377\361\245\000\377\351\230\000"
-  "\377\331~\000\377\307W\000\377\271&\000\377\264\000\000\377\264\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\271(\000\377\311"
-  "\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377"
-  "\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\361\244\000\377\341\213\000\377\314e\000\377\273\062\000\377"
-  "\264\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\004\000\377"
-  "\265\006\000\377\266\016\000\377\273\062\000\377\311\\\000\377\334\203\000\377\355\236"
-  "\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\366\253\000\377\361\244\000\377\344\221\000\377\322q\000\377\306T"
-  "\000\377\313b\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377"
-  "\365\251\000\377\361\244\000\377\351\230\000\377\332\177\000\377\314d\000\377\312_"
-  "\000\377\327{\000\377\351\230\000\377\363\250\000\377\366\254\000\377\364\250\000\377"
-  "\355\236\000\377\337\210\000\377\315f\000\377\275\070\000\377\264\000\000\377\262\000\000"
-  "\377\270\064\060\377\307}s\377\334\265\250\377\351\324\305\377\350\321\302"
-  "\377\331\256\242\377\304sj\377\267(&\377\262\000\000\377\265\000\000\377\276?\000\377"
-  "\320l\000\377\342\214\000\377\356\240\000\377\364\250\000\377\366\253\000\377\366\254"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\366\254\000\377\357\241\000\377\340\212\000\377\316i\000\377\300E"
-  "\000\377\271)\000\377\267\031\000\377\266\026\014\377\265\007\010\377\267(%\377\277\\"
-  "U\377\321\231\216\377\344\310\271\377\356\335\315\210\347\320\301\377\325"
-  "\245\231\377\300b[\377\265\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377\331"
-  "}\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000\377\347\226\000\377\324"
-  "t\000\377\300E\000\377\265\006\000\377\263\000\000\377\265\003\007\377\267($\377\272A<\377"
-  "\274PJ\377\275RK\377\273E@\377\270.*\377\266\025\016\377\265\000\000\377\270\035"
-  "\000\377\300F\000\377\322p\000\377\345\222\000\377\362\246\000\377\367\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\366\254\000"
-  "\377\357\242\000\377\340\211\000\377\317j\000\377\311]\000\377\323r\000\377\342\216"
-  "\000\377\356\240\000\377\363\250\000\377\365\253\000\377\366\254\000\377\366\254\000"
-  "\377\365\252\000\377\365\252\000\377\365\252\000\377\366\253\000\377\367\254\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000"
-  "\377\366\253\000\377\364\250\000\377\357\241\000\377\344\220\000\377\325u\000\377\311"
-  "^\000\377\315g\000\377\336\206\000\377\356\237\000\377\365\252\000\377\366\253\000\377"
-  "\362\245\000\377\351\230\000\377\331~\000\377\307W\000\377\271&\000\377\264\000\000\377"
-  "\264\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\272/\000\377\313`\000\377\336"
-  "\207\000\377\356\237\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\345\221\000\377\322o\000\377\300E\000\377\270\036\000"
-  "\377\265\005\000\377\265\007\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\006\000"
-  "\377\266\015\000\377\272,\000\377\305R\000\377\325w\000\377\345\222\000\377\360\242"
-  "\000\377\364\251\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\366\254\000\377\365\252\000\377\362\246\000\377\353\233\000"
-  "\377\335\204\000\377\312_\000\377\273\060\000\377\263\000\000\377\263\000\000\377\272A;"
-  "\377\312\204{\377\335\271\254\377\355\333\314\252\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\335\267\252\377\310\177u\377\271\070\063\377\262\000\000\377\264\000\000\377\275"
-  ";\000\377\320l\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\363\247\000\377\350\226\000\377\332\177\000\377\320m\000\377\323"
-  "r\000\377\334\203\000\377\346\223\000\377\354\235\000\377\361\245\000\377\365\252\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\256\000\377\366\254\000\377\362\246\000\377\355\237\000\377\353\233"
-  "\000\377\355\236\000\377\362\245\000\377\366\253\000\377\367\256\000\377\370\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\363\247\000\377\350\227\000\377\332\177"
-  "\000\377\320m\000\377\322q\000\377\334\202\000\377\345\223\000\377\354\235\000\377\361"
-  "\245\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\366\254\000\377\356\241\000\377\335\205\000\377\311\\\000\377"
-  "\271%\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\271(\000\377\311\\\000\377\335\205\000\377\356"
-  "\240\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302"
-  "K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244"
-  "\000\377\341\213\000\377\314e\000\377\273\062\000\377\264\000\000\377\264\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\266\020\000\377\272+\000\377\277B\000\377\310Z"
-  "\000\377\324t\000\377\342\216\000\377\357\241\000\377\366\254\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\366\253\000\377\363\247\000\377\356\240\000\377\350\226"
-  "\000\377\337\210\000\377\325v\000\377\320l\000\377\326x\000\377\343\217\000\377\360\243"
-  "\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000"
-  "\377\333\201\000\377\310Z\000\377\303N\000\377\322q\000\377\346\224\000\377\364\250"
-  "\000\377\371\260\000\377\370\257\000\377\362\246\000\377\344\221\000\377\320l\000\377"
-  "\275\071\000\377\263\000\000\377\262\000\000\377\267-+\377\303og\377\324\242\226\377"
-  "\337\275\260\377\336\273\256\377\322\234\220\377\301f^\377\266\"!\377\262"
-  "\000\000\377\264\000\000\377\277A\000\377\323r\000\377\347\225\000\377\364\250\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\257\000\377\367\255\000\377\356\240\000\377"
-  "\335\204\000\377\310Z\000\377\271%\000\377\263\000\000\377\264\000\000\377\267*'\377\274"
-  "KE\377\302jb\377\314\213\201\377\332\262\245\377\351\322\303\377\357\337"
-  "\317D\347\320\301\377\325\244\230\377\300b[\377\265\005\016\377\262\000\000\377"
-  "\267\025\000\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364"
-  "\250\000\377\347\226\000\377\324t\000\377\300E\000\377\266\011\000\377\263\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\001\000\377\270\037\000\377\274\067\000\377\303N\000\377\315f\000\377\333\201\000\377\351"
-  "\231\000\377\363\250\000\377\367\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\370\257\000\377\367\255\000\377\356\240\000\377\334\203\000\377"
-  "\310[\000\377\302K\000\377\321m\000\377\345\222\000\377\363\250\000\377\370\257\000\377"
-  "\370\257\000\377\366\254\000\377\363\247\000\377\356\240\000\377\353\233\000\377\354"
-  "\235\000\377\361\244\000\377\365\253\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364"
-  "\251\000\377\347\226\000\377\323r\000\377\303M\000\377\306W\000\377\332~\000\377\355"
-  "\236\000\377\367\254\000\377\372\261\000\377\367\255\000\377\356\240\000\377\335\205"
-  "\000\377\310[\000\377\271%\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000"
-  "\377\264\000\000\377\271)\000\377\306U\000\377\326x\000\377\343\217\000\377\354\235\000"
-  "\377\361\245\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\363\250\000\377\351\230"
-  "\000\377\333\201\000\377\315f\000\377\303M\000\377\274\066\000\377\270\037\000\377\265"
-  "\000\000\377\264\000\000\377\266\013\000\377\271(\000\377\277?\000\377\307W\000\377\322p\000"
-  "\377\341\213\000\377\356\237\000\377\365\253\000\377\370\256\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\361\244\000\377\341\214\000\377\314e\000\377\273\060"
-  "\000\377\263\000\000\377\262\000\000\377\271\071\065\377\305um\377\325\245\231\377\343"
-  "\306\267\377\354\331\311\356\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377"
-  "\271\070\063\377\262\000\000\377\264\000\000\377\275;\000\377\320l\000\377\344\220\000\377"
-  "\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\366\253\000\377"
-  "\357\242\000\377\347\225\000\377\340\211\000\377\332\200\000\377\327z\000\377\330|"
-  "\000\377\337\207\000\377\351\230\000\377\362\246\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365"
-  "\252\000\377\354\235\000\377\341\214\000\377\333\201\000\377\340\212\000\377\353\233"
-  "\000\377\364\251\000\377\370\256\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367"
-  "\255\000\377\365\252\000\377\357\241\000\377\347\225\000\377\340\211\000\377\332\200"
-  "\000\377\327z\000\377\330{\000\377\336\207\000\377\351\230\000\377\362\246\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\256\000\377\371\257\000\377\367\255"
-  "\000\377\357\242\000\377\336\206\000\377\310[\000\377\270\"\000\377\263\000\000\377\263"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264"
-  "\000\000\377\271(\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256"
-  "\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210"
-  "\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341\213\000\377\314"
-  "e\000\377\273\062\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\264"
-  "\000\000\377\267\034\000\377\300D\000\377\314e\000\377\331}\000\377\343\217\000\377\354"
-  "\235\000\377\363\247\000\377\366\254\000\377\367\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\364\251\000\377\354\235\000\377\342\214\000\377\331~\000\377\327z\000\377\331"
-  "~\000\377\336\206\000\377\344\221\000\377\354\235\000\377\363\247\000\377\367\255\000"
-  "\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\371\257\000\377\367\255\000\377\356\240\000\377\333\201\000\377"
-  "\307X\000\377\302J\000\377\321o\000\377\346\224\000\377\364\250\000\377\371\260\000\377"
-  "\371\260\000\377\363\247\000\377\345\222\000\377\320l\000\377\274\070\000\377\263\000"
-  "\000\377\262\000\000\377\266\040\037\377\276VO\377\310\177u\377\317\225\212\377\316"
-  "\223\210\377\306zq\377\274OI\377\265\025\030\377\262\000\000\377\264\000\000\377\277"
-  "@\000\377\323r\000\377\347\226\000\377\364\251\000\377\371\257\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\371\257\000\377\367\255\000\377\356\240\000\377\335\204\000\377\307X\000\377"
-  "\267\034\000\377\262\000\000\377\263\000\000\377\272@;\377\304sj\377\321\233\217\377"
-  "\335\270\253\377\347\317\300\377\360\340\320\"\000\000\000\377\347\317\301\377"
-  "\324\243\227\377\300b[\377\265\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377"
-  "\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000\377\347\226\000\377"
-  "\324t\000\377\300E\000\377\266\012\000\377\263\000\001\377\265\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\265\000\000\377\273\060\000\377\306"
-  "U\001\377\323r\001\377\336\206\000\377\350\226\000\377\357\242\000\377\365\252\000\377"
-  "\367\255\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\371\257"
-  "\000\377\367\255\000\377\357\241\000\377\333\202\000\377\307X\000\377\301F\000\377\320"
-  "l\000\377\345\223\000\377\364\251\000\377\371\260\000\377\371\260\000\377\366\253\000"
-  "\377\356\237\000\377\342\216\000\377\333\202\000\377\337\210\000\377\351\231\000\377"
-  "\363\247\000\377\370\256\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\257\000\377\371\257\000\377\365\252\000\377\350\226\000\377"
-  "\322q\000\377\302I\000\377\305S\000\377\331}\000\377\355\236\000\377\367\255\000\377"
-  "\372\262\000\377\370\256\000\377\357\242\000\377\336\206\000\377\310[\000\377\270\""
-  "\000\377\263\000\000\377\263\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\270\036"
-  "\000\377\277@\000\377\310\\\000\377\323s\000\377\336\207\000\377\351\231\000\377\362"
-  "\246\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\367\255\000\377\365\252\000\377\357\242\000\377\347\226\000\377"
-  "\336\206\000\377\323q\000\377\306U\000\377\273\060\000\377\265\000\000\377\263\000\000\377"
-  "\266\025\000\377\277?\000\377\313a\000\377\327z\000\377\342\215\000\377\353\234\000\377"
-  "\363\247\000\377\367\255\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\371\257\000\377\370"
-  "\256\000\377\362\245\000\377\342\215\000\377\314e\000\377\272.\000\377\262\000\000\377"
-  "\262\000\000\377\267*'\377\276YR\377\310\177v\377\323\237\223\377\336\272\255"
-  "\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377\271\070\063\377\262"
-  "\000\000\377\264\000\000\377\275;\000\377\320l\000\377\344\220\000\377\362\246\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\362"
-  "\246\000\377\354\235\000\377\341\213\000\377\323r\000\377\312`\000\377\321o\000\377\341"
-  "\214\000\377\360\243\000\377\367\254\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\366\253\000\377\361\244\000\377\344\220\000\377"
-  "\324t\000\377\313a\000\377\322q\000\377\342\215\000\377\360\242\000\377\366\253\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000"
-  "\377\362\246\000\377\354\235\000\377\341\214\000\377\323r\000\377\312`\000\377\321"
-  "n\000\377\341\213\000\377\360\242\000\377\367\254\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\370\257\000\377\367\254\000\377\357\241\000\377\337\210\000\377"
-  "\313a\000\377\274\064\000\377\265\010\000\377\265\000\000\377\265\004\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\271(\000\377\311\\\000\377\335"
-  "\205\000\377\356\240\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377"
-  "\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\361\244\000\377\341\213\000\377\314e\000\377\273\062\000\377\264\000\000\377\264"
-  "\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\270#\000\377\305T\000\377\327z\000"
-  "\377\347\225\000\377\360\242\000\377\364\251\000\377\366\253\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\367\256\000\377\363\247\000\377\346\224\000\377\326w\000"
-  "\377\313a\000\377\317j\000\377\335\204\000\377\352\231\000\377\361\244\000\377\364"
-  "\251\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254"
-  "\000\377\355\237\000\377\333\201\000\377\310Z\000\377\303M\000\377\322q\000\377\346\224"
-  "\000\377\364\250\000\377\371\260\000\377\370\257\000\377\363\247\000\377\345\222\000"
-  "\377\322p\000\377\300D\000\377\267\025\000\377\264\000\000\377\266\024\017\377\270\063"
-  ".\377\274MG\377\277[T\377\276ZS\377\273JD\377\270.*\377\266\017\012\377\264"
-  "\000\000\377\267\035\000\377\302J\000\377\325v\000\377\350\226\000\377\364\250\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\365\252\000\377\354\235\000\377"
-  "\333\201\000\377\307X\000\377\270\"\000\377\262\000\000\377\264\000\000\377\274NH\377\314"
-  "\214\202\377\336\272\255\377\353\327\310\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\347\317\300\377\324\242\226\377\300bZ\377\265\005\016\377\262\000\000\377\267\025"
-  "\000\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000"
-  "\377\347\226\000\377\324t\000\377\300E\000\377\266\011\000\377\263\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\263\000\000\377\265\000\000"
-  "\377\276<\000\377\316i\000\377\340\211\000\377\354\235\000\377\362\246\000\377\365"
-  "\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\365\252\000\377\355\236\000\377\334\202\000\377"
-  "\312^\000\377\305R\000\377\323r\000\377\346\224\000\377\363\250\000\377\370\256\000\377"
-  "\367\255\000\377\362\246\000\377\346\224\000\377\326x\000\377\313b\000\377\320m\000\377"
-  "\340\211\000\377\356\240\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377"
-  "\350\227\000\377\325v\000\377\306T\000\377\310[\000\377\331~\000\377\353\233\000\377"
-  "\365\252\000\377\370\257\000\377\367\254\000\377\357\241\000\377\337\210\000\377\313"
-  "a\000\377\274\064\000\377\265\010\000\377\265\000\000\377\265\004\000\377\265\000\000\377\265"
-  "\000\000\377\266\016\000\377\270\040\000\377\273\063\000\377\303M\000\377\321n\000\377\342"
-  "\215\000\377\360\242\000\377\367\254\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377"
-  "\362\246\000\377\354\235\000\377\337\211\000\377\316h\000\377\275;\000\377\264\000\000"
-  "\377\262\000\000\377\267\033\000\377\303N\000\377\325v\000\377\345\222\000\377\357\241"
-  "\000\377\364\250\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\257\000\377\367\255\000\377\361\244\000\377\342\216\000\377\317j\000\377\276"
-  "=\000\377\266\014\000\377\265\000\000\377\266\031\024\377\270/+\377\273HB\377\302kc"
-  "\377\320\227\214\377\341\302\264\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377"
-  "\271\070\063\377\262\000\000\377\264\000\000\377\275;\000\377\320l\000\377\344\220\000\377"
-  "\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\256\000\377"
-  "\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\367\255\000\377\362\246\000\377\344\220\000\377\320l\000\377\303L"
-  "\000\377\312^\000\377\335\205\000\377\357\241\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\366\253\000\377\363\247\000\377\357\241\000\377\347\225"
-  "\000\377\331}\000\377\311\\\000\377\300D\000\377\307X\000\377\327z\000\377\346\223\000"
-  "\377\356\240\000\377\363\247\000\377\365\253\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\363\247\000\377\345\221\000\377\321n\000\377"
-  "\303N\000\377\312^\000\377\335\204\000\377\356\240\000\377\366\254\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\254\000\377\360\244\000"
-  "\377\344\220\000\377\324u\000\377\307Y\000\377\277@\000\377\272+\000\377\266\024\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\271(\000\377\311"
-  "\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377"
-  "\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\361\244\000\377\341\213\000\377\314e\000\377\273\062\000\377"
-  "\264\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\270$\000\377\310"
-  "Z\000\377\334\204\000\377\356\237\000\377\366\253\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\257\000\377\370\256\000\377\362\246\000\377\343"
-  "\217\000\377\317j\000\377\302L\000\377\312`\000\377\336\206\000\377\357\242\000\377\366"
-  "\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367"
-  "\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\370\256\000\377\371\257"
-  "\000\377\367\254\000\377\355\237\000\377\333\201\000\377\307Y\000\377\303M\000\377\322"
-  "p\000\377\346\224\000\377\364\250\000\377\371\257\000\377\370\257\000\377\363\250\000"
-  "\377\351\230\000\377\332\177\000\377\313b\000\377\301H\000\377\273\062\000\377\267\035"
-  "\001\377\265\010\006\377\265\011\015\377\266\022\021\377\265\021\021\377\265\010\014\377"
-  "\265\012\005\377\270\040\001\377\274\065\000\377\302L\000\377\315f\000\377\334\203\000\377"
-  "\353\233\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\365\252\000\377\362\245\000"
-  "\377\354\236\000\377\343\217\000\377\324u\000\377\304O\000\377\270\035\000\377\262\000"
-  "\000\377\263\000\000\377\275RL\377\317\226\213\377\344\307\271\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\324\242\226\377\300bZ\377\265"
-  "\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377\331}\000\377\353\234\000\377\365"
-  "\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\364\250\000\377\347\226\000\377\324t\000\377\300E\000\377\266"
-  "\011\000\377\263\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\263\000\000\377\265\000\000\377\277@\000\377\322p\000\377\346\223\000\377\363"
-  "\247\000\377\367\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\365\252\000\377\362\245\000\377\355\236\000\377"
-  "\346\223\000\377\332\200\000\377\320l\000\377\317j\000\377\333\201\000\377\352\231"
-  "\000\377\363\247\000\377\364\251\000\377\360\243\000\377\350\227\000\377\333\202\000"
-  "\377\313a\000\377\300E\000\377\305T\000\377\325v\000\377\344\220\000\377\355\236\000"
-  "\377\362\246\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\365\252\000\377\353\234\000\377\334\203\000\377\320l\000\377"
-  "\317k\000\377\331}\000\377\344\221\000\377\354\235\000\377\362\246\000\377\364\251"
-  "\000\377\360\243\000\377\344\221\000\377\325u\000\377\307X\000\377\277?\000\377\271("
-  "\000\377\266\015\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\264\000"
-  "\000\377\272,\000\377\311^\000\377\336\206\000\377\356\241\000\377\366\254\000\377\370"
-  "\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\363\247\000\377\346\223\000\377"
-  "\322p\000\377\277@\000\377\264\000\000\377\261\000\000\377\267\032\000\377\305S\000\377\332"
-  "\177\000\377\354\234\000\377\365\253\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\256\000\377\367\256"
-  "\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000"
-  "\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\362\246\000"
-  "\377\347\225\000\377\327z\000\377\311^\000\377\300D\000\377\272.\000\377\267\032\001\377"
-  "\264\000\000\377\264\000\000\377\271=\070\377\310\201w\377\335\270\253\377\356\335"
-  "\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\335\267\252\377\310\177u\377\271\070\063\377\262\000\000\377\264\000\000\377\275;"
-  "\000\377\320l\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377"
-  "\370\257\000\377\370\257\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\370\257\000\377\364\250\000\377"
-  "\344\221\000\377\317j\000\377\300E\000\377\310Y\000\377\334\204\000\377\357\242\000\377"
-  "\367\256\000\377\371\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\363\250\000\377\354\235"
-  "\000\377\342\215\000\377\327z\000\377\313a\000\377\300C\000\377\272-\000\377\277?\000\377"
-  "\312^\000\377\326x\000\377\341\213\000\377\353\233\000\377\363\247\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\257\000\377\370\257\000\377\364\250\000\377\345"
-  "\222\000\377\320m\000\377\302I\000\377\310Z\000\377\334\202\000\377\356\240\000\377\366"
-  "\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\363\247\000\377\354\235\000\377\343\216\000\377\330|\000\377\315e\000\377\301"
-  "G\000\377\270\"\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\264\000"
-  "\000\377\271(\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370"
-  "\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000"
-  "\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210"
-  "\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341\213\000\377\314"
-  "e\000\377\273\062\000\377\264\000\000\377\264\000\000\377\265\000\000\377\263\000\000\377\262"
-  "\000\000\377\270\037\000\377\310Y\000\377\335\205\000\377\357\241\000\377\367\255\000\377"
-  "\371\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370\257"
-  "\000\377\363\247\000\377\343\217\000\377\315g\000\377\300D\000\377\311]\000\377\336\206"
-  "\000\377\360\243\000\377\370\256\000\377\371\257\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000"
-  "\377\370\257\000\377\371\260\000\377\367\255\000\377\356\240\000\377\333\201\000\377"
-  "\307X\000\377\302J\000\377\321o\000\377\346\224\000\377\364\250\000\377\370\257\000\377"
-  "\370\257\000\377\365\252\000\377\357\241\000\377\346\224\000\377\334\203\000\377\321"
-  "n\001\377\305S\001\377\273/\000\377\265\000\000\377\263\000\000\377\263\000\000\377\263\000\000"
-  "\377\263\000\000\377\265\000\000\377\274\065\000\377\307W\001\377\323r\000\377\335\205\000"
-  "\377\347\226\000\377\360\243\000\377\365\253\000\377\367\256\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\366\254\000\377\361\245"
-  "\000\377\351\230\000\377\336\207\000\377\324s\000\377\310[\001\377\276=\000\377\266\020"
-  "\000\377\262\000\000\377\263\000\000\377\274OI\377\320\226\213\377\345\311\273\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\324\241\226\377"
-  "\300bZ\377\265\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377\331}\000\377\353"
-  "\234\000\377\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\370\256\000\377\364\250\000\377\347\226\000\377\324t\000\377\300"
-  "E\000\377\266\011\000\377\263\000\000\377\265\000\000\377\265\000\000\377\265\001\000\377\265"
-  "\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\276>\000\377\322q\000\377\347\225"
-  "\000\377\364\251\000\377\371\257\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\366\254\000\377\361\245\000\377\351\227\000\377\337"
-  "\210\000\377\331~\000\377\330{\000\377\332\177\000\377\336\207\000\377\347\225\000\377"
-  "\357\242\000\377\362\246\000\377\356\237\000\377\344\220\000\377\331}\000\377\315e"
-  "\000\377\301G\000\377\272.\000\377\275;\000\377\310Z\000\377\324t\000\377\337\210\000\377"
-  "\352\231\000\377\362\246\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\366\253\000\377\360\243\000\377\350\226\000\377\337\210\000\377"
-  "\332\200\000\377\330|\000\377\331}\000\377\336\207\000\377\350\227\000\377\360\243"
-  "\000\377\362\246\000\377\355\236\000\377\343\217\000\377\330|\000\377\314d\000\377\300"
-  "D\000\377\267\027\000\377\263\000\000\377\264\000\000\377\265\000\000\377\263\000\000\377\263"
-  "\000\000\377\270\040\000\377\310Z\000\377\335\204\000\377\356\240\000\377\366\254\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\370\257\000\377\364\251\000\377\347\225\000"
-  "\377\323r\000\377\277A\000\377\264\000\000\377\261\000\000\377\266\022\000\377\305S\000\377"
-  "\332\200\000\377\355\236\000\377\367\254\000\377\371\260\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\257\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\256\000"
-  "\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\364\251"
-  "\000\377\356\237\000\377\344\221\000\377\332\200\000\377\317j\001\377\303N\001\377\271"
-  "(\000\377\263\000\000\377\262\000\000\377\267,(\377\307{r\377\334\266\251\377\356\334"
-  "\315\210\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\335\267\252\377\310\177u\377\271\070\063\377\262\000\000\377\264\000\000\377"
-  "\275;\000\377\320l\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\366"
-  "\254\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253"
-  "\000\377\366\253\000\377\366\253\000\377\366\254\000\377\367\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247"
-  "\000\377\345\222\000\377\321n\000\377\304O\000\377\312_\000\377\335\204\000\377\356\240"
-  "\000\377\366\253\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377"
-  "\345\222\000\377\325u\000\377\306V\000\377\275;\000\377\271%\000\377\267\033\000\377\270"
-  "#\000\377\275\070\000\377\305S\000\377\323r\000\377\343\217\000\377\360\243\000\377\367"
-  "\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\250\000\377"
-  "\345\222\000\377\321m\000\377\302L\000\377\311\\\000\377\334\203\000\377\356\240\000"
-  "\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\366\253\000\377\363\250\000\377\357\242\000\377\347\226\000\377\331"
-  "~\000\377\310Z\000\377\272,\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264\000\000"
-  "\377\264\000\000\377\271(\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341\213\000"
-  "\377\314e\000\377\273\062\000\377\264\000\000\377\264\000\000\377\265\002\000\377\264\000\000"
-  "\377\265\000\000\377\272.\000\377\312^\000\377\336\206\000\377\356\241\000\377\367\254"
-  "\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\367\255\000\377\361\245\000\377\342\216\000\377\317j\000\377\303N\000\377\314c\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\254\000\377\366\254\000\377\366\254\000\377"
-  "\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366"
-  "\253\000\377\366\254\000\377\367\255\000\377\365\252\000\377\354\235\000\377\333\200"
-  "\000\377\311\\\000\377\304Q\000\377\323s\000\377\347\225\000\377\364\250\000\377\370"
-  "\256\000\377\370\256\000\377\366\254\000\377\364\251\000\377\361\244\000\377\353\233"
-  "\000\377\337\207\000\377\316h\000\377\276=\000\377\265\001\000\377\263\000\000\377\264\000"
-  "\000\377\264\000\000\377\263\000\000\377\266\016\000\377\300C\000\377\320m\000\377\341\213"
-  "\000\377\354\235\000\377\362\245\000\377\365\252\000\377\366\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\366"
-  "\253\000\377\356\240\000\377\340\211\000\377\317k\000\377\303M\000\377\274\065\000\377"
-  "\270\"\000\377\266\017\003\377\264\000\000\377\266\026\025\377\277\\U\377\321\232\217"
-  "\377\345\312\273\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300"
-  "\377\324\242\226\377\300bZ\377\265\005\016\377\262\000\000\377\267\025\000\377\304"
-  "Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000\377\347\226"
-  "\000\377\324t\000\377\300E\000\377\266\011\000\377\263\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\266\025\000\377\301F\000"
-  "\377\324s\000\377\347\225\000\377\364\250\000\377\370\256\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\256\000\377\370\256\000\377\366\253\000\377\356\240\000"
-  "\377\337\210\000\377\321m\000\377\315e\000\377\326w\000\377\343\216\000\377\354\235"
-  "\000\377\362\246\000\377\365\252\000\377\362\246\000\377\347\225\000\377\327z\000\377"
-  "\310Z\000\377\276?\000\377\271(\000\377\267\034\000\377\270!\000\377\274\065\000\377\304"
-  "O\000\377\321m\000\377\341\213\000\377\357\241\000\377\366\254\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\362\246\000"
-  "\377\355\236\000\377\344\220\000\377\327z\000\377\315f\000\377\317k\000\377\336\205"
-  "\000\377\354\236\000\377\364\251\000\377\364\251\000\377\360\243\000\377\347\226\000"
-  "\377\332\177\000\377\311\\\000\377\273\062\000\377\265\005\000\377\265\000\000\377\265\002"
-  "\000\377\264\000\000\377\263\000\000\377\271'\000\377\311\\\000\377\335\205\000\377\356\240"
-  "\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363"
-  "\250\000\377\346\224\000\377\322q\000\377\277A\000\377\265\000\000\377\263\000\000\377\271"
-  "'\000\377\307X\000\377\333\201\000\377\355\236\000\377\366\254\000\377\370\257\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\366\254\000\377\366\254\000\377\366\253\000\377"
-  "\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366"
-  "\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253"
-  "\000\377\366\253\000\377\366\254\000\377\367\254\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\253\000\377\364\251\000\377\360\243\000\377\351\231\000\377\334\203"
-  "\000\377\313b\000\377\274\065\000\377\264\000\000\377\262\000\000\377\270\065\061\377\310"
-  "~u\377\334\267\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377\271\070\063\377"
-  "\262\000\000\377\264\000\000\377\275;\000\377\320l\000\377\344\221\000\377\362\246\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000"
-  "\377\363\247\000\377\360\242\000\377\355\237\000\377\354\236\000\377\354\235\000\377"
-  "\355\236\000\377\354\236\000\377\354\235\000\377\355\237\000\377\360\242\000\377\363"
-  "\247\000\377\366\253\000\377\367\255\000\377\367\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\364\250\000\377\350\227\000\377\330|\000\377\315f\000\377\317k\000\377"
-  "\333\201\000\377\347\226\000\377\357\241\000\377\363\247\000\377\365\253\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\360\243\000\377\341\213\000\377\315e\000\377\274\066\000\377\265\000\000\377\264"
-  "\000\000\377\265\005\000\377\264\000\000\377\265\000\000\377\273\061\000\377\312`\000\377\337"
-  "\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\363\247\000\377\345\222\000\377\320m\000\377\302K\000\377\311\\\000"
-  "\377\334\204\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\366"
-  "\254\000\377\357\242\000\377\340\211\000\377\313b\000\377\272/\000\377\264\000\000\377"
-  "\264\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\271(\000\377\311\\\000\377\335"
-  "\205\000\377\356\240\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377"
-  "\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\361\244\000\377\341\214\000\377\315e\000\377\273\062\000\377\264\000\000\377\263"
-  "\000\000\377\266\020\000\377\271%\000\377\275\071\000\377\305R\000\377\322p\000\377\342\216"
-  "\000\377\360\242\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\253\000\377\364\250\000\377\360\243\000\377\352\232\000\377\337\210\000\377\322"
-  "q\000\377\314d\000\377\324t\000\377\343\217\000\377\361\244\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\367\256\000\377\366\254\000\377\364\250\000\377"
-  "\361\244\000\377\356\237\000\377\355\236\000\377\354\235\000\377\355\236\000\377\355"
-  "\236\000\377\354\235\000\377\354\235\000\377\355\236\000\377\355\236\000\377\354\234"
-  "\000\377\346\223\000\377\332\177\000\377\316i\000\377\316g\000\377\332\177\000\377\352"
-  "\231\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\256"
-  "\000\377\367\255\000\377\363\247\000\377\346\223\000\377\322q\000\377\277B\000\377\265"
-  "\001\000\377\263\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\266\017\000\377\302"
-  "I\000\377\325w\000\377\350\227\000\377\364\250\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\200\000\377\306V\000\377"
-  "\271&\000\377\264\000\000\377\265\000\002\377\267'#\377\272@;\377\277]V\377\311\202"
-  "x\377\330\255\240\377\350\321\302\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\347\317\300\377\324\242\226\377\300bZ\377\265\005\016\377\262\000\000\377\267"
-  "\025\000\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250"
-  "\000\377\347\226\000\377\324t\000\377\300D\000\377\265\004\000\377\263\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\003\000\377\267\033\000\377\272.\000\377\300D\000"
-  "\377\312`\000\377\332\200\000\377\352\231\000\377\364\251\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\366\253\000"
-  "\377\354\235\000\377\332\177\000\377\310Y\000\377\305R\000\377\324t\000\377\347\225"
-  "\000\377\363\250\000\377\370\257\000\377\370\256\000\377\362\245\000\377\343\217\000"
-  "\377\320k\000\377\276=\000\377\266\011\000\377\264\000\000\377\265\004\000\377\265\000\000\377"
-  "\264\000\000\377\271*\000\377\310Z\000\377\334\203\000\377\355\237\000\377\366\254\000"
-  "\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\364\251\000\377\351\231\000\377\326y\000\377\306U\000\377\306"
-  "V\000\377\327z\000\377\352\232\000\377\365\252\000\377\370\257\000\377\367\255\000\377"
-  "\360\244\000\377\344\221\000\377\324u\000\377\306V\000\377\276=\000\377\271(\000\377"
-  "\266\025\000\377\264\000\000\377\263\000\000\377\271(\000\377\311]\000\377\336\206\000\377"
-  "\357\241\000\377\367\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\363\247\000\377\346\223\000\377\322p\000\377\300C\000\377\270#\000\377\272/\000"
-  "\377\303N\000\377\320l\000\377\340\212\000\377\356\240\000\377\366\254\000\377\370"
-  "\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\367\256\000\377\367\255\000\377\365\252\000\377\362\246\000\377\357\241\000\377\355"
-  "\236\000\377\354\235\000\377\355\236\000\377\355\236\000\377\355\236\000\377\355\236"
-  "\000\377\355\236\000\377\355\236\000\377\355\236\000\377\355\236\000\377\354\235\000"
-  "\377\354\235\000\377\355\237\000\377\360\242\000\377\363\247\000\377\366\253\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\255\000\377\361\245\000"
-  "\377\343\217\000\377\317k\000\377\275:\000\377\264\000\000\377\262\000\000\377\271\070\063"
-  "\377\310\177u\377\335\267\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\267\252\377\310\177u\377"
-  "\271\070\063\377\262\000\000\377\264\000\000\377\276<\000\377\320m\000\377\345\222\000\377"
-  "\363\247\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\364\250\000\377\354\235\000\377\343\217\000\377\335\204\000\377\332\200\000\377"
-  "\332\200\000\377\333\201\000\377\332\200\000\377\332\200\000\377\335\204\000\377\343"
-  "\217\000\377\354\235\000\377\364\251\000\377\370\256\000\377\371\257\000\377\370\257"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\367\255\000\377\365\252\000\377\356\240\000\377\344\221\000\377\334"
-  "\203\000\377\330|\000\377\330|\000\377\333\202\000\377\342\214\000\377\352\232\000\377"
-  "\362\246\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\371"
-  "\257\000\377\370\256\000\377\361\244\000\377\340\212\000\377\313a\000\377\271)\000\377"
-  "\263\000\000\377\263\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\270\"\000\377"
-  "\311\\\000\377\336\206\000\377\357\242\000\377\367\256\000\377\371\257\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\370\256\000\377\363\247\000\377\344\221\000\377\320l\000\377\301"
-  "I\000\377\310[\000\377\335\204\000\377\357\242\000\377\367\255\000\377\371\257\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\371"
-  "\257\000\377\370\256\000\377\361\244\000\377\341\213\000\377\313b\000\377\272+\000\377"
-  "\263\000\000\377\263\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\271(\000\377\311"
-  "\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377"
-  "\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\371\257"
-  "\000\377\370\256\000\377\361\245\000\377\342\215\000\377\315f\000\377\273\063\000\377"
-  "\263\000\000\377\263\000\000\377\270\037\000\377\277B\000\377\312`\000\377\325w\000\377\340"
-  "\212\000\377\352\232\000\377\362\246\000\377\367\254\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\364\251\000\377\355\236\000\377\344\221\000\377\335\205\000\377"
-  "\331}\000\377\330{\000\377\332\200\000\377\341\214\000\377\353\233\000\377\363\250"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\370\257\000\377"
-  "\370\257\000\377\370\257\000\377\370\257\000\377\371\257\000\377\370\257\000\377\366"
-  "\253\000\377\357\241\000\377\346\223\000\377\336\207\000\377\333\201\000\377\332\200"
-  "\000\377\333\201\000\377\333\200\000\377\332\200\000\377\332\177\000\377\332\177\000"
-  "\377\332~\000\377\331~\000\377\331~\000\377\330|\000\377\330|\000\377\334\204\000\377"
-  "\345\222\000\377\357\241\000\377\365\252\000\377\367\256\000\377\367\256\000\377\367"
-  "\255\000\377\370\257\000\377\371\257\000\377\364\251\000\377\347\226\000\377\323r\000"
-  "\377\277@\000\377\264\000\000\377\262\000\000\377\264\000\000\377\264\000\000\377\262\000\000\377"
-  "\265\000\000\377\301H\000\377\326x\000\377\352\232\000\377\365\253\000\377\371\257\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\371\260\000\377\366\254\000\377\354\235\000\377\332\177"
-  "\000\377\304Q\000\377\266\015\000\377\261\000\000\377\264\000\004\377\272B<\377\303of\377"
-  "\316\223\210\377\331\260\243\377\344\310\272\377\356\335\315\210\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\324\242\226\377\300bZ\377"
-  "\265\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377\331}\000\377\353\234\000\377"
-  "\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\364\250\000\377\347\225\000\377\323s\000\377\277A\000\377\264"
-  "\000\000\377\262\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\265\010\000\377\273"
-  "\061\000\377\305R\000\377\320l\000\377\333\200\000\377\345\222\000\377\357\241\000\377"
-  "\365\252\000\377\367\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\371\260\000\377\367\254\000\377\354\235\000\377\330|\000\377\305R\000\377\302"
-  "I\000\377\323r\000\377\350\227\000\377\365\253\000\377\372\261\000\377\371\260\000\377"
-  "\362\246\000\377\343\217\000\377\316h\000\377\273\062\000\377\263\000\000\377\263\000\000"
-  "\377\265\000\000\377\264\000\000\377\262\000\000\377\267\030\000\377\306T\000\377\333\201"
-  "\000\377\355\237\000\377\367\255\000\377\371\257\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\366\253\000\377\353\233"
-  "\000\377\326y\000\377\304P\000\377\304P\000\377\326w\000\377\352\231\000\377\365\252"
-  "\000\377\371\260\000\377\370\257\000\377\364\251\000\377\355\236\000\377\342\216\000"
-  "\377\327{\000\377\314d\000\377\301H\000\377\271&\000\377\264\000\000\377\263\000\000\377"
-  "\271)\000\377\311]\000\377\336\207\000\377\357\242\000\377\367\255\000\377\371\257"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\346\223\000\377\322"
-  "p\000\377\301G\000\377\276?\000\377\307Y\000\377\324t\000\377\337\207\000\377\351\230"
-  "\000\377\362\245\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\256\000\377\370\257\000\377\371\257\000\377\367\255\000\377\362\246"
-  "\000\377\352\231\000\377\341\213\000\377\334\202\000\377\332\200\000\377\333\200\000"
-  "\377\333\201\000\377\333\201\000\377\333\201\000\377\333\201\000\377\333\201\000\377"
-  "\333\201\000\377\333\201\000\377\332\200\000\377\332\200\000\377\335\205\000\377\344"
-  "\220\000\377\355\236\000\377\365\251\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\257\000\377\370\257\000\377\363\247\000\377\345\222\000\377\320m\000\377\276<"
-  "\000\377\264\000\000\377\262\000\000\377\271\070\063\377\310\177u\377\335\267\252\377"
-  "\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\335\267\252\377\310\177u\377\271\070\063\377\262\000\000\377\264\000\000"
-  "\377\275;\000\377\320l\000\377\344\220\000\377\362\245\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\345\222\000\377"
-  "\326x\000\377\312_\000\377\305T\000\377\305T\000\377\306V\000\377\306T\000\377\305T\000"
-  "\377\311^\000\377\325v\000\377\344\220\000\377\360\243\000\377\366\254\000\377\367"
-  "\255\000\377\367\255\000\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\364\250\000\377"
-  "\360\243\000\377\352\232\000\377\341\213\000\377\325w\000\377\316h\000\377\323r\000\377"
-  "\341\214\000\377\357\241\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\367\254\000\377\360\242\000\377\340\211\000\377\313a\000"
-  "\377\272-\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377"
-  "\271'\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\345\222\000\377\321"
-  "n\000\377\303N\000\377\311^\000\377\334\203\000\377\356\240\000\377\366\254\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341\214\000\377\315e\000\377"
-  "\274\064\000\377\264\000\000\377\264\000\000\377\265\001\000\377\264\000\000\377\264\000\000\377"
-  "\271(\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377"
-  "\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377"
-  "\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\360\243\000\377\341\213\000\377\314d\000\377"
-  "\273\062\000\377\263\000\000\377\263\000\000\377\271)\000\377\306V\000\377\327z\000\377\345"
-  "\222\000\377\356\237\000\377\362\246\000\377\365\252\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\255\000\377\362\246\000\377\346\223\000\377\327y\000\377\316"
-  "h\000\377\322q\000\377\335\205\000\377\350\226\000\377\356\240\000\377\363\247\000\377"
-  "\365\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\367\254"
-  "\000\377\366\254\000\377\366\254\000\377\367\254\000\377\367\255\000\377\367\255\000"
-  "\377\363\247\000\377\350\227\000\377\331~\000\377\314d\000\377\306U\000\377\305S\000"
-  "\377\306V\000\377\306W\000\377\307W\000\377\307X\000\377\307W\000\377\306V\000\377\310"
-  "Y\000\377\316g\000\377\330{\000\377\343\216\000\377\353\233\000\377\360\243\000\377\364"
-  "\251\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\257\000\377\364\251\000\377\347\226\000\377\324t\000\377\300F\000\377\266"
-  "\017\000\377\264\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\267\030\000\377\303"
-  "M\000\377\327z\000\377\352\231\000\377\365\252\000\377\370\257\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256"
-  "\000\377\370\256\000\377\365\252\000\377\353\234\000\377\331}\000\377\304Q\000\377\267"
-  "\024\000\377\262\000\000\377\264\000\007\377\275TN\377\315\215\203\377\335\270\253\377"
-  "\351\322\303\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\347\317\300\377\324\242\226\377\300bZ\377\265\005\016\377\262\000\000\377\267"
-  "\025\000\377\304Q\000\377\331}\000\377\353\234\000\377\365\253\000\377\370\257\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250"
-  "\000\377\350\226\000\377\324u\000\377\301G\000\377\266\021\000\377\264\000\000\377\265\000"
-  "\000\377\265\000\000\377\264\000\000\377\266\015\000\377\277@\000\377\317i\000\377\337\207"
-  "\000\377\352\232\000\377\360\243\000\377\364\251\000\377\366\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\365"
-  "\253\000\377\353\234\000\377\331}\000\377\306W\000\377\304P\000\377\324u\000\377\350"
-  "\227\000\377\365\252\000\377\371\260\000\377\370\256\000\377\361\244\000\377\342\215"
-  "\000\377\316h\000\377\274\065\000\377\264\000\000\377\263\000\000\377\265\000\000\377\264\000"
-  "\000\377\263\000\000\377\270\036\000\377\306U\000\377\333\200\000\377\354\235\000\377\365"
-  "\253\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\257\000\377\365\253\000\377\352\232\000\377\326y\000\377\305R"
-  "\000\377\305R\000\377\326x\000\377\352\232\000\377\365\252\000\377\371\257\000\377\370"
-  "\256\000\377\366\253\000\377\363\250\000\377\357\241\000\377\347\225\000\377\332\177"
-  "\000\377\311]\000\377\273\061\000\377\263\000\000\377\262\000\000\377\271(\000\377\311\\\000"
-  "\377\335\205\000\377\356\240\000\377\366\254\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\363\247\000\377\345\223\000\377\321o\000\377\302J\000\377\304"
-  "Q\000\377\324s\000\377\343\217\000\377\355\236\000\377\362\246\000\377\365\252\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000"
-  "\377\367\255\000\377\367\255\000\377\365\252\000\377\355\237\000\377\340\211\000\377"
-  "\321n\000\377\310Z\000\377\305S\000\377\306U\000\377\306V\000\377\306V\000\377\306V\000"
-  "\377\306V\000\377\306V\000\377\306V\000\377\306V\000\377\305T\000\377\305T\000\377\312"
-  "_\000\377\326w\000\377\345\222\000\377\361\244\000\377\367\254\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\370\256\000\377\363\247\000\377\344\221\000\377\320l\000\377"
-  "\275;\000\377\264\000\000\377\262\000\000\377\271\070\063\377\310\177u\377\335\267\252"
-  "\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\334\267\252\377\310~u\377\270\066\062\377\262\000\000\377\264\000"
-  "\000\377\274\066\000\377\314d\000\377\336\206\000\377\353\233\000\377\362\245\000\377"
-  "\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\360\243\000\377\341\213\000"
-  "\377\315f\000\377\275:\000\377\267\031\000\377\267\030\000\377\270!\000\377\267\032\000"
-  "\377\267\031\000\377\274\064\000\377\311\\\000\377\332\177\000\377\350\226\000\377\356"
-  "\240\000\377\357\242\000\377\357\241\000\377\360\243\000\377\363\247\000\377\365\252"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\254\000\377\362\246\000\377\346\224\000\377\323s\000\377\305S"
-  "\000\377\311]\000\377\333\201\000\377\355\236\000\377\366\254\000\377\370\257\000\377"
-  "\367\255\000\377\366\253\000\377\364\251\000\377\361\244\000\377\351\230\000\377\332"
-  "\200\000\377\310[\000\377\272+\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\271&\000\377\306V\000\377\330|\000\377\347\226\000\377\360\243"
-  "\000\377\364\251\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000\377\350"
-  "\226\000\377\327z\000\377\313b\000\377\316h\000\377\333\201\000\377\351\230\000\377\360"
-  "\243\000\377\364\250\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\344\221\000"
-  "\377\323s\000\377\304Q\000\377\274\066\000\377\270\"\000\377\266\022\000\377\264\000\000"
-  "\377\263\000\000\377\271(\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\366\253\000\377\364\251\000\377\361\244\000\377\351\231\000\377\333\201\000"
-  "\377\311]\000\377\272.\000\377\263\000\000\377\263\000\000\377\272-\000\377\312`\000\377"
-  "\336\207\000\377\356\240\000\377\365\253\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341\214\000"
-  "\377\316h\000\377\304P\000\377\316h\000\377\341\213\000\377\360\242\000\377\366\253"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377\363\247\000\377"
-  "\361\244\000\377\357\241\000\377\356\240\000\377\356\241\000\377\357\241\000\377\357"
-  "\242\000\377\357\241\000\377\353\233\000\377\337\207\000\377\316h\000\377\277@\000\377"
-  "\270\036\000\377\267\025\000\377\270$\000\377\273\061\000\377\277?\000\377\302J\000\377"
-  "\303N\000\377\303M\000\377\305R\000\377\315f\000\377\334\203\000\377\352\232\000\377"
-  "\363\250\000\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\352\231"
-  "\000\377\331~\000\377\311]\000\377\276>\000\377\271&\000\377\267\032\000\377\267\033\000"
-  "\377\271)\000\377\277B\000\377\313a\000\377\334\203\000\377\354\234\000\377\365\252"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\254\000\377\365\253\000\377\363\250\000\377\357\241\000\377\345"
-  "\221\000\377\324u\000\377\303L\000\377\267\024\000\377\262\000\000\377\264\000\004\377\277"
-  "]V\377\322\234\221\377\345\312\274\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\324\242\226\377\300"
-  "bZ\377\265\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377\331}\000\377\353\234"
-  "\000\377\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\364\251\000\377\352\232\000\377\332\177\000\377\311"
-  "^\000\377\277@\000\377\271)\000\377\267\031\000\377\265\000\000\377\263\000\000\377\266\014"
-  "\000\377\301G\000\377\324u\000\377\347\225\000\377\363\247\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\365\253\000\377\363\250\000\377\357\242\000\377\347\224\000\377\331}\000\377\314"
-  "e\000\377\314d\000\377\332\200\000\377\352\232\000\377\364\250\000\377\365\253\000\377"
-  "\362\246\000\377\352\232\000\377\335\204\000\377\313a\000\377\273\062\000\377\264\000"
-  "\000\377\264\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\270\036\000\377\304P"
-  "\000\377\326w\000\377\346\223\000\377\357\242\000\377\364\250\000\377\366\253\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000"
-  "\377\352\232\000\377\326y\000\377\305S\000\377\305S\000\377\326y\000\377\352\232\000"
-  "\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\366\254\000\377\360\243\000\377\342\214\000\377\316h\000\377\274\067\000\377\263\000"
-  "\000\377\262\000\000\377\270$\000\377\306U\000\377\330{\000\377\347\225\000\377\360\243"
-  "\000\377\364\251\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\345"
-  "\222\000\377\321n\000\377\302L\000\377\310Z\000\377\333\201\000\377\354\236\000\377\365"
-  "\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377"
-  "\365\252\000\377\362\246\000\377\360\242\000\377\357\241\000\377\357\242\000\377\355"
-  "\236\000\377\344\221\000\377\325v\000\377\304P\000\377\272*\000\377\267\024\000\377\267"
-  "\033\000\377\270\036\000\377\270\036\000\377\270\036\000\377\270\036\000\377\270\036\000\377"
-  "\270\036\000\377\270\036\000\377\267\026\000\377\267\026\000\377\274\065\000\377\312^\000"
-  "\377\333\200\000\377\351\230\000\377\361\244\000\377\364\251\000\377\366\253\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\370\256\000\377\362\246\000\377\344\221\000\377\320l\000\377\275;\000\377\264"
-  "\000\000\377\262\000\000\377\271\070\063\377\310\177u\377\335\267\252\377\356\335\315"
-  "f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\334"
-  "\266\251\377\307{r\377\267,)\377\262\000\000\377\263\000\000\377\272+\000\377\304Q"
-  "\001\377\321o\001\377\335\204\000\377\346\224\000\377\357\241\000\377\364\251\000\377"
-  "\367\255\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\360\242\000\377\337\210\000\377\312_\000\377\271'\000\377\262"
-  "\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\266\022\000\377\300"
-  "D\000\377\315g\000\377\330|\000\377\335\205\000\377\336\206\000\377\337\207\000\377\343"
-  "\217\000\377\353\233\000\377\362\246\000\377\366\254\000\377\367\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\371\257\000\377\365\252\000\377"
-  "\350\226\000\377\323r\000\377\303L\000\377\306V\000\377\331~\000\377\354\235\000\377"
-  "\366\254\000\377\371\257\000\377\367\255\000\377\363\250\000\377\355\236\000\377\345"
-  "\221\000\377\333\200\000\377\317i\001\377\302J\000\377\270!\000\377\264\000\000\377\263"
-  "\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\267\033\000\377\301F\000\377\315"
-  "f\001\377\331~\000\377\344\217\000\377\354\235\000\377\363\247\000\377\367\254\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\256"
-  "\000\377\365\252\000\377\355\237\000\377\343\216\000\377\332\177\000\377\327z\000\377"
-  "\331}\000\377\335\205\000\377\344\220\000\377\354\234\000\377\363\247\000\377\366\254"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\363\250\000\377\353\233\000\377\340\212\000\377\325v\000\377\312_\000\377\300"
-  "D\000\377\270$\000\377\264\000\000\377\263\000\000\377\271(\000\377\311\\\000\377\335\205"
-  "\000\377\356\240\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316"
-  "i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\355\237\000\377\345\222\000"
-  "\377\333\201\000\377\317j\000\377\302L\000\377\270$\000\377\263\000\000\377\262\000\000\377"
-  "\271)\000\377\313a\000\377\340\212\000\377\361\244\000\377\370\256\000\377\371\257"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\371\257\000\377\370\256\000\377"
-  "\361\245\000\377\340\212\000\377\313a\000\377\300D\000\377\314c\000\377\341\214\000\377"
-  "\362\246\000\377\370\257\000\377\371\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\254\000\377\363\247"
-  "\000\377\354\235\000\377\344\220\000\377\337\210\000\377\335\205\000\377\336\205\000"
-  "\377\336\206\000\377\336\207\000\377\336\207\000\377\333\200\000\377\321o\000\377\304"
-  "P\000\377\270$\000\377\263\000\000\377\262\000\000\377\265\000\000\377\274\067\000\377\307W"
-  "\000\377\320k\000\377\324t\000\377\324t\000\377\324u\000\377\332\200\000\377\345\222"
-  "\000\377\360\243\000\377\366\254\000\377\370\257\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\256\000\377"
-  "\365\252\000\377\356\240\000\377\344\220\000\377\330}\000\377\315f\000\377\302J\000\377"
-  "\272.\000\377\273\061\000\377\303N\000\377\317j\000\377\332\200\000\377\346\223\000\377"
-  "\360\242\000\377\366\253\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\256\000\377\366\254\000\377\362\245\000\377\352\233\000"
-  "\377\341\214\000\377\327z\000\377\312`\001\377\276>\000\377\266\003\000\377\262\000\000\377"
-  "\264\000\000\377\277[T\377\323\237\223\377\347\317\300\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\324\242"
-  "\226\377\300bZ\377\265\005\016\377\262\000\000\377\267\025\000\377\305R\000\377\331~"
-  "\000\377\354\235\000\377\366\254\000\377\371\257\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\256\000\377\365\252\000\377\357\241\000\377\344"
-  "\221\000\377\331}\000\377\316h\000\377\304O\000\377\273\061\000\377\265\000\000\377\262"
-  "\000\000\377\265\000\000\377\301F\000\377\325w\000\377\351\231\000\377\365\252\000\377\371"
-  "\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\366\254\000\377\362\245\000\377\352\232\000\377\342\216\000\377\334\204\000\377"
-  "\330|\000\377\327z\000\377\333\201\000\377\345\222\000\377\357\241\000\377\362\246"
-  "\000\377\357\241\000\377\346\224\000\377\334\203\000\377\320m\001\377\304O\001\377\271"
-  "'\000\377\264\000\000\377\263\000\000\377\264\000\000\377\263\000\000\377\263\000\000\377\267\023"
-  "\000\377\277A\000\377\313b\001\377\330{\000\377\342\215\000\377\353\233\000\377\362\246"
-  "\000\377\366\254\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365"
-  "\252\000\377\352\231\000\377\326w\000\377\304P\000\377\304Q\000\377\326y\000\377\353"
-  "\233\000\377\366\253\000\377\371\257\000\377\370\256\000\377\367\255\000\377\370\257"
-  "\000\377\370\257\000\377\363\247\000\377\344\220\000\377\317i\000\377\274\064\000\377"
-  "\263\000\000\377\262\000\000\377\267\033\000\377\300E\000\377\315f\000\377\331~\000\377\343"
-  "\217\000\377\354\235\000\377\363\247\000\377\366\254\000\377\367\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377"
-  "\345\222\000\377\320l\000\377\302I\000\377\310[\000\377\335\204\000\377\360\242\000\377"
-  "\370\256\000\377\371\260\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\255\000\377\365\253\000"
-  "\377\360\243\000\377\350\227\000\377\341\214\000\377\336\207\000\377\336\206\000\377"
-  "\335\204\000\377\326w\000\377\312^\001\377\275\070\000\377\264\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\261\000\000\377\261\000\000\377\265\000\000\377\277>\000\377\315"
-  "e\000\377\332\177\000\377\345\221\000\377\356\237\001\377\364\251\000\377\370\256\000"
-  "\377\371\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377"
-  "\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\371\260\000\377\371"
-  "\257\000\377\363\250\000\377\345\222\000\377\320m\000\377\276<\000\377\264\000\000\377"
-  "\262\000\000\377\271\070\063\377\310\177u\377\335\267\252\377\356\335\315f\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\267"
-  "\252\377\310\177u\377\271\070\063\377\263\000\000\377\264\000\000\377\267\034\000\377"
-  "\274\064\000\377\302K\000\377\314c\000\377\331~\000\377\350\226\000\377\362\246\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\360\242\000\377\337\211\000\377\313`\000\377\272+\000\377\263"
-  "\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\265\007\000\377\272"
-  "-\000\377\301F\000\377\306V\000\377\311\\\000\377\310\\\000\377\313`\000\377\323r\000\377"
-  "\341\213\000\377\356\240\000\377\366\253\000\377\370\256\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\370\257\000\377\364\251\000\377\347\226\000"
-  "\377\323r\000\377\303M\000\377\307W\000\377\332\177\000\377\354\236\000\377\366\254"
-  "\000\377\371\260\000\377\367\255\000\377\361\244\000\377\345\221\000\377\326x\000\377"
-  "\311^\000\377\301F\000\377\273/\000\377\267\025\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\266\022\000\377\272-\000\377\300C\000\377\310["
-  "\000\377\324u\000\377\343\217\000\377\360\242\000\377\366\254\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253"
-  "\000\377\363\247\000\377\356\240\000\377\350\227\000\377\340\212\000\377\326x\000\377"
-  "\320l\000\377\325v\000\377\342\215\000\377\357\242\000\377\366\254\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\365\253\000"
-  "\377\362\246\000\377\355\236\000\377\345\222\000\377\330|\000\377\310[\000\377\273"
-  "\060\000\377\263\000\000\377\262\000\000\377\271(\000\377\311\\\000\377\335\205\000\377\356"
-  "\240\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302"
-  "K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\361\244\000\377\367\255\000\377\327y\000\377\312_\000\377"
-  "\301G\000\377\273\060\000\377\267\027\000\377\263\000\000\377\263\000\000\377\272/\000\377"
-  "\313b\000\377\340\212\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377"
-  "\340\212\000\377\314c\000\377\301I\000\377\315f\000\377\341\214\000\377\362\245\000\377"
-  "\370\256\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\366\254\000\377\360\243\000\377\343\217"
-  "\000\377\325v\000\377\313b\000\377\310[\000\377\311\\\000\377\311]\000\377\312^\000\377"
-  "\311^\000\377\307Y\000\377\303L\000\377\274\066\000\377\266\025\000\377\263\000\000\377\263"
-  "\000\000\377\267\030\000\377\302K\000\377\322q\000\377\340\212\000\377\347\225\000\377\350"
-  "\227\000\377\350\227\000\377\352\232\000\377\357\241\000\377\364\250\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\363\250\000\377"
-  "\357\241\000\377\350\227\000\377\335\204\000\377\315e\000\377\300E\000\377\302I\000\377"
-  "\317j\000\377\337\210\000\377\351\231\000\377\360\243\000\377\364\250\000\377\366\254"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\365\253\000\377\355\237\000\377\340\212\000\377\321o\000\377\306V"
-  "\000\377\276?\000\377\271'\000\377\265\000\000\377\263\000\000\377\265\006\010\377\300`X\377"
-  "\323\240\225\377\347\317\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\324\242\226\377\300bZ\377"
-  "\265\005\016\377\262\000\000\377\267\025\000\377\304Q\000\377\331}\000\377\353\234\000\377"
-  "\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\366\254\000\377\364\250\000\377\357\242\000\377\350\227\000"
-  "\377\336\206\000\377\316i\000\377\277B\000\377\266\012\000\377\262\000\000\377\266\012"
-  "\000\377\302I\000\377\326x\000\377\351\230\000\377\365\252\000\377\370\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\365\253\000"
-  "\377\355\237\000\377\340\211\000\377\323s\000\377\320m\000\377\327{\000\377\342\215"
-  "\000\377\352\231\000\377\360\243\000\377\364\250\000\377\361\244\000\377\347\225\000"
-  "\377\330|\000\377\313a\000\377\302I\000\377\273\062\000\377\267\032\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\266\015\000\377\271)\000\377"
-  "\277@\000\377\307X\000\377\322q\000\377\341\214\000\377\356\240\000\377\366\253\000\377"
-  "\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000\377\352\232\000"
-  "\377\326y\000\377\305S\000\377\305S\000\377\326y\000\377\352\232\000\377\365\252\000"
-  "\377\370\257\000\377\370\256\000\377\367\255\000\377\370\257\000\377\370\256\000\377"
-  "\362\246\000\377\344\220\000\377\317j\000\377\275\071\000\377\264\000\000\377\263\000\000"
-  "\377\266\020\000\377\272,\000\377\300C\000\377\310[\000\377\324u\000\377\343\216\000\377"
-  "\357\242\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\363\247\000\377\345\222\000\377\321n\000\377"
-  "\303M\000\377\311\\\000\377\334\204\000\377\357\241\000\377\367\255\000\377\370\257"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\353\233\000\377\335"
-  "\204\000\377\320l\000\377\311^\000\377\311\\\000\377\310[\000\377\305S\000\377\277@\000"
-  "\377\270$\000\377\265\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\266\011\000\377\272+\000\377\300D\000\377\311]\000\377\326x\000\377\344"
-  "\221\000\377\360\243\000\377\367\254\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\370\256\000\377\362\246\000\377\344\220\000\377"
-  "\320l\000\377\275;\000\377\264\000\000\377\262\000\000\377\271\070\063\377\310\177u\377"
-  "\335\267\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\340\277\262\377\316\222\210\377\300c[\377\271"
-  "=\071\377\267'#\377\266\030\021\377\265\000\000\377\267\030\000\377\277A\000\377\320"
-  "k\000\377\343\216\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\360\242\000\377\340"
-  "\211\000\377\313a\000\377\272.\000\377\264\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\004\000\377\266\022\000\377\270\036\000\377\271&\000\377\271"
-  "&\000\377\270!\000\377\273\062\000\377\307Y\000\377\332\200\000\377\354\234\000\377\365"
-  "\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\364\251\000\377\347\225\000\377\323r\000\377\303N\000\377\307"
-  "X\000\377\332\177\000\377\355\236\000\377\366\254\000\377\371\260\000\377\367\255\000"
-  "\377\357\241\000\377\337\210\000\377\313c\000\377\275\070\000\377\266\017\000\377\265"
-  "\003\000\377\266\034\027\377\270\066\062\377\273JE\377\275SL\377\274LF\377\271\071"
-  "\065\377\266\037\032\377\265\005\000\377\266\013\000\377\273\063\000\377\311^\000\377\335"
-  "\204\000\377\355\237\000\377\366\254\000\377\370\257\000\377\367\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\254\000\377\362\245\000\377\346\224\000\377\324t\000\377\306V\000\377\312_\000\377"
-  "\333\201\000\377\355\236\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\365\253"
-  "\000\377\357\242\000\377\341\213\000\377\316g\000\377\274\067\000\377\263\000\000\377\262"
-  "\000\000\377\271'\000\377\311\\\000\377\335\205\000\377\356\240\000\377\366\254\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256"
-  "\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210"
-  "\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\254\000\377"
-  "\357\242\000\377\340\211\000\377\314d\000\377\275:\000\377\266\023\000\377\265\004\000\377"
-  "\266\022\000\377\267\033\000\377\272-\000\377\302K\000\377\321o\000\377\343\216\000\377"
-  "\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254"
-  "\000\377\365\252\000\377\362\246\000\377\354\234\000\377\336\207\000\377\317j\000\377"
-  "\311\\\000\377\323r\000\377\344\221\000\377\362\246\000\377\367\255\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\257\000\377\366\254\000\377\356\240\000\377\335\205\000\377\312_\000\377\274"
-  "\070\000\377\270!\000\377\271%\000\377\271)\000\377\271*\000\377\271*\000\377\271'\000\377"
-  "\270!\000\377\267\026\000\377\265\010\000\377\264\000\000\377\264\000\000\377\270\"\000\377"
-  "\305R\000\377\326x\000\377\345\223\000\377\356\240\000\377\362\245\000\377\363\247"
-  "\000\377\364\251\000\377\366\253\000\377\366\254\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\362"
-  "\246\000\377\350\227\000\377\330{\000\377\313`\000\377\314c\000\377\332\200\000\377\352"
-  "\232\000\377\363\250\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377"
-  "\365\252\000\377\352\232\000\377\331}\000\377\306T\000\377\272+\000\377\265\003\000\377"
-  "\266\014\004\377\266!\035\377\270\061-\377\274PJ\377\307|r\377\330\254\240\377"
-  "\351\322\303\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\347\317\300\377\324\241\226\377\300bZ\377\265\005\014\377\262"
-  "\000\000\377\267\022\000\377\303L\000\377\325v\000\377\346\223\000\377\360\243\000\377\364"
-  "\251\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\366\254\000\377\362\246\000\377\347\226\000\377"
-  "\325v\000\377\302K\000\377\270\040\000\377\267\027\000\377\275\071\000\377\311\\\000\377"
-  "\332\177\000\377\353\233\000\377\365\252\000\377\370\256\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\352\232\000"
-  "\377\330|\000\377\310Z\000\377\310Z\000\377\327z\000\377\351\230\000\377\363\247\000"
-  "\377\367\256\000\377\367\255\000\377\360\243\000\377\342\214\000\377\316h\000\377\276"
-  ">\000\377\267\025\000\377\265\001\000\377\266\031\023\377\270\063/\377\273HC\377\275"
-  "RL\377\274NH\377\271<\070\377\267#\036\377\265\011\002\377\266\005\000\377\272.\000"
-  "\377\307X\000\377\332\177\000\377\353\234\000\377\365\253\000\377\370\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\370\256\000\377\365\253\000\377\354\234\000\377\333\201\000\377"
-  "\314c\000\377\312`\000\377\327z\000\377\346\224\000\377\360\243\000\377\364\251\000\377"
-  "\366\253\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\346"
-  "\223\000\377\324u\000\377\304Q\000\377\273\062\000\377\267\035\000\377\266\023\000\377\265"
-  "\005\000\377\266\014\000\377\273\063\000\377\311]\000\377\334\203\000\377\355\236\000\377"
-  "\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\364\250\000\377\350\226\000\377\326x\000\377\312^\000\377\315"
-  "e\000\377\333\201\000\377\352\231\000\377\361\245\000\377\365\252\000\377\366\254\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\256\000\377\363\250\000\377\347\225\000\377\325u\000\377\303L\000\377"
-  "\272*\000\377\270!\000\377\271'\000\377\270#\000\377\267\027\000\377\266\021\004\377\267"
-  "%!\377\271>\071\377\274PJ\377\276YR\377\277\\T\377\277[T\377\277[T\377\277"
-  "[T\377\277[T\377\277[T\377\277[T\377\277[T\377\276XQ\377\274NG\377\272?\065"
-  "\377\275?\034\377\311]\001\377\332\177\000\377\351\230\000\377\360\242\000\377\361"
-  "\245\000\377\361\244\000\377\360\243\000\377\360\243\000\377\360\243\000\377\360\243"
-  "\000\377\360\243\000\377\360\243\000\377\360\243\000\377\361\245\000\377\361\244\000"
-  "\377\354\235\000\377\337\210\000\377\315f\000\377\274\067\000\377\264\000\000\377\262"
-  "\000\000\377\271\067\063\377\310\177u\377\335\267\252\377\356\335\315f\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\320\301"
-  "\377\333\265\250\377\320\227\214\377\306xo\377\275TM\377\267'%\377\263\000"
-  "\000\377\263\000\000\377\272.\000\377\314d\000\377\341\213\000\377\361\244\000\377\367"
-  "\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000"
-  "\377\367\255\000\377\360\242\000\377\337\210\000\377\312_\000\377\271(\000\377\263"
-  "\000\000\377\263\000\000\377\265\000\000\377\265\001\000\377\265\001\000\377\265\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\262\000\000\377\266\014\000\377\303"
-  "N\000\377\331}\000\377\354\234\000\377\366\254\000\377\371\257\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000\377\347\225"
-  "\000\377\322q\000\377\302L\000\377\306W\000\377\332\177\000\377\355\237\000\377\367\255"
-  "\000\377\372\262\000\377\370\256\000\377\357\241\000\377\335\205\000\377\310Z\000\377"
-  "\270!\000\377\262\000\000\377\263\000\000\377\270\062.\377\300aZ\377\311\202x\377\315"
-  "\217\205\377\312\205{\377\301f^\377\271\070\063\377\264\000\000\377\262\000\000\377"
-  "\267\030\000\377\306U\000\377\333\201\000\377\355\237\000\377\367\255\000\377\371\260"
-  "\000\377\370\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\371\257\000\377\365\252\000\377\350\227\000\377\323"
-  "s\000\377\303M\000\377\306U\000\377\331}\000\377\354\235\000\377\366\253\000\377\370"
-  "\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\370\257\000\377\362\246\000\377\344\220\000\377\317i\000\377"
-  "\274\064\000\377\262\000\000\377\260\000\000\377\270\037\000\377\310Z\000\377\335\204\000\377"
-  "\356\240\000\377\366\254\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377"
-  "\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\257\000\377\367\254\000\377\357\241\000\377\336\206\000\377\311\\\000\377"
-  "\270$\000\377\262\000\000\377\263\000\000\377\270\037\000\377\276?\000\377\307Y\000\377\322"
-  "p\000\377\336\205\000\377\351\231\000\377\363\247\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\367\255\000\377\364\251\000\377\356\240\000\377\347\225\000\377\340"
-  "\212\000\377\332\200\000\377\326w\000\377\326y\000\377\337\210\000\377\352\232\000\377"
-  "\363\250\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\236"
-  "\000\377\333\202\000\377\306V\000\377\267\032\000\377\262\000\000\377\263\000\000\377\264"
-  "\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\267\035\000\377\301G\000\377\317i\000\377\334\203"
-  "\000\377\346\224\000\377\357\241\000\377\365\252\000\377\370\257\000\377\371\260\000"
-  "\377\370\257\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\257\000\377\366\254\000\377\357\241\000\377\343\217"
-  "\000\377\332\177\000\377\333\201\000\377\345\222\000\377\361\244\000\377\367\255\000"
-  "\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\365\253\000\377\352\232"
-  "\000\377\326y\000\377\302I\000\377\265\000\000\377\262\000\000\377\265\001\015\377\272A<\377"
-  "\302h`\377\313\211\177\377\326\247\233\377\342\304\266\377\355\334\314\252"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347"
-  "\317\300\377\323\240\224\377\277]V\377\264\000\000\377\262\000\000\377\266\001\000\377"
-  "\276?\000\377\314c\001\377\331}\000\377\343\217\000\377\354\234\000\377\362\246\000\377"
-  "\366\254\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\371\257\000\377\366\253\000\377\352\232\000\377\326y\000\377\303L\000\377\273"
-  "\062\000\377\300E\000\377\314c\000\377\327z\000\377\344\220\000\377\357\241\000\377\365"
-  "\253\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\371\257\000\377\366\253\000\377\352\232\000\377\326x\000\377\304P\000\377\305"
-  "S\000\377\327{\000\377\354\234\000\377\367\255\000\377\373\262\000\377\371\257\000\377"
-  "\361\244\000\377\340\212\000\377\313a\000\377\272*\000\377\262\000\000\377\263\000\000\377"
-  "\267+(\377\277\\T\377\310~u\377\315\217\204\377\313\207}\377\302kc\377\272"
-  "?:\377\264\000\010\377\262\000\000\377\266\010\000\377\303M\000\377\330|\000\377\353\234"
-  "\000\377\366\254\000\377\371\260\000\377\371\257\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\257\000\377\366"
-  "\253\000\377\357\242\000\377\344\220\000\377\331~\000\377\325w\000\377\330{\000\377\335"
-  "\205\000\377\344\220\000\377\353\233\000\377\362\245\000\377\366\253\000\377\370\256"
-  "\000\377\370\256\000\377\364\250\000\377\353\234\000\377\340\211\000\377\324s\000\377"
-  "\311\\\000\377\277A\000\377\270\036\000\377\263\000\000\377\261\000\000\377\266\024\000\377"
-  "\305S\000\377\332\177\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\365\252\000\377"
-  "\355\236\000\377\341\213\000\377\330{\000\377\325w\000\377\331}\000\377\337\210\000\377"
-  "\346\223\000\377\355\236\000\377\363\247\000\377\367\254\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370\257\000\377\364\251\000"
-  "\377\347\225\000\377\322q\000\377\276>\000\377\264\000\000\377\262\000\001\377\263\000\000"
-  "\377\263\000\000\377\263\000\000\377\264\000\000\377\272>\071\377\303me\377\314\214\202"
-  "\377\322\234\220\377\323\240\225\377\323\240\224\377\323\237\223\377\323"
-  "\237\223\377\323\237\223\377\323\237\223\377\323\240\224\377\323\240\224"
-  "\377\321\232\217\377\312\207~\377\300e`\377\272@\067\377\300E\003\377\316f\000"
-  "\377\332\177\000\377\340\212\000\377\342\214\000\377\341\213\000\377\341\213\000\377"
-  "\341\213\000\377\341\213\000\377\341\213\000\377\341\213\000\377\341\213\000\377\341"
-  "\213\000\377\341\214\000\377\341\213\000\377\335\205\000\377\324t\001\377\306V\001\377"
-  "\272-\000\377\263\000\000\377\262\000\000\377\267-*\377\307|r\377\334\266\251\377\356"
-  "\334\315\210\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\352\325\305\314\341\301\263\377\323\240\225\377\304"
-  "ri\377\271\067\063\377\262\000\000\377\262\000\000\377\273/\000\377\314d\000\377\341\213"
-  "\000\377\361\244\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\360\242\000\377\337\211\000\377\313"
-  "a\000\377\272,\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\001"
-  "\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\262\000"
-  "\000\377\266\017\000\377\303N\000\377\330|\000\377\353\234\000\377\366\253\000\377\370"
-  "\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\364\251\000\377\347\225\000\377\323r\000\377\303M\000\377\307X\000\377\332\177"
-  "\000\377\355\236\000\377\367\255\000\377\372\261\000\377\367\255\000\377\357\241\000"
-  "\377\335\205\000\377\310Z\000\377\270\"\000\377\262\000\000\377\263\000\000\377\272D?\377"
-  "\310\201w\377\327\252\236\377\336\273\256\377\331\256\241\377\312\207}\377"
-  "\274LF\377\264\000\000\377\262\000\000\377\267\031\000\377\306U\000\377\333\201\000\377"
-  "\355\236\000\377\366\254\000\377\371\257\000\377\370\256\000\377\367\256\000\377\367"
-  "\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000"
-  "\377\365\252\000\377\350\227\000\377\323s\000\377\303M\000\377\306V\000\377\331}\000"
-  "\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370\256\000\377\362"
-  "\246\000\377\344\220\000\377\317j\000\377\274\067\000\377\263\000\000\377\261\000\000\377"
-  "\270$\000\377\310[\000\377\335\205\000\377\356\240\000\377\366\254\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377"
-  "\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377"
-  "\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\254\000\377\357\241"
-  "\000\377\336\206\000\377\311\\\000\377\271%\000\377\262\000\000\377\263\000\000\377\272,"
-  "\000\377\307W\000\377\326w\000\377\342\216\000\377\353\233\000\377\361\244\000\377\365"
-  "\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000"
-  "\377\346\223\000\377\331}\000\377\322p\000\377\325v\000\377\335\205\000\377\345\222"
-  "\000\377\354\234\000\377\361\245\000\377\365\253\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\257\000\377\366\254\000\377\355\237\000\377\333\202\000\377\306V\000\377\267\034"
-  "\000\377\262\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\266\022"
-  "\000\377\273\060\000\377\302I\000\377\313a\000\377\327y\000\377\345\221\000\377\360\244"
-  "\000\377\367\255\000\377\371\257\000\377\370\256\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\367"
-  "\255\000\377\363\250\000\377\356\237\000\377\351\231\000\377\352\231\000\377\356\241"
-  "\000\377\364\251\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370"
-  "\257\000\377\365\252\000\377\352\231\000\377\326y\000\377\302I\000\377\265\000\000\377"
-  "\261\000\000\377\265\016\024\377\276XQ\377\314\215\202\377\333\264\247\377\346"
-  "\315\276\377\356\334\314\252\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\317\300\377\323\241\225\377\300"
-  "`X\377\265\000\000\377\262\000\000\377\265\000\000\377\272*\000\377\300C\000\377\310[\000\377"
-  "\323s\000\377\341\213\000\377\355\237\000\377\365\252\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\253\000\377"
-  "\352\232\000\377\326x\000\377\304P\000\377\300F\000\377\314d\000\377\334\203\000\377"
-  "\347\225\000\377\356\240\000\377\363\247\000\377\366\254\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000"
-  "\377\352\231\000\377\326w\000\377\304P\000\377\305S\000\377\327z\000\377\353\234\000"
-  "\377\366\254\000\377\372\261\000\377\370\257\000\377\360\243\000\377\340\212\000\377"
-  "\313a\000\377\272+\000\377\262\000\000\377\263\000\000\377\271<\067\377\306yp\377\325"
-  "\246\232\377\336\273\255\377\332\261\244\377\315\215\203\377\275UN\377\265"
-  "\001\016\377\261\000\000\377\266\007\000\377\303M\000\377\330{\000\377\353\233\000\377\366"
-  "\253\000\377\371\257\000\377\370\256\000\377\367\256\000\377\367\256\000\377\367\256"
-  "\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000"
-  "\377\367\256\000\377\367\256\000\377\370\256\000\377\370\256\000\377\366\254\000\377"
-  "\363\250\000\377\356\241\000\377\350\227\000\377\341\214\000\377\331}\000\377\322q"
-  "\000\377\324u\000\377\340\211\000\377\355\236\000\377\365\252\000\377\370\256\000\377"
-  "\370\256\000\377\365\253\000\377\362\246\000\377\354\235\000\377\344\221\000\377\330"
-  "|\000\377\311]\000\377\273\062\000\377\263\000\000\377\261\000\000\377\267\027\000\377\305"
-  "S\000\377\332\200\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377\362"
-  "\246\000\377\355\236\000\377\347\224\000\377\337\210\000\377\326y\000\377\322p\000\377"
-  "\327y\000\377\343\217\000\377\357\242\000\377\366\254\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\364\250\000\377"
-  "\346\224\000\377\322q\000\377\276?\000\377\264\000\000\377\262\000\000\377\264\000\000\377"
-  "\264\000\000\377\263\000\000\377\265\016\017\377\276ZS\377\315\220\205\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\311\206}\377\275PI\377\272\060\004\377"
-  "\301C\000\377\310[\000\377\314c\000\377\315e\000\377\314d\000\377\314d\000\377\314d\000"
-  "\377\314d\000\377\314d\000\377\314d\000\377\314d\000\377\314d\000\377\315e\000\377\314"
-  "e\000\377\312`\000\377\305S\000\377\276<\000\377\270\036\000\377\264\000\000\377\263\000\000"
-  "\377\270\064/\377\307}t\377\334\267\252\377\356\335\315f\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354"
-  "\331\312D\335\267\252\377\311\203y\377\272@;\377\262\000\000\377\263\000\000\377"
-  "\273\063\000\377\315f\000\377\341\214\000\377\361\244\000\377\367\255\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377"
-  "\360\243\000\377\342\215\000\377\320l\000\377\300E\000\377\271&\000\377\266\024\000\377"
-  "\266\013\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\264\000\000\377\263\000\000\377\267\030\000\377\303L\000\377\325w\000\377\347"
-  "\225\000\377\361\244\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\370\256\000\377\364\251\000\377\351\230\000\377\327z\000\377\311"
-  "\\\000\377\313a\000\377\332\177\000\377\351\230\000\377\361\245\000\377\364\251\000\377"
-  "\362\245\000\377\352\231\000\377\332\177\000\377\307X\000\377\271%\000\377\262\000\000"
-  "\377\264\000\000\377\274OI\377\316\223\210\377\341\302\264\377\352\325\306\377"
-  "\343\305\267\377\321\231\216\377\276WP\377\264\000\000\377\262\000\000\377\270\035"
-  "\000\377\305R\000\377\330{\000\377\350\227\000\377\361\244\000\377\363\247\000\377\362"
-  "\246\000\377\362\246\000\377\362\246\000\377\362\246\000\377\362\246\000\377\362\245"
-  "\000\377\362\246\000\377\362\246\000\377\364\250\000\377\365\253\000\377\367\254\000"
-  "\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377\304"
-  "O\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\367\256\000\377\362\246\000\377\345\222\000\377\323s\000\377\303N\000\377\273"
-  "\061\000\377\272,\000\377\300D\000\377\316g\000\377\340\212\000\377\357\242\000\377\366"
-  "\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313"
-  "a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\367\254\000\377\357\241\000\377\336\207\000\377\312^\000\377\272*\000\377\262\000\000"
-  "\377\263\000\000\377\274\064\000\377\314d\000\377\340\211\000\377\356\240\000\377\364"
-  "\251\000\377\366\254\000\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\357\242\000\377\337\211\000\377\315g\000\377\306V\000\377\321"
-  "o\000\377\342\216\000\377\357\242\000\377\365\252\000\377\366\254\000\377\367\254\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377\334"
-  "\202\000\377\307X\000\377\270$\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\005\000\377\266\016\000\377\267\032\000\377\274\066\000\377\310"
-  "Z\000\377\331~\000\377\350\227\000\377\361\244\000\377\363\247\000\377\362\246\000\377"
-  "\363\247\000\377\364\251\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\364\250\000"
-  "\377\364\250\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\366\254\000\377\365\252\000\377\360\243\000\377\345\222\000\377\324s\000\377"
-  "\301H\000\377\266\004\000\377\262\000\000\377\266\027\031\377\301f^\377\324\241\226\377"
-  "\346\314\275\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\323\304\377\327\253\237"
-  "\377\306xo\377\273HC\377\267'$\377\266\034\030\377\266\020\004\377\266\021\000\377"
-  "\273\060\000\377\306V\000\377\331}\000\377\352\232\000\377\365\252\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365"
-  "\252\000\377\353\233\000\377\331~\000\377\312_\000\377\312^\000\377\330|\000\377\350"
-  "\227\000\377\362\246\000\377\366\253\000\377\366\254\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377"
-  "\361\244\000\377\345\223\000\377\323r\000\377\303N\000\377\304P\000\377\324t\000\377"
-  "\346\224\000\377\360\243\000\377\364\251\000\377\362\246\000\377\353\234\000\377\335"
-  "\204\000\377\312^\000\377\272-\000\377\263\000\000\377\263\000\000\377\273E@\377\314\212"
-  "\200\377\337\275\257\317\000\000\000\377\000\000\000\377\324\241\225\377\300aZ\377\265"
-  "\014\021\377\262\000\000\377\266\017\000\377\302L\000\377\325v\000\377\346\224\000\377\360"
-  "\243\000\377\363\247\000\377\362\246\000\377\362\246\000\377\362\246\000\377\362\246"
-  "\000\377\362\246\000\377\362\246\000\377\362\246\000\377\362\246\000\377\362\245\000"
-  "\377\362\245\000\377\362\246\000\377\363\250\000\377\365\252\000\377\366\254\000\377"
-  "\366\254\000\377\366\253\000\377\363\247\000\377\352\231\000\377\331~\000\377\312_"
-  "\000\377\310Z\000\377\327y\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370"
-  "\256\000\377\367\254\000\377\366\254\000\377\365\252\000\377\360\243\000\377\344\221"
-  "\000\377\324t\000\377\304P\000\377\272+\000\377\265\005\000\377\271&\000\377\306V\000\377"
-  "\332\200\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000"
-  "\377\365\253\000\377\361\244\000\377\346\223\000\377\325u\000\377\307Y\000\377\313"
-  "a\000\377\334\202\000\377\355\236\000\377\366\253\000\377\370\256\000\377\367\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\254\000\377\366\254\000\377\364\251\000\377\357\241\000\377\342"
-  "\215\000\377\320l\000\377\276>\000\377\265\000\000\377\263\000\000\377\265\004\007\377\266"
-  "\035\032\377\270.*\377\274NH\377\306yp\377\325\246\232\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\316\222\207\377\276WP\377\267\031\005\377\267"
-  "\011\000\377\272+\000\377\273\061\000\377\273\062\000\377\273\062\000\377\273\061\000\377"
-  "\273\061\000\377\273\061\000\377\273\061\000\377\273\061\000\377\273\061\000\377\273\061"
-  "\000\377\273\062\000\377\273\062\000\377\273/\000\377\271&\000\377\267\032\000\377\266\027"
-  "\016\377\266\036\033\377\270\063/\377\277[T\377\315\216\204\377\337\276\260\377"
-  "\357\337\317\"\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\340\277\261\377\313\211\177\377"
-  "\272C>\377\262\000\000\377\263\000\000\377\273\063\000\377\315f\000\377\341\214\000\377"
-  "\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\362\246\000\377\350\227\000\377\333\202\000"
-  "\377\317j\000\377\305S\000\377\275:\000\377\267\035\000\377\265\000\001\377\265\000\001\377"
-  "\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377"
-  "\266\016\000\377\277A\000\377\315f\001\377\333\201\000\377\345\223\000\377\355\237\000"
-  "\377\363\247\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\365"
-  "\252\000\377\355\236\000\377\340\213\000\377\326x\000\377\324t\000\377\331~\000\377\340"
-  "\211\000\377\343\217\000\377\345\221\000\377\343\217\000\377\335\205\000\377\321n\001"
-  "\377\302K\000\377\267\033\000\377\262\000\000\377\263\000\000\377\274MG\377\320\227\214"
-  "\377\344\311\273\377\356\335\316f\346\315\276\377\322\236\222\377\276VP\377"
-  "\263\000\000\377\262\000\000\377\267\022\000\377\301F\000\377\317k\001\377\334\203\000\377"
-  "\343\216\000\377\344\221\000\377\344\220\000\377\343\217\000\377\343\217\000\377\343"
-  "\217\000\377\343\217\000\377\343\217\000\377\343\217\000\377\345\223\000\377\352\232"
-  "\000\377\361\244\000\377\365\252\000\377\370\256\000\377\370\257\000\377\364\251\000"
-  "\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235\000"
-  "\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\364\250\000\377\352"
-  "\232\000\377\336\206\000\377\323r\000\377\316g\000\377\315f\000\377\321n\000\377\332"
-  "\177\000\377\347\224\000\377\361\245\000\377\367\254\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377"
-  "\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\257\000\377\367\254\000\377\357\241\000\377\336\207"
-  "\000\377\312^\000\377\271)\000\377\262\000\000\377\262\000\000\377\273\063\000\377\316h\000"
-  "\377\343\216\000\377\362\246\000\377\370\256\000\377\370\257\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\256\000\377\371\257\000\377\367\255\000\377\357\242\000\377\335\205"
-  "\000\377\311]\000\377\302J\000\377\320k\000\377\344\221\000\377\363\247\000\377\370\257"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377"
-  "\366\254\000\377\355\237\000\377\334\202\000\377\307X\000\377\270$\000\377\263\000\000"
-  "\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\263\000\000"
-  "\377\262\000\000\377\264\000\000\377\276=\000\377\315e\000\377\332\177\000\377\341\214"
-  "\000\377\343\216\000\377\343\217\000\377\346\223\000\377\354\234\000\377\362\246\000"
-  "\377\367\254\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\367\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\366\253\000\377\362\246\000\377\354\236\000\377\345"
-  "\221\000\377\332\177\000\377\314c\001\377\276=\000\377\265\000\000\377\261\000\000\377\265"
-  "\001\005\377\301f_\377\326\247\233\377\351\324\305\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\355\333\313\314\341\301\263\377\324\242\226\377\311\203y\377\300b"
-  "[\377\272>\071\377\265\005\016\377\262\000\000\377\265\000\000\377\301G\000\377\325w\000"
-  "\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\256\000\377\370\256\000\377\366\253\000\377\356\240\000\377\342\214"
-  "\000\377\327{\000\377\330|\000\377\343\217\000\377\357\242\000\377\366\254\000\377\370"
-  "\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\366\254\000\377\362\246\000\377\355\236\000\377\345\222\000\377\332\177\000\377"
-  "\313b\000\377\300C\000\377\300D\000\377\314d\000\377\332\200\000\377\342\215\000\377"
-  "\345\222\000\377\344\220\000\377\336\207\000\377\323r\001\377\304Q\000\377\271$\000\377"
-  "\262\000\000\377\262\000\000\377\272B=\377\315\216\204\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\326\246\232\377\300bZ\377\264\000\000\377\261\000\000\377\266\000\000\377\277"
-  "@\000\377\315f\001\377\332\200\000\377\342\215\000\377\344\221\000\377\344\220\000\377"
-  "\343\217\000\377\343\217\000\377\343\217\000\377\343\217\000\377\343\217\000\377\343"
-  "\217\000\377\343\217\000\377\343\216\000\377\343\216\000\377\344\220\000\377\350\227"
-  "\000\377\356\240\000\377\364\251\000\377\367\256\000\377\371\260\000\377\366\254\000"
-  "\377\355\236\000\377\331~\000\377\306V\000\377\303M\000\377\323r\000\377\347\226\000"
-  "\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\365\252\000\377\355\236\000\377\340\212\000\377\323r\000\377\307Y"
-  "\000\377\275;\000\377\273\061\000\377\305T\000\377\332\177\000\377\354\235\000\377\366"
-  "\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000\377"
-  "\350\227\000\377\324t\000\377\303N\000\377\306U\000\377\331}\000\377\354\235\000\377"
-  "\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\365\253\000\377\361\245"
-  "\000\377\353\234\000\377\343\216\000\377\327z\000\377\311\\\001\377\274\064\000\377\264"
-  "\000\000\377\263\000\000\377\265\000\000\377\272A<\377\302jb\377\313\211\177\377\323"
-  "\237\223\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\330\254\240"
-  "f\312\205{\377\274NH\377\265\001\004\377\263\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\267%\"\377\274NH\377\304qh\377\315\220\206\377\331"
-  "\257\243\377\346\315\277\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\340\277"
-  "\262\377\313\211\177\377\272C>\377\262\000\000\377\263\000\000\377\273\063\000\377\315"
-  "f\000\377\341\214\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\367\255\000\377\365\251\000\377\360"
-  "\243\000\377\351\230\000\377\340\212\000\377\324t\000\377\305T\000\377\272+\000\377\265"
-  "\000\000\377\264\000\001\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\264"
-  "\000\000\377\264\000\000\377\265\005\000\377\272-\000\377\301I\001\377\313`\000\377\325w\000"
-  "\377\342\216\000\377\356\240\000\377\365\252\000\377\370\256\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\253\000\377\362\246\000\377\354\235\000\377\345\222\000\377\337\210"
-  "\000\377\330|\000\377\323r\000\377\320l\000\377\317k\000\377\317j\000\377\313b\000\377"
-  "\304Q\001\377\274\066\000\377\266\017\000\377\262\000\000\377\263\000\000\377\274NH\377\320"
-  "\230\214\377\345\311\273\377\356\336\316D\346\315\277\377\323\237\223\377"
-  "\276WP\377\264\000\000\377\262\000\000\377\266\004\000\377\273\063\000\377\303N\001\377\313"
-  "a\000\377\317j\000\377\320l\000\377\317k\000\377\317k\000\377\317k\000\377\317k\000\377"
-  "\317k\000\377\316i\000\377\317j\000\377\323s\000\377\336\206\000\377\352\232\000\377"
-  "\364\250\000\377\370\256\000\377\371\257\000\377\364\251\000\377\350\226\000\377\324"
-  "s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370"
-  "\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\365\252\000\377\360\243\000\377\352\232\000"
-  "\377\345\222\000\377\342\216\000\377\342\215\000\377\344\220\000\377\350\227\000\377"
-  "\356\241\000\377\364\251\000\377\367\255\000\377\367\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000"
-  "\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\257\000\377\367\254\000\377\357\241\000\377\336\207\000\377"
-  "\312^\000\377\271)\000\377\262\000\000\377\262\000\000\377\273\063\000\377\316h\000\377\343"
-  "\217\000\377\362\246\000\377\370\256\000\377\370\257\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\371\257\000\377\367\255\000\377\357\242\000\377\335\205\000\377"
-  "\311]\000\377\302I\000\377\320k\000\377\344\221\000\377\363\250\000\377\370\257\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254"
-  "\000\377\355\237\000\377\334\202\000\377\307X\000\377\270$\000\377\263\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\262"
-  "\000\000\377\264\000\000\377\271&\000\377\301H\000\377\311]\000\377\315g\000\377\316h\000\377"
-  "\317j\000\377\325u\000\377\341\213\000\377\355\237\000\377\365\253\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\365\252\000\377\355\236\000\377\341\214\000\377\324u\000\377\312^\000\377\301"
-  "F\001\377\272*\000\377\265\000\000\377\262\000\000\377\265\007\011\377\301g_\377\326\247"
-  "\233\377\352\324\305\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\332\312"
-  "\356\344\311\272\377\331\260\243\377\313\212\200\377\276WQ\377\265\021\026"
-  "\377\261\000\000\377\265\000\000\377\301G\000\377\325v\000\377\351\230\000\377\364\251"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\366\254\000\377\362\246\000\377\354\235\000\377\347\225\000\377\347"
-  "\226\000\377\355\236\000\377\363\250\000\377\367\255\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\365\252\000\377"
-  "\355\237\000\377\342\214\000\377\325v\000\377\312_\000\377\300E\000\377\272/\000\377"
-  "\273\061\000\377\302J\000\377\312_\000\377\317i\000\377\320m\000\377\317k\000\377\314"
-  "d\000\377\305T\001\377\275;\000\377\267\027\000\377\263\000\000\377\263\000\000\377\272C="
-  "\377\315\216\204\377\000\000\000\377\000\000\000\377\000\000\000\377\326\247\233\377\300b["
-  "\377\265\000\000\377\262\000\000\377\265\000\000\377\272.\000\377\302K\001\377\312_\000\377"
-  "\316i\000\377\320l\000\377\317k\000\377\317k\000\377\317k\000\377\317k\000\377\317k\000"
-  "\377\317k\000\377\317k\000\377\317j\000\377\316i\000\377\316h\000\377\321n\000\377\332"
-  "\177\000\377\347\224\000\377\361\245\000\377\367\255\000\377\371\260\000\377\367\255"
-  "\000\377\355\236\000\377\331~\000\377\306V\000\377\303M\000\377\323r\000\377\347\225"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\366\254\000\377\362\246\000\377\354\235\000\377\343\217\000\377"
-  "\327z\000\377\310[\000\377\277@\000\377\306U\000\377\331~\000\377\354\235\000\377\366"
-  "\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\365\252\000\377"
-  "\350\227\000\377\324t\000\377\303M\000\377\306U\000\377\330}\000\377\354\234\000\377"
-  "\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\364\250\000\377\353\233"
-  "\000\377\337\207\000\377\322p\000\377\310Z\000\377\277A\001\377\271$\000\377\264\000\000"
-  "\377\263\000\000\377\266\027\025\377\300_X\377\317\223\210\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\325\246\232\377\321\233\217\377\320\227\214\377\320\230\215"
-  "\377\320\230\215\377\320\230\215\377\320\230\215\377\320\230\215\377\321"
-  "\231\216\377\321\231\216\377\317\224\211\377\311\202y\377\301d\\\377\271"
-  "\071\064\377\265\000\002\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264"
-  "\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264"
-  "\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\264"
-  "\000\000\377\270\065\061\377\303nf\377\321\233\220\377\336\274\256\377\350\320"
-  "\302\377\357\337\317\"\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\337\276\260"
-  "\377\313\210~\377\272C=\377\262\000\000\377\263\000\000\377\273\063\000\377\315f\000\377"
-  "\341\214\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\366\253\000"
-  "\377\363\250\000\377\355\236\000\377\336\207\000\377\314c\000\377\273\063\000\377\264"
-  "\000\000\377\264\000\000\377\265\012\012\377\267#\040\377\270\065\061\377\272>\071\377"
-  "\271<\067\377\270/,\377\266\034\030\377\266\024\003\377\267\033\000\377\274\066\000\377"
-  "\307Y\000\377\331~\000\377\352\232\000\377\365\252\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\361\244\000\377"
-  "\347\225\000\377\330{\000\377\310Z\000\377\276>\000\377\274\065\000\377\274\067\000\377"
-  "\274\064\000\377\271)\000\377\267\032\000\377\266\027\021\377\266\026\025\377\270\065"
-  "\061\377\301g_\377\323\240\225\377\346\314\275\377\356\336\316D\347\317\300"
-  "\377\326\246\232\377\303me\377\271;\066\377\266\030\027\377\266\027\022\377\267"
-  "\031\001\377\271'\000\377\273\063\000\377\275\071\000\377\275:\000\377\275\071\000\377\275"
-  "\071\000\377\275\071\000\377\275\071\000\377\275\071\000\377\274\064\000\377\274\067\000\377"
-  "\303O\000\377\323s\000\377\345\222\000\377\362\246\000\377\370\257\000\377\371\260"
-  "\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~"
-  "\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\254\000\377\365\252\000\377\363\250\000\377\362\246\000\377\361\245\000\377\361"
-  "\245\000\377\362\245\000\377\363\247\000\377\365\252\000\377\366\254\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\254"
-  "\000\377\357\241\000\377\336\207\000\377\312^\000\377\272-\000\377\264\000\000\377\267"
-  "\033\000\377\301F\000\377\321o\000\377\344\221\000\377\362\245\000\377\367\255\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\366\254\000\377\364\250"
-  "\000\377\354\234\000\377\333\200\000\377\310[\000\377\302K\000\377\320l\000\377\344\221"
-  "\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377\334\202\000\377\307"
-  "X\000\377\270$\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\006\000\377\267\026\000\377\270$"
-  "\000\377\272,\000\377\273/\000\377\273/\000\377\273\061\000\377\274\066\000\377\276?\000"
-  "\377\301F\000\377\302J\000\377\301H\000\377\303L\000\377\312_\000\377\330|\000\377\347"
-  "\225\000\377\361\244\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\364\251\000\377\351\230\000\377\327{\000\377"
-  "\306U\000\377\273\063\000\377\267\031\000\377\266\024\005\377\266\026\022\377\266\035\033"
-  "\377\272E?\377\306yp\377\331\256\241\377\352\325\306\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\313\274\377\324\241\225\377"
-  "\301g_\377\266\033\034\377\262\000\000\377\266\001\000\377\302J\000\377\326x\000\377\351"
-  "\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377\364\251\000\377"
-  "\363\247\000\377\363\247\000\377\364\251\000\377\366\253\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\364\251\000\377\351\231\000\377\330|\000\377\307W\000\377\274\064\000\377\267\033"
-  "\000\377\266\023\000\377\267\027\000\377\271&\000\377\273\062\000\377\275\070\000\377\275"
-  ":\000\377\275\071\000\377\274\065\000\377\272+\000\377\267\034\000\377\266\027\017\377\266"
-  "\025\023\377\270\060,\377\300_X\377\321\231\216\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\330\255\241\377\305um\377\272A<\377\266\033\031\377\266\026\022\377\267"
-  "\030\003\377\271%\000\377\273\062\000\377\275\070\000\377\275:\000\377\275:\000\377\275"
-  "\071\000\377\275\071\000\377\275\071\000\377\275\071\000\377\275\071\000\377\275\071\000\377"
-  "\275;\000\377\276<\000\377\277A\000\377\305R\000\377\322p\000\377\342\216\000\377\360"
-  "\243\000\377\367\255\000\377\371\260\000\377\366\254\000\377\354\235\000\377\331~\000"
-  "\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000"
-  "\377\366\254\000\377\364\251\000\377\360\242\000\377\344\221\000\377\323s\000\377\307"
-  "W\000\377\313`\000\377\334\202\000\377\355\236\000\377\366\253\000\377\370\256\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324t\000\377"
-  "\304P\000\377\307W\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\346\223\000\377\324t\000\377\303N\000\377"
-  "\272-\000\377\267\027\000\377\266\025\010\377\266\027\025\377\267&#\377\274LF\377"
-  "\307}s\377\330\254\237f\000\000\000\377\000\000\000\377\000\000\000\377\312\206|\377\277]V"
-  "\377\274MF\377\274OI\377\275RL\377\275RL\377\275RL\377\275RL\377\275SM\377"
-  "\275SM\377\274PI\377\273F@\377\270\064/\377\266\033\030\377\265\001\001\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\272?:\377\311\202"
-  "x\377\334\265\250\377\353\327\307\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\337\276\260\377\313\210~\377\272C=\377\262\000\000\377\263"
-  "\000\000\377\273\063\000\377\315f\000\377\341\214\000\377\361\244\000\377\367\255\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\370\256\000\377\362\245\000\377\343\216\000"
-  "\377\316h\000\377\274\066\000\377\264\000\000\377\263\000\000\377\266\040\035\377\274LF"
-  "\377\303me\377\310~t\377\306zq\377\300c[\377\271=\070\377\265\006\015\377\262"
-  "\000\000\377\265\004\000\377\301H\000\377\325w\000\377\351\230\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000"
-  "\377\365\252\000\377\352\232\000\377\327{\001\377\303M\000\377\266\013\000\377\262\000"
-  "\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\267(%\377\275QK\377"
-  "\305sj\377\317\224\211\377\335\270\253\377\352\325\306\377\000\000\000\377\353"
-  "\330\310\377\337\274\256\377\320\230\215\377\306wn\377\275UN\377\270.*\377"
-  "\264\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\265\000\001\377\264\000\000\377\264\000\000\377\263\000\000\377\263\000\000\377"
-  "\273\063\000\377\316h\000\377\343\216\000\377\362\245\000\377\370\257\000\377\371\260"
-  "\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~"
-  "\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\254"
-  "\000\377\357\241\000\377\335\205\000\377\311\\\000\377\273\063\000\377\273\061\000\377"
-  "\303M\000\377\316i\000\377\334\202\000\377\351\230\000\377\363\247\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\364\251\000\377\360\243\000\377"
-  "\352\232\000\377\341\213\000\377\322p\000\377\304O\000\377\301H\000\377\320m\000\377"
-  "\344\221\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377\333\202\000"
-  "\377\306V\000\377\267\035\000\377\262\000\000\377\263\000\000\377\264\000\000\377\264\000\000"
-  "\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\266\012\000\377\273\061"
-  "\000\377\302K\000\377\311\\\000\377\313b\000\377\314c\000\377\314c\000\377\313b\000\377"
-  "\313b\000\377\313b\000\377\313a\000\377\312`\000\377\313b\000\377\317j\000\377\326y\000"
-  "\377\337\210\000\377\347\224\000\377\355\236\000\377\362\246\000\377\366\253\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\257\000\377\364\251\000\377\350\226\000\377\324"
-  "s\000\377\300C\000\377\265\000\000\377\263\000\000\377\265\017\022\377\271=\070\377\277"
-  "_W\377\310\177u\377\323\237\224\377\341\301\263\377\355\334\314\252\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\325\306\377\327\252"
-  "\235\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x"
-  "\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\257\000\377\364\251\000\377\350\227\000\377\324u\000\377\300E\000\377\265\004\000"
-  "\377\263\000\000\377\265\000\000\377\265\000\000\377\265\000\001\377\265\000\000\377\264\000\000"
-  "\377\264\000\000\377\264\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\266!\036"
-  "\377\274LF\377\303nf\377\315\217\205\377\333\263\246\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\024\020\016\337\322\235\221\377\307|r\377\276ZS\377\270\064\060"
-  "\377\264\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000"
-  "\377\264\000\000\377\264\000\001\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000"
-  "\377\265\006\000\377\272.\000\377\301I\000\377\313b\000\377\330{\000\377\346\223\000\377"
-  "\361\244\000\377\367\255\000\377\371\260\000\377\366\254\000\377\354\235\000\377\331"
-  "~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\365\253\000\377\355\236\000\377\337\210\000"
-  "\377\325u\000\377\326y\000\377\343\216\000\377\357\242\000\377\366\254\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377"
-  "\324t\000\377\304P\000\377\307W\000\377\331~\000\377\354\235\000\377\366\253\000\377"
-  "\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\344\217\000\377\317j\000"
-  "\377\275\070\000\377\264\000\000\377\263\000\000\377\266\034\032\377\273F@\377\301g_\377"
-  "\311\203y\377\322\234\221\377\000\000\000\377\000\000\000\377\000\000\000\377\322\234\221\377"
-  "\302ia\377\267%\"\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263"
-  "\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\264"
-  "\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\272D>\377\313\211\177\377\340\300\262\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\337\276\260\377"
-  "\313\210~\377\272C=\377\262\000\000\377\263\000\000\377\273\063\000\377\315f\000\377\341"
-  "\214\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\370\256\000\377\362\246\000\377\343\217\000\377\316i\000\377\274\067\000\377\264\000"
-  "\000\377\263\000\000\377\270\060,\377\302kc\377\320\230\215\377\331\257\242\377"
-  "\327\251\235\377\313\212\200\377\276WP\377\265\021\026\377\261\000\000\377\264"
-  "\000\000\377\300E\000\377\325v\000\377\350\227\000\377\364\251\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\366\253"
-  "\000\377\353\233\000\377\327{\001\377\302K\000\377\265\000\000\377\261\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\263\000\000\377\272@;\377\306yp\377\324\242\226"
-  "\377\340\277\261\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000\000\377\352\325"
-  "\306\377\341\301\263\377\325\246\232\377\310~u\377\273HB\377\264\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377"
-  "\264\000\001\377\263\000\000\377\263\000\000\377\261\000\000\377\262\000\000\377\272.\000\377\315"
-  "f\000\377\342\216\000\377\362\245\000\377\370\257\000\377\371\260\000\377\364\251\000"
-  "\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235\000"
-  "\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362"
-  "\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360"
-  "\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\254\000\377\357\241\000"
-  "\377\335\205\000\377\311\\\000\377\276=\000\377\304Q\000\377\322q\000\377\337\210\000"
-  "\377\350\227\000\377\360\243\000\377\365\252\000\377\367\255\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\366\254\000\377\361\245\000\377\347\226\000\377\333\202\000\377\320l\000"
-  "\377\304Q\000\377\275\071\000\377\300D\000\377\321m\000\377\345\221\000\377\363\247"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\257\000\377\366\254\000\377\355\236\000\377\333\202\000\377\306V\000\377\267\032"
-  "\000\377\262\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\263\000\000\377\263\000\000\377\267\030\000\377\302I\000\377\320k\000\377\333\201"
-  "\000\377\340\212\000\377\341\213\000\377\340\212\000\377\340\211\000\377\337\211\000"
-  "\377\337\210\000\377\337\210\000\377\337\210\000\377\337\210\000\377\335\205\000\377"
-  "\331~\000\377\326x\000\377\330{\000\377\341\213\000\377\354\235\000\377\364\251\000\377"
-  "\367\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\257\000\377\370\257\000\377\364\251\000\377\350\226\000\377\323"
-  "s\000\377\277A\000\377\264\000\000\377\262\000\000\377\266\033\035\377\276ZS\377\313\212"
-  "\177\377\330\255\241\377\343\306\270\377\353\330\311\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\326\307\377\327\253"
-  "\236\377\303me\377\266\035\036\377\261\000\000\377\266\000\000\377\302J\000\377\326x"
-  "\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\371\257\000\377\365\252\000\377\350\227\000\377\324t\000\377\300C\000\377\264\000\000"
-  "\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\001\377\264\000\000\377\263\000\000"
-  "\377\263\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\270\066\062"
-  "\377\304ri\377\322\235\221\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\327\252\236\377\312\204{\377\275PJ\377"
-  "\264\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377"
-  "\263\000\000\377\264\000\001\377\264\000\001\377\263\000\000\377\262\000\000\377\262\000\000\377"
-  "\266\017\000\377\301F\000\377\317i\000\377\333\202\000\377\346\223\000\377\356\237\000"
-  "\377\364\250\000\377\367\255\000\377\371\257\000\377\366\253\000\377\354\235\000\377"
-  "\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\367\255\000\377\362\246\000\377\352\232"
-  "\000\377\345\222\000\377\346\223\000\377\354\235\000\377\363\247\000\377\367\254\000"
-  "\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226"
-  "\000\377\324t\000\377\304P\000\377\307W\000\377\331~\000\377\354\235\000\377\366\253"
-  "\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\217\000\377"
-  "\317i\000\377\274\065\000\377\263\000\000\377\262\000\000\377\267+(\377\301f^\377\317"
-  "\224\211\377\000\000\000\377\000\000\000\377\000\000\000\377\326\247\232\377\317\224\211\377"
-  "\305um\377\273JD\377\265\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\264\000\001\377\264\000\000\377\264"
-  "\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\001\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\272D?\377\314\213\200\377\341\301\263\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\337"
-  "\276\260\377\313\210~\377\272C=\377\262\000\000\377\263\000\000\377\273\063\000\377"
-  "\315f\000\377\341\214\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\367\256\000\377\361\245\000\377\342\216\000\377\316h\000\377\274\066"
-  "\000\377\263\000\000\377\262\000\000\377\271:\066\377\310\177v\377\333\263\246\377\000"
-  "\000\000\377\344\310\271\210\324\243\227\377\302h`\377\266\034\034\377\262\000\000"
-  "\377\265\000\000\377\301I\000\377\325w\000\377\351\230\000\377\364\251\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377"
-  "\365\252\000\377\352\232\000\377\327z\000\377\303N\003\377\267\"\024\377\265\034$\377"
-  "\267\060/\377\271\067\063\377\270\060,\377\271;\066\377\301f^\377\321\231\216"
-  "\377\341\302\264\377\355\334\314\210\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\356\336\316D\343\306\270\377\323\237\223\377\303lc\377\272"
-  "?:\377\270/+\377\271\067\063\377\270\064\060\377\267(%\377\266\030\026\377\265"
-  "\003\004\377\265\000\000\377\265\000\000\377\265\005\000\377\265\001\000\377\267\033\000\377\300"
-  "C\000\377\321o\000\377\344\221\000\377\362\246\000\377\370\257\000\377\371\260\000\377"
-  "\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377"
-  "\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256"
-  "\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210"
-  "\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\254\000\377"
-  "\357\242\000\377\337\207\000\377\314d\000\377\304Q\000\377\317j\000\377\340\212\000\377"
-  "\355\236\000\377\363\247\000\377\365\253\000\377\366\254\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\366\254\000\377\356\240\000\377\337\211\000\377\316h\000\377"
-  "\300E\000\377\270\"\000\377\267\030\000\377\277@\000\377\321n\000\377\345\222\000\377"
-  "\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\366\254\000\377\356\237\000\377\335\205\000\377\312_\000\377"
-  "\274\066\000\377\270\036\000\377\270\"\000\377\271'\000\377\271'\000\377\271'\000\377\271"
-  "'\000\377\270!\000\377\270!\000\377\275:\000\377\313a\000\377\334\203\000\377\352\231"
-  "\000\377\360\242\000\377\361\244\000\377\360\243\000\377\360\243\000\377\360\243\000"
-  "\377\360\243\000\377\360\243\000\377\361\244\000\377\360\242\000\377\352\231\000\377"
-  "\334\204\000\377\316h\000\377\312^\000\377\325v\000\377\346\224\000\377\363\247\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\366\254\000\377\361\245\000\377\345\222\000\377\322"
-  "p\000\377\277B\000\377\265\000\000\377\262\000\000\377\267%$\377\303ld\377\325\244\230"
-  "\377\345\313\275\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303"
-  "ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377"
-  "\362\245\000\377\345\223\000\377\323r\000\377\300D\000\377\266\011\000\377\263\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\001\377\266\022\021\377\267%\"\377"
-  "\270\062.\377\271\070\063\377\270\061-\377\271\067\063\377\277^W\377\316\222\210"
-  "\377\337\276\260\202\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\325\245\231\377\305sj\377\272D>\377\270/+\377"
-  "\270\066\062\377\270\065\061\377\267*'\377\266\032\030\377\265\005\006\377\265\000\000"
-  "\377\265\000\000\377\265\005\000\377\265\004\000\377\267\027\000\377\275;\000\377\314c\000\377"
-  "\335\204\000\377\353\233\000\377\362\245\000\377\365\252\000\377\366\254\000\377\367"
-  "\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377"
-  "\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\365\252\000\377\363\247\000\377\361\245\000\377"
-  "\362\245\000\377\363\250\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324t\000\377\304"
-  "P\000\377\307W\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317k\000\377\275\071\000\377"
-  "\263\000\000\377\262\000\000\377\270\065\061\377\307zq\377\331\260\243\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\312\206|\377\277\\U\377\271<\067\377\267&\"\377\266\023"
-  "\011\377\266\021\000\377\270\036\000\377\271%\000\377\271'\000\377\271'\000\377\271&\000"
-  "\377\271&\000\377\271&\000\377\271&\000\377\271'\000\377\271'\000\377\271'\000\377\271"
-  "(\000\377\271(\000\377\271'\000\377\270\"\000\377\267\032\000\377\266\015\000\377\265\002"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\272A<"
-  "\377\312\205{\377\336\272\254\377\355\334\314\210\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\337\276\260\377\313\210~\377\272C=\377"
-  "\262\000\000\377\263\000\000\377\273\063\000\377\315f\000\377\341\214\000\377\361\244\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245"
-  "\000\377\342\216\000\377\316h\000\377\274\066\000\377\263\000\000\377\262\000\000\377\272"
-  "?:\377\312\207}\377\337\276\260\377\000\000\000\377\000\000\000\377\330\255\241\377\303"
-  "nf\377\266\037\037\377\262\000\000\377\265\000\000\377\302I\000\377\325w\000\377\351\230"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\365\252\000\377\352\232\000\377\327y\000\377\304P"
-  "\016\377\273@\066\377\276ZV\377\304tl\377\310\200w\377\310\200v\377\311\202"
-  "x\377\317\225\212\377\334\267\251\377\352\326\307\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\356\336\272"
-  "\255\377\320\230\215\377\311\203z\377\310\200v\377\310\200w\377\306wn\377"
-  "\300aY\377\272?:\377\266\024\023\377\264\000\000\377\264\000\000\377\267\030\000\377\273"
-  "\063\000\377\302K\000\377\314d\000\377\332\200\000\377\351\230\000\377\363\247\000\377"
-  "\370\256\000\377\371\257\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O"
-  "\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377"
-  "\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\255\000\377\361\244\000\377\344\220\000\377\326x\000\377\321"
-  "o\000\377\333\201\000\377\351\231\000\377\364\250\000\377\367\256\000\377\370\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\356"
-  "\237\000\377\334\203\000\377\307X\000\377\270#\000\377\262\000\000\377\264\000\000\377\276"
-  ">\000\377\321n\000\377\345\222\000\377\363\247\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\366\254\000\377\360\242"
-  "\000\377\343\217\000\377\325u\000\377\313a\000\377\307Y\000\377\310Z\000\377\310\\\000"
-  "\377\310\\\000\377\310\\\000\377\310\\\000\377\310Z\000\377\310Z\000\377\314c\000\377"
-  "\327z\000\377\346\223\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\254\000\377\357\241\000\377\336\206\000\377\312_\000\377\302L\000\377\317"
-  "k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\366\253\000\377\363\247\000\377\357\241\000"
-  "\377\350\226\000\377\334\202\000\377\314d\000\377\275:\000\377\264\000\000\377\262\000"
-  "\000\377\266!\037\377\304qi\377\331\256\241\377\353\327\310\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\352\324\305\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377"
-  "\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\253\000\377\363\250\000\377\357\241\000\377\350\226\000\377\334\203\000\377\314"
-  "d\000\377\275:\000\377\265\000\000\377\263\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\011\007\377\270\065\061\377\276YR\377\304rj\377\310\177v\377\310\200"
-  "v\377\311\201w\377\316\221\206\377\332\262\245\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\340"
-  "\277\261K\322\235\221\377\312\205{\377\310\200v\377\310\201w\377\306yp\377"
-  "\301d]\377\272D?\377\266\033\031\377\264\000\000\377\264\000\000\377\266\023\000\377\273"
-  "/\000\377\301H\000\377\313a\000\377\330|\000\377\347\225\000\377\362\246\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253"
-  "\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377"
-  "\364\251\000\377\350\226\000\377\324s\000\377\303N\000\377\306V\000\377\331~\000\377"
-  "\354\235\000\377\366\254\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246"
-  "\000\377\344\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271\071"
-  "\065\377\311\203y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000\377\305sk"
-  "\377\267)%\377\263\000\000\377\264\000\000\377\270!\000\377\276<\000\377\303O\000\377\307"
-  "Y\000\377\311\\\000\377\311\\\000\377\310\\\000\377\310\\\000\377\310\\\000\377\310\\"
-  "\000\377\310\\\000\377\310\\\000\377\310\\\000\377\311\\\000\377\311\\\000\377\310Z\000"
-  "\377\304Q\000\377\277?\000\377\270$\000\377\265\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\271\071\065\377\305vm\377\325\246\232"
-  "\377\343\307\270\377\354\331\312\356\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\337\276\260\377\313\210~\377\272C=\377\262\000\000\377\263\000\000\377"
-  "\273\063\000\377\315f\000\377\341\214\000\377\361\244\000\377\367\255\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342\216\000\377\316"
-  "h\000\377\274\066\000\377\263\000\000\377\262\000\000\377\272?:\377\313\210~\377\340\300"
-  "\262\377\000\000\000\377\000\000\000\377\331\257\242\377\304og\377\266\037\037\377\261"
-  "\000\000\377\265\000\000\377\302I\000\377\325w\000\377\351\230\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\365\252\000\377\352\231\000\377\327x\000\377\304S\031\377\277[P\377\311\205"
-  "}\377\326\247\234\377\335\270\253\377\336\273\255\377\336\272\255\377\341"
-  "\301\263\377\350\321\302\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\323\304\377\341\303\265"
-  "\377\336\273\255\377\336\273\255\377\335\271\253\377\327\253\236\377\314"
-  "\214\201\377\277]V\377\266!\040\377\262\000\000\377\263\000\000\377\271)\000\377\304"
-  "Q\000\377\322o\000\377\335\205\000\377\347\225\000\377\357\241\000\377\365\252\000\377"
-  "\370\256\000\377\370\257\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O"
-  "\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377"
-  "\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\367\255\000\377\363\250\000\377\354\235\000\377\344\221\000\377"
-  "\342\215\000\377\347\226\000\377\360\243\000\377\366\254\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\367\255\000"
-  "\377\356\240\000\377\334\202\000\377\306V\000\377\267\030\000\377\261\000\000\377\263"
-  "\000\000\377\276=\000\377\321n\000\377\345\222\000\377\363\247\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\254"
-  "\000\377\363\247\000\377\354\234\000\377\344\220\000\377\336\207\000\377\335\204\000"
-  "\377\335\204\000\377\335\205\000\377\335\205\000\377\335\205\000\377\335\205\000\377"
-  "\335\204\000\377\335\204\000\377\337\210\000\377\345\222\000\377\356\237\000\377\365"
-  "\252\000\377\370\256\000\377\371\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\371\260\000\377\370\256\000\377\360\243\000"
-  "\377\336\206\000\377\311^\000\377\301H\000\377\316i\000\377\343\217\000\377\362\246"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\364\251\000\377\355\237\000\377\343\217\000\377\330{\000\377\315f\001\377\302"
-  "L\001\377\272+\000\377\264\000\000\377\262\000\000\377\266\031\027\377\304ph\377\331\257"
-  "\242\377\354\331\312\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303"
-  "ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\365\252\000\377\356\237\000\377\343\217\000\377"
-  "\330|\000\377\315f\000\377\302J\000\377\271&\000\377\264\000\000\377\263\000\000\377\265"
-  "\000\000\377\265\000\000\377\264\000\000\377\266\021\017\377\274OI\377\311\201x\377\325"
-  "\244\230\377\334\267\252\377\336\273\255\377\336\272\255\377\340\277\262"
-  "K\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\336\273\255\377\336\272"
-  "\255\377\335\272\254\377\331\256\241\377\316\221\206\377\301e]\377\267+)"
-  "\377\263\000\000\377\263\000\000\377\270\"\000\377\303L\000\377\320l\000\377\334\203\000"
-  "\377\346\224\000\377\357\241\000\377\365\252\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331"
-  "~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000"
-  "\377\323r\000\377\303L\000\377\306U\000\377\331~\000\377\355\236\000\377\367\254\000"
-  "\377\371\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317"
-  "k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271:\066\377\311\204z\377\337\275"
-  "\257\377\000\000\000\377\000\000\000\377\000\000\000\377\304pg\377\266\024\023\377\261\000\000\377"
-  "\264\000\000\377\273\063\000\377\307X\001\377\323s\001\377\333\201\000\377\336\206\000\377"
-  "\336\206\000\377\335\205\000\377\335\205\000\377\335\205\000\377\335\205\000\377\335"
-  "\205\000\377\335\205\000\377\335\205\000\377\335\205\000\377\336\206\000\377\334\203"
-  "\000\377\325w\000\377\311]\000\377\275\070\000\377\265\000\000\377\262\000\000\377\263\000\000"
-  "\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000"
-  "\377\263\000\000\377\263\000\000\377\264\000\000\377\267+(\377\276ZS\377\310\201w\377"
-  "\323\240\224\377\336\273\256\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\337\276\260\377\313\210~\377\272C=\377\262\000\000\377\263\000\000"
-  "\377\273\063\000\377\315f\000\377\341\214\000\377\361\244\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342\216\000\377"
-  "\316h\000\377\274\066\000\377\263\000\000\377\262\000\000\377\272?:\377\313\207}\377\340"
-  "\277\261\377\000\000\000\377\000\000\000\377\331\256\241\377\303of\377\266\037\037\377"
-  "\262\000\000\377\265\000\000\377\302I\000\377\325w\000\377\351\230\000\377\364\251\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256"
-  "\000\377\365\252\000\377\352\231\000\377\326v\000\377\305U\037\377\303i^\377\321\233"
-  "\222\377\341\303\265\377\353\327\310\377\356\335\315f\356\335\316f\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\356\335\316f\356\335\315"
-  "f\353\330\311\377\343\306\270\377\324\242\226\377\303me\377\270,'\377\264"
-  "\000\000\377\266\012\000\377\277B\000\377\317j\000\377\340\211\000\377\354\234\000\377\362"
-  "\246\000\377\365\252\000\377\366\254\000\377\370\256\000\377\370\257\000\377\364\251"
-  "\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235"
-  "\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377"
-  "\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377"
-  "\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253"
-  "\000\377\363\247\000\377\361\244\000\377\360\242\000\377\361\245\000\377\364\251\000"
-  "\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\365\252\000\377\354\234\000\377\332\200\000\377\306V\000"
-  "\377\270\040\000\377\262\000\000\377\264\000\000\377\276>\000\377\321n\000\377\345\222\000"
-  "\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\365\253\000\377\363\247\000\377\360\243"
-  "\000\377\356\241\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000"
-  "\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000\377\357\241\000\377"
-  "\361\244\000\377\364\250\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257"
-  "\000\377\367\255\000\377\357\242\000\377\336\206\000\377\312_\000\377\302K\000\377\317"
-  "k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\363\247\000\377\350\226\000\377\327{\000\377"
-  "\310Y\000\377\276=\000\377\271'\000\377\267\031\003\377\265\000\000\377\265\000\000\377\271"
-  "<\070\377\307zq\377\332\262\245\377\354\331\311\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324"
-  "\305\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377"
-  "\302J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\250\000"
-  "\377\350\227\000\377\330|\000\377\310[\000\377\277@\000\377\273\060\000\377\271'\000\377"
-  "\267\033\000\377\266\020\000\377\265\007\000\377\265\000\000\377\264\000\000\377\266\026\023"
-  "\377\277]V\377\320\226\213\377\340\277\261K\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\326\250\234\377\305um\377\271\066\061\377\264\000"
-  "\000\377\266\000\000\377\276<\000\377\315e\000\377\335\205\000\377\352\232\000\377\361"
-  "\245\000\377\365\251\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377"
-  "\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\227\000\377\325w\000"
-  "\377\306U\000\377\310Z\000\377\331}\000\377\353\233\000\377\364\251\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317k\000\377\275"
-  ":\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\274\256\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\304sj\377\267$\"\377\262\000\000\377\265\000\000\377"
-  "\277@\000\377\320k\000\377\341\213\000\377\353\234\000\377\357\241\000\377\357\241"
-  "\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000"
-  "\377\356\240\000\377\356\240\000\377\357\241\000\377\357\241\000\377\355\236\000\377"
-  "\344\220\000\377\325v\000\377\304P\000\377\271)\000\377\266\023\000\377\267\033\000\377"
-  "\270\037\000\377\270\037\000\377\270\037\000\377\270\037\000\377\270\037\000\377\270\037"
-  "\000\377\267\035\000\377\267\024\000\377\266\012\000\377\266\032\025\377\270\061,\377\273"
-  "JD\377\303md\377\320\230\215\377\341\302\264\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\337\276\260\377\313\210~\377\272C=\377\262\000\000\377\263\000\000"
-  "\377\273\063\000\377\315f\000\377\341\214\000\377\361\244\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342\216\000\377"
-  "\316h\000\377\274\066\000\377\263\000\000\377\262\000\000\377\272?:\377\313\207}\377\340"
-  "\276\261\377\000\000\000\377\000\000\000\377\330\255\241\377\303nf\377\266\037\037\377"
-  "\262\000\000\377\265\000\000\377\302I\000\377\325w\000\377\351\230\000\377\364\251\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256"
-  "\000\377\365\252\000\377\352\231\000\377\326v\000\377\304U\036\377\302g\\\377\317"
-  "\227\216\377\340\277\262\377\353\326\307\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354"
-  "\330\311\377\342\303\265\377\322\236\223\377\302jb\377\271\064&\377\272$\000"
-  "\377\301E\000\377\314c\000\377\333\200\000\377\351\231\000\377\363\250\000\377\367"
-  "\255\000\377\367\256\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251"
-  "\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235"
-  "\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377"
-  "\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377"
-  "\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\254\000\377\366\254\000\377\367\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\365"
-  "\252\000\377\362\246\000\377\354\236\000\377\343\217\000\377\324t\000\377\303N\000\377"
-  "\267\035\000\377\262\000\000\377\264\000\000\377\276>\000\377\321n\000\377\345\222\000\377"
-  "\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000"
-  "\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377"
-  "\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\367"
-  "\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000"
-  "\377\367\255\000\377\357\242\000\377\336\206\000\377\312_\000\377\302K\000\377\317"
-  "k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\370\256\000\377\363\247\000\377\345\222\000\377\321o\000\377"
-  "\277?\000\377\265\000\000\377\263\000\000\377\266\026\023\377\271\067\062\377\275SL\377"
-  "\304sj\377\321\231\216\377\340\300\262\377\356\335\315\210\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\352\324\305\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377\266"
-  "\000\000\377\302J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363"
-  "\247\000\377\345\222\000\377\321o\000\377\300D\000\377\272/\000\377\276=\000\377\303"
-  "L\000\377\302J\000\377\275:\000\377\270\037\000\377\265\000\000\377\263\000\000\377\265\023"
-  "\023\377\277[T\377\316\223\210\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\324\244\230\377\304rj\377\272:\060\377\271"
-  "!\000\377\277@\000\377\312_\000\377\330|\000\377\347\226\000\377\362\246\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377"
-  "\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\353\234\000\377\334\203"
-  "\000\377\320l\000\377\317j\000\377\331}\000\377\344\221\000\377\354\235\000\377\361\245"
-  "\000\377\365\252\000\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317k\000\377\275"
-  ":\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\273\256\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\305sj\377\267&$\377\262\000\000\377\265\000\000\377"
-  "\300E\000\377\324t\000\377\347\225\000\377\363\250\000\377\367\255\000\377\367\255"
-  "\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000"
-  "\377\366\254\000\377\366\254\000\377\367\255\000\377\367\255\000\377\365\252\000\377"
-  "\355\237\000\377\337\211\000\377\320m\000\377\307X\000\377\304Q\000\377\305S\000\377"
-  "\306T\000\377\306T\000\377\306T\000\377\306T\000\377\306U\000\377\306U\000\377\304Q\000"
-  "\377\300E\000\377\273\062\000\377\267\031\002\377\264\000\000\377\264\000\000\377\271>\071"
-  "\377\311\201w\377\335\270\253\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\337\276\260\377\313\210~\377\272C=\377\262\000\000\377\263\000\000\377\273\063\000"
-  "\377\315f\000\377\341\214\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\255\000\377\361\245\000\377\342\216\000\377\316h\000\377\274"
-  "\066\000\377\263\000\000\377\262\000\000\377\272?:\377\313\207}\377\340\276\261\377"
-  "\000\000\000\377\000\000\000\377\330\255\241\377\303nf\377\266\037\037\377\262\000\000\377"
-  "\265\000\000\377\302I\000\377\325w\000\377\351\230\000\377\364\251\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365"
-  "\252\000\377\352\231\000\377\327x\000\377\304S\027\377\276TJ\377\306zs\377\322\237"
-  "\224\377\336\273\255\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\325\306\377\337\276\260"
-  "\377\324\242\227\377\307~w\377\275TO\377\273\071\036\377\304M\000\377\321m\000"
-  "\377\334\204\000\377\347\225\000\377\360\243\000\377\366\254\000\377\370\257\000\377"
-  "\370\256\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350"
-  "\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\366"
-  "\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000"
-  "\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\366\254\000\377\361\245\000"
-  "\377\351\230\000\377\336\207\000\377\324s\000\377\310[\000\377\276<\000\377\266\024"
-  "\000\377\263\000\000\377\264\000\000\377\276>\000\377\321n\000\377\345\222\000\377\363\247"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\256\000"
-  "\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367"
-  "\255\000\377\357\242\000\377\336\206\000\377\312_\000\377\302K\000\377\317k\000\377\344"
-  "\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\370\257\000\377\363\250\000\377\345\222\000\377\320l\000\377\275\070\000"
-  "\377\263\000\000\377\262\000\000\377\266#\"\377\276ZS\377\312\204z\377\325\245\231"
-  "\377\340\277\261\377\352\324\305\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305"
-  "\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302"
-  "J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\344"
-  "\221\000\377\320l\000\377\277A\000\377\277A\000\377\312`\000\377\323s\000\377\322p\000"
-  "\377\310Y\000\377\273\063\000\377\264\000\000\377\262\000\000\377\265\005\016\377\273ID\377"
-  "\306wn\377\321\233\220\377\335\267\252\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\024\020"
-  "\016\337\326\247\233\377\311\204|\377\276ZU\377\273:&\377\302I\000\377\317i"
-  "\000\377\333\201\000\377\346\223\000\377\357\241\000\377\365\253\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377\307X"
-  "\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\256\000\377\366\253\000\377\360\243\000\377\347\226\000"
-  "\377\337\210\000\377\332\177\000\377\330|\000\377\331~\000\377\336\207\000\377\347"
-  "\226\000\377\360\244\000\377\366\253\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317k\000\377"
-  "\275:\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\273\256"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\305sj\377\267&$\377\262\000\000\377\265\000"
-  "\000\377\301F\000\377\325v\000\377\350\227\000\377\365\252\000\377\371\260\000\377\371"
-  "\260\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\370\257\000\377\371\257\000\377\367\255\000"
-  "\377\362\246\000\377\352\231\000\377\340\212\000\377\333\201\000\377\331~\000\377\332"
-  "\177\000\377\332\200\000\377\332\200\000\377\332\200\000\377\332\200\000\377\333\201"
-  "\000\377\332\200\000\377\327z\000\377\317j\001\377\303O\001\377\271(\000\377\263\000\000"
-  "\377\262\000\000\377\267+(\377\307{r\377\334\266\251\377\356\334\315\210\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\337\276\260\377\313\210~\377\272C=\377\262\000\000\377"
-  "\263\000\000\377\273\063\000\377\315f\000\377\341\214\000\377\361\244\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342"
-  "\216\000\377\316h\000\377\274\066\000\377\263\000\000\377\262\000\000\377\272?:\377\313"
-  "\207}\377\340\276\261\377\000\000\000\377\000\000\000\377\330\255\241\377\303nf\377\266"
-  "\037\037\377\262\000\000\377\265\000\000\377\302I\000\377\325w\000\377\351\230\000\377\364"
-  "\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\365\252\000\377\352\232\000\377\327z\000\377\303P\013\377\271"
-  "\066+\377\272ED\377\301ha\377\315\216\204\377\334\267\252\377\353\327\310"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\332\312"
-  "\314\336\273\256\377\317\223\210\377\303me\377\273LG\377\272:.\377\300G\020"
-  "\377\320k\000\377\340\211\000\377\353\234\000\377\361\245\000\377\365\252\000\377\366"
-  "\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256"
-  "\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~"
-  "\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\366"
-  "\253\000\377\355\237\000\377\337\210\000\377\317j\000\377\303M\000\377\274\066\000\377"
-  "\270\"\000\377\265\010\000\377\263\000\000\377\265\000\000\377\276>\000\377\321n\000\377\345"
-  "\222\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\357\242\000\377\336\206\000\377\312_\000\377\302K"
-  "\000\377\317k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\362\245\000\377\344\220\000\377"
-  "\320l\000\377\275:\000\377\264\000\000\377\262\000\000\377\270/,\377\304qh\377\325\245"
-  "\231\377\344\311\272\377\356\334\315\252\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\352\324\305\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377"
-  "\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377"
-  "\363\247\000\377\344\221\000\377\320l\000\377\301H\000\377\306U\000\377\327y\000\377"
-  "\343\217\000\377\341\213\000\377\323r\000\377\302J\000\377\267\034\000\377\264\000\000\377"
-  "\265\004\005\377\267,(\377\273FA\377\301e]\377\313\211\177\377\332\262\245\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\340\300\262'\321\231\216\377\304rj\377\274PK\377\272;\062\377\277C"
-  "\025\377\315f\000\377\336\205\000\377\352\232\000\377\361\244\000\377\364\251\000\377"
-  "\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235"
-  "\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377"
-  "\365\252\000\377\362\245\000\377\355\236\000\377\344\220\000\377\327z\000\377\316g"
-  "\000\377\320k\000\377\335\205\000\377\354\235\000\377\365\253\000\377\370\256\000\377"
-  "\367\256\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\344"
-  "\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271:\065\377\311"
-  "\203y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000\377\305sj\377\267&$\377"
-  "\262\000\000\377\265\000\000\377\300F\000\377\324u\000\377\350\226\000\377\364\251\000\377"
-  "\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256"
-  "\000\377\367\255\000\377\365\252\000\377\362\245\000\377\356\240\000\377\354\235\000"
-  "\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377"
-  "\354\235\000\377\355\236\000\377\355\236\000\377\350\227\000\377\334\203\000\377\313"
-  "b\000\377\274\064\000\377\264\000\000\377\262\000\000\377\270\065\061\377\310~u\377\334"
-  "\267\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\337\276\260\377\313\210"
-  "~\377\272C=\377\262\000\000\377\263\000\000\377\273\063\000\377\315f\000\377\342\214\000"
-  "\377\361\244\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\361\245\000\377\342\216\000\377\316h\000\377\274\066\000\377\263\000\000\377\262"
-  "\000\000\377\272?:\377\313\207}\377\340\277\261\377\000\000\000\377\000\000\000\377\331\256"
-  "\241\377\303of\377\266\037\037\377\262\000\000\377\265\000\000\377\302I\000\377\325w"
-  "\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\352\232\000\377\327"
-  "z\000\377\303N\001\377\267\027\001\377\263\000\000\377\267('\377\301d\\\377\321\231"
-  "\216\377\341\301\263\377\354\331\312\356\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\355\333\313\252\342\305\267\377\322\236\223\377\303kc\377\272;-\377"
-  "\272,\000\377\301F\000\377\313c\002\377\333\201\000\377\352\232\000\377\364\250\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000"
-  "\377\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377"
-  "\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\257\000\377\365\253\000\377\353\234\000\377\331~\000\377\306T"
-  "\000\377\271%\000\377\264\000\000\377\265\000\000\377\265\000\000\377\263\000\000\377\265\000\000"
-  "\377\276>\000\377\321n\000\377\345\222\000\377\363\247\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377"
-  "\336\206\000\377\312_\000\377\302K\000\377\317k\000\377\344\220\000\377\362\246\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\366\254\000\377\364\251\000\377\361\244\000\377"
-  "\352\232\000\377\335\205\000\377\314c\000\377\274\066\000\377\264\000\000\377\262\000\000"
-  "\377\270\062.\377\307{r\377\333\264\247\377\354\332\312\356\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303ld\377"
-  "\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377"
-  "\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\256\000\377\363\247\000\377\344\221\000\377\320l\000\377\302K\000\377"
-  "\311^\000\377\335\205\000\377\354\235\000\377\353\234\000\377\336\207\000\377\315g"
-  "\000\377\301I\000\377\273\061\000\377\270\037\001\377\266\014\003\377\264\000\000\377\266"
-  "\"\040\377\277\\U\377\316\223\210\377\337\275\257\317\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\325\245\231\377\305sj\377"
-  "\273A\065\377\272+\000\377\277A\000\377\312^\003\377\331}\000\377\350\227\000\377\363"
-  "\247\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304"
-  "O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\364\251"
-  "\000\377\352\231\000\377\327z\000\377\306V\000\377\306V\000\377\327z\000\377\352\232"
-  "\000\377\365\252\000\377\370\256\000\377\370\256\000\377\367\255\000\377\370\256\000"
-  "\377\367\256\000\377\362\246\000\377\344\220\000\377\317k\000\377\275:\000\377\263"
-  "\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\273\256\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\305sj\377\267&$\377\262\000\000\377\265\000\000\377\300E\000\377"
-  "\324t\000\377\350\226\000\377\364\250\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\254\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366"
-  "\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\367\254\000\377\366\254"
-  "\000\377\361\244\000\377\343\217\000\377\317k\000\377\275:\000\377\264\000\000\377\262"
-  "\000\000\377\271\070\063\377\310\177u\377\335\267\252\377\356\335\315f\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\337\276\260\377\313\210~\377\272C=\377\262\000\000\377\263"
-  "\000\000\377\274\064\000\377\315g\000\377\342\215\000\377\362\245\000\377\370\256\000\377"
-  "\371\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342\216\000"
-  "\377\316h\000\377\274\066\000\377\263\000\000\377\262\000\000\377\272?:\377\313\210~\377"
-  "\340\300\262\377\000\000\000\377\000\000\000\377\331\257\242\377\304og\377\266\037\037"
-  "\377\261\000\000\377\265\000\000\377\302I\000\377\325w\000\377\351\230\000\377\364\251"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\365\252\000\377\352\232\000\377\327{\001\377\303M\000\377\266\007\000"
-  "\377\261\000\000\377\264\000\000\377\272C>\377\306wn\377\322\235\222\377\335\271"
-  "\254\377\347\317\301\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\322\303\377\337\274\257\377"
-  "\323\241\225\377\306{r\377\274LD\377\273\061\000\377\304K\000\377\320k\000\377\334"
-  "\202\000\377\347\225\001\377\360\243\001\377\366\254\000\377\370\257\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307"
-  "X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377"
-  "\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257"
-  "\000\377\365\252\000\377\353\233\000\377\330{\000\377\303M\000\377\266\014\000\377\262"
-  "\000\000\377\264\000\000\377\265\000\000\377\263\000\000\377\265\000\000\377\276>\000\377\322o"
-  "\000\377\346\223\000\377\364\250\000\377\370\257\000\377\370\257\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377\336\206\000\377\312_\000"
-  "\377\302K\000\377\317k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\367\255\000\377\364\251\000\377\356\240\000\377\345\222\000\377\333\201\000\377\320"
-  "l\001\377\304O\001\377\272*\000\377\263\000\000\377\262\000\000\377\267*&\377\307{q\377"
-  "\334\266\251\377\356\335\316\210\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\352\324\305\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377"
-  "\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377"
-  "\363\247\000\377\344\220\000\377\317j\000\377\301I\000\377\312^\000\377\337\207\000\377"
-  "\357\242\000\377\362\245\000\377\352\231\000\377\335\205\000\377\322p\000\377\307W"
-  "\001\377\275\070\000\377\266\007\000\377\263\000\000\377\263\000\000\377\271;\066\377\304p"
-  "h\377\320\231\215\377\334\266\251\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\340\277\262K\325\245\231\377\310\201x\377\275SK\377\273\061\004\377\302F\000"
-  "\377\316g\000\377\332\177\000\377\345\222\001\377\357\242\001\377\366\253\000\377\370"
-  "\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000"
-  "\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000"
-  "\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\366\254\000\377\353\233"
-  "\000\377\327z\000\377\304Q\000\377\304O\000\377\325w\000\377\351\231\000\377\365\252"
-  "\000\377\370\257\000\377\370\256\000\377\367\255\000\377\370\256\000\377\367\256\000"
-  "\377\362\246\000\377\344\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000"
-  "\000\377\271:\065\377\311\203y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\305sj\377\267&$\377\262\000\000\377\265\000\000\377\300E\000\377\324t\000\377\350"
-  "\226\000\377\364\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\371\260\000\377\371\257\000\377\363\250"
-  "\000\377\345\222\000\377\320m\000\377\276<\000\377\264\000\000\377\262\000\000\377\271\070"
-  "\063\377\310\177u\377\335\267\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\337\276\260\377\313\210~\377\272C=\377\262\000\000\377\263\000\000\377\273\063"
-  "\000\377\315e\000\377\341\214\000\377\360\243\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342\216\000\377\316h\000\377"
-  "\274\066\000\377\263\000\000\377\262\000\000\377\272>:\377\312\207}\377\337\276\260"
-  "\377\000\000\000\377\000\000\000\377\330\255\240\377\303nf\377\266\037\037\377\262\000\000"
-  "\377\265\000\000\377\302I\000\377\325w\000\377\351\230\000\377\364\251\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377"
-  "\365\252\000\377\352\232\000\377\327{\000\377\303M\000\377\266\021\000\377\263\000\000\377"
-  "\264\000\000\377\267*'\377\274KE\377\302kc\377\315\217\204\377\334\265\250\377"
-  "\352\326\306\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\354\331\311\356\335\271\254\377\316\223\210\377\303ng\377"
-  "\273KH\377\271\064*\377\300D\000\377\320j\000\377\340\211\000\377\352\232\000\377"
-  "\361\244\000\377\364\251\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256"
-  "\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~"
-  "\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365"
-  "\252\000\377\353\233\000\377\330|\000\377\304O\000\377\266\025\000\377\263\000\000\377\264"
-  "\000\000\377\265\000\000\377\263\000\000\377\265\000\000\377\276=\000\377\321n\000\377\345\221"
-  "\000\377\362\246\000\377\367\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\357\242\000\377\336\206\000\377\312_\000\377\302K\000\377"
-  "\317k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\362"
-  "\246\000\377\347\225\000\377\330|\000\377\312`\000\377\301G\000\377\273\060\000\377\267"
-  "\033\001\377\264\000\000\377\263\000\000\377\271:\065\377\310\177u\377\335\267\252\377"
-  "\356\335\315\210\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305"
-  "\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302"
-  "J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\344"
-  "\221\000\377\320m\000\377\303M\000\377\312_\000\377\336\205\000\377\356\240\000\377\364"
-  "\251\000\377\362\246\000\377\354\234\000\377\341\214\000\377\322p\000\377\302J\000\377"
-  "\267\030\000\377\263\000\000\377\264\000\000\377\267%\"\377\273FA\377\301g_\377\313"
-  "\211\177\377\332\260\243\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\340\276\261\202\320\230\215"
-  "\377\304sk\377\274PL\377\271\066/\377\277?\003\377\315e\000\377\336\205\000\377"
-  "\351\231\000\377\360\243\000\377\364\251\000\377\366\254\000\377\367\256\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000"
-  "\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000"
-  "\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\257\000\377\366\253\000\377\353\233\000\377\327z\000"
-  "\377\305S\000\377\304Q\000\377\326w\000\377\351\231\000\377\365\252\000\377\370\257"
-  "\000\377\370\256\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000"
-  "\377\344\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271:\065"
-  "\377\311\203y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000\377\305sj\377"
-  "\267&$\377\262\000\000\377\265\000\000\377\300E\000\377\324t\000\377\350\226\000\377\364"
-  "\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367"
-  "\256\000\377\367\256\000\377\370\257\000\377\370\256\000\377\363\247\000\377\344\221"
-  "\000\377\320l\000\377\275;\000\377\264\000\000\377\262\000\000\377\271\070\063\377\310\177"
-  "u\377\335\267\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\337\276\260"
-  "\377\313\210~\377\272B=\377\262\000\000\377\263\000\000\377\273/\000\377\312^\000\377"
-  "\334\202\000\377\352\232\000\377\361\245\000\377\365\252\000\377\366\254\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\361\245\000\377\342\216\000\377\316h\000\377\274\066\000\377\263"
-  "\000\000\377\262\000\000\377\271:\065\377\310~t\377\332\261\245\377\000\000\000\377\343"
-  "\306\270\314\324\242\226\377\301g_\377\266\034\034\377\262\000\000\377\265\000\000"
-  "\377\302I\000\377\325w\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000"
-  "\377\352\232\000\377\327{\000\377\303N\000\377\267\026\000\377\263\000\000\377\264\000\001"
-  "\377\265\012\010\377\265\000\000\377\270-)\377\301g`\377\324\242\226\377\347\316"
-  "\277\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\351\322\303\377\326\250\233\377\303nf\377\270\061/\377\263\000\000\377"
-  "\267\034\006\377\303N\002\377\327y\000\377\351\230\000\377\363\250\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364"
-  "\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354"
-  "\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000"
-  "\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210"
-  "\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000"
-  "\377\353\233\000\377\331}\000\377\304Q\000\377\267\032\000\377\263\000\000\377\264\000\000"
-  "\377\265\000\000\377\264\000\000\377\265\000\000\377\275\071\000\377\315f\000\377\337\210"
-  "\000\377\354\235\000\377\362\246\000\377\365\252\000\377\366\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\357\242\000\377\336\206\000\377\312_\000\377\302L\000\377"
-  "\317k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361"
-  "\245\000\377\343\217\000\377\317k\000\377\276?\000\377\266\021\000\377\265\000\000\377\266"
-  "\030\023\377\267-)\377\272E?\377\302h`\377\317\225\212\377\340\300\262\377"
-  "\357\337\317D\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377"
-  "\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377"
-  "\326x\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\250\000\377\347\226\000"
-  "\377\326y\000\377\313a\000\377\316h\000\377\334\202\000\377\351\230\000\377\360\244"
-  "\000\377\364\251\000\377\363\247\000\377\352\232\000\377\331~\000\377\305S\000\377\270"
-  "\036\000\377\263\000\000\377\264\000\000\377\265\013\011\377\265\000\000\377\267%\"\377\277"
-  "_W\377\321\232\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\331\257\242\377\306wn\377\271:\067"
-  "\377\263\000\002\377\266\021\004\377\301G\003\377\324t\000\377\347\224\000\377\362\246"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354"
-  "\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364"
-  "\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\370\257\000\377\365\252\000\377\352\232\000\377\327z\000\377\305"
-  "T\000\377\305R\000\377\326x\000\377\352\231\000\377\365\252\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220"
-  "\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203"
-  "y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000\377\305sj\377\267&$\377\262"
-  "\000\000\377\265\000\000\377\300F\000\377\324t\000\377\350\226\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\362\246\000\377\344\221\000\377\320l\000"
-  "\377\275;\000\377\264\000\000\377\262\000\000\377\271\070\063\377\310\177u\377\335\267"
-  "\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\337\275\257\377\312\205"
-  "{\377\271:\065\377\262\000\000\377\263\000\000\377\271$\000\377\303M\000\377\320l\001\377"
-  "\334\203\000\377\346\223\000\377\356\240\000\377\364\250\000\377\367\255\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\361\245\000\377\342\216\000\377\316h\000\377\274\066\000\377\264\000\000\377\263"
-  "\000\000\377\270/+\377\302ia\377\317\225\212\377\330\253\237\377\326\246\232"
-  "\377\313\207}\377\275UN\377\265\024\026\377\262\000\000\377\266\005\000\377\302I\000"
-  "\377\325w\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\352\232\000"
-  "\377\327{\000\377\303N\000\377\267\026\000\377\263\000\001\377\264\000\000\377\265\000\000\377"
-  "\263\000\000\377\264\000\000\377\276WP\377\321\233\220\377\346\314\275\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\320"
-  "\301\377\324\242\226\377\300_X\377\264\000\000\377\261\000\000\377\266\010\000\377\304"
-  "Q\000\377\331~\001\377\354\235\000\377\367\255\000\377\371\260\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226"
-  "\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253"
-  "\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377"
-  "\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000\377\353\233\000\377\331"
-  "}\000\377\304Q\000\377\267\032\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000"
-  "\000\377\265\000\000\377\272.\000\377\305T\000\377\322q\000\377\336\206\000\377\347\226"
-  "\000\377\357\242\000\377\365\252\000\377\367\255\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\257\000\377\370\257\000\377\370\257\000\377"
-  "\370\257\000\377\370\257\000\377\370\257\000\377\371\260\000\377\370\256\000\377\360"
-  "\243\000\377\336\207\000\377\312`\000\377\302L\000\377\317k\000\377\344\220\000\377\362"
-  "\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\371\257\000\377\370\256\000\377\362\246\000\377\342\215\000\377\315"
-  "f\000\377\273\060\000\377\263\000\000\377\262\000\000\377\267(%\377\276WP\377\307}s\377"
-  "\322\234\221\377\335\270\253\377\350\322\302\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303ld\377"
-  "\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377"
-  "\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\365\251\000\377\355\236\000\377\342\215\000\377\331~\000"
-  "\377\326y\000\377\331}\000\377\336\206\000\377\345\222\000\377\357\241\000\377\363"
-  "\250\000\377\355\237\000\377\334\203\000\377\307W\000\377\270\040\000\377\263\000\001\377"
-  "\264\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\274LF\377\316\223\210\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\327\251\235\377\302jb\377\265\007\014\377\261\000\000\377\265"
-  "\000\000\377\302I\000\377\326y\001\377\352\232\000\377\366\253\000\377\371\260\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377"
-  "\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257"
-  "\000\377\365\252\000\377\352\232\000\377\327z\000\377\305T\000\377\305R\000\377\326x"
-  "\000\377\352\231\000\377\365\252\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317k\000\377\275"
-  ":\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\273\256\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\305sj\377\267&$\377\262\000\000\377\265\000\000\377"
-  "\301F\000\377\325u\000\377\350\227\000\377\365\252\000\377\371\260\000\377\371\260"
-  "\000\377\370\256\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\370\257\000\377\363\247\000\377\345\222\000\377\320m\000\377\275<\000\377\264"
-  "\000\000\377\262\000\000\377\271\070\063\377\310\177u\377\335\267\252\377\356\335\315"
-  "f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\337\276\260\377\313\210~\377\272B=\377\263\000"
-  "\000\377\263\000\000\377\267\030\000\377\273\062\000\377\302I\000\377\313a\000\377\327{\000"
-  "\377\346\223\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342\216"
-  "\000\377\316h\000\377\274\066\000\377\264\000\000\377\263\000\000\377\266\036\034\377\273"
-  "IC\377\302ia\377\306yp\377\305ul\377\300_X\377\271:\065\377\265\007\014\377\263"
-  "\000\000\377\266\013\000\377\302I\000\377\325w\000\377\351\230\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\365\252\000\377\352\232\000\377\327{\000\377\303N\000\377\267\026\000\377\263\000"
-  "\001\377\264\000\000\377\265\000\000\377\263\000\000\377\264\000\000\377\276YR\377\322\234"
-  "\221\377\346\314\275\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\350\320\301\377\324\243\227\377\300bZ\377\264\000\000\377"
-  "\261\000\000\377\266\013\000\377\304P\000\377\330}\001\377\353\234\000\377\366\253\000\377"
-  "\371\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256"
-  "\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~"
-  "\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377"
-  "\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365"
-  "\252\000\377\353\233\000\377\331}\000\377\304Q\000\377\267\032\000\377\263\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\267\036\000\377\274\066\000\377\303"
-  "N\000\377\315f\000\377\332\200\000\377\350\227\000\377\363\247\000\377\367\255\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\357\242\000\377\336\206\000\377\312_\000\377\302L\000\377\317"
-  "k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244"
-  "\000\377\342\215\000\377\315f\000\377\273\062\000\377\263\000\000\377\262\000\000\377\270"
-  "\067\062\377\305sk\377\324\243\227\377\342\304\266\377\353\327\310\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305"
-  "\377\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302"
-  "J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377\363"
-  "\247\000\377\356\240\000\377\350\226\000\377\337\211\000\377\326x\000\377\320m\000\377"
-  "\326x\000\377\344\221\000\377\357\241\000\377\354\235\000\377\334\202\000\377\306V"
-  "\000\377\270\040\000\377\263\000\001\377\264\000\000\377\265\000\000\377\263\000\000\377\264\000"
-  "\000\377\274NH\377\317\224\211\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\327\252\236\377\303ld"
-  "\377\265\025\026\377\261\000\000\377\265\000\000\377\301H\000\377\326w\001\377\351\230"
-  "\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366"
-  "\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350"
-  "\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000\377\352\232\000\377"
-  "\327z\000\377\305T\000\377\305R\000\377\326x\000\377\352\231\000\377\365\252\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362"
-  "\246\000\377\344\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271"
-  ":\065\377\311\203y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000\377\305s"
-  "j\377\267&$\377\262\000\000\377\265\000\000\377\300F\000\377\324u\000\377\350\226\000\377"
-  "\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\362\246\000\377\344"
-  "\221\000\377\320l\000\377\275;\000\377\264\000\000\377\262\000\000\377\271\070\063\377\310"
-  "\177u\377\335\267\252\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\305"
-  "\266\377\320\231\216\377\302h`\377\272@;\377\267'$\377\266\032\024\377\265"
-  "\004\000\377\267\025\000\377\276<\000\377\315f\000\377\340\212\000\377\360\242\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\361\245\000\377\342\216\000\377\316h\000\377\274\066\000\377\264"
-  "\000\000\377\263\000\000\377\265\010\010\377\266\040\035\377\270\060,\377\271\071\064\377"
-  "\271\067\062\377\267+'\377\266\030\025\377\265\000\003\377\263\000\000\377\266\016\000\377"
-  "\301I\000\377\325w\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377"
-  "\352\232\000\377\327{\000\377\303N\000\377\267\026\000\377\263\000\000\377\264\000\000\377"
-  "\265\000\000\377\263\000\000\377\265\002\001\377\277\\U\377\322\235\222\377\346\315\276"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\350\321\302\377\325\244\230\377\301d]\377\265\016\022\377\262\000\000\377\266"
-  "\015\000\377\302J\000\377\324u\000\377\345\223\000\377\360\243\000\377\364\251\000\377"
-  "\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251"
-  "\000\377\350\226\000\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235"
-  "\000\377\366\253\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377"
-  "\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377"
-  "\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000\377\353"
-  "\233\000\377\331}\000\377\304P\000\377\267\032\000\377\263\000\000\377\264\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\010\000\377\265\007\000\377\270\036\000\377\300"
-  "D\000\377\321n\000\377\344\220\000\377\362\245\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\365\252\000\377"
-  "\363\250\000\377\362\245\000\377\361\244\000\377\361\244\000\377\361\244\000\377\361"
-  "\244\000\377\361\244\000\377\361\244\000\377\361\244\000\377\362\245\000\377\360\243"
-  "\000\377\351\231\000\377\331~\000\377\310Z\000\377\302J\000\377\320k\000\377\344\220"
-  "\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\254\000\377\365\253\000\377\363\247\000\377\354\234\000\377\335\205"
-  "\000\377\313a\000\377\273\061\000\377\263\000\000\377\262\000\000\377\272?:\377\311\203"
-  "y\377\335\270\252\377\355\332\313\356\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303"
-  "ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377\364\250\000\377\362"
-  "\246\000\377\362\246\000\377\364\250\000\377\366\253\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377"
-  "\361\245\000\377\346\223\000\377\324t\000\377\306U\000\377\311]\000\377\331~\000\377"
-  "\347\224\000\377\346\223\000\377\330{\000\377\304Q\000\377\267\035\000\377\264\000\000\377"
-  "\264\000\000\377\265\000\000\377\263\000\000\377\264\000\000\377\275RL\377\317\225\212\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\330\253\237\377\303nf\377\266!\040\377\262\000\000\377\265"
-  "\000\000\377\300D\000\377\322o\000\377\343\217\000\377\357\241\000\377\364\251\000\377"
-  "\366\253\000\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377"
-  "\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257"
-  "\000\377\365\252\000\377\352\232\000\377\327z\000\377\305T\000\377\305R\000\377\326x"
-  "\000\377\352\231\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317k\000\377\275"
-  ":\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\273\256\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\304sj\377\267&$\377\262\000\000\377\265\000\000\377"
-  "\277A\000\377\321n\000\377\343\216\000\377\356\240\000\377\361\245\000\377\361\245"
-  "\000\377\361\245\000\377\363\247\000\377\365\252\000\377\366\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\366\253"
-  "\000\377\363\250\000\377\355\236\000\377\337\211\000\377\315f\000\377\274\067\000\377"
-  "\264\000\000\377\262\000\000\377\271\067\063\377\310\177u\377\335\267\252\377\356\335"
-  "\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\351\323\304\377\335\270\253\377\321\232\217"
-  "\377\307{r\377\276XQ\377\270.+\377\263\000\000\377\262\000\000\377\271%\000\377\311"
-  "]\000\377\336\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342"
-  "\215\000\377\315f\000\377\273\061\000\377\263\000\001\377\263\000\001\377\265\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264"
-  "\000\000\377\263\000\001\377\265\000\000\377\300F\000\377\325v\000\377\350\227\000\377\364"
-  "\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\365\252\000\377\352\232\000\377\327{\000\377\303N\000\377\267"
-  "\026\000\377\263\000\001\377\264\000\000\377\265\000\000\377\263\000\000\377\264\000\000\377\276"
-  "XQ\377\322\235\221\377\346\315\277\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\322\303\377\324\243\227\377\300"
-  "aY\377\264\000\000\377\261\000\000\377\265\000\000\377\276>\000\377\313b\001\377\331}\000\377"
-  "\343\217\000\377\354\234\000\377\362\246\000\377\366\253\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307"
-  "X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377"
-  "\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257"
-  "\000\377\365\252\000\377\353\233\000\377\330|\000\377\303N\000\377\266\017\000\377\262"
-  "\000\000\377\264\000\000\377\265\000\000\377\265\001\000\377\265\000\000\377\265\000\000\377\263"
-  "\000\000\377\263\000\000\377\273\061\000\377\315f\000\377\342\215\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\257\000\377"
-  "\367\254\000\377\362\245\000\377\353\233\000\377\344\221\000\377\341\214\000\377\341"
-  "\213\000\377\341\214\000\377\341\214\000\377\341\214\000\377\341\214\000\377\341\214"
-  "\000\377\342\215\000\377\341\214\000\377\334\202\000\377\317k\000\377\302L\000\377\301"
-  "F\000\377\320l\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\367\255\000\377\364\251\000\377\357\242\000\377\350\226\000"
-  "\377\337\207\000\377\322q\001\377\304Q\000\377\271(\000\377\263\000\000\377\262\000\000\377"
-  "\271\071\064\377\312\205{\377\337\275\257\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377"
-  "\327\251\235\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377"
-  "\326x\000\377\351\230\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\256\000\377\366\254\000\377\362\246\000\377"
-  "\353\234\000\377\346\223\000\377\346\224\000\377\354\234\000\377\362\246\000\377\366"
-  "\254\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000"
-  "\377\370\257\000\377\365\251\000\377\347\226\000\377\323q\000\377\300F\000\377\277"
-  "B\000\377\314d\000\377\331}\000\377\331}\000\377\316i\000\377\300D\000\377\267\027\000\377"
-  "\264\000\001\377\264\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\274MG\377\317"
-  "\224\211\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\327\253\237\377\302kc\377\265\016\017\377\261"
-  "\000\000\377\265\000\000\377\275\070\000\377\311^\001\377\327z\000\377\342\215\000\377\353"
-  "\233\000\377\361\245\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377"
-  "\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\257\000\377\365\252\000\377\352\232\000\377\326x\000\377\304Q\000\377\304"
-  "P\000\377\326x\000\377\352\232\000\377\366\253\000\377\371\257\000\377\370\256\000\377"
-  "\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\344\220\000\377\317"
-  "k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\273"
-  "\256\377\000\000\000\377\000\000\000\377\000\000\000\377\304og\377\266\026\025\377\261\000\000\377"
-  "\264\000\000\377\274\066\000\377\311]\001\377\327y\000\377\337\210\000\377\342\214\000\377"
-  "\342\214\000\377\343\217\000\377\351\230\000\377\360\242\000\377\365\252\000\377\367"
-  "\255\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\256\000\377\367\255\000\377\365\252\000\377"
-  "\360\243\000\377\351\230\000\377\340\211\000\377\324t\001\377\306U\001\377\272-\000\377"
-  "\263\000\000\377\262\000\000\377\270.*\377\307|r\377\334\266\251\377\356\334\315"
-  "\210\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\326\307\252\342\303\265\377"
-  "\325\245\231\377\306yp\377\272@;\377\263\000\000\377\262\000\000\377\271&\000\377\311"
-  "]\000\377\336\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000\377\342"
-  "\215\000\377\316g\000\377\273\064\000\377\264\000\000\377\263\000\001\377\265\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264"
-  "\000\000\377\263\000\001\377\265\007\000\377\301G\000\377\325v\000\377\351\227\000\377\364"
-  "\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\365\252\000\377\352\232\000\377\327{\000\377\303N\000\377\267"
-  "\026\000\377\263\000\000\377\264\000\000\377\265\000\000\377\263\000\000\377\265\000\000\377\276"
-  "ZS\377\322\235\221\377\346\315\276\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302\377\324\243\227\377\300"
-  "c[\377\265\001\004\377\262\000\000\377\265\000\000\377\271*\000\377\300D\000\377\310[\000\377"
-  "\323s\000\377\341\213\000\377\355\237\000\377\365\252\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307"
-  "X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377"
-  "\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257"
-  "\000\377\365\252\000\377\353\233\000\377\330|\000\377\304O\000\377\266\024\000\377\263"
-  "\000\000\377\264\000\000\377\265\000\000\377\265\001\000\377\265\000\000\377\265\000\000\377\263"
-  "\000\000\377\263\000\000\377\273\062\000\377\315f\000\377\342\215\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\367\256\000\377\370\257\000\377\370\257\000\377"
-  "\365\252\000\377\354\235\000\377\337\211\000\377\323s\000\377\315f\000\377\314c\000\377"
-  "\315e\000\377\315e\000\377\315e\000\377\315e\000\377\315f\000\377\315f\000\377\315e\000"
-  "\377\312^\000\377\302J\000\377\274\065\000\377\277B\000\377\320m\000\377\344\221\000\377"
-  "\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\362\246\000\377\347\226\000\377\332\177\000\377\315g\000\377\304P\000\377\274"
-  "\067\000\377\267\032\000\377\263\000\000\377\263\000\000\377\271=\070\377\312\206|\377\337"
-  "\275\260\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303ld\377\266"
-  "\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377\364"
-  "\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\370\256\000\377\365\253\000\377\356\237\000\377\341\213\000\377\326x\000\377\327"
-  "y\000\377\342\215\000\377\357\241\000\377\366\253\000\377\370\256\000\377\367\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\364\251\000\377\350"
-  "\226\000\377\323s\000\377\300E\000\377\272.\000\377\300E\000\377\310Y\000\377\310[\000"
-  "\377\302K\000\377\273\060\000\377\266\016\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\263\000\000\377\264\000\000\377\274PI\377\317\225\212\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\327"
-  "\253\237\377\303md\377\266\032\030\377\262\000\000\377\264\000\000\377\271&\000\377\277"
-  "@\000\377\307X\000\377\322o\000\377\337\210\000\377\354\234\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000"
-  "\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000"
-  "\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000\377\352\232"
-  "\000\377\327y\000\377\305R\000\377\304Q\000\377\326x\000\377\352\232\000\377\365\253"
-  "\000\377\370\257\000\377\370\256\000\377\367\255\000\377\370\256\000\377\367\256\000"
-  "\377\362\246\000\377\344\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000"
-  "\000\377\271:\065\377\311\203y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\304qi\377\266\037\035\377\262\000\000\377\264\000\000\377\271%\000\377\300C\000\377"
-  "\307W\000\377\314c\000\377\314d\000\377\315e\000\377\321n\000\377\334\203\000\377\351"
-  "\230\000\377\363\247\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\363\247\000\377\351\230\000\377\333\202\000\377\317j\000\377\305R"
-  "\000\377\275:\000\377\270\036\000\377\264\000\000\377\263\000\000\377\270\063/\377\307}t"
-  "\377\334\267\251\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\337\275\257\377\314\213\201\377\273JD\377\263\000\000\377"
-  "\262\000\000\377\272+\000\377\312_\000\377\337\207\000\377\357\241\000\377\367\255\000"
-  "\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367"
-  "\255\000\377\362\246\000\377\344\221\000\377\322p\000\377\302I\000\377\271(\000\377\266"
-  "\024\000\377\266\015\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\003\000\377\266\017\000\377\267\031\000\377\273\063\000\377\307W\000\377\331"
-  "}\000\377\352\232\000\377\365\251\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\352\232\000\377\327"
-  "{\000\377\303N\000\377\267\025\000\377\263\000\000\377\264\000\002\377\266\031\026\377\267"
-  "%\"\377\272C>\377\304pg\377\324\241\225\377\344\310\272\377\357\337\317\""
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\346\314\275"
-  "\377\326\246\232\377\305um\377\273HB\377\267'$\377\266\033\027\377\266\021\004"
-  "\377\266\023\000\377\273\060\000\377\306U\000\377\330|\000\377\352\231\000\377\364\251"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377"
-  "\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253\000\377"
-  "\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216"
-  "\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\366\254\000\377\365\252\000\377\363\250\000\377\363\247\000\377\364\251\000\377"
-  "\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\256\000\377\365\253\000\377\354\235\000\377\334\202\000"
-  "\377\311]\000\377\275\070\000\377\267\034\000\377\266\020\000\377\265\005\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\274\066\000\377\316h"
-  "\000\377\342\216\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\364\250\000\377\363\247"
-  "\000\377\363\247\000\377\363\247\000\377\357\242\000\377\344\221\000\377\324t\000\377"
-  "\304P\000\377\274\064\000\377\272-\000\377\273\062\000\377\273\063\000\377\273\063\000\377"
-  "\273\063\000\377\273\063\000\377\274\064\000\377\273\063\000\377\272.\000\377\267\034\000"
-  "\377\267\025\000\377\276>\000\377\320m\000\377\344\221\000\377\362\246\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\360\243\000\377\341"
-  "\214\000\377\317i\000\377\277B\000\377\270\037\000\377\266\016\000\377\266\030\020\377"
-  "\266\035\033\377\270\064\060\377\300_X\377\317\224\211\377\341\302\264\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\352\324\305\377\327\251\235\377\303ld\377\266\035\035\377\262\000"
-  "\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\365\252\000\377\352\233\000\377\331}\000\377\311]\000\377\312_\000\377\332\177"
-  "\000\377\354\234\000\377\365\253\000\377\370\256\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\351\230\000\377\330"
-  "{\000\377\306V\000\377\274\070\000\377\272.\000\377\273\061\000\377\272.\000\377\270#\000"
-  "\377\266\024\000\377\265\003\000\377\265\000\000\377\265\000\000\377\266\027\025\377\267#"
-  "\037\377\272>\071\377\302ia\377\321\233\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\330\254\240"
-  "\377\307}s\377\274NH\377\267*'\377\266\034\031\377\266\023\007\377\266\020\000\377"
-  "\272+\000\377\304O\000\377\325w\000\377\347\226\000\377\363\250\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253"
-  "\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\365\253\000\377\364\251\000\377\363\247\000\377"
-  "\363\250\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\365\253\000\377\354\234\000\377\332"
-  "\177\000\377\312`\000\377\311\\\000\377\326y\000\377\347\225\000\377\361\244\000\377"
-  "\365\252\000\377\366\254\000\377\367\255\000\377\370\256\000\377\370\256\000\377\362"
-  "\246\000\377\344\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271"
-  ":\065\377\311\203y\377\336\273\256\377\000\000\000\377\000\000\000\377\000\000\000\377\312\204"
-  "z\377\275PJ\377\267*'\377\266\033\030\377\266\026\010\377\270\035\000\377\272*\000"
-  "\377\273\061\000\377\272.\000\377\273\061\000\377\302I\000\377\322p\000\377\344\221\000"
-  "\377\362\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\361\245\000\377\343\217\000\377\321n\000\377\301F\000\377\270#\000\377\266\016"
-  "\000\377\266\026\015\377\266\034\032\377\270\060-\377\276ZS\377\315\216\203\377"
-  "\337\275\260\377\357\336\317D\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\343\305\267\377\316\222\207\377\274NH\377\263\000\000\377\262"
-  "\000\000\377\272+\000\377\312_\000\377\337\207\000\377\357\241\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\363\250\000\377\352\231\000\377\335\204\000\377\320m\000\377\306V\000\377\276"
-  "=\000\377\270!\000\377\265\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\264\000"
-  "\000\377\266\013\000\377\272,\000\377\301F\000\377\311^\000\377\324u\000\377\342\214\000"
-  "\377\356\237\000\377\365\252\000\377\370\256\000\377\367\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\352\232\000\377\327{\000"
-  "\377\303N\000\377\266\023\000\377\263\000\000\377\265\001\011\377\271<\067\377\300c[\377"
-  "\311\202x\377\321\231\216\377\330\254\240\377\336\273\256\377\343\305\267"
-  "\377\344\311\272\377\344\311\272\377\344\310\272\377\344\311\272\377\344"
-  "\311\273\377\343\306\270\377\337\275\257\377\331\256\241\377\321\233\220"
-  "\377\312\205{\377\301g_\377\272A<\377\265\012\020\377\262\000\000\377\265\000\000\377"
-  "\301F\000\377\325v\000\377\351\230\000\377\365\252\000\377\370\257\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307"
-  "X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377"
-  "\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\256\000\377\367\255\000\377\364\250\000\377\356\240\000"
-  "\377\351\230\000\377\350\226\000\377\354\235\000\377\362\246\000\377\366\254\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256"
-  "\000\377\366\253\000\377\357\242\000\377\344\220\000\377\326y\000\377\313a\000\377\302"
-  "J\000\377\273\060\000\377\266\021\000\377\264\000\000\377\265\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\365\252\000"
-  "\377\360\243\000\377\352\232\000\377\346\223\000\377\344\221\000\377\344\221\000\377"
-  "\341\214\000\377\330{\000\377\311]\000\377\273\063\000\377\264\000\000\377\263\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\276<\000\377\320m\000\377\345"
-  "\221\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\357\242\000\377\337\210\000\377\312_\000\377\271)\000\377\263\000\000"
-  "\377\263\000\000\377\267*&\377\275QK\377\304sj\377\316\222\207\377\332\262\245"
-  "\377\350\320\301\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303ld"
-  "\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\365\252\000\377\351\231\000\377\325w\000\377\304P"
-  "\000\377\305S\000\377\327z\000\377\353\233\000\377\366\253\000\377\371\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000"
-  "\377\355\236\000\377\341\213\000\377\324s\000\377\311\\\000\377\300C\000\377\271&\000"
-  "\377\265\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\265\002\001"
-  "\377\270\066\062\377\277^W\377\310~t\377\317\226\213\377\327\252\235\377\336"
-  "\272\254\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\340\276\261\202\332\260\244\377\322\236\222\377\313\210~\377\302"
-  "kc\377\273GA\377\266\026\027\377\262\000\000\377\264\000\000\377\276>\000\377\322p\000"
-  "\377\346\224\000\377\364\250\000\377\370\257\000\377\370\257\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000"
-  "\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000"
-  "\377\361\245\000\377\353\234\000\377\350\226\000\377\351\231\000\377\357\242\000\377"
-  "\365\252\000\377\367\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\366\253\000\377\357\241\000\377\343\216\000\377\327z\000\377\323r"
-  "\000\377\327z\000\377\337\210\000\377\346\224\000\377\355\236\000\377\362\246\000\377"
-  "\366\254\000\377\370\257\000\377\370\256\000\377\362\246\000\377\344\220\000\377\317"
-  "k\000\377\275:\000\377\263\000\000\377\262\000\000\377\271:\065\377\311\203y\377\336\274"
-  "\256\377\000\000\000\377\000\000\000\377\000\000\000\377\327\251\235\377\313\210~\377\301f"
-  "^\377\272@:\377\265\000\002\377\263\000\000\377\264\000\000\377\264\000\000\377\263\000\001\377"
-  "\263\000\001\377\273\063\000\377\316g\000\377\342\215\000\377\361\245\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341"
-  "\214\000\377\314d\000\377\273\060\000\377\263\000\000\377\263\000\000\377\267$!\377\274"
-  "MG\377\303og\377\315\217\204\377\331\256\242\377\346\315\276\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\343\306\267\377"
-  "\316\222\207\377\274NH\377\263\000\000\377\262\000\000\377\272+\000\377\312_\000\377"
-  "\337\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\256\000\377\367\255\000\377\365\252\000\377\360\244\000"
-  "\377\352\232\000\377\341\214\000\377\325w\000\377\307X\000\377\273\061\000\377\265\000"
-  "\000\377\264\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\266\023\000\377\277@"
-  "\000\377\314d\000\377\332\177\000\377\344\221\000\377\354\236\000\377\362\246\000\377"
-  "\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\365\252\000\377\352\232\000\377\327{\000\377\303N\000\377\266"
-  "\020\000\377\262\000\000\377\265\013\020\377\275TN\377\313\212\200\377\331\256\241"
-  "\377\337\274\257\377\335\267\252\377\326\250\234\377\321\233\220\377\320"
-  "\226\213\377\320\226\213\377\320\227\214\377\320\226\213\377\320\226\213"
-  "\377\321\232\217\377\326\246\232\377\334\266\251\377\337\275\257\377\332"
-  "\260\244\377\315\217\204\377\277[T\377\265\026\031\377\261\000\000\377\264\000\000"
-  "\377\300E\000\377\325v\000\377\351\230\000\377\365\252\000\377\370\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377\307"
-  "X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377"
-  "\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\366\254\000\377\360\243\000\377\345\222\000"
-  "\377\332\177\000\377\330{\000\377\341\213\000\377\355\236\000\377\365\252\000\377\370"
-  "\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\366\254\000\377\363\247\000\377\355\237\000\377\346\223\000\377\334\202\000\377"
-  "\316i\000\377\301F\000\377\267\033\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\363\247\000"
-  "\377\351\231\000\377\335\205\000\377\323s\000\377\320l\000\377\320k\000\377\316h\000"
-  "\377\310[\000\377\300C\000\377\270\037\000\377\264\000\000\377\263\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\263\000\000\377\264\000\000\377\276<\000\377\321m\000\377\345\221\000\377"
-  "\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\357\242\000\377\337\207\000\377\312^\000\377\271'\000\377\262\000\000\377\263\000"
-  "\000\377\271<\067\377\305sk\377\323\237\223\377\337\275\260\377\350\322\303"
-  "\377\357\340\320\"\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303ld\377"
-  "\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377"
-  "\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\365\252\000\377\351\230\000\377\325v\000\377\304O\000\377\305"
-  "R\000\377\327z\000\377\353\233\000\377\366\253\000\377\371\257\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\253\000\377\362\246"
-  "\000\377\354\235\000\377\344\220\000\377\331}\000\377\313a\000\377\275:\000\377\265\000"
-  "\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\265\003\002\377\274LF"
-  "\377\311\203y\377\327\252\235\377\336\274\256\377\335\271\254\377\327\253"
-  "\236\377\322\234\221\377\320\227\213\377\320\226\213\377\320\227\214\377"
-  "\320\226\213\377\317\226\213\377\321\231\216\377\325\244\230\377\333\264"
-  "\247\377\337\275\257\377\333\264\247\377\317\225\212\377\300c\\\377\266#"
-  "#\377\262\000\000\377\263\000\000\377\276=\000\377\322p\000\377\346\224\000\377\364\250"
-  "\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377"
-  "\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\364\251\000\377\354\234\000\377\337\211\000"
-  "\377\327{\000\377\333\201\000\377\347\225\000\377\362\246\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\366\254\000\377\363"
-  "\247\000\377\355\236\000\377\346\224\000\377\337\211\000\377\331}\000\377\324u\000\377"
-  "\327z\000\377\341\214\000\377\355\237\000\377\365\252\000\377\371\257\000\377\370\256"
-  "\000\377\362\246\000\377\344\220\000\377\317k\000\377\275:\000\377\263\000\000\377\262"
-  "\000\000\377\271:\065\377\311\202x\377\336\273\255\377\000\000\000\377\363\347\327f"
-  "\000\000\000\377\000\000\000\377\334\265\250\377\316\221\206\377\300_X\377\266\032\031"
-  "\377\263\000\000\377\263\000\000\377\264\000\000\377\262\000\001\377\263\000\001\377\273\061\000"
-  "\377\315f\000\377\342\215\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\257\000\377\367\255\000\377\361\244\000\377\341\213\000\377\314d\000\377\272"
-  ".\000\377\262\000\000\377\262\000\000\377\270\065\061\377\303ne\377\321\232\217\377\336"
-  "\273\255\377\347\320\301\377\357\337\317\"\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\304\266\377\316\221\206\377\274"
-  "MG\377\263\000\000\377\262\000\000\377\272+\000\377\312_\000\377\337\207\000\377\357\241"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\366\254\000\377\366\253\000\377\364\250\000\377\356"
-  "\237\000\377\341\213\000\377\316i\000\377\275:\000\377\265\000\000\377\264\000\000\377\265"
-  "\000\000\377\264\000\000\377\263\000\000\377\267\030\000\377\303L\000\377\325v\000\377\346\224"
-  "\000\377\360\244\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\365"
-  "\252\000\377\352\232\000\377\327{\000\377\303N\000\377\266\016\000\377\262\000\000\377\265"
-  "\017\023\377\277_X\377\321\233\217\377\341\301\263\377\346\314\275\377\335"
-  "\271\253\377\316\221\207\377\301f_\377\275QJ\377\274PJ\377\275UN\377\275"
-  "QJ\377\274PI\377\300c[\377\314\214\202\377\334\265\250\377\345\313\274\377"
-  "\342\304\266\377\323\240\225\377\301g_\377\266\036\035\377\262\000\000\377\265"
-  "\000\000\377\300E\000\377\323r\000\377\345\223\000\377\361\245\000\377\366\253\000\377"
-  "\367\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377\304O\000\377"
-  "\307X\000\377\331~\000\377\354\235\000\377\366\253\000\377\370\257\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302"
-  "K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\366\254\000\377\356\237\000\377\335"
-  "\205\000\377\315f\000\377\312^\000\377\327z\000\377\351\230\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\366\254\000\377\365\252\000\377\361\245\000\377\350\227\000\377"
-  "\330{\000\377\305S\000\377\270!\000\377\264\000\000\377\264\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\245\000"
-  "\377\344\220\000\377\322p\000\377\303M\000\377\275\070\000\377\274\067\000\377\275\071"
-  "\000\377\273\061\000\377\270$\000\377\266\021\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\263\000\000\377\265\000\000\377\276<\000\377\320m\000\377\345\221"
-  "\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367"
-  "\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377"
-  "\263\000\000\377\273GB\377\313\210~\377\335\271\254\377\354\331\311\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303ld\377\266"
-  "\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377\351\230\000\377\364"
-  "\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\365\252\000\377\351\231\000\377\326x\000\377\305R\000\377\305"
-  "R\000\377\325v\000\377\350\226\000\377\362\246\000\377\366\254\000\377\367\254\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254"
-  "\000\377\365\252\000\377\360\243\000\377\345\222\000\377\324t\000\377\302I\000\377\266"
-  "\024\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\265\003\003\377\275"
-  "UO\377\317\224\211\377\337\275\257\377\346\314\276\377\337\275\257\377\320"
-  "\230\215\377\302kc\377\275RL\377\274OI\377\275TN\377\275QK\377\274OI\377"
-  "\277_W\377\312\206|\377\332\260\243\377\345\311\273\377\343\307\270\377\326"
-  "\247\233\377\304pg\377\267*(\377\262\000\000\377\264\000\000\377\276>\000\377\320m"
-  "\000\377\343\217\000\377\360\243\000\377\365\253\000\377\367\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331"
-  "~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\250"
-  "\000\377\347\225\000\377\325w\000\377\311\\\000\377\315f\000\377\335\204\000\377\354"
-  "\235\000\377\364\250\000\377\366\254\000\377\367\254\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\361\245\000\377\351\230"
-  "\000\377\331~\000\377\313b\000\377\311^\000\377\327z\000\377\351\230\000\377\364\251"
-  "\000\377\371\260\000\377\370\257\000\377\362\246\000\377\344\220\000\377\317k\000\377"
-  "\275:\000\377\264\000\000\377\262\000\000\377\271\070\063\377\307}s\377\333\263\246\377"
-  "\000\000\000\377\363\346\326D\364\352\331\314\000\000\000\377\000\000\000\377\332\261\244\377"
-  "\311\201x\377\274NH\377\267%\"\377\266\024\022\377\265\011\011\377\263\000\000\377"
-  "\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\361\244\000\377\341"
-  "\214\000\377\315f\000\377\273\063\000\377\263\000\000\377\263\000\000\377\272?:\377\311"
-  "\201x\377\333\265\247\377\353\326\307\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\304\266\377"
-  "\316\221\206\377\274MG\377\263\000\000\377\262\000\000\377\272+\000\377\312_\000\377"
-  "\337\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\363\247\000\377\345\222\000\377\321o\000\377\276>\000\377\265"
-  "\000\000\377\263\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\266\022\000\377\303"
-  "O\000\377\330|\000\377\353\233\000\377\365\253\000\377\370\257\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\257\000\377\365\253\000\377\353\233\000\377\330{\000\377\303N\000\377\266"
-  "\017\000\377\262\000\000\377\265\014\022\377\276YR\377\316\221\207\377\334\265\250"
-  "\377\337\275\260\377\326\247\233\377\305wo\377\270\064\063\377\263\000\000\377"
-  "\263\000\000\377\264\000\000\377\263\000\000\377\263\000\000\377\267,,\377\303pi\377\324"
-  "\242\227\377\337\274\257\377\335\267\252\377\320\226\213\377\300`X\377\266"
-  "\033\033\377\263\000\000\377\265\000\000\377\276<\000\377\314d\000\377\333\201\000\377\347"
-  "\224\000\377\356\240\000\377\363\247\000\377\366\253\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000"
-  "\377\324s\000\377\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\366\253\000"
-  "\377\370\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343"
-  "\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367"
-  "\255\000\377\370\257\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253"
-  "\000\377\355\236\000\377\332\177\000\377\307X\000\377\303N\000\377\323s\000\377\347\226"
-  "\000\377\364\251\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366"
-  "\254\000\377\355\237\000\377\334\202\000\377\307X\000\377\270#\000\377\263\000\000\377"
-  "\264\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\274\066\000\377\316h\000\377"
-  "\342\216\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\361\244\000\377\341\214\000\377\315e\000\377\273\062\000\377\264"
-  "\000\000\377\263\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\263\000\000\377\265\000\000\377\276"
-  "<\000\377\320m\000\377\345\221\000\377\362\246\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377"
-  "\272-\000\377\262\000\000\377\263\000\000\377\274LF\377\315\220\205\377\342\303\265"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235"
-  "\377\303ld\377\266\035\035\377\262\000\000\377\266\000\000\377\302J\000\377\326x\000\377"
-  "\351\231\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\365\252\000\377\351\231\000\377\326x\000\377"
-  "\304P\000\377\301H\000\377\315g\000\377\335\205\000\377\350\227\000\377\357\241\000\377"
-  "\363\250\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\257\000\377\365\252\000\377\352\232\000\377\327z\000\377"
-  "\302K\000\377\266\015\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377"
-  "\265\003\002\377\274OI\377\314\212\200\377\332\261\244\377\337\276\260\377\327"
-  "\253\237\377\310\177w\377\271><\377\263\000\000\377\262\000\000\377\264\000\000\377\263"
-  "\000\000\377\262\000\000\377\266\040\"\377\301ha\377\322\235\222\377\336\272\255\377"
-  "\336\272\255\377\322\235\221\377\302ia\377\267'%\377\263\000\000\377\264\000\000"
-  "\377\274\066\000\377\312_\000\377\331~\000\377\345\222\000\377\355\236\000\377\362\246"
-  "\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377"
-  "\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226\000\377"
-  "\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\370\256\000\377\370"
-  "\256\000\377\363\247\000\377\345\222\000\377\321n\000\377\301H\000\377\303M\000\377\321"
-  "n\000\377\340\212\000\377\352\232\000\377\360\243\000\377\364\251\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000"
-  "\377\355\236\000\377\332\177\000\377\307X\000\377\303N\000\377\323r\000\377\347\225"
-  "\000\377\364\251\000\377\371\260\000\377\370\257\000\377\362\246\000\377\343\217\000"
-  "\377\317j\000\377\274\067\000\377\263\000\000\377\262\000\000\377\270/,\377\303me\377"
-  "\322\235\222\377\340\300\262\314\000\000\000\377\000\000\000\377\364\350\330\210\000\000"
-  "\000\377\000\000\000\377\326\250\234\377\312\205{\377\301e^\377\273E@\377\266\037"
-  "\035\377\263\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361"
-  "\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377"
-  "\361\244\000\377\341\214\000\377\315f\000\377\273\063\000\377\263\000\000\377\262\000\000"
-  "\377\272C>\377\313\211~\377\340\276\261\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342"
-  "\304\266\377\316\221\206\377\274MG\377\263\000\000\377\262\000\000\377\272+\000\377"
-  "\312_\000\377\337\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\257\000\377\370\257\000\377\364\250\000\377\346\223\000\377\322o\000\377\276>"
-  "\000\377\265\000\000\377\263\000\000\377\265\000\000\377\264\000\000\377\262\000\000\377\266\016"
-  "\000\377\303N\000\377\330}\000\377\354\234\000\377\366\254\000\377\371\257\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\371\257\000\377\366\253\000\377\353\233\000\377\330|\000\377\303"
-  "N\000\377\266\023\000\377\263\000\000\377\265\003\013\377\272D?\377\304ri\377\315\216"
-  "\204\377\317\224\212\377\310\201x\377\275WS\377\265\013\027\377\261\000\000\377"
-  "\261\000\000\377\262\000\000\377\261\000\000\377\261\000\000\377\264\000\014\377\274QM\377\307"
-  "}u\377\316\223\211\377\315\220\206\377\305vm\377\273JD\377\266\023\023\377"
-  "\264\000\000\377\265\000\000\377\272,\000\377\302J\000\377\314c\000\377\326y\000\377\342"
-  "\216\000\377\355\237\000\377\365\252\000\377\367\256\000\377\370\256\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000\377"
-  "\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\366\254\000\377\371\257\000\377"
-  "\370\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000"
-  "\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\236"
-  "\000\377\331~\000\377\306V\000\377\303L\000\377\323r\000\377\350\226\000\377\365\252"
-  "\000\377\371\257\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\367\255\000\377\356"
-  "\240\000\377\334\203\000\377\307Y\000\377\270#\000\377\263\000\000\377\264\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361"
-  "\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377"
-  "\361\244\000\377\341\213\000\377\314d\000\377\272-\000\377\262\000\000\377\262\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\001\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\263\000\000\377\265\000\000\377\276<\000\377\320m\000\377\345"
-  "\221\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000"
-  "\377\263\000\000\377\274LF\377\316\221\206\377\342\305\267\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303ld\377\266"
-  "\035\035\377\261\000\000\377\266\000\000\377\302J\000\377\326y\000\377\352\231\000\377\365"
-  "\252\000\377\371\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\365\252\000\377\352\231\000\377\326y\000\377\304O\000\377\274"
-  "\070\000\377\302J\000\377\315f\000\377\330}\000\377\344\221\000\377\357\241\000\377\365"
-  "\253\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\371\257\000\377\366\253\000\377\353\233\000\377\327z\000\377\302K\000\377\265"
-  "\007\000\377\262\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\265\002\001\377\271"
-  "=\070\377\303ld\377\314\213\201\377\317\225\212\377\312\205|\377\277_Y\377"
-  "\265\035\"\377\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377"
-  "\263\000\000\377\273IF\377\306xp\377\316\222\207\377\316\222\207\377\307{r\377"
-  "\275QK\377\266\035\032\377\264\000\000\377\265\000\000\377\271'\000\377\301F\000\377\312"
-  "`\000\377\325v\000\377\341\213\000\377\354\235\000\377\364\251\000\377\367\255\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377"
-  "\304O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\345\222\000"
-  "\377\321n\000\377\277B\000\377\274\065\000\377\304O\000\377\320l\000\377\333\202\000\377"
-  "\347\225\000\377\361\244\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\371\257\000\377\367\255\000\377\355\237\000\377\332\177\000\377\306"
-  "W\000\377\302K\000\377\322q\000\377\347\225\000\377\364\251\000\377\371\260\000\377\370"
-  "\257\000\377\362\246\000\377\343\217\000\377\317i\000\377\274\065\000\377\263\000\000\377"
-  "\262\000\000\377\266!\040\377\275QK\377\306wn\377\320\227\214\377\333\265\250"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\333\264\247\377\316"
-  "\223\210\377\301g_\377\270\060,\377\263\000\000\377\264\000\000\377\274\066\000\377\316"
-  "h\000\377\342\216\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\361\244\000\377\341\214\000\377\315f\000\377\273\063\000"
-  "\377\263\000\000\377\262\000\000\377\272C>\377\313\211\177\377\340\300\262\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\342\304\266\377\316\221\206\377\274MG\377\263\000"
-  "\000\377\262\000\000\377\272+\000\377\312_\000\377\337\207\000\377\357\241\000\377\367"
-  "\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377"
-  "\345\222\000\377\321n\000\377\276>\000\377\265\000\000\377\263\000\000\377\265\000\000\377"
-  "\265\004\000\377\265\007\000\377\272,\000\377\307W\000\377\332\200\000\377\354\234\000\377"
-  "\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\363\247\000"
-  "\377\350\227\000\377\326x\000\377\302L\000\377\266\024\000\377\263\000\000\377\265\000\004"
-  "\377\267%\"\377\272A<\377\275SL\377\276XP\377\275PF\377\273>\060\377\271+"
-  "\021\377\270\"\000\377\270\"\000\377\271$\000\377\270\"\000\377\270\"\000\377\271*\016"
-  "\377\273<-\377\275ND\377\276XP\377\275TN\377\272D>\377\267)%\377\265\007\007"
-  "\377\265\000\000\377\265\000\000\377\266\025\000\377\270#\000\377\275\071\000\377\307X\000"
-  "\377\330{\000\377\350\227\000\377\364\250\000\377\370\256\000\377\370\256\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226\000\377\324s\000"
-  "\377\304O\000\377\307X\000\377\331~\000\377\354\235\000\377\365\253\000\377\367\255"
-  "\000\377\365\253\000\377\365\252\000\377\364\251\000\377\364\251\000\377\365\252\000"
-  "\377\365\253\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377"
-  "\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\355"
-  "\236\000\377\332\177\000\377\307X\000\377\303M\000\377\322o\000\377\345\222\000\377\362"
-  "\245\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377"
-  "\355\237\000\377\334\202\000\377\307X\000\377\270#\000\377\263\000\000\377\264\000\000\377"
-  "\265\000\000\377\264\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377"
-  "\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\361\244\000\377\341\214\000\377\315f\000\377\273\063\000\377\264\000\000\377\263"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\263\000\000\377\265\000\000\377\276<\000\377\320m"
-  "\000\377\345\221\000\377\362\246\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377"
-  "\262\000\000\377\263\000\000\377\274KE\377\315\220\205\377\342\303\265\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\377\327\251\235\377\303"
-  "ld\377\266\035\035\377\262\000\000\377\265\000\000\377\301H\000\377\324u\000\377\347\225"
-  "\000\377\362\246\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\365\252\000\377\352\231\000\377\327z\000\377\303M"
-  "\000\377\270\"\000\377\267\033\000\377\276<\000\377\312^\000\377\333\200\000\377\353\233"
-  "\000\377\365\252\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\365\252\000\377\353\233\000\377\331}\000\377\306U"
-  "\000\377\271*\000\377\265\005\000\377\265\004\000\377\265\001\000\377\265\000\000\377\265\000\000"
-  "\377\266\040\035\377\271>\071\377\275QK\377\276XQ\377\275RH\377\273A\064\377"
-  "\271.\026\377\271#\000\377\270\"\000\377\271$\000\377\271#\000\377\270\"\000\377\271"
-  "(\010\377\272\071)\377\275LA\377\276WO\377\276VO\377\273GA\377\267-)\377\265"
-  "\014\013\377\265\000\000\377\265\000\000\377\266\023\000\377\270!\000\377\274\066\000\377\305"
-  "S\000\377\325v\000\377\346\224\000\377\362\246\000\377\367\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370"
-  "\257\000\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324"
-  "s\000\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\370\256\000\377\370\256\000\377\363\247\000\377\346\223\000\377\322p\000\377\277"
-  "B\000\377\267\032\000\377\270\"\000\377\300D\000\377\315g\000\377\337\210\000\377\356"
-  "\240\000\377\366\253\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370"
-  "\257\000\377\366\254\000\377\355\236\000\377\332\177\000\377\307X\000\377\303N\000\377"
-  "\323r\000\377\347\225\000\377\364\251\000\377\371\260\000\377\370\257\000\377\362\246"
-  "\000\377\345\221\000\377\321o\000\377\300D\000\377\267\031\000\377\265\000\000\377\266\025"
-  "\017\377\267(%\377\272>:\377\300bZ\377\315\217\204\377\337\274\257\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\331\257\243\377\307|s\377"
-  "\271:\066\377\262\000\000\377\263\000\000\377\274\066\000\377\316h\000\377\342\216\000\377"
-  "\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\361\244\000\377\341\214\000\377\315f\000\377\273\063\000\377\263\000\000\377\262"
-  "\000\000\377\272C>\377\313\210~\377\337\276\260\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342"
-  "\304\266\377\316\221\206\377\274MG\377\263\000\000\377\262\000\000\377\272+\000\377"
-  "\312_\000\377\337\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\363\247\000\377\345\222\000\377\321n\000\377\276<"
-  "\000\377\264\000\000\377\262\000\000\377\265\000\000\377\271$\000\377\276=\000\377\306U\000\377"
-  "\322p\000\377\341\213\000\377\356\240\000\377\366\253\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377"
-  "\364\250\000\377\360\243\000\377\352\231\000\377\337\210\000\377\317k\000\377\300C"
-  "\000\377\266\021\000\377\263\000\000\377\264\000\000\377\264\000\001\377\264\000\004\377\264\000"
-  "\006\377\267\035\007\377\274\070\005\377\302L\003\377\307W\001\377\310[\000\377\310[\000"
-  "\377\310Z\000\377\310[\000\377\310[\000\377\307X\000\377\303M\002\377\275;\005\377\270"
-  "\040\007\377\265\001\007\377\264\000\004\377\265\000\002\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\263\000\000\377\265\004\000\377\277A\000\377\322q\000\377\346\224"
-  "\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\370\256\000"
-  "\377\370\257\000\377\364\251\000\377\350\226\000\377\323s\000\377\303N\000\377\306"
-  "W\000\377\331~\000\377\354\235\000\377\363\250\000\377\362\245\000\377\355\236\000\377"
-  "\352\231\000\377\351\227\000\377\351\230\000\377\353\233\000\377\357\241\000\377\363"
-  "\250\000\377\366\254\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377"
-  "\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\253\000\377\355\236\000\377\332\200\000"
-  "\377\307X\000\377\301F\000\377\313c\000\377\334\203\000\377\350\227\000\377\357\242"
-  "\000\377\363\250\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\236\000\377\333"
-  "\202\000\377\306V\000\377\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000"
-  "\377\341\214\000\377\315e\000\377\273\061\000\377\264\000\000\377\263\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000"
-  "\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\263\000\000\377\264\000\000\377\275:\000\377\320m\000\377\345\222"
-  "\000\377\363\247\000\377\370\256\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367"
-  "\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377"
-  "\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\352\324\305\377\326\250\234\377\302jb\377\265\023"
-  "\024\377\262\000\000\377\265\000\000\377\277@\000\377\316h\000\377\336\206\000\377\351\230"
-  "\000\377\360\242\000\377\364\250\000\377\366\254\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\365\252\000\377\352\231\000\377\327y\000\377\302K\000\377\265\010\000"
-  "\377\261\000\000\377\266\011\000\377\302J\000\377\326x\000\377\351\231\000\377\365\252"
-  "\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\365\253\000\377\355\237\000\377\340\212\000\377\321n\000\377\305T"
-  "\000\377\276=\000\377\271&\000\377\266\013\000\377\265\000\000\377\265\000\000\377\265\000\001"
-  "\377\264\000\004\377\265\000\006\377\267\031\007\377\274\065\006\377\302I\003\377\306V\001"
-  "\377\310Z\000\377\310[\000\377\310Z\000\377\310Z\000\377\310[\000\377\307X\000\377\304"
-  "O\002\377\276>\005\377\270$\007\377\265\005\007\377\264\000\005\377\265\000\002\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\275:\000\377"
-  "\317k\000\377\344\220\000\377\362\246\000\377\370\256\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000"
-  "\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000"
-  "\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\363\247\000\377\346\223\000\377\322o\000\377\276>"
-  "\000\377\264\000\000\377\262\000\000\377\270\040\000\377\306V\000\377\333\201\000\377\355"
-  "\236\000\377\366\254\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370"
-  "\257\000\377\366\253\000\377\355\236\000\377\332\177\000\377\307X\000\377\303O\000\377"
-  "\323r\000\377\347\225\000\377\364\251\000\377\371\257\000\377\370\257\000\377\363\250"
-  "\000\377\351\230\000\377\332\200\000\377\314d\000\377\302K\000\377\274\064\000\377\267"
-  "\036\000\377\264\000\000\377\263\000\000\377\270\061-\377\306xo\377\333\263\246\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\337\274\256\377\312\205"
-  "{\377\272?:\377\262\000\000\377\263\000\000\377\274\066\000\377\316h\000\377\342\216\000"
-  "\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370\256"
-  "\000\377\361\245\000\377\342\215\000\377\315f\000\377\273\063\000\377\263\000\000\377\262"
-  "\000\000\377\272C=\377\313\210~\377\337\276\260\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342"
-  "\304\266\377\316\221\206\377\274MG\377\263\000\000\377\262\000\000\377\272+\000\377"
-  "\312_\000\377\337\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\370\256\000\377\363\247\000\377\345\221\000\377\320m\000\377\275\071"
-  "\000\377\263\000\000\377\261\000\000\377\265\000\000\377\276<\000\377\312_\000\377\327y\000\377"
-  "\341\214\000\377\353\233\000\377\362\246\000\377\366\254\000\377\367\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\256\000\377\365\253\000"
-  "\377\357\241\000\377\345\222\000\377\332\200\000\377\317k\000\377\305R\000\377\273"
-  "\063\000\377\265\007\000\377\263\000\001\377\263\000\000\377\263\000\000\377\262\000\000\377\262"
-  "\000\000\377\270\024\000\377\304M\000\377\321m\000\377\332\177\000\377\335\205\001\377\335"
-  "\205\001\377\334\204\000\377\335\205\001\377\335\205\001\377\332\200\000\377\322p\000"
-  "\377\305Q\000\377\271\036\000\377\263\000\000\377\262\000\000\377\264\000\000\377\265\000\000"
-  "\377\265\002\001\377\265\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\276<\000\377"
-  "\322p\000\377\346\224\000\377\364\251\000\377\370\257\000\377\370\257\000\377\367\255"
-  "\000\377\370\257\000\377\371\257\000\377\365\252\000\377\350\227\000\377\323s\000\377"
-  "\303L\000\377\306V\000\377\331~\000\377\353\234\000\377\360\243\000\377\351\231\000\377"
-  "\336\207\000\377\327z\000\377\325u\000\377\326w\000\377\333\200\000\377\344\220\000\377"
-  "\356\241\000\377\366\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K"
-  "\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\355\236\000\377\333"
-  "\201\000\377\307X\000\377\275;\000\377\302I\000\377\315f\000\377\331}\000\377\344\220"
-  "\000\377\356\240\000\377\365\252\000\377\367\256\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\236\000\377\333"
-  "\201\000\377\306U\000\377\267\031\000\377\262\000\000\377\264\000\000\377\265\000\000\377\264"
-  "\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000"
-  "\377\341\213\000\377\314d\000\377\272-\000\377\263\000\000\377\263\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\001\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000"
-  "\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000"
-  "\377\263\000\000\377\262\000\000\377\263\000\000\377\275\070\000\377\320m\000\377\345\222"
-  "\000\377\363\250\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367"
-  "\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377"
-  "\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\351\324\304\377\326\247\233\377\301g_\377\265\000"
-  "\003\377\262\000\000\377\265\000\000\377\273\060\000\377\304P\001\377\317i\000\377\331~\000"
-  "\377\345\221\000\377\356\241\000\377\365\252\000\377\367\256\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370"
-  "\257\000\377\365\252\000\377\352\231\000\377\326y\000\377\302I\000\377\264\000\000\377"
-  "\260\000\000\377\264\000\000\377\301F\000\377\325w\000\377\351\231\000\377\365\252\000\377"
-  "\371\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256"
-  "\000\377\366\254\000\377\362\245\000\377\352\232\000\377\341\213\000\377\326x\000\377"
-  "\312_\000\377\276>\000\377\267\025\000\377\264\000\001\377\265\000\000\377\265\000\000\377\263"
-  "\000\000\377\262\000\000\377\267\004\000\377\302G\000\377\317j\000\377\331}\000\377\335\204"
-  "\000\377\335\205\001\377\335\204\000\377\335\204\001\377\335\205\001\377\333\201\000"
-  "\377\324s\000\377\307W\000\377\272(\000\377\263\000\000\377\262\000\000\377\264\000\000\377"
-  "\265\000\000\377\265\002\001\377\265\001\001\377\265\000\000\377\263\000\000\377\263\000\000\377"
-  "\274\064\000\377\317i\000\377\344\220\000\377\363\247\000\377\370\257\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\370\257\000\377\366\253\000\377\354\235\000\377\331~\000\377\307X\000\377\304"
-  "O\000\377\324s\000\377\350\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\345\223\000\377\321"
-  "o\000\377\275;\000\377\262\000\000\377\260\000\000\377\266\021\000\377\305S\000\377\333\201"
-  "\000\377\355\237\000\377\367\254\000\377\371\257\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256"
-  "\000\377\370\257\000\377\366\253\000\377\355\236\000\377\332\177\000\377\307X\000\377"
-  "\303O\000\377\323r\000\377\347\225\000\377\364\251\000\377\370\257\000\377\370\256"
-  "\000\377\365\252\000\377\357\241\000\377\347\225\000\377\335\205\000\377\322p\001\377"
-  "\305T\001\377\273/\000\377\264\000\000\377\261\000\000\377\266\037\035\377\305tk\377\332"
-  "\261\245\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\340\277\261"
-  "\356\313\207}\377\272@;\377\262\000\000\377\263\000\000\377\274\066\000\377\316h\000\377"
-  "\342\216\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\371\257\000"
-  "\377\370\256\000\377\362\245\000\377\342\215\000\377\315g\000\377\274\064\000\377\263"
-  "\000\000\377\262\000\000\377\272C=\377\313\210~\377\337\276\260\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\342\304\266\377\316\221\206\377\274MG\377\263\000\000\377\262\000\000"
-  "\377\272+\000\377\312_\000\377\337\207\000\377\357\241\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\370\256\000\377\363\247\000\377\346\223\000\377"
-  "\322q\000\377\300E\000\377\267\025\000\377\265\000\000\377\272,\000\377\306T\000\377\326"
-  "y\000\377\346\223\000\377\357\241\000\377\363\250\000\377\365\253\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370"
-  "\256\000\377\364\251\000\377\352\233\000\377\333\201\000\377\313`\000\377\300C\000\377"
-  "\272,\000\377\267\033\000\377\266\014\000\377\266\016\000\377\267\030\000\377\267\032\000"
-  "\377\266\016\000\377\267\032\000\377\277@\000\377\317i\000\377\337\210\000\377\352\232"
-  "\000\377\356\240\000\377\356\240\000\377\356\237\000\377\356\240\000\377\356\241\000"
-  "\377\353\234\000\377\341\213\000\377\321n\000\377\301E\000\377\267\032\000\377\265\000"
-  "\000\377\265\000\000\377\265\001\000\377\265\000\000\377\265\000\000\377\265\000\000\377\263\000"
-  "\000\377\265\000\000\377\276>\000\377\321n\000\377\344\221\000\377\362\245\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\363\247"
-  "\000\377\347\225\000\377\324t\000\377\305S\000\377\311]\000\377\334\202\000\377\354\234"
-  "\000\377\355\237\000\377\341\213\000\377\320l\000\377\304P\000\377\300C\000\377\301H"
-  "\000\377\311]\000\377\330{\000\377\347\226\000\377\362\246\000\377\367\254\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343"
-  "\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367"
-  "\255\000\377\370\257\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253"
-  "\000\377\355\236\000\377\333\201\000\377\307W\000\377\272,\000\377\270\040\000\377\276"
-  "<\000\377\310\\\000\377\330|\000\377\350\227\000\377\363\250\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254"
-  "\000\377\355\237\000\377\334\204\000\377\311\\\000\377\272.\000\377\265\000\000\377\265"
-  "\000\000\377\265\001\000\377\264\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342"
-  "\216\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\361\244\000\377\342\215\000\377\316i\000\377\275;\000\377\266\014\000"
-  "\377\265\000\000\377\265\004\000\377\265\000\000\377\265\000\000\377\265\002\000\377\266\012\000"
-  "\377\266\024\000\377\267\032\000\377\267\035\000\377\267\035\000\377\267\035\000\377\267"
-  "\035\000\377\267\035\000\377\267\035\000\377\267\034\000\377\266\017\000\377\267\033\000\377"
-  "\300C\000\377\321n\000\377\344\220\000\377\361\245\000\377\366\254\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312"
-  "`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377\342"
-  "\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\325\306\377"
-  "\330\254\240\377\304sj\377\270\064\060\377\264\000\000\377\265\002\000\377\267\033\002"
-  "\377\272*\000\377\277A\000\377\311^\000\377\332~\000\377\351\231\000\377\364\251\000"
-  "\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\365\252\000\377\352\232\000\377\330"
-  "|\000\377\305R\000\377\270\040\000\377\263\000\000\377\266\014\000\377\301H\000\377\324u"
-  "\000\377\347\226\000\377\363\247\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\365\253\000\377\363"
-  "\247\000\377\356\240\000\377\344\221\000\377\324u\000\377\303M\000\377\267\034\000\377"
-  "\264\000\000\377\264\000\000\377\265\002\000\377\265\000\000\377\266\016\000\377\275:\000\377"
-  "\314d\000\377\335\205\000\377\351\231\000\377\356\240\000\377\357\241\000\377\356\237"
-  "\000\377\356\240\000\377\357\241\000\377\354\235\000\377\343\216\000\377\323r\000\377"
-  "\303K\000\377\270\040\000\377\265\000\000\377\265\000\000\377\265\001\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\263\000\000\377\264\000\000\377\274\067\000\377\316h\000\377"
-  "\342\215\000\377\360\243\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253"
-  "\000\377\354\235\000\377\331~\000\377\307X\000\377\304O\000\377\324s\000\377\350\226"
-  "\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\363\247\000\377\346\224\000\377\323s\000\377\301F\000\377\266"
-  "\017\000\377\263\000\000\377\270\037\000\377\305T\000\377\331~\000\377\353\233\000\377\364"
-  "\251\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366"
-  "\253\000\377\355\236\000\377\332\177\000\377\307X\000\377\303O\000\377\323r\000\377\347"
-  "\225\000\377\364\251\000\377\370\257\000\377\370\256\000\377\366\254\000\377\365\252"
-  "\000\377\362\245\000\377\353\234\000\377\337\210\000\377\316g\000\377\275;\000\377\264"
-  "\000\000\377\262\000\000\377\267*(\377\305ul\377\331\257\242\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\335\271\254\377\311\203y\377\271>\071\377"
-  "\262\000\000\377\263\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\366\254\000\377\357\242"
-  "\000\377\340\212\000\377\314d\000\377\273\062\000\377\263\000\000\377\262\000\000\377\272"
-  "C=\377\313\210~\377\337\276\260\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\304\266\377"
-  "\316\221\206\377\274MG\377\263\000\000\377\262\000\000\377\272+\000\377\312_\000\377"
-  "\337\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\364\250\000\377\351\230\000\377\332\177\000\377\314c\000\377\304"
-  "Q\000\377\303M\000\377\307X\000\377\322p\000\377\341\213\000\377\356\241\000\377\366"
-  "\253\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377"
-  "\350\227\000\377\325v\000\377\301I\000\377\266\023\000\377\263\000\000\377\265\000\000\377"
-  "\270\040\000\377\275\070\000\377\302I\000\377\304Q\000\377\304Q\000\377\305S\000\377\314"
-  "d\000\377\332\177\000\377\351\230\000\377\363\250\000\377\367\255\000\377\367\255\000"
-  "\377\366\254\000\377\367\255\000\377\367\255\000\377\364\251\000\377\353\233\000\377"
-  "\334\203\000\377\315e\000\377\302J\000\377\273\063\000\377\267\035\000\377\265\000\000\377"
-  "\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\265\000\000\377\275\071\000\377"
-  "\314d\000\377\335\204\000\377\351\231\000\377\360\243\000\377\364\251\000\377\365\252"
-  "\000\377\364\251\000\377\361\244\000\377\353\233\000\377\342\214\000\377\325w\000\377"
-  "\315g\000\377\322q\000\377\341\214\000\377\355\237\000\377\354\234\000\377\334\203"
-  "\000\377\307Y\000\377\271'\000\377\263\000\000\377\265\005\000\377\276<\000\377\315e\000\377"
-  "\335\204\000\377\351\230\000\377\360\243\000\377\364\250\000\377\366\253\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K"
-  "\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377\334"
-  "\202\000\377\307W\000\377\270\"\000\377\262\000\000\377\265\000\000\377\277A\000\377\322"
-  "p\000\377\345\223\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\256\000\377\366\254\000\377\357\242\000\377\342"
-  "\215\000\377\322p\000\377\305S\000\377\275;\000\377\271&\000\377\266\017\000\377\263\000"
-  "\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361\245\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\362\246\000\377"
-  "\346\224\000\377\327y\000\377\310[\000\377\277A\000\377\272+\000\377\266\023\000\377\264"
-  "\000\000\377\264\000\000\377\265\004\000\377\271&\000\377\276=\000\377\302L\000\377\305R\000"
-  "\377\305T\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\304"
-  "Q\000\377\305R\000\377\312^\000\377\324t\000\377\340\212\000\377\352\231\000\377\360"
-  "\242\000\377\363\250\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377"
-  "\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315"
-  "\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\355"
-  "\332\313\356\336\273\256\377\316\223\210\377\303me\377\274NH\377\270\063."
-  "\377\265\020\017\377\264\000\000\377\266\015\000\377\300E\000\377\323s\000\377\347\225"
-  "\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\365\252\000\377"
-  "\355\236\000\377\336\207\000\377\317i\000\377\303M\000\377\273\061\000\377\271'\000\377"
-  "\300C\000\377\317j\000\377\337\210\000\377\353\233\000\377\361\244\000\377\364\251"
-  "\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\365\252\000\377\353\234\000\377\332\177\000\377\305"
-  "S\000\377\267\033\000\377\263\000\000\377\264\000\000\377\267\032\000\377\272/\000\377\300"
-  "D\000\377\312^\000\377\330|\000\377\347\226\000\377\362\246\000\377\367\254\000\377\367"
-  "\255\000\377\366\254\000\377\367\255\000\377\367\255\000\377\365\252\000\377\354\235"
-  "\000\377\336\207\000\377\317j\000\377\303N\000\377\274\066\000\377\270\040\000\377\265"
-  "\001\000\377\264\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\273"
-  "\062\000\377\312_\000\377\333\200\000\377\350\226\000\377\357\242\000\377\363\250\000"
-  "\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\257\000\377\366\254\000\377\354\236\000\377\331~\000\377\307W\000\377\303N\000\377"
-  "\323s\000\377\347\226\000\377\364\251\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\364\250\000\377\352\231\000\377\333\200\000"
-  "\377\313b\000\377\300F\000\377\272+\000\377\272+\000\377\303L\000\377\323r\000\377\343"
-  "\216\000\377\355\236\000\377\362\246\000\377\365\252\000\377\367\255\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370"
-  "\257\000\377\366\253\000\377\355\236\000\377\332\177\000\377\307W\000\377\303N\000\377"
-  "\323r\000\377\347\226\000\377\364\251\000\377\370\257\000\377\370\256\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\363\247\000\377\345\223\000\377\322p\000\377"
-  "\277?\000\377\264\000\000\377\262\000\000\377\267'%\377\302kc\377\323\240\224\377\342"
-  "\304\266D\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\327\251\235\377\306wn\377"
-  "\271\067\063\377\262\000\000\377\263\000\000\377\274\064\000\377\316g\000\377\342\215\000"
-  "\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\365\253\000\377\363\247\000\377\357\241"
-  "\000\377\347\225\000\377\331~\000\377\310[\000\377\272-\000\377\263\000\000\377\262\000\000"
-  "\377\272@;\377\312\207}\377\337\276\260\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342"
-  "\304\266\377\316\221\206\377\274MG\377\263\000\000\377\262\000\000\377\272+\000\377"
-  "\312_\000\377\337\207\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\367\255\000\377\365\252\000\377\356\240\000\377\345\222\000\377\335"
-  "\205\000\377\331~\000\377\330|\000\377\333\201\000\377\341\213\000\377\353\233\000\377"
-  "\363\247\000\377\367\256\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\364\250\000\377\347\226\000\377\324s\000\377\277B\000\377\264\000\000\377\261\000"
-  "\000\377\264\000\000\377\273\063\000\377\307X\000\377\322p\000\377\330|\000\377\331~\000\377"
-  "\332\177\000\377\336\206\000\377\346\224\000\377\360\242\000\377\366\254\000\377\371"
-  "\257\000\377\371\257\000\377\370\257\000\377\371\257\000\377\371\257\000\377\367\254"
-  "\000\377\361\244\000\377\350\226\000\377\335\205\000\377\322p\000\377\306U\000\377\273"
-  "\061\000\377\264\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\265"
-  "\000\000\377\272,\000\377\303N\000\377\317j\000\377\332\177\000\377\345\222\000\377\356"
-  "\240\000\377\362\246\000\377\357\241\000\377\346\223\000\377\335\205\000\377\331}\000"
-  "\377\330|\000\377\332\200\000\377\341\213\000\377\353\233\000\377\361\244\000\377\354"
-  "\234\000\377\333\201\000\377\305T\000\377\266\022\000\377\261\000\000\377\262\000\000\377"
-  "\270$\000\377\302K\000\377\316i\000\377\332\177\000\377\344\221\000\377\356\237\000\377"
-  "\364\251\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377"
-  "\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\370\256\000\377\371\257\000\377\367\255\000\377\356"
-  "\240\000\377\334\203\000\377\307X\000\377\270\040\000\377\261\000\000\377\263\000\000\377"
-  "\275\071\000\377\320m\000\377\345\222\000\377\363\247\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\254\000\377"
-  "\362\246\000\377\352\233\000\377\341\213\000\377\326x\000\377\313`\000\377\277B\000\377"
-  "\267\034\000\377\263\000\000\377\264\000\000\377\274\066\000\377\316h\000\377\342\216\000\377"
-  "\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\364\251\000\377\355\237\000\377\344\220\000\377\331~\000\377\316g\000\377\302"
-  "I\000\377\270\040\000\377\263\000\000\377\262\000\000\377\265\003\000\377\276<\000\377\311^"
-  "\000\377\324t\000\377\331~\000\377\332\200\000\377\332\177\000\377\331~\000\377\331~"
-  "\000\377\331~\000\377\331~\000\377\331~\000\377\331~\000\377\331~\000\377\331}\000\377"
-  "\331}\000\377\334\203\000\377\343\217\000\377\355\236\000\377\364\251\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000"
-  "\377\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302\377\336\273\256\377\324"
-  "\241\225\377\310\177u\377\275TM\377\266\032\034\377\262\000\000\377\264\000\000\377"
-  "\276>\000\377\322p\000\377\346\224\000\377\363\250\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\366\253\000\377\361\244\000\377\350\227\000\377\336\207\000\377"
-  "\323s\000\377\307Y\000\377\276<\000\377\275\070\000\377\305R\000\377\321m\000\377\334"
-  "\202\000\377\346\224\000\377\357\242\000\377\365\252\000\377\367\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\371\260\000\377\367\254\000\377"
-  "\355\236\000\377\332\200\000\377\305R\000\377\266\023\000\377\261\000\000\377\264\000\000"
-  "\377\272-\000\377\304O\000\377\317k\000\377\333\200\000\377\345\222\000\377\357\241"
-  "\000\377\366\253\000\377\370\257\000\377\371\257\000\377\370\257\000\377\370\257\000"
-  "\377\371\257\000\377\367\255\000\377\362\246\000\377\351\231\000\377\337\210\000\377"
-  "\324t\000\377\310Y\000\377\274\066\000\377\265\000\000\377\262\000\000\377\263\000\000\377\263"
-  "\000\000\377\263\000\000\377\264\000\000\377\271&\000\377\302J\000\377\315g\000\377\330}\000"
-  "\377\343\217\000\377\355\236\000\377\364\250\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\370\256\000\377\371\260\000\377\367\255\000\377\355\236\000\377\331"
-  "~\000\377\306U\000\377\302L\000\377\323r\000\377\347\225\000\377\364\251\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\256\000\377\367\256\000\377\365\252"
-  "\000\377\357\241\000\377\346\224\000\377\334\202\000\377\321m\000\377\304Q\000\377\274"
-  "\070\000\377\276=\000\377\307Y\000\377\324s\000\377\337\207\000\377\351\230\000\377\362"
-  "\246\000\377\367\255\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\331"
-  "~\000\377\306U\000\377\302L\000\377\323r\000\377\350\226\000\377\365\252\000\377\371"
-  "\257\000\377\370\257\000\377\367\255\000\377\370\257\000\377\371\257\000\377\364\251"
-  "\000\377\347\225\000\377\322q\000\377\276=\000\377\263\000\000\377\262\000\000\377\266\033"
-  "\034\377\275UO\377\311\201w\377\323\237\223\377\330\255\241\377\332\262\245"
-  "\377\331\257\242\377\324\243\227\377\313\211~\377\300`X\377\267*(\377\262"
-  "\000\000\377\262\000\000\377\273\060\000\377\315f\000\377\342\215\000\377\361\245\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\367\255\000\377\363\247\000\377\354\234\000\377\342\215\000\377\327{\000\377"
-  "\314d\001\377\301G\001\377\270!\000\377\263\000\000\377\262\000\000\377\271\071\064\377\312"
-  "\205{\377\337\275\257\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\304\266\377\316\221"
-  "\206\377\274MG\377\263\000\000\377\262\000\000\377\272+\000\377\312_\000\377\337\207"
-  "\000\377\357\241\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\254\000\377\364\250\000\377\360\243\000\377\355\236\000\377\353\234"
-  "\000\377\353\234\000\377\354\235\000\377\356\240\000\377\362\246\000\377\365\253\000"
-  "\377\367\255\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251"
-  "\000\377\350\226\000\377\324t\000\377\300E\000\377\265\001\000\377\262\000\000\377\267\033"
-  "\000\377\302J\000\377\322q\000\377\341\214\000\377\352\232\000\377\354\235\000\377\354"
-  "\235\000\377\355\237\000\377\360\243\000\377\364\251\000\377\367\254\000\377\367\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\256\000\377\370\256\000\377\367\255\000"
-  "\377\365\252\000\377\362\245\000\377\354\234\000\377\341\214\000\377\322o\000\377\301"
-  "I\000\377\270\037\000\377\265\000\000\377\266\015\000\377\266\020\000\377\265\007\000\377\265"
-  "\006\000\377\267\032\000\377\272-\000\377\300C\000\377\311]\000\377\331}\000\377\350\227"
-  "\000\377\360\242\000\377\351\231\000\377\332\200\000\377\316h\000\377\320k\000\377\333"
-  "\201\000\377\347\224\000\377\356\240\000\377\364\250\000\377\364\251\000\377\354\235"
-  "\000\377\333\201\000\377\306U\000\377\267\035\000\377\263\000\000\377\264\000\000\377\266"
-  "\025\000\377\272,\000\377\277B\000\377\311]\000\377\330{\000\377\347\226\000\377\363\247"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000"
-  "\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\367\255\000\377\370\256\000\377\365\253\000\377\354\235"
-  "\000\377\333\201\000\377\306V\000\377\270\040\000\377\262\000\000\377\264\000\000\377\276"
-  "=\000\377\321n\000\377\345\222\000\377\363\247\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\365\252"
-  "\000\377\363\247\000\377\356\240\000\377\345\222\000\377\327y\000\377\306T\000\377\271"
-  "&\000\377\262\000\000\377\263\000\000\377\274\066\000\377\316h\000\377\342\216\000\377\361"
-  "\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\253\000\377\364\250\000\377\360\242\000\377\351\230\000\377\334\203\000\377\313"
-  "b\000\377\275\071\000\377\265\004\000\377\264\000\000\377\271(\000\377\305S\000\377\326x\000"
-  "\377\344\220\000\377\353\233\000\377\355\236\000\377\354\235\000\377\354\234\000\377"
-  "\354\234\000\377\354\234\000\377\354\234\000\377\354\235\000\377\354\234\000\377\350"
-  "\226\000\377\335\205\000\377\322p\000\377\315f\000\377\326y\000\377\346\223\000\377\362"
-  "\246\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272"
-  "-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\332"
-  "\312\356\342\305\266\377\323\237\223\377\302jb\377\267&$\377\262\000\000\377"
-  "\264\000\000\377\277A\000\377\323q\000\377\346\224\000\377\363\250\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\254\000\377\365\252\000\377\362\246\000\377\355"
-  "\236\000\377\342\216\000\377\323r\000\377\302L\000\377\271*\000\377\272+\000\377\300"
-  "F\000\377\313b\000\377\333\201\000\377\352\232\000\377\364\251\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\366\254"
-  "\000\377\355\236\000\377\333\201\000\377\307W\000\377\271%\000\377\263\000\000\377\265"
-  "\000\000\377\275:\000\377\315e\000\377\335\205\000\377\352\231\000\377\360\243\000\377"
-  "\364\251\000\377\366\254\000\377\367\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\256\000\377\370\256\000\377\367\255\000\377\365\252\000\377\362\246\000\377\355\236"
-  "\000\377\343\217\000\377\324t\000\377\303O\000\377\270$\000\377\265\001\000\377\266\013"
-  "\000\377\266\021\000\377\265\010\000\377\265\005\000\377\267\027\000\377\272+\000\377\277"
-  "@\000\377\310Y\000\377\326w\000\377\346\223\000\377\362\245\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\370\256\000\377\365\252\000\377\354\234"
-  "\000\377\331~\000\377\307Y\000\377\305R\000\377\324u\000\377\350\226\000\377\364\251"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\366\254\000\377\364\251\000\377\361\244\000\377\353\233\000\377\337\210\000\377"
-  "\317i\000\377\277B\000\377\271&\000\377\273\060\000\377\303M\000\377\317i\000\377\336"
-  "\207\000\377\354\235\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\355"
-  "\236\000\377\332\200\000\377\310[\000\377\304Q\000\377\323s\000\377\347\225\000\377\363"
-  "\250\000\377\367\255\000\377\367\256\000\377\367\255\000\377\370\256\000\377\370\256"
-  "\000\377\364\250\000\377\347\225\000\377\323s\000\377\300E\000\377\266\015\000\377\264"
-  "\000\000\377\265\020\017\377\271\066\062\377\275TN\377\302ia\377\304sj\377\305vm"
-  "\377\305tk\377\303lc\377\276YR\377\271=\070\377\266\032\027\377\264\000\000\377"
-  "\265\000\000\377\275:\000\377\317j\000\377\343\216\000\377\361\245\000\377\367\255\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367"
-  "\255\000\377\361\244\000\377\344\220\000\377\324t\000\377\306W\000\377\276=\000\377\271"
-  ")\000\377\266\026\003\377\264\000\000\377\264\000\000\377\273ID\377\314\213\200\377\340"
-  "\277\261\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\304\266\377\316\221\206\377\274"
-  "MG\377\263\000\000\377\262\000\000\377\272+\000\377\312_\000\377\337\210\000\377\357\242"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\254\000\377\366\254\000\377\366\253\000\377\365\253\000\377\365\253"
-  "\000\377\366\253\000\377\366\253\000\377\366\254\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\226"
-  "\000\377\324t\000\377\301G\000\377\270!\000\377\271(\000\377\301G\000\377\315f\000\377"
-  "\335\205\000\377\354\234\000\377\364\251\000\377\366\254\000\377\366\253\000\377\366"
-  "\253\000\377\366\254\000\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\364\251\000\377\353\234\000\377\334\204\000\377\315f\000\377\304"
-  "O\000\377\301H\000\377\302J\000\377\300E\000\377\275\070\000\377\270#\000\377\266\012\000"
-  "\377\264\000\000\377\266\010\000\377\276>\000\377\321n\000\377\345\221\000\377\356\240"
-  "\000\377\346\223\000\377\323r\000\377\304Q\000\377\312_\000\377\334\203\000\377\355\237"
-  "\000\377\366\253\000\377\370\257\000\377\366\253\000\377\355\236\000\377\333\201\000"
-  "\377\306V\000\377\270!\000\377\263\000\000\377\264\000\000\377\265\003\000\377\264\000\000\377"
-  "\266\017\000\377\276?\000\377\320l\000\377\344\220\000\377\362\246\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313"
-  "a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\365\253\000\377\363\247\000\377\356\240\000\377\345\222\000\377\325v\000\377\304"
-  "O\000\377\267\035\000\377\262\000\000\377\264\000\000\377\276>\000\377\321o\000\377\345\222"
-  "\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\365"
-  "\253\000\377\356\237\000\377\335\205\000\377\311]\000\377\272*\000\377\262\000\000\377"
-  "\263\000\000\377\274\066\000\377\316h\000\377\343\216\000\377\361\245\000\377\367\256"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\366\254\000\377\362\245\000\377\346\224\000\377\327y\000\377\311\\\000\377"
-  "\301H\000\377\300D\000\377\305S\000\377\320m\000\377\340\212\000\377\356\240\000\377"
-  "\365\252\000\377\366\254\000\377\366\253\000\377\365\253\000\377\365\253\000\377\365"
-  "\253\000\377\366\253\000\377\366\254\000\377\366\253\000\377\360\242\000\377\340\212"
-  "\000\377\315f\000\377\303N\000\377\316h\000\377\342\214\000\377\361\245\000\377\367\256"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000"
-  "\377\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\353\326\307\377"
-  "\331\256\242\377\305tl\377\267+)\377\262\000\000\377\264\000\000\377\277B\000\377\323"
-  "r\000\377\346\224\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\364\251\000\377\353\233\000\377\331"
-  "~\000\377\305S\000\377\270\037\000\377\263\000\000\377\266\021\000\377\301G\000\377\324t"
-  "\000\377\347\225\000\377\364\250\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\256\000\377\366\253\000\377\356\240\000\377\340"
-  "\211\000\377\317j\000\377\302K\000\377\272,\000\377\270!\000\377\277B\000\377\321o\000"
-  "\377\345\222\000\377\362\246\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\365\252\000\377\355\236\000\377\337\210"
-  "\000\377\317j\000\377\304Q\000\377\301I\000\377\302I\000\377\301F\000\377\275:\000\377"
-  "\271'\000\377\266\016\000\377\264\000\000\377\265\000\000\377\274\067\000\377\315f\000\377"
-  "\341\214\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\365"
-  "\252\000\377\363\247\000\377\356\241\000\377\346\224\000\377\331}\000\377\315g\000\377"
-  "\315f\000\377\332\200\000\377\352\232\000\377\365\252\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\363\247\000\377\347\225\000\377\324t\000\377\301G\000\377\266"
-  "\015\000\377\263\000\000\377\270\040\000\377\303L\000\377\323r\000\377\343\216\000\377\355"
-  "\237\000\377\362\246\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\366\254\000\377\356\241\000\377\337\211\000\377\320"
-  "m\000\377\314c\000\377\325v\000\377\342\216\000\377\354\236\000\377\362\245\000\377\365"
-  "\252\000\377\366\254\000\377\370\256\000\377\370\256\000\377\364\251\000\377\351\231"
-  "\000\377\331~\000\377\311^\000\377\277A\000\377\272*\000\377\267\031\002\377\265\016\016"
-  "\377\266\030\032\377\266#\"\377\267)&\377\267*(\377\267)'\377\267%$\377\266"
-  "\033\034\377\265\017\021\377\266\026\004\377\271&\000\377\276<\000\377\307W\000\377\326"
-  "x\000\377\346\224\000\377\362\246\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337"
-  "\211\000\377\313b\000\377\274\064\000\377\265\000\000\377\264\000\000\377\266\037\033\377"
-  "\271\066\062\377\275QK\377\305ul\377\323\240\224\377\344\310\271\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\342\304\266\377\316\221\206\377\274MG\377\263\000\000\377"
-  "\262\000\000\377\272+\000\377\312`\000\377\337\211\000\377\360\243\000\377\370\256\000"
-  "\377\371\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\257\000\377\370\257\000"
-  "\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\371\257\000\377\365\252\000\377\350\227\000\377\324s\000\377"
-  "\301G\000\377\274\067\000\377\305Q\000\377\321o\000\377\335\204\000\377\350\227\000\377"
-  "\362\245\000\377\367\255\000\377\371\257\000\377\370\257\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000"
-  "\377\367\255\000\377\361\244\000\377\347\225\000\377\335\205\000\377\327{\000\377\326"
-  "y\000\377\326x\000\377\322o\000\377\310[\000\377\275:\000\377\265\001\000\377\260\000\000\377"
-  "\261\000\000\377\272,\000\377\316h\000\377\343\217\000\377\355\237\000\377\345\222\000"
-  "\377\321n\000\377\302I\000\377\310[\000\377\335\204\000\377\357\241\000\377\370\256"
-  "\000\377\372\261\000\377\366\254\000\377\355\236\000\377\333\201\000\377\306V\000\377"
-  "\270!\000\377\263\000\000\377\264\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\273"
-  "\063\000\377\316i\000\377\343\217\000\377\362\246\000\377\370\257\000\377\370\257\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256"
-  "\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210"
-  "\000\377\360\243\000\377\367\255\000\377\371\257\000\377\366\254\000\377\362\245\000"
-  "\377\352\232\000\377\341\213\000\377\327y\000\377\312`\000\377\277?\000\377\267\026"
-  "\000\377\262\000\000\377\264\000\000\377\276?\000\377\322p\000\377\346\224\000\377\364\250"
-  "\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\371\257\000\377\367\256\000\377\360"
-  "\243\000\377\337\210\000\377\312`\000\377\272+\000\377\262\000\000\377\263\000\000\377\274"
-  "\067\000\377\316i\000\377\343\217\000\377\362\246\000\377\370\257\000\377\370\257\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257"
-  "\000\377\365\253\000\377\356\240\000\377\343\217\000\377\332\200\000\377\326x\000\377"
-  "\325v\000\377\330|\000\377\337\211\000\377\352\231\000\377\363\247\000\377\370\256"
-  "\000\377\371\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000"
-  "\377\370\257\000\377\371\260\000\377\370\257\000\377\362\245\000\377\340\212\000\377"
-  "\313a\000\377\300C\000\377\313b\000\377\341\213\000\377\362\245\000\377\370\256\000\377"
-  "\371\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263"
-  "\000\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\355\333\313\314\332\262"
-  "\245\377\306wn\377\267,*\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377"
-  "\346\224\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\371\257\000\377\367\254\000\377\355\236\000\377\333\201\000"
-  "\377\306U\000\377\267\033\000\377\261\000\000\377\263\000\000\377\276>\000\377\322q\000\377"
-  "\347\225\000\377\364\251\000\377\371\257\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\366\254\000\377\361\245\000\377\351\227\000"
-  "\377\336\206\000\377\323r\000\377\306V\000\377\276=\000\377\301G\000\377\322q\000\377"
-  "\347\224\000\377\364\251\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\367\255\000\377\362\246\000\377\351\230\000"
-  "\377\336\207\000\377\330{\000\377\326y\000\377\326x\000\377\322q\000\377\312^\000\377"
-  "\277@\000\377\266\017\000\377\261\000\000\377\260\000\000\377\270\"\000\377\312_\000\377\340"
-  "\211\000\377\360\243\000\377\367\255\000\377\371\257\000\377\366\254\000\377\361\245"
-  "\000\377\352\231\000\377\341\214\000\377\334\202\000\377\330|\000\377\330{\000\377\334"
-  "\203\000\377\345\222\000\377\357\241\000\377\365\253\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000"
-  "\377\371\257\000\377\365\252\000\377\351\230\000\377\326w\000\377\301H\000\377\265"
-  "\002\000\377\261\000\000\377\264\000\000\377\274\064\000\377\307Y\000\377\324t\000\377\337\210"
-  "\000\377\351\230\000\377\361\244\000\377\366\253\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\366\254\000\377\362\245\000\377\350\227\000\377\336\207"
-  "\000\377\331}\000\377\330{\000\377\332\200\000\377\337\210\000\377\347\225\000\377\357"
-  "\242\000\377\365\252\000\377\370\256\000\377\370\256\000\377\365\252\000\377\356\240"
-  "\000\377\345\221\000\377\331~\000\377\316i\001\377\303N\001\377\271)\000\377\263\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\263\000\000\377\270\036\000\377\301G\001\377\314d\001\377\327z\000\377"
-  "\342\215\000\377\355\236\000\377\364\251\000\377\367\255\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\241\000"
-  "\377\336\206\000\377\311]\000\377\270$\000\377\262\000\000\377\263\000\000\377\270\063/"
-  "\377\300b[\377\313\210~\377\326\246\232\377\341\300\263\377\353\327\310\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\342\304\266\377\316\221\206\377\274MG\377\263"
-  "\000\000\377\262\000\000\377\272+\000\377\312_\000\377\336\207\000\377\357\241\000\377\366"
-  "\254\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\256\000\377\367\256\000\377\370\256\000\377\367"
-  "\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\364\250\000\377\347\225\000\377\323"
-  "s\000\377\303M\000\377\303N\000\377\321o\000\377\341\214\000\377\353\234\000\377\361"
-  "\245\000\377\365\252\000\377\367\255\000\377\370\256\000\377\370\256\000\377\367\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\367\255\000\377\364\251\000\377\360\243\000\377\354\235\000\377\352"
-  "\232\000\377\352\232\000\377\351\230\000\377\342\216\000\377\325v\000\377\305R\000\377"
-  "\270$\000\377\263\000\000\377\263\000\000\377\274\067\000\377\320l\000\377\344\220\000\377"
-  "\356\237\000\377\345\222\000\377\321o\000\377\302K\000\377\311\\\000\377\334\204\000"
-  "\377\357\241\000\377\367\255\000\377\372\261\000\377\366\254\000\377\355\236\000\377"
-  "\333\201\000\377\306V\000\377\270!\000\377\263\000\000\377\264\000\000\377\265\000\000\377"
-  "\263\000\000\377\264\000\000\377\274\065\000\377\316h\000\377\343\216\000\377\361\245\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377"
-  "\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\255\000\377\371\260"
-  "\000\377\366\253\000\377\356\240\000\377\341\213\000\377\321o\000\377\306U\000\377\276"
-  "=\000\377\271'\000\377\266\012\000\377\263\000\000\377\265\000\000\377\276>\000\377\321n\000"
-  "\377\345\222\000\377\363\247\000\377\367\256\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312_\000\377\272+\000\377\262"
-  "\000\000\377\263\000\000\377\274\066\000\377\316h\000\377\342\215\000\377\361\244\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\367\256\000\377\366\254\000\377\363\247\000\377\357\241\000\377"
-  "\353\233\000\377\351\230\000\377\351\230\000\377\352\232\000\377\355\236\000\377\361"
-  "\245\000\377\365\252\000\377\367\255\000\377\370\256\000\377\370\256\000\377\367\256"
-  "\000\377\367\256\000\377\367\256\000\377\370\256\000\377\371\257\000\377\370\256\000"
-  "\377\361\245\000\377\341\213\000\377\315e\000\377\302J\000\377\314e\000\377\341\213"
-  "\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312"
-  "`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377\342"
-  "\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\354\332\312\356\332\261\245\377\305vm\377\267,)\377\262\000"
-  "\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000"
-  "\377\366\254\000\377\354\235\000\377\332\200\000\377\306T\000\377\267\034\000\377\261"
-  "\000\000\377\264\000\000\377\277?\000\377\322p\000\377\346\223\000\377\363\247\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\365\252\000\377\361\245\000\377\354\235\000\377\342\216\000\377"
-  "\323r\000\377\304P\000\377\302J\000\377\322p\000\377\346\223\000\377\364\250\000\377"
-  "\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\367\255\000\377\365\252\000\377\361\244\000\377\355\236\000\377\352\232\000"
-  "\377\352\232\000\377\351\231\000\377\344\220\000\377\327z\000\377\307W\000\377\272"
-  "+\000\377\263\000\000\377\263\000\000\377\273\060\000\377\314c\000\377\340\212\000\377\360"
-  "\243\000\377\367\256\000\377\371\260\000\377\366\253\000\377\355\237\000\377\337\210"
-  "\000\377\322q\000\377\317k\000\377\327z\000\377\342\215\000\377\352\232\000\377\360\243"
-  "\000\377\364\250\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377"
-  "\365\251\000\377\351\230\000\377\325w\000\377\301H\000\377\266\011\000\377\262\000\000\377"
-  "\264\000\000\377\270\037\000\377\274\070\000\377\304P\000\377\317j\000\377\336\206\000\377"
-  "\354\235\000\377\365\252\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\365\252\000\377\361\245\000\377\354\235\000\377\345\222\000\377"
-  "\333\200\000\377\321n\000\377\320l\000\377\333\200\000\377\351\231\000\377\364\250"
-  "\000\377\370\256\000\377\370\256\000\377\366\254\000\377\364\250\000\377\360\242\000"
-  "\377\351\230\000\377\336\206\000\377\316h\000\377\277@\000\377\266\015\000\377\264\000"
-  "\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000"
-  "\000\377\265\000\000\377\274\067\000\377\313a\000\377\333\201\000\377\347\225\000\377\357"
-  "\241\000\377\363\247\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\241\000\377"
-  "\336\207\000\377\311^\000\377\271(\000\377\262\000\000\377\263\000\000\377\272C>\377\310"
-  "\177v\377\330\255\240\377\346\314\275\377\356\334\315\210\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\342\304\266\377\316\221\206\377\274MG\377\263\000\000\377"
-  "\262\000\000\377\271'\000\377\307X\000\377\331~\000\377\351\230\000\377\361\244\000\377"
-  "\364\251\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000"
-  "\377\365\252\000\377\363\247\000\377\356\240\000\377\343\217\000\377\324u\000\377\312"
-  "_\000\377\316h\000\377\335\204\000\377\354\235\000\377\364\251\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\366\254\000\377\366\253\000\377\365\252\000\377\365\252\000\377"
-  "\365\253\000\377\364\251\000\377\355\237\000\377\340\211\000\377\317k\000\377\303M"
-  "\000\377\276<\000\377\277?\000\377\306V\000\377\326x\000\377\347\225\000\377\356\240"
-  "\000\377\345\222\000\377\322p\000\377\303L\000\377\311]\000\377\334\203\000\377\356\240"
-  "\000\377\367\255\000\377\371\260\000\377\366\254\000\377\355\236\000\377\333\201\000"
-  "\377\306V\000\377\270!\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377"
-  "\264\000\000\377\274\064\000\377\313b\000\377\335\205\000\377\353\233\000\377\362\246"
-  "\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377"
-  "\313a\000\377\337\210\000\377\360\243\000\377\367\256\000\377\371\260\000\377\365\253"
-  "\000\377\353\234\000\377\332\177\000\377\306W\000\377\272+\000\377\265\005\000\377\265"
-  "\003\000\377\265\000\000\377\264\000\000\377\265\000\000\377\275:\000\377\315g\000\377\337\211"
-  "\000\377\354\235\000\377\363\247\000\377\365\252\000\377\366\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367"
-  "\254\000\377\357\241\000\377\336\207\000\377\312^\000\377\272*\000\377\262\000\000\377"
-  "\263\000\000\377\273\062\000\377\313a\000\377\335\204\000\377\353\233\000\377\362\246"
-  "\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\253\000\377\365\252"
-  "\000\377\365\251\000\377\365\251\000\377\365\252\000\377\365\252\000\377\366\253\000"
-  "\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\255\000\377\362"
-  "\245\000\377\344\220\000\377\323r\000\377\312^\000\377\320l\000\377\337\207\000\377\353"
-  "\234\000\377\362\245\000\377\365\252\000\377\366\254\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272"
-  "-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\354\331\311\377\332\261\244\377\305vm\377\267,)\377\262\000\000\377\264\000\000"
-  "\377\277B\000\377\323r\000\377\346\224\000\377\363\250\000\377\370\256\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000"
-  "\377\354\235\000\377\332\177\000\377\305T\000\377\267\035\000\377\262\000\000\377\264"
-  "\000\000\377\276=\000\377\317i\000\377\340\212\000\377\355\236\000\377\363\247\000\377"
-  "\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\365\251\000\377\354\235\000\377\332\200\000"
-  "\377\310Z\000\377\303L\000\377\321o\000\377\345\223\000\377\363\250\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\254\000\377\366\253\000\377\365\252\000\377\365\252\000\377\365"
-  "\253\000\377\365\251\000\377\357\241\000\377\342\215\000\377\321o\000\377\304Q\000\377"
-  "\276=\000\377\276=\000\377\305R\000\377\323q\000\377\344\220\000\377\361\245\000\377"
-  "\370\256\000\377\371\260\000\377\365\252\000\377\353\233\000\377\330|\000\377\310Y"
-  "\000\377\307X\000\377\327y\000\377\351\230\000\377\363\247\000\377\367\254\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000"
-  "\377\350\227\000\377\325v\000\377\301H\000\377\266\015\000\377\263\000\000\377\265\000\000"
-  "\377\265\005\000\377\265\001\000\377\270$\000\377\303O\000\377\326y\000\377\351\230\000\377"
-  "\364\251\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\365\252\000\377\355\236\000\377\334\204\000\377"
-  "\313a\000\377\305S\000\377\322q\000\377\345\222\000\377\363\247\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\366\254\000\377\363\247\000\377\351"
-  "\230\000\377\331~\000\377\311^\000\377\301F\000\377\277?\000\377\277C\000\377\300D\000"
-  "\377\300D\000\377\300D\000\377\300C\000\377\277@\000\377\300C\000\377\307X\000\377\326"
-  "w\000\377\346\223\000\377\361\245\000\377\366\253\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\357\241\000\377\337\207\000\377\312_\000\377\272+\000\377"
-  "\262\000\000\377\263\000\000\377\274LF\377\315\216\204\377\340\300\262\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\342\303\265\377\315\216"
-  "\204\377\273F@\377\262\000\000\377\262\000\000\377\270\035\000\377\301H\000\377\316i\001"
-  "\377\333\201\000\377\345\221\000\377\355\236\000\377\363\250\000\377\367\254\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256"
-  "\000\377\367\255\000\377\365\253\000\377\360\243\000\377\351\230\000\377\341\214\000"
-  "\377\334\202\000\377\327z\000\377\327y\000\377\335\204\000\377\350\226\000\377\362"
-  "\246\000\377\367\255\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\256\000\377\370\257\000\377\371\257\000\377\370\256\000\377\363\247"
-  "\000\377\351\230\000\377\336\206\000\377\325w\000\377\322p\000\377\323q\000\377\327z"
-  "\000\377\342\215\000\377\355\236\000\377\361\244\000\377\346\223\000\377\321n\000\377"
-  "\302I\000\377\310Z\000\377\334\203\000\377\356\240\000\377\367\255\000\377\371\260"
-  "\000\377\366\254\000\377\355\236\000\377\333\201\000\377\306V\000\377\270!\000\377\263"
-  "\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\271*\000\377\304Q"
-  "\000\377\321o\000\377\335\205\000\377\347\225\000\377\357\241\000\377\364\251\000\377"
-  "\367\255\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000"
-  "\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243"
-  "\000\377\367\256\000\377\371\260\000\377\365\253\000\377\353\233\000\377\330{\000\377"
-  "\303M\000\377\266\014\000\377\262\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377"
-  "\265\000\000\377\273/\000\377\306U\000\377\323r\000\377\337\207\000\377\350\226\000\377"
-  "\357\242\000\377\365\252\000\377\367\255\000\377\367\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\367\254\000\377\357\241\000\377\336\206\000"
-  "\377\311\\\000\377\270$\000\377\262\000\000\377\263\000\000\377\271(\000\377\304O\000\377"
-  "\321n\000\377\335\204\000\377\346\224\000\377\356\240\000\377\364\251\000\377\367\255"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\256\000\377\367\255\000\377\363\250\000\377\353\233\000\377\337\211\000\377\330"
-  "{\000\377\326y\000\377\332\177\000\377\337\211\000\377\346\224\000\377\356\240\000\377"
-  "\364\251\000\377\367\255\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242"
-  "\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE"
-  "\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305"
-  "vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000"
-  "\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000"
-  "\377\267\035\000\377\262\000\000\377\264\000\000\377\273\062\000\377\307W\000\377\324t\000"
-  "\377\337\210\000\377\350\227\000\377\360\243\000\377\365\252\000\377\367\255\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377\367\255"
-  "\000\377\357\241\000\377\334\203\000\377\310Z\000\377\302J\000\377\321n\000\377\346\223"
-  "\000\377\364\251\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370"
-  "\256\000\377\370\257\000\377\371\257\000\377\370\256\000\377\364\250\000\377\353\233"
-  "\000\377\337\210\000\377\326x\000\377\322q\000\377\322q\000\377\326x\000\377\337\210"
-  "\000\377\352\232\000\377\363\247\000\377\370\256\000\377\371\257\000\377\365\252\000"
-  "\377\352\231\000\377\326w\000\377\304P\000\377\304Q\000\377\326y\000\377\353\233\000"
-  "\377\366\253\000\377\371\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\256\000\377\364\251\000\377\350\227\000\377\325v\000\377\301H\000\377"
-  "\266\016\000\377\263\000\000\377\265\000\000\377\264\000\000\377\262\000\000\377\265\000\000\377"
-  "\300D\000\377\324u\000\377\350\227\000\377\365\252\000\377\371\257\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\371\257\000\377\367"
-  "\255\000\377\357\242\000\377\335\205\000\377\311\\\000\377\301I\000\377\317k\000\377"
-  "\344\220\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\370"
-  "\256\000\377\370\257\000\377\366\254\000\377\357\242\000\377\345\221\000\377\332\177"
-  "\000\377\324t\000\377\322q\000\377\323r\000\377\323s\000\377\323s\000\377\323s\000\377"
-  "\323s\000\377\323q\000\377\323s\000\377\330|\000\377\342\215\000\377\355\237\000\377"
-  "\365\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\357\241\000\377\337\207\000\377\312_\000\377\272+\000\377\262\000\000\377\263\000"
-  "\000\377\274NH\377\316\222\210\377\343\306\270\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\342\304\266\377\316\221\206\377\274LF\377"
-  "\264\000\000\377\263\000\000\377\266\022\000\377\273/\000\377\301G\000\377\312^\000\377\326"
-  "x\000\377\344\221\000\377\360\243\000\377\366\254\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\364"
-  "\251\000\377\352\232\000\377\334\203\000\377\322p\000\377\322q\000\377\332\200\000\377"
-  "\344\220\000\377\353\233\000\377\361\244\000\377\365\252\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\367\256\000\377\365\252\000\377\361\244\000\377\353\234"
-  "\000\377\350\226\000\377\346\224\000\377\347\224\000\377\351\230\000\377\356\237\000"
-  "\377\363\247\000\377\362\245\000\377\345\222\000\377\321n\000\377\302L\000\377\311"
-  "\\\000\377\334\203\000\377\356\240\000\377\367\255\000\377\371\260\000\377\366\254"
-  "\000\377\355\236\000\377\333\201\000\377\306V\000\377\270!\000\377\263\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\267\033\000\377\274\065\000\377\303"
-  "L\000\377\314d\000\377\331~\000\377\347\225\000\377\362\246\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377"
-  "\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\256\000\377"
-  "\371\260\000\377\365\253\000\377\353\233\000\377\330|\000\377\303N\000\377\266\022\000"
-  "\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\270\037\000"
-  "\377\274\070\000\377\304O\000\377\315g\000\377\333\201\000\377\351\230\000\377\363\247"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\370\257\000\377\367\254\000\377\357\241\000\377\336\207\000\377\312^\000\377\271*"
-  "\000\377\263\000\000\377\264\000\000\377\267\032\000\377\274\064\000\377\302K\000\377\314c"
-  "\000\377\331}\000\377\347\225\000\377\362\245\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\365\253\000\377\362\245\000\377\355\236\000\377\346\224\000\377\335\205\000"
-  "\377\324u\000\377\321n\000\377\330|\000\377\346\223\000\377\362\245\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377"
-  "\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377"
-  "\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305vm\377\267,)\377\262"
-  "\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000"
-  "\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000\377\270\036\000\377\263"
-  "\000\000\377\264\000\000\377\270\040\000\377\275\071\000\377\304Q\000\377\316h\000\377\334"
-  "\203\000\377\352\231\000\377\363\250\000\377\367\255\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\257\000\377\367\255\000\377\357\241\000\377"
-  "\334\203\000\377\311\\\000\377\303L\000\377\321n\000\377\345\223\000\377\363\250\000"
-  "\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\366\253\000\377\361\245\000\377\354\235\000"
-  "\377\350\227\000\377\346\224\000\377\346\224\000\377\350\227\000\377\354\235\000\377"
-  "\361\244\000\377\365\252\000\377\370\256\000\377\370\257\000\377\365\252\000\377\352"
-  "\231\000\377\326x\000\377\304Q\000\377\305R\000\377\326y\000\377\352\232\000\377\366"
-  "\253\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\256\000\377\364\251\000\377\350\227\000\377\325v\000\377\301H\000\377\266"
-  "\016\000\377\263\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\265\000\000\377\300"
-  "E\000\377\324u\000\377\350\227\000\377\364\251\000\377\370\257\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\367\255\000"
-  "\377\357\241\000\377\335\205\000\377\311]\000\377\302J\000\377\320k\000\377\344\221"
-  "\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\256\000"
-  "\377\370\256\000\377\367\255\000\377\364\250\000\377\357\241\000\377\352\231\000\377"
-  "\347\225\000\377\347\224\000\377\347\225\000\377\347\225\000\377\347\225\000\377\347"
-  "\225\000\377\347\225\000\377\347\224\000\377\347\225\000\377\351\230\000\377\355\237"
-  "\000\377\363\247\000\377\366\254\000\377\370\256\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\357\241\000\377\337\207\000\377\312_\000\377\272+\000\377"
-  "\262\000\000\377\263\000\000\377\274NH\377\316\222\207\377\343\305\267\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312\273\377\323\237"
-  "\223\377\303me\377\272C>\377\267($\377\266\034\027\377\266\010\000\377\266\022"
-  "\000\377\274\067\000\377\312`\000\377\336\206\000\377\356\240\000\377\366\254\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\363\247\000\377\346\223\000\377\323r\000\377\306V\000\377\313"
-  "b\000\377\334\203\000\377\354\235\000\377\364\251\000\377\366\254\000\377\367\254\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377"
-  "\366\253\000\377\364\251\000\377\364\250\000\377\364\250\000\377\364\250\000\377\363"
-  "\250\000\377\363\250\000\377\362\246\000\377\356\240\000\377\342\216\000\377\322q\000"
-  "\377\310[\000\377\317i\000\377\340\211\000\377\357\242\000\377\367\255\000\377\371"
-  "\260\000\377\366\254\000\377\355\236\000\377\333\201\000\377\306V\000\377\270!\000\377"
-  "\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\010\000\377"
-  "\266\011\000\377\267\034\000\377\277@\000\377\317j\000\377\342\215\000\377\361\244\000"
-  "\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246"
-  "\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243"
-  "\000\377\367\256\000\377\371\260\000\377\365\253\000\377\353\233\000\377\330|\000\377"
-  "\304P\000\377\267\031\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\266\011\000\377\266\012\000\377\270\040\000\377\300E\000\377\321n\000\377"
-  "\344\220\000\377\362\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\360\243\000\377\341\214\000"
-  "\377\317k\000\377\301F\000\377\271(\000\377\267\027\000\377\266\022\000\377\265\007\000\377"
-  "\267\032\000\377\276?\000\377\316h\000\377\341\214\000\377\360\243\000\377\367\255\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\365\252\000\377\360\242"
-  "\000\377\342\215\000\377\320m\000\377\306U\000\377\315g\000\377\340\211\000\377\360\243"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377"
-  "\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315"
-  "\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305vm\377\267"
-  ",)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000\377\270\036"
-  "\000\377\263\000\000\377\264\000\000\377\266\011\000\377\266\012\000\377\270\"\000\377\301"
-  "G\000\377\322q\000\377\345\222\000\377\362\246\000\377\367\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\366\254\000\377\357\241"
-  "\000\377\337\210\000\377\316i\000\377\310[\000\377\323r\000\377\343\216\000\377\357\241"
-  "\000\377\364\250\000\377\366\253\000\377\366\254\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\366\253\000\377\365\252"
-  "\000\377\364\250\000\377\363\250\000\377\363\250\000\377\364\250\000\377\365\252\000"
-  "\377\366\253\000\377\367\254\000\377\370\256\000\377\370\257\000\377\365\252\000\377"
-  "\352\232\000\377\326y\000\377\305S\000\377\305S\000\377\326y\000\377\352\232\000\377"
-  "\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256"
-  "\000\377\370\256\000\377\364\251\000\377\350\227\000\377\325v\000\377\301H\000\377\266"
-  "\015\000\377\263\000\000\377\265\000\000\377\265\000\000\377\263\000\000\377\266\013\000\377\300"
-  "C\000\377\321o\000\377\343\217\000\377\357\241\000\377\364\251\000\377\366\253\000\377"
-  "\367\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\254\000"
-  "\377\357\241\000\377\335\204\000\377\311^\000\377\303L\000\377\320m\000\377\344\221"
-  "\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000\377\364\251\000\377"
-  "\364\250\000\377\363\250\000\377\364\250\000\377\364\250\000\377\364\250\000\377\364"
-  "\250\000\377\364\250\000\377\363\250\000\377\364\250\000\377\364\251\000\377\365\252"
-  "\000\377\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\367\255\000\377\357\241\000\377\337\207\000\377\312_\000\377\272+\000\377"
-  "\262\000\000\377\263\000\000\377\274MG\377\316\221\206\377\342\304\266\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\326\307\252\336\273"
-  "\256\377\322\235\221\377\310~u\377\277\\U\377\270\064\060\377\264\000\000\377\262"
-  "\000\000\377\267\033\000\377\306V\000\377\333\202\000\377\355\236\000\377\366\254\000\377"
-  "\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\370\257\000\377\363\250\000\377\345\221\000\377\317k\000\377\301G\000\377\310"
-  "Z\000\377\335\204\000\377\357\241\000\377\367\255\000\377\371\257\000\377\367\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\256\000\377\366"
-  "\253\000\377\361\244\000\377\352\232\000\377\343\216\000\377\334\203\000\377\326x\000"
-  "\377\325v\000\377\333\202\000\377\347\225\000\377\362\245\000\377\367\255\000\377\371"
-  "\260\000\377\366\254\000\377\355\236\000\377\333\201\000\377\306V\000\377\270!\000\377"
-  "\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\263\000\000\377\263\000\000\377\272,\000\377\313b\000\377\341\213\000\377\361\244\000\377"
-  "\370\256\000\377\371\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000"
-  "\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243"
-  "\000\377\367\256\000\377\371\260\000\377\365\253\000\377\353\233\000\377\330|\000\377"
-  "\304P\000\377\267\031\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\273\062\000\377\315g\000\377"
-  "\342\215\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\362\246\000\377\350\227\000"
-  "\377\334\202\000\377\320l\000\377\306U\000\377\275;\000\377\267\034\000\377\263\000\000"
-  "\377\262\000\000\377\271)\000\377\312`\000\377\337\210\000\377\360\242\000\377\367\255"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370\257\000\377\363"
-  "\247\000\377\344\220\000\377\317j\000\377\302I\000\377\311^\000\377\336\205\000\377\357"
-  "\242\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000"
-  "\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377"
-  "\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305vm"
-  "\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377"
-  "\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256"
-  "\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000\377"
-  "\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\263\000\000\377\264\000\000\377"
-  "\274\067\000\377\317k\000\377\344\220\000\377\363\247\000\377\370\257\000\377\370\257"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\254\000\377"
-  "\361\245\000\377\347\225\000\377\333\201\000\377\325v\000\377\326x\000\377\334\203"
-  "\000\377\343\217\000\377\352\231\000\377\360\243\000\377\365\252\000\377\367\255\000"
-  "\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\370\256\000\377\371\257\000\377"
-  "\366\253\000\377\353\233\000\377\327z\000\377\305T\000\377\305S\000\377\326y\000\377"
-  "\352\232\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\227\000\377\324u\000\377"
-  "\300D\000\377\265\000\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\265"
-  "\010\000\377\275\070\000\377\311]\000\377\327z\000\377\343\216\000\377\353\234\000\377"
-  "\362\246\000\377\366\254\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000"
-  "\377\367\254\000\377\357\241\000\377\335\204\000\377\311^\000\377\303L\000\377\320"
-  "m\000\377\344\221\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\371\257\000\377\367\256\000\377\360\243\000\377\337\210\000\377\312`\000"
-  "\377\272+\000\377\262\000\000\377\263\000\000\377\274MG\377\316\221\206\377\342\304"
-  "\266\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\353\327\310\210\343\305\267\377\327\251\235\377\310\177v\377\273HC\377\264"
-  "\000\000\377\262\000\000\377\267\033\000\377\306V\000\377\333\202\000\377\355\236\000\377"
-  "\366\254\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\370\257\000\377\363\247\000\377\344\221\000\377\317k\000\377"
-  "\301H\000\377\310[\000\377\335\204\000\377\357\242\000\377\367\255\000\377\371\257"
-  "\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\370\257\000\377"
-  "\370\257\000\377\364\251\000\377\352\232\000\377\335\204\000\377\324t\000\377\324t"
-  "\000\377\333\201\000\377\343\216\000\377\351\231\000\377\360\242\000\377\364\251\000"
-  "\377\367\255\000\377\370\257\000\377\366\253\000\377\355\236\000\377\333\201\000\377"
-  "\306V\000\377\270!\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\272,\000\377\313b\000\377\340\212"
-  "\000\377\360\244\000\377\367\256\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367"
-  "\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337"
-  "\210\000\377\360\243\000\377\367\256\000\377\371\260\000\377\365\253\000\377\353\233"
-  "\000\377\330|\000\377\304P\000\377\267\031\000\377\263\000\000\377\264\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\273\063\000"
-  "\377\316g\000\377\342\215\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\255\000\377\365\251\000"
-  "\377\360\243\000\377\352\231\000\377\341\213\000\377\324t\000\377\305S\000\377\271"
-  ")\000\377\263\000\000\377\262\000\000\377\271)\000\377\312`\000\377\337\210\000\377\360\242"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370"
-  "\257\000\377\363\247\000\377\344\220\000\377\317j\000\377\302I\000\377\311^\000\377\336"
-  "\205\000\377\357\242\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000"
-  "\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261"
-  "\244\377\305vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377"
-  "\346\224\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000"
-  "\377\305T\000\377\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\263\000\000"
-  "\377\264\000\000\377\274\066\000\377\317j\000\377\344\220\000\377\362\246\000\377\370"
-  "\256\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\367\255\000\377\364\251\000\377\357\242\000\377\351\231\000\377\343\216\000\377"
-  "\333\200\000\377\324t\000\377\324t\000\377\335\204\000\377\352\231\000\377\364\250"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\370\257\000\377\365\253\000\377\352\232\000\377\327y\000\377\305S\000\377\305"
-  "S\000\377\326y\000\377\352\232\000\377\365\252\000\377\370\257\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\350\227"
-  "\000\377\325u\000\377\300F\000\377\265\003\000\377\263\000\000\377\264\000\000\377\265\000\000"
-  "\377\264\000\000\377\265\004\000\377\271&\000\377\277A\000\377\307Y\000\377\322p\000\377"
-  "\337\210\000\377\354\235\000\377\365\252\000\377\370\256\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\257\000\377\367\254\000\377\357\241\000\377\335\204\000\377\311^\000\377\303"
-  "L\000\377\320m\000\377\344\221\000\377\363\247\000\377\370\256\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\360\242\000\377\337\210\000"
-  "\377\312`\000\377\272+\000\377\262\000\000\377\263\000\000\377\274MG\377\316\221\206"
-  "\377\342\304\266\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\341\302\264\377\317\223\210\377\275TM"
-  "\377\264\000\000\377\262\000\000\377\270!\000\377\307X\000\377\334\202\000\377\355\237"
-  "\000\377\366\254\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\254\000\377\366\254\000\377\365\251\000\377\357\242\000\377\343\216\000\377\322"
-  "o\000\377\307X\000\377\316g\000\377\337\211\000\377\357\242\000\377\367\254\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\256\000\377\362\246\000\377\344\220\000\377\322p\000\377\307X\000\377\316"
-  "g\000\377\336\207\000\377\355\236\000\377\364\250\000\377\366\253\000\377\366\254\000"
-  "\377\367\256\000\377\370\257\000\377\366\253\000\377\355\236\000\377\333\201\000\377"
-  "\306V\000\377\270!\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\272.\000\377\312_\000\377\335\205"
-  "\000\377\354\235\000\377\364\250\000\377\366\254\000\377\366\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367"
-  "\256\000\377\362\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337"
-  "\210\000\377\360\243\000\377\367\256\000\377\371\260\000\377\365\253\000\377\353\233"
-  "\000\377\330|\000\377\304P\000\377\267\031\000\377\263\000\000\377\264\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\274\067\000"
-  "\377\316h\000\377\343\216\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000"
-  "\377\366\254\000\377\364\250\000\377\355\236\000\377\336\206\000\377\313a\000\377\273"
-  "\060\000\377\263\000\000\377\263\000\000\377\272.\000\377\313a\000\377\340\211\000\377\360"
-  "\242\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377"
-  "\370\256\000\377\362\246\000\377\343\217\000\377\317k\000\377\302K\000\377\312`\000\377"
-  "\336\206\000\377\357\242\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255"
-  "\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263"
-  "\000\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261"
-  "\244\377\305vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377"
-  "\346\224\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000"
-  "\377\305T\000\377\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000"
-  "\377\265\000\000\377\274\067\000\377\315g\000\377\340\212\000\377\356\240\000\377\364"
-  "\251\000\377\366\254\000\377\367\254\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\366\254\000\377\366\253\000\377\363\250\000\377\355\236\000\377"
-  "\336\206\000\377\315g\000\377\307X\000\377\322q\000\377\344\221\000\377\362\246\000\377"
-  "\367\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365"
-  "\253\000\377\361\245\000\377\346\224\000\377\324t\000\377\304P\000\377\305S\000\377\327"
-  "y\000\377\352\232\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\352\231\000\377\330"
-  "|\000\377\306V\000\377\273\061\000\377\267\027\000\377\266\016\000\377\265\002\000\377\265"
-  "\000\000\377\265\000\000\377\266\016\000\377\267\026\000\377\272,\000\377\303M\000\377\323"
-  "r\000\377\344\220\000\377\357\242\000\377\365\252\000\377\366\254\000\377\367\254\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\257\000\377\367\254\000\377\357\241\000\377\335\204\000\377\311^\000\377\303L\000\377"
-  "\320m\000\377\344\221\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\366\254\000\377\366\253\000\377\363\250\000\377\353\234\000\377\333\202\000\377\310"
-  "[\000\377\271)\000\377\262\000\000\377\263\000\000\377\274MG\377\316\221\206\377\342"
-  "\304\266\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\345\313\274\377\321\232\217\377\276XQ\377\264"
-  "\000\000\377\262\000\000\377\270!\000\377\307X\000\377\334\202\000\377\355\237\000\377\366"
-  "\254\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\366\253\000"
-  "\377\362\245\000\377\354\234\000\377\345\222\000\377\335\205\000\377\326x\000\377\323"
-  "s\000\377\332\177\000\377\346\224\000\377\362\245\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370"
-  "\256\000\377\362\246\000\377\342\215\000\377\315f\000\377\301G\000\377\312`\000\377\337"
-  "\210\000\377\360\244\000\377\367\256\000\377\370\257\000\377\367\255\000\377\367\256"
-  "\000\377\370\257\000\377\366\253\000\377\355\236\000\377\333\201\000\377\306V\000\377"
-  "\270!\000\377\263\000\001\377\264\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\264"
-  "\000\000\377\263\000\000\377\264\000\000\377\271&\000\377\305Q\000\377\323s\001\377\340\212"
-  "\000\377\351\231\000\377\360\243\000\377\364\251\000\377\367\255\000\377\367\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362"
-  "\246\000\377\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360"
-  "\243\000\377\367\256\000\377\371\260\000\377\365\253\000\377\353\233\000\377\330|\000"
-  "\377\304P\000\377\267\031\000\377\263\000\001\377\264\000\000\377\265\000\000\377\264\000\000"
-  "\377\264\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\274\066\000\377\317i\000"
-  "\377\343\217\001\377\362\246\000\377\370\256\000\377\370\257\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257"
-  "\000\377\370\256\000\377\361\245\000\377\342\214\000\377\315f\000\377\273\063\000\377"
-  "\263\000\000\377\262\000\000\377\272.\000\377\313a\000\377\340\211\000\377\360\242\000\377"
-  "\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\371\257\000\377\370\257\000"
-  "\377\363\247\000\377\344\220\000\377\317j\000\377\302I\000\377\311^\000\377\336\206"
-  "\000\377\357\242\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377"
-  "\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377"
-  "\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244"
-  "\377\305vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346"
-  "\224\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377"
-  "\305T\000\377\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377"
-  "\265\000\000\377\273/\000\377\307X\000\377\326x\000\377\342\216\000\377\353\233\000\377"
-  "\361\244\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\360\243\000\377\337\207\000"
-  "\377\312_\000\377\301G\000\377\316g\000\377\343\216\000\377\362\246\000\377\370\256"
-  "\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\366\254\000\377\363\247\000\377\356\237\000"
-  "\377\346\224\000\377\333\201\000\377\314c\000\377\301F\000\377\305R\000\377\327z\000"
-  "\377\352\232\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\256\000\377\370\256\000\377\365\252\000\377\355\237\000\377\341\213"
-  "\000\377\324s\000\377\311\\\000\377\300D\000\377\272*\000\377\266\012\000\377\264\000\000"
-  "\377\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\273\061\000\377\310[\000"
-  "\377\327z\000\377\343\217\000\377\354\234\000\377\361\245\000\377\365\253\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\371\260\000"
-  "\377\367\255\000\377\357\242\000\377\335\205\000\377\311]\000\377\302J\000\377\320"
-  "k\000\377\344\221\000\377\363\247\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\255\000\377\364"
-  "\251\000\377\360\242\000\377\351\230\000\377\337\211\000\377\322p\001\377\303N\000\377"
-  "\270\040\000\377\262\000\000\377\263\000\000\377\273HB\377\315\217\205\377\342\303\265"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\346\314\275\377\321\233\220\377\276XR\377\264\000\000\377\262"
-  "\000\000\377\270!\000\377\307X\000\377\334\202\000\377\355\237\000\377\366\254\000\377"
-  "\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\370\256\000\377\370\256\000\377\364\251\000\377\353\233"
-  "\000\377\337\207\000\377\326x\000\377\326w\000\377\333\201\000\377\342\215\000\377\350"
-  "\227\000\377\357\241\000\377\364\251\000\377\367\255\000\377\367\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370\256\000\377"
-  "\362\246\000\377\342\215\000\377\315e\000\377\300E\000\377\312_\000\377\337\210\000\377"
-  "\361\244\000\377\370\256\000\377\371\257\000\377\367\255\000\377\367\256\000\377\370"
-  "\257\000\377\366\253\000\377\355\236\000\377\333\201\000\377\306V\000\377\270!\000\377"
-  "\263\000\001\377\264\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377"
-  "\264\000\000\377\264\000\000\377\267\031\000\377\275:\000\377\306T\001\377\320k\000\377\333"
-  "\202\000\377\350\226\000\377\362\245\000\377\367\254\000\377\370\256\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377"
-  "\343\216\000\377\316i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377"
-  "\367\256\000\377\371\260\000\377\365\253\000\377\353\233\000\377\330|\000\377\304P"
-  "\000\377\267\031\000\377\263\000\001\377\264\000\000\377\265\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\263\000\000\377\264\000\000\377\274\066\000\377\317i\000\377\343\217"
-  "\001\377\362\246\000\377\370\256\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\370"
-  "\256\000\377\361\245\000\377\342\215\000\377\315f\000\377\273\063\000\377\263\000\000\377"
-  "\262\000\000\377\272.\000\377\313a\000\377\340\211\000\377\360\242\000\377\367\255\000"
-  "\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\371\260\000\377\370\257\000\377\363\247"
-  "\000\377\344\220\000\377\317j\000\377\301I\000\377\311^\000\377\335\205\000\377\357\242"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377"
-  "\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315"
-  "\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305vm\377\267"
-  ",)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000\377\270\037"
-  "\000\377\263\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\270!\000"
-  "\377\277?\000\377\307Y\000\377\322o\000\377\336\206\000\377\352\231\000\377\363\247"
-  "\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\371\257\000\377\370\256\000\377\360\244\000\377\337\210\000\377\312^\000\377\300E"
-  "\000\377\315f\000\377\342\216\000\377\362\246\000\377\370\257\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\365\252\000\377\356\240\000\377\343\216\000\377\326x\000\377\313a"
-  "\000\377\300E\000\377\274\065\000\377\304P\000\377\327{\000\377\352\232\000\377\365\252"
-  "\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\366\254\000\377\362\246\000\377\354\235\000\377\344\220\000\377\331"
-  "~\000\377\313c\000\377\276>\000\377\266\022\000\377\264\000\000\377\265\000\000\377\265\000"
-  "\000\377\264\000\000\377\264\000\000\377\267\035\000\377\276?\000\377\310Z\000\377\323q\000"
-  "\377\337\210\000\377\353\233\000\377\364\250\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\256\000\377\370\257\000\377\371\260\000\377\367\256\000\377\357\242"
-  "\000\377\335\205\000\377\311\\\000\377\302I\000\377\317k\000\377\344\220\000\377\363"
-  "\247\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\366\254\000\377\361\244\000\377\347\225\000\377"
-  "\332\200\000\377\317j\000\377\305R\001\377\275\070\000\377\267\024\000\377\263\000\000\377"
-  "\263\000\000\377\273GB\377\315\217\204\377\342\303\265\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312"
-  "\274\377\321\232\216\377\276XQ\377\264\000\000\377\262\000\000\377\270!\000\377\307"
-  "X\000\377\334\202\000\377\355\237\000\377\366\254\000\377\370\257\000\377\367\256\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377"
-  "\367\254\000\377\365\252\000\377\357\242\000\377\342\215\000\377\321o\000\377\310Y"
-  "\000\377\315g\000\377\334\203\000\377\351\230\000\377\360\243\000\377\364\250\000\377"
-  "\366\253\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\254\000\377\367\254\000\377\365\252\000\377\357\242\000\377\341\213\000"
-  "\377\317j\000\377\305T\000\377\316i\000\377\341\213\000\377\361\244\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000"
-  "\377\355\236\000\377\333\201\000\377\306V\000\377\270!\000\377\263\000\000\377\264\000"
-  "\000\377\266\023\020\377\267($\377\270\066\061\377\271;\066\377\270\064\060\377\267"
-  "%\"\377\266\027\016\377\267\027\000\377\271'\000\377\300E\000\377\317i\000\377\341\213"
-  "\000\377\357\242\000\377\366\254\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\367\256\000\377\362\246\000\377\343\216\000\377\316"
-  "i\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\256\000\377\371"
-  "\260\000\377\365\253\000\377\353\233\000\377\330|\000\377\304P\000\377\267\031\000\377"
-  "\263\000\000\377\264\000\001\377\266\026\023\377\267*&\377\271\067\062\377\271:\066\377"
-  "\267-/\377\266\037\040\377\274\070\013\377\315e\000\377\340\212\000\377\357\241\000"
-  "\377\365\252\000\377\367\254\000\377\367\254\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244"
-  "\000\377\341\214\000\377\315e\000\377\273\063\000\377\263\000\000\377\262\000\000\377\272"
-  ".\000\377\313a\000\377\340\211\000\377\360\242\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\366\254\000\377\365\253\000\377\364\251\000\377\364"
-  "\250\000\377\364\250\000\377\364\250\000\377\364\250\000\377\364\250\000\377\364\250"
-  "\000\377\364\250\000\377\364\251\000\377\364\251\000\377\357\242\000\377\342\215\000"
-  "\377\320m\000\377\306T\000\377\315g\000\377\340\211\000\377\360\243\000\377\367\255"
-  "\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377"
-  "\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377"
-  "\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305vm\377\267,)\377\262"
-  "\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000"
-  "\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000\377\270\037\000\377\263"
-  "\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\266\016\000\377\267"
-  "\032\000\377\272-\000\377\302K\000\377\322p\000\377\344\220\000\377\361\245\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000"
-  "\377\367\255\000\377\360\243\000\377\341\213\000\377\316h\000\377\305T\000\377\320"
-  "k\000\377\341\214\000\377\357\242\000\377\365\252\000\377\367\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\256\000"
-  "\377\364\251\000\377\352\232\000\377\331~\000\377\310Y\000\377\274\065\000\377\266\021"
-  "\000\377\270\"\000\377\304O\000\377\330{\000\377\352\232\000\377\365\252\000\377\370"
-  "\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\366\253\000\377\365\251\000\377\360\243\000\377\346\223\000\377"
-  "\324u\000\377\302K\000\377\267\027\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\266\017\000\377\267\033\000\377\273/\000\377\303N\000\377\324"
-  "s\000\377\345\222\000\377\362\246\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\253\000\377"
-  "\364\251\000\377\364\251\000\377\365\252\000\377\363\250\000\377\354\235\000\377\334"
-  "\204\000\377\313b\000\377\306U\000\377\323r\000\377\346\223\000\377\363\247\000\377\370"
-  "\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\370\256\000\377\366\254\000\377\356\240\000\377\337\210\000\377\315f\000\377\277"
-  "B\000\377\271%\000\377\267\026\000\377\266\026\016\377\265\017\016\377\270.+\377\300"
-  "aY\377\321\231\216\377\344\307\271\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312\273\377\321\232"
-  "\216\377\276XQ\377\264\000\000\377\262\000\000\377\270!\000\377\307X\000\377\334\202"
-  "\000\377\355\237\000\377\366\254\000\377\370\257\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\366\253\000\377\362\246\000\377"
-  "\354\235\000\377\344\220\000\377\326x\000\377\307W\000\377\276?\000\377\305T\000\377"
-  "\325v\000\377\343\217\000\377\354\235\000\377\362\245\000\377\365\253\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\366\253\000\377"
-  "\362\245\000\377\354\235\000\377\345\222\000\377\334\203\000\377\323s\000\377\321n"
-  "\000\377\331}\000\377\347\224\000\377\362\246\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\355\236\000\377\333"
-  "\201\000\377\306V\000\377\270\040\000\377\263\000\000\377\264\000\000\377\270\060+\377\276"
-  "XQ\377\304ri\377\307{r\377\304pg\377\275SM\377\267*&\377\264\000\000\377\263"
-  "\000\000\377\271'\000\377\311\\\000\377\336\206\000\377\357\241\000\377\367\255\000\377"
-  "\371\260\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\371\257\000\377\370\257"
-  "\000\377\362\246\000\377\343\217\000\377\317i\000\377\302K\000\377\313a\000\377\337\210"
-  "\000\377\360\243\000\377\367\256\000\377\371\260\000\377\365\253\000\377\353\233\000"
-  "\377\330|\000\377\304P\000\377\267\030\000\377\263\000\000\377\265\000\005\377\270\065\060"
-  "\377\277\\T\377\305tk\377\307{r\377\302ke\377\274MH\377\274<!\377\307W\000"
-  "\377\327y\000\377\344\220\000\377\354\235\000\377\362\245\000\377\365\252\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000"
-  "\377\367\255\000\377\361\244\000\377\341\214\000\377\315e\000\377\273\063\000\377\263"
-  "\000\000\377\262\000\000\377\272.\000\377\313a\000\377\340\211\000\377\360\242\000\377\367"
-  "\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\364\251\000\377\360\242"
-  "\000\377\353\233\000\377\350\226\000\377\347\225\000\377\347\225\000\377\347\225\000"
-  "\377\347\225\000\377\347\225\000\377\347\225\000\377\347\226\000\377\347\225\000\377"
-  "\344\221\000\377\335\205\000\377\324u\000\377\321m\000\377\330|\000\377\346\223\000\377"
-  "\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242"
-  "\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE"
-  "\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305"
-  "vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000"
-  "\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000"
-  "\377\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\264\000\000\377\264\000\000\377\273\062\000\377\315e\000\377\341\214"
-  "\000\377\361\244\000\377\370\256\000\377\370\257\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\370\256\000\377\367\255\000\377\362\246\000\377\346\224\000\377\330"
-  "}\000\377\321n\000\377\324t\000\377\335\205\000\377\346\223\000\377\354\235\000\377\362"
-  "\245\000\377\365\252\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\257\000\377\365\252\000\377\351\227\000\377\325v\000\377\301G\000\377"
-  "\265\000\000\377\261\000\000\377\266\023\000\377\304O\000\377\330{\000\377\352\232\000\377"
-  "\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377\365\252\000"
-  "\377\353\233\000\377\330|\000\377\304O\000\377\267\030\000\377\263\000\000\377\264\000\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\263\000\000\377\264\000\000"
-  "\377\274\067\000\377\317i\000\377\343\217\000\377\362\246\000\377\370\256\000\377\371"
-  "\257\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\364\251"
-  "\000\377\357\242\000\377\352\232\000\377\350\226\000\377\347\226\000\377\347\225\000"
-  "\377\343\217\000\377\333\201\000\377\323r\000\377\322q\000\377\335\204\000\377\352"
-  "\232\000\377\364\251\000\377\367\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377"
-  "\334\202\000\377\307X\000\377\270!\000\377\263\000\000\377\264\000\000\377\267-)\377\274"
-  "OI\377\303of\377\315\217\204\377\332\262\245\377\350\322\303\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\345\312\273\377\321\232\216\377\276XQ\377\264\000\000\377\262\000\000\377\270"
-  "!\000\377\307X\000\377\334\202\000\377\355\237\000\377\366\254\000\377\370\257\000\377"
-  "\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\370\256\000\377\370\257\000\377\371\257\000\377\370\256\000\377\364"
-  "\250\000\377\353\233\000\377\337\210\000\377\323s\000\377\310Z\000\377\276=\000\377\271"
-  "*\000\377\276<\000\377\310Z\000\377\324s\000\377\337\210\000\377\352\233\000\377\363"
-  "\250\000\377\370\256\000\377\371\257\000\377\370\257\000\377\370\256\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\256\000\377\370\257\000\377\371\257\000\377\370\256\000"
-  "\377\364\250\000\377\352\232\000\377\336\207\000\377\327y\000\377\326x\000\377\332"
-  "\177\000\377\340\211\000\377\347\224\000\377\356\240\000\377\364\251\000\377\367\255"
-  "\000\377\367\256\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000"
-  "\377\355\236\000\377\333\201\000\377\306V\000\377\270\037\000\377\262\000\000\377\264"
-  "\000\000\377\273FA\377\307}s\377\324\241\225\377\331\256\241\377\322\236\222"
-  "\377\305wn\377\271>\071\377\263\000\000\377\262\000\000\377\270\040\000\377\310[\000\377"
-  "\336\206\000\377\357\241\000\377\367\256\000\377\371\260\000\377\370\257\000\377\370"
-  "\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256"
-  "\000\377\370\257\000\377\371\260\000\377\370\257\000\377\363\247\000\377\343\217\000"
-  "\377\317j\000\377\302K\000\377\313a\000\377\337\210\000\377\360\243\000\377\367\256"
-  "\000\377\371\260\000\377\365\253\000\377\353\233\000\377\330|\000\377\304P\000\377\267"
-  "\025\000\377\262\000\000\377\265\002\013\377\274MG\377\311\202y\377\325\244\230\377"
-  "\330\255\241\377\320\231\217\377\304ph\377\274B\063\377\277>\000\377\310Y\000"
-  "\377\323s\000\377\337\210\000\377\352\232\000\377\363\247\000\377\367\255\000\377\370"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\361\244\000\377\341\214\000\377\315e\000\377\273\063\000\377\263\000\000\377\262"
-  "\000\000\377\272.\000\377\313a\000\377\340\211\000\377\360\242\000\377\367\255\000\377"
-  "\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256"
-  "\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000"
-  "\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377\370\256\000\377"
-  "\370\257\000\377\371\257\000\377\367\255\000\377\361\244\000\377\347\225\000\377\334"
-  "\202\000\377\325v\000\377\323r\000\377\323s\000\377\324s\000\377\324t\000\377\324s\000"
-  "\377\323s\000\377\323r\000\377\323r\000\377\324s\000\377\326x\000\377\332\177\000\377"
-  "\337\210\000\377\346\224\000\377\356\237\000\377\364\251\000\377\367\255\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377"
-  "\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377\342\303\265"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\354\331\311\377\332\261\244\377\305vm\377\267,)\377\262\000\000\377\264"
-  "\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250\000\377\370\256\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000\377\366\253"
-  "\000\377\354\235\000\377\332\177\000\377\305T\000\377\270\037\000\377\263\000\000\377\264"
-  "\000\000\377\265\000\000\377\265\001\000\377\265\000\000\377\265\000\000\377\263\000\000\377\263"
-  "\000\000\377\272-\000\377\314d\000\377\341\214\000\377\361\245\000\377\370\256\000\377"
-  "\371\257\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\255"
-  "\000\377\364\251\000\377\356\240\000\377\346\224\000\377\340\211\000\377\332\177\000"
-  "\377\327y\000\377\330{\000\377\337\210\000\377\352\232\000\377\363\247\000\377\367"
-  "\255\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\371\257\000\377\365"
-  "\252\000\377\351\230\000\377\325u\000\377\300D\000\377\264\000\000\377\261\000\000\377\266"
-  "\021\000\377\304O\000\377\330{\000\377\352\232\000\377\365\252\000\377\370\257\000\377"
-  "\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\370\256\000\377\371\257\000\377\366\253\000\377\353\234\000\377\331}\000\377"
-  "\304P\000\377\267\031\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\001\000\377"
-  "\265\000\000\377\265\000\000\377\263\000\000\377\263\000\000\377\273\063\000\377\316h\000\377"
-  "\343\217\000\377\362\246\000\377\370\257\000\377\371\260\000\377\370\257\000\377\370"
-  "\257\000\377\371\257\000\377\367\255\000\377\361\244\000\377\346\224\000\377\333\201"
-  "\000\377\325u\000\377\323q\000\377\323s\000\377\325w\000\377\330}\000\377\335\204\000\377"
-  "\342\215\000\377\351\231\000\377\360\243\000\377\365\253\000\377\367\255\000\377\367"
-  "\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377"
-  "\370\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\257\000"
-  "\377\366\254\000\377\355\236\000\377\333\201\000\377\306U\000\377\267\031\000\377\262"
-  "\000\000\377\263\000\000\377\272C>\377\305vm\377\323\236\223\377\336\273\255\377"
-  "\350\320\301\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312\273\377\321\232\216\377\276"
-  "XQ\377\264\000\000\377\262\000\000\377\270!\000\377\307X\000\377\334\202\000\377\355\237"
-  "\000\377\366\254\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\254\000\377\366\253\000\377\365\252\000\377\365\252\000"
-  "\377\366\253\000\377\365\252\000\377\357\241\000\377\342\215\000\377\321o\000\377\303"
-  "N\000\377\273\062\000\377\270\036\000\377\267\030\000\377\267\035\000\377\273\060\000\377"
-  "\302K\000\377\320l\000\377\341\213\000\377\356\240\000\377\364\251\000\377\366\253"
-  "\000\377\365\252\000\377\365\252\000\377\366\253\000\377\367\254\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\254\000\377\366\253\000\377\365\252\000"
-  "\377\365\252\000\377\365\253\000\377\365\252\000\377\357\242\000\377\342\216\000\377"
-  "\323s\000\377\314d\000\377\323r\000\377\341\213\000\377\354\235\000\377\362\246\000\377"
-  "\365\252\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\257\000\377\366\253\000\377\355\236\000\377\333\201\000\377\306V\000"
-  "\377\270\036\000\377\262\000\000\377\264\000\000\377\275UN\377\317\225\212\377\340\277"
-  "\262\377\347\316\277\377\336\273\256\377\315\216\203\377\274LF\377\263\000"
-  "\000\377\262\000\000\377\271&\000\377\310Z\000\377\334\203\000\377\354\235\000\377\364"
-  "\251\000\377\366\253\000\377\365\252\000\377\365\252\000\377\365\252\000\377\365\252"
-  "\000\377\365\252\000\377\365\252\000\377\365\252\000\377\365\252\000\377\366\253\000"
-  "\377\365\252\000\377\360\242\000\377\341\213\000\377\315f\000\377\302J\000\377\313"
-  "a\000\377\337\210\000\377\360\243\000\377\367\256\000\377\371\260\000\377\365\253\000"
-  "\377\353\233\000\377\330|\000\377\304P\000\377\267\023\000\377\262\000\000\377\265\007\017"
-  "\377\277]V\377\321\233\220\377\342\303\265\377\346\316\277\377\334\267\252"
-  "\377\312\206}\377\273G>\377\267\020\000\377\272'\000\377\303N\000\377\322q\000\377"
-  "\343\217\000\377\361\244\000\377\367\255\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\361\244\000\377\341\214\000"
-  "\377\315e\000\377\273\063\000\377\263\000\000\377\262\000\000\377\272.\000\377\313a\000\377"
-  "\340\211\000\377\360\242\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\366\254\000\377\365\253\000\377\365\252\000\377\365\252\000"
-  "\377\365\252\000\377\365\252\000\377\365\252\000\377\365\252\000\377\365\252\000\377"
-  "\365\252\000\377\365\252\000\377\365\252\000\377\365\252\000\377\366\253\000\377\363"
-  "\250\000\377\353\233\000\377\334\203\000\377\314d\000\377\302J\000\377\277@\000\377\300"
-  "C\000\377\300D\000\377\300D\000\377\300D\000\377\300E\000\377\300E\000\377\302I\000\377"
-  "\307X\000\377\323r\000\377\340\212\000\377\353\234\000\377\362\245\000\377\365\252"
-  "\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377"
-  "\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377"
-  "\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244"
-  "\377\305vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346"
-  "\224\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377"
-  "\305T\000\377\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\273\060\000\377\313b\000\377"
-  "\337\211\000\377\357\241\000\377\365\253\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\365\252\000"
-  "\377\362\245\000\377\354\234\000\377\337\210\000\377\321n\000\377\312^\000\377\323"
-  "q\000\377\343\217\000\377\361\245\000\377\367\255\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\366\254\000\377\362\246\000\377\346\224\000\377\323s\000\377"
-  "\300E\000\377\265\000\000\377\262\000\000\377\266\024\000\377\304O\000\377\330{\000\377\352"
-  "\232\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\370\256\000\377\370\257\000\377"
-  "\365\252\000\377\353\233\000\377\330|\000\377\304O\000\377\267\030\000\377\263\000\000\377"
-  "\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377"
-  "\264\000\000\377\274\066\000\377\315g\000\377\341\214\000\377\357\242\000\377\365\252"
-  "\000\377\366\253\000\377\365\252\000\377\365\252\000\377\366\253\000\377\363\247\000"
-  "\377\353\233\000\377\334\202\000\377\314c\000\377\301H\000\377\276<\000\377\300D\000"
-  "\377\307Y\000\377\324u\000\377\342\215\000\377\354\235\000\377\361\245\000\377\364"
-  "\251\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\254\000\377\366\253\000\377"
-  "\365\252\000\377\365\252\000\377\365\252\000\377\365\252\000\377\365\252\000\377\366"
-  "\253\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377"
-  "\334\202\000\377\307X\000\377\270!\000\377\262\000\000\377\264\000\000\377\275RK\377\315"
-  "\217\204\377\337\275\257\377\354\331\311\356\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\345\312\273\377\321\232\216\377\276XQ\377\264\000\000\377\262\000\000\377\270"
-  "!\000\377\307X\000\377\334\203\000\377\356\237\000\377\367\254\000\377\371\257\000\377"
-  "\370\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367"
-  "\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256"
-  "\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000"
-  "\377\367\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\365\252\000\377"
-  "\361\244\000\377\355\236\000\377\352\232\000\377\352\232\000\377\351\231\000\377\344"
-  "\220\000\377\327z\000\377\307W\000\377\272*\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\264\000\000\377\264\000\000\377\271%\000\377\305S\000\377\326w\000\377\343\217\000"
-  "\377\351\230\000\377\352\232\000\377\352\232\000\377\354\235\000\377\360\243\000\377"
-  "\365\251\000\377\367\255\000\377\370\256\000\377\370\256\000\377\367\256\000\377\367"
-  "\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256"
-  "\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000"
-  "\377\367\256\000\377\370\256\000\377\370\256\000\377\367\255\000\377\365\252\000\377"
-  "\361\244\000\377\355\236\000\377\352\232\000\377\352\232\000\377\351\231\000\377\346"
-  "\223\000\377\335\204\000\377\323q\000\377\320l\000\377\332~\000\377\350\227\000\377\363"
-  "\250\000\377\370\256\000\377\370\257\000\377\367\256\000\377\367\256\000\377\367\256"
-  "\000\377\367\256\000\377\370\256\000\377\371\257\000\377\366\254\000\377\355\236\000"
-  "\377\333\201\000\377\306V\000\377\270\036\000\377\262\000\000\377\264\000\000\377\277[T"
-  "\377\323\237\223\377\346\314\276\377\000\000\000\377\344\307\271\377\320\226\213"
-  "\377\274NH\377\263\000\000\377\262\000\000\377\270\040\000\377\304Q\000\377\325v\000\377"
-  "\342\216\000\377\351\230\000\377\353\233\000\377\352\231\000\377\352\231\000\377\352"
-  "\231\000\377\352\231\000\377\352\231\000\377\352\231\000\377\352\231\000\377\352\231"
-  "\000\377\352\232\000\377\352\232\000\377\345\223\000\377\331}\000\377\310[\000\377\300"
-  "F\000\377\313b\000\377\337\211\000\377\360\243\000\377\370\256\000\377\372\261\000\377"
-  "\366\253\000\377\353\234\000\377\331}\000\377\304P\000\377\267\022\000\377\262\000\000\377"
-  "\265\012\021\377\301d\\\377\325\246\232\377\350\320\301\377\000\000\000\377\342\303"
-  "\265\377\315\220\205\377\273IC\377\263\000\000\377\263\000\000\377\273\061\000\377\314"
-  "c\000\377\340\212\000\377\360\243\000\377\367\256\000\377\371\257\000\377\370\256\000"
-  "\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377"
-  "\367\256\000\377\370\256\000\377\371\257\000\377\370\256\000\377\361\244\000\377\342"
-  "\214\000\377\315f\000\377\273\063\000\377\263\000\000\377\262\000\000\377\272.\000\377\313"
-  "b\000\377\340\212\000\377\360\243\000\377\367\255\000\377\371\257\000\377\370\256\000"
-  "\377\367\256\000\377\367\256\000\377\367\256\000\377\370\256\000\377\370\256\000\377"
-  "\367\256\000\377\366\253\000\377\362\246\000\377\356\237\000\377\352\232\000\377\351"
-  "\231\000\377\351\231\000\377\352\231\000\377\352\231\000\377\352\231\000\377\352\231"
-  "\000\377\352\231\000\377\352\231\000\377\352\231\000\377\352\232\000\377\352\233\000"
-  "\377\350\227\000\377\340\212\000\377\321o\000\377\301I\000\377\267\033\000\377\264\000"
-  "\000\377\265\000\000\377\265\007\000\377\265\001\000\377\265\007\000\377\270\037\000\377\274\064"
-  "\000\377\302J\000\377\313b\000\377\331~\000\377\350\226\000\377\363\247\000\377\367\256"
-  "\000\377\370\257\000\377\367\256\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370\257\000\377"
-  "\367\255\000\377\357\242\000\377\337\210\000\377\312`\000\377\272-\000\377\262\000\000"
-  "\377\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377"
-  "\332\261\244\377\305vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323"
-  "r\000\377\346\224\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332"
-  "\177\000\377\305T\000\377\270\037\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\272+\000\377\307X"
-  "\000\377\327{\000\377\345\222\000\377\355\237\000\377\362\246\000\377\365\252\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\367\256\000\377\370\257"
-  "\000\377\370\256\000\377\362\245\000\377\342\215\000\377\316h\000\377\303L\000\377\314"
-  "d\000\377\340\211\000\377\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\370\256\000\377\366\254"
-  "\000\377\364\251\000\377\360\243\000\377\351\230\000\377\335\205\000\377\315g\000\377"
-  "\276>\000\377\265\000\000\377\262\000\000\377\266\025\000\377\304O\000\377\330{\000\377\352"
-  "\232\000\377\365\252\000\377\370\257\000\377\370\256\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000"
-  "\377\367\256\000\377\367\256\000\377\367\256\000\377\370\256\000\377\371\257\000\377"
-  "\366\253\000\377\353\233\000\377\330|\000\377\304O\000\377\267\030\000\377\263\000\000\377"
-  "\264\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377"
-  "\264\000\000\377\273\060\000\377\311\\\000\377\331~\000\377\345\222\000\377\352\232\000"
-  "\377\352\232\000\377\352\231\000\377\352\232\000\377\352\232\000\377\350\227\000\377"
-  "\340\211\000\377\321n\000\377\301G\000\377\267\027\000\377\263\000\000\377\265\010\000\377"
-  "\276>\000\377\315f\000\377\335\204\000\377\351\227\000\377\357\242\000\377\364\250"
-  "\000\377\366\254\000\377\370\256\000\377\370\256\000\377\367\256\000\377\367\256\000"
-  "\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377\367\256\000\377"
-  "\370\256\000\377\370\256\000\377\367\255\000\377\365\252\000\377\361\245\000\377\355"
-  "\236\000\377\352\232\000\377\351\230\000\377\351\231\000\377\353\234\000\377\357\241"
-  "\000\377\363\247\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377\334"
-  "\202\000\377\307X\000\377\270!\000\377\262\000\000\377\264\000\000\377\276XQ\377\321\231"
-  "\216\377\345\311\273\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312"
-  "\273\377\321\232\216\377\276XQ\377\264\000\000\377\262\000\000\377\270\"\000\377\307"
-  "Y\000\377\334\204\000\377\356\240\000\377\367\255\000\377\371\260\000\377\370\257\000"
-  "\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377"
-  "\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\371\257\000\377\367\256\000\377\362\246\000\377\351\230\000"
-  "\377\336\207\000\377\330|\000\377\327y\000\377\326y\000\377\323q\000\377\312^\001\377"
-  "\277?\000\377\266\016\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377"
-  "\263\000\000\377\266\005\000\377\276<\000\377\311\\\001\377\322p\000\377\326x\000\377\327"
-  "y\000\377\330{\000\377\336\206\000\377\350\226\000\377\361\245\000\377\367\255\000\377"
-  "\371\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000"
-  "\377\371\257\000\377\367\256\000\377\362\246\000\377\351\230\000\377\337\207\000\377"
-  "\330|\000\377\326x\000\377\326y\000\377\327z\000\377\330|\000\377\332\200\000\377\337"
-  "\207\000\377\347\224\000\377\360\243\000\377\367\254\000\377\371\260\000\377\371\260"
-  "\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\371\257\000"
-  "\377\371\260\000\377\367\255\000\377\356\237\000\377\334\202\000\377\307W\000\377\270"
-  "\036\000\377\262\000\000\377\264\000\000\377\277\\U\377\324\241\225\377\347\317\300"
-  "\377\000\000\000\377\344\311\273\377\320\226\213\377\274KE\377\263\000\000\377\262"
-  "\000\000\377\267\023\000\377\276?\000\377\311]\001\377\322p\000\377\326y\000\377\327{\000"
-  "\377\327z\000\377\327y\000\377\327y\000\377\327y\000\377\327y\000\377\327y\000\377\327"
-  "y\000\377\327y\000\377\327z\000\377\327z\000\377\324t\000\377\313a\000\377\301F\000\377"
-  "\276>\000\377\314c\000\377\340\212\000\377\361\244\000\377\371\257\000\377\372\262"
-  "\000\377\366\254\000\377\354\234\000\377\331}\000\377\304Q\000\377\267\022\000\377\261"
-  "\000\000\377\265\013\021\377\301e]\377\326\250\233\377\351\322\303\377\000\000\000\377"
-  "\343\306\267\377\316\221\207\377\273ID\377\262\000\000\377\261\000\000\377\271(\000"
-  "\377\313a\000\377\340\212\000\377\361\244\000\377\370\256\000\377\371\260\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\371\260\000\377\370\257\000\377\362\245\000"
-  "\377\342\215\000\377\315f\000\377\273\063\000\377\263\000\000\377\262\000\000\377\272/\000"
-  "\377\313b\000\377\340\212\000\377\361\244\000\377\370\256\000\377\371\260\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\371\257"
-  "\000\377\370\256\000\377\364\250\000\377\353\233\000\377\341\213\000\377\331}\000\377"
-  "\326x\000\377\326x\000\377\327y\000\377\327y\000\377\327y\000\377\327y\000\377\327y\000"
-  "\377\327y\000\377\327y\000\377\327z\000\377\327{\000\377\326x\000\377\320l\000\377\306"
-  "U\000\377\273\062\000\377\264\000\000\377\262\000\000\377\263\000\000\377\263\000\000\377\262"
-  "\000\000\377\263\000\000\377\270#\000\377\303M\000\377\320k\000\377\334\202\000\377\346\224"
-  "\000\377\360\242\000\377\366\254\000\377\371\260\000\377\371\260\000\377\370\257\000"
-  "\377\370\256\000\377\367\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377\337"
-  "\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217"
-  "\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305vm\377\267,)"
-  "\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000\377\270\037"
-  "\000\377\263\000\001\377\264\000\000\377\265\000\000\377\264\000\000\377\264\000\000\377\264\000"
-  "\000\377\263\000\000\377\264\000\000\377\270\036\000\377\300C\000\377\312`\001\377\325v\000"
-  "\377\340\212\000\377\353\233\000\377\363\247\000\377\367\255\000\377\370\256\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367"
-  "\256\000\377\370\256\000\377\370\257\000\377\372\261\000\377\371\260\000\377\363\250"
-  "\000\377\343\217\000\377\316g\000\377\301H\000\377\313a\000\377\337\210\000\377\360\243"
-  "\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377\370\256\000\377\370"
-  "\256\000\377\371\257\000\377\371\257\000\377\366\253\000\377\357\241\000\377\345\222"
-  "\000\377\332~\000\377\317i\000\377\304O\000\377\272/\000\377\265\000\000\377\262\000\000\377"
-  "\267\026\000\377\304O\000\377\330{\000\377\352\232\000\377\365\252\000\377\370\257\000"
-  "\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\256\000\377\370\256\000\377\370\256\000\377\370\257\000\377\370\257\000\377\370"
-  "\257\000\377\371\257\000\377\371\260\000\377\366\254\000\377\354\234\000\377\331}\000"
-  "\377\304P\000\377\267\031\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000\000"
-  "\377\265\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\270$\000\377\301H\000\377"
-  "\314c\000\377\324t\000\377\327z\000\377\327z\000\377\327y\000\377\327z\000\377\327z\000"
-  "\377\326w\000\377\320l\000\377\305T\000\377\273\060\000\377\264\000\000\377\262\000\000\377"
-  "\263\000\000\377\271(\000\377\303N\000\377\317j\000\377\332\200\000\377\345\223\000\377"
-  "\357\242\000\377\366\253\000\377\370\257\000\377\371\257\000\377\370\257\000\377\370"
-  "\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\371\257\000\377\370\256\000\377\363\247\000\377\351\231\000"
-  "\377\337\210\000\377\330|\000\377\325w\000\377\326x\000\377\333\201\000\377\344\220"
-  "\000\377\356\237\000\377\365\252\000\377\367\255\000\377\367\256\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377\334"
-  "\202\000\377\307X\000\377\270!\000\377\262\000\000\377\264\000\000\377\276YR\377\321\233"
-  "\220\377\346\314\275\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312"
-  "\273\377\321\232\216\377\276XQ\377\264\000\000\377\262\000\000\377\270!\000\377\307"
-  "W\000\377\333\201\000\377\354\235\000\377\365\252\000\377\367\255\000\377\366\253\000"
-  "\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377"
-  "\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366"
-  "\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253"
-  "\000\377\366\253\000\377\366\254\000\377\364\251\000\377\355\236\000\377\337\207\000"
-  "\377\317j\000\377\305R\000\377\302I\000\377\302J\000\377\301G\000\377\275:\000\377\271"
-  "&\000\377\266\021\006\377\265\022\024\377\266\037\036\377\267%\"\377\266\040\037\377"
-  "\265\024\025\377\266\020\007\377\271$\000\377\275\071\000\377\301F\000\377\302J\000\377"
-  "\302I\000\377\304P\000\377\316g\000\377\335\205\000\377\354\234\000\377\364\251\000\377"
-  "\366\254\000\377\366\254\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366"
-  "\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253"
-  "\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000"
-  "\377\366\254\000\377\365\252\000\377\355\236\000\377\337\210\000\377\317k\000\377\305"
-  "Q\000\377\300F\000\377\302J\000\377\310[\000\377\324s\000\377\340\212\000\377\352\232"
-  "\000\377\360\242\000\377\363\247\000\377\365\252\000\377\366\253\000\377\366\253\000"
-  "\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\254\000\377"
-  "\367\255\000\377\364\251\000\377\353\234\000\377\332\177\000\377\306U\000\377\270\035"
-  "\000\377\262\000\000\377\264\000\000\377\277[T\377\323\240\224\377\346\315\276\377"
-  "\000\000\000\377\345\312\273\377\321\233\220\377\276ZS\377\266\030\027\377\264\000"
-  "\000\377\266\021\005\377\271%\000\377\275\071\000\377\301F\000\377\302L\000\377\303M\000"
-  "\377\303L\000\377\303L\000\377\303L\000\377\303L\000\377\303L\000\377\303L\000\377\303"
-  "L\000\377\303L\000\377\303M\000\377\303L\000\377\301H\000\377\275\071\000\377\271&\000\377"
-  "\274\065\000\377\313a\000\377\337\210\000\377\357\241\000\377\366\254\000\377\370\256"
-  "\000\377\364\251\000\377\352\231\000\377\330{\000\377\304O\000\377\267\021\000\377\262"
-  "\000\000\377\265\013\021\377\301d]\377\326\246\232\377\350\321\302\377\000\000\000\377"
-  "\342\304\266\377\316\220\206\377\273IC\377\263\000\000\377\262\000\000\377\272-\000"
-  "\377\312`\000\377\337\210\000\377\356\241\000\377\365\253\000\377\367\254\000\377\366"
-  "\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253"
-  "\000\377\366\253\000\377\366\253\000\377\367\254\000\377\366\253\000\377\357\242\000"
-  "\377\340\212\000\377\314d\000\377\273\062\000\377\263\000\000\377\262\000\000\377\272-\000"
-  "\377\312`\000\377\337\207\000\377\356\240\000\377\365\253\000\377\367\254\000\377\366"
-  "\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\254"
-  "\000\377\365\253\000\377\357\242\000\377\342\215\000\377\322q\000\377\306V\000\377\302"
-  "I\000\377\302I\000\377\303L\000\377\303L\000\377\303L\000\377\303L\000\377\303L\000\377"
-  "\303L\000\377\303L\000\377\303L\000\377\303M\000\377\302K\000\377\300D\000\377\274\065"
-  "\000\377\270\036\000\377\265\001\000\377\264\000\000\377\265\000\000\377\265\000\000\377\263\000"
-  "\000\377\264\000\000\377\274\064\000\377\313a\000\377\334\202\000\377\351\227\000\377\357"
-  "\242\000\377\363\247\000\377\365\252\000\377\366\253\000\377\366\253\000\377\366\253"
-  "\000\377\366\253\000\377\366\254\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\370\257\000\377\367\255\000\377\357\242\000\377"
-  "\337\210\000\377\312`\000\377\272-\000\377\262\000\000\377\263\000\000\377\274KE\377\315"
-  "\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305vm\377\267"
-  ",)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\346\224\000\377\363\250"
-  "\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\257\000\377\366\253\000\377\354\235\000\377\332\177\000\377\305T\000\377\270\036"
-  "\000\377\263\000\000\377\264\000\000\377\265\012\010\377\266\031\026\377\267\"\037\377\267"
-  "%\"\377\266\037\036\377\266\024\023\377\266\025\006\377\270$\000\377\274\067\000\377"
-  "\305R\000\377\322q\000\377\343\217\000\377\360\243\000\377\367\255\000\377\370\256"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\366\254\000\377\366\253\000\377\366\253\000\377\367\254\000\377\366\254\000\377"
-  "\360\243\000\377\341\213\000\377\315f\000\377\302J\000\377\313c\000\377\340\211\000\377"
-  "\360\243\000\377\367\255\000\377\370\257\000\377\367\255\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\366\254\000\377\366\254\000"
-  "\377\366\253\000\377\366\254\000\377\366\254\000\377\362\246\000\377\350\226\000\377"
-  "\330|\000\377\311]\000\377\277A\000\377\272+\000\377\267\032\000\377\265\000\000\377\263"
-  "\000\000\377\267\027\000\377\304O\000\377\330{\000\377\352\232\000\377\365\252\000\377\370"
-  "\257\000\377\370\256\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\254\000\377\366\254\000\377\366\253\000\377\366\253\000\377\366\253\000"
-  "\377\366\253\000\377\366\254\000\377\367\254\000\377\364\250\000\377\351\231\000\377"
-  "\327z\000\377\303N\000\377\267\030\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265"
-  "\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\266\023\000\377\272"
-  "+\000\377\276=\000\377\301H\000\377\303L\000\377\303M\000\377\303L\000\377\303L\000\377"
-  "\303M\000\377\302K\000\377\300C\000\377\274\064\000\377\267\035\000\377\265\000\000\377\264"
-  "\000\000\377\265\000\000\377\267\027\000\377\272+\000\377\277A\000\377\311]\000\377\330|\000"
-  "\377\350\226\000\377\362\246\000\377\366\254\000\377\366\254\000\377\366\253\000\377"
-  "\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366\253\000\377\366"
-  "\253\000\377\366\253\000\377\366\254\000\377\365\252\000\377\356\237\000\377\340\211"
-  "\000\377\320l\000\377\305R\000\377\300E\000\377\302J\000\377\312^\000\377\330|\000\377"
-  "\350\227\000\377\363\250\000\377\370\256\000\377\370\256\000\377\367\255\000\377\367"
-  "\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255"
-  "\000\377\367\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377\334\202\000"
-  "\377\307X\000\377\270!\000\377\262\000\000\377\264\000\000\377\276XQ\377\321\232\217"
-  "\377\345\312\274\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312"
-  "\273\377\321\231\216\377\276VO\377\264\000\000\377\262\000\000\377\267\033\000\377\304"
-  "O\000\377\325v\000\377\343\217\000\377\353\233\000\377\355\236\000\377\354\235\000\377"
-  "\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354"
-  "\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235"
-  "\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000"
-  "\377\354\235\000\377\355\236\000\377\353\233\000\377\343\216\000\377\324t\000\377\303"
-  "N\000\377\270#\000\377\265\000\000\377\265\000\000\377\266\004\000\377\265\000\000\377\265\000"
-  "\000\377\266\036\033\377\273E@\377\277_X\377\302ia\377\300`Y\377\273HB\377\267"
-  "\"\036\377\265\000\000\377\265\000\000\377\266\002\000\377\265\002\000\377\265\000\000\377\270"
-  "\037\000\377\302K\000\377\322q\000\377\342\214\000\377\352\232\000\377\355\236\000\377"
-  "\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354"
-  "\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235"
-  "\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\355\236\000"
-  "\377\353\233\000\377\343\217\000\377\324u\000\377\304O\000\377\270#\000\377\264\000\000"
-  "\377\265\000\000\377\276:\000\377\315d\000\377\335\204\000\377\350\226\000\377\354\235"
-  "\000\377\354\235\000\377\354\234\000\377\354\235\000\377\354\235\000\377\354\235\000"
-  "\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\355\236\000\377"
-  "\353\233\000\377\343\217\000\377\324t\000\377\303M\000\377\267\030\000\377\262\000\000\377"
-  "\264\000\000\377\276YR\377\322\236\222\377\346\314\276\377\000\000\000\377\350\321"
-  "\302\377\331\257\242\377\311\203y\377\277_W\377\272@;\377\267\"\037\377\265"
-  "\000\000\377\265\000\000\377\266\002\000\377\266\012\000\377\266\017\000\377\266\022\000\377\266"
-  "\024\000\377\266\024\000\377\266\024\000\377\266\024\000\377\266\024\000\377\266\024\000\377"
-  "\266\024\000\377\266\024\000\377\266\024\000\377\266\023\000\377\265\000\000\377\265\000\000"
-  "\377\272+\000\377\307Y\000\377\330|\000\377\346\223\000\377\354\235\000\377\356\237"
-  "\000\377\352\232\000\377\341\214\000\377\322p\000\377\301H\000\377\266\012\000\377\262"
-  "\000\000\377\265\000\010\377\300c[\377\325\246\232\377\350\320\301\377\000\000\000\377"
-  "\342\304\265\377\315\217\205\377\273GA\377\263\000\000\377\263\000\000\377\271)\000"
-  "\377\307X\000\377\330|\000\377\346\223\000\377\354\234\000\377\355\236\000\377\354"
-  "\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235"
-  "\000\377\354\235\000\377\354\235\000\377\355\236\000\377\354\235\000\377\346\224\000"
-  "\377\331~\000\377\310[\000\377\272-\000\377\263\000\000\377\263\000\000\377\271)\000\377"
-  "\307X\000\377\330|\000\377\346\223\000\377\354\234\000\377\355\236\000\377\354\235"
-  "\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\355\236\000"
-  "\377\354\234\000\377\345\222\000\377\330{\000\377\307X\000\377\272-\000\377\265\000\000"
-  "\377\265\000\000\377\266\010\000\377\266\006\000\377\266\006\000\377\266\007\000\377\266\007\000"
-  "\377\266\007\000\377\266\007\000\377\266\007\000\377\266\007\000\377\266\006\000\377\266\002\000"
-  "\377\265\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\264\000\000"
-  "\377\263\000\000\377\265\000\000\377\274\065\000\377\313a\000\377\333\202\000\377\347\225"
-  "\000\377\354\234\000\377\354\235\000\377\354\234\000\377\354\234\000\377\354\234\000"
-  "\377\354\235\000\377\357\241\000\377\362\246\000\377\365\253\000\377\367\255\000\377"
-  "\370\256\000\377\367\256\000\377\370\256\000\377\370\257\000\377\367\255\000\377\360"
-  "\242\000\377\337\211\000\377\313a\000\377\272-\000\377\262\000\000\377\263\000\000\377\274"
-  "KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305"
-  "vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\323r\000\377\347\225\000"
-  "\377\364\250\000\377\370\257\000\377\370\257\000\377\367\255\000\377\367\255\000\377"
-  "\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\370"
-  "\256\000\377\370\257\000\377\366\253\000\377\354\235\000\377\332\200\000\377\306T\000"
-  "\377\270\036\000\377\263\000\000\377\264\000\001\377\267)%\377\274KE\377\300bZ\377\302"
-  "ia\377\277^W\377\273E@\377\267\"\036\377\264\000\000\377\264\000\000\377\273\060\000"
-  "\377\313`\000\377\337\210\000\377\357\242\000\377\367\255\000\377\370\257\000\377\370"
-  "\256\000\377\367\256\000\377\370\256\000\377\367\255\000\377\366\253\000\377\362\246"
-  "\000\377\357\241\000\377\354\236\000\377\354\236\000\377\354\235\000\377\347\225\000"
-  "\377\332\177\000\377\311\\\000\377\301G\000\377\314c\000\377\340\212\000\377\361\244"
-  "\000\377\367\256\000\377\370\257\000\377\367\256\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\256\000\377"
-  "\370\256\000\377\367\255\000\377\366\253\000\377\363\247\000\377\357\242\000\377\355"
-  "\236\000\377\354\235\000\377\354\235\000\377\350\227\000\377\335\205\000\377\315f\000"
-  "\377\276=\000\377\266\020\000\377\264\000\000\377\265\001\000\377\264\000\000\377\263\000\000"
-  "\377\267\030\000\377\304O\000\377\330|\000\377\353\233\000\377\365\253\000\377\370\257"
-  "\000\377\370\256\000\377\367\255\000\377\370\256\000\377\367\256\000\377\366\254\000"
-  "\377\363\250\000\377\360\243\000\377\355\236\000\377\354\234\000\377\354\234\000\377"
-  "\354\235\000\377\354\235\000\377\355\236\000\377\352\232\000\377\341\214\000\377\322"
-  "p\000\377\301G\000\377\266\023\000\377\263\000\000\377\264\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\265\000\000\377\264\000\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\265\000\000\377\266\004\000\377\266\007\000\377\266\007\000\377\266\007\000\377\266\007"
-  "\000\377\266\007\000\377\266\006\000\377\266\002\000\377\265\000\000\377\265\000\000\377\265\000"
-  "\000\377\264\000\000\377\265\000\000\377\265\000\000\377\264\000\000\377\266\013\000\377\276<"
-  "\000\377\315f\000\377\335\205\000\377\350\227\000\377\354\235\000\377\355\236\000\377"
-  "\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354\235\000\377\354"
-  "\235\000\377\354\235\000\377\354\235\000\377\355\236\000\377\353\233\000\377\344\220"
-  "\000\377\325v\000\377\304Q\000\377\271&\000\377\264\000\000\377\266\010\000\377\277B\000\377"
-  "\322p\000\377\346\223\000\377\363\247\000\377\370\256\000\377\370\257\000\377\367\255"
-  "\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000\377\367\255\000"
-  "\377\367\255\000\377\370\256\000\377\370\257\000\377\366\254\000\377\355\237\000\377"
-  "\334\203\000\377\307X\000\377\270!\000\377\262\000\000\377\264\000\000\377\276XQ\377\321"
-  "\232\216\377\345\312\273\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\344"
-  "\311\273\377\320\227\214\377\275QK\377\263\000\000\377\262\000\000\377\266\016\000\377"
-  "\276?\000\377\312_\001\377\324t\000\377\331~\000\377\332\200\000\377\332\177\000\377"
-  "\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332"
-  "\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177"
-  "\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000"
-  "\377\332\177\000\377\332\200\000\377\331}\000\377\323r\000\377\310[\001\377\274\067"
-  "\000\377\264\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\262\000"
-  "\000\377\267-)\377\302jb\377\316\221\206\377\323\240\224\377\317\223\210\377"
-  "\303of\377\270\064\060\377\263\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\264\000\000\377\273\063\000\377\307X\001\377\322q\000\377\331}\000\377\332"
-  "\200\000\377\332\200\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177"
-  "\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000"
-  "\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377"
-  "\332\200\000\377\331~\000\377\323s\000\377\311\\\001\377\275\070\000\377\264\000\000\377"
-  "\261\000\000\377\262\000\000\377\267\017\000\377\303J\000\377\320k\000\377\330|\000\377\333"
-  "\201\001\377\333\201\001\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177"
-  "\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\200\000"
-  "\377\331~\000\377\324s\000\377\311^\001\377\276=\000\377\266\010\000\377\262\000\000\377"
-  "\263\000\000\377\275UN\377\321\233\220\377\345\313\275\377\000\000\000\377\000\000\000\377"
-  "\345\313\274\377\332\260\244\377\316\223\210\377\302kc\377\270\065\061\377"
-  "\263\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377"
-  "\263\000\000\377\263\000\001\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377"
-  "\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377"
-  "\270\037\000\377\301G\000\377\314d\000\377\326w\000\377\332\177\000\377\333\201\000\377"
-  "\331}\000\377\323q\000\377\310Z\001\377\275\071\000\377\265\000\000\377\262\000\000\377\264"
-  "\000\000\377\277_W\377\325\244\230\377\347\320\301\377\000\000\000\377\342\303\265"
-  "\377\314\215\203\377\272@;\377\262\000\000\377\262\000\000\377\270\035\000\377\301F"
-  "\000\377\314d\001\377\325w\000\377\332\177\000\377\332\200\000\377\332\177\000\377\332"
-  "\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177"
-  "\000\377\332\177\000\377\332\200\000\377\332\177\000\377\326x\000\377\315f\000\377\302"
-  "I\000\377\270#\000\377\264\000\000\377\264\000\000\377\270\037\000\377\301F\000\377\314d\000"
-  "\377\325w\000\377\332\177\000\377\332\200\000\377\332\177\000\377\332\177\000\377\332"
-  "\177\000\377\332\177\000\377\332\177\000\377\332\200\000\377\332\177\000\377\325v\000"
-  "\377\313a\001\377\277@\000\377\266\010\000\377\262\000\000\377\261\000\000\377\262\000\000\377"
-  "\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377"
-  "\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377"
-  "\272*\000\377\304Q\001\377\320l\001\377\330|\000\377\333\201\000\377\333\201\000\377"
-  "\332\177\000\377\331~\000\377\331~\000\377\333\201\000\377\342\214\000\377\353\233"
-  "\000\377\363\250\000\377\370\256\000\377\371\257\000\377\370\257\000\377\370\257\000"
-  "\377\371\260\000\377\370\256\000\377\360\243\000\377\340\212\000\377\313a\000\377\272"
-  "-\000\377\262\000\000\377\263\000\000\377\274KE\377\315\217\205\377\342\303\265\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\354\331\311\377\332\261\244\377\305vm\377\267,)\377\262\000\000\377\264\000\000"
-  "\377\300C\000\377\323s\000\377\347\226\000\377\364\251\000\377\371\260\000\377\371"
-  "\260\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\371\257\000\377\371\260\000\377\367\255\000"
-  "\377\355\236\000\377\333\201\000\377\306U\000\377\270\035\000\377\262\000\000\377\264"
-  "\000\002\377\272C=\377\305ul\377\317\226\213\377\323\240\225\377\316\221\206"
-  "\377\303lc\377\270\067\062\377\263\000\000\377\262\000\000\377\270#\000\377\311\\\000\377"
-  "\336\207\000\377\360\242\000\377\370\256\000\377\371\260\000\377\370\257\000\377\370"
-  "\257\000\377\371\257\000\377\370\256\000\377\364\250\000\377\353\234\000\377\342\215"
-  "\000\377\333\202\000\377\332\177\000\377\332\177\000\377\326y\000\377\315e\000\377\301"
-  "I\000\377\277@\000\377\314e\000\377\341\213\000\377\361\245\000\377\370\257\000\377\371"
-  "\260\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257"
-  "\000\377\370\257\000\377\370\257\000\377\370\257\000\377\371\257\000\377\370\257\000"
-  "\377\365\252\000\377\355\236\000\377\343\217\000\377\334\203\000\377\332\177\000\377"
-  "\332\177\000\377\327z\000\377\317j\000\377\303N\000\377\271%\000\377\264\000\000\377\263"
-  "\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\267\030\000\377\304P\000\377\331"
-  "}\000\377\353\234\000\377\366\254\000\377\371\260\000\377\371\257\000\377\370\257\000"
-  "\377\371\257\000\377\370\257\000\377\365\253\000\377\356\240\000\377\345\222\000\377"
-  "\335\204\000\377\332~\000\377\331~\000\377\332\177\000\377\332\200\000\377\332\200"
-  "\000\377\331}\000\377\322q\000\377\310Z\001\377\275\070\000\377\266\005\000\377\263\000\000"
-  "\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000"
-  "\377\263\000\000\377\263\000\000\377\263\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\261\000\000\377\262\000\000\377\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000"
-  "\377\262\000\000\377\263\000\000\377\270#\000\377\303M\001\377\317j\001\377\327z\000\377"
-  "\332\200\000\377\332\200\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332"
-  "\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\177\000\377\332\200"
-  "\000\377\331~\000\377\324s\000\377\311]\000\377\275:\000\377\265\000\000\377\261\000\000\377"
-  "\263\000\000\377\275\071\000\377\321n\000\377\346\223\000\377\364\250\000\377\371\260"
-  "\000\377\371\260\000\377\370\257\000\377\370\257\000\377\370\257\000\377\370\257\000"
-  "\377\370\257\000\377\370\257\000\377\370\257\000\377\371\257\000\377\371\260\000\377"
-  "\367\255\000\377\356\240\000\377\334\204\000\377\307Y\000\377\270\"\000\377\262\000\000"
-  "\377\264\000\000\377\276XQ\377\321\232\216\377\345\312\273\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\345\313\274\377\321\233\220\377\277\\U\377\265"
-  "\020\020\377\264\000\000\377\266\013\000\377\271'\000\377\276=\000\377\303L\000\377\305"
-  "S\000\377\306T\000\377\305T\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377"
-  "\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000"
-  "\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305T\000\377\306"
-  "T\000\377\305R\000\377\302K\000\377\275;\000\377\270#\000\377\265\006\005\377\265\001\016"
-  "\377\265\017\025\377\265\025\027\377\265\000\000\377\266\023\023\377\274OI\377\314"
-  "\213\201\377\334\266\250\377\343\307\271\377\335\270\253\377\315\220\205"
-  "\377\275UN\377\266\031\030\377\265\000\000\377\265\024\026\377\265\020\025\377\265"
-  "\002\016\377\265\005\006\377\270\040\001\377\275\071\000\377\302J\000\377\305R\000\377\306"
-  "T\000\377\305T\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377"
-  "\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000"
-  "\377\305S\000\377\305T\000\377\306T\000\377\305S\000\377\302K\000\377\275;\000\377\270"
-  "#\000\377\265\006\005\377\264\000\016\377\265\017\024\377\270%\026\377\274\071\022\377"
-  "\301I\012\377\305R\002\377\306U\000\377\306T\000\377\305T\000\377\305S\000\377\305S"
-  "\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305T\000\377\306T\000\377"
-  "\305S\000\377\302K\000\377\276<\000\377\271&\000\377\266\011\000\377\264\000\000\377\266"
-  "\025\024\377\277_W\377\323\236\223\377\346\314\276\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\351\323\304\377\335\270\253\377\315\216\203\377\276WP\377\266"
-  "\034\032\377\265\000\000\377\265\024\025\377\265\022\025\377\265\011\017\377\265\000\006"
-  "\377\264\000\001\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000"
-  "\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\264\000\000\377\265\000\000"
-  "\377\266\021\000\377\272-\000\377\277A\000\377\303N\000\377\305T\000\377\306U\000\377"
-  "\305R\000\377\302J\000\377\275:\000\377\270#\001\377\265\001\000\377\263\000\000\377\266"
-  "\040\036\377\302h`\377\326\247\233\377\350\321\302\377\000\000\000\377\342\305\266"
-  "\377\316\222\207\377\274NH\377\264\000\000\377\264\000\000\377\266\024\003\377\272,"
-  "\000\377\277A\000\377\303N\000\377\305S\000\377\306T\000\377\305T\000\377\305S\000\377"
-  "\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305T\000\377\306T\000"
-  "\377\305T\000\377\304O\000\377\277B\000\377\272.\000\377\266\024\000\377\265\000\000\377"
-  "\264\000\000\377\266\021\000\377\272,\000\377\277A\000\377\303N\000\377\305S\000\377\306"
-  "T\000\377\305T\000\377\305S\000\377\305S\000\377\305S\000\377\305T\000\377\306T\000\377"
-  "\305S\000\377\303M\000\377\276?\000\377\271)\000\377\266\014\004\377\265\000\014\377\265"
-  "\014\023\377\265\025\030\377\266\027\031\377\266\030\031\377\266\027\031\377\266\027"
-  "\031\377\266\027\031\377\266\027\031\377\266\027\031\377\266\027\031\377\266\027\031"
-  "\377\266\030\031\377\266\032\031\377\266\033\031\377\266\034\031\377\266\034\031\377"
-  "\266\034\031\377\266\031\027\377\265\020\021\377\265\011\011\377\267\032\002\377\273"
-  "\063\000\377\301F\000\377\304Q\000\377\306U\000\377\306U\000\377\305T\000\377\305R\000\377"
-  "\304Q\000\377\310Z\000\377\322q\000\377\342\215\000\377\357\241\000\377\366\253\000\377"
-  "\367\255\000\377\367\254\000\377\366\254\000\377\367\256\000\377\366\254\000\377\357"
-  "\241\000\377\337\207\000\377\312`\000\377\272,\000\377\262\000\000\377\263\000\000\377\274"
-  "KE\377\315\217\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305"
-  "vm\377\267,)\377\262\000\000\377\264\000\000\377\277B\000\377\322q\000\377\346\223\000"
-  "\377\363\247\000\377\367\255\000\377\367\255\000\377\366\254\000\377\366\254\000\377"
-  "\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\367"
-  "\255\000\377\367\256\000\377\365\252\000\377\353\234\000\377\332\177\000\377\305T\000"
-  "\377\267\033\000\377\262\000\000\377\264\000\004\377\275TM\377\316\221\207\377\335\271"
-  "\254\377\343\306\270\377\333\263\246\377\312\206|\377\273F@\377\263\000\000\377"
-  "\262\000\000\377\271'\000\377\311]\000\377\336\206\000\377\356\240\000\377\366\253\000"
-  "\377\367\256\000\377\367\254\000\377\367\254\000\377\367\255\000\377\366\253\000\377"
-  "\357\242\000\377\342\216\000\377\323s\000\377\310[\000\377\305R\000\377\305R\000\377"
-  "\304O\000\377\277?\000\377\272+\000\377\274\070\000\377\314c\000\377\340\212\000\377\360"
-  "\242\000\377\366\254\000\377\367\255\000\377\366\254\000\377\366\254\000\377\366\254"
-  "\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000"
-  "\377\367\255\000\377\366\254\000\377\361\244\000\377\345\222\000\377\325w\000\377\311"
-  "]\000\377\305R\000\377\305R\000\377\304P\000\377\300E\000\377\273\062\000\377\267\026\000"
-  "\377\265\000\000\377\264\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\267\030\000"
-  "\377\303N\000\377\327{\000\377\352\232\000\377\364\251\000\377\367\255\000\377\367"
-  "\255\000\377\366\254\000\377\367\255\000\377\367\254\000\377\362\246\000\377\347\225"
-  "\000\377\330{\000\377\313a\000\377\305R\000\377\304Q\000\377\305S\000\377\305T\000\377"
-  "\306T\000\377\305R\000\377\302J\000\377\275:\000\377\270#\001\377\266\015\006\377\265"
-  "\014\017\377\266\026\025\377\266\033\030\377\266\034\031\377\266\034\031\377\266\034"
-  "\031\377\266\034\031\377\266\034\031\377\266\033\031\377\266\032\031\377\266\031\031"
-  "\377\266\030\031\377\266\027\031\377\266\027\031\377\266\027\031\377\266\027\031\377"
-  "\266\027\031\377\266\027\031\377\266\030\031\377\266\032\031\377\266\033\031\377\266"
-  "\034\031\377\266\034\031\377\266\034\031\377\266\030\026\377\265\014\021\377\265\003"
-  "\011\377\267\027\002\377\273\061\000\377\300E\000\377\304P\000\377\305T\000\377\306T\000"
-  "\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305S\000\377\305"
-  "S\000\377\305T\000\377\306T\000\377\305S\000\377\302L\000\377\276<\000\377\271$\000\377"
-  "\265\000\000\377\262\000\000\377\264\000\000\377\276<\000\377\320m\000\377\344\221\000\377"
-  "\362\246\000\377\367\255\000\377\367\255\000\377\366\254\000\377\366\254\000\377\366"
-  "\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\366\254\000\377\367\254"
-  "\000\377\367\256\000\377\365\253\000\377\355\236\000\377\333\202\000\377\307X\000\377"
-  "\270!\000\377\262\000\000\377\264\000\000\377\276XQ\377\321\232\216\377\345\312\273"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302\377\330\254\237"
-  "\377\310\177v\377\276YR\377\271:\066\377\267\"\037\377\265\003\000\377\266\003\000"
-  "\377\267\024\000\377\267\031\000\377\267\032\000\377\267\031\000\377\267\031\000\377\267"
-  "\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377"
-  "\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031"
-  "\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\032\000\377\267\032\000\377\267"
-  "\031\000\377\267\023\000\377\266\002\000\377\265\005\000\377\267'#\377\273E@\377\277[T"
-  "\377\301f^\377\301e]\377\302h`\377\310~u\377\327\251\235\377\346\315\276"
-  "\377\000\000\000\377\347\320\301\377\330\255\240\377\311\202x\377\302ia\377\301"
-  "e]\377\301f^\377\277\\U\377\273HB\377\267*&\377\265\010\000\377\266\001\000\377"
-  "\267\022\000\377\267\031\000\377\267\032\000\377\267\032\000\377\267\031\000\377\267\031"
-  "\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267"
-  "\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377"
-  "\267\032\000\377\267\032\000\377\267\031\000\377\267\024\000\377\266\003\000\377\265\004\000"
-  "\377\267'#\377\273FA\377\276ZS\377\300`X\377\276VM\377\273@\065\377\270&\022"
-  "\377\267\026\000\377\267\026\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267"
-  "\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\032\000\377\267\032\000\377"
-  "\267\031\000\377\267\024\000\377\266\003\000\377\265\004\000\377\267$\040\377\271;\067\377"
-  "\276ZS\377\311\201x\377\331\256\241\377\351\322\303\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\347\320\301\377\330\254\237\377\311\203y\377\302ia\377"
-  "\301e]\377\301f^\377\277]V\377\273IC\377\267+'\377\265\001\001\377\264\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\000\000\377\265\003\000\377"
-  "\266\017\000\377\267\027\000\377\267\032\000\377\267\032\000\377\267\031\000\377\267\022"
-  "\000\377\266\001\000\377\265\007\000\377\267&#\377\272?:\377\277^W\377\312\207}\377"
-  "\334\265\250\377\352\326\307\252\000\000\000\377\346\314\275\377\325\245\231\377"
-  "\305wn\377\275RK\377\270\065\061\377\266\035\031\377\265\000\000\377\266\007\000\377"
-  "\267\026\000\377\267\031\000\377\267\032\000\377\267\031\000\377\267\031\000\377\267\031"
-  "\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267"
-  "\032\000\377\267\031\000\377\267\027\000\377\266\020\000\377\266\004\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\265\000\000\377\265\003\000\377\266\017\000\377\267\026\000\377"
-  "\267\031\000\377\267\032\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031"
-  "\000\377\267\031\000\377\267\032\000\377\267\031\000\377\267\026\000\377\266\006\000\377\265"
-  "\001\000\377\266\037\033\377\272?:\377\276WP\377\301e]\377\302ia\377\302ja\377"
-  "\302ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302"
-  "ia\377\302ia\377\302ia\377\302ia\377\302jb\377\302h`\377\300aZ\377\274PJ"
-  "\377\270\066\061\377\266\024\017\377\265\000\000\377\266\014\000\377\267\030\000\377\267"
-  "\032\000\377\267\032\000\377\267\032\000\377\267\023\000\377\266\021\000\377\272.\000\377"
-  "\306W\000\377\327{\000\377\346\223\000\377\355\237\000\377\357\241\000\377\356\240"
-  "\000\377\356\240\000\377\357\241\000\377\356\237\000\377\347\225\000\377\331~\000\377"
-  "\307X\000\377\271(\000\377\262\000\000\377\263\000\000\377\273JD\377\315\217\204\377"
-  "\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\354\331\311\377\332\260\244\377\305ul\377\267*'\377\262"
-  "\000\000\377\264\000\000\377\276<\000\377\316i\000\377\337\211\000\377\353\233\000\377\357"
-  "\241\000\377\357\241\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240"
-  "\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000\377\357\241\000"
-  "\377\355\236\000\377\344\221\000\377\325u\000\377\303M\000\377\267\026\000\377\262\000"
-  "\000\377\264\000\000\377\277\\U\377\323\237\223\377\345\313\274\377\000\000\000\377\342"
-  "\304\266\377\316\223\210\377\274LF\377\263\000\000\377\262\000\000\377\271%\000\377"
-  "\306V\000\377\330|\000\377\347\225\000\377\356\237\000\377\357\241\000\377\356\240"
-  "\000\377\356\240\000\377\357\241\000\377\355\237\000\377\346\224\000\377\330|\000\377"
-  "\307X\000\377\273\060\000\377\266\022\000\377\266\023\000\377\267\030\000\377\265\002\000\377"
-  "\265\000\000\377\272.\000\377\311\\\000\377\332\200\000\377\350\227\000\377\356\240\000"
-  "\377\357\241\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000\377"
-  "\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000\377\357\241\000\377\356"
-  "\240\000\377\350\227\000\377\333\201\000\377\312_\000\377\274\066\000\377\267\025\000\377"
-  "\266\021\000\377\267\030\000\377\266\022\000\377\266\006\000\377\265\000\000\377\265\000\000\377"
-  "\265\000\000\377\265\000\000\377\264\000\000\377\263\000\000\377\266\024\000\377\301H\000\377"
-  "\323r\000\377\343\216\000\377\354\235\000\377\357\241\000\377\356\240\000\377\356\240"
-  "\000\377\357\241\000\377\356\240\000\377\351\231\000\377\335\205\000\377\314e\000\377"
-  "\276<\000\377\267\031\000\377\266\017\000\377\267\031\000\377\267\032\000\377\267\032\000"
-  "\377\267\031\000\377\267\022\000\377\266\001\000\377\265\010\000\377\267*&\377\273HB\377"
-  "\277\\U\377\301g_\377\302jb\377\302ia\377\302ia\377\302ia\377\302ia\377\302"
-  "ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302ia"
-  "\377\302ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302ia\377\302jb\377"
-  "\302h`\377\300aY\377\274PI\377\270\065\060\377\266\023\016\377\265\000\000\377\266"
-  "\015\000\377\267\030\000\377\267\032\000\377\267\032\000\377\267\031\000\377\267\031\000\377"
-  "\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031\000\377\267\031"
-  "\000\377\267\032\000\377\267\031\000\377\267\025\000\377\266\015\000\377\265\000\000\377\265"
-  "\000\000\377\263\000\000\377\265\000\000\377\275\070\000\377\315f\000\377\336\207\000\377\352"
-  "\232\000\377\356\241\000\377\357\241\000\377\356\240\000\377\356\240\000\377\356\240"
-  "\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000\377\356\240\000"
-  "\377\357\241\000\377\355\236\000\377\345\222\000\377\326x\000\377\304Q\000\377\270"
-  "\035\000\377\262\000\000\377\264\000\000\377\276WP\377\321\231\216\377\345\312\273\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\343\307\270\377\330"
-  "\254\240\377\315\217\204\377\302ia\377\271\067\063\377\263\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\263\000\000\377\271=\070\377\304pg\377\316\221\206\377\324\243"
-  "\227\377\326\246\232\377\326\247\233\377\332\260\243\377\343\306\270\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\344\311\272\377\332\262\245\377\326\247\233"
-  "\377\326\246\232\377\325\243\230\377\317\223\211\377\305sj\377\272B=\377"
-  "\264\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\263\000\000\377\271<\067\377\304qi\377\316\220\206\377\320\230\215\377\311\204"
-  "{\377\276ZU\377\265\014\031\377\261\000\000\377\261\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\271:\065"
-  "\377\302kc\377\315\220\206\377\331\256\241\377\344\310\271\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\344\310\272\377\332\262"
-  "\245\377\326\250\233\377\326\246\232\377\325\244\230\377\317\224\211\377"
-  "\305ul\377\272D?\377\264\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263"
-  "\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263"
-  "\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\264\000\000\377\272"
-  "A<\377\304pg\377\317\224\211\377\332\261\244\377\346\314\275\377\000\000\000\377"
-  "\000\000\000\377\354\331\312D\342\303\265\377\326\247\233\377\313\210~\377\300"
-  "`Y\377\267)&\377\263\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\263\000\000\377\270.*\377\301f^\377\314\213\201\377\323\240"
-  "\225\377\326\250\233\377\326\250\234\377\326\247\233\377\326\247\233\377"
-  "\326\247\233\377\326\247\233\377\326\247\233\377\326\247\233\377\326\247"
-  "\233\377\326\247\233\377\326\247\233\377\326\247\233\377\326\247\233\377"
-  "\326\250\234\377\326\246\232\377\321\233\220\377\311\201w\377\276WP\377\266"
-  "\022\022\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\265\000\000\377\276?\000\377\313b\001\377\327y\000"
-  "\377\334\203\000\377\336\205\000\377\335\205\000\377\335\204\000\377\335\205\000\377"
-  "\335\204\000\377\330|\000\377\316h\001\377\301H\000\377\270\035\000\377\262\000\000\377"
-  "\262\000\000\377\272C>\377\314\215\202\377\341\302\264\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\330\311\377\331"
-  "\257\242\377\304ri\377\266\034\032\377\261\000\000\377\264\000\000\377\273\060\000\377"
-  "\306V\001\377\322q\001\377\332\200\000\377\335\205\000\377\335\205\000\377\335\204"
-  "\000\377\335\204\000\377\335\204\000\377\335\204\000\377\335\204\000\377\335\204\000"
-  "\377\335\204\000\377\335\205\000\377\335\205\000\377\334\203\000\377\326x\000\377\313"
-  "a\001\377\276?\000\377\266\006\000\377\262\000\000\377\263\000\000\377\276YR\377\324\241"
-  "\225\377\347\317\300\377\000\000\000\377\344\310\271\377\317\224\211\377\273HB"
-  "\377\262\000\000\377\262\000\000\377\267\032\000\377\301G\000\377\315f\001\377\330{\000\377"
-  "\334\204\000\377\335\205\000\377\335\204\000\377\335\205\000\377\336\205\000\377\334"
-  "\203\000\377\327z\000\377\314d\001\377\277A\000\377\265\004\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\263\000\000\377\270!\000\377\302K\000\377\317j\001\377"
-  "\331}\000\377\335\204\000\377\335\205\000\377\335\204\000\377\335\204\000\377\335\204"
-  "\000\377\335\204\000\377\335\204\000\377\335\204\000\377\335\204\000\377\335\204\000"
-  "\377\335\205\000\377\335\204\000\377\330|\000\377\316h\001\377\301G\000\377\267\024"
-  "\000\377\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000"
-  "\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\266\006"
-  "\000\377\275:\000\377\311^\001\377\325v\000\377\333\202\000\377\335\205\000\377\335\205"
-  "\000\377\335\204\000\377\335\205\000\377\335\205\000\377\331~\000\377\320l\001\377\303"
-  "M\001\377\270\037\000\377\262\000\000\377\261\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\264\000\000\377\272C>\377\305tk"
-  "\377\317\224\211\377\325\244\230\377\326\250\234\377\326\250\233\377\326"
-  "\247\233\377\326\247\233\377\326\247\233\377\326\247\233\377\326\247\233"
-  "\377\326\247\233\377\326\247\233\377\326\247\233\377\326\247\233\377\326"
-  "\247\233\377\326\247\233\377\326\247\233\377\326\247\233\377\326\247\233"
-  "\377\326\247\233\377\326\247\233\377\326\247\233\377\326\250\234\377\326"
-  "\246\232\377\321\233\217\377\310\200v\377\275UN\377\265\015\016\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000"
-  "\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\263\000\000"
-  "\377\263\000\000\377\264\000\000\377\272,\000\377\305S\001\377\321o\001\377\332\177\000\377"
-  "\335\205\000\377\335\205\000\377\335\204\000\377\335\204\000\377\335\204\000\377\335"
-  "\204\000\377\335\204\000\377\335\204\000\377\335\204\000\377\335\205\000\377\335\205"
-  "\000\377\334\203\000\377\327y\000\377\314c\001\377\277B\000\377\266\020\000\377\262\000"
-  "\000\377\263\000\000\377\275QK\377\320\227\214\377\344\311\273\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350\321\302\377\334\267"
-  "\251\377\315\215\203\377\276VO\377\265\021\020\377\264\000\000\377\264\000\000\377"
-  "\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377"
-  "\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377"
-  "\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377"
-  "\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\000\377\264\000\000\377"
-  "\266\030\027\377\277[T\377\316\222\207\377\335\271\254\377\347\316\277\377"
-  "\351\324\305\356\351\324\304\356\352\326\307\252\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\353\326\307\252\351\324\304\356\351\324\305\356"
-  "\347\317\300\377\336\274\256\377\320\226\213\377\300aY\377\266\040\036\377"
-  "\264\000\000\377\264\000\000\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377"
-  "\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377"
-  "\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377"
-  "\264\000\006\377\264\000\006\377\264\000\006\377\264\000\000\377\264\000\000\377\266\026\025\377"
-  "\277[T\377\317\224\211\377\335\270\253\377\341\301\263\377\327\253\237\377"
-  "\307|t\377\271<\071\377\264\000\000\377\263\000\000\377\264\000\006\377\264\000\006\377\264"
-  "\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264"
-  "\000\006\377\264\000\006\377\264\000\000\377\264\000\000\377\266\025\024\377\276YR\377\315"
-  "\217\205\377\335\270\253\377\350\321\302\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\353\327\307\210\351\324"
-  "\304\356\351\324\305\356\347\317\300\377\337\275\257\377\320\230\215\377"
-  "\300c[\377\267#\040\377\264\000\000\377\265\000\000\377\265\010\006\377\265\010\006\377"
-  "\265\010\006\377\265\010\006\377\265\010\006\377\265\010\006\377\265\010\006\377\265\010"
-  "\006\377\265\010\006\377\265\007\006\377\265\004\006\377\265\000\006\377\265\000\006\377\264\000"
-  "\006\377\264\000\006\377\264\000\006\377\264\000\000\377\264\000\000\377\266\037\035\377\300"
-  "`Y\377\317\225\212\377\337\274\256\377\351\324\304\356\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\346\314\276\377\331\257\243\377\311\203y\377"
-  "\273ID\377\265\000\000\377\264\000\000\377\264\000\004\377\264\000\006\377\264\000\006\377\264"
-  "\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264"
-  "\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\265\000\006\377\265\000\006\377\265"
-  "\004\006\377\265\007\006\377\265\010\006\377\265\010\006\377\265\007\006\377\265\004\006\377\265"
-  "\000\006\377\265\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264"
-  "\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\003\377\264"
-  "\000\000\377\265\000\001\377\274MG\377\312\207}\377\332\262\245\377\345\313\274\377"
-  "\351\324\304\356\352\324\305\356\351\323\304\377\351\323\304\377\351\323"
-  "\304\377\351\323\304\377\351\323\304\377\351\323\304\377\351\323\304\377"
-  "\351\323\304\377\351\323\304\377\351\323\304\377\351\323\304\377\352\325"
-  "\305\314\351\322\303\377\343\305\267\377\326\246\232\377\305vm\377\271\071"
-  "\065\377\264\000\000\377\264\000\000\377\264\000\006\377\264\000\007\377\264\000\007\377\264\000"
-  "\006\377\264\000\005\377\264\000\003\377\265\004\001\377\271)\000\377\277B\000\377\305S\000\377"
-  "\310Z\000\377\311\\\000\377\310[\000\377\310[\000\377\310\\\000\377\310Z\000\377\306"
-  "T\000\377\301F\000\377\273\060\000\377\266\023\000\377\263\000\000\377\264\000\000\377\274"
-  "LF\377\315\220\205\377\342\303\265\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\331\311\377\332\261\244\377\305"
-  "vn\377\270/+\377\263\000\000\377\264\000\000\377\270\037\000\377\275:\000\377\303M\000\377"
-  "\307X\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000"
-  "\377\310[\000\377\310[\000\377\310[\000\377\310[\000\377\310\\\000\377\310Z\000\377\305"
-  "R\000\377\277A\000\377\271)\000\377\265\003\000\377\263\000\000\377\265\010\012\377\300_"
-  "X\377\324\243\227\377\347\317\300\377\000\000\000\377\344\310\272\377\320\226\213"
-  "\377\274PJ\377\264\000\000\377\263\000\000\377\266\021\000\377\272.\000\377\300E\000\377"
-  "\305T\000\377\310Z\000\377\310\\\000\377\310[\000\377\310[\000\377\311\\\000\377\310"
-  "Z\000\377\305S\000\377\300C\000\377\272*\000\377\265\006\001\377\264\000\003\377\264\000\005"
-  "\377\264\000\005\377\264\000\004\377\265\000\002\377\266\025\001\377\273\062\000\377\301H\000"
-  "\377\306U\000\377\310[\000\377\310\\\000\377\310[\000\377\310[\000\377\310[\000\377\310"
-  "[\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000\377\310\\\000\377\310[\000\377"
-  "\306U\000\377\301F\000\377\272/\000\377\266\015\001\377\264\000\002\377\264\000\004\377\264"
-  "\000\006\377\265\000\007\377\265\003\007\377\265\006\006\377\265\010\007\377\265\010\007\377\265"
-  "\007\006\377\265\003\005\377\265\000\003\377\265\011\001\377\271&\000\377\276?\000\377\304P"
-  "\000\377\307Y\000\377\310\\\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000\377"
-  "\306V\000\377\302I\000\377\273\063\000\377\266\023\000\377\264\000\002\377\264\000\004\377"
-  "\264\000\006\377\264\000\006\377\264\000\007\377\264\000\006\377\264\000\000\377\264\000\000\377"
-  "\266!\036\377\300aZ\377\320\227\214\377\337\274\257\377\347\317\300\377\352"
-  "\324\305\377\351\324\304\377\351\323\304\377\351\323\304\377\351\323\304"
-  "\377\351\323\304\377\351\323\304\377\351\323\304\377\351\323\304\377\351"
-  "\323\304\377\351\323\304\377\351\323\304\377\351\323\304\377\351\323\304"
-  "\377\351\323\304\377\351\323\304\377\351\323\304\377\351\323\304\377\351"
-  "\323\304\377\352\325\305\377\351\322\303\377\342\304\266\377\325\245\231"
-  "\377\305tk\377\271\067\063\377\264\000\000\377\264\000\000\377\264\000\006\377\264\000\006"
-  "\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006"
-  "\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\264\000\006\377\265\000\006"
-  "\377\265\001\007\377\265\005\006\377\265\005\006\377\265\000\004\377\265\002\002\377\267\035\000"
-  "\377\274\070\000\377\302L\000\377\307W\000\377\310[\000\377\310[\000\377\310[\000\377"
-  "\310[\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000\377\310[\000"
-  "\377\310\\\000\377\310Z\000\377\305S\000\377\300C\000\377\272+\000\377\266\011\000\377"
-  "\263\000\000\377\265\000\000\377\276YR\377\321\232\217\377\345\312\274\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347\320"
-  "\301\377\330\253\237\377\310\177v\377\300`Y\377\276XQ\377\277]V\377\277^"
-  "W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377"
-  "\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277"
-  "^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277]U"
-  "\377\276XQ\377\300bZ\377\311\203y\377\331\257\242\377\351\322\303\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\356\332"
-  "\262\245\377\312\207}\377\301d\\\377\276XQ\377\277\\U\377\277^W\377\277^"
-  "W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377"
-  "\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277"
-  "^W\377\277^W\377\277^W\377\277]V\377\276XQ\377\300aZ\377\311\202x\377\332"
-  "\260\243\377\350\321\302\377\354\332\312\"\343\305\267\377\322\234\221\377"
-  "\304ph\377\277ZS\377\276ZS\377\277^W\377\277^W\377\277^W\377\277^W\377\277"
-  "^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277]V\377\276XQ"
-  "\377\300aY\377\311\201w\377\330\255\240\377\350\321\302\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\325\306\314\333\264\247"
-  "\377\313\210~\377\301d]\377\276XQ\377\277\\U\377\277^W\377\277^W\377\277"
-  "^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W"
-  "\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277\\U\377"
-  "\276XQ\377\301d\\\377\312\206|\377\332\262\245\377\352\324\305\356\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\344\311"
-  "\273\377\324\242\226\377\306wn\377\277]U\377\276YR\377\277^W\377\277^W\377"
-  "\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277"
-  "^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W"
-  "\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377"
-  "\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277"
-  "^W\377\277^V\377\276YR\377\277]V\377\306yp\377\325\245\231\377\345\313\274"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\341\300\263\377\320\227\214\377\303nf\377\276"
-  "ZS\377\276ZS\377\277^W\377\277_X\377\300_X\377\277[T\377\274PJ\377\271<\067"
-  "\377\267!\035\377\266\015\000\377\267\024\000\377\270\040\000\377\271%\000\377\271%\000"
-  "\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\270\"\000\377\267\026\000\377"
-  "\266\014\000\377\266\034\030\377\270.*\377\273ID\377\304qh\377\323\241\225\377"
-  "\345\312\273\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\355\334\314\252\336\273\255\377\315\215\203\377\300`Y\377"
-  "\271=\070\377\267'#\377\266\023\013\377\266\017\000\377\267\034\000\377\270#\000\377"
-  "\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000"
-  "\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271$\000\377\270\037\000\377"
-  "\267\023\000\377\266\016\000\377\266!\035\377\270\063/\377\275RL\377\307}t\377\331"
-  "\257\242\377\351\323\304\252\000\000\000\377\346\315\276\377\325\245\231\377\304"
-  "sj\377\274KE\377\270/+\377\266\035\031\377\266\014\000\377\267\026\000\377\270!\000"
-  "\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\270"
-  "!\000\377\267\025\000\377\266\015\000\377\266\040\033\377\271<\067\377\274PI\377\276"
-  "VO\377\274MG\377\271\067\063\377\266\033\026\377\266\014\000\377\267\030\000\377\270"
-  "\"\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377"
-  "\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\270\""
-  "\000\377\267\027\000\377\266\014\000\377\266\033\026\377\271\067\062\377\274MG\377\276"
-  "ZS\377\277_W\377\300_X\377\277^W\377\277_W\377\300_X\377\277]U\377\275SM"
-  "\377\272A<\377\267'#\377\266\017\003\377\267\021\000\377\270\036\000\377\271$\000\377"
-  "\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\270#\000\377\267\031"
-  "\000\377\266\015\000\377\266\027\021\377\270\063.\377\273JD\377\276XR\377\277^W\377"
-  "\300_X\377\277^W\377\277\\U\377\276XQ\377\301d\\\377\312\207}\377\333\263"
-  "\246\377\352\325\305\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\356\334\315\210\340\277\261\377\317\225\212\377"
-  "\303me\377\276YR\377\276ZS\377\277^W\377\277^W\377\277^W\377\277^W\377\277"
-  "^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W\377\277^W"
-  "\377\277^W\377\277^W\377\300_X\377\277^W\377\276WQ\377\273HB\377\270\060,"
-  "\377\266\025\016\377\266\016\000\377\267\033\000\377\270#\000\377\271%\000\377\271%\000"
-  "\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271%\000\377\271"
-  "%\000\377\271%\000\377\271%\000\377\271%\000\377\270\040\000\377\267\024\000\377\266\015"
-  "\000\377\266\040\033\377\270\062.\377\274OI\377\306yp\377\326\250\234\377\347"
-  "\320\301\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\343\307\270\377\331\256\241\377\323\237\224\377"
-  "\322\234\221\377\323\236\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\322\236\223\377\322\234\221\377\323\240\224\377"
-  "\331\257\243\377\344\311\272\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\313\274\377\332\261\244\377\324"
-  "\241\225\377\322\234\221\377\322\236\222\377\323\237\223\377\323\237\223"
-  "\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323"
-  "\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223"
-  "\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323"
-  "\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\322\236\223"
-  "\377\322\234\221\377\323\240\224\377\331\257\242\377\345\312\273\377\000\000"
-  "\000\377\000\000\000\377\353\327\310\210\337\276\260\377\326\246\232\377\322\235"
-  "\222\377\322\235\221\377\323\237\223\377\323\237\223\377\323\237\223\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\322\236\223\377\322\234\221\377"
-  "\323\240\224\377\331\256\242\377\344\310\271\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\346\314\275\377\332"
-  "\262\245\377\324\241\225\377\322\234\221\377\322\236\222\377\323\237\223"
-  "\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323"
-  "\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223"
-  "\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323"
-  "\237\223\377\323\237\223\377\322\236\222\377\322\234\221\377\323\241\225"
-  "\377\332\261\244\377\345\313\274\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\332\312\"\341\301\263\377"
-  "\327\251\235\377\322\236\222\377\322\235\221\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\236\223\377"
-  "\322\235\221\377\323\236\223\377\327\253\236\377\341\303\265\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\352\324\305\356\336\272\255\377\325\245\231\377"
-  "\322\235\221\377\322\235\222\377\323\237\223\377\323\240\224\377\323\240"
-  "\224\377\321\232\217\377\313\207}\377\301f^\377\270\063/\377\263\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\263\000\000\377\267)&\377\277\\"
-  "U\377\311\202x\377\324\241\225\377\337\276\260\377\353\327\310\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\347\316\277\377\333\263\246\377\317\225\212\377\305tk\377\273JD\377"
-  "\265\000\002\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377"
-  "\264\000\000\377\271\070\064\377\301f^\377\314\212\200\377\327\251\234\377\343"
-  "\306\270\377\000\000\000\377\000\000\000\377\000\000\000\377\341\301\263\377\324\243\227\377"
-  "\311\203z\377\277^W\377\267,(\377\263\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262"
-  "\000\000\377\262\000\000\377\263\000\000\377\270\060,\377\301f^\377\312\207}\377\316\221"
-  "\207\377\311\202x\377\277^W\377\267#\040\377\263\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\263\000\000\377\267%\"\377\277]V\377\311\202x"
-  "\377\320\227\214\377\323\237\224\377\323\240\224\377\323\237\223\377\323"
-  "\237\224\377\323\240\224\377\322\234\221\377\314\215\202\377\303nf\377\272"
-  "@:\377\264\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\266\030\027\377\276VO\377\307}t\377\317\225\212\377\323\237\223\377"
-  "\323\240\224\377\323\237\223\377\322\236\222\377\322\234\221\377\324\241"
-  "\225\377\332\262\245\377\345\313\275\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\323"
-  "\304\377\335\271\254\377\325\245\231\377\322\235\221\377\322\235\222\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377"
-  "\323\237\223\377\323\237\223\377\323\237\223\377\323\237\223\377\323\237"
-  "\223\377\323\240\225\377\322\236\223\377\317\223\210\377\306zp\377\275QJ"
-  "\377\265\014\015\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000\000\377\262\000"
-  "\000\377\263\000\000\377\270\064/\377\300c[\377\313\210~\377\326\246\232\377\342"
-  "\303\265\377\355\333\313\252\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\323\304\377\347\316"
-  "\277\377\346\315\276\377\346\315\276\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\276\377\346\315\276\377\347\316"
-  "\277\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\324\305\356\347\316"
-  "\277\377\346\315\276\377\346\315\276\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\276\377"
-  "\346\315\276\377\347\316\277\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\354\331\312D\350\320\301\377\346\315\276\377\346\315\276"
-  "\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346"
-  "\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277"
-  "\377\346\315\277\377\346\315\276\377\346\315\276\377\347\316\277\377\351"
-  "\323\304\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\352\325\305\314\347\316\277\377\346"
-  "\315\276\377\346\315\276\377\346\315\277\377\346\315\277\377\346\315\277"
-  "\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346"
-  "\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277"
-  "\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346"
-  "\315\276\377\346\315\276\377\347\316\277\377\352\324\305\356\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\350\321\302\377\346\315\276\377\346\315\276\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377"
-  "\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315"
-  "\277\377\346\315\277\377\346\315\276\377\346\315\277\377\350\322\303\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\353\330\310f\350"
-  "\320\301\377\346\315\276\377\346\315\276\377\346\315\277\377\347\317\300"
-  "\377\347\317\300\377\344\307\271\377\332\261\244\377\313\210~\377\274OI\377"
-  "\265\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\263\000\000\377\263\000\000\377"
-  "\263\000\000\377\263\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377"
-  "\273F@\377\310\200v\377\330\254\237\377\344\311\272\377\354\332\312\356\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\351\324\305\377\340\277\261\377\322\234\220"
-  "\377\302kb\377\267*'\377\263\000\000\377\263\000\000\377\264\000\000\377\263\000\000\377"
-  "\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377"
-  "\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377\263\000\000\377"
-  "\263\000\000\377\265\005\010\377\276VO\377\314\214\202\377\333\264\247\377\347\316"
-  "\277\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\345\312\273\377"
-  "\330\255\241\377\311\202y\377\273IC\377\264\000\000\377\263\000\000\377\264\000\000\377"
-  "\264\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264\000\000\377"
-  "\263\000\000\377\263\000\000\377\264\000\000\377\274MG\377\313\211\177\377\332\260\243"
-  "\377\337\275\257\377\327\253\236\377\310\177v\377\272@;\377\264\000\000\377\263"
-  "\000\000\377\264\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263"
-  "\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263"
-  "\000\000\377\264\000\000\377\264\000\000\377\263\000\000\377\264\000\000\377\272B=\377\310~u"
-  "\377\327\252\236\377\342\304\266\377\347\316\277\377\347\317\300\377\346"
-  "\315\277\377\347\316\300\377\347\317\300\377\345\312\273\377\335\267\252"
-  "\377\316\222\210\377\277]V\377\266\025\024\377\263\000\000\377\263\000\000\377\264"
-  "\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264"
-  "\000\000\377\263\000\000\377\263\000\000\377\271\070\063\377\305vm\377\325\244\230\377"
-  "\341\302\264\377\346\315\277\377\347\317\300\377\347\316\277\377\346\315"
-  "\276\377\346\315\276\377\347\316\277\377\352\324\305\377\357\337\317\"\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\353\327\310\377\347\320\301\377\346\315\276"
-  "\377\346\315\276\377\346\315\277\377\346\315\277\377\346\315\277\377\346"
-  "\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277"
-  "\377\346\315\277\377\346\315\277\377\346\315\277\377\346\315\277\377\346"
-  "\315\277\377\347\316\277\377\347\317\300\377\346\315\276\377\340\277\262"
-  "\377\323\240\225\377\304ph\377\270\060-\377\263\000\000\377\263\000\000\377\264\000"
-  "\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000"
-  "\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\263\000\000\377\264\000"
-  "\000\377\263\000\000\377\263\000\000\377\265\000\000\377\275QK\377\313\210~\377\332\262"
-  "\245\377\346\314\275\377\355\334\314\210\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\346\314\275\377\325\246\232"
-  "\377\306wn\377\275UN\377\274MF\377\275RL\377\275TM\377\275TM\377\275TM\377"
-  "\275TM\377\275TM\377\275TM\377\275SM\377\274MG\377\275RL\377\304qh\377\323"
-  "\237\224\377\344\307\271\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\354\331\311\377\335\271\253\377\314\215\202\377\300bZ\377"
-  "\274MG\377\274OI\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275"
-  "TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM"
-  "\377\275RK\377\274LF\377\276XQ\377\307|s\377\327\253\236\377\347\317\300"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\344\311\272\377\324\241\226\377\304sj\377\275SM\377\274MG\377\275SL\377"
-  "\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275SL\377\274"
-  "MG\377\275TN\377\305um\377\326\246\232\377\345\313\275\377\353\330\310\377"
-  "\343\306\270\377\322\236\222\377\303me\377\275QJ\377\274MG\377\275SM\377"
-  "\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275"
-  "TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275SM\377\274MG\377\275QK"
-  "\377\303nf\377\322\235\221\377\343\305\267\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\322\303\377\331\257\242"
-  "\377\311\201x\377\277ZS\377\274LF\377\275QK\377\275TM\377\275TM\377\275T"
-  "M\377\275TM\377\275TM\377\275TM\377\275TM\377\274NH\377\274OI\377\302h`\377"
-  "\317\226\213\377\340\300\262\377\355\334\314\210\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354"
-  "\332\313\314\337\274\257\377\316\221\206\377\301e]\377\274NH\377\274OI\377"
-  "\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275"
-  "TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275TM\377\275RL\377\274LF"
-  "\377\276VO\377\306yo\377\326\247\233\377\346\315\276\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\341\302\264\377\326\246\232\377\320\227\214\377\317\224"
-  "\211\377\317\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377"
-  "\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\317\224"
-  "\211\377\317\226\213\377\324\243\227\377\337\276\260\377\354\331\311\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\347"
-  "\317\300\377\332\262\245\377\322\234\221\377\317\224\211\377\317\225\212"
-  "\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\320"
-  "\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213"
-  "\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\317"
-  "\226\213\377\317\224\211\377\320\230\215\377\327\251\235\377\343\305\267"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\340\277\261\377\325\244\230\377\320\226\213\377\317"
-  "\224\211\377\317\226\213\377\320\226\213\377\320\226\213\377\320\226\213"
-  "\377\320\226\213\377\320\226\213\377\320\226\213\377\317\226\213\377\317"
-  "\224\211\377\320\226\213\377\325\245\231\377\341\302\264\377\355\333\314"
-  "\377\362\345\324\377\353\330\310\377\337\275\257\377\324\241\226\377\317"
-  "\225\212\377\317\224\211\377\320\226\213\377\320\226\213\377\320\226\213"
-  "\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\320"
-  "\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213"
-  "\377\320\226\213\377\320\226\213\377\317\224\211\377\317\225\212\377\324"
-  "\242\226\377\337\274\256\377\353\327\310f\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\344\310\272\377\330\254"
-  "\237\377\321\231\216\377\317\224\211\377\317\225\212\377\320\226\213\377"
-  "\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226"
-  "\213\377\320\226\213\377\317\224\211\377\317\225\212\377\323\237\223\377"
-  "\335\270\252\377\351\323\304\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\350\321\302\377\333\265\250\377\322\235\222\377\317\224\211\377\317"
-  "\224\212\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213"
-  "\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\320"
-  "\226\213\377\320\226\213\377\320\226\213\377\320\226\213\377\320\226\213"
-  "\377\317\226\213\377\317\224\211\377\320\227\214\377\326\247\233\377\342"
-  "\303\265\377\356\335\315f\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\354\332\312\""
-  "\347\316\277\377\344\310\272\377\343\307\270\377\344\310\271\377\344\310"
-  "\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377"
-  "\344\310\271\377\344\310\271\377\343\307\271\377\344\310\271\377\346\315"
-  "\276\377\353\330\310\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\357\340\320\"\351\323\304\377\345\312\273"
-  "\377\343\307\271\377\344\307\271\377\344\310\271\377\344\310\271\377\344"
-  "\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271"
-  "\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344"
-  "\310\271\377\344\310\271\377\344\307\271\377\343\307\270\377\344\310\272"
-  "\377\347\317\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\346\315\276\377"
-  "\344\310\271\377\343\307\270\377\344\310\271\377\344\310\271\377\344\310"
-  "\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377"
-  "\344\310\271\377\343\307\270\377\344\310\271\377\346\316\277\377\354\332"
-  "\312\377\362\346\325\377\365\352\332\377\361\344\324\377\353\327\310\377"
-  "\346\314\275\377\344\307\271\377\343\307\271\377\344\310\271\377\344\310"
-  "\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377"
-  "\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310"
-  "\271\377\344\310\271\377\344\310\271\377\344\310\271\377\343\307\271\377"
-  "\344\307\271\377\346\314\275\377\353\327\310f\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\350"
-  "\320\301\377\344\311\272\377\343\307\270\377\344\307\271\377\344\310\271"
-  "\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344"
-  "\310\271\377\344\310\271\377\343\307\271\377\344\307\271\377\345\313\274"
-  "\377\352\325\306\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-  "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-  "\000\000\000\377\351\324\305\377\345\312\274\377\343\307\271\377\343\307\271\377"
-  "\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310"
-  "\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377"
-  "\344\310\271\377\344\310\271\377\344\310\271\377\344\310\271\377\344\310"
-  "\271\377\343\307\270\377\344\310\272\377\347\316\277\377\354\332\312\314"
-  "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-  "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-  "\000\377\000\000\000\377\000\000\000\377",
-};
-
@@ -25,6 +25,7 @@
 
 #include "gpio.h"
 #include "mbox.h"
+#include "irq.h"
 
 /* PL011 UART registers */
 #define UART0_DR        ((volatile unsigned int*)(MMIO_BASE+0x00201000))
@@ -34,8 +35,29 @@
 #define UART0_LCRH      ((volatile unsigned int*)(MMIO_BASE+0x0020102C))
 #define UART0_CR        ((volatile unsigned int*)(MMIO_BASE+0x00201030))
 #define UART0_IMSC      ((volatile unsigned int*)(MMIO_BASE+0x00201038))
+#define UART0_MIS       ((volatile unsigned int*)(MMIO_BASE+0x00201040))
 #define UART0_ICR       ((volatile unsigned int*)(MMIO_BASE+0x00201044))
 
+#define UART_TXIM       (1<<5)  // Transmit interrupt, in IMSC, MIS and ICR
+#define UART_TXFF       (1<<5)  // Transmit FIFO full, in FR
+
+/*
+ * Once uart_irq_init has run, output is queued in tx_buffer and the transmit
+ * interrupt feeds it to the FIFO, so sending costs no more than a copy.
+ * Messages are only ever dropped whole: one that doesn't fit in what is left
+ * of the buffer is counted instead, and the count is sent as
+ * "[n bytes dropped]" ahead of the next message there is room for, unless it
+ * is sent with uart_puts_wait, which waits for room instead. Only core
+ * 0 may send from then on, as only its interrupts are masked while queueing.
+ */
+#define TX_BUFFER       4096    // bytes, a power of two
+
+static char tx_buffer[TX_BUFFER];
+static unsigned int tx_head;    // bytes queued
+static unsigned int tx_tail;    // bytes handed to the FIFO
+static unsigned int tx_dropped; // bytes dropped since the last note of it
+static int tx_irq;              // set once the interrupt drains the buffer
+
 void spin_for_cycles(int c) {
     while (c--) {
         asm volatile("nop");
@@ -83,14 +105,101 @@ void uart_init()
     *UART0_CR = 0x301;       // enable Tx, Rx, FIFO
 }
 
+/**
+ * Move queued bytes into the FIFO until it is full, and have the transmit
+ * interrupt call again only while some are left. Call with IRQs masked.
+ */
+static void tx_fill() {
+    while (tx_tail != tx_head && !(*UART0_FR&UART_TXFF)) {
+        *UART0_DR = tx_buffer[tx_tail++ & (TX_BUFFER-1)];
+    }
+    if (tx_tail != tx_head) {
+        *UART0_IMSC |= UART_TXIM;
+    } else {
+        *UART0_IMSC &= ~UART_TXIM;
+    }
+}
+
+static void tx_interrupt() {
+    if (*UART0_MIS&UART_TXIM) tx_fill();
+}
+
+static void tx_push(char c) {
+    tx_buffer[tx_head++ & (TX_BUFFER-1)] = c;
+}
+
+/**
+ * Queue the len bytes at s, each newline going out as "\r\n" if crlf is set.
+ * If they don't fit, wait for room if wait is set, or else count them as
+ * dropped
+ */
+static void tx_queue(const char *s, unsigned int len, int crlf, int wait) {
+    unsigned long daif = irq_save();
+    unsigned int room = TX_BUFFER - (tx_head - tx_tail);
+    unsigned int out = len; // bytes to queue, with the carriage returns
+    char note[32];
+    unsigned int n = 0;
+
+    if (crlf) {
+        for (unsigned int i = 0; i < len; i++) out += s[i]=='\n';
+    }
+
+    if (tx_dropped) {
+        char digits[10];
+        int d = 0;
+        unsigned int count = tx_dropped;
+
+        do digits[d++] = '0' + count % 10; while (count /= 10);
+        note[n++] = '[';
+        while (d) note[n++] = digits[--d];
+        for (const char *t = " bytes dropped]\r\n"; *t; t++) note[n++] = *t;
+    }
+
+    // the interrupt makes room, so let it in while waiting
+    while (wait && room < n + out) {
+        irq_restore(daif);
+        asm volatile("nop");
+        daif = irq_save();
+        room = TX_BUFFER - (tx_head - tx_tail);
+    }
+
+    if (room < n + out) {
+        tx_dropped += out;
+    } else {
+        for (unsigned int i = 0; i < n; i++) tx_push(note[i]);
+        tx_dropped = 0;
+        for (unsigned int i = 0; i < len; i++) {
+            if (crlf && s[i]=='\n') tx_push('\r');
+            tx_push(s[i]);
+        }
+        tx_fill();
+    }
+    irq_restore(daif);
+}
+
+/**
+ * Switch output over to the buffer drained by the transmit interrupt.
+ * Call on core 0 after irq_init.
+ */
+void uart_irq_init() {
+    *UART0_IMSC &= ~UART_TXIM;
+    *UART0_ICR = UART_TXIM;
+    tx_irq = irq_connect(IRQ_UART, tx_interrupt);
+}
+
 /**
  * Send a character
  */
 void uart_send(unsigned int c) {
+    if (tx_irq) {
+        char ch = c;
+        tx_queue(&ch, 1, 0, 0);
+        return;
+    }
     // wait until we can send
     do {
         asm volatile("nop");
-    } while(*UART0_FR&0x20);
+    } while(*UART0_FR&UART_TXFF);
     // write the character to the buffer
     *UART0_DR=c;
 }
@@ -111,10 +220,20 @@ char uart_getc() {
     return r=='\r'?'\n':r;
 }
 
+static unsigned int tx_length(char *s) {
+    unsigned int len = 0;
+    while (s[len]) len++;
+    return len;
+}
+
 /**
  * Display a string
  */
 void uart_puts(char *s) {
+    if (tx_irq) {
+        tx_queue(s, tx_length(s), 1, 0);
+        return;
+    }
     while(*s) {
         // convert newline to carrige return + newline
         if (*s=='\n') {
@@ -124,17 +243,33 @@ void uart_puts(char *s) {
     }
 }
 
+/**
+ * Display a string that mustn't be lost, waiting for room in the buffer
+ * if need be. s must fit in it
+ */
+void uart_puts_wait(char *s) {
+    if (tx_irq) {
+        tx_queue(s, tx_length(s), 1, 1);
+        return;
+    }
+    uart_puts(s);
+}
+
 /**
  * Display a binary value in hexadecimal
  */
 void uart_hex(unsigned int d) {
     unsigned int n;
     int c;
+    char s[9];
     for (c=28; c>=0; c-=4) {
         // get highest tetrad
         n = (d>>c) & 0xF;
         // 0-9 => '0'-'9', 10-15 => 'A'-'F'
         n += n>9 ?0x37:0x30;
-        uart_send(n);
+        s[7-c/4] = n;
     }
+    // send as one message, so it is never split by a full buffer
+    s[8] = 0;
+    uart_puts(s);
 }
@@ -25,10 +25,12 @@
 
 
 void uart_init();
+void uart_irq_init();
 void uart_send(unsigned int c);
 void spin_for_cycles(int c);
 char uart_getc();
 void uart_puts(char *s);
+void uart_puts_wait(char *s);
 void uart_hex(unsigned int d);
 
 /*
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+#
+# Builds the compressed asset pack.
+#
+# Reads GIMP "C-Source" RGBA image dumps, converts their pixels to the framebuffer's ARGB order and compresses each
+# one as an LZ4 block. The blocks go back to back into one byte array in asset_pack.c, and asset_pack.h gets an id
+# per image plus a table of where each block lives and how big it is once decoded. assets.c decodes them on demand.
+#
+#   python3 tools/mkassets.py source/asset_pack art/title_screen.h ...
+
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from mkatlas import load_gimp
+
+MINMATCH = 4
+LASTLITERALS = 5  # The block must end with at least this many literals...
+MFLIMIT = 12      # ...and the last match must start at least this far from the end.
+
+
+def lz4_compress(data):
+    """Greedy LZ4 block compression with a single-entry hash table, as in the reference fast mode."""
+    n = len(data)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+
+    def length(v):
+        while v >= 255:
+            out.append(255)
+            v -= 255
+        out.append(v)
+
+    while i < n - MFLIMIT:
+        key = data[i:i + MINMATCH]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > 0xFFFF:
+            i += 1
+            continue
+
+        # Extend the match forwards, then backwards over literals not yet emitted.
+        m = MINMATCH
+        end = n - LASTLITERALS
+        while i + m < end and data[cand + m] == data[i + m]:
+            m += 1
+        while i > anchor and cand > 0 and data[i - 1] == data[cand - 1]:
+            i -= 1
+            cand -= 1
+            m += 1
+
+        lit = i - anchor
+        out.append((min(lit, 15) << 4) | min(m - MINMATCH, 15))
+        if lit >= 15:
+            length(lit - 15)
+        out += data[anchor:i]
+        out += struct.pack('<H', i - cand)
+        if m - MINMATCH >= 15:
+            length(m - MINMATCH - 15)
+
+        i += m
+        anchor = i
+
+    lit = n - anchor
+    out.append(min(lit, 15) << 4)
+    if lit >= 15:
+        length(lit - 15)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    """Reference decoder, used to check every block before it is written out."""
+    out = bytearray()
+    i = 0
+    while True:
+        token = src[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += src[i:i + lit]
+        i += lit
+        if i == len(src):
+            break
+        off = src[i] | (src[i + 1] << 8)
+        i += 2
+        m = token & 15
+        if m == 15:
+            while True:
+                b = src[i]
+                i += 1
+                m += b
+                if b != 255:
+                    break
+        for _ in range(m + MINMATCH):
+            out.append(out[-off])
+    assert len(out) == size
+    return bytes(out)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: mkassets.py output-base image.h...')
+
+    base = sys.argv[1]
+    assets = []
+    for path in sys.argv[2:]:
+        name = os.path.splitext(os.path.basename(path))[0]
+        width, height, pixels = load_gimp(path, False)
+        raw = struct.pack('<%dI' % len(pixels), *pixels)
+        block = lz4_compress(raw)
+        if lz4_decompress(block, len(raw)) != raw:
+            sys.exit('%s: compression check failed' % path)
+        assets.append((name, width, height, block))
+
+    total = sum(len(a[3]) for a in assets)
+    words = sum(a[1] * a[2] for a in assets)
+
+    h = open(base + '.h', 'w')
+    h.write('/* Compressed asset pack, generated by tools/mkassets.py from the images in art/. Do not edit. */\n\n')
+    h.write('#ifndef ASSET_PACK_H\n#define ASSET_PACK_H\n\n')
+    for i, a in enumerate(assets):
+        h.write('#define ASSET_%s %d\n' % (a[0].upper(), i))
+    h.write('#define NUM_ASSETS %d\n\n' % len(assets))
+    h.write('#define ASSET_PACK_BYTES %d\n' % total)
+    h.write('#define ASSET_DECODED_WORDS %d // ARGB pixels of every asset together.\n\n' % words)
+    h.write('struct asset\n{\n    unsigned int offset;  // Start of the LZ4 block in asset_pack.\n'
+            '    unsigned int size;    // Compressed bytes.\n    unsigned int width;\n    unsigned int height;\n'
+            '    unsigned int decoded; // Start of the decoded pixels in the decode buffer, in words.\n};\n\n')
+    h.write('extern const struct asset asset_table[NUM_ASSETS];\n')
+    h.write('extern const unsigned char asset_pack[ASSET_PACK_BYTES];\n\n#endif\n')
+
+    c = open(base + '.c', 'w')
+    c.write('/* Compressed asset pack, generated by tools/mkassets.py from the images in art/. Do not edit. */\n\n')
+    c.write('#include "%s.h"\n\n' % os.path.basename(base))
+    c.write('const struct asset asset_table[NUM_ASSETS] = {\n')
+    offset = 0
+    decoded = 0
+    for name, width, height, block in assets:
+        c.write('    { %d, %d, %d, %d, %d }, // %s, %d bytes raw\n'
+                % (offset, len(block), width, height, decoded, name, width * height * 4))
+        offset += len(block)
+        decoded += width * height
+    c.write('};\n\n')
+    c.write('const unsigned char asset_pack[ASSET_PACK_BYTES] = {\n')
+    for name, width, height, block in assets:
+        c.write('    // %s\n' % name)
+        for i in range(0, len(block), 16):
+            c.write('    ' + ', '.join('0x%02x' % b for b in block[i:i + 16]) + ',\n')
+    c.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
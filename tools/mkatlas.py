@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+#
+# Packs sprites into one atlas header.
+#
+# Reads GIMP "C-Source" RGBA image dumps, converts their pixels to the framebuffer's ARGB order and encodes each
+# frame as rows of spans, so the blitter never touches transparent pixels. An index table gives each frame's offset
+# and size. Left-facing frames are not stored; they are drawn by mirroring the right-facing ones.
+#
+# Images listed after --key have their opaque black background keyed out, that is, made transparent.
+#
+#   python3 tools/mkatlas.py source/atlas.h art/mario_right1.h ... --key art/dk_right1.h ...
+#
+# Span format, all 32-bit words. Each row starts with its number of spans. Each span is a header word
+#     skip << 16 | length << 1 | blend
+# followed by length pixels. skip is the number of transparent pixels before the span. Spans with the blend bit set
+# hold partially transparent pixels, the rest are opaque and are copied. Anything after the last span is transparent.
+
+import codecs
+import os
+import re
+import sys
+
+KEY = 0xFF000000  # Opaque black.
+
+
+def load_gimp(path, key):
+    text = open(path, encoding='latin-1').read()
+    m = re.search(r'^\s*(\d+),\s*(\d+),\s*(\d+),', text, re.M)
+    width, height, bpp = map(int, m.groups())
+    if bpp != 4:
+        sys.exit('%s: expected an RGBA image' % path)
+
+    literal = ''.join(re.findall(r'"((?:[^"\\]|\\.)*)"', text[m.end():]))
+    data = codecs.escape_decode(literal.encode('latin-1'))[0]
+    if len(data) < width * height * 4:
+        sys.exit('%s: pixel data too short' % path)
+
+    pixels = []
+    for i in range(width * height):
+        r, g, b, a = data[4 * i:4 * i + 4]
+        p = (a << 24) | (r << 16) | (g << 8) | b
+        pixels.append(0 if key and p == KEY else p)
+    return width, height, pixels
+
+
+def encode(width, height, pixels):
+    words = []
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        spans = []
+        x = 0
+        while x < width:
+            skip = 0
+            while x < width and row[x] >> 24 == 0:
+                skip += 1
+                x += 1
+            if x == width:
+                break
+
+            blend = (row[x] >> 24) != 0xFF
+            start = x
+            while x < width and row[x] >> 24 != 0 and ((row[x] >> 24) != 0xFF) == blend:
+                x += 1
+            spans.append((skip, blend, row[start:x]))
+
+        words.append(len(spans))
+        for skip, blend, span in spans:
+            words.append((skip << 16) | (len(span) << 1) | int(blend))
+            words.extend(span)
+    return words
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: mkatlas.py output.h image.h... [--key image.h...]')
+
+    frames = []
+    key = False
+    for path in sys.argv[2:]:
+        if path == '--key':
+            key = True
+            continue
+        name = os.path.splitext(os.path.basename(path))[0]
+        width, height, pixels = load_gimp(path, key)
+        frames.append((name, width, height, encode(width, height, pixels), sum(1 for p in pixels if p >> 24)))
+
+    out = open(sys.argv[1], 'w')
+    out.write('/* Sprite atlas, generated by tools/mkatlas.py from the images in art/. Do not edit. */\n\n')
+
+    for i, f in enumerate(frames):
+        out.write('#define ATLAS_%s %d\n' % (f[0].upper(), i))
+    out.write('#define ATLAS_FRAMES %d\n\n' % len(frames))
+
+    out.write('struct atlas_frame\n{\n    unsigned int offset; // In words from the start of atlas_spans.\n'
+              '    unsigned int width;\n    unsigned int height;\n};\n\n')
+
+    out.write('static const struct atlas_frame atlas_frames[ATLAS_FRAMES] = {\n')
+    offset = 0
+    for name, width, height, words, drawn in frames:
+        out.write('    { %d, %d, %d }, // %s, %d of %d pixels drawn\n' % (offset, width, height, name, drawn, width * height))
+        offset += len(words)
+    out.write('};\n\n')
+
+    # Span-encoded ARGB, see fb_blit_spans.
+    out.write('#define ATLAS_WORDS %d\n\n' % offset)
+    out.write('static unsigned int atlas_spans[ATLAS_WORDS] __attribute__((aligned(64))) = {\n')
+    for name, width, height, words, drawn in frames:
+        out.write('    // %s\n' % name)
+        for i in range(0, len(words), 8):
+            out.write('    ' + ', '.join('0x%08x' % w for w in words[i:i + 8]) + ',\n')
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()